@@ -9,6 +9,18 @@
 
 namespace flutter {
 
+// Bounds the memory used by the lookup cache of apps that look up many
+// different names.
+static constexpr size_t kMaxLookupCacheEntries = 1024;
+
+// In debug builds the tooling may add files to a directory bundle while it is
+// in use, so assets that are missing are looked for again every time.
+#if FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG
+static constexpr bool kCacheMissingAssets = false;
+#else
+static constexpr bool kCacheMissingAssets = true;
+#endif
+
 AssetManager::AssetManager() = default;
 
 AssetManager::~AssetManager() = default;
@@ -19,6 +31,7 @@ bool AssetManager::PushFront(std::unique_ptr<AssetResolver> resolver) {
   }
 
   resolvers_.push_front(std::move(resolver));
+  ResetLookupCache();
   return true;
 }
 
@@ -28,6 +41,7 @@ bool AssetManager::PushBack(std::unique_ptr<AssetResolver> resolver) {
   }
 
   resolvers_.push_back(std::move(resolver));
+  ResetLookupCache();
   return true;
 }
 
@@ -53,12 +67,28 @@ void AssetManager::UpdateResolverByType(
     new_resolvers.push_back(std::move(updated_asset_resolver));
   }
   resolvers_.swap(new_resolvers);
+  ResetLookupCache();
 }
 
 std::deque<std::unique_ptr<AssetResolver>> AssetManager::TakeResolvers() {
+  ResetLookupCache();
   return std::move(resolvers_);
 }
 
+void AssetManager::ResetLookupCache() {
+  std::scoped_lock lock(lookup_cache_mutex_);
+  lookup_cache_.clear();
+}
+
+void AssetManager::CacheLookup(const std::string& asset_name,
+                               const AssetResolver* resolver) const {
+  std::scoped_lock lock(lookup_cache_mutex_);
+  if (lookup_cache_.size() >= kMaxLookupCacheEntries) {
+    lookup_cache_.clear();
+  }
+  lookup_cache_[asset_name] = resolver;
+}
+
 // |AssetResolver|
 std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
     const std::string& asset_name) const {
@@ -67,13 +97,34 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   }
   TRACE_EVENT1("flutter", "AssetManager::GetAsMapping", "name",
                asset_name.c_str());
+  std::optional<const AssetResolver*> cached_resolver;
+  {
+    std::scoped_lock lock(lookup_cache_mutex_);
+    auto found = lookup_cache_.find(asset_name);
+    if (found != lookup_cache_.end()) {
+      cached_resolver = found->second;
+    }
+  }
+  if (cached_resolver.has_value()) {
+    if (cached_resolver.value() == nullptr) {
+      return nullptr;
+    }
+    // Fall back to asking all resolvers if the asset went away.
+    if (auto mapping = cached_resolver.value()->GetAsMapping(asset_name)) {
+      return mapping;
+    }
+  }
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
     if (mapping != nullptr) {
+      CacheLookup(asset_name, resolver.get());
       return mapping;
     }
   }
   FML_DLOG(WARNING) << "Could not find asset: " << asset_name;
+  if (kCacheMissingAssets) {
+    CacheLookup(asset_name, nullptr);
+  }
   return nullptr;
 }
 
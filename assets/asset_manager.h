@@ -7,7 +7,9 @@
 
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <optional>
 #include "flutter/assets/asset_resolver.h"
@@ -90,6 +92,16 @@ class AssetManager final : public AssetResolver {
 
  private:
   std::deque<std::unique_ptr<AssetResolver>> resolvers_;
+  // The resolver each asset that was looked up was found in, so that the
+  // resolvers before it aren't asked again. A null resolver marks an asset that
+  // none of them had. Assets are looked up on several threads.
+  mutable std::mutex lookup_cache_mutex_;
+  mutable std::unordered_map<std::string, const AssetResolver*> lookup_cache_;
+
+  void ResetLookupCache();
+
+  void CacheLookup(const std::string& asset_name,
+                   const AssetResolver* resolver) const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManager);
 };
@@ -57,6 +57,8 @@ std::unique_ptr<fml::Mapping> DirectoryAssetBundle::GetAsMapping(
     return nullptr;
   }
 
+  // Assets are decoded front to back, so let the kernel read ahead.
+  mapping->Advise(fml::FileMapping::AccessPattern::kSequential);
   return mapping;
 }
 
@@ -87,6 +89,7 @@ std::vector<std::unique_ptr<fml::Mapping>> DirectoryAssetBundle::GetAsMappings(
       auto mapping = std::make_unique<fml::FileMapping>(fd);
 
       if (mapping && mapping->IsValid()) {
+        mapping->Advise(fml::FileMapping::AccessPattern::kSequential);
         mappings.push_back(std::move(mapping));
       } else {
         FML_LOG(ERROR) << "Mapping " << filename << " failed";
@@ -8,13 +8,14 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "flutter/fml/base32.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/hex_codec.h"
 #include "flutter/fml/logging.h"
-#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -221,11 +222,22 @@ size_t PersistentCache::PrecompileKnownSkSLs(GrDirectContext* context) const {
 std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   TRACE_EVENT0("flutter", "PersistentCache::LoadSkSLs");
   std::vector<PersistentCache::SkSLCache> result;
-  fml::FileVisitor visitor = [&result](const fml::UniqueFD& directory,
-                                       const std::string& filename) {
+  // SkSLs that were cached during previous runs are usually also packaged
+  // with the application. Only keep the first of them so that they are not
+  // precompiled twice.
+  std::unordered_set<std::string> keys;
+  auto add_sksl = [&result, &keys](SkSLCache cache) {
+    std::string key(static_cast<const char*>(cache.key->data()),
+                    cache.key->size());
+    if (keys.insert(std::move(key)).second) {
+      result.push_back(std::move(cache));
+    }
+  };
+  fml::FileVisitor visitor = [&add_sksl](const fml::UniqueFD& directory,
+                                         const std::string& filename) {
     SkSLCache cache = LoadFile(directory, filename, true);
     if (cache.key != nullptr && cache.value != nullptr) {
-      result.push_back(cache);
+      add_sksl(std::move(cache));
     } else {
       FML_LOG(ERROR) << "Failed to load: " << filename;
     }
@@ -264,7 +276,7 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
         sk_sp<SkData> key = ParseBase32(item.name.GetString());
         sk_sp<SkData> sksl = ParseBase64(item.value.GetString());
         if (key != nullptr && sksl != nullptr) {
-          result.push_back({key, sksl});
+          add_sksl({key, sksl});
         } else {
           FML_LOG(ERROR) << "Failed to load: " << item.name.GetString();
         }
@@ -275,11 +287,93 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   return result;
 }
 
+// A write-behind queue of the files stored into the persistent cache.
+//
+// Skia stores shaders from within its compile callback on the raster thread,
+// often many of them in the same frame. Rather than posting a task for each
+// of them, stores are queued and the queue is written out by a single task
+// on the worker, which also drops stores that a later store of the same file
+// made redundant.
+class PersistentCache::StoreQueue
+    : public std::enable_shared_from_this<StoreQueue> {
+ public:
+  void Enqueue(const fml::RefPtr<fml::TaskRunner>& worker,
+               std::shared_ptr<fml::UniqueFD> directory,
+               std::string file_name,
+               std::unique_ptr<fml::Mapping> mapping) {
+    {
+      std::scoped_lock lock(mutex_);
+      bool replaced = false;
+      for (PendingStore& store : pending_stores_) {
+        if (store.directory == directory && store.file_name == file_name) {
+          store.mapping = std::move(mapping);
+          replaced = true;
+          break;
+        }
+      }
+      if (!replaced) {
+        pending_stores_.push_back({std::move(directory), std::move(file_name),
+                                   std::move(mapping)});
+      }
+      if (worker && flush_posted_) {
+        return;
+      }
+      flush_posted_ = !!worker;
+    }
+
+    if (!worker) {
+      FML_LOG(WARNING)
+          << "The persistent cache has no available workers. Performing the "
+             "task on the current thread. This slow operation is going to "
+             "occur on a frame workload.";
+      Flush();
+    } else {
+      worker->PostTask([queue = shared_from_this()]() { queue->Flush(); });
+    }
+  }
+
+ private:
+  struct PendingStore {
+    std::shared_ptr<fml::UniqueFD> directory;
+    std::string file_name;
+    std::unique_ptr<fml::Mapping> mapping;
+  };
+
+  void Flush() {
+    std::vector<PendingStore> stores;
+    {
+      std::scoped_lock lock(mutex_);
+      stores.swap(pending_stores_);
+      flush_posted_ = false;
+    }
+    if (stores.empty()) {
+      return;
+    }
+
+    TRACE_EVENT1("flutter", "PersistentCacheStore", "count",
+                 std::to_string(stores.size()).c_str());
+    for (const PendingStore& store : stores) {
+      if (!fml::WriteAtomically(*store.directory,        //
+                                store.file_name.c_str(),  //
+                                *store.mapping)           //
+      ) {
+        FML_LOG(WARNING)
+            << "Could not write cache contents to persistent store.";
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::vector<PendingStore> pending_stores_;
+  bool flush_posted_ = false;
+};
+
 PersistentCache::PersistentCache(bool read_only)
     : is_read_only_(read_only),
       cache_directory_(MakeCacheDirectory(cache_base_path_, read_only, false)),
       sksl_cache_directory_(
-          MakeCacheDirectory(cache_base_path_, read_only, true)) {
+          MakeCacheDirectory(cache_base_path_, read_only, true)),
+      store_queue_(std::make_shared<StoreQueue>()) {
   if (!IsValid()) {
     FML_LOG(WARNING) << "Could not acquire the persistent cache directory. "
                         "Caching of GPU resources on disk is disabled.";
@@ -344,37 +438,6 @@ sk_sp<SkData> PersistentCache::load(const SkData& key) {
   return result;
 }
 
-static void PersistentCacheStore(
-    const fml::RefPtr<fml::TaskRunner>& worker,
-    const std::shared_ptr<fml::UniqueFD>& cache_directory,
-    std::string key,
-    std::unique_ptr<fml::Mapping> value) {
-  // The static leak checker gets confused by the use of fml::MakeCopyable.
-  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-  auto task = fml::MakeCopyable([cache_directory,             //
-                                 file_name = std::move(key),  //
-                                 mapping = std::move(value)   //
-  ]() mutable {
-    TRACE_EVENT0("flutter", "PersistentCacheStore");
-    if (!fml::WriteAtomically(*cache_directory,   //
-                              file_name.c_str(),  //
-                              *mapping)           //
-    ) {
-      FML_LOG(WARNING) << "Could not write cache contents to persistent store.";
-    }
-  });
-
-  if (!worker) {
-    FML_LOG(WARNING)
-        << "The persistent cache has no available workers. Performing the task "
-           "on the current thread. This slow operation is going to occur on a "
-           "frame workload.";
-    task();
-  } else {
-    worker->PostTask(std::move(task));
-  }
-}
-
 std::unique_ptr<fml::MallocMapping> PersistentCache::BuildCacheObject(
     const SkData& key,
     const SkData& data) {
@@ -418,9 +481,9 @@ void PersistentCache::store(const SkData& key, const SkData& data) {
     return;
   }
 
-  PersistentCacheStore(GetWorkerTaskRunner(),
-                       cache_sksl_ ? sksl_cache_directory_ : cache_directory_,
-                       std::move(file_name), std::move(mapping));
+  store_queue_->Enqueue(GetWorkerTaskRunner(),
+                        cache_sksl_ ? sksl_cache_directory_ : cache_directory_,
+                        std::move(file_name), std::move(mapping));
 }
 
 void PersistentCache::DumpSkp(const SkData& data) {
@@ -437,8 +500,8 @@ void PersistentCache::DumpSkp(const SkData& data) {
   FML_LOG(INFO) << "Dumping " << file_name;
   auto mapping = std::make_unique<fml::DataMapping>(
       std::vector<uint8_t>{data.bytes(), data.bytes() + data.size()});
-  PersistentCacheStore(GetWorkerTaskRunner(), cache_directory_,
-                       std::move(file_name), std::move(mapping));
+  store_queue_->Enqueue(GetWorkerTaskRunner(), cache_directory_,
+                        std::move(file_name), std::move(mapping));
 }
 
 void PersistentCache::AddWorkerTaskRunner(
@@ -95,7 +95,9 @@ class PersistentCache : public GrContextOptions::PersistentCache {
     sk_sp<SkData> value;
   };
 
-  /// Load all the SkSL shader caches in the right directory.
+  /// Load all the SkSL shader caches in the right directory and the SkSLs
+  /// packaged with the application. A key that is both cached and packaged is
+  /// only returned once, with its cached SkSL.
   std::vector<SkSLCache> LoadSkSLs() const;
 
   //----------------------------------------------------------------------------
@@ -133,6 +135,8 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   static constexpr char kAssetFileName[] = "io.flutter.shaders.json";
 
  private:
+  class StoreQueue;
+
   static std::string cache_base_path_;
 
   static std::shared_ptr<AssetManager> asset_manager_;
@@ -155,6 +159,8 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   const std::shared_ptr<fml::UniqueFD> sksl_cache_directory_;
   mutable std::mutex worker_task_runners_mutex_;
   std::multiset<fml::RefPtr<fml::TaskRunner>> worker_task_runners_;
+  // Shared with the pending flush tasks, which may outlive this cache.
+  const std::shared_ptr<StoreQueue> store_queue_;
 
   bool stored_new_shaders_ = false;
   bool is_dumping_skp_ = false;
@@ -57,6 +57,14 @@ class Texture : public ContextListener {
   // Called on raster thread.
   virtual void MarkNewFrameAvailable() = 0;
 
+  // Called on raster thread, along with |MarkNewFrameAvailable|.
+  void IncrementFrameGeneration() { frame_generation_++; }
+
+  // The number of frames that have been made available for this texture.
+  // Texture layers compare it across layer trees to tell whether the texture
+  // has new contents to paint.
+  uint64_t frame_generation() const { return frame_generation_; }
+
   // Called on raster thread.
   virtual void OnTextureUnregistered() = 0;
 
@@ -64,6 +72,7 @@ class Texture : public ContextListener {
 
  private:
   int64_t id_;
+  uint64_t frame_generation_ = 0;
   FML_DISALLOW_COPY_AND_ASSIGN(Texture);
 };
 
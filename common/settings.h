@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "flutter/common/startup_timeline.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/mapping.h"
@@ -40,11 +41,34 @@ class FrameTiming {
 
   static constexpr int kStatisticsCount = kCount + 5;
 
+  /// Steps of the rasterization of a frame, between `kRasterStart` and
+  /// `kRasterFinish`. Their durations are summed over all views drawn in the
+  /// frame and are not part of the statistics reported to the framework.
+  enum RasterPhase {
+    /// Computing the damage of the frame for partial repaint.
+    kDiff,
+    /// Prerolling the layer tree.
+    kPreroll,
+    /// Painting the layer tree into the surface canvas.
+    kPaint,
+    /// Submitting the surface frames. With Impeller, this includes encoding
+    /// and submitting the commands of the frame and presenting it.
+    kSubmit,
+    kRasterPhaseCount
+  };
+
   fml::TimePoint Get(Phase phase) const { return data_[phase]; }
   fml::TimePoint Set(Phase phase, fml::TimePoint value) {
     return data_[phase] = value;
   }
 
+  fml::TimeDelta GetRasterPhaseDuration(RasterPhase phase) const {
+    return raster_phase_durations_[phase];
+  }
+  void SetRasterPhaseDuration(RasterPhase phase, fml::TimeDelta duration) {
+    raster_phase_durations_[phase] = duration;
+  }
+
   uint64_t GetFrameNumber() const { return frame_number_; }
   void SetFrameNumber(uint64_t frame_number) { frame_number_ = frame_number; }
   uint64_t GetLayerCacheCount() const { return layer_cache_count_; }
@@ -63,6 +87,7 @@ class FrameTiming {
 
  private:
   fml::TimePoint data_[kCount];
+  fml::TimeDelta raster_phase_durations_[kRasterPhaseCount];
   uint64_t frame_number_;
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
@@ -232,6 +257,66 @@ struct Settings {
   // Some devices claim to support the required APIs but crash on their usage.
   bool enable_opengl_gpu_tracing = false;
 
+  // Preroll the children of wide container layers on the concurrent worker
+  // task runner instead of only on the raster thread.
+  bool enable_concurrent_preroll = false;
+
+  // With Skia, record large display lists in tiles into deferred display
+  // lists on the concurrent worker task runner and replay them on the raster
+  // thread.
+  bool enable_deferred_tile_rasterization = false;
+
+  // Move the UI and raster threads between the performance and the
+  // efficiency cores depending on how long they take to produce frames,
+  // instead of keeping them on the performance cores.
+  bool enable_adaptive_thread_affinity = false;
+
+  // The most frames the UI thread may have built ahead of the raster thread.
+  // A deeper pipeline lets the UI thread keep building while one frame takes
+  // long to rasterize. 0 keeps the default depth.
+  uint32_t frame_pipeline_depth = 0;
+
+  // When the raster thread falls behind, skip a queued frame whose target
+  // time has passed if a newer frame is queued behind it, instead of drawing
+  // every queued frame late.
+  bool drop_late_frames = false;
+
+  // Start building a frame as late after the vsync as the recent frames allow
+  // it to still be rasterized by its target time, rather than right away.
+  bool enable_frame_pacing = false;
+
+  // Ask the display to refresh at 60, 30 or 24 Hz when the content being
+  // animated doesn't need it to refresh any faster.
+  bool enable_content_frame_rate = false;
+
+  // Dispatch pointer moves once per frame, resampled for the time of the
+  // vsync, instead of the way the platform view would dispatch them.
+  bool enable_pointer_resampling = false;
+
+  // Merge the pointer data packets that queue up while the UI thread is busy,
+  // dropping the moves of a pointer that the next move of it makes stale.
+  bool coalesce_pointer_moves = false;
+
+  // Don't rasterize or present a frame whose layer tree draws the same pixels
+  // as the last one. The surface must keep showing the last frame presented
+  // until it is handed a new one.
+  bool skip_unchanged_frames = false;
+
+  // When several views are drawn in the same frame, prepare their frames for
+  // submission on the concurrent worker task runner. Frames are still
+  // submitted on the raster thread, in view order.
+  bool enable_concurrent_view_rasterization = false;
+
+  // While the platform view sets up the GPU context, warm the heap snapshot
+  // of the root isolate and the default font manager on the concurrent
+  // worker task runner.
+  bool enable_parallel_startup = false;
+
+  // With Impeller, decode images that are stored as YUV, such as most JPEGs,
+  // into their luma and chroma planes and convert them to RGB on the GPU
+  // instead of on the CPU.
+  bool enable_yuv_image_decoding = false;
+
   // Data set by platform-specific embedders for use in font initialization.
   uint32_t font_initialization_data = 0;
 
@@ -312,6 +397,10 @@ struct Settings {
   // soon as a frame is rasterized.
   FrameRasterizedCallback frame_rasterized_callback;
 
+  // Callback to handle the startup timeline of the shell. This is called once,
+  // on the raster thread, after the first frame is rasterized.
+  StartupTimelineCallback startup_timeline_callback;
+
   // This data will be available to the isolate immediately on launch via the
   // PlatformDispatcher.getPersistentIsolateData callback. This is meant for
   // information that the isolate cannot request asynchronously (platform
@@ -330,6 +419,11 @@ struct Settings {
   // Max bytes threshold of resource cache, or 0 for unlimited.
   size_t resource_cache_max_bytes_threshold = 0;
 
+  // Max bytes of decoded images, and the encoded data they were decoded from,
+  // that the engine keeps around so that decoding the same bytes again is
+  // free, or 0 to not cache decoded images.
+  size_t decoded_image_cache_max_bytes = 0;
+
   /// The minimum number of samples to require in multipsampled anti-aliasing.
   ///
   /// Setting this value to 0 or 1 disables MSAA.
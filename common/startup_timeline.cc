@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/common/startup_timeline.h"
+
+namespace flutter {
+
+const char* StartupTimeline::GetPhaseName(Phase phase) {
+  switch (phase) {
+    case kSnapshotMapping:
+      return "SnapshotMapping";
+    case kVMInit:
+      return "VMInit";
+    case kContextCreation:
+      return "ContextCreation";
+    case kIsolateRun:
+      return "IsolateRun";
+    case kFirstBuild:
+      return "FirstBuild";
+    case kFirstRaster:
+      return "FirstRaster";
+    case kFirstPresent:
+      return "FirstPresent";
+    case kCount:
+      break;
+  }
+  return "Unknown";
+}
+
+const char* StartupTimeline::GetThreadName(Thread thread) {
+  switch (thread) {
+    case kPlatformThread:
+      return "platform";
+    case kUIThread:
+      return "ui";
+    case kRasterThread:
+      return "raster";
+    case kIOThread:
+      return "io";
+  }
+  return "unknown";
+}
+
+void StartupTimeline::RecordPhase(Phase phase,
+                                  fml::TimePoint start,
+                                  fml::TimeDelta duration,
+                                  Thread thread) {
+  if (records_[phase].has_value()) {
+    return;
+  }
+  records_[phase] = Record{start, duration, thread};
+}
+
+void StartupTimeline::Merge(const StartupTimeline& other) {
+  for (size_t i = 0; i < records_.size(); i++) {
+    if (!records_[i].has_value()) {
+      records_[i] = other.records_[i];
+    }
+  }
+}
+
+}  // namespace flutter
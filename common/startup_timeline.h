@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_COMMON_STARTUP_TIMELINE_H_
+#define FLUTTER_COMMON_STARTUP_TIMELINE_H_
+
+#include <array>
+#include <functional>
+#include <optional>
+
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// The steps a shell goes through from its creation to the presentation of
+/// its first frame. Unlike the trace events of the same steps, the timeline is
+/// recorded whether or not tracing is enabled, so that cold starts can be
+/// compared across devices.
+class StartupTimeline {
+ public:
+  enum Phase {
+    /// Mapping the VM and isolate snapshots from the settings.
+    kSnapshotMapping,
+    /// Launching the Dart VM. Only recorded by the shell that launched the VM
+    /// of the process.
+    kVMInit,
+    /// Creating the platform view and its rendering context. With Impeller,
+    /// this includes loading the shader libraries of the context.
+    kContextCreation,
+    /// Preparing the root isolate and running its entrypoint.
+    kIsolateRun,
+    /// Building the first frame.
+    kFirstBuild,
+    /// Rasterizing the first frame, including its presentation.
+    kFirstRaster,
+    /// Submitting and presenting the first frame.
+    kFirstPresent,
+    kCount
+  };
+
+  /// The engine threads the phases run on.
+  enum Thread { kPlatformThread, kUIThread, kRasterThread, kIOThread };
+
+  struct Record {
+    fml::TimePoint start;
+    fml::TimeDelta duration;
+    Thread thread = kPlatformThread;
+  };
+
+  static const char* GetPhaseName(Phase phase);
+
+  static const char* GetThreadName(Thread thread);
+
+  /// Records a phase unless it is already recorded, as only the first time
+  /// a phase runs is part of the startup.
+  void RecordPhase(Phase phase,
+                   fml::TimePoint start,
+                   fml::TimeDelta duration,
+                   Thread thread);
+
+  /// Records the phases of |other| that are not recorded yet.
+  void Merge(const StartupTimeline& other);
+
+  const std::optional<Record>& GetPhase(Phase phase) const {
+    return records_[phase];
+  }
+
+  bool HasPhase(Phase phase) const { return records_[phase].has_value(); }
+
+ private:
+  std::array<std::optional<Record>, kCount> records_;
+};
+
+using StartupTimelineCallback = std::function<void(const StartupTimeline&)>;
+
+}  // namespace flutter
+
+#endif  // FLUTTER_COMMON_STARTUP_TIMELINE_H_
@@ -3,16 +3,24 @@
 // found in the LICENSE file.
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/benchmarking/dl_op_benchmarks.h"
+#include "flutter/display_list/skia/dl_sk_dispatcher.h"
 #include "flutter/display_list/testing/dl_test_snippets.h"
+#include "flutter/display_list/utils/dl_receiver_utils.h"
+#include "third_party/skia/include/utils/SkNoDrawCanvas.h"
 
 namespace flutter {
 
-DlOpReceiver& DisplayListBuilderBenchmarkAccessor(DisplayListBuilder& builder) {
-  return builder.asReceiver();
-}
-
 namespace {
 
+// Receives every op and does nothing with it, to measure the cost of the
+// dispatch loop itself.
+class IgnoreAllDispatcher : public virtual DlOpReceiver,
+                            public IgnoreAttributeDispatchHelper,
+                            public IgnoreClipDispatchHelper,
+                            public IgnoreTransformDispatchHelper,
+                            public IgnoreDrawDispatchHelper {};
+
 static std::vector<testing::DisplayListInvocationGroup> allRenderingOps =
     testing::CreateAllRenderingOps();
 
@@ -149,6 +157,24 @@ static void BM_DisplayListBuilderWithSaveLayerAndImageFilter(
   }
 }
 
+[[maybe_unused]] static const bool kOpBenchmarksRegistered = [] {
+  testing::RegisterDisplayListBuilderOpBenchmarks();
+  testing::RegisterDisplayListDispatchOpBenchmarks(
+      "IgnoreAll", [](const DisplayList& display_list, const SkRect& cull) {
+        IgnoreAllDispatcher receiver;
+        display_list.Dispatch(receiver, cull);
+      });
+  // The canvas forwards the calls through the SkCanvas API without
+  // rasterizing, so only the cost of converting the ops is measured.
+  testing::RegisterDisplayListDispatchOpBenchmarks(
+      "SkCanvas", [](const DisplayList& display_list, const SkRect& cull) {
+        SkNoDrawCanvas canvas(1000, 1000);
+        DlSkCanvasDispatcher receiver(&canvas);
+        display_list.Dispatch(receiver, cull);
+      });
+  return true;
+}();
+
 BENCHMARK_CAPTURE(BM_DisplayListBuilderDefault,
                   kDefault,
                   DisplayListBuilderBenchmarkType::kDefault)
@@ -0,0 +1,362 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/benchmarking/dl_complexity_impeller.h"
+
+// Unlike the GL and Metal calculators, the weightings used in this file have
+// not yet been fitted to DisplayListBenchmarks runs. They are first order
+// estimates of the relative cost of the work that Impeller does for each op,
+// normalised the same way as the other calculators so that 0.0005ms results
+// in a score of 100, and should be refined once benchmark data is available.
+//
+// See the comments in display_list_complexity_helper.h for details on the
+// normalisation.
+
+namespace flutter {
+
+namespace {
+
+// Every draw records an Entity and encodes its own draw call, regardless of
+// how much it covers.
+constexpr unsigned int kDrawCallComplexity = 1000;  // 0.005ms
+
+// Allocating an offscreen render target, rendering into it and compositing
+// it back into its parent pass.
+constexpr unsigned int kOffscreenPassComplexity = 60000;  // 0.3ms
+
+// Advanced blend modes read the destination, which needs a copy of the
+// backdrop on devices without framebuffer fetch.
+constexpr unsigned int kAdvancedBlendComplexity = 30000;  // 0.15ms
+
+// Every path that is filled or stroked is flattened and tessellated on the
+// CPU, and the resulting vertices are uploaded for the draw.
+constexpr unsigned int kPathComplexity = 4000;  // 0.02ms
+
+// Updating the glyph atlas is paid once for all of the text in a frame.
+constexpr unsigned int kGlyphAtlasComplexity = 20000;  // 0.1ms
+
+bool IsAdvancedBlendMode(DlBlendMode mode) {
+  return mode > DlBlendMode::kModulate;
+}
+
+}  // namespace
+
+DisplayListImpellerComplexityCalculator*
+    DisplayListImpellerComplexityCalculator::instance_ = nullptr;
+
+DisplayListImpellerComplexityCalculator*
+DisplayListImpellerComplexityCalculator::GetInstance() {
+  if (instance_ == nullptr) {
+    instance_ = new DisplayListImpellerComplexityCalculator();
+  }
+  return instance_;
+}
+
+unsigned int
+DisplayListImpellerComplexityCalculator::ImpellerHelper::BatchedComplexity() {
+  // Each saveLayer renders into its own offscreen pass.
+  unsigned int save_layer_complexity =
+      save_layer_count_ * kOffscreenPassComplexity;
+
+  unsigned int draw_text_complexity;
+  if (draw_text_count_ == 0) {
+    draw_text_complexity = 0;
+  } else {
+    // Once the glyph atlas is up to date each run of text is a single
+    // textured draw.
+    draw_text_complexity =
+        kGlyphAtlasComplexity + draw_text_count_ * kDrawCallComplexity;
+  }
+
+  return save_layer_complexity + draw_text_complexity;
+}
+
+unsigned int DisplayListImpellerComplexityCalculator::ImpellerHelper::
+    AttributeComplexity(bool analytic_blur) {
+  unsigned int complexity = 0;
+  if (has_mask_blur_ && !analytic_blur) {
+    // The draw is rendered into an offscreen texture and blurred.
+    complexity += kOffscreenPassComplexity;
+  }
+  if (has_image_filter_) {
+    complexity += kOffscreenPassComplexity;
+  }
+  if (IsAdvancedBlendMode(blend_mode_)) {
+    complexity += kAdvancedBlendComplexity;
+  }
+  return complexity;
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::
+    AccumulateDrawComplexity(unsigned int geometry_complexity,
+                             bool analytic_blur) {
+  if (IsComplex()) {
+    return;
+  }
+  AccumulateComplexity(kDrawCallComplexity + geometry_complexity +
+                       AttributeComplexity(analytic_blur));
+}
+
+unsigned int DisplayListImpellerComplexityCalculator::ImpellerHelper::
+    PathTessellationComplexity(const SkPath& path) {
+  // Curves are subdivided into many line segments before tessellation, and
+  // strokes generate a pair of vertices for each of those segments plus
+  // their joins and caps.
+  unsigned int complexity =
+      kPathComplexity + CalculatePathComplexity(path, 100, 400, 500, 800);
+  if (DrawStyle() != DlDrawStyle::kFill) {
+    complexity += complexity / 2;
+  }
+  return complexity;
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::setBlendMode(
+    DlBlendMode mode) {
+  blend_mode_ = mode;
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::setImageFilter(
+    const DlImageFilter* filter) {
+  has_image_filter_ = filter != nullptr;
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::setMaskFilter(
+    const DlMaskFilter* filter) {
+  has_mask_blur_ =
+      filter != nullptr && filter->type() == DlMaskFilterType::kBlur;
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::saveLayer(
+    const SkRect* bounds,
+    const SaveLayerOptions options,
+    const DlImageFilter* backdrop) {
+  if (IsComplex()) {
+    return;
+  }
+  if (backdrop) {
+    // Flutter does not offer this operation so this value can only ever be
+    // non-null for a frame-wide builder which is not currently evaluated for
+    // complexity.
+    AccumulateComplexity(Ceiling());
+  }
+  save_layer_count_++;
+  if (options.renders_with_attributes()) {
+    // The layer is filtered into another offscreen texture and blended into
+    // its parent when it is restored.
+    if (has_image_filter_) {
+      AccumulateComplexity(kOffscreenPassComplexity);
+    }
+    if (IsAdvancedBlendMode(blend_mode_)) {
+      AccumulateComplexity(kAdvancedBlendComplexity);
+    }
+  }
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawLine(
+    const SkPoint& p0,
+    const SkPoint& p1) {
+  // Lines are expanded into a quad, plus a few vertices for round caps,
+  // without going through the tessellator.
+  AccumulateDrawComplexity(100);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawRect(
+    const SkRect& rect) {
+  // Filled rects are drawn directly from their corners. Stroked rects are
+  // stroked as a path with four lines.
+  if (DrawStyle() == DlDrawStyle::kFill) {
+    AccumulateDrawComplexity(0, true);
+  } else {
+    AccumulateDrawComplexity(PathTessellationComplexity(SkPath::Rect(rect)));
+  }
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawOval(
+    const SkRect& bounds) {
+  if (bounds.width() == bounds.height()) {
+    drawCircle(bounds.center(), bounds.width() / 2);
+    return;
+  }
+  AccumulateDrawComplexity(PathTessellationComplexity(SkPath::Oval(bounds)));
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawCircle(
+    const SkPoint& center,
+    SkScalar radius) {
+  // Circles skip the tessellator, but the number of vertices generated for
+  // them grows with the radius.
+  unsigned int complexity = (radius + 50) * 2;
+  AccumulateDrawComplexity(complexity, DrawStyle() == DlDrawStyle::kFill);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawRRect(
+    const SkRRect& rrect) {
+  if (rrect.isRect()) {
+    drawRect(rrect.rect());
+    return;
+  }
+  // Blurred simple rrects are drawn analytically, everything else is
+  // tessellated as a path.
+  bool analytic_blur = DrawStyle() == DlDrawStyle::kFill &&
+                       rrect.getType() == SkRRect::Type::kSimple_Type;
+  AccumulateDrawComplexity(PathTessellationComplexity(SkPath::RRect(rrect)),
+                           analytic_blur);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawDRRect(
+    const SkRRect& outer,
+    const SkRRect& inner) {
+  SkPath path;
+  path.addRRect(outer);
+  path.addRRect(inner);
+  AccumulateDrawComplexity(PathTessellationComplexity(path));
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawPath(
+    const SkPath& path) {
+  AccumulateDrawComplexity(PathTessellationComplexity(path));
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawArc(
+    const SkRect& oval_bounds,
+    SkScalar start_degrees,
+    SkScalar sweep_degrees,
+    bool use_center) {
+  SkPath path;
+  if (use_center) {
+    path.moveTo(oval_bounds.center());
+  }
+  path.arcTo(oval_bounds, start_degrees, sweep_degrees, !use_center);
+  if (use_center) {
+    path.close();
+  }
+  AccumulateDrawComplexity(PathTessellationComplexity(path));
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawPoints(
+    DlCanvas::PointMode mode,
+    uint32_t count,
+    const SkPoint points[]) {
+  unsigned int complexity;
+  if (mode == DlCanvas::PointMode::kPoints) {
+    // Points are expanded into quads or circles in a single draw.
+    complexity = count * 20;
+  } else {
+    // Lines and polygons are stroked as a path.
+    complexity = kPathComplexity + count * 150;
+  }
+  AccumulateDrawComplexity(complexity);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawVertices(
+    const DlVertices* vertices,
+    DlBlendMode mode) {
+  // Vertices are uploaded as they are, without tessellation.
+  unsigned int complexity = vertices->vertex_count() * 2;
+  if (IsAdvancedBlendMode(mode)) {
+    complexity += kAdvancedBlendComplexity;
+  }
+  AccumulateDrawComplexity(complexity);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawImage(
+    const sk_sp<DlImage> image,
+    const SkPoint point,
+    DlImageSampling sampling,
+    bool render_with_attributes) {
+  ImageRect(image->dimensions(), image->isTextureBacked(),
+            render_with_attributes, false);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::ImageRect(
+    const SkISize& size,
+    bool texture_backed,
+    bool render_with_attributes,
+    bool enforce_src_edges) {
+  // Textures are sampled in a single draw, but images that are not backed
+  // by a texture have to be uploaded first, which scales with their area.
+  unsigned int complexity = 0;
+  if (!texture_backed) {
+    complexity = size.width() * size.height() / 100;
+  }
+  AccumulateDrawComplexity(complexity);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawImageNine(
+    const sk_sp<DlImage> image,
+    const SkIRect& center,
+    const SkRect& dst,
+    DlFilterMode filter,
+    bool render_with_attributes) {
+  // Nine patches are drawn as up to nine separate image draws.
+  SkISize dimensions = image->dimensions();
+  unsigned int complexity = 8 * kDrawCallComplexity;
+  if (!image->isTextureBacked()) {
+    complexity += dimensions.width() * dimensions.height() / 100;
+  }
+  AccumulateDrawComplexity(complexity);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawDisplayList(
+    const sk_sp<DisplayList> display_list,
+    SkScalar opacity) {
+  if (IsComplex()) {
+    return;
+  }
+  ImpellerHelper helper(Ceiling() - CurrentComplexityScore());
+  if (opacity < SK_Scalar1 && !display_list->can_apply_group_opacity()) {
+    helper.saveLayer(nullptr, SaveLayerOptions::kWithAttributes, nullptr);
+  }
+  display_list->Dispatch(helper);
+  AccumulateComplexity(helper.ComplexityScore());
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawTextBlob(
+    const sk_sp<SkTextBlob> blob,
+    SkScalar x,
+    SkScalar y) {
+  if (IsComplex()) {
+    return;
+  }
+  // The cost of the draw itself is calculated at the end, only the cost of
+  // the attributes it is drawn with is accumulated here.
+  draw_text_count_++;
+  AccumulateComplexity(AttributeComplexity(false));
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawTextFrame(
+    const std::shared_ptr<impeller::TextFrame>& text_frame,
+    SkScalar x,
+    SkScalar y) {
+  drawTextBlob(nullptr, x, y);
+}
+
+void DisplayListImpellerComplexityCalculator::ImpellerHelper::drawShadow(
+    const SkPath& path,
+    const DlColor color,
+    const SkScalar elevation,
+    bool transparent_occluder,
+    SkScalar dpr) {
+  if (IsComplex()) {
+    return;
+  }
+  // Shadows are drawn as a blurred fill of the path. Rects, simple rrects
+  // and circles are blurred analytically, other paths are tessellated and
+  // blurred in an offscreen pass.
+  SkRect rect;
+  SkRRect rrect;
+  unsigned int complexity = kDrawCallComplexity;
+  if (path.isRect(&rect) ||
+      (path.isRRect(&rrect) && rrect.isSimple()) ||
+      (path.isOval(&rect) && rect.width() == rect.height())) {
+    AccumulateComplexity(complexity);
+    return;
+  }
+  complexity += kPathComplexity +
+                CalculatePathComplexity(path, 100, 400, 500, 800) +
+                kOffscreenPassComplexity;
+  AccumulateComplexity(complexity);
+}
+
+}  // namespace flutter
@@ -0,0 +1,130 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_IMPELLER_H_
+#define FLUTTER_FLOW_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_IMPELLER_H_
+
+#include "flutter/display_list/benchmarking/dl_complexity_helper.h"
+
+namespace flutter {
+
+// Estimates the cost of rendering a DisplayList with Impeller.
+//
+// Unlike Skia, Impeller tessellates most geometry on the CPU and renders
+// every draw with its own pipeline, so the scores here are driven by the
+// amount of tessellation a draw needs, by the number of offscreen passes
+// it creates and by the number of draws that need to read back the
+// framebuffer for advanced blending, rather than by the area covered.
+class DisplayListImpellerComplexityCalculator
+    : public DisplayListComplexityCalculator {
+ public:
+  static DisplayListImpellerComplexityCalculator* GetInstance();
+
+  unsigned int Compute(const DisplayList* display_list) override {
+    ImpellerHelper helper(ceiling_);
+    display_list->Dispatch(helper);
+    return helper.ComplexityScore();
+  }
+
+  bool ShouldBeCached(unsigned int complexity_score) override {
+    // Set cache threshold at 1ms
+    return complexity_score > 200000u;
+  }
+
+  void SetComplexityCeiling(unsigned int ceiling) override {
+    ceiling_ = ceiling;
+  }
+
+ private:
+  class ImpellerHelper : public ComplexityCalculatorHelper {
+   public:
+    explicit ImpellerHelper(unsigned int ceiling)
+        : ComplexityCalculatorHelper(ceiling) {}
+
+    void setBlendMode(DlBlendMode mode) override;
+    void setImageFilter(const DlImageFilter* filter) override;
+    void setMaskFilter(const DlMaskFilter* filter) override;
+
+    void saveLayer(const SkRect* bounds,
+                   const SaveLayerOptions options,
+                   const DlImageFilter* backdrop) override;
+
+    void drawLine(const SkPoint& p0, const SkPoint& p1) override;
+    void drawRect(const SkRect& rect) override;
+    void drawOval(const SkRect& bounds) override;
+    void drawCircle(const SkPoint& center, SkScalar radius) override;
+    void drawRRect(const SkRRect& rrect) override;
+    void drawDRRect(const SkRRect& outer, const SkRRect& inner) override;
+    void drawPath(const SkPath& path) override;
+    void drawArc(const SkRect& oval_bounds,
+                 SkScalar start_degrees,
+                 SkScalar sweep_degrees,
+                 bool use_center) override;
+    void drawPoints(DlCanvas::PointMode mode,
+                    uint32_t count,
+                    const SkPoint points[]) override;
+    void drawVertices(const DlVertices* vertices, DlBlendMode mode) override;
+    void drawImage(const sk_sp<DlImage> image,
+                   const SkPoint point,
+                   DlImageSampling sampling,
+                   bool render_with_attributes) override;
+    void drawImageNine(const sk_sp<DlImage> image,
+                       const SkIRect& center,
+                       const SkRect& dst,
+                       DlFilterMode filter,
+                       bool render_with_attributes) override;
+    void drawDisplayList(const sk_sp<DisplayList> display_list,
+                         SkScalar opacity) override;
+    void drawTextBlob(const sk_sp<SkTextBlob> blob,
+                      SkScalar x,
+                      SkScalar y) override;
+    void drawTextFrame(const std::shared_ptr<impeller::TextFrame>& text_frame,
+                       SkScalar x,
+                       SkScalar y) override;
+    void drawShadow(const SkPath& path,
+                    const DlColor color,
+                    const SkScalar elevation,
+                    bool transparent_occluder,
+                    SkScalar dpr) override;
+
+   protected:
+    void ImageRect(const SkISize& size,
+                   bool texture_backed,
+                   bool render_with_attributes,
+                   bool enforce_src_edges) override;
+
+    unsigned int BatchedComplexity() override;
+
+   private:
+    // Returns the cost of the offscreen passes and framebuffer reads that
+    // the current attributes add to a draw. Mask blurs on draws with
+    // |analytic_blur| set are rendered directly by Impeller without an
+    // offscreen pass.
+    unsigned int AttributeComplexity(bool analytic_blur);
+
+    // Accumulates the cost of a single draw whose geometry costs
+    // |geometry_complexity|, along with its |AttributeComplexity|.
+    void AccumulateDrawComplexity(unsigned int geometry_complexity,
+                                  bool analytic_blur = false);
+
+    unsigned int PathTessellationComplexity(const SkPath& path);
+
+    DlBlendMode blend_mode_ = DlBlendMode::kSrcOver;
+    bool has_image_filter_ = false;
+    bool has_mask_blur_ = false;
+
+    unsigned int save_layer_count_ = 0;
+    unsigned int draw_text_count_ = 0;
+  };
+
+  DisplayListImpellerComplexityCalculator()
+      : ceiling_(std::numeric_limits<unsigned int>::max()) {}
+  static DisplayListImpellerComplexityCalculator* instance_;
+
+  unsigned int ceiling_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_IMPELLER_H_
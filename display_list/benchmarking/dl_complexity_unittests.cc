@@ -4,6 +4,7 @@
 
 #include "flutter/display_list/benchmarking/dl_complexity.h"
 #include "flutter/display_list/benchmarking/dl_complexity_gl.h"
+#include "flutter/display_list/benchmarking/dl_complexity_impeller.h"
 #include "flutter/display_list/benchmarking/dl_complexity_metal.h"
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_builder.h"
@@ -23,6 +24,7 @@ namespace {
 std::vector<DisplayListComplexityCalculator*> Calculators() {
   return {DisplayListMetalComplexityCalculator::GetInstance(),
           DisplayListGLComplexityCalculator::GetInstance(),
+          DisplayListImpellerComplexityCalculator::GetInstance(),
           DisplayListNaiveComplexityCalculator::GetInstance()};
 }
 
@@ -440,5 +442,123 @@ TEST(DisplayListComplexity, DrawAtlas) {
   }
 }
 
+TEST(DisplayListComplexity, ImpellerCeiling) {
+  auto display_list = GetSampleDisplayList();
+
+  auto calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+  calculator->SetComplexityCeiling(10u);
+  ASSERT_EQ(calculator->Compute(display_list.get()), 10u);
+  calculator->SetComplexityCeiling(std::numeric_limits<unsigned int>::max());
+}
+
+TEST(DisplayListComplexity, ImpellerTessellation) {
+  SkRect rect = SkRect::MakeXYWH(10, 10, 80, 60);
+
+  DisplayListBuilder builder_rect;
+  builder_rect.DrawRect(rect, DlPaint());
+  auto display_list_rect = builder_rect.Build();
+
+  DisplayListBuilder builder_path;
+  SkPath path;
+  path.moveTo(SkPoint::Make(10, 10));
+  path.cubicTo(SkPoint::Make(90, 10), SkPoint::Make(90, 70),
+               SkPoint::Make(10, 70));
+  path.close();
+  builder_path.DrawPath(path, DlPaint());
+  auto display_list_path = builder_path.Build();
+
+  DisplayListBuilder builder_circle;
+  builder_circle.DrawCircle(SkPoint::Make(50, 50), 30.0f, DlPaint());
+  auto display_list_circle = builder_circle.Build();
+
+  DisplayListBuilder builder_oval;
+  builder_oval.DrawOval(rect, DlPaint());
+  auto display_list_oval = builder_oval.Build();
+
+  auto calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+  ASSERT_NE(calculator->Compute(display_list_rect.get()), 0u);
+  ASSERT_LT(calculator->Compute(display_list_rect.get()),
+            calculator->Compute(display_list_path.get()));
+  ASSERT_LT(calculator->Compute(display_list_circle.get()),
+            calculator->Compute(display_list_oval.get()));
+}
+
+TEST(DisplayListComplexity, ImpellerOffscreenPasses) {
+  SkPath path;
+  path.moveTo(SkPoint::Make(10, 10));
+  path.lineTo(SkPoint::Make(90, 20));
+  path.lineTo(SkPoint::Make(50, 70));
+  path.close();
+  auto mask_blur = DlBlurMaskFilter::Make(DlBlurStyle::kNormal, 5.0f);
+  auto image_filter = DlBlurImageFilter::Make(5.0f, 5.0f, DlTileMode::kClamp);
+
+  DisplayListBuilder builder_path;
+  builder_path.DrawPath(path, DlPaint());
+  auto display_list_path = builder_path.Build();
+
+  DisplayListBuilder builder_path_blur;
+  builder_path_blur.DrawPath(path, DlPaint().setMaskFilter(mask_blur));
+  auto display_list_path_blur = builder_path_blur.Build();
+
+  DisplayListBuilder builder_path_filter;
+  builder_path_filter.DrawPath(path, DlPaint().setImageFilter(image_filter));
+  auto display_list_path_filter = builder_path_filter.Build();
+
+  DisplayListBuilder builder_rect;
+  builder_rect.DrawRect(SkRect::MakeXYWH(10, 10, 80, 60), DlPaint());
+  auto display_list_rect = builder_rect.Build();
+
+  DisplayListBuilder builder_rect_blur;
+  builder_rect_blur.DrawRect(SkRect::MakeXYWH(10, 10, 80, 60),
+                             DlPaint().setMaskFilter(mask_blur));
+  auto display_list_rect_blur = builder_rect_blur.Build();
+
+  auto calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+  ASSERT_GT(calculator->Compute(display_list_path_blur.get()),
+            calculator->Compute(display_list_path.get()));
+  ASSERT_GT(calculator->Compute(display_list_path_filter.get()),
+            calculator->Compute(display_list_path.get()));
+  // Blurred rects are drawn without an offscreen pass.
+  ASSERT_EQ(calculator->Compute(display_list_rect_blur.get()),
+            calculator->Compute(display_list_rect.get()));
+}
+
+TEST(DisplayListComplexity, ImpellerSaveLayers) {
+  DisplayListBuilder builder;
+  builder.SaveLayer(nullptr, nullptr);
+  builder.DrawRect(SkRect::MakeXYWH(10, 10, 80, 60), DlPaint());
+  builder.Restore();
+  auto display_list = builder.Build();
+
+  DisplayListBuilder builder_filtered;
+  DlPaint layer_paint;
+  layer_paint.setImageFilter(
+      DlBlurImageFilter::Make(5.0f, 5.0f, DlTileMode::kClamp));
+  builder_filtered.SaveLayer(nullptr, &layer_paint);
+  builder_filtered.DrawRect(SkRect::MakeXYWH(10, 10, 80, 60), DlPaint());
+  builder_filtered.Restore();
+  auto display_list_filtered = builder_filtered.Build();
+
+  auto calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+  ASSERT_NE(calculator->Compute(display_list.get()), 0u);
+  ASSERT_GT(calculator->Compute(display_list_filtered.get()),
+            calculator->Compute(display_list.get()));
+}
+
+TEST(DisplayListComplexity, ImpellerAdvancedBlends) {
+  DisplayListBuilder builder_src_over;
+  builder_src_over.DrawRect(SkRect::MakeXYWH(10, 10, 80, 60), DlPaint());
+  auto display_list_src_over = builder_src_over.Build();
+
+  DisplayListBuilder builder_multiply;
+  builder_multiply.DrawRect(SkRect::MakeXYWH(10, 10, 80, 60),
+                            DlPaint().setBlendMode(DlBlendMode::kMultiply));
+  auto display_list_multiply = builder_multiply.Build();
+
+  auto calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+  ASSERT_GT(calculator->Compute(display_list_multiply.get()),
+            calculator->Compute(display_list_src_over.get()));
+}
+
 }  // namespace testing
 }  // namespace flutter
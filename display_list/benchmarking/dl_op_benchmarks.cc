@@ -0,0 +1,152 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/benchmarking/dl_op_benchmarks.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/testing/dl_test_snippets.h"
+
+namespace flutter {
+
+DlOpReceiver& DisplayListBuilderBenchmarkAccessor(DisplayListBuilder& builder) {
+  return builder.asReceiver();
+}
+
+namespace testing {
+
+namespace {
+
+struct BuilderMode {
+  const char* name;
+  bool prepare_rtree;
+  bool compute_bounds;
+};
+
+constexpr BuilderMode kBuilderModes[] = {
+    {"kDefault", false, false},
+    {"kBounds", false, true},
+    {"kRtree", true, false},
+    {"kBoundsAndRtree", true, true},
+};
+
+// The benchmarks are registered during static initialization, when the
+// test images and display lists the invocations refer to may not be created
+// yet, so the invocations that are run are only created once the first
+// benchmark runs.
+DisplayListInvocationGroup& GetOpGroup(size_t index) {
+  static std::vector<DisplayListInvocationGroup> groups = CreateAllGroups();
+  return groups[index];
+}
+
+std::vector<std::string> GetOpNames() {
+  std::vector<std::string> names;
+  for (const auto& group : CreateAllGroups()) {
+    names.push_back(group.op_name);
+  }
+  return names;
+}
+
+// The transforms and clips of one repetition are undone before the next so
+// that they don't compound, for example into an infinite scale.
+void InvokeRepeatedly(DisplayListInvocationGroup& group,
+                      DlOpReceiver& receiver) {
+  for (int i = 0; i < kDlOpBenchmarkRepetitions; i++) {
+    receiver.save();
+    for (auto& invocation : group.variants) {
+      invocation.Invoke(receiver);
+    }
+    receiver.restore();
+  }
+}
+
+size_t CountOps(DisplayListInvocationGroup& group) {
+  size_t op_count = 0u;
+  for (auto& invocation : group.variants) {
+    op_count += invocation.op_count();
+  }
+  return op_count * kDlOpBenchmarkRepetitions;
+}
+
+sk_sp<DisplayList> BuildDisplayList(DisplayListInvocationGroup& group,
+                                    bool prepare_rtree) {
+  DisplayListBuilder builder(prepare_rtree);
+  InvokeRepeatedly(group, DisplayListBuilderBenchmarkAccessor(builder));
+  return builder.Build();
+}
+
+}  // namespace
+
+bool RegisterDisplayListBuilderOpBenchmarks() {
+  auto op_names = GetOpNames();
+  for (size_t g = 0; g < op_names.size(); g++) {
+    for (const auto& mode : kBuilderModes) {
+      std::string name =
+          "BM_DisplayListBuilderOp/" + op_names[g] + "/" + mode.name;
+      benchmark::RegisterBenchmark(
+          name.c_str(),
+          [g, mode](benchmark::State& state) {
+            auto& group = GetOpGroup(g);
+            while (state.KeepRunning()) {
+              DisplayListBuilder builder(mode.prepare_rtree);
+              InvokeRepeatedly(group,
+                               DisplayListBuilderBenchmarkAccessor(builder));
+              auto display_list = builder.Build();
+              if (mode.compute_bounds) {
+                benchmark::DoNotOptimize(display_list->bounds());
+              }
+              if (mode.prepare_rtree) {
+                benchmark::DoNotOptimize(display_list->rtree());
+              }
+            }
+            state.SetItemsProcessed(state.iterations() * CountOps(group));
+          })
+          ->Unit(benchmark::kMicrosecond);
+    }
+  }
+  return true;
+}
+
+bool RegisterDisplayListDispatchOpBenchmarks(const std::string& receiver_name,
+                                             DlOpDispatchFunction dispatch) {
+  auto op_names = GetOpNames();
+  auto shared_dispatch =
+      std::make_shared<DlOpDispatchFunction>(std::move(dispatch));
+  for (size_t g = 0; g < op_names.size(); g++) {
+    for (bool culled : {false, true}) {
+      std::string name = "BM_DisplayListDispatchOp/" + receiver_name + "/" +
+                         op_names[g] + (culled ? "/kCulled" : "/kAll");
+      benchmark::RegisterBenchmark(
+          name.c_str(),
+          [g, culled, shared_dispatch](benchmark::State& state) {
+            auto& group = GetOpGroup(g);
+            auto display_list = BuildDisplayList(group, culled);
+            // Culling to the top left quarter of the bounds makes the
+            // dispatch search the RTree instead of visiting every op. Ops
+            // that don't draw have empty bounds and are never culled.
+            SkRect cull_rect = display_list->bounds();
+            if (culled && !cull_rect.isEmpty()) {
+              cull_rect.setXYWH(cull_rect.x(), cull_rect.y(),
+                                cull_rect.width() / 2,
+                                cull_rect.height() / 2);
+            } else {
+              cull_rect.outset(1, 1);
+            }
+            while (state.KeepRunning()) {
+              (*shared_dispatch)(*display_list, cull_rect);
+            }
+            state.SetItemsProcessed(state.iterations() * CountOps(group));
+          })
+          ->Unit(benchmark::kMicrosecond);
+    }
+  }
+  return true;
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_OP_BENCHMARKS_H_
+#define FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_OP_BENCHMARKS_H_
+
+#include <functional>
+#include <string>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/dl_builder.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+// Benchmarks of the recording and dispatch of each type of op a DisplayList
+// records, so that a regression in the overhead of a single op shows up as
+// such rather than as a small change of a benchmark of all ops.
+//
+// Each benchmark records or dispatches a display list made of the variants of
+// one op from dl_test_snippets, repeated |kDlOpBenchmarkRepetitions| times.
+
+namespace flutter {
+
+/// Gives the benchmarks access to the receiver of a builder so that they
+/// record ops the way a dispatch into the builder does.
+DlOpReceiver& DisplayListBuilderBenchmarkAccessor(DisplayListBuilder& builder);
+
+namespace testing {
+
+inline constexpr int kDlOpBenchmarkRepetitions = 100;
+
+/// Dispatches |display_list| into the receiver under benchmark, culled to
+/// |cull_rect|. This is typically a call to
+/// `display_list.Dispatch(receiver, cull_rect)`.
+using DlOpDispatchFunction =
+    std::function<void(const DisplayList& display_list,
+                       const SkRect& cull_rect)>;
+
+/// Registers, for each type of op, the benchmarks of recording the op with a
+/// DisplayListBuilder, with and without computing the bounds and the RTree of
+/// the display list. Returns true so that it can initialize a static.
+bool RegisterDisplayListBuilderOpBenchmarks();
+
+/// Registers, for each type of op, the benchmarks of dispatching the op with
+/// |dispatch|, both to the whole display list and to a cull rect that is
+/// resolved with the RTree of the display list. The benchmarks are named
+/// after |receiver_name|. Returns true so that it can initialize a static.
+bool RegisterDisplayListDispatchOpBenchmarks(const std::string& receiver_name,
+                                             DlOpDispatchFunction dispatch);
+
+}  // namespace testing
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_OP_BENCHMARKS_H_
@@ -125,7 +125,9 @@ class DlRegionAdapter {
 };
 
 template <typename Region>
-void RunFromRectsBenchmark(benchmark::State& state, int maxSize) {
+void RunFromRectsBenchmark(benchmark::State& state,
+                           int maxSize,
+                           int rectCount) {
   std::random_device d;
   std::seed_seq seed{2, 1, 3};
   std::mt19937 rng(seed);
@@ -134,7 +136,7 @@ void RunFromRectsBenchmark(benchmark::State& state, int maxSize) {
   std::uniform_int_distribution size(1, maxSize);
 
   std::vector<SkIRect> rects;
-  for (int i = 0; i < 2000; ++i) {
+  for (int i = 0; i < rectCount; ++i) {
     SkIRect rect = SkIRect::MakeXYWH(pos(rng), pos(rng), size(rng), size(rng));
     rects.push_back(rect);
   }
@@ -145,7 +147,9 @@ void RunFromRectsBenchmark(benchmark::State& state, int maxSize) {
 }
 
 template <typename Region>
-void RunGetRectsBenchmark(benchmark::State& state, int maxSize) {
+void RunGetRectsBenchmark(benchmark::State& state,
+                          int maxSize,
+                          int rectCount) {
   std::random_device d;
   std::seed_seq seed{2, 1, 3};
   std::mt19937 rng(seed);
@@ -154,7 +158,7 @@ void RunGetRectsBenchmark(benchmark::State& state, int maxSize) {
   std::uniform_int_distribution size(1, maxSize);
 
   std::vector<SkIRect> rects;
-  for (int i = 0; i < 2000; ++i) {
+  for (int i = 0; i < rectCount; ++i) {
     SkIRect rect = SkIRect::MakeXYWH(pos(rng), pos(rng), size(rng), size(rng));
     rects.push_back(rect);
   }
@@ -173,7 +177,8 @@ void RunRegionOpBenchmark(benchmark::State& state,
                           RegionOp op,
                           bool withSingleRect,
                           int maxSize,
-                          double sizeFactor) {
+                          double sizeFactor,
+                          int rectCount) {
   std::random_device d;
   std::seed_seq seed{2, 1, 3};
   std::mt19937 rng(seed);
@@ -181,11 +186,11 @@ void RunRegionOpBenchmark(benchmark::State& state,
   SkIRect bounds1 = SkIRect::MakeWH(4000, 4000);
   SkIRect bounds2 = RandomSubRect(rng, bounds1, sizeFactor);
 
-  auto rects = GenerateRects(rng, bounds1, 500, maxSize);
+  auto rects = GenerateRects(rng, bounds1, rectCount, maxSize);
   Region region1(rects);
 
-  rects = GenerateRects(rng, bounds2, withSingleRect ? 1 : 500 * sizeFactor,
-                        maxSize);
+  rects = GenerateRects(rng, bounds2,
+                        withSingleRect ? 1 : rectCount * sizeFactor, maxSize);
   Region region2(rects);
 
   switch (op) {
@@ -202,6 +207,29 @@ void RunRegionOpBenchmark(benchmark::State& state,
   }
 }
 
+// Unions regions that cover the top and the bottom half of the bounds, as
+// damage tracking does for layers stacked in a scrolling list.
+template <typename Region>
+void RunDisjointUnionBenchmark(benchmark::State& state,
+                               int maxSize,
+                               int rectCount) {
+  std::random_device d;
+  std::seed_seq seed{2, 1, 3};
+  std::mt19937 rng(seed);
+
+  auto rects =
+      GenerateRects(rng, SkIRect::MakeWH(4000, 2000), rectCount, maxSize);
+  Region region1(rects);
+
+  rects = GenerateRects(rng, SkIRect::MakeLTRB(0, 2000, 4000, 4000),
+                        rectCount, maxSize);
+  Region region2(rects);
+
+  while (state.KeepRunning()) {
+    Region::unionRegions(region1, region2);
+  }
+}
+
 template <typename Region>
 void RunIntersectsRegionBenchmark(benchmark::State& state,
                                   int maxSize,
@@ -257,38 +285,63 @@ void RunIntersectsSingleRectBenchmark(benchmark::State& state, int maxSize) {
 
 namespace flutter {
 
-static void BM_DlRegion_FromRects(benchmark::State& state, int maxSize) {
-  RunFromRectsBenchmark<DlRegionAdapter>(state, maxSize);
+// The number of rects that regions of the "Huge" benchmarks are made of.
+const int kHugeRectCount = 10000;
+
+static void BM_DlRegion_FromRects(benchmark::State& state,
+                                  int maxSize,
+                                  int rectCount = 2000) {
+  RunFromRectsBenchmark<DlRegionAdapter>(state, maxSize, rectCount);
 }
 
-static void BM_SkRegion_FromRects(benchmark::State& state, int maxSize) {
-  RunFromRectsBenchmark<SkRegionAdapter>(state, maxSize);
+static void BM_SkRegion_FromRects(benchmark::State& state,
+                                  int maxSize,
+                                  int rectCount = 2000) {
+  RunFromRectsBenchmark<SkRegionAdapter>(state, maxSize, rectCount);
 }
 
-static void BM_DlRegion_GetRects(benchmark::State& state, int maxSize) {
-  RunGetRectsBenchmark<DlRegionAdapter>(state, maxSize);
+static void BM_DlRegion_GetRects(benchmark::State& state,
+                                 int maxSize,
+                                 int rectCount = 2000) {
+  RunGetRectsBenchmark<DlRegionAdapter>(state, maxSize, rectCount);
 }
 
-static void BM_SkRegion_GetRects(benchmark::State& state, int maxSize) {
-  RunGetRectsBenchmark<SkRegionAdapter>(state, maxSize);
+static void BM_SkRegion_GetRects(benchmark::State& state,
+                                 int maxSize,
+                                 int rectCount = 2000) {
+  RunGetRectsBenchmark<SkRegionAdapter>(state, maxSize, rectCount);
 }
 
 static void BM_DlRegion_Operation(benchmark::State& state,
                                   RegionOp op,
                                   bool withSingleRect,
                                   int maxSize,
-                                  double sizeFactor) {
+                                  double sizeFactor,
+                                  int rectCount = 500) {
   RunRegionOpBenchmark<DlRegionAdapter>(state, op, withSingleRect, maxSize,
-                                        sizeFactor);
+                                        sizeFactor, rectCount);
 }
 
 static void BM_SkRegion_Operation(benchmark::State& state,
                                   RegionOp op,
                                   bool withSingleRect,
                                   int maxSize,
-                                  double sizeFactor) {
+                                  double sizeFactor,
+                                  int rectCount = 500) {
   RunRegionOpBenchmark<SkRegionAdapter>(state, op, withSingleRect, maxSize,
-                                        sizeFactor);
+                                        sizeFactor, rectCount);
+}
+
+static void BM_DlRegion_DisjointUnion(benchmark::State& state,
+                                      int maxSize,
+                                      int rectCount) {
+  RunDisjointUnionBenchmark<DlRegionAdapter>(state, maxSize, rectCount);
+}
+
+static void BM_SkRegion_DisjointUnion(benchmark::State& state,
+                                      int maxSize,
+                                      int rectCount) {
+  RunDisjointUnionBenchmark<SkRegionAdapter>(state, maxSize, rectCount);
 }
 
 static void BM_DlRegion_IntersectsRegion(benchmark::State& state,
@@ -709,4 +762,68 @@ BENCHMARK_CAPTURE(BM_DlRegion_GetRects, Large, 1500)
 BENCHMARK_CAPTURE(BM_SkRegion_GetRects, Large, 1500)
     ->Unit(benchmark::kMicrosecond);
 
-}  // namespace flutter
\ No newline at end of file
+BENCHMARK_CAPTURE(BM_DlRegion_FromRects, Huge, 100, kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_FromRects, Huge, 100, kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRegion_GetRects, Huge, 100, kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_GetRects, Huge, 100, kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRegion_Operation,
+                  Union_Huge,
+                  RegionOp::kUnion,
+                  false,
+                  100,
+                  1.0,
+                  kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_Operation,
+                  Union_Huge,
+                  RegionOp::kUnion,
+                  false,
+                  100,
+                  1.0,
+                  kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRegion_Operation,
+                  Intersection_Huge,
+                  RegionOp::kIntersection,
+                  false,
+                  100,
+                  1.0,
+                  kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_Operation,
+                  Intersection_Huge,
+                  RegionOp::kIntersection,
+                  false,
+                  100,
+                  1.0,
+                  kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRegion_Operation,
+                  Intersection_HugeWithSingleRect,
+                  RegionOp::kIntersection,
+                  true,
+                  100,
+                  kSizeFactorSmall,
+                  kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_Operation,
+                  Intersection_HugeWithSingleRect,
+                  RegionOp::kIntersection,
+                  true,
+                  100,
+                  kSizeFactorSmall,
+                  kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRegion_DisjointUnion, Huge, 100, kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_DisjointUnion, Huge, 100, kHugeRectCount)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace flutter
@@ -0,0 +1,183 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Replays a frame captured with the `_flutter.screenshotSkp` service protocol
+// extension and reports how long it takes to rasterize.
+//
+// Usage:
+//   display_list_skp_replay --skp=<file> [--backend=software|opengl|metal]
+//                           [--iterations=<count>] [--snapshot=<file.png>]
+//
+// Each iteration draws the captured picture onto an offscreen surface of the
+// size of the frame and waits for the GPU to finish, so the reported times
+// include GPU execution.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "flutter/display_list/testing/dl_test_surface_provider.h"
+#include "flutter/fml/command_line.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_point.h"
+#include "third_party/skia/include/codec/SkCodec.h"
+#include "third_party/skia/include/codec/SkJpegDecoder.h"
+#include "third_party/skia/include/codec/SkPngDecoder.h"
+#include "third_party/skia/include/codec/SkWebpDecoder.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkPicture.h"
+#include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/encode/SkPngEncoder.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
+
+namespace flutter {
+namespace testing {
+namespace {
+
+constexpr size_t kDefaultIterations = 100u;
+constexpr size_t kWarmUpIterations = 5u;
+
+bool ParseBackend(const std::string& name,
+                  DlSurfaceProvider::BackendType* backend) {
+  if (name == "software") {
+    *backend = DlSurfaceProvider::kSoftwareBackend;
+  } else if (name == "opengl") {
+    *backend = DlSurfaceProvider::kOpenGlBackend;
+  } else if (name == "metal") {
+    *backend = DlSurfaceProvider::kMetalBackend;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+void DrawAndWait(const sk_sp<SkSurface>& surface,
+                 const sk_sp<SkPicture>& picture) {
+  SkCanvas* canvas = surface->getCanvas();
+  canvas->clear(SK_ColorTRANSPARENT);
+  canvas->drawPicture(picture);
+  if (GrDirectContext* context =
+          GrAsDirectContext(surface->recordingContext())) {
+    context->flushAndSubmit(surface.get(), GrSyncCpu::kYes);
+  }
+}
+
+bool WriteSnapshot(const sk_sp<SkSurface>& surface, const std::string& path) {
+  auto image = surface->makeImageSnapshot();
+  auto raster = image ? image->makeRasterImage() : nullptr;
+  auto data = raster ? SkPngEncoder::Encode(nullptr, raster.get(), {})
+                     : nullptr;
+  if (!data) {
+    return false;
+  }
+  fml::NonOwnedMapping mapping(static_cast<const uint8_t*>(data->data()),
+                               data->size());
+  auto directory =
+      fml::OpenDirectory(".", false, fml::FilePermission::kReadWrite);
+  return fml::WriteAtomically(directory, path.c_str(), mapping);
+}
+
+int Replay(const fml::CommandLine& command_line) {
+  std::string skp_path;
+  if (!command_line.GetOptionValue("skp", &skp_path)) {
+    std::cerr << "Missing --skp=<file> argument." << std::endl;
+    return 1;
+  }
+
+  DlSurfaceProvider::BackendType backend_type;
+  auto backend_name =
+      command_line.GetOptionValueWithDefault("backend", "software");
+  if (!ParseBackend(backend_name, &backend_type)) {
+    std::cerr << "Unknown backend: " << backend_name << std::endl;
+    return 1;
+  }
+
+  size_t iterations = kDefaultIterations;
+  std::string iterations_value;
+  if (command_line.GetOptionValue("iterations", &iterations_value)) {
+    iterations = std::max<size_t>(
+        std::strtoul(iterations_value.c_str(), nullptr, 10), 1u);
+  }
+
+  auto mapping = fml::FileMapping::CreateReadOnly(skp_path);
+  if (!mapping) {
+    std::cerr << "Could not read " << skp_path << std::endl;
+    return 1;
+  }
+
+  // Images are embedded as PNG by the service protocol and may also be JPEG
+  // or WebP when they are passed through encoded.
+  SkCodecs::Register(SkPngDecoder::Decoder());
+  SkCodecs::Register(SkJpegDecoder::Decoder());
+  SkCodecs::Register(SkWebpDecoder::Decoder());
+  auto data =
+      SkData::MakeWithoutCopy(mapping->GetMapping(), mapping->GetSize());
+  auto picture = SkPicture::MakeFromData(data.get());
+  if (!picture) {
+    std::cerr << "Could not deserialize " << skp_path << std::endl;
+    return 1;
+  }
+
+  auto provider = DlSurfaceProvider::Create(backend_type);
+  if (!provider) {
+    std::cerr << "The " << backend_name << " backend is not available."
+              << std::endl;
+    return 1;
+  }
+  SkIRect bounds = picture->cullRect().roundOut();
+  if (bounds.isEmpty() ||
+      !provider->InitializeSurface(bounds.width(), bounds.height())) {
+    std::cerr << "Could not create a surface for the frame." << std::endl;
+    return 1;
+  }
+  auto surface = provider->GetPrimarySurface()->sk_surface();
+
+  // The first frames compile shaders and upload images.
+  for (size_t i = 0; i < kWarmUpIterations; i++) {
+    DrawAndWait(surface, picture);
+  }
+
+  std::vector<double> frame_times;
+  frame_times.reserve(iterations);
+  for (size_t i = 0; i < iterations; i++) {
+    auto start = fml::TimePoint::Now();
+    DrawAndWait(surface, picture);
+    frame_times.push_back((fml::TimePoint::Now() - start).ToMillisecondsF());
+  }
+
+  std::sort(frame_times.begin(), frame_times.end());
+  double total = 0;
+  for (auto time : frame_times) {
+    total += time;
+  }
+  std::cout << "backend: " << provider->backend_name() << std::endl
+            << "frame size: " << bounds.width() << "x" << bounds.height()
+            << std::endl
+            << "iterations: " << iterations << std::endl
+            << "average ms: " << total / iterations << std::endl
+            << "median ms: " << frame_times[iterations / 2] << std::endl
+            << "90th percentile ms: " << frame_times[(iterations * 9) / 10]
+            << std::endl
+            << "worst ms: " << frame_times.back() << std::endl;
+
+  std::string snapshot_path;
+  if (command_line.GetOptionValue("snapshot", &snapshot_path) &&
+      !WriteSnapshot(surface, snapshot_path)) {
+    std::cerr << "Could not write " << snapshot_path << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace flutter
+
+int main(int argc, char** argv) {
+  return flutter::testing::Replay(fml::CommandLineFromArgcArgv(argc, argv));
+}
@@ -2,14 +2,185 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_op_records.h"
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
 
+namespace {
+
+// The pooled block sizes are the powers of two from kMinPooledBytes to
+// kMaxPooledBytes.
+constexpr size_t kPooledSizeClassCount = 9;
+static_assert((DisplayListStorage::kMinPooledBytes
+               << (kPooledSizeClassCount - 1)) ==
+              DisplayListStorage::kMaxPooledBytes);
+
+// The most bytes of free blocks that the pool keeps for each size class.
+constexpr size_t kMaxFreeBytesPerSizeClass = 512 * 1024;
+
+size_t SizeClassFor(size_t count) {
+  size_t size_class = 0;
+  while ((DisplayListStorage::kMinPooledBytes << size_class) < count) {
+    size_class++;
+  }
+  return size_class;
+}
+
+constexpr size_t BytesForSizeClass(size_t size_class) {
+  return DisplayListStorage::kMinPooledBytes << size_class;
+}
+
+class DisplayListStoragePool {
+ public:
+  static DisplayListStoragePool& GetInstance() {
+    static DisplayListStoragePool* pool = new DisplayListStoragePool();
+    return *pool;
+  }
+
+  uint8_t* Take(size_t size_class) {
+    {
+      std::scoped_lock lock(mutex_);
+      auto& blocks = free_blocks_[size_class];
+      if (!blocks.empty()) {
+        uint8_t* block = blocks.back();
+        blocks.pop_back();
+        return block;
+      }
+    }
+    auto block =
+        static_cast<uint8_t*>(std::malloc(BytesForSizeClass(size_class)));
+    FML_CHECK(block);
+    return block;
+  }
+
+  void Give(uint8_t* block, size_t size_class) {
+    {
+      std::scoped_lock lock(mutex_);
+      auto& blocks = free_blocks_[size_class];
+      if ((blocks.size() + 1) * BytesForSizeClass(size_class) <=
+          kMaxFreeBytesPerSizeClass) {
+        blocks.push_back(block);
+        return;
+      }
+    }
+    std::free(block);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::array<std::vector<uint8_t*>, kPooledSizeClassCount> free_blocks_;
+};
+
+}  // namespace
+
+DisplayListStorage::DisplayListStorage(DisplayListStorage&& other)
+    : ptr_(std::exchange(other.ptr_, nullptr)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      pooled_(std::exchange(other.pooled_, false)),
+      mapping_(std::move(other.mapping_)) {}
+
+DisplayListStorage::DisplayListStorage(
+    std::shared_ptr<const fml::Mapping> mapping,
+    size_t offset)
+    : mapping_(std::move(mapping)) {
+  FML_DCHECK(mapping_ && offset <= mapping_->GetSize());
+  // The ops are only ever read from the adopted bytes.
+  ptr_ = const_cast<uint8_t*>(mapping_->GetMapping()) + offset;
+  capacity_ = mapping_->GetSize() - offset;
+}
+
+DisplayListStorage::~DisplayListStorage() {
+  Release();
+}
+
+void DisplayListStorage::reserve(size_t count, size_t used) {
+  FML_DCHECK(used <= capacity_);
+  FML_DCHECK(!mapping_);
+  if (count <= capacity_) {
+    return;
+  }
+  if (count > kMaxPooledBytes) {
+    if (pooled_) {
+      auto ptr = static_cast<uint8_t*>(std::malloc(count));
+      FML_CHECK(ptr);
+      memcpy(ptr, ptr_, used);
+      Release();
+      ptr_ = ptr;
+    } else {
+      ptr_ = static_cast<uint8_t*>(std::realloc(ptr_, count));
+      FML_CHECK(ptr_);
+    }
+    capacity_ = count;
+    pooled_ = false;
+    return;
+  }
+  size_t size_class = SizeClassFor(count);
+  uint8_t* ptr = DisplayListStoragePool::GetInstance().Take(size_class);
+  if (ptr_) {
+    memcpy(ptr, ptr_, used);
+    Release();
+  }
+  ptr_ = ptr;
+  capacity_ = BytesForSizeClass(size_class);
+  pooled_ = true;
+}
+
+void DisplayListStorage::trim(size_t count) {
+  if (!ptr_ || mapping_ || count >= capacity_) {
+    return;
+  }
+  if (count == 0) {
+    Release();
+    return;
+  }
+  if (!pooled_) {
+    // Large buffers are shrunk in place, as they were before pooling.
+    ptr_ = static_cast<uint8_t*>(std::realloc(ptr_, count));
+    FML_CHECK(ptr_);
+    capacity_ = count;
+    return;
+  }
+  size_t size_class = SizeClassFor(count);
+  if (BytesForSizeClass(size_class) >= capacity_) {
+    return;
+  }
+  uint8_t* ptr = DisplayListStoragePool::GetInstance().Take(size_class);
+  memcpy(ptr, ptr_, count);
+  Release();
+  ptr_ = ptr;
+  capacity_ = BytesForSizeClass(size_class);
+  pooled_ = true;
+}
+
+void DisplayListStorage::Release() {
+  if (mapping_) {
+    mapping_.reset();
+  } else if (ptr_) {
+    if (pooled_) {
+      DisplayListStoragePool::GetInstance().Give(ptr_,
+                                                 SizeClassFor(capacity_));
+    } else {
+      std::free(ptr_);
+    }
+  }
+  ptr_ = nullptr;
+  capacity_ = 0;
+  pooled_ = false;
+}
+
 const SaveLayerOptions SaveLayerOptions::kNoAttributes = SaveLayerOptions();
 const SaveLayerOptions SaveLayerOptions::kWithAttributes =
     kNoAttributes.with_renders_with_attributes();
@@ -23,7 +194,8 @@ DisplayList::DisplayList()
       bounds_({0, 0, 0, 0}),
       can_apply_group_opacity_(true),
       is_ui_thread_safe_(true),
-      modifies_transparent_black_(false) {}
+      modifies_transparent_black_(false),
+      has_rtree_(false) {}
 
 DisplayList::DisplayList(DisplayListStorage&& storage,
                          size_t byte_count,
@@ -34,7 +206,9 @@ DisplayList::DisplayList(DisplayListStorage&& storage,
                          bool can_apply_group_opacity,
                          bool is_ui_thread_safe,
                          bool modifies_transparent_black,
-                         sk_sp<const DlRTree> rtree)
+                         bool has_rtree,
+                         std::vector<SkRect> rtree_rects,
+                         std::vector<int> rtree_indices)
     : storage_(std::move(storage)),
       byte_count_(byte_count),
       op_count_(op_count),
@@ -45,13 +219,30 @@ DisplayList::DisplayList(DisplayListStorage&& storage,
       can_apply_group_opacity_(can_apply_group_opacity),
       is_ui_thread_safe_(is_ui_thread_safe),
       modifies_transparent_black_(modifies_transparent_black),
-      rtree_(std::move(rtree)) {}
+      has_rtree_(has_rtree),
+      rtree_rects_(std::move(rtree_rects)),
+      rtree_indices_(std::move(rtree_indices)) {}
 
 DisplayList::~DisplayList() {
   uint8_t* ptr = storage_.get();
   DisposeOps(ptr, ptr + byte_count_);
 }
 
+sk_sp<const DlRTree> DisplayList::rtree() const {
+  if (!has_rtree_) {
+    return nullptr;
+  }
+  std::call_once(rtree_once_, [this]() {
+    TRACE_EVENT0("flutter", "DisplayList::BuildRTree");
+    rtree_ = sk_make_sp<DlRTree>(rtree_rects_.data(), rtree_rects_.size(),
+                                 rtree_indices_.data(),
+                                 [](int id) { return id >= 0; });
+    rtree_rects_ = {};
+    rtree_indices_ = {};
+  });
+  return rtree_;
+}
+
 uint32_t DisplayList::next_unique_id() {
   static std::atomic<uint32_t> next_id{1};
   uint32_t id;
@@ -166,6 +357,19 @@ void DisplayList::Dispatch(DlOpReceiver& receiver,
   Dispatch(receiver, ptr, ptr + byte_count_, culler);
 }
 
+void DisplayList::Dispatch(DlOpReceiver& receiver,
+                           const std::vector<int>& rect_indices) const {
+  const DlRTree* rtree = this->rtree().get();
+  FML_DCHECK(rtree != nullptr);
+  if (!rtree) {
+    return;
+  }
+  FML_DCHECK(std::is_sorted(rect_indices.begin(), rect_indices.end()));
+  uint8_t* ptr = storage_.get();
+  VectorCuller culler(rtree, rect_indices);
+  Dispatch(receiver, ptr, ptr + byte_count_, culler);
+}
+
 void DisplayList::Dispatch(DlOpReceiver& receiver,
                            uint8_t* ptr,
                            uint8_t* end,
@@ -315,4 +519,314 @@ bool DisplayList::Equals(const DisplayList* other) const {
   return CompareOps(ptr, ptr + byte_count_, o_ptr, o_ptr + other->byte_count_);
 }
 
+namespace {
+
+// The ops that hold only values, so that they can be written and read back
+// in their in-memory layout. Ops that are followed by variable length data
+// are listed in |FOR_EACH_SERIALIZABLE_POINTS_OP|.
+#define FOR_EACH_SERIALIZABLE_VALUE_OP(V) \
+  V(SetAntiAlias)                         \
+  V(SetInvertColors)                      \
+  V(SetStrokeCap)                         \
+  V(SetStrokeJoin)                        \
+  V(SetStyle)                             \
+  V(SetStrokeWidth)                       \
+  V(SetStrokeMiter)                       \
+  V(SetColor)                             \
+  V(SetBlendMode)                         \
+  V(ClearPathEffect)                      \
+  V(ClearColorFilter)                     \
+  V(ClearColorSource)                     \
+  V(ClearImageFilter)                     \
+  V(ClearMaskFilter)                      \
+  V(Save)                                 \
+  V(SaveLayer)                            \
+  V(SaveLayerBounds)                      \
+  V(Restore)                              \
+  V(Translate)                            \
+  V(Scale)                                \
+  V(Rotate)                               \
+  V(Skew)                                 \
+  V(Transform2DAffine)                    \
+  V(TransformFullPerspective)             \
+  V(TransformReset)                       \
+  V(ClipIntersectRect)                    \
+  V(ClipIntersectRRect)                   \
+  V(ClipDifferenceRect)                   \
+  V(ClipDifferenceRRect)                  \
+  V(DrawPaint)                            \
+  V(DrawColor)                            \
+  V(DrawLine)                             \
+  V(DrawRect)                             \
+  V(DrawOval)                             \
+  V(DrawCircle)                           \
+  V(DrawRRect)                            \
+  V(DrawDRRect)                           \
+  V(DrawArc)
+
+#define FOR_EACH_SERIALIZABLE_POINTS_OP(V) \
+  V(DrawPoints)                            \
+  V(DrawLines)                             \
+  V(DrawPolygon)
+
+// Must be incremented when the layout of a serializable op changes in a way
+// that |kSerializedOpLayout| does not catch.
+constexpr uint32_t kSerializedFormatVersion = 1;
+constexpr uint32_t kSerializedMagic = 0x54534c44;  // "DLST"
+
+struct SerializedOpLayout {
+  DisplayListOpType type;
+  size_t size;
+};
+
+constexpr SerializedOpLayout kSerializableOpLayouts[] = {
+#define DL_OP_LAYOUT(name) {DisplayListOpType::k##name, sizeof(name##Op)},
+    FOR_EACH_SERIALIZABLE_VALUE_OP(DL_OP_LAYOUT)
+    FOR_EACH_SERIALIZABLE_POINTS_OP(DL_OP_LAYOUT)
+#undef DL_OP_LAYOUT
+};
+
+// Changes whenever a serializable op changes its type or size, so that
+// DisplayLists written by a different version of the engine are rejected.
+constexpr uint32_t ComputeSerializedOpLayout() {
+  uint32_t hash = 17;
+  for (const SerializedOpLayout& layout : kSerializableOpLayouts) {
+    hash = hash * 31 + static_cast<uint32_t>(layout.type);
+    hash = hash * 31 + static_cast<uint32_t>(layout.size);
+  }
+  return hash;
+}
+constexpr uint32_t kSerializedOpLayout = ComputeSerializedOpLayout();
+
+constexpr uint32_t kSerializedCanApplyGroupOpacity = 1 << 0;
+constexpr uint32_t kSerializedModifiesTransparentBlack = 1 << 1;
+
+// Precedes the ops in a serialized DisplayList. Its size keeps the ops that
+// follow it aligned as they are in a DisplayListStorage.
+struct SerializedHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t op_layout;
+  uint32_t pointer_size;
+  uint64_t byte_count;
+  uint32_t op_count;
+  uint32_t flags;
+  SkRect bounds;
+};
+static_assert(sizeof(SerializedHeader) % alignof(std::max_align_t) == 0);
+
+bool IsValidEnum(int value, int last) {
+  return value >= 0 && value <= last;
+}
+
+// Returns whether |op|, which takes |size| bytes, is a valid op that only
+// holds values. |save_depth| tracks the saves and restores seen so far.
+bool IsSerializableOp(const DLOp* op, size_t size, int& save_depth) {
+  switch (op->type) {
+    case DisplayListOpType::kSave:
+    case DisplayListOpType::kSaveLayer:
+    case DisplayListOpType::kSaveLayerBounds:
+      save_depth++;
+      break;
+    case DisplayListOpType::kRestore:
+      if (--save_depth < 0) {
+        return false;
+      }
+      break;
+    case DisplayListOpType::kSetStrokeCap:
+      if (!IsValidEnum(
+              static_cast<int>(static_cast<const SetStrokeCapOp*>(op)->value),
+              static_cast<int>(DlStrokeCap::kLastCap))) {
+        return false;
+      }
+      break;
+    case DisplayListOpType::kSetStrokeJoin:
+      if (!IsValidEnum(
+              static_cast<int>(static_cast<const SetStrokeJoinOp*>(op)->value),
+              static_cast<int>(DlStrokeJoin::kLastJoin))) {
+        return false;
+      }
+      break;
+    case DisplayListOpType::kSetStyle:
+      if (!IsValidEnum(
+              static_cast<int>(static_cast<const SetStyleOp*>(op)->style),
+              static_cast<int>(DlDrawStyle::kLastStyle))) {
+        return false;
+      }
+      break;
+    case DisplayListOpType::kSetBlendMode:
+      if (!IsValidEnum(
+              static_cast<int>(static_cast<const SetBlendModeOp*>(op)->mode),
+              static_cast<int>(DlBlendMode::kLastMode))) {
+        return false;
+      }
+      break;
+    case DisplayListOpType::kDrawColor:
+      if (!IsValidEnum(
+              static_cast<int>(static_cast<const DrawColorOp*>(op)->mode),
+              static_cast<int>(DlBlendMode::kLastMode))) {
+        return false;
+      }
+      break;
+    default:
+      break;
+  }
+
+  switch (op->type) {
+#define DL_OP_VALUE_SIZE(name)     \
+  case DisplayListOpType::k##name: \
+    return size == SkAlignPtr(sizeof(name##Op));
+
+    FOR_EACH_SERIALIZABLE_VALUE_OP(DL_OP_VALUE_SIZE)
+
+#undef DL_OP_VALUE_SIZE
+
+#define DL_OP_POINTS_SIZE(name)                                                \
+  case DisplayListOpType::k##name: {                                           \
+    if (size < sizeof(name##Op)) {                                             \
+      return false;                                                            \
+    }                                                                          \
+    size_t count = static_cast<const name##Op*>(op)->count;                    \
+    return count <= (size - sizeof(name##Op)) / sizeof(SkPoint) &&             \
+           size == SkAlignPtr(sizeof(name##Op) + count * sizeof(SkPoint));     \
+  }
+
+    FOR_EACH_SERIALIZABLE_POINTS_OP(DL_OP_POINTS_SIZE)
+
+#undef DL_OP_POINTS_SIZE
+
+    default:
+      return false;
+  }
+}
+
+// Returns the number of ops in |ptr| to |end| if they are all serializable
+// and their saves and restores are balanced, or -1 otherwise.
+int64_t CountSerializableOps(const uint8_t* ptr, const uint8_t* end) {
+  int64_t op_count = 0;
+  int save_depth = 0;
+  while (ptr < end) {
+    if (static_cast<size_t>(end - ptr) < sizeof(DLOp)) {
+      return -1;
+    }
+    auto op = reinterpret_cast<const DLOp*>(ptr);
+    size_t size = op->size;
+    if (size < sizeof(DLOp) || size % sizeof(void*) != 0 ||
+        size > static_cast<size_t>(end - ptr) ||
+        !IsSerializableOp(op, size, save_depth)) {
+      return -1;
+    }
+    ptr += size;
+    op_count++;
+  }
+  return save_depth == 0 ? op_count : -1;
+}
+
+// Returns whether the ops of |type| only hold values, so that equal ops of
+// that type have equal bytes.
+bool IsValueOp(DisplayListOpType type) {
+  switch (type) {
+#define DL_OP_IS_VALUE_OP(name) case DisplayListOpType::k##name:
+    FOR_EACH_SERIALIZABLE_VALUE_OP(DL_OP_IS_VALUE_OP)
+    FOR_EACH_SERIALIZABLE_POINTS_OP(DL_OP_IS_VALUE_OP)
+#undef DL_OP_IS_VALUE_OP
+    return true;
+    default:
+      return false;
+  }
+}
+
+#undef FOR_EACH_SERIALIZABLE_VALUE_OP
+#undef FOR_EACH_SERIALIZABLE_POINTS_OP
+
+}  // namespace
+
+size_t DisplayList::ContentHash() const {
+  size_t hash = fml::HashCombine(byte_count_, op_count_);
+  const uint8_t* ptr = storage_.get();
+  const uint8_t* end = ptr + byte_count_;
+  while (ptr < end) {
+    auto op = reinterpret_cast<const DLOp*>(ptr);
+    fml::HashCombineSeed(hash, static_cast<int>(op->type),
+                         static_cast<uint32_t>(op->size));
+    if (IsValueOp(op->type)) {
+      // Hash the payload a word at a time. The builder clears the padding
+      // of each op, so equal ops have equal bytes.
+      for (size_t offset = sizeof(DLOp); offset + sizeof(uint32_t) <= op->size;
+           offset += sizeof(uint32_t)) {
+        uint32_t word;
+        memcpy(&word, ptr + offset, sizeof(word));
+        fml::HashCombineSeed(hash, word);
+      }
+    }
+    ptr += op->size;
+  }
+  return hash;
+}
+
+std::unique_ptr<fml::Mapping> DisplayList::Serialize() const {
+  const uint8_t* ptr = storage_.get();
+  if (CountSerializableOps(ptr, ptr + byte_count_) != op_count_) {
+    return nullptr;
+  }
+  SerializedHeader header = {
+      .magic = kSerializedMagic,
+      .version = kSerializedFormatVersion,
+      .op_layout = kSerializedOpLayout,
+      .pointer_size = sizeof(void*),
+      .byte_count = byte_count_,
+      .op_count = op_count_,
+      .flags = (can_apply_group_opacity_ ? kSerializedCanApplyGroupOpacity
+                                         : 0u) |
+               (modifies_transparent_black_
+                    ? kSerializedModifiesTransparentBlack
+                    : 0u),
+      .bounds = bounds_,
+  };
+  std::vector<uint8_t> data(sizeof(header) + byte_count_);
+  memcpy(data.data(), &header, sizeof(header));
+  if (byte_count_ > 0) {
+    memcpy(data.data() + sizeof(header), ptr, byte_count_);
+  }
+  return std::make_unique<fml::DataMapping>(std::move(data));
+}
+
+sk_sp<DisplayList> DisplayList::MakeFromMapping(
+    std::shared_ptr<const fml::Mapping> mapping) {
+  TRACE_EVENT0("flutter", "DisplayList::MakeFromMapping");
+  if (!mapping || !mapping->GetMapping() ||
+      mapping->GetSize() < sizeof(SerializedHeader)) {
+    return nullptr;
+  }
+  SerializedHeader header;
+  memcpy(&header, mapping->GetMapping(), sizeof(header));
+  if (header.magic != kSerializedMagic ||
+      header.version != kSerializedFormatVersion ||
+      header.op_layout != kSerializedOpLayout ||
+      header.pointer_size != sizeof(void*) ||
+      header.byte_count != mapping->GetSize() - sizeof(header)) {
+    return nullptr;
+  }
+  size_t offset = sizeof(header);
+  const uint8_t* ops = mapping->GetMapping() + offset;
+  if (reinterpret_cast<uintptr_t>(ops) % alignof(std::max_align_t) != 0) {
+    // The ops can only be dispatched in place when they are aligned as they
+    // would be in a DisplayListStorage.
+    mapping = std::make_shared<fml::DataMapping>(
+        std::vector<uint8_t>(ops, ops + header.byte_count));
+    offset = 0;
+  }
+  DisplayListStorage storage(std::move(mapping), offset);
+  const uint8_t* ptr = storage.get();
+  if (CountSerializableOps(ptr, ptr + header.byte_count) != header.op_count) {
+    return nullptr;
+  }
+  return sk_sp<DisplayList>(new DisplayList(
+      std::move(storage), header.byte_count, header.op_count, 0u, 0u,
+      header.bounds, header.flags & kSerializedCanApplyGroupOpacity,
+      /*is_ui_thread_safe=*/true,
+      header.flags & kSerializedModifiesTransparentBlack,
+      /*has_rtree=*/false, {}, {}));
+}
+
 }  // namespace flutter
@@ -6,11 +6,15 @@
 #define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 #include "flutter/display_list/dl_sampling_options.h"
 #include "flutter/display_list/geometry/dl_rtree.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 
 // The Flutter DisplayList mechanism encapsulates a persistent sequence of
 // rendering operations.
@@ -203,24 +207,51 @@ class SaveLayerOptions {
   };
 };
 
-// Manages a buffer allocated with malloc.
+// Manages the buffer that holds the ops of a DisplayList.
+//
+// Buffers of up to |kMaxPooledBytes| are taken from and given back to a
+// process-wide pool of power-of-two sized blocks, so that the builders
+// created every frame reuse the blocks of the display lists that have been
+// disposed of instead of growing new buffers with realloc. The pool is
+// shared between threads because display lists are usually built on the UI
+// thread and disposed of on the raster thread.
+//
+// A buffer may also be adopted from an |fml::Mapping| holding the ops of a
+// serialized display list, in which case it is read-only and the mapping is
+// kept alive until the storage is released.
 class DisplayListStorage {
  public:
+  static constexpr size_t kMinPooledBytes = 4096;
+  static constexpr size_t kMaxPooledBytes = kMinPooledBytes << 8;
+
   DisplayListStorage() = default;
-  DisplayListStorage(DisplayListStorage&&) = default;
+  DisplayListStorage(DisplayListStorage&& other);
+  // Adopts the bytes of |mapping| starting at |offset|.
+  DisplayListStorage(std::shared_ptr<const fml::Mapping> mapping,
+                     size_t offset);
+  ~DisplayListStorage();
 
-  uint8_t* get() const { return ptr_.get(); }
+  uint8_t* get() const { return ptr_; }
 
-  void realloc(size_t count) {
-    ptr_.reset(static_cast<uint8_t*>(std::realloc(ptr_.release(), count)));
-    FML_CHECK(ptr_);
-  }
+  size_t capacity() const { return capacity_; }
+
+  // Ensures room for at least |count| bytes, preserving the first |used|
+  // bytes of the current contents. New bytes are not initialized.
+  void reserve(size_t count, size_t used);
+
+  // Releases the room that is not needed to hold |count| bytes when that
+  // saves a pooled size class or more, preserving the first |count| bytes.
+  void trim(size_t count);
 
  private:
-  struct FreeDeleter {
-    void operator()(uint8_t* p) { std::free(p); }
-  };
-  std::unique_ptr<uint8_t, FreeDeleter> ptr_;
+  void Release();
+
+  uint8_t* ptr_ = nullptr;
+  size_t capacity_ = 0;
+  bool pooled_ = false;
+  std::shared_ptr<const fml::Mapping> mapping_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListStorage);
 };
 
 class Culler;
@@ -238,6 +269,13 @@ class DisplayList : public SkRefCnt {
   void Dispatch(DlOpReceiver& ctx, const SkRect& cull_rect) const;
   void Dispatch(DlOpReceiver& ctx, const SkIRect& cull_rect) const;
 
+  /// Dispatches the rendering ops of the rtree leaf node indices in
+  /// |rect_indices|, which must be in numerical order, such as a group
+  /// returned by |DlRTree::searchAndPartitionRects|, along with the ops that
+  /// set up their attributes, transforms and clips. The DisplayList must
+  /// have an rtree.
+  void Dispatch(DlOpReceiver& ctx, const std::vector<int>& rect_indices) const;
+
   // From historical behavior, SkPicture always included nested bytes,
   // but nested ops are only included if requested. The defaults used
   // here for these accessors follow that pattern.
@@ -254,8 +292,14 @@ class DisplayList : public SkRefCnt {
 
   const SkRect& bounds() const { return bounds_; }
 
-  bool has_rtree() const { return rtree_ != nullptr; }
-  sk_sp<const DlRTree> rtree() const { return rtree_; }
+  bool has_rtree() const { return has_rtree_; }
+
+  /// Returns the rtree of the rendering ops if the DisplayList was built
+  /// with one, or null otherwise. The rtree is built from the bounds of the
+  /// ops recorded by the builder the first time it is needed, which is
+  /// usually when the DisplayList is first dispatched with a cull rect that
+  /// does not contain its bounds.
+  sk_sp<const DlRTree> rtree() const;
 
   bool Equals(const DisplayList* other) const;
   bool Equals(const DisplayList& other) const { return Equals(&other); }
@@ -263,6 +307,11 @@ class DisplayList : public SkRefCnt {
     return Equals(other.get());
   }
 
+  /// Returns a hash of the ops of this DisplayList that is the same for all
+  /// DisplayLists that are |Equals|, so that they can be looked up by
+  /// content. Ops that refer to other objects only contribute their type.
+  size_t ContentHash() const;
+
   bool can_apply_group_opacity() const { return can_apply_group_opacity_; }
   bool isUIThreadSafe() const { return is_ui_thread_safe_; }
 
@@ -279,6 +328,32 @@ class DisplayList : public SkRefCnt {
     return modifies_transparent_black_;
   }
 
+  /// @brief     Writes the ops of this DisplayList into a mapping that can be
+  ///            stored in a file or shipped as an asset and read back with
+  ///            |MakeFromMapping|.
+  ///
+  /// The ops are written in their in-memory layout so that they can be
+  /// dispatched from the mapping without being parsed. Ops that refer to
+  /// objects outside of the op buffer (images, paths, text, vertices, color
+  /// sources, filters and nested DisplayLists) cannot be written that way,
+  /// so null is returned for DisplayLists that contain any of them.
+  ///
+  /// The layout is specific to the version of the engine that wrote it and
+  /// is rejected by |MakeFromMapping| in other versions, so serialized
+  /// DisplayLists are only suitable for caches that can be rebuilt.
+  std::unique_ptr<fml::Mapping> Serialize() const;
+
+  /// @brief     Creates a DisplayList that dispatches the ops written into
+  ///            |mapping| by |Serialize|, or null if the mapping does not
+  ///            hold a DisplayList that this version of the engine wrote.
+  ///
+  /// The op headers are checked, but the ops are neither copied nor rebuilt
+  /// when the mapping is suitably aligned, so a DisplayList loaded from an
+  /// |fml::FileMapping| is dispatched from the mapped file. The mapping is
+  /// kept alive by the DisplayList. The DisplayList has no rtree.
+  static sk_sp<DisplayList> MakeFromMapping(
+      std::shared_ptr<const fml::Mapping> mapping);
+
  private:
   DisplayList(DisplayListStorage&& ptr,
               size_t byte_count,
@@ -289,7 +364,9 @@ class DisplayList : public SkRefCnt {
               bool can_apply_group_opacity,
               bool is_ui_thread_safe,
               bool modifies_transparent_black,
-              sk_sp<const DlRTree> rtree);
+              bool has_rtree,
+              std::vector<SkRect> rtree_rects,
+              std::vector<int> rtree_indices);
 
   static uint32_t next_unique_id();
 
@@ -309,7 +386,13 @@ class DisplayList : public SkRefCnt {
   const bool is_ui_thread_safe_;
   const bool modifies_transparent_black_;
 
-  const sk_sp<const DlRTree> rtree_;
+  const bool has_rtree_;
+  mutable std::once_flag rtree_once_;
+  // The bounds and op indices that the rtree is built from, released once
+  // the rtree has been built.
+  mutable std::vector<SkRect> rtree_rects_;
+  mutable std::vector<int> rtree_indices_;
+  mutable sk_sp<const DlRTree> rtree_;
 
   void Dispatch(DlOpReceiver& ctx,
                 uint8_t* ptr,
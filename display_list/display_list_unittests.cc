@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -16,7 +17,9 @@
 #include "flutter/display_list/skia/dl_sk_dispatcher.h"
 #include "flutter/display_list/testing/dl_test_snippets.h"
 #include "flutter/display_list/utils/dl_receiver_utils.h"
+#include "flutter/fml/file.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/math.h"
 #include "flutter/testing/display_list_testing.h"
 #include "flutter/testing/testing.h"
@@ -250,6 +253,138 @@ TEST_F(DisplayListTest, BuilderCanBeReused) {
   ASSERT_TRUE(dl->Equals(dl2));
 }
 
+TEST_F(DisplayListTest, ReservedBuilderMatchesUnreservedBuilder) {
+  DisplayListBuilder reserved_builder(kTestBounds);
+  reserved_builder.ReserveBytes(64 * 1024);
+  DisplayListBuilder builder(kTestBounds);
+  for (int i = 0; i < 100; i++) {
+    SkRect rect = SkRect::MakeXYWH(i, i, 10, 10);
+    reserved_builder.DrawRect(rect, DlPaint(DlColor::kBlue()));
+    builder.DrawRect(rect, DlPaint(DlColor::kBlue()));
+  }
+  auto reserved_dl = reserved_builder.Build();
+  auto dl = builder.Build();
+  EXPECT_EQ(reserved_dl->bytes(), dl->bytes());
+  EXPECT_TRUE(reserved_dl->Equals(dl));
+}
+
+TEST_F(DisplayListTest, StorageReusesPooledBlocks) {
+  uint8_t* released_block;
+  {
+    DisplayListStorage storage;
+    storage.reserve(5000, 0);
+    EXPECT_EQ(storage.capacity(), 8192u);
+    released_block = storage.get();
+  }
+  DisplayListStorage storage;
+  storage.reserve(6000, 0);
+  EXPECT_EQ(storage.get(), released_block);
+
+  memset(storage.get(), 0xAB, 100);
+  storage.trim(100);
+  EXPECT_EQ(storage.capacity(), DisplayListStorage::kMinPooledBytes);
+  EXPECT_EQ(storage.get()[99], 0xAB);
+
+  storage.reserve(DisplayListStorage::kMaxPooledBytes + 1, 100);
+  EXPECT_EQ(storage.capacity(), DisplayListStorage::kMaxPooledBytes + 1);
+  EXPECT_EQ(storage.get()[99], 0xAB);
+}
+
+static sk_sp<DisplayList> MakeSerializableDisplayList() {
+  DisplayListBuilder builder;
+  DlPaint paint(DlColor::kBlue());
+  builder.Save();
+  builder.Translate(10.0f, 10.0f);
+  builder.ClipRRect(SkRRect::MakeRectXY(SkRect::MakeWH(80.0f, 80.0f), 5.0f,
+                                        5.0f),
+                    DlCanvas::ClipOp::kIntersect, true);
+  builder.DrawRect(SkRect::MakeWH(50.0f, 50.0f), paint);
+  paint.setStrokeWidth(3.0f).setDrawStyle(DlDrawStyle::kStroke);
+  builder.DrawCircle(SkPoint::Make(40.0f, 40.0f), 20.0f, paint);
+  builder.Restore();
+  SkPoint points[] = {{0.0f, 0.0f}, {20.0f, 30.0f}, {60.0f, 10.0f}};
+  builder.DrawPoints(DlCanvas::PointMode::kPolygon, 3, points, paint);
+  return builder.Build();
+}
+
+TEST_F(DisplayListTest, SerializedDisplayListRoundTrips) {
+  auto display_list = MakeSerializableDisplayList();
+  std::shared_ptr<fml::Mapping> mapping = display_list->Serialize();
+  ASSERT_NE(mapping, nullptr);
+
+  auto loaded = DisplayList::MakeFromMapping(mapping);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_TRUE(DisplayListsEQ_Verbose(display_list, loaded));
+  EXPECT_EQ(loaded->bounds(), display_list->bounds());
+  EXPECT_EQ(loaded->op_count(), display_list->op_count());
+  EXPECT_EQ(loaded->can_apply_group_opacity(),
+            display_list->can_apply_group_opacity());
+  EXPECT_EQ(loaded->modifies_transparent_black(),
+            display_list->modifies_transparent_black());
+  EXPECT_NE(loaded->unique_id(), display_list->unique_id());
+}
+
+TEST_F(DisplayListTest, SerializedDisplayListIsDispatchedFromFileMapping) {
+  auto display_list = MakeSerializableDisplayList();
+  auto mapping = display_list->Serialize();
+  ASSERT_NE(mapping, nullptr);
+
+  fml::ScopedTemporaryDirectory temp_dir;
+  ASSERT_TRUE(fml::WriteAtomically(temp_dir.fd(), "picture.dl", *mapping));
+  std::shared_ptr<fml::Mapping> file_mapping =
+      fml::FileMapping::CreateReadOnly(temp_dir.fd(), "picture.dl");
+  ASSERT_NE(file_mapping, nullptr);
+
+  auto loaded = DisplayList::MakeFromMapping(file_mapping);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_TRUE(DisplayListsEQ_Verbose(display_list, loaded));
+}
+
+TEST_F(DisplayListTest, DisplayListWithReferencesIsNotSerialized) {
+  DisplayListBuilder builder;
+  builder.DrawPath(SkPath().addOval(SkRect::MakeWH(10.0f, 10.0f)), DlPaint());
+  EXPECT_EQ(builder.Build()->Serialize(), nullptr);
+
+  DisplayListBuilder nested_builder;
+  nested_builder.DrawDisplayList(MakeSerializableDisplayList());
+  EXPECT_EQ(nested_builder.Build()->Serialize(), nullptr);
+}
+
+TEST_F(DisplayListTest, InvalidSerializedDisplayListIsRejected) {
+  auto mapping = MakeSerializableDisplayList()->Serialize();
+  ASSERT_NE(mapping, nullptr);
+  std::vector<uint8_t> bytes(mapping->GetMapping(),
+                             mapping->GetMapping() + mapping->GetSize());
+
+  auto load = [](std::vector<uint8_t> data) {
+    return DisplayList::MakeFromMapping(
+        std::make_shared<fml::DataMapping>(std::move(data)));
+  };
+  EXPECT_NE(load(bytes), nullptr);
+  EXPECT_EQ(DisplayList::MakeFromMapping(nullptr), nullptr);
+
+  // Truncated.
+  EXPECT_EQ(load({bytes.begin(), bytes.end() - 8}), nullptr);
+  EXPECT_EQ(load({bytes.begin(), bytes.begin() + 8}), nullptr);
+
+  // Wrong magic or format version.
+  auto corrupt = bytes;
+  corrupt[0] ^= 0xFF;
+  EXPECT_EQ(load(corrupt), nullptr);
+  corrupt = bytes;
+  corrupt[4] ^= 0xFF;
+  EXPECT_EQ(load(corrupt), nullptr);
+
+  // The last op, which draws the points, claims 8 more bytes than remain.
+  corrupt = bytes;
+  corrupt.resize(corrupt.size() - 8);
+  uint64_t byte_count;
+  memcpy(&byte_count, corrupt.data() + 16, sizeof(byte_count));
+  byte_count -= 8;
+  memcpy(corrupt.data() + 16, &byte_count, sizeof(byte_count));
+  EXPECT_EQ(load(corrupt), nullptr);
+}
+
 TEST_F(DisplayListTest, SaveRestoreRestoresTransform) {
   SkRect cull_rect = SkRect::MakeLTRB(-10.0f, -10.0f, 500.0f, 500.0f);
   DisplayListBuilder builder(cull_rect);
@@ -1133,6 +1268,43 @@ TEST_F(DisplayListTest, OverlappingOpsDoNotSupportGroupOpacity) {
   EXPECT_FALSE(display_list->can_apply_group_opacity());
 }
 
+TEST_F(DisplayListTest, NonOverlappingOpsSupportGroupOpacity) {
+  DisplayListBuilder builder;
+  DlOpReceiver& receiver = ToReceiver(builder);
+  for (int i = 0; i < 10; i++) {
+    receiver.drawRect(SkRect::MakeXYWH(i * 30, 0, 20, 20));
+  }
+  auto display_list = builder.Build();
+  EXPECT_TRUE(display_list->can_apply_group_opacity());
+}
+
+TEST_F(DisplayListTest, OpsSharingAPixelDoNotSupportGroupOpacity) {
+  DisplayListBuilder builder;
+  DlOpReceiver& receiver = ToReceiver(builder);
+  receiver.drawRect(SkRect::MakeLTRB(0, 0, 10.5, 10));
+  receiver.drawRect(SkRect::MakeLTRB(10.5, 0, 20, 10));
+  auto display_list = builder.Build();
+  EXPECT_FALSE(display_list->can_apply_group_opacity());
+}
+
+TEST_F(DisplayListTest, NonOverlappingOpsInSaveSupportGroupOpacity) {
+  DisplayListBuilder builder;
+  builder.DrawRect({0, 0, 10, 10}, DlPaint());
+  builder.Save();
+  builder.Translate(20, 0);
+  builder.DrawRect({0, 0, 10, 10}, DlPaint());
+  builder.Restore();
+  builder.DrawRect({40, 0, 50, 10}, DlPaint());
+  EXPECT_TRUE(builder.Build()->can_apply_group_opacity());
+
+  builder.DrawRect({0, 0, 10, 10}, DlPaint());
+  builder.Save();
+  builder.Translate(5, 0);
+  builder.DrawRect({0, 0, 10, 10}, DlPaint());
+  builder.Restore();
+  EXPECT_FALSE(builder.Build()->can_apply_group_opacity());
+}
+
 TEST_F(DisplayListTest, SaveLayerFalseSupportsGroupOpacityOverlappingChidren) {
   DisplayListBuilder builder;
   DlOpReceiver& receiver = ToReceiver(builder);
@@ -2172,6 +2344,127 @@ TEST_F(DisplayListTest, RTreeOfSimpleScene) {
   test_rtree(rtree, {19, 19, 51, 51}, rects, {0, 1});
 }
 
+TEST_F(DisplayListTest, RTreeIsBuiltOnceWhenFirstNeeded) {
+  DisplayListBuilder builder(/*prepare_rtree=*/true);
+  builder.DrawRect({10, 10, 20, 20}, DlPaint());
+  builder.DrawRect({50, 50, 60, 60}, DlPaint());
+  auto display_list = builder.Build();
+  EXPECT_TRUE(display_list->has_rtree());
+
+  std::vector<sk_sp<const DlRTree>> rtrees(4);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < rtrees.size(); i++) {
+    threads.emplace_back(
+        [&display_list, &rtrees, i]() { rtrees[i] = display_list->rtree(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_NE(rtrees[0], nullptr);
+  for (const auto& rtree : rtrees) {
+    EXPECT_EQ(rtree, rtrees[0]);
+  }
+  EXPECT_EQ(display_list->rtree(), rtrees[0]);
+  test_rtree(rtrees[0], {19, 19, 51, 51},
+             {{10, 10, 20, 20}, {50, 50, 60, 60}}, {0, 1});
+
+  DisplayListBuilder no_rtree_builder(/*prepare_rtree=*/false);
+  no_rtree_builder.DrawRect({10, 10, 20, 20}, DlPaint());
+  auto no_rtree_display_list = no_rtree_builder.Build();
+  EXPECT_FALSE(no_rtree_display_list->has_rtree());
+  EXPECT_EQ(no_rtree_display_list->rtree(), nullptr);
+}
+
+TEST_F(DisplayListTest, DispatchPartitionsOfRTree) {
+  DisplayListBuilder builder(/*prepare_rtree=*/true);
+  builder.Translate(5, 5);
+  builder.DrawRect({10, 10, 20, 20}, DlPaint(DlColor::kRed()));
+  builder.DrawRect({50, 50, 60, 60}, DlPaint(DlColor::kBlue()));
+  builder.DrawRect({15, 15, 25, 25}, DlPaint(DlColor::kGreen()));
+  auto display_list = builder.Build();
+
+  auto groups =
+      display_list->rtree()->searchAndPartitionRects(display_list->bounds());
+  ASSERT_EQ(groups.size(), 2u);
+
+  // Attribute ops are dispatched for every group, so the partial
+  // DisplayLists are compared by their bounds.
+  DisplayListBuilder first_builder;
+  display_list->Dispatch(ToReceiver(first_builder), groups[0]);
+  EXPECT_EQ(first_builder.Build()->bounds(), SkRect::MakeLTRB(15, 15, 30, 30));
+
+  DisplayListBuilder second_builder;
+  display_list->Dispatch(ToReceiver(second_builder), groups[1]);
+  EXPECT_EQ(second_builder.Build()->bounds(),
+            SkRect::MakeLTRB(55, 55, 65, 65));
+}
+
+TEST_F(DisplayListTest, BuilderPublishesChunksAtRootSaveLevel) {
+  DisplayListBuilder builder(/*prepare_rtree=*/true);
+  std::vector<sk_sp<DisplayList>> chunks;
+  builder.SetChunkCallback(0u, [&chunks](const sk_sp<DisplayList>& chunk) {
+    chunks.push_back(chunk);
+  });
+
+  builder.Save();
+  builder.Translate(5, 5);
+  builder.DrawRect({10, 10, 20, 20}, DlPaint(DlColor::kRed()));
+  builder.Restore();
+  ASSERT_EQ(chunks.size(), 1u);
+  EXPECT_EQ(chunks[0]->bounds(), SkRect::MakeLTRB(15, 15, 25, 25));
+
+  builder.DrawRect({50, 50, 60, 60}, DlPaint(DlColor::kBlue()));
+  builder.Save();
+  builder.DrawRect({70, 70, 80, 80}, DlPaint(DlColor::kBlue()));
+  builder.Restore();
+  ASSERT_EQ(chunks.size(), 2u);
+  EXPECT_EQ(chunks[1]->bounds(), SkRect::MakeLTRB(50, 50, 80, 80));
+
+  builder.DrawRect({0, 0, 5, 5}, DlPaint(DlColor::kGreen()));
+  auto display_list = builder.Build();
+  ASSERT_EQ(chunks.size(), 2u);
+
+  // The built DisplayList draws each chunk and then the ops recorded after
+  // the last one.
+  EXPECT_EQ(display_list->op_count(), 3u);
+  EXPECT_EQ(display_list->bounds(), SkRect::MakeLTRB(0, 0, 80, 80));
+  ASSERT_TRUE(display_list->has_rtree());
+  std::vector<int> indices;
+  display_list->rtree()->search({16, 16, 17, 17}, &indices);
+  EXPECT_EQ(indices.size(), 1u);
+}
+
+TEST_F(DisplayListTest, BuilderDoesNotPublishChunksUnderRootClipOrTransform) {
+  std::vector<sk_sp<DisplayList>> chunks;
+  auto callback = [&chunks](const sk_sp<DisplayList>& chunk) {
+    chunks.push_back(chunk);
+  };
+
+  DisplayListBuilder clip_builder;
+  clip_builder.SetChunkCallback(0u, callback);
+  clip_builder.ClipRect({0, 0, 50, 50});
+  clip_builder.Save();
+  clip_builder.DrawRect({10, 10, 20, 20}, DlPaint());
+  clip_builder.Restore();
+  EXPECT_TRUE(chunks.empty());
+  EXPECT_EQ(clip_builder.Build()->op_count(), 2u);
+
+  DisplayListBuilder transform_builder;
+  transform_builder.SetChunkCallback(0u, callback);
+  transform_builder.Translate(10, 10);
+  transform_builder.Save();
+  transform_builder.DrawRect({10, 10, 20, 20}, DlPaint());
+  transform_builder.Restore();
+  EXPECT_TRUE(chunks.empty());
+
+  DisplayListBuilder small_builder;
+  small_builder.SetChunkCallback(1024u, callback);
+  small_builder.Save();
+  small_builder.DrawRect({10, 10, 20, 20}, DlPaint());
+  small_builder.Restore();
+  EXPECT_TRUE(chunks.empty());
+}
+
 TEST_F(DisplayListTest, RTreeOfSaveRestoreScene) {
   DisplayListBuilder builder(/*prepare_rtree=*/true);
   DlOpReceiver& receiver = ToReceiver(builder);
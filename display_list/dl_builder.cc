@@ -46,14 +46,18 @@ void* DisplayListBuilder::Push(size_t pod, int render_op_inc, Args&&... args) {
   if (used_ + size > allocated_) {
     static_assert(is_power_of_two(DL_BUILDER_PAGE),
                   "This math needs updating for non-pow2.");
-    // Next greater multiple of DL_BUILDER_PAGE.
-    allocated_ = (used_ + size + DL_BUILDER_PAGE) & ~(DL_BUILDER_PAGE - 1);
-    storage_.realloc(allocated_);
+    // Next greater multiple of DL_BUILDER_PAGE. The storage may round this
+    // up further to the size of a pooled block.
+    storage_.reserve((used_ + size + DL_BUILDER_PAGE) & ~(DL_BUILDER_PAGE - 1),
+                     used_);
+    allocated_ = storage_.capacity();
     FML_DCHECK(storage_.get());
-    memset(storage_.get() + used_, 0, allocated_ - used_);
   }
   FML_DCHECK(used_ + size <= allocated_);
   auto op = reinterpret_cast<T*>(storage_.get() + used_);
+  // Pooled storage is not cleared, and ops are compared with memcmp, so the
+  // padding of each op must be zeroed as it is pushed.
+  memset(op, 0, size);
   used_ += size;
   new (op) T{std::forward<Args>(args)...};
   op->type = T::kType;
@@ -64,9 +68,57 @@ void* DisplayListBuilder::Push(size_t pod, int render_op_inc, Args&&... args) {
 }
 
 sk_sp<DisplayList> DisplayListBuilder::Build() {
+  chunk_callback_ = nullptr;
   while (layer_stack_.size() > 1) {
     restore();
   }
+  if (chunks_.empty()) {
+    return BuildOps();
+  }
+
+  // Seal the remaining ops as the last chunk and record a DisplayList that
+  // draws each of the chunks in turn.
+  std::vector<sk_sp<DisplayList>> chunks = std::move(chunks_);
+  chunks_.clear();
+  if (used_ > 0) {
+    chunks.push_back(BuildOps());
+    ResetAccumulator();
+  }
+  for (const sk_sp<DisplayList>& chunk : chunks) {
+    DrawDisplayList(chunk);
+  }
+  return BuildOps();
+}
+
+void DisplayListBuilder::SetChunkCallback(size_t min_chunk_bytes,
+                                          ChunkCallback callback) {
+  min_chunk_bytes_ = min_chunk_bytes;
+  chunk_callback_ = std::move(callback);
+}
+
+bool DisplayListBuilder::CanBuildChunk() const {
+  return layer_stack_.size() == 1 && !has_root_clip_ &&
+         tracker_.matrix_4x4() == SkM44();
+}
+
+void DisplayListBuilder::BuildChunk() {
+  FML_DCHECK(CanBuildChunk());
+  sk_sp<DisplayList> chunk = BuildOps();
+  ResetAccumulator();
+  chunks_.push_back(chunk);
+  chunk_callback_(chunk);
+}
+
+void DisplayListBuilder::ResetAccumulator() {
+  if (accumulator_->type() == BoundsAccumulatorType::kRTree) {
+    accumulator_ = std::make_unique<RTreeBoundsAccumulator>();
+  } else {
+    accumulator_ = std::make_unique<RectBoundsAccumulator>();
+  }
+}
+
+sk_sp<DisplayList> DisplayListBuilder::BuildOps() {
+  FML_DCHECK(layer_stack_.size() == 1);
 
   size_t bytes = used_;
   int count = render_op_count_;
@@ -79,15 +131,29 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   used_ = allocated_ = render_op_count_ = op_index_ = 0;
   nested_bytes_ = nested_op_count_ = 0;
   is_ui_thread_safe_ = true;
-  storage_.realloc(bytes);
+  storage_.trim(bytes);
   layer_stack_.pop_back();
   layer_stack_.emplace_back();
+  current_layer_ = &layer_stack_.back();
   tracker_.reset();
+  has_root_clip_ = false;
   current_ = DlPaint();
+  pending_op_bounds_.setEmpty();
+
+  // The rtree is only built from the bounds of the ops the first time the
+  // DisplayList is culled, see |DisplayList::rtree|.
+  std::vector<SkRect> rtree_rects;
+  std::vector<int> rtree_indices;
+  const RTreeBoundsAccumulator* rtree_accumulator = this->rtree_accumulator();
+  if (rtree_accumulator) {
+    rtree_rects = rtree_accumulator->rects();
+    rtree_indices = rtree_accumulator->rect_indices();
+  }
 
   return sk_sp<DisplayList>(new DisplayList(
       std::move(storage_), bytes, count, nested_bytes, nested_count, bounds(),
-      compatible, is_safe, affects_transparency, rtree()));
+      compatible, is_safe, affects_transparency, rtree_accumulator != nullptr,
+      std::move(rtree_rects), std::move(rtree_indices)));
 }
 
 DisplayListBuilder::DisplayListBuilder(const SkRect& cull_rect,
@@ -103,6 +169,11 @@ DisplayListBuilder::DisplayListBuilder(const SkRect& cull_rect,
   current_layer_ = &layer_stack_.back();
 }
 
+void DisplayListBuilder::ReserveBytes(size_t bytes) {
+  storage_.reserve(bytes, used_);
+  allocated_ = storage_.capacity();
+}
+
 DisplayListBuilder::~DisplayListBuilder() {
   uint8_t* ptr = storage_.get();
   if (ptr) {
@@ -462,9 +533,16 @@ void DisplayListBuilder::Restore() {
       if (layer_info.cannot_inherit_opacity()) {
         current_layer_->mark_incompatible();
       } else if (layer_info.has_compatible_op()) {
-        current_layer_->add_compatible_op();
+        current_layer_->add_compatible_ops(layer_info);
       }
     }
+    // Any bounds accumulated while restoring belong to the layer as a whole
+    // rather than to the next op.
+    pending_op_bounds_.setEmpty();
+
+    if (chunk_callback_ && used_ >= min_chunk_bytes_ && CanBuildChunk()) {
+      BuildChunk();
+    }
   }
 }
 void DisplayListBuilder::RestoreToCount(int restore_count) {
@@ -543,6 +621,8 @@ void DisplayListBuilder::saveLayer(const SkRect* bounds,
     }
   }
   UpdateLayerResult(result);
+  // A backdrop floods the new layer as a whole rather than the next op.
+  pending_op_bounds_.setEmpty();
 
   if (options.renders_with_attributes() && current_.getImageFilter()) {
     // We use |resetCullRect| here because we will be accumulating bounds of
@@ -685,6 +765,7 @@ void DisplayListBuilder::ClipRect(const SkRect& rect,
     return;
   }
   tracker_.clipRect(rect, clip_op, is_aa);
+  has_root_clip_ |= layer_stack_.size() == 1;
   if (current_layer_->is_nop_ || tracker_.is_cull_rect_empty()) {
     current_layer_->is_nop_ = true;
     return;
@@ -706,6 +787,7 @@ void DisplayListBuilder::ClipRRect(const SkRRect& rrect,
     clipRect(rrect.rect(), clip_op, is_aa);
   } else {
     tracker_.clipRRect(rrect, clip_op, is_aa);
+    has_root_clip_ |= layer_stack_.size() == 1;
     if (current_layer_->is_nop_ || tracker_.is_cull_rect_empty()) {
       current_layer_->is_nop_ = true;
       return;
@@ -742,6 +824,7 @@ void DisplayListBuilder::ClipPath(const SkPath& path,
     }
   }
   tracker_.clipPath(path, clip_op, is_aa);
+  has_root_clip_ |= layer_stack_.size() == 1;
   if (current_layer_->is_nop_ || tracker_.is_cull_rect_empty()) {
     current_layer_->is_nop_ = true;
     return;
@@ -1430,6 +1513,7 @@ bool DisplayListBuilder::AccumulateUnbounded() {
     return false;
   }
   accumulator()->accumulate(clip, op_index_);
+  pending_op_bounds_.join(clip);
   return true;
 }
 
@@ -1446,6 +1530,7 @@ bool DisplayListBuilder::AccumulateBounds(SkRect& bounds) {
     tracker_.mapRect(&bounds);
     if (bounds.intersect(tracker_.device_cull_rect())) {
       accumulator()->accumulate(bounds, op_index_);
+      pending_op_bounds_.join(bounds);
       return true;
     }
   }
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_BUILDER_H_
 #define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_BUILDER_H_
 
+#include <functional>
+
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_blend_mode.h"
 #include "flutter/display_list/dl_canvas.h"
@@ -40,6 +42,11 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   ~DisplayListBuilder();
 
+  // Reserves room for |bytes| of ops, typically the size of an earlier
+  // recording of similar content, so that the storage does not need to grow
+  // while the ops are recorded. Unused room is released by |Build|.
+  void ReserveBytes(size_t bytes);
+
   // |DlCanvas|
   SkISize GetBaseLayerSize() const override;
   // |DlCanvas|
@@ -246,6 +253,16 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   sk_sp<DisplayList> Build();
 
+  using ChunkCallback = std::function<void(const sk_sp<DisplayList>&)>;
+
+  // Seals the ops recorded so far into a DisplayList of their own, called a
+  // chunk, whenever at least |min_chunk_bytes| of ops have been recorded and
+  // a |Restore| returns to the root save level with no transform or clip in
+  // effect. Each chunk is passed to |callback| as soon as it is sealed, so
+  // that it can be prepared for rendering while recording continues, and
+  // the DisplayList returned from |Build| draws all of the chunks in order.
+  void SetChunkCallback(size_t min_chunk_bytes, ChunkCallback callback);
+
  private:
   // This method exposes the internal stateful DlOpReceiver implementation
   // of the DisplayListBuilder, primarily for testing purposes. Its use
@@ -497,6 +514,22 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   bool is_ui_thread_safe_ = true;
 
+  ChunkCallback chunk_callback_;
+  size_t min_chunk_bytes_ = 0;
+  std::vector<sk_sp<DisplayList>> chunks_;
+
+  // Whether a clip has been applied at the root save level, which would be
+  // lost if the ops recorded after it were sealed into a separate chunk.
+  bool has_root_clip_ = false;
+
+  // Builds a DisplayList from the ops recorded so far, with any saves
+  // already restored, and resets the builder to record the next one.
+  sk_sp<DisplayList> BuildOps();
+
+  bool CanBuildChunk() const;
+  void BuildChunk();
+  void ResetAccumulator();
+
   template <typename T, typename... Args>
   void* Push(size_t extra, int op_inc, Args&&... args);
 
@@ -508,6 +541,8 @@ class DisplayListBuilder final : public virtual DlCanvas,
     return SkScalarIsFinite(sigma) && sigma > 0.0;
   }
 
+  static constexpr size_t kMaxOpacityCompatibleOps = 32;
+
   class LayerInfo {
    public:
     explicit LayerInfo(
@@ -539,19 +574,51 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
     void mark_incompatible() { cannot_inherit_opacity_ = true; }
 
-    // For now this only allows a single compatible op to mark the
-    // layer as being compatible with group opacity. If we start
-    // computing bounds of ops in the Builder methods then we
-    // can upgrade this to checking for overlapping ops.
+    // Records a compatible op that touches the device pixels covered by
+    // |device_bounds|, or an op whose bounds are not known if the bounds are
+    // empty. The layer remains compatible with group opacity as long as the
+    // bounds of all of its compatible ops are known and do not overlap, so
+    // that applying the opacity to each op individually cannot reveal any
+    // overdraw. As each op is compared with all of the previous ones, a layer
+    // with more than |kMaxOpacityCompatibleOps| ops is conservatively marked
+    // as incompatible.
     // See https://github.com/flutter/flutter/issues/93899
-    void add_compatible_op() {
-      if (!cannot_inherit_opacity_) {
-        if (has_compatible_op_) {
+    void add_compatible_op(const SkRect& device_bounds) {
+      if (cannot_inherit_opacity_) {
+        return;
+      }
+      if (has_compatible_op_ &&
+          (device_bounds.isEmpty() || has_unbounded_compatible_op_ ||
+           compatible_op_bounds_.size() >= kMaxOpacityCompatibleOps)) {
+        cannot_inherit_opacity_ = true;
+        return;
+      }
+      // Ops that share a partially covered pixel overlap once they are
+      // anti-aliased, so compare the pixels they touch.
+      SkRect pixel_bounds = SkRect::Make(device_bounds.roundOut());
+      for (const SkRect& bounds : compatible_op_bounds_) {
+        if (bounds.intersects(pixel_bounds)) {
           cannot_inherit_opacity_ = true;
-        } else {
-          has_compatible_op_ = true;
+          return;
         }
       }
+      has_compatible_op_ = true;
+      if (device_bounds.isEmpty()) {
+        has_unbounded_compatible_op_ = true;
+      } else {
+        compatible_op_bounds_.push_back(pixel_bounds);
+      }
+    }
+
+    // Records the compatible ops of a restored save() layer, which share
+    // the device space of this layer.
+    void add_compatible_ops(const LayerInfo& layer) {
+      for (const SkRect& bounds : layer.compatible_op_bounds_) {
+        add_compatible_op(bounds);
+      }
+      if (layer.has_unbounded_compatible_op_) {
+        add_compatible_op(SkRect::MakeEmpty());
+      }
     }
 
     // Records that the current layer contains an op that produces visible
@@ -596,6 +663,8 @@ class DisplayListBuilder final : public virtual DlCanvas,
     bool has_layer_;
     bool cannot_inherit_opacity_ = false;
     bool has_compatible_op_ = false;
+    bool has_unbounded_compatible_op_ = false;
+    std::vector<SkRect> compatible_op_bounds_;
     std::shared_ptr<const DlImageFilter> filter_;
     bool is_unbounded_ = false;
     bool has_deferred_save_op_ = false;
@@ -615,6 +684,10 @@ class DisplayListBuilder final : public virtual DlCanvas,
   // are compatible with rendering ops applying an inherited opacity.
   bool current_opacity_compatibility_ = true;
 
+  // The device bounds accumulated for the op currently being recorded,
+  // consumed by |UpdateLayerOpacityCompatibility|.
+  SkRect pending_op_bounds_ = SkRect::MakeEmpty();
+
   // Returns the compatibility of a given blend mode for applying an
   // inherited opacity value to modulate the visibility of the op.
   // For now we only accept SrcOver blend modes but this could be expanded
@@ -636,10 +709,11 @@ class DisplayListBuilder final : public virtual DlCanvas,
   // that has determined its compatibility as indicated by |compatible|.
   void UpdateLayerOpacityCompatibility(bool compatible) {
     if (compatible) {
-      current_layer_->add_compatible_op();
+      current_layer_->add_compatible_op(pending_op_bounds_);
     } else {
       current_layer_->mark_incompatible();
     }
+    pending_op_bounds_.setEmpty();
   }
 
   // Check for opacity compatibility for an op that may or may not use the
@@ -704,13 +778,18 @@ class DisplayListBuilder final : public virtual DlCanvas,
     return accumulator_->bounds();
   }
 
-  sk_sp<DlRTree> rtree() {
+  // Returns the bounds of the ops from which the rtree of the DisplayList
+  // is built when it is first needed, or null if no rtree was requested.
+  const RTreeBoundsAccumulator* rtree_accumulator() const {
     FML_DCHECK(layer_stack_.size() == 1);
+    if (accumulator_->type() != BoundsAccumulatorType::kRTree) {
+      return nullptr;
+    }
     if (is_unbounded()) {
       FML_LOG(INFO) << "returning partial rtree for unbounded DisplayList";
     }
 
-    return accumulator_->rtree();
+    return static_cast<const RTreeBoundsAccumulator*>(accumulator_.get());
   }
 
   static DisplayListAttributeFlags FlagsForPointMode(PointMode mode);
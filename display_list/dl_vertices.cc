@@ -4,6 +4,8 @@
 
 #include "flutter/display_list/dl_vertices.h"
 
+#include <atomic>
+
 #include "flutter/display_list/utils/dl_bounds_accumulator.h"
 #include "flutter/fml/logging.h"
 
@@ -20,6 +22,11 @@ static void DlVerticesDeleter(void* p) {
   ::operator delete(p);
 }
 
+static uint32_t NextUniqueId() {
+  static std::atomic<uint32_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
 static size_t bytes_needed(int vertex_count, Flags flags, int index_count) {
   int needed = sizeof(DlVertices);
   // We always have vertices
@@ -103,7 +110,8 @@ DlVertices::DlVertices(DlVertexMode mode,
                        const SkRect* bounds)
     : mode_(mode),
       vertex_count_(std::max(unchecked_vertex_count, 0)),
-      index_count_(indices ? std::max(unchecked_index_count, 0) : 0) {
+      index_count_(indices ? std::max(unchecked_index_count, 0) : 0),
+      unique_id_(NextUniqueId()) {
   bounds_ = bounds ? *bounds : compute_bounds(vertices, vertex_count_);
 
   char* pod = reinterpret_cast<char*>(this);
@@ -138,7 +146,9 @@ DlVertices::DlVertices(const DlVertices* other)
                  other->colors(),
                  other->index_count_,
                  other->indices(),
-                 &other->bounds_) {}
+                 &other->bounds_) {
+  unique_id_ = other->unique_id_;
+}
 
 DlVertices::DlVertices(DlVertexMode mode,
                        int unchecked_vertex_count,
@@ -146,7 +156,8 @@ DlVertices::DlVertices(DlVertexMode mode,
                        int unchecked_index_count)
     : mode_(mode),
       vertex_count_(std::max(unchecked_vertex_count, 0)),
-      index_count_(std::max(unchecked_index_count, 0)) {
+      index_count_(std::max(unchecked_index_count, 0)),
+      unique_id_(NextUniqueId()) {
   char* pod = reinterpret_cast<char*>(this);
   size_t offset = sizeof(DlVertices);
 
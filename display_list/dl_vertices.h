@@ -228,6 +228,13 @@ class DlVertices {
     return static_cast<const uint16_t*>(pod(indices_offset_));
   }
 
+  /// Returns an identifier that is unique to the vertices this object was
+  /// built with. Copies of the object made by a display list share the
+  /// identifier of the vertices they were copied from, so renderers can use
+  /// it as the key of a cache of uploaded vertex data. It isn't considered
+  /// by the equality operators.
+  uint32_t unique_id() const { return unique_id_; }
+
   bool operator==(DlVertices const& other) const;
 
   bool operator!=(DlVertices const& other) const { return !(*this == other); }
@@ -267,6 +274,7 @@ class DlVertices {
   size_t colors_offset_;
 
   int index_count_;
+  uint32_t unique_id_;
   size_t indices_offset_;
 
   SkRect bounds_;
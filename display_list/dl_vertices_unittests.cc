@@ -6,6 +6,7 @@
 #include "flutter/display_list/dl_vertices.h"
 #include "flutter/display_list/testing/dl_test_equality.h"
 #include "flutter/display_list/utils/dl_comparable.h"
+#include "flutter/display_list/utils/dl_receiver_utils.h"
 #include "gtest/gtest.h"
 
 namespace flutter {
@@ -882,6 +883,43 @@ TEST(DisplayListVertices, TestEquals) {
   TestEquals(*vertices1, *vertices2);
 }
 
+class VerticesIdRecorder : public virtual DlOpReceiver,
+                           public IgnoreAttributeDispatchHelper,
+                           public IgnoreClipDispatchHelper,
+                           public IgnoreTransformDispatchHelper,
+                           public IgnoreDrawDispatchHelper {
+ public:
+  void drawVertices(const DlVertices* vertices, DlBlendMode mode) override {
+    ids.push_back(vertices->unique_id());
+  }
+
+  std::vector<uint32_t> ids;
+};
+
+TEST(DisplayListVertices, UniqueIdIsSharedByDisplayListCopies) {
+  SkPoint coords[3] = {
+      SkPoint::Make(2, 3),
+      SkPoint::Make(5, 6),
+      SkPoint::Make(15, 20),
+  };
+
+  std::shared_ptr<const DlVertices> vertices1 = DlVertices::Make(
+      DlVertexMode::kTriangles, 3, coords, nullptr, nullptr);
+  std::shared_ptr<const DlVertices> vertices2 = DlVertices::Make(
+      DlVertexMode::kTriangles, 3, coords, nullptr, nullptr);
+  EXPECT_NE(vertices1->unique_id(), vertices2->unique_id());
+  TestEquals(*vertices1, *vertices2);
+
+  DisplayListBuilder builder;
+  builder.DrawVertices(vertices1, DlBlendMode::kSrcOver, DlPaint());
+  builder.DrawVertices(vertices2, DlBlendMode::kSrcOver, DlPaint());
+  VerticesIdRecorder recorder;
+  builder.Build()->Dispatch(recorder);
+  ASSERT_EQ(recorder.ids.size(), 2u);
+  EXPECT_EQ(recorder.ids[0], vertices1->unique_id());
+  EXPECT_EQ(recorder.ids[1], vertices2->unique_id());
+}
+
 TEST(DisplayListVertices, TestNotEquals) {
   SkPoint coords[4] = {
       SkPoint::Make(2, 3),
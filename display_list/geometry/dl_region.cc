@@ -74,6 +74,18 @@ DlRegion::SpanChunkHandle DlRegion::SpanBuffer::storeChunk(const Span* begin,
   return res;
 }
 
+DlRegion::SpanChunkHandle DlRegion::SpanBuffer::appendBuffer(
+    const SpanBuffer& buffer) {
+  SpanChunkHandle offset = size_;
+  if (buffer.size_ == 0) {
+    return offset;
+  }
+  reserve(size_ + buffer.size_);
+  memcpy(spans_ + size_, buffer.spans_, buffer.size_ * sizeof(Span));
+  size_ += buffer.size_;
+  return offset;
+}
+
 size_t DlRegion::SpanBuffer::getChunkSize(SpanChunkHandle handle) const {
   FML_DCHECK(handle < size_);
   return spans_[handle].left;
@@ -227,9 +239,9 @@ size_t DlRegion::intersectLineSpans(std::vector<Span>& res,
 
   while (begin1 != end1 && begin2 != end2) {
     if (begin1->right <= begin2->left) {
-      ++begin1;
+      begin1 = skipSpansBefore(begin1 + 1, end1, begin2->left);
     } else if (begin2->right <= begin1->left) {
-      ++begin2;
+      begin2 = skipSpansBefore(begin2 + 1, end2, begin1->left);
     } else {
       int32_t left = std::max(begin1->left, begin2->left);
       int32_t right = std::min(begin1->right, begin2->right);
@@ -387,6 +399,33 @@ void DlRegion::setRects(const std::vector<SkIRect>& unsorted_rects) {
 #endif
 }
 
+void DlRegion::appendLines(const DlRegion& region) {
+  auto it = region.lines_.begin();
+  auto end = region.lines_.end();
+  if (it == end) {
+    return;
+  }
+  FML_DCHECK(lines_.empty() || lines_.back().bottom <= it->top);
+
+  if (!lines_.empty() && lines_.back().bottom == it->top) {
+    const Span *begin, *end;
+    region.span_buffer_.getSpans(it->chunk_handle, begin, end);
+    if (spansEqual(lines_.back(), begin, end)) {
+      lines_.back().bottom = it->bottom;
+      ++it;
+    }
+  }
+
+  // The spans of the merged line, if any, are copied along with the others
+  // but are never referenced.
+  SpanChunkHandle offset = span_buffer_.appendBuffer(region.span_buffer_);
+  lines_.reserve(lines_.size() + (end - it));
+  for (; it != end; ++it) {
+    lines_.push_back({it->top, it->bottom, it->chunk_handle + offset});
+  }
+  bounds_.join(region.bounds_);
+}
+
 void DlRegion::appendLine(int32_t top,
                           int32_t bottom,
                           const Span* begin,
@@ -411,6 +450,16 @@ DlRegion DlRegion::MakeUnion(const DlRegion& a, const DlRegion& b) {
     return a;
   } else if (b.isSimple() && b.bounds_.contains(a.bounds_)) {
     return b;
+  } else if (a.bounds_.bottom() <= b.bounds_.top()) {
+    // The lines of the regions do not overlap, so they can be copied as they
+    // are without merging any spans.
+    DlRegion res(a);
+    res.appendLines(b);
+    return res;
+  } else if (b.bounds_.bottom() <= a.bounds_.top()) {
+    DlRegion res(b);
+    res.appendLines(a);
+    return res;
   }
 
   DlRegion res;
@@ -507,6 +556,10 @@ DlRegion DlRegion::MakeIntersection(const DlRegion& a, const DlRegion& b) {
     return b;
   } else if (b.isSimple() && b.bounds_.contains(a.bounds_)) {
     return a;
+  } else if (a.isSimple()) {
+    return intersectWithRect(b, a.bounds_);
+  } else if (b.isSimple()) {
+    return intersectWithRect(a, b.bounds_);
   }
 
   DlRegion res;
@@ -560,6 +613,43 @@ DlRegion DlRegion::MakeIntersection(const DlRegion& a, const DlRegion& b) {
   return res;
 }
 
+DlRegion DlRegion::intersectWithRect(const DlRegion& region,
+                                     const SkIRect& rect) {
+  DlRegion res;
+  auto it = region.lines_.begin();
+  auto end = region.lines_.end();
+  if (region.lines_.size() > kBinarySearchThreshold &&
+      it[kBinarySearchThreshold].bottom <= rect.fTop) {
+    it = std::lower_bound(
+        region.lines_.begin() + kBinarySearchThreshold + 1, end, rect.fTop,
+        [](const SpanLine& line, int32_t top) { return line.bottom <= top; });
+  } else {
+    while (it != end && it->bottom <= rect.fTop) {
+      ++it;
+    }
+  }
+
+  SpanVec tmp;
+  for (; it != end && it->top < rect.fBottom; ++it) {
+    const Span *begin, *span_end;
+    region.span_buffer_.getSpans(it->chunk_handle, begin, span_end);
+    tmp.clear();
+    for (begin = skipSpansBefore(begin, span_end, rect.fLeft);
+         begin != span_end && begin->left < rect.fRight; ++begin) {
+      tmp.emplace_back(std::max(begin->left, rect.fLeft),
+                       std::min(begin->right, rect.fRight));
+    }
+    if (!tmp.empty()) {
+      int32_t top = std::max(it->top, rect.fTop);
+      int32_t bottom = std::min(it->bottom, rect.fBottom);
+      res.appendLine(top, bottom, tmp.data(), tmp.data() + tmp.size());
+      res.bounds_.join(
+          SkIRect::MakeLTRB(tmp.front().left, top, tmp.back().right, bottom));
+    }
+  }
+  return res;
+}
+
 std::vector<SkIRect> DlRegion::getRects(bool deband) const {
   std::vector<SkIRect> rects;
   if (isEmpty()) {
@@ -658,15 +748,32 @@ bool DlRegion::intersects(const SkIRect& rect) const {
   return false;
 }
 
+const DlRegion::Span* DlRegion::skipSpansBefore(const Span* begin,
+                                                const Span* end,
+                                                int32_t left) {
+  // Lines of regions built from many rects can hold many spans, so spans
+  // that are not among the next few are found with a binary search.
+  if (end - begin > kBinarySearchThreshold &&
+      begin[kBinarySearchThreshold].right <= left) {
+    return std::lower_bound(
+        begin + kBinarySearchThreshold + 1, end, left,
+        [](const Span& span, int32_t x) { return span.right <= x; });
+  }
+  while (begin != end && begin->right <= left) {
+    ++begin;
+  }
+  return begin;
+}
+
 bool DlRegion::spansIntersect(const Span* begin1,
                               const Span* end1,
                               const Span* begin2,
                               const Span* end2) {
   while (begin1 != end1 && begin2 != end2) {
     if (begin1->right <= begin2->left) {
-      ++begin1;
+      begin1 = skipSpansBefore(begin1 + 1, end1, begin2->left);
     } else if (begin2->right <= begin1->left) {
-      ++begin2;
+      begin2 = skipSpansBefore(begin2 + 1, end2, begin1->left);
     } else {
       return true;
     }
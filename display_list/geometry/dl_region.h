@@ -94,6 +94,9 @@ class DlRegion {
     size_t capacity() const { return capacity_; }
 
     SpanChunkHandle storeChunk(const Span* begin, const Span* end);
+    /// Copies all chunks of |buffer| to the end of this buffer with a single
+    /// copy and returns the offset to add to their handles.
+    SpanChunkHandle appendBuffer(const SpanBuffer& buffer);
     size_t getChunkSize(SpanChunkHandle handle) const;
     void getSpans(SpanChunkHandle handle,
                   const DlRegion::Span*& begin,
@@ -133,6 +136,10 @@ class DlRegion {
     appendLine(top, bottom, begin, end);
   }
 
+  /// Appends the lines of |region|, none of which may be above the lines of
+  /// this region.
+  void appendLines(const DlRegion& region);
+
   typedef std::vector<Span> SpanVec;
   SpanLine makeLine(int32_t top, int32_t bottom, const SpanVec&);
   SpanLine makeLine(int32_t top,
@@ -150,6 +157,14 @@ class DlRegion {
                                    const SpanBuffer& b_buffer,
                                    SpanChunkHandle b_handle);
 
+  static DlRegion intersectWithRect(const DlRegion& region,
+                                    const SkIRect& rect);
+
+  /// Returns the first span in [begin, end) whose right edge is past |left|.
+  static const Span* skipSpansBefore(const Span* begin,
+                                     const Span* end,
+                                     int32_t left);
+
   bool spansEqual(SpanLine& line, const Span* begin, const Span* end) const;
 
   static bool spansIntersect(const Span* begin1,
@@ -429,5 +429,50 @@ TEST(DisplayListRegion, TestAgainstSkRegion) {
   }
 }
 
+TEST(DisplayListRegion, TestDisjointRegionsAgainstSkRegion) {
+  std::seed_seq seed{::testing::UnitTest::GetInstance()->random_seed()};
+  std::mt19937 rng(seed);
+
+  std::uniform_int_distribution pos_x(0, 3900);
+  std::uniform_int_distribution pos_y(0, 1900);
+  std::uniform_int_distribution size(1, 100);
+
+  std::vector<SkIRect> rects_top;
+  std::vector<SkIRect> rects_bottom;
+  for (size_t i = 0; i < 1000; ++i) {
+    rects_top.push_back(
+        SkIRect::MakeXYWH(pos_x(rng), pos_y(rng), size(rng), size(rng)));
+    rects_bottom.push_back(SkIRect::MakeXYWH(pos_x(rng), 2000 + pos_y(rng),
+                                             size(rng), size(rng)));
+  }
+  // Rects that touch the boundary between the regions.
+  rects_top.push_back(SkIRect::MakeLTRB(0, 1990, 100, 2000));
+  rects_bottom.push_back(SkIRect::MakeLTRB(0, 2000, 100, 2010));
+
+  DlRegion region_top(rects_top);
+  SkRegion sk_region_top;
+  sk_region_top.setRects(rects_top.data(), rects_top.size());
+  DlRegion region_bottom(rects_bottom);
+  SkRegion sk_region_bottom;
+  sk_region_bottom.setRects(rects_bottom.data(), rects_bottom.size());
+
+  SkRegion sk_union(sk_region_top);
+  sk_union.op(sk_region_bottom, SkRegion::kUnion_Op);
+  CheckEquality(DlRegion::MakeUnion(region_top, region_bottom), sk_union);
+  CheckEquality(DlRegion::MakeUnion(region_bottom, region_top), sk_union);
+
+  for (const SkIRect& rect : {SkIRect::MakeLTRB(500, 500, 3000, 3000),
+                              SkIRect::MakeLTRB(0, 1995, 50, 2005)}) {
+    DlRegion dl_rect(rect);
+    SkRegion sk_intersection(sk_union);
+    sk_intersection.op(rect, SkRegion::kIntersect_Op);
+    DlRegion dl_union = DlRegion::MakeUnion(region_top, region_bottom);
+    CheckEquality(DlRegion::MakeIntersection(dl_union, dl_rect),
+                  sk_intersection);
+    CheckEquality(DlRegion::MakeIntersection(dl_rect, dl_union),
+                  sk_intersection);
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
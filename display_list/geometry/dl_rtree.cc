@@ -5,6 +5,10 @@
 #include "flutter/display_list/geometry/dl_rtree.h"
 #include "flutter/display_list/geometry/dl_region.h"
 
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
 #include "flutter/fml/logging.h"
 
 namespace flutter {
@@ -183,6 +187,75 @@ std::list<SkRect> DlRTree::searchAndConsolidateRects(const SkRect& query,
   return final_results;
 }
 
+std::vector<std::vector<int>> DlRTree::searchAndPartitionRects(
+    const SkRect& query) const {
+  std::list<SkRect> consolidated = searchAndConsolidateRects(query);
+  if (consolidated.empty()) {
+    return {};
+  }
+
+  // The consolidated rects do not overlap each other, but a single rect in
+  // the tree can span several of them. Union the consolidated rects that
+  // share a rect, or rects with the same ID, into one partition.
+  std::vector<int> parents(consolidated.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  auto find = [&parents](int partition) {
+    while (parents[partition] != partition) {
+      parents[partition] = parents[parents[partition]];
+      partition = parents[partition];
+    }
+    return partition;
+  };
+  auto join = [&parents, &find](int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a != b) {
+      parents[std::max(a, b)] = std::min(a, b);
+    }
+  };
+
+  std::vector<int> index_partitions(leaf_count_, -1);
+  std::unordered_map<int, int> id_partitions;
+  std::vector<int> results;
+  int partition = 0;
+  for (const SkRect& rect : consolidated) {
+    results.clear();
+    search(rect, &results);
+    for (int index : results) {
+      if (index_partitions[index] < 0) {
+        index_partitions[index] = partition;
+      } else {
+        join(index_partitions[index], partition);
+      }
+      int id = nodes_[index].id;
+      if (id != invalid_id_) {
+        auto [it, inserted] = id_partitions.try_emplace(id, partition);
+        if (!inserted) {
+          join(it->second, partition);
+        }
+      }
+    }
+    partition++;
+  }
+
+  // Indices are visited in numerical order, so each group is sorted and the
+  // groups are ordered by their first index.
+  std::vector<std::vector<int>> groups;
+  std::vector<int> group_of_partition(consolidated.size(), -1);
+  for (int index = 0; index < leaf_count_; index++) {
+    if (index_partitions[index] < 0) {
+      continue;
+    }
+    int root = find(index_partitions[index]);
+    if (group_of_partition[root] < 0) {
+      group_of_partition[root] = groups.size();
+      groups.emplace_back();
+    }
+    groups[group_of_partition[root]].push_back(index);
+  }
+  return groups;
+}
+
 void DlRTree::search(const Node& parent,
                      const SkRect& query,
                      std::vector<int>* results) const {
@@ -26,6 +26,8 @@ namespace flutter {
 /// - Query for a set of non-overlapping rectangles that are joined
 ///   from the original rectangles that intersect a query rect
 ///   @see |searchAndConsolidateRects|
+/// - Query for groups of hits that cover mutually exclusive areas
+///   @see |searchAndPartitionRects|
 class DlRTree : public SkRefCnt {
  private:
   static constexpr int kMaxChildren = 11;
@@ -126,6 +128,20 @@ class DlRTree : public SkRefCnt {
   std::list<SkRect> searchAndConsolidateRects(const SkRect& query,
                                               bool deband = true) const;
 
+  /// Finds the rects in the tree that intersect with the query rect and
+  /// partitions them into groups whose rects do not share any pixels with
+  /// the rects of the other groups.
+  ///
+  /// Each group is a list of the leaf node indices that |search| would
+  /// return for its rects, in numerical order, and the groups are ordered by
+  /// their first index. Rects that have the same ID are always in the same
+  /// group. The groups are found by joining the rects that intersect each
+  /// of the rects returned by |searchAndConsolidateRects|, so the result is
+  /// a single group whenever the rects that intersect the query overlap
+  /// each other in a connected area.
+  std::vector<std::vector<int>> searchAndPartitionRects(
+      const SkRect& query) const;
+
   /// Returns DlRegion that represents the union of all rectangles in the
   /// R-Tree.
   const DlRegion& region() const;
@@ -319,5 +319,35 @@ TEST(DisplayListRTree, Region) {
   EXPECT_EQ(rects.size(), expected_rects.size());
 }
 
+TEST(DisplayListRTree, Partition) {
+  SkRect rects[] = {
+      SkRect::MakeLTRB(0, 0, 10, 10),      //
+      SkRect::MakeLTRB(5, 5, 15, 15),      // overlaps 0
+      SkRect::MakeLTRB(30, 0, 40, 10),     //
+      SkRect::MakeLTRB(60, 0, 70, 10),     // same id as 0
+      SkRect::MakeLTRB(100, 100, 110, 110),
+      SkRect::MakeLTRB(200, 0, 250, 10),   //
+      SkRect::MakeLTRB(200, 0, 210, 50),   // overlaps 5 in an L shape
+  };
+  int ids[] = {0, 1, 2, 0, 3, 4, 5};
+  DlRTree tree(rects, 7, ids);
+
+  auto groups = tree.searchAndPartitionRects(SkRect::MakeLTRB(0, 0, 300, 300));
+  std::vector<std::vector<int>> expected_groups = {
+      {0, 1, 3},
+      {2},
+      {4},
+      {5, 6},
+  };
+  EXPECT_EQ(groups, expected_groups);
+
+  groups = tree.searchAndPartitionRects(SkRect::MakeLTRB(25, 0, 45, 10));
+  expected_groups = {{2}};
+  EXPECT_EQ(groups, expected_groups);
+
+  groups = tree.searchAndPartitionRects(SkRect::MakeLTRB(500, 500, 600, 600));
+  EXPECT_TRUE(groups.empty());
+}
+
 }  // namespace testing
 }  // namespace flutter
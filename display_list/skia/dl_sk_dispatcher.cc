@@ -258,7 +258,7 @@ void DlSkCanvasDispatcher::drawDisplayList(
   // Create a new CanvasDispatcher to isolate the actions of the
   // display_list from the current environment.
   DlSkCanvasDispatcher dispatcher(canvas_, combined_opacity);
-  if (display_list->rtree()) {
+  if (display_list->has_rtree()) {
     display_list->Dispatch(dispatcher, canvas_->getLocalClipBounds());
   } else {
     display_list->Dispatch(dispatcher);
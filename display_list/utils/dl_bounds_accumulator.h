@@ -157,6 +157,11 @@ class RTreeBoundsAccumulator final : public virtual BoundsAccumulator {
     return BoundsAccumulatorType::kRTree;
   }
 
+  /// The bounds of the ops accumulated so far and the index of the op
+  /// that each of them belongs to, from which |rtree| is built.
+  const std::vector<SkRect>& rects() const { return rects_; }
+  const std::vector<int>& rect_indices() const { return rect_indices_; }
+
  private:
   std::vector<SkRect> rects_;
   std::vector<int> rect_indices_;
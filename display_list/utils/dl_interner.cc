@@ -0,0 +1,45 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/utils/dl_interner.h"
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+sk_sp<DisplayList> DisplayListInterner::Intern(
+    sk_sp<DisplayList> display_list) {
+  if (!display_list ||
+      display_list->bytes(false) - sizeof(DisplayList) > kMaxInternedBytes) {
+    return display_list;
+  }
+  TRACE_EVENT0("flutter", "DisplayListInterner::Intern");
+  size_t hash = display_list->ContentHash();
+  auto [begin, end] = entries_.equal_range(hash);
+  for (auto it = begin; it != end; ++it) {
+    Entry& entry = it->second;
+    if (entry.display_list->bounds() == display_list->bounds() &&
+        entry.display_list->Equals(display_list)) {
+      entry.last_used_frame = frame_;
+      return entry.display_list;
+    }
+  }
+  if (entries_.size() < kMaxEntries) {
+    entries_.emplace(hash, Entry{display_list, frame_});
+  }
+  return display_list;
+}
+
+void DisplayListInterner::OnFrame() {
+  frame_++;
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (frame_ - it->second.last_used_frame >= kFramesToKeep) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace flutter
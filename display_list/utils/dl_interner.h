@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_UTILS_DL_INTERNER_H_
+#define FLUTTER_DISPLAY_LIST_UTILS_DL_INTERNER_H_
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+/// Collapses DisplayLists with equal contents into a single shared instance.
+///
+/// Lists of items often record the same picture for each item, for example
+/// an icon or a divider, and every recording carries its own storage and
+/// unique id. Interning each newly built DisplayList returns a previously
+/// interned DisplayList that |Equals| it instead, so that the copies can be
+/// released and the raster cache, which is keyed by unique id, sees the
+/// same DisplayList for each of them.
+///
+/// Interned DisplayLists are kept alive by the interner until they have not
+/// been returned by |Intern| for |kFramesToKeep| frames. This class is not
+/// thread safe; it is meant to be used on the thread that records
+/// DisplayLists, which must call |OnFrame| once per frame.
+class DisplayListInterner {
+ public:
+  /// DisplayLists with more op bytes than this are not interned, as they
+  /// are less likely to be duplicated and more expensive to compare.
+  static constexpr size_t kMaxInternedBytes = 16 * 1024;
+
+  /// The most DisplayLists that are interned at once.
+  static constexpr size_t kMaxEntries = 512;
+
+  static constexpr uint64_t kFramesToKeep = 2;
+
+  DisplayListInterner() = default;
+
+  /// Returns an interned DisplayList that is equal to and has the same
+  /// bounds as |display_list|, interning |display_list| itself if there is
+  /// none.
+  sk_sp<DisplayList> Intern(sk_sp<DisplayList> display_list);
+
+  /// Releases the DisplayLists that have not been returned by |Intern|
+  /// during the last |kFramesToKeep| frames.
+  void OnFrame();
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    sk_sp<DisplayList> display_list;
+    uint64_t last_used_frame;
+  };
+
+  std::unordered_multimap<size_t, Entry> entries_;
+  uint64_t frame_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListInterner);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_UTILS_DL_INTERNER_H_
@@ -0,0 +1,75 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/utils/dl_interner.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<DisplayList> MakeDisplayList(DlColor color) {
+  DisplayListBuilder builder;
+  builder.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint(color));
+  builder.DrawCircle(SkPoint::Make(5.0f, 5.0f), 2.0f, DlPaint(color));
+  return builder.Build();
+}
+
+TEST(DisplayListInterner, EqualDisplayListsAreShared) {
+  DisplayListInterner interner;
+  auto first = MakeDisplayList(DlColor::kBlue());
+  auto second = MakeDisplayList(DlColor::kBlue());
+  ASSERT_NE(first, second);
+  EXPECT_EQ(first->ContentHash(), second->ContentHash());
+
+  EXPECT_EQ(interner.Intern(first), first);
+  EXPECT_EQ(interner.Intern(second), first);
+  EXPECT_EQ(interner.size(), 1u);
+}
+
+TEST(DisplayListInterner, DifferentDisplayListsAreNotShared) {
+  DisplayListInterner interner;
+  auto blue = MakeDisplayList(DlColor::kBlue());
+  auto red = MakeDisplayList(DlColor::kRed());
+  EXPECT_NE(blue->ContentHash(), red->ContentHash());
+
+  EXPECT_EQ(interner.Intern(blue), blue);
+  EXPECT_EQ(interner.Intern(red), red);
+  EXPECT_EQ(interner.size(), 2u);
+}
+
+TEST(DisplayListInterner, UnusedDisplayListsAreReleased) {
+  DisplayListInterner interner;
+  auto kept = MakeDisplayList(DlColor::kBlue());
+  auto released = MakeDisplayList(DlColor::kRed());
+  interner.Intern(kept);
+  interner.Intern(released);
+
+  for (uint64_t i = 0; i < DisplayListInterner::kFramesToKeep; i++) {
+    interner.OnFrame();
+    EXPECT_EQ(interner.Intern(MakeDisplayList(DlColor::kBlue())), kept);
+  }
+  EXPECT_EQ(interner.size(), 1u);
+  EXPECT_TRUE(released->unique());
+
+  auto red = MakeDisplayList(DlColor::kRed());
+  EXPECT_EQ(interner.Intern(red), red);
+}
+
+TEST(DisplayListInterner, LargeDisplayListsAreNotInterned) {
+  DisplayListInterner interner;
+  DisplayListBuilder builder;
+  for (int i = 0; i < 2000; i++) {
+    builder.DrawRect(SkRect::MakeXYWH(i, i, 10.0f, 10.0f), DlPaint());
+  }
+  auto large = builder.Build();
+  ASSERT_GT(large->bytes(false) - sizeof(DisplayList),
+            DisplayListInterner::kMaxInternedBytes);
+  EXPECT_EQ(interner.Intern(large), large);
+  EXPECT_EQ(interner.size(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
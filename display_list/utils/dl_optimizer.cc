@@ -0,0 +1,442 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/utils/dl_optimizer.h"
+
+#include <algorithm>
+#include <optional>
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/dl_op_receiver.h"
+#include "flutter/display_list/dl_paint.h"
+#include "flutter/display_list/utils/dl_matrix_clip_tracker.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+// Returns the union of |a| and |b| if they share a full edge and so their
+// union is itself a rect that they cover without overlapping.
+std::optional<SkRect> UnionOfAdjacentRects(const SkRect& a, const SkRect& b) {
+  if (a.isEmpty() || b.isEmpty()) {
+    return std::nullopt;
+  }
+  if (a.fTop == b.fTop && a.fBottom == b.fBottom &&
+      (a.fRight == b.fLeft || b.fRight == a.fLeft)) {
+    return SkRect::MakeLTRB(std::min(a.fLeft, b.fLeft), a.fTop,
+                            std::max(a.fRight, b.fRight), a.fBottom);
+  }
+  if (a.fLeft == b.fLeft && a.fRight == b.fRight &&
+      (a.fBottom == b.fTop || b.fBottom == a.fTop)) {
+    return SkRect::MakeLTRB(a.fLeft, std::min(a.fTop, b.fTop), a.fRight,
+                            std::max(a.fBottom, b.fBottom));
+  }
+  return std::nullopt;
+}
+
+// Replays the ops of a DisplayList into a DisplayListBuilder, deferring
+// transforms until something is drawn with them and rect fills until the
+// next op shows that they cannot be merged with another rect. The builder
+// itself defers saves until a transform or clip is recorded within them, so
+// saves that only contain dropped transforms and clips are dropped as well.
+class OptimizingReceiver final : public DlOpReceiver {
+ public:
+  explicit OptimizingReceiver(DisplayListBuilder& builder)
+      : builder_(builder),
+        tracker_(DisplayListBuilder::kMaxCullRect, SkMatrix::I()) {}
+
+  void Finish() { FlushPendingRect(); }
+
+  void setAntiAlias(bool aa) override {
+    FlushPendingRect();
+    paint_.setAntiAlias(aa);
+  }
+  void setDrawStyle(DlDrawStyle style) override {
+    FlushPendingRect();
+    paint_.setDrawStyle(style);
+  }
+  void setColor(DlColor color) override {
+    FlushPendingRect();
+    paint_.setColor(color);
+  }
+  void setStrokeWidth(float width) override {
+    FlushPendingRect();
+    paint_.setStrokeWidth(width);
+  }
+  void setStrokeMiter(float limit) override {
+    FlushPendingRect();
+    paint_.setStrokeMiter(limit);
+  }
+  void setStrokeCap(DlStrokeCap cap) override {
+    FlushPendingRect();
+    paint_.setStrokeCap(cap);
+  }
+  void setStrokeJoin(DlStrokeJoin join) override {
+    FlushPendingRect();
+    paint_.setStrokeJoin(join);
+  }
+  void setColorSource(const DlColorSource* source) override {
+    FlushPendingRect();
+    paint_.setColorSource(source);
+  }
+  void setColorFilter(const DlColorFilter* filter) override {
+    FlushPendingRect();
+    paint_.setColorFilter(filter);
+  }
+  void setInvertColors(bool invert) override {
+    FlushPendingRect();
+    paint_.setInvertColors(invert);
+  }
+  void setBlendMode(DlBlendMode mode) override {
+    FlushPendingRect();
+    paint_.setBlendMode(mode);
+  }
+  void setPathEffect(const DlPathEffect* effect) override {
+    FlushPendingRect();
+    paint_.setPathEffect(effect);
+  }
+  void setMaskFilter(const DlMaskFilter* filter) override {
+    FlushPendingRect();
+    paint_.setMaskFilter(filter);
+  }
+  void setImageFilter(const DlImageFilter* filter) override {
+    FlushPendingRect();
+    paint_.setImageFilter(filter);
+  }
+
+  void save() override {
+    PrepareForDraw();
+    builder_.Save();
+    tracker_.save();
+    save_count_++;
+  }
+  void saveLayer(const SkRect* bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override {
+    PrepareForDraw();
+    bool with_attributes = options.renders_with_attributes();
+    builder_.SaveLayer(bounds, with_attributes ? &paint_ : nullptr, backdrop);
+    tracker_.save();
+    if (backdrop || (with_attributes && paint_.getImageFilterPtr())) {
+      // Filtered content can spread into the enclosing clips from outside
+      // of them, so they no longer make the clips in the layer redundant.
+      tracker_.resetCullRect();
+    }
+    save_count_++;
+  }
+  void restore() override {
+    FlushPendingRect();
+    if (save_count_ == 0) {
+      return;
+    }
+    // Nothing was drawn with the pending transform before it was restored.
+    pending_transform_.reset();
+    builder_.Restore();
+    tracker_.restore();
+    save_count_--;
+  }
+
+  void translate(SkScalar tx, SkScalar ty) override {
+    AddTransform(SkM44::Translate(tx, ty));
+  }
+  void scale(SkScalar sx, SkScalar sy) override {
+    AddTransform(SkM44::Scale(sx, sy));
+  }
+  void rotate(SkScalar degrees) override {
+    AddTransform(SkM44(SkMatrix::RotateDeg(degrees)));
+  }
+  void skew(SkScalar sx, SkScalar sy) override {
+    AddTransform(SkM44(SkMatrix::Skew(sx, sy)));
+  }
+  // clang-format off
+  void transform2DAffine(SkScalar mxx, SkScalar mxy, SkScalar mxt,
+                         SkScalar myx, SkScalar myy, SkScalar myt) override {
+    AddTransform(SkM44(mxx, mxy, 0, mxt,
+                       myx, myy, 0, myt,
+                        0,   0,  1,  0,
+                        0,   0,  0,  1));
+  }
+  void transformFullPerspective(
+      SkScalar mxx, SkScalar mxy, SkScalar mxz, SkScalar mxt,
+      SkScalar myx, SkScalar myy, SkScalar myz, SkScalar myt,
+      SkScalar mzx, SkScalar mzy, SkScalar mzz, SkScalar mzt,
+      SkScalar mwx, SkScalar mwy, SkScalar mwz, SkScalar mwt) override {
+    AddTransform(SkM44(mxx, mxy, mxz, mxt,
+                       myx, myy, myz, myt,
+                       mzx, mzy, mzz, mzt,
+                       mwx, mwy, mwz, mwt));
+  }
+  // clang-format on
+  void transformReset() override {
+    FlushPendingRect();
+    tracker_.setIdentity();
+    pending_transform_ = PendingTransform{.reset = true};
+  }
+
+  void clipRect(const SkRect& rect, ClipOp clip_op, bool is_aa) override {
+    FlushPendingRect();
+    bool redundant = clip_op == ClipOp::kIntersect && ClipIsRedundant() &&
+                     rect.contains(tracker_.local_cull_rect());
+    tracker_.clipRect(rect, clip_op, is_aa);
+    if (!redundant) {
+      FlushTransform();
+      builder_.ClipRect(rect, clip_op, is_aa);
+    }
+  }
+  void clipRRect(const SkRRect& rrect, ClipOp clip_op, bool is_aa) override {
+    FlushPendingRect();
+    bool redundant = clip_op == ClipOp::kIntersect && ClipIsRedundant() &&
+                     rrect.contains(tracker_.local_cull_rect());
+    tracker_.clipRRect(rrect, clip_op, is_aa);
+    if (!redundant) {
+      FlushTransform();
+      builder_.ClipRRect(rrect, clip_op, is_aa);
+    }
+  }
+  void clipPath(const SkPath& path, ClipOp clip_op, bool is_aa) override {
+    FlushPendingRect();
+    tracker_.clipPath(path, clip_op, is_aa);
+    FlushTransform();
+    builder_.ClipPath(path, clip_op, is_aa);
+  }
+
+  void drawColor(DlColor color, DlBlendMode mode) override {
+    PrepareForDraw();
+    builder_.DrawColor(color, mode);
+  }
+  void drawPaint() override {
+    PrepareForDraw();
+    builder_.DrawPaint(paint_);
+  }
+  void drawLine(const SkPoint& p0, const SkPoint& p1) override {
+    PrepareForDraw();
+    builder_.DrawLine(p0, p1, paint_);
+  }
+  void drawRect(const SkRect& rect) override {
+    FlushTransform();
+    if (!CanMergeRects()) {
+      FlushPendingRect();
+      builder_.DrawRect(rect, paint_);
+      return;
+    }
+    if (pending_rect_.has_value()) {
+      std::optional<SkRect> merged =
+          UnionOfAdjacentRects(pending_rect_.value(), rect);
+      if (merged.has_value()) {
+        pending_rect_ = merged;
+        return;
+      }
+      FlushPendingRect();
+    }
+    pending_rect_ = rect;
+  }
+  void drawOval(const SkRect& bounds) override {
+    PrepareForDraw();
+    builder_.DrawOval(bounds, paint_);
+  }
+  void drawCircle(const SkPoint& center, SkScalar radius) override {
+    PrepareForDraw();
+    builder_.DrawCircle(center, radius, paint_);
+  }
+  void drawRRect(const SkRRect& rrect) override {
+    PrepareForDraw();
+    builder_.DrawRRect(rrect, paint_);
+  }
+  void drawDRRect(const SkRRect& outer, const SkRRect& inner) override {
+    PrepareForDraw();
+    builder_.DrawDRRect(outer, inner, paint_);
+  }
+  void drawPath(const SkPath& path) override {
+    PrepareForDraw();
+    builder_.DrawPath(path, paint_);
+  }
+  void drawArc(const SkRect& oval_bounds,
+               SkScalar start_degrees,
+               SkScalar sweep_degrees,
+               bool use_center) override {
+    PrepareForDraw();
+    builder_.DrawArc(oval_bounds, start_degrees, sweep_degrees, use_center,
+                     paint_);
+  }
+  void drawPoints(PointMode mode,
+                  uint32_t count,
+                  const SkPoint points[]) override {
+    PrepareForDraw();
+    builder_.DrawPoints(mode, count, points, paint_);
+  }
+  void drawVertices(const DlVertices* vertices, DlBlendMode mode) override {
+    PrepareForDraw();
+    builder_.DrawVertices(vertices, mode, paint_);
+  }
+  void drawImage(const sk_sp<DlImage> image,
+                 const SkPoint point,
+                 DlImageSampling sampling,
+                 bool render_with_attributes) override {
+    PrepareForDraw();
+    builder_.DrawImage(image, point, sampling,
+                       render_with_attributes ? &paint_ : nullptr);
+  }
+  void drawImageRect(const sk_sp<DlImage> image,
+                     const SkRect& src,
+                     const SkRect& dst,
+                     DlImageSampling sampling,
+                     bool render_with_attributes,
+                     SrcRectConstraint constraint) override {
+    PrepareForDraw();
+    builder_.DrawImageRect(image, src, dst, sampling,
+                           render_with_attributes ? &paint_ : nullptr,
+                           constraint);
+  }
+  void drawImageNine(const sk_sp<DlImage> image,
+                     const SkIRect& center,
+                     const SkRect& dst,
+                     DlFilterMode filter,
+                     bool render_with_attributes) override {
+    PrepareForDraw();
+    builder_.DrawImageNine(image, center, dst, filter,
+                           render_with_attributes ? &paint_ : nullptr);
+  }
+  void drawAtlas(const sk_sp<DlImage> atlas,
+                 const SkRSXform xform[],
+                 const SkRect tex[],
+                 const DlColor colors[],
+                 int count,
+                 DlBlendMode mode,
+                 DlImageSampling sampling,
+                 const SkRect* cull_rect,
+                 bool render_with_attributes) override {
+    PrepareForDraw();
+    builder_.DrawAtlas(atlas, xform, tex, colors, count, mode, sampling,
+                       cull_rect, render_with_attributes ? &paint_ : nullptr);
+  }
+  void drawDisplayList(const sk_sp<DisplayList> display_list,
+                       SkScalar opacity) override {
+    PrepareForDraw();
+    builder_.DrawDisplayList(display_list, opacity);
+  }
+  void drawTextBlob(const sk_sp<SkTextBlob> blob,
+                    SkScalar x,
+                    SkScalar y) override {
+    PrepareForDraw();
+    builder_.DrawTextBlob(blob, x, y, paint_);
+  }
+  void drawTextFrame(const std::shared_ptr<impeller::TextFrame>& text_frame,
+                     SkScalar x,
+                     SkScalar y) override {
+    PrepareForDraw();
+    builder_.DrawTextFrame(text_frame, x, y, paint_);
+  }
+  void drawShadow(const SkPath& path,
+                  const DlColor color,
+                  const SkScalar elevation,
+                  bool transparent_occluder,
+                  SkScalar dpr) override {
+    PrepareForDraw();
+    builder_.DrawShadow(path, color, elevation, transparent_occluder, dpr);
+  }
+
+ private:
+  struct PendingTransform {
+    // Whether the transform is reset before |matrix| is applied.
+    bool reset = false;
+    SkM44 matrix;
+  };
+
+  // Rects can only be merged when filling them in one op covers the same
+  // pixels in the same way as filling them one after the other.
+  bool CanMergeRects() const {
+    return paint_.getDrawStyle() == DlDrawStyle::kFill &&
+           !paint_.getPathEffectPtr() && !paint_.getMaskFilterPtr() &&
+           !paint_.getImageFilterPtr();
+  }
+
+  // Whether the clips in effect are known well enough that an intersect
+  // clip which contains their bounds can be dropped.
+  bool ClipIsRedundant() const {
+    return !tracker_.using_4x4_matrix() && !tracker_.is_cull_rect_empty();
+  }
+
+  void AddTransform(const SkM44& matrix) {
+    FlushPendingRect();
+    tracker_.transform(matrix);
+    if (!pending_transform_.has_value()) {
+      pending_transform_.emplace();
+    }
+    pending_transform_->matrix.preConcat(matrix);
+  }
+
+  void PrepareForDraw() {
+    FlushPendingRect();
+    FlushTransform();
+  }
+
+  void FlushPendingRect() {
+    if (pending_rect_.has_value()) {
+      builder_.DrawRect(pending_rect_.value(), paint_);
+      pending_rect_.reset();
+    }
+  }
+
+  void FlushTransform() {
+    if (!pending_transform_.has_value()) {
+      return;
+    }
+    PendingTransform pending = pending_transform_.value();
+    pending_transform_.reset();
+    const SkM44& m = pending.matrix;
+    bool is_identity = m == SkM44();
+    if (!pending.reset && is_identity) {
+      return;
+    }
+    if (pending.reset) {
+      builder_.TransformReset();
+    }
+    if (is_identity) {
+      return;
+    }
+    bool is_affine = DisplayListMatrixClipTracker::is_3x3(m) &&
+                     m.rc(3, 0) == 0 && m.rc(3, 1) == 0 && m.rc(3, 3) == 1;
+    if (is_affine && m.rc(0, 0) == 1 && m.rc(0, 1) == 0 && m.rc(1, 0) == 0 &&
+        m.rc(1, 1) == 1) {
+      builder_.Translate(m.rc(0, 3), m.rc(1, 3));
+    } else if (is_affine) {
+      builder_.Transform2DAffine(m.rc(0, 0), m.rc(0, 1), m.rc(0, 3),  //
+                                 m.rc(1, 0), m.rc(1, 1), m.rc(1, 3));
+    } else {
+      builder_.TransformFullPerspective(
+          m.rc(0, 0), m.rc(0, 1), m.rc(0, 2), m.rc(0, 3),  //
+          m.rc(1, 0), m.rc(1, 1), m.rc(1, 2), m.rc(1, 3),  //
+          m.rc(2, 0), m.rc(2, 1), m.rc(2, 2), m.rc(2, 3),  //
+          m.rc(3, 0), m.rc(3, 1), m.rc(3, 2), m.rc(3, 3));
+    }
+  }
+
+  DisplayListBuilder& builder_;
+  DisplayListMatrixClipTracker tracker_;
+  DlPaint paint_;
+  int save_count_ = 0;
+  std::optional<PendingTransform> pending_transform_;
+  std::optional<SkRect> pending_rect_;
+};
+
+}  // namespace
+
+sk_sp<DisplayList> DisplayListOptimizer::Optimize(
+    const sk_sp<DisplayList>& display_list) {
+  if (!display_list || display_list->bounds().isEmpty()) {
+    return display_list;
+  }
+  TRACE_EVENT0("flutter", "DisplayListOptimizer::Optimize");
+  // Every op of the DisplayList is contained in its bounds, so culling to
+  // them drops nothing that the original would render.
+  DisplayListBuilder builder(display_list->bounds(),
+                             display_list->has_rtree());
+  OptimizingReceiver receiver(builder);
+  display_list->Dispatch(receiver);
+  receiver.Finish();
+  return builder.Build();
+}
+
+}  // namespace flutter
@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_UTILS_DL_OPTIMIZER_H_
+#define FLUTTER_DISPLAY_LIST_UTILS_DL_OPTIMIZER_H_
+
+#include "flutter/display_list/display_list.h"
+
+namespace flutter {
+
+/// Rewrites finished DisplayLists into equivalent DisplayLists that take
+/// fewer ops to dispatch.
+///
+/// The pass removes the patterns that pictures produced by the framework
+/// are full of:
+///  - saves with no transform or clip between them and their restore,
+///  - consecutive transforms, which are folded into a single transform,
+///  - transforms that are restored before anything is drawn with them,
+///  - intersect clips that contain the clips already in effect, and so
+///    contain everything that is drawn after them,
+///  - adjacent fills of rects with the same paint whose union is a rect,
+///    which are merged into a single rect.
+///
+/// The DisplayListBuilder that the result is recorded into applies its own
+/// optimizations on top of these.
+class DisplayListOptimizer {
+ public:
+  /// Returns an optimized copy of |display_list|, or |display_list| itself
+  /// if it has no bounds.
+  static sk_sp<DisplayList> Optimize(const sk_sp<DisplayList>& display_list);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_UTILS_DL_OPTIMIZER_H_
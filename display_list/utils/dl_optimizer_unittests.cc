@@ -0,0 +1,116 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/utils/dl_optimizer.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/testing/display_list_testing.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(DisplayListOptimizer, DropsSavesAndTransformsWithoutDraws) {
+  DisplayListBuilder builder;
+  builder.Save();
+  builder.Translate(10.0f, 10.0f);
+  builder.Restore();
+  builder.Save();
+  builder.Scale(2.0f, 2.0f);
+  builder.Rotate(45.0f);
+  builder.Restore();
+  builder.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint());
+  auto optimized = DisplayListOptimizer::Optimize(builder.Build());
+
+  DisplayListBuilder expected;
+  expected.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint());
+  EXPECT_TRUE(DisplayListsEQ_Verbose(optimized, expected.Build()));
+}
+
+TEST(DisplayListOptimizer, FoldsConsecutiveTransforms) {
+  DisplayListBuilder builder;
+  builder.Translate(10.0f, 0.0f);
+  builder.Translate(0.0f, 5.0f);
+  builder.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint());
+  builder.Scale(2.0f, 2.0f);
+  builder.Translate(1.0f, 1.0f);
+  builder.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint());
+  auto optimized = DisplayListOptimizer::Optimize(builder.Build());
+
+  DisplayListBuilder expected;
+  expected.Translate(10.0f, 5.0f);
+  expected.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint());
+  expected.Transform2DAffine(2.0f, 0.0f, 2.0f,  //
+                             0.0f, 2.0f, 2.0f);
+  expected.DrawRect(SkRect::MakeWH(10.0f, 10.0f), DlPaint());
+  EXPECT_TRUE(DisplayListsEQ_Verbose(optimized, expected.Build()));
+}
+
+TEST(DisplayListOptimizer, DropsClipsThatContainTheEnclosingClip) {
+  DisplayListBuilder builder;
+  builder.ClipRect(SkRect::MakeWH(100.0f, 100.0f));
+  builder.Save();
+  builder.ClipRect(SkRect::MakeLTRB(-10.0f, -10.0f, 200.0f, 200.0f));
+  builder.ClipRRect(SkRRect::MakeRectXY(
+      SkRect::MakeLTRB(-10.0f, -10.0f, 200.0f, 200.0f), 5.0f, 5.0f));
+  builder.DrawRect(SkRect::MakeLTRB(10.0f, 10.0f, 20.0f, 20.0f), DlPaint());
+  builder.Restore();
+  builder.ClipRect(SkRect::MakeWH(50.0f, 50.0f));
+  builder.DrawRect(SkRect::MakeLTRB(30.0f, 30.0f, 40.0f, 40.0f), DlPaint());
+  auto optimized = DisplayListOptimizer::Optimize(builder.Build());
+
+  DisplayListBuilder expected;
+  expected.ClipRect(SkRect::MakeWH(100.0f, 100.0f));
+  expected.DrawRect(SkRect::MakeLTRB(10.0f, 10.0f, 20.0f, 20.0f), DlPaint());
+  expected.ClipRect(SkRect::MakeWH(50.0f, 50.0f));
+  expected.DrawRect(SkRect::MakeLTRB(30.0f, 30.0f, 40.0f, 40.0f), DlPaint());
+  EXPECT_TRUE(DisplayListsEQ_Verbose(optimized, expected.Build()));
+}
+
+TEST(DisplayListOptimizer, KeepsClipsInFilteredLayers) {
+  auto blur = DlBlurImageFilter::Make(5.0f, 5.0f, DlTileMode::kDecal);
+  DisplayListBuilder builder;
+  builder.ClipRect(SkRect::MakeWH(100.0f, 100.0f));
+  builder.SaveLayer(nullptr, nullptr, blur.get());
+  builder.ClipRect(SkRect::MakeLTRB(-10.0f, -10.0f, 200.0f, 200.0f));
+  builder.DrawRect(SkRect::MakeLTRB(10.0f, 10.0f, 150.0f, 150.0f), DlPaint());
+  builder.Restore();
+  auto display_list = builder.Build();
+  auto optimized = DisplayListOptimizer::Optimize(display_list);
+  EXPECT_EQ(optimized->op_count(), display_list->op_count());
+}
+
+TEST(DisplayListOptimizer, MergesAdjacentRectFills) {
+  DlPaint paint(DlColor::kBlue());
+  DisplayListBuilder builder;
+  builder.DrawRect(SkRect::MakeLTRB(0.0f, 0.0f, 10.0f, 10.0f), paint);
+  builder.DrawRect(SkRect::MakeLTRB(10.0f, 0.0f, 20.0f, 10.0f), paint);
+  builder.DrawRect(SkRect::MakeLTRB(0.0f, 10.0f, 20.0f, 30.0f), paint);
+  // Overlaps the merged rects, so filling it separately blends twice.
+  builder.DrawRect(SkRect::MakeLTRB(5.0f, 5.0f, 15.0f, 15.0f), paint);
+  builder.DrawRect(SkRect::MakeLTRB(15.0f, 5.0f, 25.0f, 15.0f),
+                   DlPaint(DlColor::kRed()));
+  auto optimized = DisplayListOptimizer::Optimize(builder.Build());
+
+  DisplayListBuilder expected;
+  expected.DrawRect(SkRect::MakeLTRB(0.0f, 0.0f, 20.0f, 30.0f), paint);
+  expected.DrawRect(SkRect::MakeLTRB(5.0f, 5.0f, 15.0f, 15.0f), paint);
+  expected.DrawRect(SkRect::MakeLTRB(15.0f, 5.0f, 25.0f, 15.0f),
+                    DlPaint(DlColor::kRed()));
+  EXPECT_TRUE(DisplayListsEQ_Verbose(optimized, expected.Build()));
+}
+
+TEST(DisplayListOptimizer, DoesNotMergeStrokedRects) {
+  DlPaint paint(DlColor::kBlue());
+  paint.setDrawStyle(DlDrawStyle::kStroke);
+  DisplayListBuilder builder;
+  builder.DrawRect(SkRect::MakeLTRB(0.0f, 0.0f, 10.0f, 10.0f), paint);
+  builder.DrawRect(SkRect::MakeLTRB(10.0f, 0.0f, 20.0f, 10.0f), paint);
+  auto display_list = builder.Build();
+  auto optimized = DisplayListOptimizer::Optimize(display_list);
+  EXPECT_TRUE(DisplayListsEQ_Verbose(optimized, display_list));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -4,9 +4,13 @@
 
 #include "flutter/flow/compositor_context.h"
 
+#include <algorithm>
+#include <iterator>
 #include <optional>
 #include <utility>
+
 #include "flutter/flow/layers/layer_tree.h"
+#include "flutter/fml/time/time_point.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 
 namespace flutter {
@@ -14,13 +18,15 @@ namespace flutter {
 std::optional<SkRect> FrameDamage::ComputeClipRect(
     flutter::LayerTree& layer_tree,
     bool has_raster_cache,
-    bool impeller_enabled) {
+    bool impeller_enabled,
+    TextureRegistry* texture_registry) {
   if (layer_tree.root_layer()) {
     PaintRegionMap empty_paint_region_map;
     DiffContext context(layer_tree.frame_size(), layer_tree.paint_region_map(),
                         prev_layer_tree_ ? prev_layer_tree_->paint_region_map()
                                          : empty_paint_region_map,
                         has_raster_cache, impeller_enabled);
+    context.set_texture_registry(texture_registry);
     context.PushCullRect(SkRect::MakeIWH(layer_tree.frame_size().width(),
                                          layer_tree.frame_size().height()));
     {
@@ -120,10 +126,20 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
     FrameDamage* frame_damage) {
   TRACE_EVENT0("flutter", "CompositorContext::ScopedFrame::Raster");
 
+  std::fill(std::begin(raster_phase_durations_),
+            std::end(raster_phase_durations_), fml::TimeDelta::Zero());
+  fml::TimePoint phase_start = fml::TimePoint::Now();
+  auto end_phase = [&](FrameTiming::RasterPhase phase) {
+    fml::TimePoint now = fml::TimePoint::Now();
+    raster_phase_durations_[phase] = now - phase_start;
+    phase_start = now;
+  };
+
   std::optional<SkRect> clip_rect;
   if (frame_damage) {
-    clip_rect = frame_damage->ComputeClipRect(layer_tree, !ignore_raster_cache,
-                                              !gr_context_);
+    clip_rect = frame_damage->ComputeClipRect(
+        layer_tree, !ignore_raster_cache, !gr_context_,
+        context_.texture_registry().get());
 
     if (aiks_context_ &&
         !ShouldPerformPartialRepaint(clip_rect, layer_tree.frame_size())) {
@@ -131,6 +147,7 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
       frame_damage->Reset();
     }
   }
+  end_phase(FrameTiming::kDiff);
 
   bool root_needs_readback = layer_tree.Preroll(
       *this, ignore_raster_cache, clip_rect ? *clip_rect : kGiantRect);
@@ -141,6 +158,8 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
         view_embedder_->PostPrerollAction(raster_thread_merger_);
   }
 
+  end_phase(FrameTiming::kPreroll);
+
   if (post_preroll_result == PostPrerollResult::kResubmitFrame) {
     return RasterStatus::kResubmit;
   }
@@ -154,6 +173,7 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
     PaintLayerTreeSkia(layer_tree, clip_rect, needs_save_layer,
                        ignore_raster_cache);
   }
+  end_phase(FrameTiming::kPaint);
   return RasterStatus::kSuccess;
 }
 
@@ -9,11 +9,13 @@
 #include <string>
 
 #include "flutter/common/graphics/texture.h"
+#include "flutter/common/settings.h"
 #include "flutter/flow/diff_context.h"
 #include "flutter/flow/embedded_views.h"
 #include "flutter/flow/layer_snapshot_store.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/flow/stopwatch.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "third_party/skia/include/core/SkCanvas.h"
@@ -72,9 +74,13 @@ class FrameDamage {
   // If previous layer tree is not specified, clip rect will be nullopt,
   // but the paint region of layer_tree will be calculated so that it can be
   // used for diffing of subsequent frames.
-  std::optional<SkRect> ComputeClipRect(flutter::LayerTree& layer_tree,
-                                        bool has_raster_cache,
-                                        bool impeller_enabled);
+  // If |texture_registry| is provided, texture layers whose texture has no
+  // new frame are not considered damaged.
+  std::optional<SkRect> ComputeClipRect(
+      flutter::LayerTree& layer_tree,
+      bool has_raster_cache,
+      bool impeller_enabled,
+      TextureRegistry* texture_registry = nullptr);
 
   // See Damage::frame_damage.
   std::optional<SkIRect> GetFrameDamage() const {
@@ -139,6 +145,13 @@ class CompositorContext {
                                 bool ignore_raster_cache,
                                 FrameDamage* frame_damage);
 
+    /// The time the last call to `Raster` spent in the diff, preroll and
+    /// paint steps.
+    fml::TimeDelta GetRasterPhaseDuration(
+        FrameTiming::RasterPhase phase) const {
+      return raster_phase_durations_[phase];
+    }
+
    private:
     void PaintLayerTreeSkia(flutter::LayerTree& layer_tree,
                             std::optional<SkRect> clip_rect,
@@ -158,6 +171,7 @@ class CompositorContext {
     const bool instrumentation_enabled_;
     const bool surface_supports_readback_;
     fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
+    fml::TimeDelta raster_phase_durations_[FrameTiming::kRasterPhaseCount];
 
     FML_DISALLOW_COPY_AND_ASSIGN(ScopedFrame);
   };
@@ -194,12 +208,39 @@ class CompositorContext {
 
   LayerSnapshotStore& snapshot_store() { return layer_snapshot_store_; }
 
+  /// @brief  Sets the task runner used to preroll the children of wide
+  ///         containers concurrently. Prerolls are serial when unset.
+  void SetConcurrentPrerollTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+    concurrent_preroll_task_runner_ = std::move(task_runner);
+  }
+
+  const std::shared_ptr<fml::ConcurrentTaskRunner>&
+  concurrent_preroll_task_runner() const {
+    return concurrent_preroll_task_runner_;
+  }
+
+  /// @brief  Sets the task runner used to record large display lists in
+  ///         tiles concurrently when rendering with Skia. Display lists are
+  ///         recorded on the raster thread when unset.
+  void SetConcurrentRecordingTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+    concurrent_recording_task_runner_ = std::move(task_runner);
+  }
+
+  const std::shared_ptr<fml::ConcurrentTaskRunner>&
+  concurrent_recording_task_runner() const {
+    return concurrent_recording_task_runner_;
+  }
+
  private:
   RasterCache raster_cache_;
   std::shared_ptr<TextureRegistry> texture_registry_;
   Stopwatch raster_time_;
   Stopwatch ui_time_;
   LayerSnapshotStore layer_snapshot_store_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_preroll_task_runner_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_recording_task_runner_;
 
   /// Only used by default constructor of `CompositorContext`.
   FixedRefreshRateUpdater fixed_refresh_rate_updater_;
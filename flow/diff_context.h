@@ -19,6 +19,7 @@
 namespace flutter {
 
 class Layer;
+class TextureRegistry;
 
 // Represents area that needs to be updated in front buffer (frame_damage) and
 // area that is going to be painted to in back buffer (buffer_damage).
@@ -168,6 +169,15 @@ class DiffContext {
 
   bool impeller_enabled() const { return impeller_enabled_; }
 
+  // The registry of the textures painted by texture layers. When set, texture
+  // layers whose texture has no new frame since the previous layer tree are
+  // not repainted.
+  void set_texture_registry(TextureRegistry* texture_registry) {
+    texture_registry_ = texture_registry;
+  }
+
+  TextureRegistry* texture_registry() const { return texture_registry_; }
+
   class Statistics {
    public:
     // Picture replaced by different picture
@@ -253,6 +263,7 @@ class DiffContext {
   const PaintRegionMap& last_frame_paint_region_map_;
   bool has_raster_cache_;
   bool impeller_enabled_;
+  TextureRegistry* texture_registry_ = nullptr;
 
   void AddDamage(const SkRect& rect);
 
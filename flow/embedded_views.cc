@@ -30,6 +30,10 @@ void DisplayListEmbedderViewSlice::render_into(DlCanvas* canvas) {
   canvas->DrawDisplayList(display_list_);
 }
 
+sk_sp<DisplayList> DisplayListEmbedderViewSlice::display_list() const {
+  return display_list_;
+}
+
 void DisplayListEmbedderViewSlice::dispatch(DlOpReceiver& receiver) {
   display_list_->Dispatch(receiver);
 }
@@ -344,6 +344,9 @@ class EmbedderViewSlice {
   }
 
   virtual void render_into(DlCanvas* canvas) = 0;
+
+  // The recording, once |end_recording| has been called.
+  virtual sk_sp<DisplayList> display_list() const = 0;
 };
 
 class DisplayListEmbedderViewSlice : public EmbedderViewSlice {
@@ -356,6 +359,7 @@ class DisplayListEmbedderViewSlice : public EmbedderViewSlice {
   const DlRegion& getRegion() const override;
 
   void render_into(DlCanvas* canvas) override;
+  sk_sp<DisplayList> display_list() const override;
   void dispatch(DlOpReceiver& receiver);
   bool is_empty();
   bool recording_ended();
@@ -431,6 +435,18 @@ class ExternalViewEmbedder {
     return PostPrerollResult::kSuccess;
   }
 
+  // Hints that a frame with platform views is likely to be drawn soon, for
+  // example because the embedder has just created a platform view.
+  //
+  // Embedders that merge the raster and platform threads to draw platform
+  // views can merge them here, so that the frame with the platform views does
+  // not have to wait for the merge in |PostPrerollAction|.
+  //
+  // Called on the rasterizing thread between frames. The
+  // `raster_thread_merger` is never null.
+  virtual void PrepareToEmbedPlatformViews(
+      const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {}
+
   // Must be called on the UI thread.
   virtual DlCanvas* CompositeEmbeddedView(int64_t platform_view_id) = 0;
 
@@ -4,6 +4,8 @@
 
 #include "flutter/flow/frame_timings.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 
@@ -126,6 +128,20 @@ void FrameTimingsRecorder::RecordRasterStart(fml::TimePoint raster_start) {
   (void)status;
 }
 
+void FrameTimingsRecorder::AddRasterPhaseDuration(
+    FrameTiming::RasterPhase phase,
+    fml::TimeDelta duration) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  raster_phase_durations_[phase] = raster_phase_durations_[phase] + duration;
+}
+
+fml::TimeDelta FrameTimingsRecorder::GetRasterPhaseDuration(
+    FrameTiming::RasterPhase phase) const {
+  std::scoped_lock state_lock(state_mutex_);
+  return raster_phase_durations_[phase];
+}
+
 fml::Status FrameTimingsRecorder::RecordVsyncImpl(fml::TimePoint vsync_start,
                                                   fml::TimePoint vsync_target) {
   std::scoped_lock state_lock(state_mutex_);
@@ -197,6 +213,11 @@ FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   timing_.Set(FrameTiming::kRasterStart, raster_start_);
   timing_.Set(FrameTiming::kRasterFinish, raster_end_);
   timing_.Set(FrameTiming::kRasterFinishWallTime, raster_end_wall_time_);
+  for (int phase = 0; phase < FrameTiming::kRasterPhaseCount; phase++) {
+    timing_.SetRasterPhaseDuration(
+        static_cast<FrameTiming::RasterPhase>(phase),
+        raster_phase_durations_[phase]);
+  }
   timing_.SetFrameNumber(GetFrameNumber());
   timing_.SetRasterCacheStatistics(layer_cache_count_, layer_cache_bytes_,
                                    picture_cache_count_, picture_cache_bytes_);
@@ -232,6 +253,9 @@ std::unique_ptr<FrameTimingsRecorder> FrameTimingsRecorder::CloneUntil(
 
   if (state >= State::kRasterStart) {
     recorder->raster_start_ = raster_start_;
+    std::copy(std::begin(raster_phase_durations_),
+              std::end(raster_phase_durations_),
+              std::begin(recorder->raster_phase_durations_));
   }
 
   if (state >= State::kRasterEnd) {
@@ -99,6 +99,14 @@ class FrameTimingsRecorder {
   /// Records a raster start event.
   void RecordRasterStart(fml::TimePoint raster_start);
 
+  /// Adds to the time spent in a step of rasterization. May be called any
+  /// number of times between the raster start and end events.
+  void AddRasterPhaseDuration(FrameTiming::RasterPhase phase,
+                              fml::TimeDelta duration);
+
+  /// The time spent so far in a step of rasterization.
+  fml::TimeDelta GetRasterPhaseDuration(FrameTiming::RasterPhase phase) const;
+
   /// Clones the recorder until (and including) the specified state.
   std::unique_ptr<FrameTimingsRecorder> CloneUntil(State state);
 
@@ -152,6 +160,7 @@ class FrameTimingsRecorder {
   fml::TimePoint raster_start_;
   fml::TimePoint raster_end_;
   fml::TimePoint raster_end_wall_time_;
+  fml::TimeDelta raster_phase_durations_[FrameTiming::kRasterPhaseCount];
 
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
@@ -125,6 +125,38 @@ TEST(FrameTimingsRecorderTest, RecordRasterTimesWithCache) {
 #if !defined(OS_FUCHSIA) && !defined(FML_OS_WIN) && \
     (FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG)
 
+TEST(FrameTimingsRecorderTest, RecordRasterPhaseDurations) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto st = fml::TimePoint::Now();
+  const auto en = st + fml::TimeDelta::FromMillisecondsF(16);
+  recorder->RecordVsync(st, en);
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+  recorder->RecordBuildEnd(fml::TimePoint::Now());
+  recorder->RecordRasterStart(fml::TimePoint::Now());
+
+  // Each view drawn in the frame adds to the durations.
+  const auto paint = fml::TimeDelta::FromMilliseconds(3);
+  const auto submit = fml::TimeDelta::FromMilliseconds(2);
+  for (int i = 0; i < 2; i++) {
+    recorder->AddRasterPhaseDuration(FrameTiming::kPaint, paint);
+    recorder->AddRasterPhaseDuration(FrameTiming::kSubmit, submit);
+  }
+  ASSERT_EQ(paint * 2, recorder->GetRasterPhaseDuration(FrameTiming::kPaint));
+
+  const auto cloned =
+      recorder->CloneUntil(FrameTimingsRecorder::State::kRasterStart);
+  ASSERT_EQ(submit * 2, cloned->GetRasterPhaseDuration(FrameTiming::kSubmit));
+
+  FrameTiming timing = recorder->RecordRasterEnd();
+  ASSERT_EQ(fml::TimeDelta::Zero(),
+            timing.GetRasterPhaseDuration(FrameTiming::kDiff));
+  ASSERT_EQ(fml::TimeDelta::Zero(),
+            timing.GetRasterPhaseDuration(FrameTiming::kPreroll));
+  ASSERT_EQ(paint * 2, timing.GetRasterPhaseDuration(FrameTiming::kPaint));
+  ASSERT_EQ(submit * 2, timing.GetRasterPhaseDuration(FrameTiming::kSubmit));
+}
+
 TEST(FrameTimingsRecorderTest, ThrowWhenRecordBuildBeforeVsync) {
   auto recorder = std::make_unique<FrameTimingsRecorder>();
 
@@ -21,6 +21,10 @@ class BackdropFilterLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  bool CanPrerollConcurrently() const override { return false; }
+
+  bool AddPaintOps(PaintOpStream& stream) const override { return false; }
+
  private:
   std::shared_ptr<const DlImageFilter> filter_;
   DlBlendMode blend_mode_;
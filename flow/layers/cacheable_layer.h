@@ -40,6 +40,10 @@ class CacheableContainerLayer : public ContainerLayer {
     return layer_raster_cache_item_.get();
   }
 
+  // Cacheable containers apply their state to their children through the
+  // |LayerStateStack| and may be drawn from the raster cache.
+  bool AddPaintOps(PaintOpStream& stream) const override { return false; }
+
  protected:
   std::unique_ptr<LayerRasterCacheItem> layer_raster_cache_item_;
 };
@@ -7,6 +7,7 @@
 
 #include "flutter/flow/layers/cacheable_layer.h"
 #include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/layers/paint_op_stream.h"
 #include "flutter/flow/paint_utils.h"
 
 namespace flutter {
@@ -99,6 +100,19 @@ class ClipShapeLayer : public CacheableContainerLayer {
     PaintChildren(context);
   }
 
+  bool AddPaintOps(PaintOpStream& stream) const override {
+    if (UsesSaveLayer()) {
+      return false;
+    }
+    stream.AddSave();
+    stream.AddClip(clip_shape_, clip_behavior_ != Clip::kHardEdge);
+    if (!ContainerLayer::AddPaintOps(stream)) {
+      return false;
+    }
+    stream.AddRestore();
+    return true;
+  }
+
   bool UsesSaveLayer() const {
     return clip_behavior_ == Clip::kAntiAliasWithSaveLayer;
   }
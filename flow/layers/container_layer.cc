@@ -4,10 +4,18 @@
 
 #include "flutter/flow/layers/container_layer.h"
 
+#include <algorithm>
 #include <optional>
 
+#include "flutter/flow/layers/paint_op_stream.h"
+#include "flutter/fml/parallel_for.h"
+
 namespace flutter {
 
+// Containers with fewer children than this are always prerolled serially as
+// the cost of dispatching to worker threads outweighs the gains.
+static constexpr size_t kMinChildrenForConcurrentPreroll = 16;
+
 ContainerLayer::ContainerLayer() : child_paint_bounds_(SkRect::MakeEmpty()) {}
 
 void ContainerLayer::Diff(DiffContext* context, const Layer* old_layer) {
@@ -126,6 +134,12 @@ static bool safe_intersection_test(const SkRect* rect1, const SkRect& rect2) {
   return rect1->intersects(rect2);
 }
 
+bool ContainerLayer::CanPrerollConcurrently() const {
+  return std::all_of(layers_.begin(), layers_.end(), [](const auto& layer) {
+    return layer->CanPrerollConcurrently();
+  });
+}
+
 void ContainerLayer::PrerollChildren(PrerollContext* context,
                                      SkRect* child_paint_bounds) {
   // Platform views have no children, so context->has_platform_view should
@@ -133,22 +147,63 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   FML_DCHECK(!context->has_platform_view);
   FML_DCHECK(!context->has_texture_layer);
 
+  if (CanReuseRetainedPreroll(context)) {
+    // Nothing in the subtree has changed and it does not contain platform
+    // views, texture layers or raster cache items, so prerolling it again
+    // would produce the same results.
+    child_paint_bounds->join(child_paint_bounds_);
+    context->surface_needs_readback = context->surface_needs_readback ||
+                                      retained_preroll_->surface_needs_readback;
+    context->renderable_state_flags = children_renderable_state_flags_;
+    return;
+  }
+
+  // The readback of the children is tracked separately so that it can be
+  // reused by later prerolls of a retained layer.
+  const bool parent_needs_readback = context->surface_needs_readback;
+  context->surface_needs_readback = false;
+  const size_t raster_cached_entry_count =
+      context->raster_cached_entries ? context->raster_cached_entries->size()
+                                     : 0;
+
+  std::vector<ChildPrerollResult> concurrent_results;
+  bool prerolled_concurrently =
+      PrerollChildrenConcurrently(context, concurrent_results);
+
   bool child_has_platform_view = false;
   bool child_has_texture_layer = false;
   bool all_renderable_state_flags = LayerStateStack::kCallerCanApplyAnything;
 
-  for (auto& layer : layers_) {
-    // Reset context->has_platform_view and context->has_texture_layer to false
-    // so that layers aren't treated as if they have a platform view or texture
-    // layer based on one being previously found in a sibling tree.
-    context->has_platform_view = false;
-    context->has_texture_layer = false;
+  for (size_t i = 0; i < layers_.size(); i++) {
+    auto& layer = layers_[i];
+    if (prerolled_concurrently) {
+      // The children were prerolled with their own contexts; fold their
+      // results into this context in order, as a serial preroll would have.
+      ChildPrerollResult& result = concurrent_results[i];
+      context->has_platform_view = result.has_platform_view;
+      context->has_texture_layer = result.has_texture_layer;
+      context->renderable_state_flags = result.renderable_state_flags;
+      context->surface_needs_readback =
+          context->surface_needs_readback || result.surface_needs_readback;
+      if (context->raster_cached_entries) {
+        context->raster_cached_entries->insert(
+            context->raster_cached_entries->end(),
+            result.raster_cached_entries.begin(),
+            result.raster_cached_entries.end());
+      }
+    } else {
+      // Reset context->has_platform_view and context->has_texture_layer to
+      // false so that layers aren't treated as if they have a platform view or
+      // texture layer based on one being previously found in a sibling tree.
+      context->has_platform_view = false;
+      context->has_texture_layer = false;
 
-    // Initialize the renderable state flags to false to force the layer to
-    // opt-in to applying state attributes during its |Preroll|
-    context->renderable_state_flags = 0;
+      // Initialize the renderable state flags to false to force the layer to
+      // opt-in to applying state attributes during its |Preroll|
+      context->renderable_state_flags = 0;
 
-    layer->Preroll(context);
+      layer->Preroll(context);
+    }
 
     all_renderable_state_flags &= context->renderable_state_flags;
     if (safe_intersection_test(child_paint_bounds, layer->paint_bounds())) {
@@ -171,6 +226,104 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   set_subtree_has_platform_view(child_has_platform_view);
   set_children_renderable_state_flags(all_renderable_state_flags);
   set_child_paint_bounds(*child_paint_bounds);
+
+  const bool children_need_readback = context->surface_needs_readback;
+  context->surface_needs_readback =
+      parent_needs_readback || children_need_readback;
+
+  retained_preroll_.reset();
+  if (retained_ && !child_has_platform_view && !child_has_texture_layer &&
+      (!context->raster_cached_entries ||
+       context->raster_cached_entries->size() == raster_cached_entry_count) &&
+      CanPrerollConcurrently()) {
+    // Layers that can be prerolled concurrently have no effects outside of
+    // their own subtree, so skipping their preroll is also safe.
+    retained_preroll_ = {
+        .matrix = context->state_stack.transform_4x4(),
+        .cull_rect = context->state_stack.device_cull_rect(),
+        .has_raster_cache = context->raster_cache != nullptr,
+        .surface_needs_readback = children_need_readback,
+    };
+  }
+}
+
+bool ContainerLayer::CanReuseRetainedPreroll(
+    const PrerollContext* context) const {
+  return retained_ && retained_preroll_.has_value() &&
+         retained_preroll_->has_raster_cache ==
+             (context->raster_cache != nullptr) &&
+         retained_preroll_->cull_rect ==
+             context->state_stack.device_cull_rect() &&
+         retained_preroll_->matrix == context->state_stack.transform_4x4();
+}
+
+bool ContainerLayer::PrerollChildrenConcurrently(
+    PrerollContext* context,
+    std::vector<ChildPrerollResult>& results) {
+  if (!context->concurrent_task_runner ||
+      layers_.size() < kMinChildrenForConcurrentPreroll ||
+      !CanPrerollConcurrently()) {
+    return false;
+  }
+
+  // Each child gets a fresh state stack that starts from the current cull
+  // rect and transform. A perspective transform cannot be carried over that
+  // way, so fall back to a serial preroll.
+  const SkMatrix matrix = context->state_stack.transform_3x3();
+  if (context->state_stack.transform_4x4() != SkM44(matrix)) {
+    return false;
+  }
+  const SkRect cull_rect = context->state_stack.device_cull_rect();
+
+  TRACE_EVENT1("flutter", "ContainerLayer::PrerollChildrenConcurrently",
+               "children", std::to_string(layers_.size()).c_str());
+
+  const size_t child_count = layers_.size();
+  results.resize(child_count);
+  auto preroll_child = [&](size_t index) {
+    LayerStateStack state_stack;
+    state_stack.set_preroll_delegate(cull_rect, matrix);
+    ChildPrerollResult& result = results[index];
+    PrerollContext child_context = {
+        // clang-format off
+        .raster_cache                  = context->raster_cache,
+        .gr_context                    = context->gr_context,
+        .view_embedder                 = context->view_embedder,
+        .state_stack                   = state_stack,
+        .dst_color_space               = context->dst_color_space,
+        .surface_needs_readback        = false,
+        .raster_time                   = context->raster_time,
+        .ui_time                       = context->ui_time,
+        .texture_registry              = context->texture_registry,
+        .raster_cached_entries         = context->raster_cached_entries
+                                             ? &result.raster_cached_entries
+                                             : nullptr,
+        .impeller_enabled              = context->impeller_enabled,
+        // clang-format on
+    };
+    layers_[index]->Preroll(&child_context);
+    result.has_platform_view = child_context.has_platform_view;
+    result.has_texture_layer = child_context.has_texture_layer;
+    result.surface_needs_readback = child_context.surface_needs_readback;
+    result.renderable_state_flags = child_context.renderable_state_flags;
+  };
+
+  fml::ParallelFor(context->concurrent_task_runner, child_count, 1,
+                   [&preroll_child](size_t begin, size_t end) {
+                     for (size_t index = begin; index < end; index++) {
+                       preroll_child(index);
+                     }
+                   });
+  return true;
+}
+
+bool ContainerLayer::AddPaintOps(PaintOpStream& stream) const {
+  for (auto& layer : layers_) {
+    if (!stream.AddLayer(layer.get())) {
+      return false;
+    }
+  }
+  return true;
 }
 
 void ContainerLayer::PaintChildren(PaintContext& context) const {
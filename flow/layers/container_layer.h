@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FLOW_LAYERS_CONTAINER_LAYER_H_
 #define FLUTTER_FLOW_LAYERS_CONTAINER_LAYER_H_
 
+#include <optional>
 #include <vector>
 
 #include "flutter/flow/layers/layer.h"
@@ -23,6 +24,10 @@ class ContainerLayer : public Layer {
   void Preroll(PrerollContext* context) override;
   void Paint(PaintContext& context) const override;
 
+  bool CanPrerollConcurrently() const override;
+
+  bool AddPaintOps(PaintOpStream& stream) const override;
+
   const std::vector<std::shared_ptr<Layer>>& layers() const { return layers_; }
 
   virtual void DiffChildren(DiffContext* context,
@@ -44,13 +49,55 @@ class ContainerLayer : public Layer {
     children_renderable_state_flags_ = flags;
   }
 
+  // Marks this layer as retained by the framework from one frame to the
+  // next, see |SceneBuilder::addRetained|. The subtree of a retained layer
+  // does not change, so the results of prerolling its children are reused
+  // whenever they are prerolled again under the same transform and cull
+  // rect.
+  void set_retained(bool retained) {
+    retained_ = retained;
+    retained_preroll_.reset();
+  }
+  bool retained() const { return retained_; }
+
  protected:
   void PrerollChildren(PrerollContext* context, SkRect* child_paint_bounds);
 
  private:
+  struct ChildPrerollResult {
+    bool has_platform_view = false;
+    bool has_texture_layer = false;
+    bool surface_needs_readback = false;
+    int renderable_state_flags = 0;
+    std::vector<RasterCacheItem*> raster_cached_entries;
+  };
+
+  // Prerolls the children on the context's concurrent task runner and on the
+  // calling thread, storing the outcome of each child in |results|. Returns
+  // false, without prerolling anything, if the children cannot be prerolled
+  // concurrently.
+  bool PrerollChildrenConcurrently(PrerollContext* context,
+                                   std::vector<ChildPrerollResult>& results);
+
+  // The conditions under which the children of a retained layer were last
+  // prerolled, along with the one result that is not already stored in the
+  // members of this layer.
+  struct RetainedPrerollState {
+    SkM44 matrix;
+    SkRect cull_rect;
+    bool has_raster_cache;
+    bool surface_needs_readback;
+  };
+
+  // Returns true if the children were prerolled under the same conditions
+  // last time and their results can be reused for |context|.
+  bool CanReuseRetainedPreroll(const PrerollContext* context) const;
+
   std::vector<std::shared_ptr<Layer>> layers_;
   SkRect child_paint_bounds_;
   int children_renderable_state_flags_ = 0;
+  bool retained_ = false;
+  std::optional<RetainedPrerollState> retained_preroll_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ContainerLayer);
 };
@@ -9,6 +9,7 @@
 #include "flutter/flow/testing/diff_context_test.h"
 #include "flutter/flow/testing/layer_test.h"
 #include "flutter/flow/testing/mock_layer.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "gtest/gtest.h"
 #include "include/core/SkMatrix.h"
@@ -254,6 +255,72 @@ TEST_F(ContainerLayerTest, NeedsSystemComposite) {
   EXPECT_TRUE(DisplayListsEQ_Verbose(display_list(), expected_builder.Build()));
 }
 
+TEST_F(ContainerLayerTest, ConcurrentPrerollMatchesSerialPreroll) {
+  SkMatrix initial_transform = SkMatrix::Translate(-0.5f, -0.5f);
+  DlPaint child_paint = DlPaint(DlColor::kGreen());
+
+  auto layer = std::make_shared<ContainerLayer>();
+  std::vector<std::shared_ptr<MockLayer>> mock_layers;
+  SkRect expected_total_bounds = SkRect::MakeEmpty();
+  for (int i = 0; i < 32; i++) {
+    SkPath child_path;
+    child_path.addRect(i * 10.0f, 0.0f, i * 10.0f + 5.0f, 5.0f);
+    auto mock_layer = std::make_shared<MockLayer>(child_path, child_paint);
+    mock_layer->set_fake_has_texture_layer(i == 20);
+    mock_layer->set_fake_opacity_compatible(true);
+    expected_total_bounds.join(child_path.getBounds());
+    mock_layers.push_back(mock_layer);
+    layer->Add(mock_layer);
+  }
+  ASSERT_TRUE(layer->CanPrerollConcurrently());
+
+  auto loop = fml::ConcurrentMessageLoop::Create(2);
+  preroll_context()->concurrent_task_runner = loop->GetTaskRunner();
+  preroll_context()->state_stack.set_preroll_delegate(initial_transform);
+  layer->Preroll(preroll_context());
+
+  EXPECT_TRUE(preroll_context()->has_texture_layer);
+  EXPECT_FALSE(preroll_context()->has_platform_view);
+  EXPECT_EQ(layer->paint_bounds(), expected_total_bounds);
+  EXPECT_EQ(layer->child_paint_bounds(), layer->paint_bounds());
+  for (auto& mock_layer : mock_layers) {
+    EXPECT_EQ(mock_layer->parent_matrix(), initial_transform);
+    EXPECT_EQ(mock_layer->parent_cull_rect(), kGiantRect);
+  }
+  // The children do not overlap, so they can all inherit state.
+  EXPECT_EQ(preroll_context()->renderable_state_flags,
+            LayerStateStack::kCallerCanApplyOpacity);
+}
+
+TEST_F(ContainerLayerTest, RetainedLayerReusesChildPreroll) {
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer);
+  layer->set_retained(true);
+
+  preroll_context()->state_stack.set_preroll_delegate(SkMatrix::I());
+  layer->Preroll(preroll_context());
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+  EXPECT_EQ(preroll_context()->renderable_state_flags, 0);
+
+  // A retained subtree never changes, so this change is only observed once
+  // the children are prerolled under different conditions.
+  mock_layer->set_fake_opacity_compatible(true);
+  layer->Preroll(preroll_context());
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+  EXPECT_EQ(preroll_context()->renderable_state_flags, 0);
+  EXPECT_EQ(mock_layer->parent_matrix(), SkMatrix::I());
+
+  SkMatrix transform = SkMatrix::Translate(10.0f, 10.0f);
+  preroll_context()->state_stack.set_preroll_delegate(transform);
+  layer->Preroll(preroll_context());
+  EXPECT_EQ(preroll_context()->renderable_state_flags,
+            LayerStateStack::kCallerCanApplyOpacity);
+  EXPECT_EQ(mock_layer->parent_matrix(), transform);
+}
+
 TEST_F(ContainerLayerTest, RasterCacheTest) {
   // LTRB
   const SkPath child_path1 = SkPath().addRect(5.0f, 6.0f, 20.5f, 21.5f);
@@ -0,0 +1,141 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layers/deferred_tile_rasterizer.h"
+
+#include <algorithm>
+#include <string>
+
+#include "flutter/display_list/dl_paint.h"
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/display_list/skia/dl_sk_canvas.h"
+#include "flutter/fml/parallel_for.h"
+#include "flutter/fml/trace_event.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
+#include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
+#include "third_party/skia/include/private/chromium/GrDeferredDisplayList.h"
+#include "third_party/skia/include/private/chromium/GrDeferredDisplayListRecorder.h"
+#include "third_party/skia/include/private/chromium/GrSurfaceCharacterization.h"
+
+namespace flutter {
+
+std::vector<SkIRect> DeferredTileRasterizer::ComputeTiles(
+    const SkIRect& area) {
+  std::vector<SkIRect> tiles;
+  for (int top = area.top(); top < area.bottom(); top += kTileSize) {
+    for (int left = area.left(); left < area.right(); left += kTileSize) {
+      tiles.push_back(SkIRect::MakeLTRB(
+          left, top, std::min(left + kTileSize, area.right()),
+          std::min(top + kTileSize, area.bottom())));
+    }
+  }
+  return tiles;
+}
+
+SkIRect DeferredTileRasterizer::ComputeTiledArea(
+    const DisplayList& display_list,
+    const PaintContext& context) {
+  if (!context.concurrent_recording_task_runner || !context.gr_context ||
+      context.impeller_enabled) {
+    return {};
+  }
+  // Display lists that draw GPU resident images can only be recorded on the
+  // raster thread.
+  if (display_list.op_count(true) < kMinOpCount ||
+      !display_list.isUIThreadSafe()) {
+    return {};
+  }
+
+  // The tiles are laid out in device space, which a perspective transform
+  // doesn't map the bounds of the display list into exactly.
+  const SkMatrix matrix = context.canvas->GetTransform();
+  if (context.canvas->GetTransformFullPerspective() != SkM44(matrix) ||
+      matrix.hasPerspective()) {
+    return {};
+  }
+  SkRect device_bounds = matrix.mapRect(display_list.bounds());
+  if (!device_bounds.intersect(context.canvas->GetDestinationClipBounds())) {
+    return {};
+  }
+  const SkIRect area = device_bounds.roundOut();
+
+  // A single tile would be recorded on one thread anyway.
+  if (area.width() <= kTileSize && area.height() <= kTileSize) {
+    return {};
+  }
+  return area;
+}
+
+bool DeferredTileRasterizer::Draw(const sk_sp<DisplayList>& display_list,
+                                  DlScalar opacity,
+                                  PaintContext& context) {
+  const SkIRect area = ComputeTiledArea(*display_list, context);
+  if (area.isEmpty()) {
+    return false;
+  }
+  const std::vector<SkIRect> tiles = ComputeTiles(area);
+
+  TRACE_EVENT1("flutter", "DeferredTileRasterizer::Draw", "tiles",
+               std::to_string(tiles.size()).c_str());
+
+  // The surfaces of the tiles are created on the raster thread, which owns
+  // the GrDirectContext. Their characterizations are all that the recorders
+  // on the workers need.
+  const size_t tile_count = tiles.size();
+  std::vector<sk_sp<SkSurface>> surfaces(tile_count);
+  std::vector<GrSurfaceCharacterization> characterizations(tile_count);
+  for (size_t i = 0; i < tile_count; i++) {
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(
+        tiles[i].width(), tiles[i].height(), context.dst_color_space);
+    surfaces[i] = SkSurfaces::RenderTarget(context.gr_context,
+                                           skgpu::Budgeted::kYes, info);
+    if (!surfaces[i] || !surfaces[i]->characterize(&characterizations[i])) {
+      return false;
+    }
+  }
+
+  DlCanvas* canvas = context.canvas;
+  const SkMatrix matrix = canvas->GetTransform();
+  std::vector<sk_sp<GrDeferredDisplayList>> recordings(tile_count);
+  fml::ParallelFor(
+      context.concurrent_recording_task_runner, tile_count, 1,
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          GrDeferredDisplayListRecorder recorder(characterizations[i]);
+          DlSkCanvasAdapter tile_canvas(recorder.getCanvas());
+          tile_canvas.Clear(DlColor::kTransparent());
+          tile_canvas.Translate(-tiles[i].left(), -tiles[i].top());
+          tile_canvas.Transform(matrix);
+          tile_canvas.DrawDisplayList(display_list);
+          recordings[i] = recorder.detach();
+        }
+      },
+      fml::ConcurrentTaskPriority::kLatencySensitive);
+
+  // The tiles are drawn untransformed at their device positions, subject
+  // to the clip of the canvas.
+  DlAutoCanvasRestore save(canvas, true);
+  canvas->TransformReset();
+  DlPaint paint;
+  paint.setOpacity(opacity);
+  for (size_t i = 0; i < tile_count; i++) {
+    if (!recordings[i] ||
+        !skgpu::ganesh::DrawDDL(surfaces[i], std::move(recordings[i]))) {
+      // Draw the tile directly if its recording couldn't be replayed.
+      DlAutoCanvasRestore tile_save(canvas, true);
+      canvas->ClipRect(SkRect::Make(tiles[i]));
+      canvas->SetTransform(matrix);
+      canvas->DrawDisplayList(display_list, opacity);
+      continue;
+    }
+    canvas->DrawImage(DlImage::Make(surfaces[i]->makeImageSnapshot()),
+                      SkPoint::Make(tiles[i].left(), tiles[i].top()),
+                      DlImageSampling::kNearestNeighbor, &paint);
+  }
+  return true;
+}
+
+}  // namespace flutter
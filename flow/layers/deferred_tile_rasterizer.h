@@ -0,0 +1,59 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYERS_DEFERRED_TILE_RASTERIZER_H_
+#define FLUTTER_FLOW_LAYERS_DEFERRED_TILE_RASTERIZER_H_
+
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/flow/layers/layer.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+// Rasterizes large display lists with Skia by splitting the area of the
+// canvas they cover into tiles, recording each tile into a
+// |GrDeferredDisplayList| on the concurrent recording task runner of the
+// paint context, and replaying the recordings on the raster thread.
+//
+// Recording a display list into Skia is CPU bound, so splitting the work
+// lets a complex picture use more than the raster thread. Each tile is
+// replayed into its own texture that is then drawn into the canvas, like
+// a raster cache entry.
+class DeferredTileRasterizer {
+ public:
+  // The width and height of the tiles, in device pixels.
+  static constexpr int kTileSize = 512;
+
+  // Display lists with fewer ops than this are recorded faster on the raster
+  // thread than they are split between workers.
+  static constexpr unsigned int kMinOpCount = 1000u;
+
+  // Splits a device space area into tiles of at most |kTileSize| pixels
+  // from its top left corner, in rows.
+  static std::vector<SkIRect> ComputeTiles(const SkIRect& area);
+
+  // Draws |display_list| into the canvas of |context| with its current
+  // transform and clip, recording it in tiles concurrently.
+  //
+  // Returns false without drawing anything if the display list is too small
+  // to benefit, the context can't record concurrently, or the display list
+  // can't be recorded off the raster thread, in which case the caller draws
+  // it directly.
+  static bool Draw(const sk_sp<DisplayList>& display_list,
+                   DlScalar opacity,
+                   PaintContext& context);
+
+ private:
+  // Returns the device space area of the canvas of |context| covered by
+  // |display_list|, or an empty rect if the display list can't or shouldn't
+  // be rasterized in tiles.
+  static SkIRect ComputeTiledArea(const DisplayList& display_list,
+                                  const PaintContext& context);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYERS_DEFERRED_TILE_RASTERIZER_H_
@@ -9,7 +9,9 @@
 #include "flutter/display_list/dl_builder.h"
 #include "flutter/flow/layer_snapshot_store.h"
 #include "flutter/flow/layers/cacheable_layer.h"
+#include "flutter/flow/layers/deferred_tile_rasterizer.h"
 #include "flutter/flow/layers/offscreen_surface.h"
+#include "flutter/flow/layers/paint_op_stream.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/flow/raster_cache_util.h"
 
@@ -103,6 +105,14 @@ void DisplayListLayer::Preroll(PrerollContext* context) {
   set_paint_bounds(bounds_);
 }
 
+bool DisplayListLayer::AddPaintOps(PaintOpStream& stream) const {
+  stream.AddSave();
+  stream.AddTranslate(offset_);
+  stream.AddDisplayList(this);
+  stream.AddRestore();
+  return true;
+}
+
 void DisplayListLayer::Paint(PaintContext& context) const {
   FML_DCHECK(display_list_);
   FML_DCHECK(needs_painting(context));
@@ -157,6 +167,9 @@ void DisplayListLayer::Paint(PaintContext& context) const {
     context.layer_snapshot_store->Add(snapshot_data);
   }
 
+  if (DeferredTileRasterizer::Draw(display_list_, opacity, context)) {
+    return;
+  }
   context.canvas->DrawDisplayList(display_list_, opacity);
 }
 
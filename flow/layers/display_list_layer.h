@@ -37,6 +37,8 @@ class DisplayListLayer : public Layer {
 
   void Paint(PaintContext& context) const override;
 
+  bool AddPaintOps(PaintOpStream& stream) const override;
+
   const DisplayListRasterCacheItem* raster_cache_item() const {
     return display_list_raster_cache_item_.get();
   }
@@ -7,6 +7,7 @@
 #include "flutter/flow/layers/display_list_layer.h"
 
 #include "flutter/display_list/dl_builder.h"
+#include "flutter/flow/layers/deferred_tile_rasterizer.h"
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/flow/testing/diff_context_test.h"
 #include "flutter/fml/macros.h"
@@ -634,6 +635,54 @@ TEST_F(DisplayListLayerTest, OverflowCachedDisplayListOpacityInheritance) {
   ASSERT_TRUE(opacity_layer->children_can_accept_opacity());
 }
 
+TEST(DeferredTileRasterizerTest, ComputeTilesCoversArea) {
+  const int size = DeferredTileRasterizer::kTileSize;
+  const SkIRect area = SkIRect::MakeXYWH(10, 20, size * 2 + 5, size + 1);
+  const std::vector<SkIRect> tiles =
+      DeferredTileRasterizer::ComputeTiles(area);
+  ASSERT_EQ(tiles.size(), 6u);
+  EXPECT_EQ(tiles[0], SkIRect::MakeXYWH(10, 20, size, size));
+  EXPECT_EQ(tiles[1], SkIRect::MakeXYWH(10 + size, 20, size, size));
+  EXPECT_EQ(tiles[2], SkIRect::MakeXYWH(10 + size * 2, 20, 5, size));
+  EXPECT_EQ(tiles[3], SkIRect::MakeXYWH(10, 20 + size, size, 1));
+  EXPECT_EQ(tiles[5], SkIRect::MakeXYWH(10 + size * 2, 20 + size, 5, 1));
+
+  int64_t covered = 0;
+  for (const SkIRect& tile : tiles) {
+    EXPECT_TRUE(area.contains(tile));
+    covered += static_cast<int64_t>(tile.width()) * tile.height();
+  }
+  EXPECT_EQ(covered, static_cast<int64_t>(area.width()) * area.height());
+}
+
+TEST_F(DisplayListLayerTest, LargeDisplayListIsDrawnDirectlyWithoutRunner) {
+  const SkRect picture_bounds = SkRect::MakeWH(2000, 2000);
+  DisplayListBuilder builder;
+  for (unsigned int i = 0; i < DeferredTileRasterizer::kMinOpCount; i++) {
+    builder.DrawRect(picture_bounds, DlPaint());
+  }
+  auto display_list = builder.Build();
+  const SkPoint layer_offset = SkPoint::Make(1.0f, 1.0f);
+  auto layer = std::make_shared<DisplayListLayer>(layer_offset, display_list,
+                                                  false, false);
+
+  layer->Preroll(preroll_context());
+  ASSERT_EQ(paint_context().concurrent_recording_task_runner, nullptr);
+  layer->Paint(display_list_paint_context());
+
+  DisplayListBuilder expected_builder;
+  /* (DisplayList)layer::Paint */ {
+    expected_builder.Save();
+    {
+      expected_builder.Translate(layer_offset.fX, layer_offset.fY);
+      expected_builder.DrawDisplayList(display_list);
+    }
+    expected_builder.Restore();
+  }
+  EXPECT_TRUE(
+      DisplayListsEQ_Verbose(this->display_list(), expected_builder.Build()));
+}
+
 }  // namespace testing
 }  // namespace flutter
 
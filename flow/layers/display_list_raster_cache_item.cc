@@ -22,7 +22,8 @@ static bool IsDisplayListWorthRasterizing(
     const DisplayList* display_list,
     bool will_change,
     bool is_complex,
-    DisplayListComplexityCalculator* complexity_calculator) {
+    DisplayListComplexityCalculator* complexity_calculator,
+    std::optional<unsigned int>& complexity_score) {
   if (will_change) {
     // If the display list is going to change in the future, there is no point
     // in doing to extra work to rasterize.
@@ -36,14 +37,20 @@ static bool IsDisplayListWorthRasterizing(
     return false;
   }
 
+  // The display list of an item never changes, so its score is computed once.
+  // The score is also kept as the replay cost of the cache entry, which the
+  // raster cache uses to decide what to evict when over its byte budget.
+  if (!complexity_score.has_value()) {
+    complexity_score = complexity_calculator->Compute(display_list);
+  }
+
   if (is_complex) {
     // The caller seems to have extra information about the display list and
     // thinks the display list is always worth rasterizing.
     return true;
   }
 
-  unsigned int complexity_score = complexity_calculator->Compute(display_list);
-  return complexity_calculator->ShouldBeCached(complexity_score);
+  return complexity_calculator->ShouldBeCached(complexity_score.value());
 }
 
 DisplayListRasterCacheItem::DisplayListRasterCacheItem(
@@ -71,13 +78,20 @@ std::unique_ptr<DisplayListRasterCacheItem> DisplayListRasterCacheItem::Make(
 void DisplayListRasterCacheItem::PrerollSetup(PrerollContext* context,
                                               const SkMatrix& matrix) {
   cache_state_ = CacheState::kNone;
-  DisplayListComplexityCalculator* complexity_calculator =
-      context->gr_context ? DisplayListComplexityCalculator::GetForBackend(
-                                context->gr_context->backend())
-                          : DisplayListComplexityCalculator::GetForSoftware();
+  warm_up_candidate_ = false;
+  DisplayListComplexityCalculator* complexity_calculator;
+  if (context->impeller_enabled) {
+    complexity_calculator = DisplayListComplexityCalculator::GetForImpeller();
+  } else if (context->gr_context) {
+    complexity_calculator = DisplayListComplexityCalculator::GetForBackend(
+        context->gr_context->backend());
+  } else {
+    complexity_calculator = DisplayListComplexityCalculator::GetForSoftware();
+  }
 
   if (!IsDisplayListWorthRasterizing(display_list(), will_change_, is_complex_,
-                                     complexity_calculator)) {
+                                     complexity_calculator,
+                                     complexity_score_)) {
     // We only deal with display lists that are worthy of rasterization.
     return;
   }
@@ -108,9 +122,13 @@ void DisplayListRasterCacheItem::PrerollFinalize(PrerollContext* context,
   bool visible = !context->state_stack.content_culled(bounds);
   RasterCache::CacheInfo cache_info =
       raster_cache->MarkSeen(key_id_, matrix, visible);
-  if (!visible ||
-      cache_info.accesses_since_visible <= raster_cache->access_threshold()) {
+  // An entry that was rasterized ahead of time while idle is drawn as soon as
+  // it exists, even before it reaches the access threshold.
+  bool below_threshold =
+      cache_info.accesses_since_visible <= raster_cache->access_threshold();
+  if (!visible || (below_threshold && !cache_info.has_image)) {
     cache_state_ = kNone;
+    warm_up_candidate_ = visible;
   } else {
     if (cache_info.has_image) {
       context->renderable_state_flags |=
@@ -156,6 +174,22 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
       !context.raster_cache->GenerateNewCacheInThisFrame() || !id.has_value()) {
     return false;
   }
+  return UpdateCacheEntry(context, id.value());
+}
+
+bool DisplayListRasterCacheItem::TryToWarmUpRasterCache(
+    const PaintContext& context) const {
+  if (!warm_up_candidate_ || !context.raster_cache ||
+      context.raster_cache->access_threshold() == 0) {
+    return false;
+  }
+  warm_up_candidate_ = false;
+  return UpdateCacheEntry(context, key_id_);
+}
+
+bool DisplayListRasterCacheItem::UpdateCacheEntry(
+    const PaintContext& context,
+    const RasterCacheKeyID& id) const {
   SkRect bounds = display_list_->bounds().makeOffset(offset_.x(), offset_.y());
   RasterCache::Context r_context = {
       // clang-format off
@@ -164,10 +198,12 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
       .matrix             = transformation_matrix_,
       .logical_rect       = bounds,
       .flow_type          = flow_type,
+      .aiks_context       = context.aiks_context,
+      .replay_cost        = complexity_score_.value_or(0),
       // clang-format on
   };
   return context.raster_cache->UpdateCacheEntry(
-      id.value(), r_context,
+      id, r_context,
       [display_list = display_list_](DlCanvas* canvas) {
         canvas->DrawDisplayList(display_list);
       },
@@ -43,6 +43,8 @@ class DisplayListRasterCacheItem : public RasterCacheItem {
   bool TryToPrepareRasterCache(const PaintContext& context,
                                bool parent_cached = false) const override;
 
+  bool TryToWarmUpRasterCache(const PaintContext& context) const override;
+
   void ModifyMatrix(SkPoint offset) const {
     matrix_ = matrix_.preTranslate(offset.x(), offset.y());
   }
@@ -50,11 +52,16 @@ class DisplayListRasterCacheItem : public RasterCacheItem {
   const DisplayList* display_list() const { return display_list_.get(); }
 
  private:
+  bool UpdateCacheEntry(const PaintContext& context,
+                        const RasterCacheKeyID& id) const;
+
   SkMatrix transformation_matrix_;
   sk_sp<DisplayList> display_list_;
   SkPoint offset_;
   bool is_complex_;
   bool will_change_;
+  std::optional<unsigned int> complexity_score_;
+  mutable bool warm_up_candidate_ = false;
 };
 
 }  // namespace flutter
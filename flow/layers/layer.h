@@ -20,6 +20,7 @@
 #include "flutter/flow/stopwatch.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/compiler_specific.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/trace_event.h"
@@ -42,6 +43,7 @@ class MockLayer;
 
 class ContainerLayer;
 class DisplayListLayer;
+class PaintOpStream;
 class PerformanceOverlayLayer;
 class TextureLayer;
 class RasterCacheItem;
@@ -82,6 +84,15 @@ struct PrerollContext {
   int renderable_state_flags = 0;
 
   std::vector<RasterCacheItem*>* raster_cached_entries;
+
+  // When set, containers with many children may preroll them concurrently on
+  // this task runner. The contexts handed to those children leave it unset,
+  // so nested containers preroll serially.
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner;
+
+  // Whether the tree is being prerolled for rendering with Impeller, which
+  // raster cache items use to choose how to estimate rendering costs.
+  bool impeller_enabled = false;
 };
 
 struct PaintContext {
@@ -119,6 +130,11 @@ struct PaintContext {
   bool enable_leaf_layer_tracing = false;
   bool impeller_enabled = false;
   impeller::AiksContext* aiks_context;
+
+  // The task runner that large display lists are recorded on in tiles, see
+  // |DeferredTileRasterizer|. Null unless deferred tile rasterization is
+  // enabled.
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_recording_task_runner;
 };
 
 // Represents a single composited layer. Created on the UI thread but then
@@ -167,6 +183,11 @@ class Layer {
 
   virtual void Preroll(PrerollContext* context) = 0;
 
+  // Whether this layer and its subtree can be prerolled on a worker thread
+  // concurrently with its siblings. Layers that record state in the shared
+  // ExternalViewEmbedder during Preroll must return false.
+  virtual bool CanPrerollConcurrently() const { return true; }
+
   // Used during Preroll by layers that employ a saveLayer to manage the
   // PrerollContext settings with values affected by the saveLayer mechanism.
   // This object must be created before calling Preroll on the children to
@@ -197,6 +218,11 @@ class Layer {
 
   virtual void PaintChildren(PaintContext& context) const { FML_DCHECK(false); }
 
+  // Appends the operations that paint this layer to |stream| and returns
+  // true, or returns false if this layer can only be painted by |Paint|.
+  // See |PaintOpStream|.
+  virtual bool AddPaintOps(PaintOpStream& stream) const { return false; }
+
   bool subtree_has_platform_view() const { return subtree_has_platform_view_; }
   void set_subtree_has_platform_view(bool value) {
     subtree_has_platform_view_ = value;
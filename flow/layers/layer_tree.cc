@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/layer_tree.h"
 
+#include <algorithm>
+
 #include "flutter/display_list/skia/dl_sk_canvas.h"
 #include "flutter/flow/embedded_views.h"
 #include "flutter/flow/frame_timings.h"
@@ -62,11 +64,21 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
       .ui_time                       = frame.context().ui_time(),
       .texture_registry              = frame.context().texture_registry(),
       .raster_cached_entries         = &raster_cache_items_,
+      .concurrent_task_runner        =
+          frame.context().concurrent_preroll_task_runner(),
+      .impeller_enabled              = !!frame.aiks_context(),
       // clang-format on
   };
 
   root_layer_->Preroll(&context);
 
+  // The layers of a tree do not change once it is built, so it only needs to
+  // be lowered once.
+  if (!paint_op_stream_built_) {
+    paint_op_stream_ = PaintOpStream::Make(root_layer_.get());
+    paint_op_stream_built_ = true;
+  }
+
   return context.surface_needs_readback;
 }
 
@@ -142,6 +154,8 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
       .enable_leaf_layer_tracing     = enable_leaf_layer_tracing_,
       .impeller_enabled              = !!frame.aiks_context(),
       .aiks_context                  = frame.aiks_context(),
+      .concurrent_recording_task_runner =
+          frame.context().concurrent_recording_task_runner(),
       // clang-format on
   };
 
@@ -150,11 +164,59 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
     TryToRasterCache(raster_cache_items_, &context, ignore_raster_cache);
   }
 
+  // Leaf layer tracing is implemented by |DisplayListLayer::Paint|.
+  if (paint_op_stream_ && !enable_leaf_layer_tracing_) {
+    paint_op_stream_->Paint(context);
+    return;
+  }
+
   if (root_layer_->needs_painting(context)) {
     root_layer_->Paint(context);
   }
 }
 
+size_t LayerTree::WarmUpRasterCache(CompositorContext& compositor_context,
+                                    GrDirectContext* gr_context,
+                                    impeller::AiksContext* aiks_context,
+                                    fml::TimePoint deadline) const {
+  TRACE_EVENT0("flutter", "LayerTree::WarmUpRasterCache");
+
+  LayerStateStack state_stack;
+  PaintContext context = {
+      // clang-format off
+      .state_stack                   = state_stack,
+      .canvas                        = nullptr,
+      .gr_context                    = gr_context,
+      // There is no frame canvas to take the color space from while idle; the
+      // surfaces that support the raster cache render in sRGB.
+      .dst_color_space               = SkColorSpace::MakeSRGB(),
+      .view_embedder                 = nullptr,
+      .raster_time                   = compositor_context.raster_time(),
+      .ui_time                       = compositor_context.ui_time(),
+      .texture_registry              = compositor_context.texture_registry(),
+      .raster_cache                  = &compositor_context.raster_cache(),
+      .impeller_enabled              = !!aiks_context,
+      .aiks_context                  = aiks_context,
+      // clang-format on
+  };
+
+  // Each entry is only started if the slowest entry so far would still
+  // finish before the deadline.
+  size_t count = 0;
+  fml::TimeDelta slowest = fml::TimeDelta::Zero();
+  for (auto* item : raster_cache_items_) {
+    fml::TimePoint start = fml::TimePoint::Now();
+    if (start + slowest >= deadline) {
+      break;
+    }
+    if (item->TryToWarmUpRasterCache(context)) {
+      count++;
+      slowest = std::max(slowest, fml::TimePoint::Now() - start);
+    }
+  }
+  return count;
+}
+
 sk_sp<DisplayList> LayerTree::Flatten(
     const SkRect& bounds,
     const std::shared_ptr<TextureRegistry>& texture_registry,
@@ -11,9 +11,11 @@
 #include "flutter/common/graphics/texture.h"
 #include "flutter/flow/compositor_context.h"
 #include "flutter/flow/layers/layer.h"
+#include "flutter/flow/layers/paint_op_stream.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
 
 class GrDirectContext;
 
@@ -49,6 +51,17 @@ class LayerTree {
   void Paint(CompositorContext::ScopedFrame& frame,
              bool ignore_raster_cache = false) const;
 
+  // Rasterizes the raster cache entries of the last preroll that are visible
+  // but have not yet reached the access threshold of the compositor context's
+  // raster cache. Stops before |deadline| if the next entry is not expected
+  // to finish in time.
+  //
+  // Returns the number of entries rasterized.
+  size_t WarmUpRasterCache(CompositorContext& compositor_context,
+                           GrDirectContext* gr_context,
+                           impeller::AiksContext* aiks_context,
+                           fml::TimePoint deadline) const;
+
   sk_sp<DisplayList> Flatten(
       const SkRect& bounds,
       const std::shared_ptr<TextureRegistry>& texture_registry = nullptr,
@@ -93,6 +106,11 @@ class LayerTree {
 
   std::vector<RasterCacheItem*> raster_cache_items_;
 
+  // The tree lowered into a flat stream of paint operations after its first
+  // preroll, or null if it contains layers that cannot be lowered.
+  std::unique_ptr<PaintOpStream> paint_op_stream_;
+  bool paint_op_stream_built_ = false;
+
   FML_DISALLOW_COPY_AND_ASSIGN(LayerTree);
 };
 
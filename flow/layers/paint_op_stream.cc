@@ -0,0 +1,148 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layers/paint_op_stream.h"
+
+#include "flutter/flow/layers/deferred_tile_rasterizer.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/layer.h"
+#include "flutter/flow/raster_cache_util.h"
+
+namespace flutter {
+
+std::unique_ptr<PaintOpStream> PaintOpStream::Make(const Layer* root) {
+  if (!root) {
+    return nullptr;
+  }
+  TRACE_EVENT0("flutter", "PaintOpStream::Make");
+  std::unique_ptr<PaintOpStream> stream(new PaintOpStream());
+  if (!stream->AddLayer(root)) {
+    return nullptr;
+  }
+  return stream;
+}
+
+bool PaintOpStream::AddLayer(const Layer* layer) {
+  size_t cull_index = ops_.size();
+  Op& cull = ops_.emplace_back();
+  cull.type = OpType::kCullLayer;
+  cull.layer = layer;
+  if (!layer->AddPaintOps(*this)) {
+    return false;
+  }
+  ops_[cull_index].skip_to = static_cast<uint32_t>(ops_.size());
+  return true;
+}
+
+void PaintOpStream::AddSave() {
+  ops_.emplace_back().type = OpType::kSave;
+}
+
+void PaintOpStream::AddRestore() {
+  ops_.emplace_back().type = OpType::kRestore;
+}
+
+void PaintOpStream::AddTransform(const SkM44& transform) {
+  Op& op = ops_.emplace_back();
+  op.type = OpType::kTransform;
+  op.transform = &transform;
+}
+
+void PaintOpStream::AddTranslate(const SkPoint& offset) {
+  Op& op = ops_.emplace_back();
+  op.type = OpType::kTranslate;
+  op.offset = &offset;
+}
+
+void PaintOpStream::AddClip(const SkRect& rect, bool is_aa) {
+  Op& op = ops_.emplace_back();
+  op.type = OpType::kClipRect;
+  op.is_aa = is_aa;
+  op.rect = &rect;
+}
+
+void PaintOpStream::AddClip(const SkRRect& rrect, bool is_aa) {
+  Op& op = ops_.emplace_back();
+  op.type = OpType::kClipRRect;
+  op.is_aa = is_aa;
+  op.rrect = &rrect;
+}
+
+void PaintOpStream::AddClip(const SkPath& path, bool is_aa) {
+  Op& op = ops_.emplace_back();
+  op.type = OpType::kClipPath;
+  op.is_aa = is_aa;
+  op.path = &path;
+}
+
+void PaintOpStream::AddDisplayList(const DisplayListLayer* layer) {
+  Op& op = ops_.emplace_back();
+  op.type = OpType::kDrawDisplayList;
+  op.display_list_layer = layer;
+}
+
+void PaintOpStream::Paint(PaintContext& context) const {
+  TRACE_EVENT0("flutter", "PaintOpStream::Paint");
+
+  DlCanvas* canvas = context.canvas;
+  const size_t op_count = ops_.size();
+  size_t i = 0;
+  while (i < op_count) {
+    const Op& op = ops_[i];
+    switch (op.type) {
+      case OpType::kCullLayer:
+        // Matches the paint culling of |Layer::needs_painting|. Layers that
+        // contain platform views are never added to a stream.
+        if (canvas->QuickReject(op.layer->paint_bounds())) {
+          i = op.skip_to;
+          continue;
+        }
+        break;
+      case OpType::kSave:
+        canvas->Save();
+        break;
+      case OpType::kRestore:
+        canvas->Restore();
+        break;
+      case OpType::kTransform:
+        canvas->Transform(*op.transform);
+        break;
+      case OpType::kTranslate:
+        canvas->Translate(op.offset->x(), op.offset->y());
+        break;
+      case OpType::kClipRect:
+        canvas->ClipRect(*op.rect, DlCanvas::ClipOp::kIntersect, op.is_aa);
+        break;
+      case OpType::kClipRRect:
+        canvas->ClipRRect(*op.rrect, DlCanvas::ClipOp::kIntersect, op.is_aa);
+        break;
+      case OpType::kClipPath:
+        canvas->ClipPath(*op.path, DlCanvas::ClipOp::kIntersect, op.is_aa);
+        break;
+      case OpType::kDrawDisplayList: {
+        const DisplayListLayer* layer = op.display_list_layer;
+        if (context.raster_cache) {
+          // Always apply the integral transform in the presence of a raster
+          // cache whether or not we successfully draw from the cache, as
+          // |DisplayListLayer::Paint| does.
+          canvas->SetTransform(RasterCacheUtil::GetIntegralTransCTM(
+              canvas->GetTransformFullPerspective()));
+          if (layer->raster_cache_item() &&
+              layer->raster_cache_item()->Draw(context, nullptr)) {
+            TRACE_EVENT_INSTANT0("flutter", "raster cache hit");
+            break;
+          }
+        }
+        sk_sp<DisplayList> display_list = sk_ref_sp(layer->display_list());
+        if (!DeferredTileRasterizer::Draw(display_list, 1.0f, context)) {
+          canvas->DrawDisplayList(display_list);
+        }
+        break;
+      }
+    }
+    i++;
+  }
+}
+
+}  // namespace flutter
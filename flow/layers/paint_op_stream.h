@@ -0,0 +1,102 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYERS_PAINT_OP_STREAM_H_
+#define FLUTTER_FLOW_LAYERS_PAINT_OP_STREAM_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkM44.h"
+#include "third_party/skia/include/core/SkPath.h"
+#include "third_party/skia/include/core/SkPoint.h"
+#include "third_party/skia/include/core/SkRRect.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+class DisplayListLayer;
+class Layer;
+struct PaintContext;
+
+/// A layer tree lowered into a flat array of canvas operations.
+///
+/// Painting a layer tree walks it through virtual calls and pushes and pops
+/// the |LayerStateStack| at every node. For trees made only of layers that
+/// save, transform, clip and draw display lists, the same output can be
+/// produced by a loop over a contiguous array of operations that are applied
+/// to the canvas directly.
+///
+/// The operations refer to the state of the layers they were built from, so
+/// a stream must not outlive its tree. The paint bounds of each layer are
+/// read when the stream is painted, so a stream remains valid across
+/// prerolls of the same tree.
+class PaintOpStream {
+ public:
+  /// Lowers the tree rooted at |root| into a stream, or returns null if any
+  /// layer in the tree does not support it. See |Layer::AddPaintOps|.
+  static std::unique_ptr<PaintOpStream> Make(const Layer* root);
+
+  /// Paints the stream to |context.canvas|, equivalent to painting the tree
+  /// it was built from with the same context.
+  void Paint(PaintContext& context) const;
+
+  size_t op_count() const { return ops_.size(); }
+
+  // Methods used by |Layer::AddPaintOps| to build the stream.
+
+  /// Adds the operations of |layer|, skipped when painting if the layer's
+  /// paint bounds are culled. Returns false if the layer does not support
+  /// being added to a stream.
+  bool AddLayer(const Layer* layer);
+  void AddSave();
+  void AddRestore();
+  void AddTransform(const SkM44& transform);
+  void AddTranslate(const SkPoint& offset);
+  void AddClip(const SkRect& rect, bool is_aa);
+  void AddClip(const SkRRect& rrect, bool is_aa);
+  void AddClip(const SkPath& path, bool is_aa);
+  void AddDisplayList(const DisplayListLayer* layer);
+
+ private:
+  enum class OpType : uint8_t {
+    kCullLayer,
+    kSave,
+    kRestore,
+    kTransform,
+    kTranslate,
+    kClipRect,
+    kClipRRect,
+    kClipPath,
+    kDrawDisplayList,
+  };
+
+  struct Op {
+    OpType type;
+    bool is_aa = false;
+    // For |kCullLayer|, the index of the first op after the layer's ops.
+    uint32_t skip_to = 0;
+    union {
+      const Layer* layer;
+      const SkM44* transform;
+      const SkPoint* offset;
+      const SkRect* rect;
+      const SkRRect* rrect;
+      const SkPath* path;
+      const DisplayListLayer* display_list_layer;
+    };
+  };
+
+  PaintOpStream() = default;
+
+  std::vector<Op> ops_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PaintOpStream);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYERS_PAINT_OP_STREAM_H_
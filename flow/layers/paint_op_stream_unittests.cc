@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layers/paint_op_stream.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/flow/layers/clip_rect_layer.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/opacity_layer.h"
+#include "flutter/flow/layers/transform_layer.h"
+#include "flutter/flow/testing/layer_test.h"
+#include "flutter/flow/testing/mock_layer.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+using PaintOpStreamTest = LayerTest;
+
+static std::shared_ptr<DisplayListLayer> MakeDisplayListLayer(
+    const SkPoint& offset,
+    const SkRect& rect,
+    DlColor color) {
+  DisplayListBuilder builder;
+  builder.DrawRect(rect, DlPaint(color));
+  return std::make_shared<DisplayListLayer>(offset, builder.Build(), false,
+                                            false);
+}
+
+TEST_F(PaintOpStreamTest, PaintsSameAsLayerTree) {
+  auto transform_layer =
+      std::make_shared<TransformLayer>(SkMatrix::Scale(2.0f, 2.0f));
+  auto clip_layer = std::make_shared<ClipRectLayer>(
+      SkRect::MakeLTRB(0.0f, 0.0f, 100.0f, 100.0f), Clip::kAntiAlias);
+  clip_layer->Add(MakeDisplayListLayer(SkPoint::Make(5.0f, 5.0f),
+                                       SkRect::MakeWH(20.0f, 20.0f),
+                                       DlColor::kGreen()));
+  clip_layer->Add(MakeDisplayListLayer(SkPoint::Make(60.0f, 10.0f),
+                                       SkRect::MakeWH(80.0f, 30.0f),
+                                       DlColor::kBlue()));
+  transform_layer->Add(clip_layer);
+  // Outside of the 500x500 canvas once scaled, so it is culled.
+  transform_layer->Add(MakeDisplayListLayer(SkPoint::Make(300.0f, 300.0f),
+                                            SkRect::MakeWH(10.0f, 10.0f),
+                                            DlColor::kRed()));
+
+  transform_layer->Preroll(preroll_context());
+  auto stream = PaintOpStream::Make(transform_layer.get());
+  ASSERT_NE(stream, nullptr);
+
+  stream->Paint(display_list_paint_context());
+  auto stream_display_list = display_list();
+  reset_display_list();
+  transform_layer->Paint(display_list_paint_context());
+
+  EXPECT_TRUE(DisplayListsEQ_Verbose(stream_display_list, display_list()));
+}
+
+TEST_F(PaintOpStreamTest, CulledRootPaintsNothing) {
+  auto layer = MakeDisplayListLayer(SkPoint::Make(1000.0f, 1000.0f),
+                                    SkRect::MakeWH(10.0f, 10.0f),
+                                    DlColor::kRed());
+  layer->Preroll(preroll_context());
+  auto stream = PaintOpStream::Make(layer.get());
+  ASSERT_NE(stream, nullptr);
+
+  stream->Paint(display_list_paint_context());
+  EXPECT_EQ(display_list()->op_count(), 0u);
+}
+
+TEST_F(PaintOpStreamTest, UnsupportedLayersAreNotLowered) {
+  auto transform_layer = std::make_shared<TransformLayer>(SkMatrix::I());
+  auto opacity_layer =
+      std::make_shared<OpacityLayer>(128, SkPoint::Make(0.0f, 0.0f));
+  opacity_layer->Add(MakeDisplayListLayer(SkPoint::Make(0.0f, 0.0f),
+                                          SkRect::MakeWH(10.0f, 10.0f),
+                                          DlColor::kGreen()));
+  transform_layer->Add(opacity_layer);
+  EXPECT_EQ(PaintOpStream::Make(transform_layer.get()), nullptr);
+
+  auto save_layer_clip = std::make_shared<ClipRectLayer>(
+      SkRect::MakeWH(10.0f, 10.0f), Clip::kAntiAliasWithSaveLayer);
+  EXPECT_EQ(PaintOpStream::Make(save_layer_clip.get()), nullptr);
+
+  auto mock_layer = std::make_shared<MockLayer>(SkPath());
+  EXPECT_EQ(PaintOpStream::Make(mock_layer.get()), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -24,6 +24,33 @@
 namespace flutter {
 namespace {
 
+SkFont MakeLabelFont(const std::string& font_path) {
+  SkFont font;
+  if (font_path != "") {
+    sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
+    font = SkFont(font_mgr->makeFromFile(font_path.c_str()));
+  }
+  font.setSize(15);
+  return font;
+}
+
+void DrawLabel(DlCanvas* canvas,
+               const bool impeller_enabled,
+               const sk_sp<SkTextBlob>& text,
+               SkScalar x,
+               SkScalar y) {
+  // Historically SK_ColorGRAY (== 0xFF888888) was used here
+  DlPaint paint(DlColor(0xFF888888));
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  if (impeller_enabled) {
+    canvas->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(text), x, y,
+                          paint);
+    return;
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+  canvas->DrawTextBlob(text, x, y, paint);
+}
+
 void VisualizeStopWatch(DlCanvas* canvas,
                         const bool impeller_enabled,
                         const Stopwatch& stopwatch,
@@ -54,16 +81,29 @@ void VisualizeStopWatch(DlCanvas* canvas,
   if (show_labels) {
     auto text = PerformanceOverlayLayer::MakeStatisticsText(
         stopwatch, label_prefix, font_path);
-    // Historically SK_ColorGRAY (== 0xFF888888) was used here
-    DlPaint paint(DlColor(0xFF888888));
-#ifdef IMPELLER_SUPPORTS_RENDERING
-    if (impeller_enabled) {
-      canvas->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(text),
-                            x + label_x, y + height + label_y, paint);
-      return;
+    DrawLabel(canvas, impeller_enabled, text, x + label_x,
+              y + height + label_y);
+  }
+}
+
+// Lists the hit rates of the caches that have been looked up, one per line
+// from the top of the overlay.
+void DrawCacheStatistics(DlCanvas* canvas,
+                         const bool impeller_enabled,
+                         SkScalar x,
+                         SkScalar y,
+                         const std::string& font_path) {
+  const int label_x = 8;
+  const int line_height = 18;
+  SkScalar line_y = y;
+  for (const auto& cache : fml::CacheStatistics::Dump()) {
+    if (cache.hits + cache.misses == 0u) {
+      continue;
     }
-#endif  // IMPELLER_SUPPORTS_RENDERING
-    canvas->DrawTextBlob(text, x + label_x, y + height + label_y, paint);
+    line_y += line_height;
+    auto text =
+        PerformanceOverlayLayer::MakeCacheStatisticsText(cache, font_path);
+    DrawLabel(canvas, impeller_enabled, text, x + label_x, line_y);
   }
 }
 
@@ -73,12 +113,7 @@ sk_sp<SkTextBlob> PerformanceOverlayLayer::MakeStatisticsText(
     const Stopwatch& stopwatch,
     const std::string& label_prefix,
     const std::string& font_path) {
-  SkFont font;
-  if (font_path != "") {
-    sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
-    font = SkFont(font_mgr->makeFromFile(font_path.c_str()));
-  }
-  font.setSize(15);
+  SkFont font = MakeLabelFont(font_path);
 
   double max_ms_per_frame = stopwatch.MaxDelta().ToMillisecondsF();
   double average_ms_per_frame = stopwatch.AverageDelta().ToMillisecondsF();
@@ -93,6 +128,21 @@ sk_sp<SkTextBlob> PerformanceOverlayLayer::MakeStatisticsText(
                                   SkTextEncoding::kUTF8);
 }
 
+sk_sp<SkTextBlob> PerformanceOverlayLayer::MakeCacheStatisticsText(
+    const fml::CacheStatistics::Snapshot& cache,
+    const std::string& font_path) {
+  SkFont font = MakeLabelFont(font_path);
+
+  std::stringstream stream;
+  stream.setf(std::ios::fixed | std::ios::showpoint);
+  stream << std::setprecision(1);
+  stream << cache.name << "  " << cache.GetHitRate() * 100 << "% hits, "
+         << cache.evictions << " evictions";
+  auto text = stream.str();
+  return SkTextBlob::MakeFromText(text.c_str(), text.size(), font,
+                                  SkTextEncoding::kUTF8);
+}
+
 PerformanceOverlayLayer::PerformanceOverlayLayer(uint64_t options,
                                                  const char* font_path)
     : options_(options) {
@@ -135,6 +185,11 @@ void PerformanceOverlayLayer::Paint(PaintContext& context) const {
                      x, y + height, width, height - padding,
                      options_ & kVisualizeEngineStatistics,
                      options_ & kDisplayEngineStatistics, "UI", font_path_);
+
+  if (options_ & kDisplayCacheStatistics) {
+    DrawCacheStatistics(context.canvas, context.impeller_enabled, x, y,
+                        font_path_);
+  }
 }
 
 }  // namespace flutter
@@ -9,6 +9,7 @@
 
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/stopwatch.h"
+#include "flutter/fml/cache_statistics.h"
 #include "flutter/fml/macros.h"
 
 class SkTextBlob;
@@ -19,6 +20,7 @@ const int kDisplayRasterizerStatistics = 1 << 0;
 const int kVisualizeRasterizerStatistics = 1 << 1;
 const int kDisplayEngineStatistics = 1 << 2;
 const int kVisualizeEngineStatistics = 1 << 3;
+const int kDisplayCacheStatistics = 1 << 4;
 
 class PerformanceOverlayLayer : public Layer {
  public:
@@ -26,6 +28,10 @@ class PerformanceOverlayLayer : public Layer {
                                               const std::string& label_prefix,
                                               const std::string& font_path);
 
+  static sk_sp<SkTextBlob> MakeCacheStatisticsText(
+      const fml::CacheStatistics::Snapshot& cache,
+      const std::string& font_path);
+
   bool IsReplacing(DiffContext* context, const Layer* layer) const override {
     return layer->as_performance_overlay_layer() != nullptr;
   }
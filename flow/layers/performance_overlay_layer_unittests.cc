@@ -195,6 +195,39 @@ TEST_F(PerformanceOverlayLayerTest, SimpleRasterizerStatistics) {
                                             text_position}}}));
 }
 
+TEST_F(PerformanceOverlayLayerTest, CacheStatistics) {
+  const SkRect layer_bounds = SkRect::MakeLTRB(0.0f, 0.0f, 64.0f, 64.0f);
+  const uint64_t overlay_opts = kDisplayCacheStatistics;
+  auto layer = std::make_shared<PerformanceOverlayLayer>(overlay_opts);
+  layer->set_paint_bounds(layer_bounds);
+  layer->Preroll(preroll_context());
+
+  // Only the caches that have been looked up are listed.
+  fml::CacheStatistics::Reset();
+  auto& counters =
+      fml::CacheStatistics::GetCounters("PerformanceOverlayLayerTest");
+  counters.RecordHit(3u);
+  counters.RecordMiss();
+  fml::CacheStatistics::GetCounters("PerformanceOverlayLayerTestUnused");
+
+  layer->Paint(paint_context());
+  fml::CacheStatistics::Snapshot cache = {
+      .name = "PerformanceOverlayLayerTest", .hits = 3u, .misses = 1u};
+  auto overlay_text =
+      PerformanceOverlayLayer::MakeCacheStatisticsText(cache, "");
+  auto overlay_text_data = overlay_text->serialize(SkSerialProcs{});
+  DlPaint text_paint(DlColor(0xFF888888));
+  SkPoint text_position = SkPoint::Make(16.0f, 26.0f);
+
+#if defined(OS_FUCHSIA)
+  GTEST_SKIP() << "Expectation requires a valid default font manager";
+#endif  // OS_FUCHSIA
+  EXPECT_EQ(mock_canvas().draw_calls(),
+            std::vector({MockCanvas::DrawCall{
+                0, MockCanvas::DrawTextData{overlay_text_data, text_paint,
+                                            text_position}}}));
+}
+
 TEST_F(PerformanceOverlayLayerTest, MarkAsDirtyWhenResized) {
   // Regression test for https://github.com/flutter/flutter/issues/54188
 
@@ -19,6 +19,8 @@ class PlatformViewLayer : public Layer {
   void Preroll(PrerollContext* context) override;
   void Paint(PaintContext& context) const override;
 
+  bool CanPrerollConcurrently() const override { return false; }
+
  private:
   SkPoint offset_;
   SkSize size_;
@@ -21,13 +21,28 @@ TextureLayer::TextureLayer(const SkPoint& offset,
 
 void TextureLayer::Diff(DiffContext* context, const Layer* old_layer) {
   DiffContext::AutoSubtreeRestore subtree(context);
+  std::shared_ptr<Texture> texture =
+      context->texture_registry()
+          ? context->texture_registry()->GetTexture(texture_id_)
+          : nullptr;
   if (!context->IsSubtreeDirty()) {
     FML_DCHECK(old_layer);
     auto prev = old_layer->as_texture_layer();
-    // TODO(knopp) It would be nice to be able to determine that a texture is
-    // dirty
-    context->MarkSubtreeDirty(context->GetOldLayerPaintRegion(prev));
+    // The texture only needs to be repainted if it has a new frame since the
+    // previous layer tree, or if it is painted differently. When this layer
+    // is retained, |prev| is this layer and reports last frame's texture.
+    bool unchanged = texture && prev->offset_ == offset_ &&
+                     prev->size_ == size_ && prev->freeze_ == freeze_ &&
+                     prev->sampling_ == sampling_ &&
+                     prev->diffed_texture_.lock() == texture &&
+                     prev->diffed_frame_generation_ ==
+                         texture->frame_generation();
+    if (!unchanged) {
+      context->MarkSubtreeDirty(context->GetOldLayerPaintRegion(prev));
+    }
   }
+  diffed_texture_ = texture;
+  diffed_frame_generation_ = texture ? texture->frame_generation() : 0;
 
   // Make sure DiffContext knows there is a TextureLayer in this subtree.
   // This prevents ContainerLayer from skipping TextureLayer diffing when
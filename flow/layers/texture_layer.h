@@ -37,6 +37,12 @@ class TextureLayer : public Layer {
   bool freeze_;
   DlImageSampling sampling_;
 
+  // The texture and its frame generation when this layer was last diffed,
+  // compared by the diff of the next layer tree to tell whether the texture
+  // has a new frame to paint.
+  std::weak_ptr<Texture> diffed_texture_;
+  uint64_t diffed_frame_generation_ = 0;
+
   FML_DISALLOW_COPY_AND_ASSIGN(TextureLayer);
 };
 
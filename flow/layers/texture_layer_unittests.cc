@@ -117,6 +117,38 @@ TEST_F(TextureLayerDiffTest, TextureInRetainedLayer) {
   EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 100, 100));
 }
 
+TEST_F(TextureLayerDiffTest, TextureWithoutNewFrameIsNotRepainted) {
+  const int64_t texture_id = 1;
+  auto mock_texture = std::make_shared<MockTexture>(texture_id);
+  texture_registry()->RegisterTexture(mock_texture);
+  auto make_layer = [&](const SkPoint& offset) {
+    return std::make_shared<TextureLayer>(offset, SkSize::Make(100, 100),
+                                          texture_id, false,
+                                          DlImageSampling::kLinear);
+  };
+
+  MockLayerTree tree1;
+  tree1.root()->Add(make_layer(SkPoint::Make(0, 0)));
+  auto damage = DiffLayerTree(tree1, MockLayerTree());
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 100, 100));
+
+  MockLayerTree tree2;
+  tree2.root()->Add(make_layer(SkPoint::Make(0, 0)));
+  damage = DiffLayerTree(tree2, tree1);
+  EXPECT_TRUE(damage.frame_damage.isEmpty());
+
+  mock_texture->IncrementFrameGeneration();
+  MockLayerTree tree3;
+  tree3.root()->Add(make_layer(SkPoint::Make(0, 0)));
+  damage = DiffLayerTree(tree3, tree2);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 100, 100));
+
+  MockLayerTree tree4;
+  tree4.root()->Add(make_layer(SkPoint::Make(50, 0)));
+  damage = DiffLayerTree(tree4, tree3);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 150, 100));
+}
+
 TEST_F(TextureLayerTest, OpacityInheritance) {
   const SkPoint layer_offset = SkPoint::Make(0.0f, 0.0f);
   const SkSize layer_size = SkSize::Make(8.0f, 8.0f);
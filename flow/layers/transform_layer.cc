@@ -6,6 +6,8 @@
 
 #include <optional>
 
+#include "flutter/flow/layers/paint_op_stream.h"
+
 namespace flutter {
 
 TransformLayer::TransformLayer(const SkM44& transform) : transform_(transform) {
@@ -65,6 +67,16 @@ void TransformLayer::Preroll(PrerollContext* context) {
   set_paint_bounds(child_paint_bounds);
 }
 
+bool TransformLayer::AddPaintOps(PaintOpStream& stream) const {
+  stream.AddSave();
+  stream.AddTransform(transform_);
+  if (!ContainerLayer::AddPaintOps(stream)) {
+    return false;
+  }
+  stream.AddRestore();
+  return true;
+}
+
 void TransformLayer::Paint(PaintContext& context) const {
   FML_DCHECK(needs_painting(context));
 
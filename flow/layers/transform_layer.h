@@ -23,6 +23,8 @@ class TransformLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  bool AddPaintOps(PaintOpStream& stream) const override;
+
  private:
   SkM44 transform_;
 
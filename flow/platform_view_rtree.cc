@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/platform_view_rtree.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace flutter {
+
+PlatformViewRTree::PlatformViewRTree(const std::vector<SkRect>& view_rects) {
+  // Regions are intersected with the rounded out rects of the views, so the
+  // views are indexed by those to not miss drawing that only overlaps the
+  // pixels that a view partially covers.
+  view_rects_.reserve(view_rects.size());
+  std::vector<SkRect> rects;
+  std::vector<int> ids;
+  rects.reserve(view_rects.size());
+  ids.reserve(view_rects.size());
+  for (size_t i = 0; i < view_rects.size(); i++) {
+    view_rects_.push_back(view_rects[i].roundOut());
+    rects.push_back(SkRect::Make(view_rects_.back()));
+    ids.push_back(static_cast<int>(i));
+  }
+  rtree_ = sk_make_sp<DlRTree>(rects.data(), static_cast<int>(rects.size()),
+                               ids.data());
+}
+
+std::vector<PlatformViewRTree::Overlap> PlatformViewRTree::Search(
+    const DlRegion& drawn_region,
+    size_t view_count) const {
+  std::vector<Overlap> overlaps;
+  if (drawn_region.isEmpty()) {
+    return overlaps;
+  }
+
+  std::vector<int> results;
+  rtree_->search(SkRect::Make(drawn_region.bounds()), &results);
+  std::vector<size_t> view_indices;
+  view_indices.reserve(results.size());
+  for (int result : results) {
+    size_t view_index = static_cast<size_t>(rtree_->id(result));
+    if (view_index < view_count &&
+        drawn_region.intersects(view_rects_[view_index])) {
+      view_indices.push_back(view_index);
+    }
+  }
+  std::sort(view_indices.begin(), view_indices.end(), std::greater<>());
+
+  overlaps.reserve(view_indices.size());
+  for (size_t view_index : view_indices) {
+    overlaps.push_back(
+        {view_index, DlRegion::MakeIntersection(
+                         drawn_region, DlRegion(view_rects_[view_index]))});
+  }
+  return overlaps;
+}
+
+}  // namespace flutter
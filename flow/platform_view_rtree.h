@@ -0,0 +1,52 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_PLATFORM_VIEW_RTREE_H_
+#define FLUTTER_FLOW_PLATFORM_VIEW_RTREE_H_
+
+#include <vector>
+
+#include "flutter/display_list/geometry/dl_region.h"
+#include "flutter/display_list/geometry/dl_rtree.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+// A spatial index of the platform views of a frame, which external view
+// embedders use to find the platform views that the Flutter content drawn
+// above them overlaps.
+//
+// Embedders record the content stacked after each platform view into an
+// |EmbedderViewSlice|. Rather than intersecting the drawn region of every
+// slice with every platform view below it, the views are indexed once per
+// frame in a |DlRTree| so that each slice only needs to be intersected with
+// the views that its region actually overlaps.
+class PlatformViewRTree {
+ public:
+  // The part of a drawn region that overlaps a platform view.
+  struct Overlap {
+    // The index of the platform view in the rects the tree was built from.
+    size_t view_index;
+    // The drawn region clipped to the rounded out rect of the view.
+    DlRegion region;
+  };
+
+  // Indexes the device space rects of the platform views of a frame, in the
+  // order in which they are composited.
+  explicit PlatformViewRTree(const std::vector<SkRect>& view_rects);
+
+  // Returns the overlaps of |drawn_region| with the first |view_count|
+  // platform views that it has any pixels in common with, in descending
+  // order of their view index.
+  std::vector<Overlap> Search(const DlRegion& drawn_region,
+                              size_t view_count) const;
+
+ private:
+  std::vector<SkIRect> view_rects_;
+  sk_sp<DlRTree> rtree_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_PLATFORM_VIEW_RTREE_H_
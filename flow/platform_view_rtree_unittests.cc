@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/platform_view_rtree.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(PlatformViewRTree, EmptyRegionOverlapsNothing) {
+  PlatformViewRTree rtree({SkRect::MakeLTRB(0, 0, 100, 100)});
+  EXPECT_TRUE(rtree.Search(DlRegion(), 1).empty());
+}
+
+TEST(PlatformViewRTree, FindsOverlappedViewsInDescendingOrder) {
+  PlatformViewRTree rtree({
+      SkRect::MakeLTRB(0, 0, 100, 100),
+      SkRect::MakeLTRB(200, 0, 300, 100),
+      SkRect::MakeLTRB(50, 50, 150, 150),
+  });
+  DlRegion drawn({SkIRect::MakeLTRB(60, 60, 80, 80),
+                  SkIRect::MakeLTRB(250, 90, 260, 120)});
+
+  std::vector<PlatformViewRTree::Overlap> overlaps = rtree.Search(drawn, 3);
+  ASSERT_EQ(overlaps.size(), 3u);
+  EXPECT_EQ(overlaps[0].view_index, 2u);
+  EXPECT_EQ(overlaps[0].region.bounds(), SkIRect::MakeLTRB(60, 60, 80, 80));
+  EXPECT_EQ(overlaps[1].view_index, 1u);
+  EXPECT_EQ(overlaps[1].region.bounds(),
+            SkIRect::MakeLTRB(250, 90, 260, 100));
+  EXPECT_EQ(overlaps[2].view_index, 0u);
+  EXPECT_EQ(overlaps[2].region.bounds(), SkIRect::MakeLTRB(60, 60, 80, 80));
+}
+
+TEST(PlatformViewRTree, OnlySearchesTheFirstViews) {
+  PlatformViewRTree rtree({
+      SkRect::MakeLTRB(0, 0, 100, 100),
+      SkRect::MakeLTRB(0, 0, 100, 100),
+  });
+  DlRegion drawn(SkIRect::MakeLTRB(10, 10, 20, 20));
+
+  std::vector<PlatformViewRTree::Overlap> overlaps = rtree.Search(drawn, 1);
+  ASSERT_EQ(overlaps.size(), 1u);
+  EXPECT_EQ(overlaps[0].view_index, 0u);
+}
+
+TEST(PlatformViewRTree, RegionThatOnlyFillsTheBoundsDoesNotOverlap) {
+  PlatformViewRTree rtree({SkRect::MakeLTRB(40, 40, 60, 60)});
+  // The bounds of the region cover the view, but none of its rects do.
+  DlRegion drawn({SkIRect::MakeLTRB(0, 0, 10, 10),
+                  SkIRect::MakeLTRB(90, 90, 100, 100)});
+  EXPECT_TRUE(rtree.Search(drawn, 1).empty());
+}
+
+TEST(PlatformViewRTree, ViewsArePaddedToWholePixels) {
+  PlatformViewRTree rtree({SkRect::MakeLTRB(10.5, 10.5, 20.5, 20.5)});
+  DlRegion drawn(SkIRect::MakeLTRB(20, 20, 30, 30));
+
+  std::vector<PlatformViewRTree::Overlap> overlaps = rtree.Search(drawn, 1);
+  ASSERT_EQ(overlaps.size(), 1u);
+  EXPECT_EQ(overlaps[0].region.bounds(), SkIRect::MakeLTRB(20, 20, 21, 21));
+}
+
+}  // namespace testing
+}  // namespace flutter
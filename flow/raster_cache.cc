@@ -4,15 +4,19 @@
 
 #include "flutter/flow/raster_cache.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <vector>
 
 #include "flutter/common/constants.h"
+#include "flutter/display_list/dl_builder.h"
 #include "flutter/display_list/skia/dl_sk_dispatcher.h"
 #include "flutter/flow/layers/container_layer.h"
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/paint_utils.h"
 #include "flutter/flow/raster_cache_util.h"
+#include "flutter/fml/cache_statistics.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
@@ -21,9 +25,24 @@
 #include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 #include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
+#ifdef IMPELLER_SUPPORTS_RENDERING
+#include "impeller/aiks/aiks_context.h"               // nogncheck
+#include "impeller/display_list/dl_dispatcher.h"      // nogncheck
+#include "impeller/display_list/dl_image_impeller.h"  // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 
 namespace flutter {
 
+namespace {
+
+fml::CacheStatistics::Counters& GetRasterCacheStatistics() {
+  static fml::CacheStatistics::Counters& counters =
+      fml::CacheStatistics::GetCounters("RasterCache");
+  return counters;
+}
+
+}  // namespace
+
 RasterCacheResult::RasterCacheResult(sk_sp<DlImage> image,
                                      const SkRect& logical_rect,
                                      const char* type,
@@ -84,6 +103,13 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
   SkRect dest_rect =
       RasterCacheUtil::GetRoundedOutDeviceBounds(context.logical_rect, matrix);
 
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  if (context.aiks_context) {
+    return RasterizeImpeller(context, dest_rect, matrix, std::move(rtree),
+                             draw_function, draw_checkerboard);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
   const SkImageInfo image_info = SkImageInfo::MakeN32Premul(
       dest_rect.width(), dest_rect.height(), context.dst_color_space);
 
@@ -113,6 +139,46 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
       image, context.logical_rect, context.flow_type, std::move(rtree));
 }
 
+#ifdef IMPELLER_SUPPORTS_RENDERING
+std::unique_ptr<RasterCacheResult> RasterCache::RasterizeImpeller(
+    const RasterCache::Context& context,
+    const SkRect& dest_rect,
+    const SkMatrix& matrix,
+    sk_sp<const DlRTree> rtree,
+    const std::function<void(DlCanvas*)>& draw_function,
+    const std::function<void(DlCanvas*, const SkRect& rect)>& draw_checkerboard)
+    const {
+  if (dest_rect.isEmpty()) {
+    return nullptr;
+  }
+
+  DisplayListBuilder builder(
+      SkRect::MakeWH(dest_rect.width(), dest_rect.height()));
+  builder.Translate(-dest_rect.left(), -dest_rect.top());
+  builder.Transform(matrix);
+  draw_function(&builder);
+
+  if (checkerboard_images_) {
+    draw_checkerboard(&builder, context.logical_rect);
+  }
+
+  impeller::DlDispatcher dispatcher;
+  builder.Build()->Dispatch(dispatcher);
+  impeller::Picture picture = dispatcher.EndRecordingAsPicture();
+  std::shared_ptr<impeller::Image> image = picture.ToImage(
+      *context.aiks_context,
+      impeller::ISize(dest_rect.width(), dest_rect.height()));
+  if (!image) {
+    return nullptr;
+  }
+
+  return std::make_unique<RasterCacheResult>(
+      impeller::DlImageImpeller::Make(image->GetTexture(),
+                                      DlImage::OwningContext::kRaster),
+      context.logical_rect, context.flow_type, std::move(rtree));
+}
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 bool RasterCache::UpdateCacheEntry(
     const RasterCacheKeyID& id,
     const Context& raster_cache_context,
@@ -120,7 +186,17 @@ bool RasterCache::UpdateCacheEntry(
     sk_sp<const DlRTree> rtree) const {
   RasterCacheKey key = RasterCacheKey(id, raster_cache_context.matrix);
   Entry& entry = cache_[key];
+  entry.replay_cost = raster_cache_context.replay_cost;
   if (!entry.image) {
+    SkRect dest_rect = RasterCacheUtil::GetRoundedOutDeviceBounds(
+        raster_cache_context.logical_rect,
+        RasterCacheUtil::GetIntegralTransCTM(raster_cache_context.matrix));
+    // 4 bytes per pixel, matching the N32 images produced by |Rasterize|.
+    size_t estimated_bytes = static_cast<size_t>(dest_rect.width()) *
+                             static_cast<size_t>(dest_rect.height()) * 4;
+    if (!MakeRoomForEntry(key.kind(), estimated_bytes, entry.replay_cost)) {
+      return false;
+    }
     void (*func)(DlCanvas*, const SkRect& rect) = DrawCheckerboard;
     entry.image = Rasterize(raster_cache_context, std::move(rtree),
                             render_function, func);
@@ -139,9 +215,75 @@ bool RasterCache::UpdateCacheEntry(
   return entry.image != nullptr;
 }
 
+// The replay work an entry saves per byte of cache it occupies. Entries with
+// no recorded cost still rank by their size.
+static double ReplayDensity(unsigned int cost, size_t size) {
+  return (static_cast<double>(cost) + 1.0) /
+         static_cast<double>(std::max<size_t>(size, 1u));
+}
+
+bool RasterCache::MakeRoomForEntry(RasterCacheKeyKind kind,
+                                   size_t bytes,
+                                   unsigned int replay_cost) const {
+  const size_t max_bytes = GetMaxBytes(kind);
+  if (max_bytes == std::numeric_limits<size_t>::max()) {
+    return true;
+  }
+  if (bytes > max_bytes) {
+    return false;
+  }
+
+  std::vector<RasterCacheKey::Map<Entry>::iterator> candidates;
+  size_t used_bytes = 0;
+  for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+    if (it->first.kind() == kind && it->second.image) {
+      candidates.push_back(it);
+      used_bytes += it->second.image->image_bytes();
+    }
+  }
+  if (used_bytes + bytes <= max_bytes) {
+    return true;
+  }
+
+  const double new_density = ReplayDensity(replay_cost, bytes);
+  auto density = [](auto it) {
+    const Entry& entry = it->second;
+    return ReplayDensity(entry.replay_cost, entry.image->image_bytes());
+  };
+  std::sort(candidates.begin(), candidates.end(),
+            [&](auto a, auto b) { return density(a) < density(b); });
+
+  size_t reclaimed_bytes = 0;
+  size_t victim_count = 0;
+  for (auto it : candidates) {
+    if (used_bytes - reclaimed_bytes + bytes <= max_bytes) {
+      break;
+    }
+    if (density(it) >= new_density) {
+      return false;
+    }
+    reclaimed_bytes += it->second.image->image_bytes();
+    victim_count++;
+  }
+  if (used_bytes - reclaimed_bytes + bytes > max_bytes) {
+    return false;
+  }
+
+  RasterCacheMetrics& metrics = GetMetricsForKind(kind);
+  GetRasterCacheStatistics().RecordEviction(victim_count);
+  for (size_t i = 0; i < victim_count; i++) {
+    Entry& victim = candidates[i]->second;
+    metrics.eviction_count++;
+    metrics.eviction_bytes += victim.image->image_bytes();
+    victim.image.reset();
+  }
+  return true;
+}
+
 RasterCache::CacheInfo RasterCache::MarkSeen(const RasterCacheKeyID& id,
                                              const SkMatrix& matrix,
                                              bool visible) const {
+  std::scoped_lock lock(preroll_mutex_);
   RasterCacheKey key = RasterCacheKey(id, matrix);
   Entry& entry = cache_[key];
   entry.encountered_this_frame = true;
@@ -154,6 +296,7 @@ RasterCache::CacheInfo RasterCache::MarkSeen(const RasterCacheKeyID& id,
 
 int RasterCache::GetAccessCount(const RasterCacheKeyID& id,
                                 const SkMatrix& matrix) const {
+  std::scoped_lock lock(preroll_mutex_);
   RasterCacheKey key = RasterCacheKey(id, matrix);
   auto entry = cache_.find(key);
   if (entry != cache_.cend()) {
@@ -164,6 +307,7 @@ int RasterCache::GetAccessCount(const RasterCacheKeyID& id,
 
 bool RasterCache::HasEntry(const RasterCacheKeyID& id,
                            const SkMatrix& matrix) const {
+  std::scoped_lock lock(preroll_mutex_);
   RasterCacheKey key = RasterCacheKey(id, matrix);
   if (cache_.find(key) != cache_.cend()) {
     return true;
@@ -177,6 +321,7 @@ bool RasterCache::Draw(const RasterCacheKeyID& id,
                        bool preserve_rtree) const {
   auto it = cache_.find(RasterCacheKey(id, canvas.GetTransform()));
   if (it == cache_.end()) {
+    GetRasterCacheStatistics().RecordMiss();
     return false;
   }
 
@@ -184,9 +329,11 @@ bool RasterCache::Draw(const RasterCacheKeyID& id,
 
   if (entry.image) {
     entry.image->draw(canvas, paint, preserve_rtree);
+    GetRasterCacheStatistics().RecordHit();
     return true;
   }
 
+  GetRasterCacheStatistics().RecordMiss();
   return false;
 }
 
@@ -221,6 +368,7 @@ void RasterCache::EvictUnusedCacheEntries() {
 
   for (auto it : dead) {
     if (it->second.image) {
+      GetRasterCacheStatistics().RecordEviction();
       RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
       metrics.eviction_count++;
       metrics.eviction_bytes += it->second.image->image_bytes();
@@ -240,6 +388,35 @@ void RasterCache::Clear() {
   layer_metrics_ = {};
 }
 
+size_t RasterCache::Trim(size_t bytes) {
+  std::vector<RasterCacheKey::Map<Entry>::iterator> candidates;
+  for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+    if (it->second.image) {
+      candidates.push_back(it);
+    }
+  }
+  auto density = [](auto it) {
+    const Entry& entry = it->second;
+    return ReplayDensity(entry.replay_cost, entry.image->image_bytes());
+  };
+  std::sort(candidates.begin(), candidates.end(),
+            [&](auto a, auto b) { return density(a) < density(b); });
+
+  size_t trimmed_bytes = 0;
+  for (auto it : candidates) {
+    if (trimmed_bytes >= bytes) {
+      break;
+    }
+    RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
+    size_t image_bytes = it->second.image->image_bytes();
+    metrics.eviction_count++;
+    metrics.eviction_bytes += image_bytes;
+    trimmed_bytes += image_bytes;
+    it->second.image.reset();
+  }
+  return trimmed_bytes;
+}
+
 size_t RasterCache::GetCachedEntriesCount() const {
   return cache_.size();
 }
@@ -311,7 +488,28 @@ size_t RasterCache::EstimatePictureCacheByteSize() const {
   return picture_cache_bytes;
 }
 
-RasterCacheMetrics& RasterCache::GetMetricsForKind(RasterCacheKeyKind kind) {
+void RasterCache::SetMaxBytes(RasterCacheKeyKind kind, size_t max_bytes) {
+  switch (kind) {
+    case RasterCacheKeyKind::kDisplayListMetrics:
+      display_list_max_bytes_ = max_bytes;
+      break;
+    case RasterCacheKeyKind::kLayerMetrics:
+      layer_max_bytes_ = max_bytes;
+      break;
+  }
+}
+
+size_t RasterCache::GetMaxBytes(RasterCacheKeyKind kind) const {
+  switch (kind) {
+    case RasterCacheKeyKind::kDisplayListMetrics:
+      return display_list_max_bytes_;
+    case RasterCacheKeyKind::kLayerMetrics:
+      return layer_max_bytes_;
+  }
+}
+
+RasterCacheMetrics& RasterCache::GetMetricsForKind(
+    RasterCacheKeyKind kind) const {
   switch (kind) {
     case RasterCacheKeyKind::kDisplayListMetrics:
       return picture_metrics_;
@@ -5,7 +5,9 @@
 #ifndef FLUTTER_FLOW_RASTER_CACHE_H_
 #define FLUTTER_FLOW_RASTER_CACHE_H_
 
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "flutter/display_list/dl_canvas.h"
@@ -20,6 +22,10 @@
 class GrDirectContext;
 class SkColorSpace;
 
+namespace impeller {
+class AiksContext;
+}  // namespace impeller
+
 namespace flutter {
 
 enum class RasterCacheLayerStrategy { kLayer, kLayerChildren };
@@ -121,6 +127,13 @@ class RasterCache {
     const SkMatrix& matrix;
     const SkRect& logical_rect;
     const char* flow_type;
+    // When set, entries are rendered with Impeller into textures owned by
+    // this context instead of into Skia surfaces.
+    impeller::AiksContext* aiks_context = nullptr;
+    // An estimate of the work saved each time the cached image is drawn
+    // instead of replaying its contents, used to choose which entries to
+    // evict when a kind exceeds its byte budget.
+    unsigned int replay_cost = 0;
   };
   struct CacheInfo {
     const size_t accesses_since_visible;
@@ -166,6 +179,15 @@ class RasterCache {
 
   void Clear();
 
+  /**
+   * @brief Evict cached images, starting with those that save the least
+   * replay work per byte, until at least |bytes| have been freed or the cache
+   * holds no images.
+   *
+   * @return The bytes of the evicted images.
+   */
+  size_t Trim(size_t bytes);
+
   void SetCheckboardCacheImages(bool checkerboard);
 
   const RasterCacheMetrics& picture_metrics() const { return picture_metrics_; }
@@ -205,6 +227,18 @@ class RasterCache {
    */
   size_t EstimateLayerCacheByteSize() const;
 
+  /**
+   * @brief Limit the bytes used by the cached images of the given kind.
+   *
+   * When a new entry would take the cached images of its kind over this
+   * budget, entries of the same kind that save less replay work per byte are
+   * evicted to make room for it. If that is not enough, the new entry is not
+   * rasterized. Budgets are unlimited by default.
+   */
+  void SetMaxBytes(RasterCacheKeyKind kind, size_t max_bytes);
+
+  size_t GetMaxBytes(RasterCacheKeyKind kind) const;
+
   /**
    * @brief Return the number of frames that a picture must be prepared
    * before it will be cached. If the number is 0, then no picture will
@@ -230,6 +264,9 @@ class RasterCache {
    * increased if it is visible, or if it was ever visible.
    * @return the number of times the entry has been hit since it was created.
    * For a new entry that will be 1 if it is visible, or zero if non-visible.
+   *
+   * This may be called from several threads at once when the children of a
+   * container are prerolled concurrently.
    */
   CacheInfo MarkSeen(const RasterCacheKeyID& id,
                      const SkMatrix& matrix,
@@ -251,19 +288,44 @@ class RasterCache {
     bool encountered_this_frame = false;
     bool visible_this_frame = false;
     size_t accesses_since_visible = 0;
+    unsigned int replay_cost = 0;
     std::unique_ptr<RasterCacheResult> image;
   };
 
   void UpdateMetrics();
 
-  RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind);
+  // Evicts the cached images of |kind| that save less replay work per byte
+  // than a new entry of |bytes| with |replay_cost| until the new entry fits
+  // within the budget of |kind|. Returns false, evicting nothing, if it
+  // cannot be made to fit.
+  bool MakeRoomForEntry(RasterCacheKeyKind kind,
+                        size_t bytes,
+                        unsigned int replay_cost) const;
+
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  std::unique_ptr<RasterCacheResult> RasterizeImpeller(
+      const RasterCache::Context& context,
+      const SkRect& dest_rect,
+      const SkMatrix& matrix,
+      sk_sp<const DlRTree> rtree,
+      const std::function<void(DlCanvas*)>& draw_function,
+      const std::function<void(DlCanvas*, const SkRect& rect)>&
+          draw_checkerboard) const;
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind) const;
 
   const size_t access_threshold_;
   const size_t display_list_cache_limit_per_frame_;
   mutable size_t display_list_cached_this_frame_ = 0;
-  RasterCacheMetrics layer_metrics_;
-  RasterCacheMetrics picture_metrics_;
+  mutable RasterCacheMetrics layer_metrics_;
+  mutable RasterCacheMetrics picture_metrics_;
   mutable RasterCacheKey::Map<Entry> cache_;
+  // Guards |cache_| for the lookups that may be made from several threads
+  // when a layer tree is prerolled concurrently, see |MarkSeen|.
+  mutable std::mutex preroll_mutex_;
+  size_t layer_max_bytes_ = std::numeric_limits<size_t>::max();
+  size_t display_list_max_bytes_ = std::numeric_limits<size_t>::max();
   bool checkerboard_images_ = false;
 
   void TraceStatsToTimeline() const;
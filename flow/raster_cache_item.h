@@ -54,6 +54,14 @@ class RasterCacheItem {
   virtual bool TryToPrepareRasterCache(const PaintContext& context,
                                        bool parent_cached = false) const = 0;
 
+  // Rasterizes the cache entry of an item that was visible in the last frame
+  // but has not been seen often enough to be cached yet, so that it is ready
+  // when the item reaches the access threshold. Called while the raster thread
+  // is idle. Returns true if a new entry was rasterized.
+  virtual bool TryToWarmUpRasterCache(const PaintContext& context) const {
+    return false;
+  }
+
   unsigned child_items() const { return child_items_; }
 
   void set_matrix(const SkMatrix& matrix) { matrix_ = matrix; }
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <limits>
+
 #include "flutter/display_list/benchmarking/dl_complexity.h"
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_builder.h"
@@ -143,6 +145,55 @@ TEST(RasterCache, ThresholdIsRespectedForDisplayList) {
   ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
 }
 
+TEST(RasterCache, WarmedUpDisplayListIsDrawnBeforeReachingThreshold) {
+  size_t threshold = 3;
+  flutter::RasterCache cache(threshold);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  MockCanvas dummy_canvas(1000, 1000);
+  DlPaint paint;
+
+  LayerStateStack preroll_state_stack;
+  preroll_state_stack.set_preroll_delegate(kGiantRect, matrix);
+  LayerStateStack paint_state_stack;
+  preroll_state_stack.set_delegate(&dummy_canvas);
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      preroll_state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder = GetSamplePaintContextHolder(
+      paint_state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  cache.BeginFrame();
+
+  DisplayListRasterCacheItem display_list_item(display_list, SkPoint(), true,
+                                               false);
+
+  // 1st access is below the threshold.
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+
+  cache.EndFrame();
+
+  // The raster thread is idle between frames.
+  ASSERT_TRUE(display_list_item.TryToWarmUpRasterCache(paint_context));
+  ASSERT_FALSE(display_list_item.TryToWarmUpRasterCache(paint_context));
+
+  cache.BeginFrame();
+
+  // 2nd access draws the entry rasterized while idle.
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+}
+
 TEST(RasterCache, SetCheckboardCacheImages) {
   size_t threshold = 1;
   flutter::RasterCache cache(threshold);
@@ -182,6 +233,92 @@ TEST(RasterCache, SetCheckboardCacheImages) {
   ASSERT_TRUE(did_draw_checkerboard);
 }
 
+TEST(RasterCache, ByteBudgetEvictsEntriesThatSaveLeastReplayWork) {
+  flutter::RasterCache cache(1);
+  // Room for one 150x100 image but not two.
+  cache.SetMaxBytes(RasterCacheKeyKind::kDisplayListMetrics, 100000);
+  EXPECT_EQ(cache.GetMaxBytes(RasterCacheKeyKind::kLayerMetrics),
+            std::numeric_limits<size_t>::max());
+
+  SkMatrix matrix = SkMatrix::I();
+  SkRect bounds = SkRect::MakeWH(150, 100);
+  auto draw_function = [](DlCanvas* canvas) {};
+  auto make_context = [&](unsigned int replay_cost) {
+    return RasterCache::Context{
+        // clang-format off
+        .gr_context         = nullptr,
+        .dst_color_space    = nullptr,
+        .matrix             = matrix,
+        .logical_rect       = bounds,
+        .flow_type          = "RasterCacheFlow::DisplayList",
+        .replay_cost        = replay_cost,
+        // clang-format on
+    };
+  };
+  RasterCacheKeyID cheap(1, RasterCacheKeyType::kDisplayList);
+  RasterCacheKeyID expensive(2, RasterCacheKeyType::kDisplayList);
+  RasterCacheKeyID cheapest(3, RasterCacheKeyType::kDisplayList);
+  DisplayListBuilder canvas;
+
+  cache.BeginFrame();
+  ASSERT_TRUE(cache.UpdateCacheEntry(cheap, make_context(10), draw_function));
+
+  // The more expensive entry displaces the cheap one.
+  ASSERT_TRUE(
+      cache.UpdateCacheEntry(expensive, make_context(1000), draw_function));
+  EXPECT_FALSE(cache.Draw(cheap, canvas, nullptr));
+  EXPECT_TRUE(cache.Draw(expensive, canvas, nullptr));
+  EXPECT_EQ(cache.picture_metrics().eviction_count, 1u);
+
+  // An entry that saves less work than what is cached is not rasterized.
+  EXPECT_FALSE(
+      cache.UpdateCacheEntry(cheapest, make_context(1), draw_function));
+  EXPECT_FALSE(cache.Draw(cheapest, canvas, nullptr));
+  EXPECT_TRUE(cache.Draw(expensive, canvas, nullptr));
+}
+
+TEST(RasterCache, TrimEvictsEntriesThatSaveLeastReplayWorkFirst) {
+  flutter::RasterCache cache(1);
+
+  SkMatrix matrix = SkMatrix::I();
+  SkRect bounds = SkRect::MakeWH(150, 100);
+  auto draw_function = [](DlCanvas* canvas) {};
+  auto make_context = [&](unsigned int replay_cost) {
+    return RasterCache::Context{
+        // clang-format off
+        .gr_context         = nullptr,
+        .dst_color_space    = nullptr,
+        .matrix             = matrix,
+        .logical_rect       = bounds,
+        .flow_type          = "RasterCacheFlow::DisplayList",
+        .replay_cost        = replay_cost,
+        // clang-format on
+    };
+  };
+  RasterCacheKeyID cheap(1, RasterCacheKeyType::kDisplayList);
+  RasterCacheKeyID expensive(2, RasterCacheKeyType::kDisplayList);
+  DisplayListBuilder canvas;
+
+  cache.BeginFrame();
+  ASSERT_TRUE(cache.UpdateCacheEntry(cheap, make_context(10), draw_function));
+  ASSERT_TRUE(
+      cache.UpdateCacheEntry(expensive, make_context(1000), draw_function));
+  size_t total_bytes = cache.EstimatePictureCacheByteSize();
+  ASSERT_GT(total_bytes, 0u);
+
+  // A single byte is enough to evict the cheap entry, but nothing more.
+  size_t trimmed_bytes = cache.Trim(1);
+  EXPECT_EQ(trimmed_bytes, total_bytes / 2);
+  EXPECT_FALSE(cache.Draw(cheap, canvas, nullptr));
+  EXPECT_TRUE(cache.Draw(expensive, canvas, nullptr));
+  EXPECT_EQ(cache.picture_metrics().eviction_count, 1u);
+
+  EXPECT_EQ(cache.Trim(std::numeric_limits<size_t>::max()), total_bytes / 2);
+  EXPECT_FALSE(cache.Draw(expensive, canvas, nullptr));
+  EXPECT_EQ(cache.EstimatePictureCacheByteSize(), 0u);
+  EXPECT_EQ(cache.Trim(1), 0u);
+}
+
 TEST(RasterCache, AccessThresholdOfZeroDisablesCachingForDisplayList) {
   size_t threshold = 0;
   flutter::RasterCache cache(threshold);
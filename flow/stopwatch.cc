@@ -4,6 +4,8 @@
 
 #include "flutter/flow/stopwatch.h"
 
+#include "flutter/flow/stopwatch_dl.h"
+
 namespace flutter {
 
 static const size_t kMaxSamples = 120;
@@ -54,6 +56,13 @@ size_t Stopwatch::GetCurrentSample() const {
   return current_sample_;
 }
 
+DlStopwatchGraph& Stopwatch::GetDlGraph() const {
+  if (!dl_graph_) {
+    dl_graph_ = std::make_unique<DlStopwatchGraph>();
+  }
+  return *dl_graph_;
+}
+
 double StopwatchVisualizer::UnitFrameInterval(double raster_time_ms) const {
   return raster_time_ms / frame_budget_.count();
 }
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FLOW_INSTRUMENTATION_H_
 #define FLUTTER_FLOW_INSTRUMENTATION_H_
 
+#include <memory>
 #include <vector>
 
 #include "flutter/display_list/dl_canvas.h"
@@ -14,6 +15,8 @@
 
 namespace flutter {
 
+class DlStopwatchGraph;
+
 class Stopwatch {
  public:
   /// The refresh rate interface for `Stopwatch`.
@@ -52,11 +55,17 @@ class Stopwatch {
   /// All places which want to get frame_budget should call this function.
   fml::Milliseconds GetFrameBudget() const;
 
+  /// The graph drawn by |DlStopwatchVisualizer|. Visualizers are recreated
+  /// on each frame, so the graph is kept with the stopwatch to be updated
+  /// rather than rebuilt.
+  DlStopwatchGraph& GetDlGraph() const;
+
  private:
   const RefreshRateUpdater& refresh_rate_updater_;
   fml::TimePoint start_;
   std::vector<fml::TimeDelta> laps_;
   size_t current_sample_ = 0;
+  mutable std::unique_ptr<DlStopwatchGraph> dl_graph_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(Stopwatch);
 };
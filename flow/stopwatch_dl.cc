@@ -3,6 +3,8 @@
 // found in the LICENSE file.
 
 #include "flutter/flow/stopwatch_dl.h"
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 #include "display_list/dl_blend_mode.h"
@@ -10,6 +12,7 @@
 #include "display_list/dl_color.h"
 #include "display_list/dl_paint.h"
 #include "display_list/dl_vertices.h"
+#include "flutter/fml/logging.h"
 #include "include/core/SkRect.h"
 
 namespace flutter {
@@ -17,45 +20,82 @@ namespace flutter {
 static const size_t kMaxSamples = 120;
 static const size_t kMaxFrameMarkers = 8;
 
+static const DlColor kBarColor = DlColor(0xAA0000FF);
+
+// The graph is laid out as the background, followed by one bar per lap, the
+// frame markers and finally the marker of the current frame.
+static const size_t kFirstBarIndex = 1;
+
 void DlStopwatchVisualizer::Visualize(DlCanvas* canvas,
                                       const SkRect& rect) const {
-  auto painter = DlVertexPainter();
+  DlStopwatchGraph& graph = stopwatch_.GetDlGraph();
+  auto const laps_count = stopwatch_.GetLapsCount();
+
+  if (graph.rect_ != rect || graph.frame_budget_ != GetFrameBudget() ||
+      graph.laps_.size() != laps_count) {
+    BuildGraph(graph, rect);
+  } else {
+    graph.updated_bar_count_ = 0;
+    for (auto i = size_t(0); i < laps_count; i++) {
+      auto const& lap = stopwatch_.GetLap(i);
+      if (graph.laps_[i] == lap) {
+        continue;
+      }
+      graph.laps_[i] = lap;
+      graph.painter_.UpdateRect(kFirstBarIndex + i, MakeBarRect(rect, i),
+                                kBarColor);
+      graph.updated_bar_count_++;
+    }
+  }
+
+  // Paint the vertical marker for the current frame.
+  DlColor color = DlColor::kGreen();
+  if (UnitFrameInterval(stopwatch_.LastLap().ToMillisecondsF()) > 1.0) {
+    // budget exceeded.
+    color = DlColor::kRed();
+  }
+  graph.painter_.UpdateRect(graph.painter_.GetRectCount() - 1,
+                            MakeCurrentSampleRect(rect), color);
+
+  // Actually draw.
+  // Use kSrcOver blend mode so that elements under the performance overlay are
+  // partially visible.
   DlPaint paint;
+  paint.setBlendMode(DlBlendMode::kSrcOver);
+  // The second blend mode does nothing since the paint has no additional color
+  // sources like a tiled image or gradient.
+  canvas->DrawVertices(graph.GetVertices(), DlBlendMode::kSrcOver, paint);
+}
+
+void DlStopwatchVisualizer::BuildGraph(DlStopwatchGraph& graph,
+                                       const SkRect& rect) const {
+  auto& painter = graph.painter_;
+  painter.Clear();
+  graph.rect_ = rect;
+  graph.frame_budget_ = GetFrameBudget();
+  graph.laps_.clear();
 
   // Establish the graph position.
   auto const x = rect.x();
   auto const y = rect.y();
   auto const width = rect.width();
   auto const height = rect.height();
-  auto const bottom = rect.bottom();
 
   // Scale the graph to show time frames up to those that are 3x the frame time.
   auto const one_frame_ms = GetFrameBudget().count();
   auto const max_interval = one_frame_ms * 3.0;
   auto const max_unit_interval = UnitFrameInterval(max_interval);
-  auto const sample_unit_width = (1.0 / kMaxSamples);
 
   // Provide a semi-transparent background for the graph.
   painter.DrawRect(rect, DlColor(0x99FFFFFF));
 
-  // Prepare a path for the data; we start at the height of the last point so
-  // it looks like we wrap around.
+  // Draw a bar for each lap.
   {
     for (auto i = size_t(0); i < stopwatch_.GetLapsCount(); i++) {
-      auto const sample_unit_height =
-          (1.0 - UnitHeight(stopwatch_.GetLap(i).ToMillisecondsF(),
-                            max_unit_interval));
-
-      auto const bar_width = width * sample_unit_width;
-      auto const bar_height = height * sample_unit_height;
-      auto const bar_left = x + width * sample_unit_width * i;
-
-      painter.DrawRect(SkRect::MakeLTRB(/*l=*/bar_left,
-                                        /*t=*/y + bar_height,
-                                        /*r=*/bar_left + bar_width,
-                                        /*b=*/bottom),
-                       DlColor(0xAA0000FF));
+      graph.laps_.push_back(stopwatch_.GetLap(i));
+      painter.DrawRect(MakeBarRect(rect, i), kBarColor);
     }
+    graph.updated_bar_count_ = graph.laps_.size();
   }
 
   // Draw horizontal frame markers.
@@ -84,39 +124,50 @@ void DlStopwatchVisualizer::Visualize(DlCanvas* canvas,
     }
   }
 
-  // Paint the vertical marker for the current frame.
-  {
-    DlColor color = DlColor::kGreen();
-    if (UnitFrameInterval(stopwatch_.LastLap().ToMillisecondsF()) > 1.0) {
-      // budget exceeded.
-      color = DlColor::kRed();
-    }
-    auto const l =
-        x + width * (static_cast<double>(stopwatch_.GetCurrentSample()) /
-                     kMaxSamples);
-    auto const t = y;
-    auto const r = l + width * sample_unit_width;
-    auto const b = rect.bottom();
-    painter.DrawRect(SkRect::MakeLTRB(l, t, r, b), color);
-  }
+  // Reserve the vertical marker for the current frame, which is updated on
+  // every frame.
+  painter.DrawRect(MakeCurrentSampleRect(rect), DlColor::kGreen());
+}
 
-  // Actually draw.
-  // Use kSrcOver blend mode so that elements under the performance overlay are
-  // partially visible.
-  paint.setBlendMode(DlBlendMode::kSrcOver);
-  // The second blend mode does nothing since the paint has no additional color
-  // sources like a tiled image or gradient.
-  canvas->DrawVertices(painter.IntoVertices(), DlBlendMode::kSrcOver, paint);
+SkRect DlStopwatchVisualizer::MakeBarRect(const SkRect& rect,
+                                          size_t index) const {
+  auto const max_unit_interval =
+      UnitFrameInterval(GetFrameBudget().count() * 3.0);
+  auto const sample_unit_width = (1.0 / kMaxSamples);
+  auto const sample_unit_height =
+      (1.0 - UnitHeight(stopwatch_.GetLap(index).ToMillisecondsF(),
+                        max_unit_interval));
+
+  auto const bar_width = rect.width() * sample_unit_width;
+  auto const bar_height = rect.height() * sample_unit_height;
+  auto const bar_left = rect.x() + rect.width() * sample_unit_width * index;
+
+  return SkRect::MakeLTRB(/*l=*/bar_left,
+                          /*t=*/rect.y() + bar_height,
+                          /*r=*/bar_left + bar_width,
+                          /*b=*/rect.bottom());
 }
 
-void DlVertexPainter::DrawRect(const SkRect& rect, const DlColor& color) {
-  // Draw 6 vertices representing 2 triangles.
+SkRect DlStopwatchVisualizer::MakeCurrentSampleRect(const SkRect& rect) const {
+  auto const sample_unit_width = (1.0 / kMaxSamples);
+  auto const l =
+      rect.x() +
+      rect.width() *
+          (static_cast<double>(stopwatch_.GetCurrentSample()) / kMaxSamples);
+  auto const t = rect.y();
+  auto const r = l + rect.width() * sample_unit_width;
+  auto const b = rect.bottom();
+  return SkRect::MakeLTRB(l, t, r, b);
+}
+
+static std::array<SkPoint, 6> MakeRectVertices(const SkRect& rect) {
+  // 6 vertices representing 2 triangles.
   auto const left = rect.x();
   auto const top = rect.y();
   auto const right = rect.right();
   auto const bottom = rect.bottom();
 
-  auto const vertices = std::array<SkPoint, 6>{
+  return std::array<SkPoint, 6>{
       SkPoint::Make(left, top),      // tl tr
       SkPoint::Make(right, top),     //    br
       SkPoint::Make(right, bottom),  //
@@ -124,6 +175,11 @@ void DlVertexPainter::DrawRect(const SkRect& rect, const DlColor& color) {
       SkPoint::Make(left, bottom),   // bl br
       SkPoint::Make(left, top)       //
   };
+}
+
+void DlVertexPainter::DrawRect(const SkRect& rect, const DlColor& color) {
+  // Draw 6 vertices representing 2 triangles.
+  auto const vertices = MakeRectVertices(rect);
 
   auto const colors = std::array<DlColor, 6>{
       color,  // tl tr
@@ -150,4 +206,31 @@ std::shared_ptr<DlVertices> DlVertexPainter::IntoVertices() {
   return result;
 }
 
+void DlVertexPainter::UpdateRect(size_t index,
+                                 const SkRect& rect,
+                                 const DlColor& color) {
+  FML_DCHECK(index < GetRectCount());
+  auto const vertices = MakeRectVertices(rect);
+  std::copy(vertices.begin(), vertices.end(), vertices_.begin() + index * 6);
+  std::fill_n(colors_.begin() + index * 6, 6, color);
+}
+
+std::shared_ptr<DlVertices> DlVertexPainter::ToVertices() const {
+  return DlVertices::Make(
+      /*mode=*/DlVertexMode::kTriangles,
+      /*vertex_count=*/vertices_.size(),
+      /*vertices=*/vertices_.data(),
+      /*texture_coordinates=*/nullptr,
+      /*colors=*/colors_.data());
+}
+
+size_t DlVertexPainter::GetRectCount() const {
+  return vertices_.size() / 6;
+}
+
+void DlVertexPainter::Clear() {
+  vertices_.clear();
+  colors_.clear();
+}
+
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_FLOW_STOPWATCH_DL_H_
 #define FLUTTER_FLOW_STOPWATCH_DL_H_
 
+#include <memory>
+#include <vector>
+
 #include "flow/stopwatch.h"
 
 namespace flutter {
@@ -22,6 +25,16 @@ class DlStopwatchVisualizer : public StopwatchVisualizer {
       : StopwatchVisualizer(stopwatch) {}
 
   void Visualize(DlCanvas* canvas, const SkRect& rect) const override;
+
+ private:
+  /// Lays out every rectangle of the graph from scratch.
+  void BuildGraph(DlStopwatchGraph& graph, const SkRect& rect) const;
+
+  /// The bar of the lap at |index|.
+  SkRect MakeBarRect(const SkRect& rect, size_t index) const;
+
+  /// The vertical marker of the current frame.
+  SkRect MakeCurrentSampleRect(const SkRect& rect) const;
 };
 
 /// @brief Provides canvas-like painting methods that actually build vertices.
@@ -46,11 +59,54 @@ class DlVertexPainter final {
   /// @note This method clears the buffer.
   std::shared_ptr<DlVertices> IntoVertices();
 
+  /// Replaces the rectangle drawn by the |index|th call to |DrawRect|.
+  void UpdateRect(size_t index, const SkRect& rect, const DlColor& color);
+
+  /// Converts the buffered vertices into a |DlVertices| object.
+  ///
+  /// @note Unlike |IntoVertices|, the buffer is kept so that it can be
+  ///       updated and drawn again.
+  std::shared_ptr<DlVertices> ToVertices() const;
+
+  /// The number of rectangles in the buffer.
+  size_t GetRectCount() const;
+
+  /// Clears the buffer.
+  void Clear();
+
  private:
   std::vector<SkPoint> vertices_;
   std::vector<DlColor> colors_;
 };
 
+//------------------------------------------------------------------------------
+/// @brief The vertices of the graph of a |Stopwatch|, kept across frames by
+///        the stopwatch.
+///
+/// Only one lap changes between two frames, so |DlStopwatchVisualizer| only
+/// recomputes the bars of the laps that differ from the ones the graph was
+/// last updated with, and the marker of the current frame. The graph is laid
+/// out again when its bounds or the frame budget change.
+class DlStopwatchGraph final {
+ public:
+  /// The vertices of the graph as of its last update.
+  std::shared_ptr<DlVertices> GetVertices() const {
+    return painter_.ToVertices();
+  }
+
+  /// The number of bars that were recomputed by the last update.
+  size_t GetUpdatedBarCount() const { return updated_bar_count_; }
+
+ private:
+  friend class DlStopwatchVisualizer;
+
+  DlVertexPainter painter_;
+  SkRect rect_ = SkRect::MakeEmpty();
+  fml::Milliseconds frame_budget_ = fml::Milliseconds::zero();
+  std::vector<fml::TimeDelta> laps_;
+  size_t updated_bar_count_ = 0;
+};
+
 }  // namespace flutter
 
 #endif  // FLUTTER_FLOW_STOPWATCH_DL_H_
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "flutter/flow/stopwatch_dl.h"
+#include "flutter/display_list/dl_builder.h"
 #include "gtest/gtest.h"
 
 namespace flutter {
@@ -69,5 +70,60 @@ TEST(DlVertexPainter, DrawRectIntoVertices) {
   EXPECT_EQ(colors[11], DlColor::kBlue());
 }
 
+TEST(DlVertexPainter, UpdateRectKeepsOtherRects) {
+  auto painter = DlVertexPainter();
+  painter.DrawRect(SkRect::MakeLTRB(0, 0, 10, 10), DlColor::kRed());
+  painter.DrawRect(SkRect::MakeLTRB(10, 10, 20, 20), DlColor::kBlue());
+
+  painter.UpdateRect(1, SkRect::MakeLTRB(30, 30, 40, 40), DlColor::kGreen());
+  auto vertices = painter.ToVertices();
+
+  EXPECT_EQ(painter.GetRectCount(), 2u);
+  ASSERT_EQ(vertices->vertex_count(), 3 * 2 * 2);
+  SkPoint first_rect_vertices[6];
+  std::copy(vertices->vertices(), vertices->vertices() + 6,
+            first_rect_vertices);
+  EXPECT_EQ(MakeRectFromVertices(first_rect_vertices),
+            SkRect::MakeLTRB(0, 0, 10, 10));
+  SkPoint second_rect_vertices[6];
+  std::copy(vertices->vertices() + 6, vertices->vertices() + 12,
+            second_rect_vertices);
+  EXPECT_EQ(MakeRectFromVertices(second_rect_vertices),
+            SkRect::MakeLTRB(30, 30, 40, 40));
+  EXPECT_EQ(vertices->colors()[0], DlColor::kRed());
+  EXPECT_EQ(vertices->colors()[11], DlColor::kGreen());
+}
+
+TEST(DlStopwatchVisualizer, OnlyUpdatesChangedLaps) {
+  const SkRect rect = SkRect::MakeXYWH(10, 10, 240, 100);
+  FixedRefreshRateStopwatch stopwatch;
+  DisplayListBuilder builder;
+
+  DlStopwatchVisualizer(stopwatch).Visualize(&builder, rect);
+  EXPECT_EQ(stopwatch.GetDlGraph().GetUpdatedBarCount(),
+            stopwatch.GetLapsCount());
+
+  DlStopwatchVisualizer(stopwatch).Visualize(&builder, rect);
+  EXPECT_EQ(stopwatch.GetDlGraph().GetUpdatedBarCount(), 0u);
+
+  stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(20));
+  DlStopwatchVisualizer(stopwatch).Visualize(&builder, rect);
+  EXPECT_EQ(stopwatch.GetDlGraph().GetUpdatedBarCount(), 1u);
+
+  // The updated graph matches one built from scratch.
+  FixedRefreshRateStopwatch expected_stopwatch;
+  expected_stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(20));
+  DlStopwatchVisualizer(expected_stopwatch).Visualize(&builder, rect);
+  auto vertices = stopwatch.GetDlGraph().GetVertices();
+  auto expected_vertices = expected_stopwatch.GetDlGraph().GetVertices();
+  EXPECT_TRUE(*vertices == *expected_vertices);
+
+  // Resizing the graph lays it out again.
+  DlStopwatchVisualizer(stopwatch).Visualize(
+      &builder, SkRect::MakeXYWH(10, 10, 120, 100));
+  EXPECT_EQ(stopwatch.GetDlGraph().GetUpdatedBarCount(),
+            stopwatch.GetLapsCount());
+}
+
 }  // namespace testing
 }  // namespace flutter
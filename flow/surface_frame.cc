@@ -48,6 +48,10 @@ bool SurfaceFrame::Submit() {
     return false;
   }
 
+  if (!Prepare()) {
+    return false;
+  }
+
   submitted_ = PerformSubmit();
 
   return submitted_;
@@ -57,6 +61,17 @@ bool SurfaceFrame::IsSubmitted() const {
   return submitted_;
 }
 
+bool SurfaceFrame::Prepare() {
+  if (!prepare_callback_) {
+    return true;
+  }
+  if (!prepared_.has_value()) {
+    TRACE_EVENT0("flutter", "SurfaceFrame::Prepare");
+    prepared_ = prepare_callback_(*this);
+  }
+  return prepared_.value();
+}
+
 DlCanvas* SurfaceFrame::Canvas() {
   return canvas_;
 }
@@ -25,6 +25,7 @@ class SurfaceFrame {
  public:
   using SubmitCallback =
       std::function<bool(SurfaceFrame& surface_frame, DlCanvas* canvas)>;
+  using PrepareCallback = std::function<bool(SurfaceFrame& surface_frame)>;
 
   // Information about the underlying framebuffer
   struct FramebufferInfo {
@@ -86,6 +87,22 @@ class SurfaceFrame {
 
   bool IsSubmitted() const;
 
+  // Sets the callback that does the part of the submission that can run on
+  // any thread, such as lowering the recorded display list for the backend.
+  // It runs once, from |Prepare| or, failing that, from |Submit|.
+  void set_prepare_callback(const PrepareCallback& prepare_callback) {
+    prepare_callback_ = prepare_callback;
+  }
+
+  // Whether the frame has work that |Prepare| can move off the thread that
+  // submits it.
+  bool CanPrepare() const { return !!prepare_callback_; }
+
+  // Runs the prepare callback, if any, unless it has already run. Frames that
+  // |CanPrepare| may be prepared concurrently with each other and with the
+  // submission of other frames. Returns whether the frame can be submitted.
+  bool Prepare();
+
   sk_sp<SkSurface> SkiaSurface() const;
 
   DlCanvas* Canvas();
@@ -109,6 +126,8 @@ class SurfaceFrame {
   FramebufferInfo framebuffer_info_;
   SubmitInfo submit_info_;
   SubmitCallback submit_callback_;
+  PrepareCallback prepare_callback_;
+  std::optional<bool> prepared_;
   std::unique_ptr<GLContextResult> context_result_;
 
   bool PerformSubmit();
@@ -52,4 +52,49 @@ TEST(FlowTest, SurfaceFrameDoesNotPrepareRtree) {
   EXPECT_FALSE(surface_frame->BuildDisplayList()->has_rtree());
 }
 
+TEST(FlowTest, SurfaceFramePreparesOnceBeforeSubmitting) {
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  int prepare_count = 0;
+  bool submitted = false;
+  auto callback = [&](const SurfaceFrame&, DlCanvas*) {
+    EXPECT_EQ(prepare_count, 1);
+    submitted = true;
+    return true;
+  };
+  SurfaceFrame frame(
+      /*surface=*/nullptr,
+      /*framebuffer_info=*/framebuffer_info,
+      /*submit_callback=*/callback,
+      /*frame_size=*/SkISize::Make(800, 600));
+  EXPECT_FALSE(frame.CanPrepare());
+  frame.set_prepare_callback([&](SurfaceFrame&) {
+    prepare_count++;
+    return true;
+  });
+  EXPECT_TRUE(frame.CanPrepare());
+
+  EXPECT_TRUE(frame.Prepare());
+  EXPECT_TRUE(frame.Prepare());
+  EXPECT_TRUE(frame.Submit());
+  EXPECT_EQ(prepare_count, 1);
+  EXPECT_TRUE(submitted);
+}
+
+TEST(FlowTest, SurfaceFrameDoesNotSubmitIfPrepareFails) {
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  auto callback = [](const SurfaceFrame&, DlCanvas*) {
+    EXPECT_FALSE(true);
+    return true;
+  };
+  SurfaceFrame frame(
+      /*surface=*/nullptr,
+      /*framebuffer_info=*/framebuffer_info,
+      /*submit_callback=*/callback,
+      /*frame_size=*/SkISize::Make(800, 600));
+  frame.set_prepare_callback([](SurfaceFrame&) { return false; });
+
+  EXPECT_FALSE(frame.Submit());
+  EXPECT_FALSE(frame.IsSubmitted());
+}
+
 }  // namespace flutter
@@ -24,6 +24,7 @@ Damage DiffContextTest::DiffLayerTree(MockLayerTree& layer_tree,
   DiffContext dc(layer_tree.size(), layer_tree.paint_region_map(),
                  old_layer_tree.paint_region_map(), use_raster_cache,
                  impeller_enabled);
+  dc.set_texture_registry(texture_registry().get());
   dc.PushCullRect(
       SkRect::MakeIWH(layer_tree.size().width(), layer_tree.size().height()));
   layer_tree.root()->Diff(&dc, old_layer_tree.root());
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/cache_statistics.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace fml {
+
+namespace {
+
+struct Registry {
+  std::mutex mutex;
+  std::map<std::string, std::unique_ptr<CacheStatistics::Counters>> counters;
+};
+
+Registry& GetRegistry() {
+  // Intentionally leaked, caches may be updated while the process exits.
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+}  // namespace
+
+double CacheStatistics::Snapshot::GetHitRate() const {
+  uint64_t lookups = hits + misses;
+  if (lookups == 0u) {
+    return 0.0;
+  }
+  return static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+CacheStatistics::Counters& CacheStatistics::GetCounters(
+    const std::string& name) {
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  auto& counters = registry.counters[name];
+  if (!counters) {
+    counters.reset(new Counters());
+  }
+  return *counters;
+}
+
+std::vector<CacheStatistics::Snapshot> CacheStatistics::Dump() {
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  std::vector<Snapshot> snapshots;
+  snapshots.reserve(registry.counters.size());
+  for (const auto& [name, counters] : registry.counters) {
+    snapshots.push_back({
+        .name = name,
+        .hits = counters->GetHits(),
+        .misses = counters->GetMisses(),
+        .evictions = counters->GetEvictions(),
+    });
+  }
+  return snapshots;
+}
+
+void CacheStatistics::Reset() {
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (const auto& [name, counters] : registry.counters) {
+    counters->hits_.store(0u, std::memory_order_relaxed);
+    counters->misses_.store(0u, std::memory_order_relaxed);
+    counters->evictions_.store(0u, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace fml
@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_CACHE_STATISTICS_H_
+#define FLUTTER_FML_CACHE_STATISTICS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// @brief      A process wide registry of the hits, misses and evictions of
+///             the caches of the engine, like the raster cache and the
+///             render target cache of Impeller, so that their sizes can be
+///             tuned from their hit rates.
+///
+///             A cache looks up its counters once, by name, and keeps the
+///             reference it gets. Updating the counters afterwards is a
+///             relaxed atomic increment, so it can be done on hot paths and
+///             from any thread. The counters of all instances of a cache are
+///             summed, for example the raster caches of several engines.
+///
+class CacheStatistics {
+ public:
+  class Counters {
+   public:
+    void RecordHit(uint64_t count = 1u) {
+      hits_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void RecordMiss(uint64_t count = 1u) {
+      misses_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void RecordEviction(uint64_t count = 1u) {
+      evictions_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    uint64_t GetHits() const { return hits_.load(std::memory_order_relaxed); }
+
+    uint64_t GetMisses() const {
+      return misses_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetEvictions() const {
+      return evictions_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    friend class CacheStatistics;
+
+    std::atomic<uint64_t> hits_ = 0u;
+    std::atomic<uint64_t> misses_ = 0u;
+    std::atomic<uint64_t> evictions_ = 0u;
+
+    Counters() = default;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(Counters);
+  };
+
+  struct Snapshot {
+    std::string name;
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+
+    /// The fraction of the lookups that were hits, or 0 if the cache has not
+    /// been looked up.
+    double GetHitRate() const;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the counters of the cache named |name|, creating
+  ///             them the first time. The counters are never destroyed, so
+  ///             the reference can be kept for the lifetime of the process.
+  ///
+  static Counters& GetCounters(const std::string& name);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the counters of all the caches, sorted by name.
+  ///
+  static std::vector<Snapshot> Dump();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Resets the counters of all the caches to zero.
+  ///
+  static void Reset();
+
+ private:
+  CacheStatistics() = delete;
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_CACHE_STATISTICS_H_
@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/cache_statistics.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+const CacheStatistics::Snapshot* FindCache(
+    const std::vector<CacheStatistics::Snapshot>& dump,
+    const std::string& name) {
+  for (const auto& snapshot : dump) {
+    if (snapshot.name == name) {
+      return &snapshot;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(CacheStatisticsTest, CountersAreSharedByName) {
+  auto& counters = CacheStatistics::GetCounters("cache_statistics_test");
+  EXPECT_EQ(&counters, &CacheStatistics::GetCounters("cache_statistics_test"));
+  EXPECT_NE(&counters, &CacheStatistics::GetCounters("cache_statistics_other"));
+}
+
+TEST(CacheStatisticsTest, DumpsHitRates) {
+  CacheStatistics::Reset();
+  auto& counters = CacheStatistics::GetCounters("cache_statistics_dump");
+  counters.RecordHit(3u);
+  counters.RecordMiss();
+  counters.RecordEviction(2u);
+
+  auto dump = CacheStatistics::Dump();
+  auto cache = FindCache(dump, "cache_statistics_dump");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->hits, 3u);
+  EXPECT_EQ(cache->misses, 1u);
+  EXPECT_EQ(cache->evictions, 2u);
+  EXPECT_DOUBLE_EQ(cache->GetHitRate(), 0.75);
+
+  CacheStatistics::Reset();
+  dump = CacheStatistics::Dump();
+  cache = FindCache(dump, "cache_statistics_dump");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->hits, 0u);
+  EXPECT_EQ(cache->GetHitRate(), 0.0);
+}
+
+TEST(CacheStatisticsTest, CountsFromSeveralThreads) {
+  constexpr int kThreadCount = 4;
+  constexpr int kHitsPerThread = 1000;
+  auto& counters = CacheStatistics::GetCounters("cache_statistics_threads");
+  uint64_t initial_hits = counters.GetHits();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadCount; i++) {
+    threads.emplace_back([&counters]() {
+      for (int j = 0; j < kHitsPerThread; j++) {
+        counters.RecordHit();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counters.GetHits() - initial_hits,
+            static_cast<uint64_t>(kThreadCount * kHitsPerThread));
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -7,23 +7,46 @@
 #include <algorithm>
 
 #include "flutter/fml/thread.h"
+#include "flutter/fml/thread_local.h"
 #include "flutter/fml/trace_event.h"
 
 namespace fml {
 
-ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count)
+namespace {
+
+// iOS prior to version 9 prevents c++11 thread_local and __thread specifier,
+// having us resort to boxed containers.
+struct WorkerHolder {
+  const ConcurrentMessageLoop* loop;
+  size_t index;
+};
+
+}  // namespace
+
+FML_THREAD_LOCAL ThreadLocalUniquePtr<WorkerHolder> tls_worker;
+
+ConcurrentMessageLoop::ConcurrentMessageLoop(
+    size_t worker_count,
+    std::optional<CpuAffinity> worker_affinity)
     : worker_count_(std::max<size_t>(worker_count, 1ul)) {
+  // The queues have to exist before any worker starts, as workers take tasks
+  // from each other's queues.
+  for (size_t i = 0; i < worker_count_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<WorkerQueue>());
+  }
+
   for (size_t i = 0; i < worker_count_; ++i) {
-    workers_.emplace_back([i, this]() {
+    workers_.emplace_back([i, worker_affinity, this]() {
       fml::Thread::SetCurrentThreadName(fml::Thread::ThreadConfig(
           std::string{"io.worker." + std::to_string(i + 1)}));
-      WorkerMain();
+      if (worker_affinity.has_value()) {
+        fml::RequestAffinity(worker_affinity.value());
+      }
+      tls_worker.reset(new WorkerHolder{this, i});
+      WorkerMain(i);
+      tls_worker.reset(nullptr);
     });
   }
-
-  for (const auto& worker : workers_) {
-    worker_thread_ids_.emplace_back(worker.get_id());
-  }
 }
 
 ConcurrentMessageLoop::~ConcurrentMessageLoop() {
@@ -42,82 +65,185 @@ std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
   return std::make_shared<ConcurrentTaskRunner>(weak_from_this());
 }
 
-void ConcurrentMessageLoop::PostTask(const fml::closure& task) {
+void ConcurrentMessageLoop::PostTask(const fml::closure& task,
+                                     ConcurrentTaskPriority priority) {
   if (!task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
-
   // Don't just drop tasks on the floor in case of shutdown.
   if (shutdown_) {
     FML_DLOG(WARNING)
         << "Tried to post a task to shutdown concurrent message "
            "loop. The task will be executed on the callers thread.";
-    lock.unlock();
     ExecuteTask(task);
     return;
   }
 
-  tasks_.push(task);
+  // Tasks posted from a worker are likely to be related to the task that it
+  // is running, and are kept on that worker unless another one runs out of
+  // tasks. Tasks posted from other threads are spread across the workers, so
+  // that a burst of them doesn't all have to be stolen from a single worker.
+  size_t worker_index = GetCurrentWorkerIndex();
+  if (worker_index == worker_count_) {
+    worker_index = next_worker_.fetch_add(1) % worker_count_;
+  }
 
-  // Unlock the mutex before notifying the condition variable because that mutex
-  // has to be acquired on the other thread anyway. Waiting in this scope till
-  // it is acquired there is a pessimization.
-  lock.unlock();
+  {
+    auto& queue = *worker_queues_[worker_index];
+    std::scoped_lock lock(queue.mutex);
+    queue.tasks[static_cast<size_t>(priority)].push_back(task);
+    // Counted under the queue mutex so that the count never drops below the
+    // number of tasks queued when the task is taken.
+    pending_task_count_.fetch_add(1);
+  }
 
-  tasks_condition_.notify_one();
+  NotifyIdleWorkers(1);
 }
 
-void ConcurrentMessageLoop::WorkerMain() {
-  while (true) {
-    std::unique_lock lock(tasks_mutex_);
-    tasks_condition_.wait(lock, [&]() {
-      return !tasks_.empty() || shutdown_ || HasThreadTasksLocked();
-    });
-
-    // Shutdown cannot be read with the task mutex unlocked.
-    bool shutdown_now = shutdown_;
-    fml::closure task;
-    std::vector<fml::closure> thread_tasks;
+void ConcurrentMessageLoop::PostTasks(std::vector<fml::closure> tasks,
+                                      ConcurrentTaskPriority priority) {
+  tasks.erase(std::remove(tasks.begin(), tasks.end(), nullptr), tasks.end());
+  if (tasks.empty()) {
+    return;
+  }
 
-    if (!tasks_.empty()) {
-      task = tasks_.front();
-      tasks_.pop();
+  if (shutdown_) {
+    FML_DLOG(WARNING)
+        << "Tried to post tasks to shutdown concurrent message "
+           "loop. The tasks will be executed on the callers thread.";
+    for (const auto& task : tasks) {
+      ExecuteTask(task);
     }
+    return;
+  }
+
+  // As in |PostTask|, tasks posted from a worker are kept on that worker.
+  // Tasks posted from other threads are split into a contiguous run of tasks
+  // for each of the next workers.
+  size_t worker_index = GetCurrentWorkerIndex();
+  size_t queue_count = 1;
+  if (worker_index == worker_count_) {
+    queue_count = std::min(tasks.size(), worker_count_);
+    worker_index = next_worker_.fetch_add(queue_count);
+  }
 
-    if (HasThreadTasksLocked()) {
-      thread_tasks = GetThreadTasksLocked();
-      FML_DCHECK(!HasThreadTasksLocked());
+  size_t begin = 0;
+  for (size_t i = 0; i < queue_count; ++i) {
+    size_t end = tasks.size() * (i + 1) / queue_count;
+    auto& queue = *worker_queues_[(worker_index + i) % worker_count_];
+    std::scoped_lock lock(queue.mutex);
+    auto& queued_tasks = queue.tasks[static_cast<size_t>(priority)];
+    for (size_t j = begin; j < end; ++j) {
+      queued_tasks.push_back(std::move(tasks[j]));
     }
+    pending_task_count_.fetch_add(end - begin);
+    begin = end;
+  }
 
-    // Don't hold onto the mutex while tasks are being executed as they could
-    // themselves try to post more tasks to the message loop.
-    lock.unlock();
+  NotifyIdleWorkers(tasks.size());
+}
 
-    TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
-    // Execute the primary task we woke up for.
-    if (task) {
-      ExecuteTask(task);
-    }
+void ConcurrentMessageLoop::NotifyIdleWorkers(size_t task_count) {
+  // Workers increment the idle worker count before they check for pending
+  // tasks, and tasks are counted before the idle workers are, so either the
+  // worker sees the task or the worker is seen here.
+  size_t idle_worker_count = idle_worker_count_.load();
+  if (idle_worker_count == 0) {
+    return;
+  }
 
-    // Execute any thread tasks.
-    for (const auto& thread_task : thread_tasks) {
+  // Acquire the mutex so that a worker that is about to wait is waiting by
+  // the time it is notified. Unlock the mutex before notifying the condition
+  // variable because that mutex has to be acquired on the other thread
+  // anyway. Waiting in this scope till it is acquired there is a
+  // pessimization.
+  { std::scoped_lock lock(tasks_mutex_); }
+  if (task_count >= idle_worker_count) {
+    tasks_condition_.notify_all();
+    return;
+  }
+  for (size_t i = 0; i < task_count; ++i) {
+    tasks_condition_.notify_one();
+  }
+}
+
+void ConcurrentMessageLoop::WorkerMain(size_t worker_index) {
+  auto& queue = *worker_queues_[worker_index];
+  while (true) {
+    // Thread tasks are run first so that a worker that is kept busy by other
+    // tasks still runs them in a timely fashion.
+    for (const auto& thread_task : TakeThreadTasks(worker_index)) {
       ExecuteTask(thread_task);
     }
 
-    if (shutdown_now) {
+    if (fml::closure task = TakeTask(worker_index)) {
+      TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
+      ExecuteTask(task);
+    }
+
+    if (shutdown_) {
       break;
     }
+
+    if (pending_task_count_.load() > 0) {
+      continue;
+    }
+
+    std::unique_lock lock(tasks_mutex_);
+    idle_worker_count_.fetch_add(1);
+    tasks_condition_.wait(lock, [&]() {
+      return pending_task_count_.load() > 0 || shutdown_ ||
+             queue.has_thread_tasks;
+    });
+    idle_worker_count_.fetch_sub(1);
   }
 }
 
+fml::closure ConcurrentMessageLoop::TakeTask(size_t worker_index) {
+  if (pending_task_count_.load() == 0) {
+    return nullptr;
+  }
+
+  // Latency sensitive tasks queued on any worker are run before background
+  // tasks queued on this one. Tasks are taken from the front of the queues
+  // of other workers as well, as those have been waiting for the longest.
+  for (size_t priority = 0; priority < kPriorityCount; ++priority) {
+    for (size_t i = 0; i < worker_count_; ++i) {
+      auto& queue = *worker_queues_[(worker_index + i) % worker_count_];
+      std::scoped_lock lock(queue.mutex);
+      auto& tasks = queue.tasks[priority];
+      if (!tasks.empty()) {
+        fml::closure task = std::move(tasks.front());
+        tasks.pop_front();
+        pending_task_count_.fetch_sub(1);
+        return task;
+      }
+    }
+  }
+  return nullptr;
+}
+
+std::vector<fml::closure> ConcurrentMessageLoop::TakeThreadTasks(
+    size_t worker_index) {
+  auto& queue = *worker_queues_[worker_index];
+  std::vector<fml::closure> thread_tasks;
+  if (queue.has_thread_tasks) {
+    std::scoped_lock lock(queue.mutex);
+    std::swap(thread_tasks, queue.thread_tasks);
+    queue.has_thread_tasks = false;
+  }
+  return thread_tasks;
+}
+
 void ConcurrentMessageLoop::ExecuteTask(const fml::closure& task) {
   task();
 }
 
 void ConcurrentMessageLoop::Terminate() {
   std::scoped_lock lock(tasks_mutex_);
+  // Workers stop once they have run the task they are running, if any, and
+  // the tasks that are still queued are dropped.
   shutdown_ = true;
   tasks_condition_.notify_all();
 }
@@ -127,24 +253,23 @@ void ConcurrentMessageLoop::PostTaskToAllWorkers(const fml::closure& task) {
     return;
   }
 
-  std::scoped_lock lock(tasks_mutex_);
-  for (const auto& worker_thread_id : worker_thread_ids_) {
-    thread_tasks_[worker_thread_id].emplace_back(task);
+  for (auto& queue : worker_queues_) {
+    std::scoped_lock lock(queue->mutex);
+    queue->thread_tasks.emplace_back(task);
+    queue->has_thread_tasks = true;
   }
-  tasks_condition_.notify_all();
-}
 
-bool ConcurrentMessageLoop::HasThreadTasksLocked() const {
-  return thread_tasks_.count(std::this_thread::get_id()) > 0;
+  // Every worker has to run the task, so they all have to be woken up.
+  std::scoped_lock lock(tasks_mutex_);
+  tasks_condition_.notify_all();
 }
 
-std::vector<fml::closure> ConcurrentMessageLoop::GetThreadTasksLocked() {
-  auto found = thread_tasks_.find(std::this_thread::get_id());
-  FML_DCHECK(found != thread_tasks_.end());
-  std::vector<fml::closure> pending_tasks;
-  std::swap(pending_tasks, found->second);
-  thread_tasks_.erase(found);
-  return pending_tasks;
+size_t ConcurrentMessageLoop::GetCurrentWorkerIndex() const {
+  const WorkerHolder* worker = tls_worker.get();
+  if (worker == nullptr || worker->loop != this) {
+    return worker_count_;
+  }
+  return worker->index;
 }
 
 ConcurrentTaskRunner::ConcurrentTaskRunner(
@@ -154,12 +279,17 @@ ConcurrentTaskRunner::ConcurrentTaskRunner(
 ConcurrentTaskRunner::~ConcurrentTaskRunner() = default;
 
 void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
+  PostTask(task, ConcurrentTaskPriority::kBackground);
+}
+
+void ConcurrentTaskRunner::PostTask(const fml::closure& task,
+                                    ConcurrentTaskPriority priority) {
   if (!task) {
     return;
   }
 
   if (auto loop = weak_loop_.lock()) {
-    loop->PostTask(task);
+    loop->PostTask(task, priority);
     return;
   }
 
@@ -169,14 +299,25 @@ void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
   task();
 }
 
-bool ConcurrentMessageLoop::RunsTasksOnCurrentThread() {
-  std::scoped_lock lock(tasks_mutex_);
-  for (const auto& worker_thread_id : worker_thread_ids_) {
-    if (worker_thread_id == std::this_thread::get_id()) {
-      return true;
+void ConcurrentTaskRunner::PostTasks(std::vector<fml::closure> tasks,
+                                     ConcurrentTaskPriority priority) {
+  if (auto loop = weak_loop_.lock()) {
+    loop->PostTasks(std::move(tasks), priority);
+    return;
+  }
+
+  FML_DLOG(WARNING)
+      << "Tried to post to a concurrent message loop that has already died. "
+         "Executing the tasks on the callers thread.";
+  for (const auto& task : tasks) {
+    if (task) {
+      task();
     }
   }
-  return false;
+}
+
+bool ConcurrentMessageLoop::RunsTasksOnCurrentThread() {
+  return GetCurrentWorkerIndex() != worker_count_;
 }
 
 }  // namespace fml
@@ -5,12 +5,16 @@
 #ifndef FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 #define FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 
+#include <atomic>
 #include <condition_variable>
-#include <map>
-#include <queue>
+#include <deque>
+#include <memory>
+#include <optional>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/closure.h"
+#include "flutter/fml/cpu_affinity.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
 
@@ -18,11 +22,33 @@ namespace fml {
 
 class ConcurrentTaskRunner;
 
+/// The lanes that tasks posted to a |ConcurrentMessageLoop| are queued in.
+/// Workers run every pending latency sensitive task before they run any
+/// other task.
+enum class ConcurrentTaskPriority {
+  /// Work that something is waiting on to make progress, such as pipelines
+  /// that a frame needs.
+  kLatencySensitive,
+
+  /// Everything else.
+  kBackground,
+};
+
+/// A pool of worker threads that run the tasks posted to it in no
+/// particular order.
+///
+/// Each worker has its own queue of tasks for each priority. Tasks posted
+/// from a worker are queued on that worker, tasks posted from other threads
+/// are spread across the workers, and workers that run out of tasks take
+/// them from the queues of the other workers.
 class ConcurrentMessageLoop
     : public std::enable_shared_from_this<ConcurrentMessageLoop> {
  public:
+  /// Creates a loop with |worker_count| workers, which request
+  /// |worker_affinity| when they start if it is set.
   static std::shared_ptr<ConcurrentMessageLoop> Create(
-      size_t worker_count = std::thread::hardware_concurrency());
+      size_t worker_count = std::thread::hardware_concurrency(),
+      std::optional<CpuAffinity> worker_affinity = std::nullopt);
 
   virtual ~ConcurrentMessageLoop();
 
@@ -37,28 +63,60 @@ class ConcurrentMessageLoop
   bool RunsTasksOnCurrentThread();
 
  protected:
-  explicit ConcurrentMessageLoop(size_t worker_count);
+  explicit ConcurrentMessageLoop(
+      size_t worker_count,
+      std::optional<CpuAffinity> worker_affinity = std::nullopt);
   virtual void ExecuteTask(const fml::closure& task);
 
  private:
   friend ConcurrentTaskRunner;
 
+  static constexpr size_t kPriorityCount = 2;
+
+  struct WorkerQueue {
+    std::mutex mutex;
+    // Indexed by |ConcurrentTaskPriority|.
+    std::deque<fml::closure> tasks[kPriorityCount];
+    std::vector<fml::closure> thread_tasks;
+    // Set while |thread_tasks| is not empty, so that the worker doesn't have
+    // to acquire the mutex to find out.
+    std::atomic_bool has_thread_tasks = false;
+  };
+
   size_t worker_count_ = 0;
   std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+  // Held by workers waiting on |tasks_condition_| and by the threads that
+  // notify it.
   std::mutex tasks_mutex_;
   std::condition_variable tasks_condition_;
-  std::queue<fml::closure> tasks_;
-  std::vector<std::thread::id> worker_thread_ids_;
-  std::map<std::thread::id, std::vector<fml::closure>> thread_tasks_;
-  bool shutdown_ = false;
+  // The number of tasks queued on all the workers, not counting thread tasks.
+  std::atomic_size_t pending_task_count_ = 0;
+  std::atomic_size_t idle_worker_count_ = 0;
+  std::atomic_size_t next_worker_ = 0;
+  std::atomic_bool shutdown_ = false;
 
-  void WorkerMain();
+  void WorkerMain(size_t worker_index);
 
-  void PostTask(const fml::closure& task);
+  void PostTask(const fml::closure& task, ConcurrentTaskPriority priority);
 
-  bool HasThreadTasksLocked() const;
+  void PostTasks(std::vector<fml::closure> tasks,
+                 ConcurrentTaskPriority priority);
 
-  std::vector<fml::closure> GetThreadTasksLocked();
+  // Returns the next task that the worker at |worker_index| should run,
+  // which is taken from another worker if it has none, or nullptr if there
+  // are no tasks queued.
+  fml::closure TakeTask(size_t worker_index);
+
+  std::vector<fml::closure> TakeThreadTasks(size_t worker_index);
+
+  // Wakes up as many of the waiting workers as are needed to run
+  // |task_count| newly queued tasks.
+  void NotifyIdleWorkers(size_t task_count);
+
+  // Returns the index of the worker that is the calling thread, or
+  // |worker_count_| if there is none.
+  size_t GetCurrentWorkerIndex() const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ConcurrentMessageLoop);
 };
@@ -71,6 +129,15 @@ class ConcurrentTaskRunner : public BasicTaskRunner {
 
   void PostTask(const fml::closure& task) override;
 
+  void PostTask(const fml::closure& task, ConcurrentTaskPriority priority);
+
+  /// Posts all of |tasks| at once, which takes each queue lock once and
+  /// wakes up no more workers than there are tasks, instead of doing both
+  /// for every task.
+  void PostTasks(
+      std::vector<fml::closure> tasks,
+      ConcurrentTaskPriority priority = ConcurrentTaskPriority::kBackground);
+
  private:
   friend ConcurrentMessageLoop;
 
@@ -11,11 +11,13 @@ namespace fml {
 DelayedTask::DelayedTask(size_t order,
                          const fml::closure& task,
                          fml::TimePoint target_time,
-                         fml::TaskSourceGrade task_source_grade)
+                         fml::TaskSourceGrade task_source_grade,
+                         fml::TimePoint deadline)
     : order_(order),
       task_(task),
       target_time_(target_time),
-      task_source_grade_(task_source_grade) {}
+      task_source_grade_(task_source_grade),
+      deadline_(deadline) {}
 
 DelayedTask::~DelayedTask() = default;
 
@@ -33,6 +35,14 @@ fml::TaskSourceGrade DelayedTask::GetTaskSourceGrade() const {
   return task_source_grade_;
 }
 
+fml::TimePoint DelayedTask::GetDeadline() const {
+  return deadline_;
+}
+
+bool DelayedTask::HasDeadline() const {
+  return deadline_ != fml::TimePoint::Max();
+}
+
 bool DelayedTask::operator>(const DelayedTask& other) const {
   if (target_time_ == other.target_time_) {
     return order_ > other.order_;
@@ -40,4 +50,11 @@ bool DelayedTask::operator>(const DelayedTask& other) const {
   return target_time_ > other.target_time_;
 }
 
+bool DelayedTask::HasLaterDeadlineThan(const DelayedTask& other) const {
+  if (deadline_ == other.deadline_) {
+    return *this > other;
+  }
+  return deadline_ > other.deadline_;
+}
+
 }  // namespace fml
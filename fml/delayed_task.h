@@ -18,7 +18,8 @@ class DelayedTask {
   DelayedTask(size_t order,
               const fml::closure& task,
               fml::TimePoint target_time,
-              fml::TaskSourceGrade task_source_grade);
+              fml::TaskSourceGrade task_source_grade,
+              fml::TimePoint deadline = fml::TimePoint::Max());
 
   DelayedTask(const DelayedTask& other);
 
@@ -30,19 +31,42 @@ class DelayedTask {
 
   fml::TaskSourceGrade GetTaskSourceGrade() const;
 
+  /// The time by which the task should have run, or |TimePoint::Max| if the
+  /// task has no deadline.
+  fml::TimePoint GetDeadline() const;
+
+  bool HasDeadline() const;
+
+  /// Orders tasks by target time, then by the order they were posted in.
   bool operator>(const DelayedTask& other) const;
 
+  /// Orders tasks by deadline, then as |operator>| does. Tasks without a
+  /// deadline are ordered after the tasks with one.
+  bool HasLaterDeadlineThan(const DelayedTask& other) const;
+
  private:
   size_t order_;
   fml::closure task_;
   fml::TimePoint target_time_;
   fml::TaskSourceGrade task_source_grade_;
+  fml::TimePoint deadline_;
 };
 
 using DelayedTaskQueue = std::priority_queue<DelayedTask,
                                              std::deque<DelayedTask>,
                                              std::greater<DelayedTask>>;
 
+struct DelayedTaskDeadlineGreater {
+  bool operator()(const DelayedTask& a, const DelayedTask& b) const {
+    return a.HasLaterDeadlineThan(b);
+  }
+};
+
+/// A queue of tasks that are due, ordered by deadline.
+using DueTaskQueue = std::priority_queue<DelayedTask,
+                                         std::deque<DelayedTask>,
+                                         DelayedTaskDeadlineGreater>;
+
 }  // namespace fml
 
 #endif  // FLUTTER_FML_DELAYED_TASK_H_
@@ -326,6 +326,49 @@ TEST(FileTest, MappingDontNeedSafeTest) {
   ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
 }
 
+TEST(FileTest, MappingAccessHintsTest) {
+  fml::ScopedTemporaryDirectory dir;
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", true,
+                              fml::FilePermission::kReadWrite);
+    WriteStringToFile(file, std::string(10000, 'a'));
+  }
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", false,
+                              fml::FilePermission::kRead);
+    fml::FileMapping mapping(file);
+    ASSERT_TRUE(mapping.IsValid());
+#if FML_OS_WIN
+    ASSERT_FALSE(mapping.Advise(fml::FileMapping::AccessPattern::kSequential));
+    ASSERT_FALSE(mapping.Prefetch());
+#else
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::AccessPattern::kSequential));
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::AccessPattern::kNormal));
+    ASSERT_TRUE(mapping.Prefetch());
+    // Ranges that don't start on a page boundary or run past the end are
+    // fine.
+    ASSERT_TRUE(mapping.Prefetch(5000, 100000));
+#endif  // FML_OS_WIN
+    ASSERT_FALSE(mapping.Prefetch(10000, 1));
+    // The hints don't change the contents.
+    ASSERT_EQ(mapping.GetMapping()[9999], 'a');
+  }
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "empty", true,
+                              fml::FilePermission::kReadWrite);
+    fml::FileMapping mapping(file);
+    ASSERT_TRUE(mapping.IsValid());
+    ASSERT_FALSE(mapping.Advise(fml::FileMapping::AccessPattern::kRandom));
+    ASSERT_FALSE(mapping.Prefetch());
+  }
+
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "empty"));
+}
+
 TEST(FileTest, FileTestsWork) {
   fml::ScopedTemporaryDirectory dir;
   ASSERT_TRUE(dir.fd().is_valid());
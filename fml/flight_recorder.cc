@@ -0,0 +1,186 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/flight_recorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/thread_local.h"
+
+namespace fml {
+
+namespace {
+
+struct Slot {
+  std::atomic<const char*> name = nullptr;
+  std::atomic<int64_t> start = 0;
+  std::atomic<int64_t> duration = 0;
+  std::atomic<uint64_t> id = 0;
+};
+
+// The ring buffer of a thread. Only the thread it is leased to writes to it.
+// Events are numbered from the creation of the buffer, and the event with
+// number |n| is stored in slot |n % kEventsPerThread|.
+struct ThreadBuffer {
+  // The number of events whose write has begun, and should not be trusted
+  // in the slot they overwrite by readers.
+  std::atomic<uint64_t> begun = 0;
+  // The number of events that have been written completely.
+  std::atomic<uint64_t> ended = 0;
+
+  // These are guarded by the registry mutex.
+  bool in_use = false;
+  std::string thread_name;
+  // The number of the first event that was recorded after the last clear.
+  uint64_t first = 0;
+
+  Slot slots[FlightRecorder::kEventsPerThread];
+};
+
+struct Registry {
+  std::mutex mutex;
+  // Buffers outlive the threads they are leased to so that the events of
+  // threads that have exited can still be dumped, until the buffer is leased
+  // to another thread.
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& GetRegistry() {
+  // Intentionally leaked, threads may record events while the process exits.
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+// Gives the buffer of a thread back to the registry when the thread exits.
+class BufferLease {
+ public:
+  explicit BufferLease(ThreadBuffer* buffer) : buffer_(buffer) {}
+
+  ~BufferLease() {
+    std::scoped_lock lock(GetRegistry().mutex);
+    buffer_->in_use = false;
+  }
+
+  ThreadBuffer* buffer() const { return buffer_; }
+
+ private:
+  ThreadBuffer* buffer_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(BufferLease);
+};
+
+FML_THREAD_LOCAL ThreadLocalUniquePtr<BufferLease> tls_buffer_lease;
+
+ThreadBuffer* GetCurrentThreadBuffer() {
+  BufferLease* lease = tls_buffer_lease.get();
+  if (lease) {
+    return lease->buffer();
+  }
+
+  ThreadBuffer* buffer = nullptr;
+  {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+    for (const auto& candidate : registry.buffers) {
+      if (!candidate->in_use) {
+        buffer = candidate.get();
+        break;
+      }
+    }
+    if (!buffer) {
+      registry.buffers.push_back(std::make_unique<ThreadBuffer>());
+      buffer = registry.buffers.back().get();
+    }
+    buffer->in_use = true;
+    buffer->thread_name.clear();
+    buffer->first = buffer->ended.load(std::memory_order_relaxed);
+  }
+  tls_buffer_lease.reset(new BufferLease(buffer));
+  return buffer;
+}
+
+}  // namespace
+
+void FlightRecorder::Record(const char* name,
+                            TimePoint start,
+                            TimeDelta duration,
+                            uint64_t id) {
+  ThreadBuffer* buffer = GetCurrentThreadBuffer();
+  uint64_t index = buffer->ended.load(std::memory_order_relaxed);
+  buffer->begun.store(index + 1, std::memory_order_relaxed);
+  // Makes the slot stores below visible after the store to |begun|, so
+  // that a reader that sees them also sees that the slot is being rewritten.
+  std::atomic_thread_fence(std::memory_order_release);
+
+  Slot& slot = buffer->slots[index % kEventsPerThread];
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.start.store(start.ToEpochDelta().ToNanoseconds(),
+                   std::memory_order_relaxed);
+  slot.duration.store(duration.ToNanoseconds(), std::memory_order_relaxed);
+  slot.id.store(id, std::memory_order_relaxed);
+  buffer->ended.store(index + 1, std::memory_order_release);
+}
+
+void FlightRecorder::SetCurrentThreadName(const std::string& name) {
+  ThreadBuffer* buffer = GetCurrentThreadBuffer();
+  std::scoped_lock lock(GetRegistry().mutex);
+  buffer->thread_name = name;
+}
+
+std::vector<FlightRecorder::ThreadEvents> FlightRecorder::Dump() {
+  std::vector<ThreadEvents> result;
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (const auto& buffer : registry.buffers) {
+    uint64_t end = buffer->ended.load(std::memory_order_acquire);
+    uint64_t begin = std::max(
+        buffer->first, end > kEventsPerThread ? end - kEventsPerThread : 0);
+    if (begin == end) {
+      continue;
+    }
+
+    ThreadEvents thread_events;
+    thread_events.thread_name = buffer->thread_name;
+    thread_events.events.reserve(end - begin);
+    for (uint64_t index = begin; index < end; index++) {
+      const Slot& slot = buffer->slots[index % kEventsPerThread];
+      thread_events.events.push_back({
+          slot.name.load(std::memory_order_relaxed),
+          TimePoint::FromEpochDelta(TimeDelta::FromNanoseconds(
+              slot.start.load(std::memory_order_relaxed))),
+          TimeDelta::FromNanoseconds(
+              slot.duration.load(std::memory_order_relaxed)),
+          slot.id.load(std::memory_order_relaxed),
+      });
+    }
+
+    // The thread may have gone on recording while the slots were copied.
+    // The events it has begun to overwrite since then are dropped.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t begun = buffer->begun.load(std::memory_order_relaxed);
+    if (begun > kEventsPerThread && begun - kEventsPerThread > begin) {
+      uint64_t overwritten = std::min(begun - kEventsPerThread, end) - begin;
+      thread_events.events.erase(thread_events.events.begin(),
+                                 thread_events.events.begin() + overwritten);
+    }
+    if (!thread_events.events.empty()) {
+      result.push_back(std::move(thread_events));
+    }
+  }
+  return result;
+}
+
+void FlightRecorder::Clear() {
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (const auto& buffer : registry.buffers) {
+    buffer->first = buffer->ended.load(std::memory_order_acquire);
+  }
+}
+
+}  // namespace fml
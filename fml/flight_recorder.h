@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_FLIGHT_RECORDER_H_
+#define FLUTTER_FML_FLIGHT_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// @brief      An always-on record of the most recent events of each thread,
+///             such as the phases of the last frames, that can be dumped
+///             after the fact to investigate a jank reported in production.
+///
+///             Unlike the events in `trace_event.h`, the events are kept
+///             whether or not tracing is enabled. Each thread records into a
+///             ring buffer of its own that holds the last
+///             `kEventsPerThread` events, without taking any lock, so that
+///             recording an event costs a few stores.
+///
+class FlightRecorder {
+ public:
+  static constexpr size_t kEventsPerThread = 512;
+
+  struct Event {
+    /// Must outlive the recorder, in practice a string literal.
+    const char* name;
+    TimePoint start;
+    TimeDelta duration;
+    /// An identifier for the work the event belongs to, such as the number
+    /// of the frame it is part of.
+    uint64_t id;
+  };
+
+  struct ThreadEvents {
+    std::string thread_name;
+    /// The events of the thread, from the oldest to the most recent.
+    std::vector<Event> events;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records an event on the buffer of the current thread.
+  ///
+  static void Record(const char* name,
+                     TimePoint start,
+                     TimeDelta duration,
+                     uint64_t id);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Names the buffer of the current thread in dumps.
+  ///
+  static void SetCurrentThreadName(const std::string& name);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns a copy of the events recorded by the threads that
+  ///             have recorded any. This may be called from any thread, while
+  ///             the other threads keep recording.
+  ///
+  static std::vector<ThreadEvents> Dump();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Discards the events recorded so far by all threads.
+  ///
+  static void Clear();
+
+ private:
+  FlightRecorder() = delete;
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_FLIGHT_RECORDER_H_
@@ -0,0 +1,23 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/flight_recorder.h"
+
+#include "flutter/benchmarking/benchmarking.h"
+
+namespace fml {
+namespace benchmarking {
+
+static void BM_FlightRecorderRecord(benchmark::State& state) {  // NOLINT
+  TimePoint start = TimePoint::Now();
+  uint64_t id = 0;
+  while (state.KeepRunning()) {
+    FlightRecorder::Record("Event", start, TimeDelta::Zero(), id++);
+  }
+}
+
+BENCHMARK(BM_FlightRecorderRecord)->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace benchmarking
+}  // namespace fml
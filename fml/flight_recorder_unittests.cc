@@ -0,0 +1,136 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/flight_recorder.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+const FlightRecorder::ThreadEvents* FindThread(
+    const std::vector<FlightRecorder::ThreadEvents>& dump,
+    const std::string& thread_name) {
+  for (const auto& thread_events : dump) {
+    if (thread_events.thread_name == thread_name) {
+      return &thread_events;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(FlightRecorderTest, RecordsEventsOfCurrentThread) {
+  std::thread thread([]() {
+    FlightRecorder::SetCurrentThreadName("recorder_test");
+    TimePoint start = TimePoint::Now();
+    FlightRecorder::Record("Build", start, TimeDelta::FromMilliseconds(3), 1);
+    FlightRecorder::Record("Raster", start, TimeDelta::FromMilliseconds(5), 1);
+  });
+  thread.join();
+
+  auto dump = FlightRecorder::Dump();
+  auto thread_events = FindThread(dump, "recorder_test");
+  ASSERT_NE(thread_events, nullptr);
+  ASSERT_EQ(thread_events->events.size(), 2u);
+  EXPECT_STREQ(thread_events->events[0].name, "Build");
+  EXPECT_EQ(thread_events->events[0].duration, TimeDelta::FromMilliseconds(3));
+  EXPECT_STREQ(thread_events->events[1].name, "Raster");
+  EXPECT_EQ(thread_events->events[1].duration, TimeDelta::FromMilliseconds(5));
+  EXPECT_EQ(thread_events->events[1].id, 1u);
+}
+
+TEST(FlightRecorderTest, KeepsTheMostRecentEvents) {
+  constexpr size_t kExtraEvents = 10;
+  std::thread thread([]() {
+    FlightRecorder::SetCurrentThreadName("recorder_test_wrap");
+    for (size_t i = 0; i < FlightRecorder::kEventsPerThread + kExtraEvents;
+         i++) {
+      FlightRecorder::Record("Event", TimePoint::Now(), TimeDelta::Zero(), i);
+    }
+  });
+  thread.join();
+
+  auto dump = FlightRecorder::Dump();
+  auto thread_events = FindThread(dump, "recorder_test_wrap");
+  ASSERT_NE(thread_events, nullptr);
+  ASSERT_EQ(thread_events->events.size(), FlightRecorder::kEventsPerThread);
+  for (size_t i = 0; i < FlightRecorder::kEventsPerThread; i++) {
+    EXPECT_EQ(thread_events->events[i].id, i + kExtraEvents);
+  }
+}
+
+TEST(FlightRecorderTest, NamesThreadsAfterFmlThreads) {
+  fml::Thread thread("recorder_fml_thread");
+  fml::AutoResetWaitableEvent latch;
+  thread.GetTaskRunner()->PostTask([&latch]() {
+    FlightRecorder::Record("Event", TimePoint::Now(), TimeDelta::Zero(), 0);
+    latch.Signal();
+  });
+  latch.Wait();
+
+  auto dump = FlightRecorder::Dump();
+  EXPECT_NE(FindThread(dump, "recorder_fml_thread"), nullptr);
+}
+
+TEST(FlightRecorderTest, ClearDiscardsRecordedEvents) {
+  fml::Thread thread("recorder_clear_thread");
+  fml::AutoResetWaitableEvent latch;
+  auto record = [&latch](uint64_t id) {
+    FlightRecorder::Record("Event", TimePoint::Now(), TimeDelta::Zero(), id);
+    latch.Signal();
+  };
+  thread.GetTaskRunner()->PostTask([&record]() { record(1); });
+  latch.Wait();
+  FlightRecorder::Clear();
+  EXPECT_EQ(FindThread(FlightRecorder::Dump(), "recorder_clear_thread"),
+            nullptr);
+
+  thread.GetTaskRunner()->PostTask([&record]() { record(2); });
+  latch.Wait();
+  auto dump = FlightRecorder::Dump();
+  auto thread_events = FindThread(dump, "recorder_clear_thread");
+  ASSERT_NE(thread_events, nullptr);
+  ASSERT_EQ(thread_events->events.size(), 1u);
+  EXPECT_EQ(thread_events->events[0].id, 2u);
+}
+
+TEST(FlightRecorderTest, DumpsWhileThreadsRecord) {
+  std::atomic_bool done = false;
+  std::thread thread([&done]() {
+    FlightRecorder::SetCurrentThreadName("recorder_test_concurrent");
+    uint64_t id = 0;
+    while (!done.load()) {
+      FlightRecorder::Record("Event", TimePoint::Now(), TimeDelta::Zero(),
+                             id++);
+    }
+  });
+
+  for (size_t i = 0; i < 100; i++) {
+    auto dump = FlightRecorder::Dump();
+    auto thread_events = FindThread(dump, "recorder_test_concurrent");
+    if (!thread_events) {
+      continue;
+    }
+    ASSERT_LE(thread_events->events.size(), FlightRecorder::kEventsPerThread);
+    for (size_t j = 1; j < thread_events->events.size(); j++) {
+      ASSERT_EQ(thread_events->events[j].id,
+                thread_events->events[j - 1].id + 1);
+    }
+  }
+  done.store(true);
+  thread.join();
+}
+
+}  // namespace testing
+}  // namespace fml
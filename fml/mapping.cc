@@ -5,10 +5,20 @@
 #include "flutter/fml/mapping.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <sstream>
 
+#include "flutter/fml/build_config.h"
+
+#if FML_OS_LINUX || (FML_OS_ANDROID && __ANDROID_API__ >= 21)
+#define FML_SYMBOL_MAPPING_PREFETCH 1
+#include <link.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace fml {
 
 // FileMapping
@@ -196,4 +206,51 @@ bool SymbolMapping::IsDontNeedSafe() const {
   return true;
 }
 
+#if FML_SYMBOL_MAPPING_PREFETCH
+namespace {
+struct LoadSegment {
+  uintptr_t address = 0;
+  uintptr_t start = 0;
+  uintptr_t end = 0;
+};
+}  // namespace
+
+static int FindLoadSegment(struct dl_phdr_info* info, size_t, void* data) {
+  auto* segment = static_cast<LoadSegment*>(data);
+  for (size_t i = 0; i < info->dlpi_phnum; i++) {
+    const auto& header = info->dlpi_phdr[i];
+    if (header.p_type != PT_LOAD) {
+      continue;
+    }
+    const uintptr_t start = info->dlpi_addr + header.p_vaddr;
+    const uintptr_t end = start + header.p_memsz;
+    if (segment->address >= start && segment->address < end) {
+      segment->start = start;
+      segment->end = end;
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif  // FML_SYMBOL_MAPPING_PREFETCH
+
+bool SymbolMapping::Prefetch() const {
+#if FML_SYMBOL_MAPPING_PREFETCH
+  if (mapping_ == nullptr) {
+    return false;
+  }
+  LoadSegment segment;
+  segment.address = reinterpret_cast<uintptr_t>(mapping_);
+  if (::dl_iterate_phdr(&FindLoadSegment, &segment) == 0) {
+    return false;
+  }
+  static const uintptr_t kPageSize = ::sysconf(_SC_PAGESIZE);
+  const uintptr_t start = segment.start - segment.start % kPageSize;
+  return ::madvise(reinterpret_cast<void*>(start), segment.end - start,
+                   MADV_WILLNEED) == 0;
+#else
+  return false;
+#endif  // FML_SYMBOL_MAPPING_PREFETCH
+}
+
 }  // namespace fml
@@ -6,6 +6,7 @@
 #define FLUTTER_FML_MAPPING_H_
 
 #include <initializer_list>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,6 +45,12 @@ class FileMapping final : public Mapping {
     kExecute,
   };
 
+  enum class AccessPattern {
+    kNormal,
+    kSequential,
+    kRandom,
+  };
+
   explicit FileMapping(const fml::UniqueFD& fd,
                        std::initializer_list<Protection> protection = {
                            Protection::kRead});
@@ -76,6 +83,17 @@ class FileMapping final : public Mapping {
 
   bool IsValid() const;
 
+  // Hints how the mapping will be read so that the kernel can read ahead
+  // accordingly. Returns false if the hint is not supported or was rejected.
+  bool Advise(AccessPattern pattern) const;
+
+  // Asks for the pages holding the |length| bytes at |offset| to be read in
+  // the background, so the first reads of the range don't block on disk. The
+  // range is clamped to the mapping. Returns false if the hint is not
+  // supported or was rejected.
+  bool Prefetch(size_t offset = 0,
+                size_t length = std::numeric_limits<size_t>::max()) const;
+
  private:
   bool valid_ = false;
   size_t size_ = 0;
@@ -207,6 +225,12 @@ class SymbolMapping final : public Mapping {
   // |Mapping|
   bool IsDontNeedSafe() const override;
 
+  // Asks for the pages of the loaded library segment that holds the symbol to
+  // be read in the background. The size of a symbol isn't known, so this
+  // covers the whole segment. Returns false if the hint is not supported or
+  // the segment could not be found.
+  bool Prefetch() const;
+
  private:
   fml::RefPtr<fml::NativeLibrary> native_library_;
   const uint8_t* mapping_ = nullptr;
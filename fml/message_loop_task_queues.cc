@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <optional>
 
@@ -30,13 +31,48 @@ class TaskSourceGradeHolder {
   explicit TaskSourceGradeHolder(TaskSourceGrade task_source_grade_arg)
       : task_source_grade(task_source_grade_arg) {}
 };
+
+// The wake time of a queue whose loop might not wake up on its own, which is
+// that of |TimePoint::Max|.
+constexpr int64_t kNoWakeTime = std::numeric_limits<int64_t>::max();
+
 }  // namespace
 
 FML_THREAD_LOCAL ThreadLocalUniquePtr<TaskSourceGradeHolder>
     tls_task_source_grade;
 
+TaskInbox::~TaskInbox() {
+  TakeAll();
+}
+
+void TaskInbox::Push(const DelayedTask& task) {
+  Node* node = new Node{task, head_.load(std::memory_order_relaxed)};
+  while (!head_.compare_exchange_weak(node->next, node)) {
+    // |node->next| has been updated to the current head, try again.
+  }
+}
+
+bool TaskInbox::IsEmpty() const {
+  return head_.load() == nullptr;
+}
+
+std::vector<DelayedTask> TaskInbox::TakeAll() {
+  std::vector<DelayedTask> tasks;
+  Node* node = head_.exchange(nullptr);
+  while (node) {
+    tasks.push_back(std::move(node->task));
+    Node* next = node->next;
+    delete node;
+    node = next;
+  }
+  std::reverse(tasks.begin(), tasks.end());
+  return tasks;
+}
+
 TaskQueueEntry::TaskQueueEntry(TaskQueueId created_for_arg)
-    : subsumed_by(kUnmerged), created_for(created_for_arg) {
+    : subsumed_by(kUnmerged),
+      created_for(created_for_arg),
+      wake_time(kNoWakeTime) {
   wakeable = NULL;
   task_observers = TaskObservers();
   task_source = std::make_unique<TaskSource>(created_for);
@@ -48,6 +84,7 @@ MessageLoopTaskQueues* MessageLoopTaskQueues::GetInstance() {
 }
 
 TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   TaskQueueId loop_id = TaskQueueId(task_queue_id_counter_);
   ++task_queue_id_counter_;
@@ -55,7 +92,8 @@ TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
   return loop_id;
 }
 
-MessageLoopTaskQueues::MessageLoopTaskQueues() : order_(0) {
+MessageLoopTaskQueues::MessageLoopTaskQueues()
+    : entries_mutex_(fml::SharedMutex::Create()), order_(0) {
   tls_task_source_grade.reset(
       new TaskSourceGradeHolder{TaskSourceGrade::kUnspecified});
 }
@@ -63,6 +101,7 @@ MessageLoopTaskQueues::MessageLoopTaskQueues() : order_(0) {
 MessageLoopTaskQueues::~MessageLoopTaskQueues() = default;
 
 void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
+  fml::UniqueLock entries_lock(*entries_mutex_);
   std::lock_guard guard(queue_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == kUnmerged);
@@ -79,6 +118,7 @@ void MessageLoopTaskQueues::DisposeTasks(TaskQueueId queue_id) {
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == kUnmerged);
   auto& subsumed_set = queue_entry->owner_of;
+  DrainInboxesUnlocked(queue_id);
   queue_entry->task_source->ShutDown();
   for (auto& subsumed : subsumed_set) {
     queue_entries_.at(subsumed)->task_source->ShutDown();
@@ -93,42 +133,67 @@ void MessageLoopTaskQueues::RegisterTask(
     TaskQueueId queue_id,
     const fml::closure& task,
     fml::TimePoint target_time,
-    fml::TaskSourceGrade task_source_grade) {
-  std::lock_guard guard(queue_mutex_);
+    fml::TaskSourceGrade task_source_grade,
+    fml::TimePoint deadline) {
+  fml::SharedLock entries_lock(*entries_mutex_);
   size_t order = order_++;
   const auto& queue_entry = queue_entries_.at(queue_id);
-  queue_entry->task_source->RegisterTask(
-      {order, task, target_time, task_source_grade});
+  if (task_source_grade == fml::TaskSourceGrade::kDartMicroTasks) {
+    deadline = fml::TimePoint::Max();
+  }
+  queue_entry->inbox.Push(
+      {order, task, target_time, task_source_grade, deadline});
+
+  // The loop will pick the task up when it next looks for tasks to run, so
+  // it only needs to be woken up if that is later than the task is due.
+  // This load is ordered after the push above, and the stores of the wake
+  // time are ordered before the inboxes are checked again, see
+  // |WakeUpForNextTaskUnlocked|, so either this sees the new wake time or
+  // the loop sees the task.
+  int64_t wake_time = queue_entry->wake_time.load();
+  if (wake_time != kNoWakeTime &&
+      wake_time <= target_time.ToEpochDelta().ToNanoseconds()) {
+    return;
+  }
+
+  std::lock_guard guard(queue_mutex_);
   TaskQueueId loop_to_wake = queue_id;
   if (queue_entry->subsumed_by != kUnmerged) {
     loop_to_wake = queue_entry->subsumed_by;
   }
-
-  // This can happen when the secondary tasks are paused.
-  if (HasPendingTasksUnlocked(loop_to_wake)) {
-    WakeUpUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
-  }
+  WakeUpForNextTaskUnlocked(loop_to_wake);
 }
 
 bool MessageLoopTaskQueues::HasPendingTasks(TaskQueueId queue_id) const {
   std::lock_guard guard(queue_mutex_);
+  DrainInboxesUnlocked(queue_id);
   return HasPendingTasksUnlocked(queue_id);
 }
 
 fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
                                                      fml::TimePoint from_time) {
   std::lock_guard guard(queue_mutex_);
+  do {
+    DrainInboxesUnlocked(queue_id);
+    if (!HasPendingTasksUnlocked(queue_id)) {
+      // The loop is not going to wake up for this queue on its own, so the
+      // next task registered for it has to wake it up.
+      queue_entries_.at(queue_id)->wake_time = kNoWakeTime;
+    } else {
+      WakeUpUnlocked(queue_id, GetNextWakeTimeUnlocked(queue_id));
+    }
+    // Tasks registered while the wake time was being updated might not have
+    // woken up the loop, and might have to run first.
+  } while (HasInboxedTasksUnlocked(queue_id));
+
   if (!HasPendingTasksUnlocked(queue_id)) {
     return nullptr;
   }
+  PromoteDueTasksUnlocked(queue_id, from_time);
+  // Peeked only once the inboxes are drained and the due tasks promoted, as
+  // both can move the tasks that |TopTask| refers to.
   TaskSource::TopTask top = PeekNextTaskUnlocked(queue_id);
 
-  if (!HasPendingTasksUnlocked(queue_id)) {
-    WakeUpUnlocked(queue_id, fml::TimePoint::Max());
-  } else {
-    WakeUpUnlocked(queue_id, GetNextWakeTimeUnlocked(queue_id));
-  }
-
   if (top.task.GetTargetTime() > from_time) {
     return nullptr;
   }
@@ -142,9 +207,47 @@ fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
 
 void MessageLoopTaskQueues::WakeUpUnlocked(TaskQueueId queue_id,
                                            fml::TimePoint time) const {
-  if (queue_entries_.at(queue_id)->wakeable) {
-    queue_entries_.at(queue_id)->wakeable->WakeUp(time);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  if (queue_entry->wakeable) {
+    queue_entry->wake_time = time.ToEpochDelta().ToNanoseconds();
+    queue_entry->wakeable->WakeUp(time);
+  }
+}
+
+void MessageLoopTaskQueues::WakeUpForNextTaskUnlocked(
+    TaskQueueId queue_id) const {
+  do {
+    DrainInboxesUnlocked(queue_id);
+    // This can happen when the secondary tasks are paused.
+    if (HasPendingTasksUnlocked(queue_id)) {
+      WakeUpUnlocked(queue_id, GetNextWakeTimeUnlocked(queue_id));
+    }
+  } while (HasInboxedTasksUnlocked(queue_id));
+}
+
+void MessageLoopTaskQueues::DrainInboxesUnlocked(TaskQueueId queue_id) const {
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  for (const DelayedTask& task : queue_entry->inbox.TakeAll()) {
+    queue_entry->task_source->RegisterTask(task);
+  }
+  for (TaskQueueId subsumed : queue_entry->owner_of) {
+    const auto& subsumed_entry = queue_entries_.at(subsumed);
+    for (const DelayedTask& task : subsumed_entry->inbox.TakeAll()) {
+      subsumed_entry->task_source->RegisterTask(task);
+    }
+  }
+}
+
+bool MessageLoopTaskQueues::HasInboxedTasksUnlocked(
+    TaskQueueId queue_id) const {
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  if (!queue_entry->inbox.IsEmpty()) {
+    return true;
   }
+  return std::any_of(queue_entry->owner_of.begin(),
+                     queue_entry->owner_of.end(), [&](TaskQueueId subsumed) {
+                       return !queue_entries_.at(subsumed)->inbox.IsEmpty();
+                     });
 }
 
 size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
@@ -153,6 +256,7 @@ size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
   if (queue_entry->subsumed_by != kUnmerged) {
     return 0;
   }
+  DrainInboxesUnlocked(queue_id);
 
   size_t total_tasks = 0;
   total_tasks += queue_entry->task_source->GetNumPendingTasks();
@@ -253,10 +357,10 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   // All checking is OK, set merged state.
   owner_entry->owner_of.insert(subsumed);
   subsumed_entry->subsumed_by = owner;
+  // Tasks registered for the subsumed queue have to wake up the owner.
+  subsumed_entry->wake_time = kNoWakeTime;
 
-  if (HasPendingTasksUnlocked(owner)) {
-    WakeUpUnlocked(owner, GetNextWakeTimeUnlocked(owner));
-  }
+  WakeUpForNextTaskUnlocked(owner);
 
   return true;
 }
@@ -293,13 +397,8 @@ bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
   queue_entries_.at(subsumed)->subsumed_by = kUnmerged;
   owner_entry->owner_of.erase(subsumed);
 
-  if (HasPendingTasksUnlocked(owner)) {
-    WakeUpUnlocked(owner, GetNextWakeTimeUnlocked(owner));
-  }
-
-  if (HasPendingTasksUnlocked(subsumed)) {
-    WakeUpUnlocked(subsumed, GetNextWakeTimeUnlocked(subsumed));
-  }
+  WakeUpForNextTaskUnlocked(owner);
+  WakeUpForNextTaskUnlocked(subsumed);
 
   return true;
 }
@@ -329,9 +428,7 @@ void MessageLoopTaskQueues::ResumeSecondarySource(TaskQueueId queue_id) {
   std::lock_guard guard(queue_mutex_);
   queue_entries_.at(queue_id)->task_source->ResumeSecondary();
   // Schedule a wake as needed.
-  if (HasPendingTasksUnlocked(queue_id)) {
-    WakeUpUnlocked(queue_id, GetNextWakeTimeUnlocked(queue_id));
-  }
+  WakeUpForNextTaskUnlocked(queue_id);
 }
 
 // Subsumed queues will never have pending tasks.
@@ -376,7 +473,7 @@ TaskSource::TopTask MessageLoopTaskQueues::PeekNextTaskUnlocked(
       [&top_task](const TaskSource* source) {
         if (source && !source->IsEmpty()) {
           TaskSource::TopTask other_task = source->Top();
-          if (!top_task.has_value() || top_task->task > other_task.task) {
+          if (!top_task.has_value() || other_task.RunsBefore(*top_task)) {
             top_task.emplace(other_task);
           }
         }
@@ -397,4 +494,13 @@ TaskSource::TopTask MessageLoopTaskQueues::PeekNextTaskUnlocked(
   return top_task.value();
 }
 
+void MessageLoopTaskQueues::PromoteDueTasksUnlocked(TaskQueueId owner,
+                                                    fml::TimePoint now) const {
+  const auto& entry = queue_entries_.at(owner);
+  entry->task_source->PromoteDueTasks(now);
+  for (TaskQueueId subsumed : entry->owner_of) {
+    queue_entries_.at(subsumed)->task_source->PromoteDueTasks(now);
+  }
+}
+
 }  // namespace fml
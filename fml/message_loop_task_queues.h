@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FML_MESSAGE_LOOP_TASK_QUEUES_H_
 #define FLUTTER_FML_MESSAGE_LOOP_TASK_QUEUES_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,6 +25,33 @@ namespace fml {
 
 static const TaskQueueId kUnmerged = TaskQueueId(TaskQueueId::kUnmerged);
 
+/// A list of tasks that any number of threads can push to without locking,
+/// and that one thread at a time can take all of the tasks from.
+class TaskInbox {
+ public:
+  TaskInbox() = default;
+
+  ~TaskInbox();
+
+  void Push(const DelayedTask& task);
+
+  bool IsEmpty() const;
+
+  /// Removes all of the tasks from the inbox and returns them in the order in
+  /// which they were pushed.
+  std::vector<DelayedTask> TakeAll();
+
+ private:
+  struct Node {
+    DelayedTask task;
+    Node* next;
+  };
+
+  std::atomic<Node*> head_ = nullptr;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TaskInbox);
+};
+
 /// A collection of tasks and observers associated with one TaskQueue.
 ///
 /// Often a TaskQueue has a one-to-one relationship with a fml::MessageLoop,
@@ -46,6 +74,16 @@ class TaskQueueEntry {
 
   TaskQueueId created_for;
 
+  /// Tasks registered for this TaskQueue that have not been moved into
+  /// |task_source| yet.
+  TaskInbox inbox;
+
+  /// The time, in nanoseconds since the epoch, by which the loop that runs
+  /// the tasks of this TaskQueue is going to look for them. Tasks registered
+  /// for a later time don't need to wake the loop. |TimePoint::Max| means
+  /// that the loop might not wake up on its own.
+  std::atomic<int64_t> wake_time;
+
   explicit TaskQueueEntry(TaskQueueId created_for);
 
  private:
@@ -77,11 +115,17 @@ class MessageLoopTaskQueues {
 
   // Tasks methods.
 
-  void RegisterTask(TaskQueueId queue_id,
-                    const fml::closure& task,
-                    fml::TimePoint target_time,
-                    fml::TaskSourceGrade task_source_grade =
-                        fml::TaskSourceGrade::kUnspecified);
+  // Tasks with a |deadline| run before the other tasks that are due by the
+  // time the loop looks for tasks to run, earliest deadline first. Deadlines
+  // are ignored for |TaskSourceGrade::kDartMicroTasks|, which always run in
+  // the order they were posted in.
+  void RegisterTask(
+      TaskQueueId queue_id,
+      const fml::closure& task,
+      fml::TimePoint target_time,
+      fml::TaskSourceGrade task_source_grade =
+          fml::TaskSourceGrade::kUnspecified,
+      fml::TimePoint deadline = fml::TimePoint::Max());
 
   bool HasPendingTasks(TaskQueueId queue_id) const;
 
@@ -146,13 +190,33 @@ class MessageLoopTaskQueues {
 
   void WakeUpUnlocked(TaskQueueId queue_id, fml::TimePoint time) const;
 
+  // Wakes up the loop of |queue_id| for its next task, if it has one.
+  void WakeUpForNextTaskUnlocked(TaskQueueId queue_id) const;
+
+  // Moves the tasks in the inboxes of |queue_id| and of the queues it owns
+  // into their task sources.
+  void DrainInboxesUnlocked(TaskQueueId queue_id) const;
+
+  // Returns true if tasks have been registered for |queue_id| or for the
+  // queues it owns since their inboxes were last drained.
+  bool HasInboxedTasksUnlocked(TaskQueueId queue_id) const;
+
   bool HasPendingTasksUnlocked(TaskQueueId queue_id) const;
 
   TaskSource::TopTask PeekNextTaskUnlocked(TaskQueueId owner) const;
 
+  void PromoteDueTasksUnlocked(TaskQueueId owner, fml::TimePoint now) const;
+
   fml::TimePoint GetNextWakeTimeUnlocked(TaskQueueId queue_id) const;
 
+  // Guards everything but the inboxes and wake times of the entries.
   mutable std::mutex queue_mutex_;
+
+  // Guards the contents of |queue_entries_|. |RegisterTask| only holds it
+  // shared, and |queue_mutex_| only if it has to wake up a loop, so that
+  // threads posting tasks don't contend with each other or with the loops
+  // running them. Changes to |queue_entries_| hold both locks.
+  std::unique_ptr<fml::SharedMutex> entries_mutex_;
   std::map<TaskQueueId, std::unique_ptr<TaskQueueEntry>> queue_entries_;
 
   size_t task_queue_id_counter_ = 0;
@@ -66,5 +66,61 @@ static void BM_RegisterAndGetTasks(benchmark::State& state) {  // NOLINT
 
 BENCHMARK(BM_RegisterAndGetTasks);
 
+// Registers tasks on a single queue from |state.range(0)| threads at once
+// while the queue is drained on another thread, as happens with the UI and
+// platform task runners.
+static void BM_RegisterTasksFromManyThreads(  // NOLINT
+    benchmark::State& state) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  const int num_producers = state.range(0);
+  const int num_tasks_per_producer = 1000;
+  const fml::TimePoint past = fml::TimePoint::Now();
+
+  while (state.KeepRunning()) {
+    const TaskQueueId queue_id = task_queue->CreateTaskQueue();
+
+    std::vector<std::thread> threads;
+    CountDownLatch producers_ready(num_producers + 1);
+
+    threads.reserve(num_producers);
+    for (int i = 0; i < num_producers; i++) {
+      threads.emplace_back(
+          [queue_id, &task_queue, past, &producers_ready]() {
+            producers_ready.CountDown();
+            producers_ready.Wait();
+            for (int j = 0; j < num_tasks_per_producer; j++) {
+              task_queue->RegisterTask(queue_id, [] {}, past);
+            }
+          });
+    }
+
+    producers_ready.CountDown();
+    producers_ready.Wait();
+    const int num_tasks = num_producers * num_tasks_per_producer;
+    int num_invocations = 0;
+    while (num_invocations < num_tasks) {
+      fml::closure invocation =
+          task_queue->GetNextTaskToRun(queue_id, fml::TimePoint::Now());
+      if (invocation) {
+        num_invocations++;
+      }
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    task_queue->Dispose(queue_id);
+  }
+  state.SetItemsProcessed(state.iterations() * num_producers *
+                          num_tasks_per_producer);
+}
+
+BENCHMARK(BM_RegisterTasksFromManyThreads)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+
 }  // namespace benchmarking
 }  // namespace fml
@@ -118,6 +118,34 @@ TEST(MessageLoopTaskQueue, PreserveTaskOrdering) {
   }
 }
 
+TEST(MessageLoopTaskQueue, RunsTasksWithEarliestDeadlineFirst) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto platform_queue = task_queue->CreateTaskQueue();
+  auto raster_queue = task_queue->CreateTaskQueue();
+  task_queue->Merge(platform_queue, raster_queue);
+
+  const auto now = ChronoTicksSinceEpoch();
+  int test_val = 0;
+  task_queue->RegisterTask(
+      platform_queue, [&test_val]() { test_val = 1; }, now);
+  task_queue->RegisterTask(
+      raster_queue, [&test_val]() { test_val = 2; }, now,
+      fml::TaskSourceGrade::kUnspecified,
+      now + fml::TimeDelta::FromMilliseconds(16));
+  task_queue->RegisterTask(
+      platform_queue, [&test_val]() { test_val = 3; }, now,
+      fml::TaskSourceGrade::kUnspecified,
+      now + fml::TimeDelta::FromMilliseconds(8));
+
+  for (int expected : {3, 2, 1}) {
+    auto invocation = task_queue->GetNextTaskToRun(platform_queue, now);
+    ASSERT_TRUE(invocation != nullptr);
+    invocation();
+    ASSERT_EQ(test_val, expected);
+  }
+  ASSERT_FALSE(task_queue->HasPendingTasks(platform_queue));
+}
+
 TEST(MessageLoopTaskQueue, RegisterTasksOnMergedQueuesPreserveTaskOrdering) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto platform_queue = task_queue->CreateTaskQueue();
@@ -275,9 +303,37 @@ TEST(MessageLoopTaskQueue, WakeUpIndependentOfTime) {
   task_queue->RegisterTask(
       queue_id, []() {}, fml::TimePoint::Max());
 
+  // The loop is already going to wake up before the second task is due.
+  ASSERT_TRUE(num_wakes == 1);
+
+  task_queue->RegisterTask(
+      queue_id, []() {}, fml::TimePoint());
+
   ASSERT_TRUE(num_wakes == 2);
 }
 
+TEST(MessageLoopTaskQueue, WokenUpAgainOnceDrained) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  int num_wakes = 0;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&num_wakes](fml::TimePoint wake_time) { ++num_wakes; });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+
+  const auto now = ChronoTicksSinceEpoch();
+  task_queue->RegisterTask(
+      queue_id, []() {}, now);
+  ASSERT_TRUE(task_queue->GetNextTaskToRun(queue_id, now) != nullptr);
+  ASSERT_TRUE(task_queue->GetNextTaskToRun(queue_id, now) == nullptr);
+
+  // Nothing is going to wake up the loop for this task but the task itself.
+  int num_wakes_before = num_wakes;
+  task_queue->RegisterTask(
+      queue_id, []() {}, fml::TimePoint::Max());
+  ASSERT_TRUE(num_wakes == num_wakes_before + 1);
+}
+
 TEST(MessageLoopTaskQueue, WokenUpWithNewerTime) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto queue_id = task_queue->CreateTaskQueue();
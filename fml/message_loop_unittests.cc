@@ -6,14 +6,19 @@
 
 #include "flutter/fml/message_loop.h"
 
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <set>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/thread.h"
 #include "flutter/fml/time/chrono_timestamp_provider.h"
 #include "gtest/gtest.h"
 
@@ -178,6 +183,46 @@ TEST(MessageLoop, TaskObserverFire) {
   ASSERT_TRUE(terminated);
 }
 
+TEST(MessageLoop, RunNowOrPostTaskAndReplyRunsReplyOnReplyRunner) {
+  fml::Thread task_thread("task");
+  fml::Thread reply_thread("reply");
+  auto task_runner = task_thread.GetTaskRunner();
+  auto reply_runner = reply_thread.GetTaskRunner();
+  bool task_ran = false;
+  fml::AutoResetWaitableEvent latch;
+  fml::TaskRunner::RunNowOrPostTaskAndReply(
+      task_runner,
+      [&]() {
+        ASSERT_TRUE(task_runner->RunsTasksOnCurrentThread());
+        task_ran = true;
+      },
+      reply_runner,
+      [&]() {
+        ASSERT_TRUE(reply_runner->RunsTasksOnCurrentThread());
+        ASSERT_TRUE(task_ran);
+        latch.Signal();
+      });
+  latch.Wait();
+}
+
+TEST(MessageLoop, RunNowOrPostTaskAndReplyWithResultMovesResult) {
+  fml::Thread task_thread("task");
+  fml::Thread reply_thread("reply");
+  auto reply_runner = reply_thread.GetTaskRunner();
+  int value = 0;
+  fml::AutoResetWaitableEvent latch;
+  fml::TaskRunner::RunNowOrPostTaskAndReplyWithResult<std::unique_ptr<int>>(
+      task_thread.GetTaskRunner(), []() { return std::make_unique<int>(42); },
+      reply_runner,
+      [&](std::unique_ptr<int> result) {
+        ASSERT_TRUE(reply_runner->RunsTasksOnCurrentThread());
+        value = *result;
+        latch.Signal();
+      });
+  latch.Wait();
+  ASSERT_EQ(value, 42);
+}
+
 TEST(MessageLoop, ConcurrentMessageLoopHasNonZeroWorkers) {
   auto loop = fml::ConcurrentMessageLoop::Create(
       0u /* explicitly specify zero workers */);
@@ -212,3 +257,112 @@ TEST(MessageLoop, CanCreateConcurrentMessageLoop) {
   latch.Wait();
   ASSERT_GE(thread_ids.size(), 1u);
 }
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsLatencySensitiveTasksFirst) {
+  auto loop = fml::ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+  fml::AutoResetWaitableEvent worker_blocked;
+  fml::AutoResetWaitableEvent unblock_worker;
+  task_runner->PostTask([&]() {
+    worker_blocked.Signal();
+    unblock_worker.Wait();
+  });
+  worker_blocked.Wait();
+
+  const size_t kCount = 10;
+  fml::CountDownLatch latch(kCount + 1);
+  std::vector<bool> ran_latency_sensitive;
+  bool latency_sensitive_ran = false;
+  for (size_t i = 0; i < kCount; ++i) {
+    task_runner->PostTask([&]() {
+      ran_latency_sensitive.push_back(latency_sensitive_ran);
+      latch.CountDown();
+    });
+  }
+  task_runner->PostTask(
+      [&]() {
+        latency_sensitive_ran = true;
+        latch.CountDown();
+      },
+      fml::ConcurrentTaskPriority::kLatencySensitive);
+
+  unblock_worker.Signal();
+  latch.Wait();
+  ASSERT_EQ(ran_latency_sensitive.size(), kCount);
+  for (bool ran : ran_latency_sensitive) {
+    ASSERT_TRUE(ran);
+  }
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopWorkersStealTasks) {
+  auto loop = fml::ConcurrentMessageLoop::Create(2u);
+  auto task_runner = loop->GetTaskRunner();
+  const size_t kCount = 10;
+  fml::CountDownLatch latch(kCount);
+  fml::AutoResetWaitableEvent done;
+  // The tasks are queued on the worker that posts them, which doesn't run
+  // them until they have all been run, so they have to be taken by the other
+  // worker.
+  task_runner->PostTask([&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      task_runner->PostTask([&]() { latch.CountDown(); });
+    }
+    latch.Wait();
+    done.Signal();
+  });
+  done.Wait();
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsBatchesOfTasks) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  auto task_runner = loop->GetTaskRunner();
+  const size_t kCount = 1000;
+  fml::CountDownLatch latch(kCount);
+  std::vector<std::atomic_bool> ran(kCount);
+  std::vector<fml::closure> tasks;
+  for (size_t i = 0; i < kCount; ++i) {
+    tasks.push_back([&ran, &latch, i]() {
+      ASSERT_FALSE(ran[i].exchange(true));
+      latch.CountDown();
+    });
+  }
+  // Empty tasks are skipped.
+  tasks.emplace_back();
+  task_runner->PostTasks(std::move(tasks));
+  latch.Wait();
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsBatchesPostedFromWorkers) {
+  auto loop = fml::ConcurrentMessageLoop::Create(2u);
+  auto task_runner = loop->GetTaskRunner();
+  const size_t kCount = 10;
+  fml::CountDownLatch latch(kCount);
+  fml::AutoResetWaitableEvent done;
+  task_runner->PostTask([&]() {
+    std::vector<fml::closure> tasks(kCount, [&]() { latch.CountDown(); });
+    task_runner->PostTasks(std::move(tasks),
+                           fml::ConcurrentTaskPriority::kLatencySensitive);
+    latch.Wait();
+    done.Signal();
+  });
+  done.Wait();
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsTasksOnAllWorkers) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  const size_t kCount = 4;
+  fml::CountDownLatch latch(kCount);
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  loop->PostTaskToAllWorkers([&]() {
+    ASSERT_TRUE(loop->RunsTasksOnCurrentThread());
+    {
+      std::scoped_lock lock(thread_ids_mutex);
+      thread_ids.insert(std::this_thread::get_id());
+    }
+    latch.CountDown();
+  });
+  latch.Wait();
+  ASSERT_EQ(thread_ids.size(), kCount);
+  ASSERT_FALSE(loop->RunsTasksOnCurrentThread());
+}
@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+namespace fml {
+
+namespace {
+
+// Shared by the calling thread and the tasks that help it. Tasks that start
+// once every range has been claimed return without touching anything but
+// this state, which they keep alive, as |fn| may be gone by then.
+struct ParallelForState {
+  ParallelForState(size_t count,
+                   size_t grain,
+                   const std::function<void(size_t, size_t)>* fn)
+      : count(count),
+        grain(grain),
+        range_count((count + grain - 1) / grain),
+        fn(fn),
+        remaining(range_count) {}
+
+  void RunRanges() {
+    for (size_t range = next_range++; range < range_count;
+         range = next_range++) {
+      size_t begin = range * grain;
+      (*fn)(begin, std::min(begin + grain, count));
+      remaining.CountDown();
+    }
+  }
+
+  const size_t count;
+  const size_t grain;
+  const size_t range_count;
+  const std::function<void(size_t, size_t)>* fn;
+  std::atomic_size_t next_range = 0;
+  CountDownLatch remaining;
+};
+
+}  // namespace
+
+void ParallelFor(const std::shared_ptr<ConcurrentTaskRunner>& runner,
+                 size_t count,
+                 size_t grain,
+                 const std::function<void(size_t begin, size_t end)>& fn,
+                 ConcurrentTaskPriority priority) {
+  FML_DCHECK(grain > 0);
+  if (count == 0) {
+    return;
+  }
+  grain = std::max<size_t>(grain, 1);
+
+  auto state = std::make_shared<ParallelForState>(count, grain, &fn);
+  if (runner && state->range_count > 1) {
+    // The calling thread runs ranges too, so one task fewer than there are
+    // ranges is enough.
+    size_t helper_count =
+        std::min<size_t>(state->range_count - 1,
+                         std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    std::vector<fml::closure> helpers(helper_count,
+                                      [state]() { state->RunRanges(); });
+    runner->PostTasks(std::move(helpers), priority);
+  }
+  state->RunRanges();
+  state->remaining.Wait();
+}
+
+}  // namespace fml
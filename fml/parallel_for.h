@@ -0,0 +1,44 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_PARALLEL_FOR_H_
+#define FLUTTER_FML_PARALLEL_FOR_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "flutter/fml/concurrent_message_loop.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// @brief      Calls `fn(begin, end)` for consecutive ranges of at most
+///             `grain` indices that together cover `[0, count)`, on the
+///             workers of `runner` and on the calling thread, and returns
+///             once every call has returned.
+///
+///             The calling thread works through the ranges along with the
+///             workers, so this may be called from a worker of `runner` and
+///             completes even if all of the workers are busy. If `runner` is
+///             null, every range is run on the calling thread.
+///
+/// @param[in]  runner    The runner to which the tasks that help the calling
+///                       thread are posted, all at once.
+/// @param[in]  count     The number of indices.
+/// @param[in]  grain     The most indices in a range, at least 1.
+/// @param[in]  fn        The function to call for each range. It is called
+///                       concurrently for different ranges.
+/// @param[in]  priority  The priority of the tasks posted to `runner`.
+///
+void ParallelFor(
+    const std::shared_ptr<ConcurrentTaskRunner>& runner,
+    size_t count,
+    size_t grain,
+    const std::function<void(size_t begin, size_t end)>& fn,
+    ConcurrentTaskPriority priority = ConcurrentTaskPriority::kBackground);
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_PARALLEL_FOR_H_
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/parallel_for.h"
+
+#include <atomic>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+TEST(ParallelForTest, RunsEveryIndexOnce) {
+  auto loop = ConcurrentMessageLoop::Create(4u);
+  const size_t kCount = 1001;
+  std::vector<std::atomic_int> runs(kCount);
+  ParallelFor(loop->GetTaskRunner(), kCount, 10,
+              [&runs](size_t begin, size_t end) {
+                ASSERT_LE(end - begin, 10u);
+                ASSERT_EQ(begin % 10, 0u);
+                for (size_t i = begin; i < end; i++) {
+                  runs[i]++;
+                }
+              });
+  for (const auto& run : runs) {
+    ASSERT_EQ(run.load(), 1);
+  }
+}
+
+TEST(ParallelForTest, RunsOnTheCallingThreadWithoutRunner) {
+  std::vector<std::pair<size_t, size_t>> ranges;
+  ParallelFor(nullptr, 5, 2, [&ranges](size_t begin, size_t end) {
+    ranges.emplace_back(begin, end);
+  });
+  std::vector<std::pair<size_t, size_t>> expected = {{0, 2}, {2, 4}, {4, 5}};
+  EXPECT_EQ(ranges, expected);
+
+  ParallelFor(nullptr, 0, 2, [](size_t begin, size_t end) { FAIL(); });
+}
+
+TEST(ParallelForTest, CanBeCalledFromABusyWorker) {
+  auto loop = ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+  AutoResetWaitableEvent done;
+  std::atomic_size_t sum = 0;
+  // The only worker runs the loop, so the calling thread has to run every
+  // range itself.
+  task_runner->PostTask([&]() {
+    ParallelFor(task_runner, 100, 1,
+                [&sum](size_t begin, size_t end) { sum += begin; });
+    done.Signal();
+  });
+  done.Wait();
+  EXPECT_EQ(sum.load(), 4950u);
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -9,6 +9,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <type_traits>
 
 #include "flutter/fml/build_config.h"
@@ -107,4 +108,36 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(AccessPattern pattern) const {
+  if (mapping_ == nullptr) {
+    return false;
+  }
+  int advice = MADV_NORMAL;
+  switch (pattern) {
+    case AccessPattern::kNormal:
+      advice = MADV_NORMAL;
+      break;
+    case AccessPattern::kSequential:
+      advice = MADV_SEQUENTIAL;
+      break;
+    case AccessPattern::kRandom:
+      advice = MADV_RANDOM;
+      break;
+  }
+  return ::madvise(mapping_, size_, advice) == 0;
+}
+
+bool FileMapping::Prefetch(size_t offset, size_t length) const {
+  if (mapping_ == nullptr || offset >= size_) {
+    return false;
+  }
+  length = std::min(length, size_ - offset);
+  // The mapping starts on a page boundary but the range may not, and madvise
+  // wants one.
+  static const size_t kPageSize = ::sysconf(_SC_PAGESIZE);
+  const size_t page_offset = offset - offset % kPageSize;
+  return ::madvise(mapping_ + page_offset, length + offset - page_offset,
+                   MADV_WILLNEED) == 0;
+}
+
 }  // namespace fml
@@ -123,4 +123,14 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(AccessPattern pattern) const {
+  // There is no equivalent of madvise for file views.
+  return false;
+}
+
+bool FileMapping::Prefetch(size_t offset, size_t length) const {
+  // PrefetchVirtualMemory is not available on every supported version.
+  return false;
+}
+
 }  // namespace fml
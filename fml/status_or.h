@@ -35,6 +35,10 @@ class StatusOr {
   // NOLINTNEXTLINE(google-explicit-constructor)
   StatusOr(const T& value) : status_(), value_(value) {}
 
+  // These constructors are intended be compatible with absl::status_or.
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  StatusOr(T&& value) : status_(), value_(std::move(value)) {}
+
   // These constructors are intended be compatible with absl::status_or.
   // NOLINTNEXTLINE(google-explicit-constructor)
   StatusOr(const Status& status) : status_(status), value_() {
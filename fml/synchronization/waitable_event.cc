@@ -4,15 +4,186 @@
 
 #include "flutter/fml/synchronization/waitable_event.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <climits>
 #include <ctime>
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 
+#if FML_WAITABLE_EVENT_USES_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // FML_WAITABLE_EVENT_USES_FUTEX
+
 namespace fml {
 
+#if FML_WAITABLE_EVENT_USES_FUTEX
+
+namespace {
+
+static_assert(sizeof(std::atomic_uint32_t) == sizeof(uint32_t),
+              "Futexes are 32 bit words.");
+
+// Blocks the calling thread while |*word| is |expected|, until it is woken up
+// or |timeout| expires, if there is one. May also return spuriously.
+void FutexWait(std::atomic_uint32_t* word,
+               uint32_t expected,
+               const TimeDelta* timeout) {
+  struct timespec timeout_spec;
+  if (timeout) {
+    int64_t nanos = std::max<int64_t>(timeout->ToNanoseconds(), 0);
+    timeout_spec.tv_sec = nanos / 1000000000;
+    timeout_spec.tv_nsec = nanos % 1000000000;
+  }
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE,
+          expected, timeout ? &timeout_spec : nullptr, nullptr, 0);
+}
+
+// Wakes up to |count| threads blocked on |*word|.
+void FutexWake(std::atomic_uint32_t* word, int count) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE,
+          count, nullptr, nullptr, 0);
+}
+
+// The states of an |AutoResetWaitableEvent|.
+constexpr uint32_t kUnsignaled = 0;
+constexpr uint32_t kSignaled = 1;
+constexpr uint32_t kUnsignaledWithWaiters = 2;
+
+// The bits of the state of a |ManualResetWaitableEvent|.
+constexpr uint32_t kSignaledBit = 1;
+constexpr uint32_t kWaitersBit = 2;
+constexpr uint32_t kSignalCountMask = ~(kSignaledBit | kWaitersBit);
+constexpr uint32_t kSignalCountIncrement = 4;
+
+}  // namespace
+
+// AutoResetWaitableEvent ------------------------------------------------------
+
+void AutoResetWaitableEvent::Signal() {
+  if (state_.exchange(kSignaled, std::memory_order_release) ==
+      kUnsignaledWithWaiters) {
+    FutexWake(&state_, 1);
+  }
+}
+
+void AutoResetWaitableEvent::Reset() {
+  // Threads that are waiting keep the state at |kUnsignaledWithWaiters|.
+  uint32_t expected = kSignaled;
+  state_.compare_exchange_strong(expected, kUnsignaled,
+                                 std::memory_order_relaxed);
+}
+
+void AutoResetWaitableEvent::Wait() {
+  uint32_t expected = kSignaled;
+  if (state_.compare_exchange_strong(expected, kUnsignaled,
+                                     std::memory_order_acquire)) {
+    return;
+  }
+  // Consuming the signal while marking the event as waited on may leave the
+  // state at |kUnsignaledWithWaiters| with no other thread waiting, which
+  // only costs the next |Signal()| a needless wake up.
+  while (state_.exchange(kUnsignaledWithWaiters, std::memory_order_acquire) !=
+         kSignaled) {
+    FutexWait(&state_, kUnsignaledWithWaiters, nullptr);
+  }
+}
+
+bool AutoResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
+  uint32_t expected = kSignaled;
+  if (state_.compare_exchange_strong(expected, kUnsignaled,
+                                     std::memory_order_acquire)) {
+    return false;
+  }
+
+  TimePoint start = TimePoint::Now();
+  while (state_.exchange(kUnsignaledWithWaiters, std::memory_order_acquire) !=
+         kSignaled) {
+    TimeDelta elapsed = TimePoint::Now() - start;
+    if (elapsed >= timeout) {
+      return true;
+    }
+    TimeDelta wait_remaining = timeout - elapsed;
+    FutexWait(&state_, kUnsignaledWithWaiters, &wait_remaining);
+  }
+  return false;
+}
+
+bool AutoResetWaitableEvent::IsSignaledForTest() {
+  return state_.load(std::memory_order_relaxed) == kSignaled;
+}
+
+// ManualResetWaitableEvent ----------------------------------------------------
+
+void ManualResetWaitableEvent::Signal() {
+  uint32_t state = state_.load(std::memory_order_relaxed);
+  uint32_t signaled_state;
+  do {
+    signaled_state =
+        ((state & kSignalCountMask) + kSignalCountIncrement) | kSignaledBit;
+  } while (!state_.compare_exchange_weak(
+      state, signaled_state, std::memory_order_release,
+      std::memory_order_relaxed));
+  if (state & kWaitersBit) {
+    FutexWake(&state_, INT_MAX);
+  }
+}
+
+void ManualResetWaitableEvent::Reset() {
+  state_.fetch_and(~kSignaledBit, std::memory_order_relaxed);
+}
+
+void ManualResetWaitableEvent::Wait() {
+  uint32_t state = state_.load(std::memory_order_acquire);
+  const uint32_t signal_count = state & kSignalCountMask;
+  while (!(state & kSignaledBit) &&
+         (state & kSignalCountMask) == signal_count) {
+    if (!(state & kWaitersBit)) {
+      if (!state_.compare_exchange_weak(state, state | kWaitersBit,
+                                        std::memory_order_acquire)) {
+        continue;
+      }
+      state |= kWaitersBit;
+    }
+    FutexWait(&state_, state, nullptr);
+    state = state_.load(std::memory_order_acquire);
+  }
+}
+
+bool ManualResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
+  TimePoint start = TimePoint::Now();
+  uint32_t state = state_.load(std::memory_order_acquire);
+  const uint32_t signal_count = state & kSignalCountMask;
+  while (!(state & kSignaledBit) &&
+         (state & kSignalCountMask) == signal_count) {
+    TimeDelta elapsed = TimePoint::Now() - start;
+    if (elapsed >= timeout) {
+      return true;
+    }
+    if (!(state & kWaitersBit)) {
+      if (!state_.compare_exchange_weak(state, state | kWaitersBit,
+                                        std::memory_order_acquire)) {
+        continue;
+      }
+      state |= kWaitersBit;
+    }
+    TimeDelta wait_remaining = timeout - elapsed;
+    FutexWait(&state_, state, &wait_remaining);
+    state = state_.load(std::memory_order_acquire);
+  }
+  return false;
+}
+
+bool ManualResetWaitableEvent::IsSignaledForTest() {
+  return state_.load(std::memory_order_relaxed) & kSignaledBit;
+}
+
+#else  // FML_WAITABLE_EVENT_USES_FUTEX
+
 // Waits with a timeout on |condition()|. Returns true on timeout, or false if
 // |condition()| ever returns true. |condition()| should have no side effects
 // (and will always be called with |*mutex| held).
@@ -173,4 +344,6 @@ bool ManualResetWaitableEvent::IsSignaledForTest() {
   return signaled_;
 }
 
+#endif  // FML_WAITABLE_EVENT_USES_FUTEX
+
 }  // namespace fml
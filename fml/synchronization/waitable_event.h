@@ -10,12 +10,25 @@
 #ifndef FLUTTER_FML_SYNCHRONIZATION_WAITABLE_EVENT_H_
 #define FLUTTER_FML_SYNCHRONIZATION_WAITABLE_EVENT_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_delta.h"
 
+// Where futexes are available, the events are implemented on top of them
+// instead of a mutex and a condition variable, so that signaling an event
+// that no thread waits on does not make a system call, and waking up a
+// waiting thread takes no lock.
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#define FML_WAITABLE_EVENT_USES_FUTEX 1
+#else
+#define FML_WAITABLE_EVENT_USES_FUTEX 0
+#endif
+
 namespace fml {
 
 // AutoResetWaitableEvent ------------------------------------------------------
@@ -62,11 +75,17 @@ class AutoResetWaitableEvent final {
   bool IsSignaledForTest();
 
  private:
+#if FML_WAITABLE_EVENT_USES_FUTEX
+  // One of |kUnsignaled|, |kSignaled| or |kUnsignaledWithWaiters|, which
+  // tells |Signal()| that threads may be blocked on the futex.
+  std::atomic_uint32_t state_ = 0;
+#else
   std::condition_variable cv_;
   std::mutex mutex_;
 
   // True if this event is in the signaled state.
   bool signaled_ = false;
+#endif  // FML_WAITABLE_EVENT_USES_FUTEX
 
   FML_DISALLOW_COPY_AND_ASSIGN(AutoResetWaitableEvent);
 };
@@ -104,6 +123,13 @@ class ManualResetWaitableEvent final {
   bool IsSignaledForTest();
 
  private:
+#if FML_WAITABLE_EVENT_USES_FUTEX
+  // The lowest bit is set while the event is signaled, and the next one
+  // while threads may be blocked on the futex. The other bits count the
+  // calls to |Signal()|, so that a waiting thread knows it was awoken even
+  // if the event has been reset since, as |signal_id_| does below.
+  std::atomic_uint32_t state_ = 0;
+#else
   std::condition_variable cv_;
   std::mutex mutex_;
 
@@ -118,6 +144,7 @@ class ManualResetWaitableEvent final {
   // |std::condition_variable::notify_all()|. A waiting thread knows it was
   // awoken if |signal_id_| is different from when it started waiting.
   unsigned signal_id_ = 0u;
+#endif  // FML_WAITABLE_EVENT_USES_FUTEX
 
   FML_DISALLOW_COPY_AND_ASSIGN(ManualResetWaitableEvent);
 };
@@ -0,0 +1,70 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/synchronization/waitable_event.h"
+
+#include <thread>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+namespace fml {
+namespace benchmarking {
+
+// Hands control back and forth between two threads, the way the threads
+// that set up a shell wait on each other.
+static void BM_WaitableEventPingPong(benchmark::State& state) {  // NOLINT
+  AutoResetWaitableEvent ping;
+  AutoResetWaitableEvent pong;
+  bool done = false;
+  std::thread thread([&]() {
+    while (true) {
+      ping.Wait();
+      if (done) {
+        return;
+      }
+      pong.Signal();
+    }
+  });
+  while (state.KeepRunning()) {
+    ping.Signal();
+    pong.Wait();
+  }
+  done = true;
+  ping.Signal();
+  thread.join();
+}
+
+BENCHMARK(BM_WaitableEventPingPong)->UseRealTime();
+
+static void BM_SignalWithoutWaiters(benchmark::State& state) {  // NOLINT
+  ManualResetWaitableEvent event;
+  while (state.KeepRunning()) {
+    event.Signal();
+    event.Reset();
+  }
+}
+
+BENCHMARK(BM_SignalWithoutWaiters);
+
+static void BM_CountDownLatch(benchmark::State& state) {  // NOLINT
+  const size_t thread_count = state.range(0);
+  while (state.KeepRunning()) {
+    CountDownLatch latch(thread_count);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_count; i++) {
+      threads.emplace_back([&latch]() { latch.CountDown(); });
+    }
+    latch.Wait();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+}
+
+BENCHMARK(BM_CountDownLatch)->Arg(1)->Arg(4)->UseRealTime();
+
+}  // namespace benchmarking
+}  // namespace fml
@@ -35,6 +35,11 @@ void TaskRunner::PostDelayedTask(const fml::closure& task,
   loop_->PostTask(task, fml::TimePoint::Now() + delay);
 }
 
+void TaskRunner::PostTaskWithDeadline(const fml::closure& task,
+                                      fml::TimePoint deadline) {
+  loop_->PostTask(task, fml::TimePoint::Now(), deadline);
+}
+
 TaskQueueId TaskRunner::GetTaskQueueId() {
   FML_DCHECK(loop_);
   return loop_->GetTaskQueueId();
@@ -62,4 +67,17 @@ void TaskRunner::RunNowOrPostTask(const fml::RefPtr<fml::TaskRunner>& runner,
   }
 }
 
+void TaskRunner::RunNowOrPostTaskAndReply(
+    const fml::RefPtr<fml::TaskRunner>& runner,
+    const fml::closure& task,
+    const fml::RefPtr<fml::TaskRunner>& reply_runner,
+    const fml::closure& reply) {
+  FML_DCHECK(runner);
+  FML_DCHECK(reply_runner);
+  RunNowOrPostTask(runner, [task, reply_runner, reply]() {
+    task();
+    RunNowOrPostTask(reply_runner, reply);
+  });
+}
+
 }  // namespace fml
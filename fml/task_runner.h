@@ -5,8 +5,12 @@
 #ifndef FLUTTER_FML_TASK_RUNNER_H_
 #define FLUTTER_FML_TASK_RUNNER_H_
 
+#include <functional>
+#include <utility>
+
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/message_loop_task_queues.h"
@@ -49,6 +53,15 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
   /// tens of milliseconds.
   virtual void PostDelayedTask(const fml::closure& task, fml::TimeDelta delay);
 
+  /// Schedules a task that should have run by \p deadline, such as frame
+  /// work that has to be done by the time the frame is presented. Such tasks
+  /// are run before the other tasks that are ready to run, earliest deadline
+  /// first.
+  /// \note Task runners that don't run tasks on a \p fml::MessageLoop
+  /// post the task as \p PostTask does.
+  virtual void PostTaskWithDeadline(const fml::closure& task,
+                                    fml::TimePoint deadline);
+
   /// Returns \p true when the current executing thread's TaskRunner matches
   /// this instance.
   virtual bool RunsTasksOnCurrentThread();
@@ -62,6 +75,37 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
   static void RunNowOrPostTask(const fml::RefPtr<fml::TaskRunner>& runner,
                                const fml::closure& task);
 
+  /// Runs \p task on \p runner, then runs \p reply on \p reply_runner once
+  /// \p task has run. Unlike waiting on a latch for \p task, this doesn't
+  /// block the calling thread, so the thread can do other work in the
+  /// meantime. Each task is run directly if its runner is the current one.
+  static void RunNowOrPostTaskAndReply(
+      const fml::RefPtr<fml::TaskRunner>& runner,
+      const fml::closure& task,
+      const fml::RefPtr<fml::TaskRunner>& reply_runner,
+      const fml::closure& reply);
+
+  /// Runs \p task on \p runner, then runs \p reply on \p reply_runner with
+  /// the result of \p task. \p Result may be a move-only type.
+  /// \see RunNowOrPostTaskAndReply
+  template <typename Result>
+  static void RunNowOrPostTaskAndReplyWithResult(
+      const fml::RefPtr<fml::TaskRunner>& runner,
+      std::function<Result()> task,
+      const fml::RefPtr<fml::TaskRunner>& reply_runner,
+      std::function<void(Result)> reply) {
+    RunNowOrPostTask(
+        runner, fml::MakeCopyable([task = std::move(task), reply_runner,
+                                   reply = std::move(reply)]() mutable {
+          auto reply_task = [result = task(),
+                             reply = std::move(reply)]() mutable {
+            reply(std::move(result));
+          };
+          RunNowOrPostTask(reply_runner,
+                           fml::MakeCopyable(std::move(reply_task)));
+        }));
+  }
+
  protected:
   explicit TaskRunner(fml::RefPtr<MessageLoopImpl> loop);
 
@@ -15,8 +15,22 @@ TaskSource::~TaskSource() {
   ShutDown();
 }
 
+bool TaskSource::TopTask::RunsBefore(const TopTask& other) const {
+  if (is_due && other.is_due) {
+    return other.task.HasLaterDeadlineThan(task);
+  }
+  if (is_due && task.HasDeadline()) {
+    return true;
+  }
+  if (other.is_due && other.task.HasDeadline()) {
+    return false;
+  }
+  return other.task > task;
+}
+
 void TaskSource::ShutDown() {
   primary_task_queue_ = {};
+  due_task_queue_ = {};
   secondary_task_queue_ = {};
 }
 
@@ -37,10 +51,12 @@ void TaskSource::RegisterTask(const DelayedTask& task) {
 void TaskSource::PopTask(TaskSourceGrade grade) {
   switch (grade) {
     case TaskSourceGrade::kUserInteraction:
-      primary_task_queue_.pop();
-      break;
     case TaskSourceGrade::kUnspecified:
-      primary_task_queue_.pop();
+      if (PrimaryTop().is_due) {
+        due_task_queue_.pop();
+      } else {
+        primary_task_queue_.pop();
+      }
       break;
     case TaskSourceGrade::kDartMicroTasks:
       secondary_task_queue_.pop();
@@ -48,8 +64,16 @@ void TaskSource::PopTask(TaskSourceGrade grade) {
   }
 }
 
+void TaskSource::PromoteDueTasks(fml::TimePoint now) {
+  while (!primary_task_queue_.empty() &&
+         primary_task_queue_.top().GetTargetTime() <= now) {
+    due_task_queue_.push(primary_task_queue_.top());
+    primary_task_queue_.pop();
+  }
+}
+
 size_t TaskSource::GetNumPendingTasks() const {
-  size_t size = primary_task_queue_.size();
+  size_t size = primary_task_queue_.size() + due_task_queue_.size();
   if (secondary_pause_requests_ == 0) {
     size += secondary_task_queue_.size();
   }
@@ -60,34 +84,48 @@ bool TaskSource::IsEmpty() const {
   return GetNumPendingTasks() == 0;
 }
 
-TaskSource::TopTask TaskSource::Top() const {
-  FML_CHECK(!IsEmpty());
-  if (secondary_pause_requests_ > 0 || secondary_task_queue_.empty()) {
-    const auto& primary_top = primary_task_queue_.top();
+TaskSource::TopTask TaskSource::PrimaryTop() const {
+  if (due_task_queue_.empty()) {
     return {
         .task_queue_id = task_queue_id_,
-        .task = primary_top,
+        .task = primary_task_queue_.top(),
     };
-  } else if (primary_task_queue_.empty()) {
+  }
+  TopTask due_top = {
+      .task_queue_id = task_queue_id_,
+      .task = due_task_queue_.top(),
+      .is_due = true,
+  };
+  if (primary_task_queue_.empty()) {
+    return due_top;
+  }
+  TopTask primary_top = {
+      .task_queue_id = task_queue_id_,
+      .task = primary_task_queue_.top(),
+  };
+  return primary_top.RunsBefore(due_top) ? primary_top : due_top;
+}
+
+TaskSource::TopTask TaskSource::Top() const {
+  FML_CHECK(!IsEmpty());
+  const bool has_primary_tasks =
+      !primary_task_queue_.empty() || !due_task_queue_.empty();
+  if (secondary_pause_requests_ > 0 || secondary_task_queue_.empty()) {
+    return PrimaryTop();
+  } else if (!has_primary_tasks) {
     const auto& secondary_top = secondary_task_queue_.top();
     return {
         .task_queue_id = task_queue_id_,
         .task = secondary_top,
     };
   } else {
-    const auto& primary_top = primary_task_queue_.top();
-    const auto& secondary_top = secondary_task_queue_.top();
-    if (primary_top > secondary_top) {
-      return {
-          .task_queue_id = task_queue_id_,
-          .task = secondary_top,
-      };
-    } else {
-      return {
-          .task_queue_id = task_queue_id_,
-          .task = primary_top,
-      };
-    }
+    TopTask primary_top = PrimaryTop();
+    TopTask secondary_top = {
+        .task_queue_id = task_queue_id_,
+        .task = secondary_task_queue_.top(),
+    };
+    return secondary_top.RunsBefore(primary_top) ? secondary_top
+                                                 : primary_top;
   }
 }
 
@@ -31,12 +31,23 @@ class MessageLoopTaskQueues;
  * Task dispatcher provides the event loop a way to acquire tasks to run via
  * `GetNextTaskToRun`. Task dispatcher asks the underlying `TaskSource` for the
  * next task.
+ *
+ * Deadlines
+ * ---------
+ * Tasks in the primary task heap that are due are moved to a heap of due
+ * tasks by `PromoteDueTasks`. Due tasks with a deadline are run before any
+ * other task, earliest deadline first. The other due tasks keep their order.
  */
 class TaskSource {
  public:
   struct TopTask {
     TaskQueueId task_queue_id;
     const DelayedTask& task;
+    // Whether |task| has been promoted by |PromoteDueTasks|.
+    bool is_due = false;
+
+    /// Returns true if this task should be run before |other|.
+    bool RunsBefore(const TopTask& other) const;
   };
 
   /// Construts a TaskSource with the given `task_queue_id`.
@@ -54,6 +65,10 @@ class TaskSource {
   /// Pops the task heap corresponding to the `TaskSourceGrade`.
   void PopTask(TaskSourceGrade grade);
 
+  /// Moves the tasks in the primary task heap whose target time is not later
+  /// than `now` to the heap of due tasks, where they are ordered by deadline.
+  void PromoteDueTasks(fml::TimePoint now);
+
   /// Returns the number of pending tasks. Excludes the tasks from the secondary
   /// heap if it's paused.
   size_t GetNumPendingTasks() const;
@@ -61,8 +76,8 @@ class TaskSource {
   /// Returns true if `GetNumPendingTasks` is zero.
   bool IsEmpty() const;
 
-  /// Returns the top task based on scheduled time, taking into account whether
-  /// the secondary heap has been paused or not.
+  /// Returns the top task based on deadline and scheduled time, taking into
+  /// account whether the secondary heap has been paused or not.
   TopTask Top() const;
 
   /// Pause providing tasks from secondary task heap.
@@ -74,9 +89,14 @@ class TaskSource {
  private:
   const fml::TaskQueueId task_queue_id_;
   fml::DelayedTaskQueue primary_task_queue_;
+  fml::DueTaskQueue due_task_queue_;
   fml::DelayedTaskQueue secondary_task_queue_;
   int secondary_pause_requests_ = 0;
 
+  // Returns the top of the primary and due task heaps, which can't both be
+  // empty.
+  TopTask PrimaryTop() const;
+
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TaskSource);
 };
 
@@ -4,6 +4,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_source.h"
@@ -97,5 +98,50 @@ TEST(TaskSourceTests, OrderingMultiTaskHeapsSecondaryPaused) {
   ASSERT_EQ(value, 1);
 }
 
+TEST(TaskSourceTests, DueTasksWithDeadlinesRunFirst) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  std::vector<int> values;
+  task_source.RegisterTask({1, [&] { values.push_back(1); }, time_stamp,
+                            TaskSourceGrade::kUnspecified});
+  task_source.RegisterTask({2, [&] { values.push_back(2); }, time_stamp,
+                            TaskSourceGrade::kDartMicroTasks});
+  task_source.RegisterTask({3, [&] { values.push_back(3); }, time_stamp,
+                            TaskSourceGrade::kUnspecified,
+                            time_stamp + fml::TimeDelta::FromMilliseconds(16)});
+  task_source.RegisterTask({4, [&] { values.push_back(4); }, time_stamp,
+                            TaskSourceGrade::kUnspecified,
+                            time_stamp + fml::TimeDelta::FromMilliseconds(8)});
+  // Not due yet, so it doesn't run before the other tasks.
+  task_source.RegisterTask({5, [&] { values.push_back(5); },
+                            time_stamp + fml::TimeDelta::FromMilliseconds(1),
+                            TaskSourceGrade::kUnspecified,
+                            time_stamp + fml::TimeDelta::FromMilliseconds(1)});
+
+  task_source.PromoteDueTasks(time_stamp);
+  while (!task_source.IsEmpty()) {
+    auto top_task = task_source.Top();
+    top_task.task.GetTask()();
+    task_source.PopTask(top_task.task.GetTaskSourceGrade());
+  }
+  ASSERT_EQ(values, std::vector<int>({4, 3, 1, 2, 5}));
+}
+
+TEST(TaskSourceTests, DeadlinesAreIgnoredUntilTasksAreDue) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  int value = 0;
+  task_source.RegisterTask(
+      {1, [&] { value = 1; }, time_stamp, TaskSourceGrade::kUnspecified});
+  task_source.RegisterTask({2, [&] { value = 7; }, time_stamp,
+                            TaskSourceGrade::kUnspecified, time_stamp});
+
+  auto top_task = task_source.Top();
+  ASSERT_FALSE(top_task.is_due);
+  top_task.task.GetTask()();
+  task_source.PopTask(top_task.task.GetTaskSourceGrade());
+  ASSERT_EQ(value, 1);
+}
+
 }  // namespace testing
 }  // namespace fml
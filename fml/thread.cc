@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "flutter/fml/build_config.h"
+#include "flutter/fml/flight_recorder.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 
@@ -78,6 +79,7 @@ Thread::Thread(const ThreadConfigSetter& setter, const ThreadConfig& config)
   thread_ = std::make_unique<std::thread>(
       [&latch, &runner, setter, config]() -> void {
         setter(config);
+        FlightRecorder::SetCurrentThreadName(config.name);
         fml::MessageLoop::EnsureInitializedForCurrentThread();
         auto& loop = MessageLoop::GetCurrent();
         runner = loop.GetTaskRunner();
@@ -20,11 +20,13 @@
 #include "impeller/aiks/testing/context_spy.h"
 #include "impeller/core/capture.h"
 #include "impeller/entity/contents/conical_gradient_contents.h"
+#include "impeller/entity/contents/filters/fused_color_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
 #include "impeller/entity/contents/linear_gradient_contents.h"
 #include "impeller/entity/contents/radial_gradient_contents.h"
 #include "impeller/entity/contents/solid_color_contents.h"
 #include "impeller/entity/contents/sweep_gradient_contents.h"
+#include "impeller/entity/contents/text_contents.h"
 #include "impeller/geometry/color.h"
 #include "impeller/geometry/constants.h"
 #include "impeller/geometry/geometry_asserts.h"
@@ -2539,9 +2541,9 @@ TEST_P(AiksTest, OpacityPeepHoleApplicationTest) {
   paint.image_filter = nullptr;
   paint.color = Color::Red();
 
-  // Paint has no alpha, can't elide;
+  // Paint is opaque and there is nothing to draw with another blend mode.
   delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
-  ASSERT_FALSE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+  ASSERT_TRUE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
 
   // Positive test.
   Entity entity;
@@ -2554,6 +2556,55 @@ TEST_P(AiksTest, OpacityPeepHoleApplicationTest) {
   ASSERT_TRUE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
 }
 
+TEST_P(AiksTest, OpacityPeepHoleAppliesToDisjointChildren) {
+  auto entity_pass = std::make_shared<EntityPass>();
+  for (int i = 0; i < 4; i++) {
+    Entity entity;
+    entity.SetContents(SolidColorContents::Make(
+        PathBuilder{}.AddRect(Rect::MakeXYWH(i * 20, 0, 10, 10)).TakePath(),
+        Color::Red()));
+    entity_pass->AddEntity(std::move(entity));
+  }
+  Paint paint;
+  paint.color = Color::Red().WithAlpha(0.5);
+
+  // Too many entities to compare their coverage.
+  auto delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
+  ASSERT_FALSE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+
+  // The caller has already proven that the children do not overlap.
+  delegate = std::make_shared<OpacityPeepholePassDelegate>(
+      paint, /*children_are_disjoint=*/true);
+  ASSERT_TRUE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+}
+
+TEST_P(AiksTest, OpacityPeepHoleCollapsesOpaqueLayers) {
+  auto entity_pass = std::make_shared<EntityPass>();
+  for (int i = 0; i < 4; i++) {
+    Entity entity;
+    entity.SetContents(SolidColorContents::Make(
+        PathBuilder{}.AddRect(Rect::MakeXYWH(i * 5, 0, 10, 10)).TakePath(),
+        Color::Red().WithAlpha(0.5)));
+    entity_pass->AddEntity(std::move(entity));
+  }
+  Paint paint;
+
+  // Overlapping source-over children composite the same without the layer.
+  auto delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
+  ASSERT_TRUE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+
+  Entity entity;
+  entity.SetContents(SolidColorContents::Make(
+      PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 10, 10)).TakePath(),
+      Color::Red()));
+  entity.SetBlendMode(BlendMode::kMultiply);
+  entity_pass->AddEntity(std::move(entity));
+
+  // A child that blends with the layer contents needs the layer.
+  delegate = std::make_shared<OpacityPeepholePassDelegate>(paint);
+  ASSERT_FALSE(delegate->CanCollapseIntoParentPass(entity_pass.get()));
+}
+
 TEST_P(AiksTest, DrawPaintAbsorbsClears) {
   Canvas canvas;
   canvas.DrawPaint({.color = Color::Red(), .blend_mode = BlendMode::kSource});
@@ -2600,6 +2651,40 @@ TEST_P(AiksTest,
   ASSERT_EQ(render_pass->GetCommands().size(), 0llu);
 }
 
+TEST_P(AiksTest, SiblingBackdropFiltersShareBackdropRead) {
+  auto record = [](const std::shared_ptr<ImageFilter>& first_filter,
+                   const std::shared_ptr<ImageFilter>& second_filter) {
+    Canvas canvas;
+    canvas.DrawCircle({150, 150}, 100, {.color = Color::CornflowerBlue()});
+    canvas.DrawCircle({450, 150}, 100, {.color = Color::OrangeRed()});
+    canvas.Save();
+    canvas.ClipRect(Rect::MakeXYWH(50, 50, 200, 200));
+    canvas.SaveLayer({}, std::nullopt, first_filter);
+    canvas.Restore();
+    canvas.Restore();
+    canvas.Save();
+    canvas.ClipRect(Rect::MakeXYWH(350, 50, 200, 200));
+    canvas.SaveLayer({}, std::nullopt, second_filter);
+    canvas.Restore();
+    canvas.Restore();
+    return canvas.EndRecordingAsPicture();
+  };
+  auto count_render_passes = [this](Picture picture) {
+    std::shared_ptr<ContextSpy> spy = ContextSpy::Make();
+    std::shared_ptr<ContextMock> mock_context = spy->MakeContext(GetContext());
+    AiksContext renderer(mock_context, nullptr);
+    std::shared_ptr<Image> image = picture.ToImage(renderer, {600, 300});
+    return spy->render_passes_.size();
+  };
+
+  auto blur = ImageFilter::MakeBlur(Sigma(5.0), Sigma(5.0),
+                                    FilterContents::BlurStyle::kNormal,
+                                    Entity::TileMode::kClamp);
+  size_t separate_passes = count_render_passes(record(blur, blur->Clone()));
+  size_t batched_passes = count_render_passes(record(blur, blur));
+  EXPECT_LT(batched_passes, separate_passes);
+}
+
 TEST_P(AiksTest, DrawRectAbsorbsClears) {
   Canvas canvas;
   canvas.DrawRect(Rect::MakeXYWH(0, 0, 300, 300),
@@ -2823,6 +2908,42 @@ TEST_P(AiksTest, SrgbToLinearFilterSubpassCollapseOptimization) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, ComposedColorFiltersAreFused) {
+  auto matrix = ColorFilter::MakeMatrix({.array = {
+                                             -1.0, 0,    0,    1.0, 0,  //
+                                             0,    -1.0, 0,    1.0, 0,  //
+                                             0,    0,    -1.0, 1.0, 0,  //
+                                             1.0,  1.0,  1.0,  1.0, 0   //
+                                         }});
+  auto composed = ColorFilter::MakeComposed(
+      ColorFilter::MakeBlend(BlendMode::kSourceOver,
+                             Color::Red().WithAlpha(0.5)),
+      ColorFilter::MakeComposed(ColorFilter::MakeLinearToSrgb(), matrix));
+
+  auto input = FilterInput::Make(std::make_shared<SolidColorContents>());
+  auto filter = composed->WrapWithGPUColorFilter(
+      input, ColorFilterContents::AbsorbOpacity::kYes);
+  ASSERT_NE(std::dynamic_pointer_cast<FusedColorFilterContents>(filter),
+            nullptr);
+
+  // Advanced blends can't be fused.
+  auto advanced = ColorFilter::MakeComposed(
+      ColorFilter::MakeBlend(BlendMode::kColorDodge, Color::Red()), matrix);
+  filter = advanced->WrapWithGPUColorFilter(
+      input, ColorFilterContents::AbsorbOpacity::kYes);
+  ASSERT_EQ(std::dynamic_pointer_cast<FusedColorFilterContents>(filter),
+            nullptr);
+
+  Canvas canvas;
+  canvas.SaveLayer({.color_filter = composed});
+  canvas.Translate({500, 300, 0});
+  canvas.Rotate(Radians(2 * kPi / 3));
+  canvas.DrawRect(Rect::MakeXYWH(100, 100, 200, 200), {.color = Color::Blue()});
+  canvas.Restore();
+
+  ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
+}
+
 static Picture BlendModeTest(BlendMode blend_mode,
                              const std::shared_ptr<Image>& src_image,
                              const std::shared_ptr<Image>& dst_image) {
@@ -3617,6 +3738,34 @@ TEST_P(AiksTest, TextForegroundShaderWithTransform) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, ConsecutiveTextFramesAreMergedIntoOneEntity) {
+  SkFont sk_font;
+  sk_font.setSize(30);
+  auto blob = SkTextBlob::MakeFromString("Hello", sk_font);
+  ASSERT_NE(blob, nullptr);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  Canvas canvas;
+  Paint paint = {.color = Color::Black()};
+  canvas.DrawTextFrame(frame, {10, 50}, paint);
+  canvas.DrawTextFrame(frame, {10, 100}, paint);
+  paint.color = Color::Red();
+  canvas.DrawTextFrame(frame, {10, 150}, paint);
+  auto picture = canvas.EndRecordingAsPicture();
+
+  std::vector<size_t> frame_counts;
+  picture.pass->IterateAllEntities([&frame_counts](Entity& entity) {
+    if (auto contents =
+            std::dynamic_pointer_cast<TextContents>(entity.GetContents())) {
+      frame_counts.push_back(contents->GetTextFrameCount());
+    }
+    return true;
+  });
+  EXPECT_EQ(frame_counts, (std::vector<size_t>{2u, 1u}));
+
+  ASSERT_TRUE(OpenPlaygroundHere(picture));
+}
+
 TEST_P(AiksTest, CanCanvasDrawPicture) {
   Canvas subcanvas;
   subcanvas.DrawRect(Rect::MakeLTRB(-100, -50, 100, 50),
@@ -146,16 +146,20 @@ void Canvas::Save(bool create_subpass,
     subpass->SetEnableOffscreenCheckerboard(
         debug_options.offscreen_texture_checkerboard);
     if (backdrop_filter) {
+      // Layers given the same backdrop filter instance share a batch key, so
+      // the pass may filter their backdrops together. The proc keeps the key
+      // alive for as long as the pass.
       EntityPass::BackdropFilterProc backdrop_filter_proc =
-          [backdrop_filter = backdrop_filter->Clone()](
-              const FilterInput::Ref& input, const Matrix& effect_transform,
-              Entity::RenderingMode rendering_mode) {
+          [backdrop_filter = backdrop_filter->Clone(),
+           batch_key = backdrop_filter](const FilterInput::Ref& input,
+                                        const Matrix& effect_transform,
+                                        Entity::RenderingMode rendering_mode) {
             auto filter = backdrop_filter->WrapInput(input);
             filter->SetEffectTransform(effect_transform);
             filter->SetRenderingMode(rendering_mode);
             return filter;
           };
-      subpass->SetBackdropFilter(backdrop_filter_proc);
+      subpass->SetBackdropFilter(backdrop_filter_proc, backdrop_filter.get());
     }
     subpass->SetBlendMode(blend_mode);
     current_pass_ = GetCurrentPass().AddSubpass(std::move(subpass));
@@ -633,7 +637,8 @@ size_t Canvas::GetClipDepth() const {
 
 void Canvas::SaveLayer(const Paint& paint,
                        std::optional<Rect> bounds,
-                       const std::shared_ptr<ImageFilter>& backdrop_filter) {
+                       const std::shared_ptr<ImageFilter>& backdrop_filter,
+                       bool can_distribute_opacity) {
   TRACE_EVENT0("flutter", "Canvas::saveLayer");
   Save(true, paint.blend_mode, backdrop_filter);
 
@@ -642,8 +647,8 @@ void Canvas::SaveLayer(const Paint& paint,
 
   // Only apply opacity peephole on default blending.
   if (paint.blend_mode == BlendMode::kSourceOver) {
-    new_layer_pass.SetDelegate(
-        std::make_shared<OpacityPeepholePassDelegate>(paint));
+    new_layer_pass.SetDelegate(std::make_shared<OpacityPeepholePassDelegate>(
+        paint, can_distribute_opacity));
   } else {
     new_layer_pass.SetDelegate(std::make_shared<PaintPassDelegate>(paint));
   }
@@ -657,22 +662,46 @@ void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
   entity.SetBlendMode(paint.blend_mode);
 
   auto text_contents = std::make_shared<TextContents>();
-  text_contents->SetTextFrame(text_frame);
   text_contents->SetColor(paint.color);
   text_contents->SetForceTextColor(paint.mask_blur_descriptor.has_value());
 
-  entity.SetTransform(GetCurrentTransform() *
-                      Matrix::MakeTranslation(position));
-
   // TODO(bdero): This mask blur application is a hack. It will always wind up
   //              doing a gaussian blur that affects the color source itself
   //              instead of just the mask. The color filter text support
   //              needs to be reworked in order to interact correctly with
   //              mask filters.
   //              https://github.com/flutter/flutter/issues/133297
-  entity.SetContents(
-      paint.WithFilters(paint.WithMaskBlur(std::move(text_contents), true)));
+  auto contents = paint.WithFilters(paint.WithMaskBlur(text_contents, true));
+
+  if (contents != text_contents) {
+    text_contents->SetTextFrame(text_frame);
+    entity.SetTransform(GetCurrentTransform() *
+                        Matrix::MakeTranslation(position));
+    entity.SetContents(std::move(contents));
+    GetCurrentPass().AddEntity(std::move(entity));
+    return;
+  }
+
+  // Unfiltered text is positioned within the contents instead of by the
+  // entity transform, so that consecutive text draws with the same state can
+  // be merged into a single entity and drawn together. Advanced blends are
+  // not merged since each draw must read back the result of the previous one.
+  entity.SetTransform(GetCurrentTransform());
+  if (auto last_entity = GetCurrentPass().GetLastEntity();
+      last_entity && paint.blend_mode <= Entity::kLastPipelineBlendMode &&
+      last_entity->GetClipDepth() == entity.GetClipDepth() &&
+      last_entity->GetBlendMode() == entity.GetBlendMode() &&
+      last_entity->GetTransform() == entity.GetTransform()) {
+    if (auto last_text_contents =
+            std::dynamic_pointer_cast<TextContents>(last_entity->GetContents());
+        last_text_contents && last_text_contents->GetColor() == paint.color) {
+      last_text_contents->AddTextFrame(text_frame, position);
+      return;
+    }
+  }
 
+  text_contents->AddTextFrame(text_frame, position);
+  entity.SetContents(std::move(text_contents));
   GetCurrentPass().AddEntity(std::move(entity));
 }
 
@@ -64,9 +64,13 @@ class Canvas {
 
   void Save();
 
+  /// @param[in]  can_distribute_opacity  Whether the contents of the layer
+  ///             are known not to overlap, so that the opacity of |paint|
+  ///             can be applied to each of them instead of to the layer.
   void SaveLayer(const Paint& paint,
                  std::optional<Rect> bounds = std::nullopt,
-                 const std::shared_ptr<ImageFilter>& backdrop_filter = nullptr);
+                 const std::shared_ptr<ImageFilter>& backdrop_filter = nullptr,
+                 bool can_distribute_opacity = false);
 
   bool Restore();
 
@@ -60,4 +60,19 @@ BENCHMARK_CAPTURE(BM_CanvasRecord, draw_rect, &DrawRect);
 BENCHMARK_CAPTURE(BM_CanvasRecord, draw_circle, &DrawCircle);
 BENCHMARK_CAPTURE(BM_CanvasRecord, draw_line, &DrawLine);
 
+// Independent subtrees (and offscreen snapshots) are recorded into their own
+// canvases. These variants record one canvas per thread concurrently, which
+// shows how encode time scales with the number of threads doing the work.
+// Wall clock time is used so that the numbers across thread counts are
+// comparable.
+BENCHMARK_CAPTURE(BM_CanvasRecord, draw_rect_parallel, &DrawRect)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_CanvasRecord, draw_circle_parallel, &DrawCircle)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_CanvasRecord, draw_line_parallel, &DrawLine)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
 }  // namespace impeller
@@ -110,12 +110,12 @@ class CanvasRecorder {
     return ExecuteAndSerialize(CanvasRecorderOp::kSave, &Canvas::Save);
   }
 
-  void SaveLayer(
-      const Paint& paint,
-      std::optional<Rect> bounds = std::nullopt,
-      const std::shared_ptr<ImageFilter>& backdrop_filter = nullptr) {
+  void SaveLayer(const Paint& paint,
+                 std::optional<Rect> bounds = std::nullopt,
+                 const std::shared_ptr<ImageFilter>& backdrop_filter = nullptr,
+                 bool can_distribute_opacity = false) {
     return ExecuteAndSerialize(FLT_CANVAS_RECORDER_OP_ARG(SaveLayer), paint,
-                               bounds, backdrop_filter);
+                               bounds, backdrop_filter, can_distribute_opacity);
   }
 
   bool Restore() {
@@ -54,6 +54,8 @@ class Serializer {
 
   void Write(const std::vector<Color>& matrices) {}
 
+  void Write(bool value) {}
+
   CanvasRecorderOp last_op_;
 };
 }  // namespace
@@ -7,7 +7,9 @@
 #include <utility>
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 #include "impeller/entity/contents/filters/filter_contents.h"
+#include "impeller/entity/contents/filters/fused_color_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/entity/entity.h"
 #include "impeller/geometry/color.h"
 
 namespace impeller {
@@ -67,6 +69,20 @@ ColorFilter::ColorFilterProc BlendColorFilter::GetCPUColorFilterProc() const {
   };
 }
 
+bool BlendColorFilter::GetFusedStages(
+    std::vector<FusedColorFilterContents::Stage>& stages) const {
+  // Advanced blends are only implemented by their own shaders.
+  if (blend_mode_ > Entity::kLastPipelineBlendMode) {
+    return false;
+  }
+  stages.push_back({
+      .kind = FusedColorFilterContents::Stage::Kind::kBlend,
+      .blend_mode = blend_mode_,
+      .color = color_,
+  });
+  return true;
+}
+
 std::shared_ptr<ColorFilter> BlendColorFilter::Clone() const {
   return std::make_shared<BlendColorFilter>(*this);
 }
@@ -95,6 +111,15 @@ ColorFilter::ColorFilterProc MatrixColorFilter::GetCPUColorFilterProc() const {
   };
 }
 
+bool MatrixColorFilter::GetFusedStages(
+    std::vector<FusedColorFilterContents::Stage>& stages) const {
+  stages.push_back({
+      .kind = FusedColorFilterContents::Stage::Kind::kMatrix,
+      .matrix = color_matrix_,
+  });
+  return true;
+}
+
 std::shared_ptr<ColorFilter> MatrixColorFilter::Clone() const {
   return std::make_shared<MatrixColorFilter>(*this);
 }
@@ -121,6 +146,13 @@ ColorFilter::ColorFilterProc SrgbToLinearColorFilter::GetCPUColorFilterProc()
   return [](Color color) { return color.SRGBToLinear(); };
 }
 
+bool SrgbToLinearColorFilter::GetFusedStages(
+    std::vector<FusedColorFilterContents::Stage>& stages) const {
+  stages.push_back(
+      {.kind = FusedColorFilterContents::Stage::Kind::kSrgbToLinear});
+  return true;
+}
+
 std::shared_ptr<ColorFilter> SrgbToLinearColorFilter::Clone() const {
   return std::make_shared<SrgbToLinearColorFilter>(*this);
 }
@@ -137,7 +169,7 @@ std::shared_ptr<ColorFilterContents>
 LinearToSrgbColorFilter::WrapWithGPUColorFilter(
     std::shared_ptr<FilterInput> input,
     ColorFilterContents::AbsorbOpacity absorb_opacity) const {
-  auto filter = ColorFilterContents::MakeSrgbToLinearFilter({std::move(input)});
+  auto filter = ColorFilterContents::MakeLinearToSrgbFilter({std::move(input)});
   filter->SetAbsorbOpacity(absorb_opacity);
   return filter;
 }
@@ -147,6 +179,13 @@ ColorFilter::ColorFilterProc LinearToSrgbColorFilter::GetCPUColorFilterProc()
   return [](Color color) { return color.LinearToSRGB(); };
 }
 
+bool LinearToSrgbColorFilter::GetFusedStages(
+    std::vector<FusedColorFilterContents::Stage>& stages) const {
+  stages.push_back(
+      {.kind = FusedColorFilterContents::Stage::Kind::kLinearToSrgb});
+  return true;
+}
+
 std::shared_ptr<ColorFilter> LinearToSrgbColorFilter::Clone() const {
   return std::make_shared<LinearToSrgbColorFilter>(*this);
 }
@@ -166,6 +205,14 @@ std::shared_ptr<ColorFilterContents>
 ComposedColorFilter::WrapWithGPUColorFilter(
     std::shared_ptr<FilterInput> input,
     ColorFilterContents::AbsorbOpacity absorb_opacity) const {
+  // Apply the whole chain in as few passes as possible instead of rendering
+  // every filter in it to its own texture.
+  std::vector<FusedColorFilterContents::Stage> stages;
+  if (GetFusedStages(stages)) {
+    return FusedColorFilterContents::MakeChain(std::move(input), stages,
+                                               absorb_opacity);
+  }
+
   std::shared_ptr<FilterContents> inner = inner_->WrapWithGPUColorFilter(
       input, ColorFilterContents::AbsorbOpacity::kNo);
   return outer_->WrapWithGPUColorFilter(FilterInput::Make(inner),
@@ -182,6 +229,12 @@ ColorFilter::ColorFilterProc ComposedColorFilter::GetCPUColorFilterProc()
   };
 }
 
+// |ColorFilter|
+bool ComposedColorFilter::GetFusedStages(
+    std::vector<FusedColorFilterContents::Stage>& stages) const {
+  return inner_->GetFusedStages(stages) && outer_->GetFusedStages(stages);
+}
+
 // |ColorFilter|
 std::shared_ptr<ColorFilter> ComposedColorFilter::Clone() const {
   return std::make_shared<ComposedColorFilter>(outer_, inner_);
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include "impeller/entity/contents/filters/color_filter_contents.h"
+#include "impeller/entity/contents/filters/fused_color_filter_contents.h"
 #include "impeller/geometry/color.h"
 
 namespace impeller {
@@ -53,6 +56,14 @@ class ColorFilter {
   ///        Impeller Colors on the CPU.
   virtual ColorFilterProc GetCPUColorFilterProc() const = 0;
 
+  /// @brief  Appends the stages that apply this filter in a
+  ///         `FusedColorFilterContents` to `stages`.
+  ///
+  /// @return Whether this filter can be applied by fused stages. If not,
+  ///         `stages` is left in an unspecified state.
+  virtual bool GetFusedStages(
+      std::vector<FusedColorFilterContents::Stage>& stages) const = 0;
+
   virtual std::shared_ptr<ColorFilter> Clone() const = 0;
 };
 
@@ -74,6 +85,10 @@ class BlendColorFilter final : public ColorFilter {
   // |ColorFilter|
   ColorFilterProc GetCPUColorFilterProc() const override;
 
+  // |ColorFilter|
+  bool GetFusedStages(
+      std::vector<FusedColorFilterContents::Stage>& stages) const override;
+
   // |ColorFilter|
   std::shared_ptr<ColorFilter> Clone() const override;
 
@@ -100,6 +115,10 @@ class MatrixColorFilter final : public ColorFilter {
   // |ColorFilter|
   ColorFilterProc GetCPUColorFilterProc() const override;
 
+  // |ColorFilter|
+  bool GetFusedStages(
+      std::vector<FusedColorFilterContents::Stage>& stages) const override;
+
   // |ColorFilter|
   std::shared_ptr<ColorFilter> Clone() const override;
 
@@ -125,6 +144,10 @@ class SrgbToLinearColorFilter final : public ColorFilter {
   // |ColorFilter|
   ColorFilterProc GetCPUColorFilterProc() const override;
 
+  // |ColorFilter|
+  bool GetFusedStages(
+      std::vector<FusedColorFilterContents::Stage>& stages) const override;
+
   // |ColorFilter|
   std::shared_ptr<ColorFilter> Clone() const override;
 };
@@ -147,6 +170,10 @@ class LinearToSrgbColorFilter final : public ColorFilter {
   // |ColorFilter|
   ColorFilterProc GetCPUColorFilterProc() const override;
 
+  // |ColorFilter|
+  bool GetFusedStages(
+      std::vector<FusedColorFilterContents::Stage>& stages) const override;
+
   // |ColorFilter|
   std::shared_ptr<ColorFilter> Clone() const override;
 };
@@ -167,6 +194,10 @@ class ComposedColorFilter final : public ColorFilter {
   // |ColorFilter|
   ColorFilterProc GetCPUColorFilterProc() const override;
 
+  // |ColorFilter|
+  bool GetFusedStages(
+      std::vector<FusedColorFilterContents::Stage>& stages) const override;
+
   // |ColorFilter|
   std::shared_ptr<ColorFilter> Clone() const override;
 
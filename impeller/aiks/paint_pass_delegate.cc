@@ -58,8 +58,11 @@ std::shared_ptr<FilterContents> PaintPassDelegate::WithImageFilter(
 /// OpacityPeepholePassDelegate
 /// ----------------------------------------------
 
-OpacityPeepholePassDelegate::OpacityPeepholePassDelegate(Paint paint)
-    : paint_(std::move(paint)) {}
+OpacityPeepholePassDelegate::OpacityPeepholePassDelegate(
+    Paint paint,
+    bool children_are_disjoint)
+    : paint_(std::move(paint)),
+      children_are_disjoint_(children_are_disjoint) {}
 
 // |EntityPassDelgate|
 OpacityPeepholePassDelegate::~OpacityPeepholePassDelegate() = default;
@@ -79,11 +82,31 @@ bool OpacityPeepholePassDelegate::CanCollapseIntoParentPass(
 
   // OpacityPeepholePassDelegate will only get used if the pass's blend mode is
   // SourceOver, so no need to check here.
-  if (paint_.color.alpha <= 0.0 || paint_.color.alpha >= 1.0 ||
-      paint_.image_filter || paint_.color_filter) {
+  if (paint_.color.alpha <= 0.0 || paint_.image_filter ||
+      paint_.GetColorFilter()) {
     return false;
   }
 
+  // Source-over is associative, so an opaque layer whose children all draw
+  // with source-over produces the same pixels as drawing the children into
+  // the parent directly, whether or not they overlap. Nothing needs to
+  // inherit opacity here.
+  if (paint_.color.alpha >= 1.0) {
+    bool all_source_over = true;
+    auto had_subpass =
+        entity_pass->IterateUntilSubpass([&all_source_over](Entity& entity) {
+          auto blend_mode = entity.GetBlendMode();
+          if (blend_mode == BlendMode::kSourceOver ||
+              (blend_mode == BlendMode::kSource &&
+               entity.GetContents()->IsOpaque())) {
+            return true;
+          }
+          all_source_over = false;
+          return false;
+        });
+    return !had_subpass && all_source_over;
+  }
+
   // Note: determing whether any coverage intersects has quadradic complexity in
   // the number of rectangles, and depending on whether or not we cache at
   // different levels of the entity tree may end up cubic. In the interest of
@@ -92,7 +115,10 @@ bool OpacityPeepholePassDelegate::CanCollapseIntoParentPass(
   // command wrapped in save layer. This would indicate something like an
   // Opacity or FadeTransition wrapping a very simple widget, like in the
   // CupertinoPicker.
-  if (entity_pass->GetElementCount() > 3) {
+  //
+  // When the contents are known to be disjoint ahead of time, every entity
+  // only needs to be checked for its ability to inherit opacity.
+  if (!children_are_disjoint_ && entity_pass->GetElementCount() > 3) {
     // Single paint command with a save layer would be:
     // 1. clip
     // 2. draw command
@@ -102,12 +128,15 @@ bool OpacityPeepholePassDelegate::CanCollapseIntoParentPass(
   bool all_can_accept = true;
   std::vector<Rect> all_coverages;
   auto had_subpass = entity_pass->IterateUntilSubpass(
-      [&all_coverages, &all_can_accept](Entity& entity) {
+      [&all_coverages, &all_can_accept, this](Entity& entity) {
         const auto& contents = entity.GetContents();
         if (!entity.CanInheritOpacity()) {
           all_can_accept = false;
           return false;
         }
+        if (children_are_disjoint_) {
+          return true;
+        }
         auto maybe_coverage = contents->GetCoverage(entity);
         if (maybe_coverage.has_value()) {
           auto coverage = maybe_coverage.value();
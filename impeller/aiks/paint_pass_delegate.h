@@ -46,11 +46,18 @@ class PaintPassDelegate final : public EntityPassDelegate {
 /// A delegate that attempts to forward opacity from a save layer to
 /// child contents.
 ///
-/// Currently this has a hardcoded limit of 3 entities in a pass, and
-/// cannot forward to child subpass delegates.
+/// Unless the contents of the layer are already known not to overlap, this
+/// has a hardcoded limit of 3 entities in a pass. It cannot forward to child
+/// subpass delegates.
 class OpacityPeepholePassDelegate final : public EntityPassDelegate {
  public:
-  explicit OpacityPeepholePassDelegate(Paint paint);
+  /// @param[in]  children_are_disjoint  Whether the caller has proven that
+  ///             the contents drawn into the layer do not overlap, as
+  ///             `flutter::SaveLayerOptions::can_distribute_opacity` does.
+  ///             The coverage of the entities then does not need to be
+  ///             compared.
+  explicit OpacityPeepholePassDelegate(Paint paint,
+                                       bool children_are_disjoint = false);
 
   // |EntityPassDelgate|
   ~OpacityPeepholePassDelegate() override;
@@ -73,6 +80,7 @@ class OpacityPeepholePassDelegate final : public EntityPassDelegate {
 
  private:
   const Paint paint_;
+  const bool children_are_disjoint_;
 
   OpacityPeepholePassDelegate(const OpacityPeepholePassDelegate&) = delete;
 
@@ -255,4 +255,8 @@ void TraceSerializer::Write(const std::vector<Rect>& matrices) {
 void TraceSerializer::Write(const std::vector<Color>& matrices) {
   buffer_ << "[std::vector<Color>] ";
 }
+
+void TraceSerializer::Write(bool value) {
+  buffer_ << "[" << (value ? "true" : "false") << "] ";
+}
 }  // namespace impeller
@@ -57,6 +57,8 @@ class TraceSerializer {
 
   void Write(const std::vector<Color>& matrices);
 
+  void Write(bool value);
+
  private:
   std::stringstream buffer_;
 };
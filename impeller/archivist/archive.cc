@@ -4,10 +4,12 @@
 
 #include "impeller/archivist/archive.h"
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/logging.h"
 #include "impeller/archivist/archive_class_registration.h"
 #include "impeller/archivist/archive_database.h"
 #include "impeller/archivist/archive_location.h"
+#include "impeller/archivist/archive_statement.h"
 
 namespace impeller {
 
@@ -23,6 +25,10 @@ bool Archive::IsValid() const {
   return database_->IsValid();
 }
 
+ArchiveTransaction Archive::CreateTransaction() {
+  return database_->CreateTransaction(transaction_count_);
+}
+
 std::optional<int64_t /* row id */> Archive::ArchiveInstance(
     const ArchiveDef& definition,
     const Archivable& archivable) {
@@ -39,7 +45,16 @@ std::optional<int64_t /* row id */> Archive::ArchiveInstance(
     return std::nullopt;
   }
 
-  auto statement = registration->CreateInsertStatement();
+  /*
+   *  Preparing the insert statement is more expensive than the write itself,
+   *  so statements are reused across writes of the same class.
+   */
+  std::unique_ptr<ArchiveStatement> statement_ptr =
+      registration->TakeInsertStatement();
+  fml::ScopedCleanupClosure return_statement([&]() {
+    registration->ReturnInsertStatement(std::move(statement_ptr));
+  });
+  auto& statement = *statement_ptr;
 
   if (!statement.IsValid() || !statement.Reset()) {
     /*
@@ -11,6 +11,7 @@
 #include <type_traits>
 
 #include "impeller/archivist/archivable.h"
+#include "impeller/archivist/archive_transaction.h"
 
 namespace impeller {
 
@@ -25,6 +26,17 @@ class Archive {
 
   bool IsValid() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Starts a transaction that all writes are made in until it is
+  ///             destroyed, like all the writes of a frame. Committing many
+  ///             writes together is much cheaper than committing each one.
+  ///
+  ///             The writes are only committed if the transaction is marked
+  ///             as ready for commit, and rolled back otherwise. The
+  ///             transaction must be destroyed before the archive is.
+  ///
+  [[nodiscard]] ArchiveTransaction CreateTransaction();
+
   template <class T,
             class = std::enable_if_t<std::is_base_of<Archivable, T>::value>>
   [[nodiscard]] bool Write(const T& archivable) {
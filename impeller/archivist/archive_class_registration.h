@@ -5,7 +5,9 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/archivist/archive.h"
@@ -27,6 +29,21 @@ class ArchiveClassRegistration {
 
   ArchiveStatement CreateInsertStatement() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Takes an insert statement for the class out of the ones that
+  ///             were returned with `ReturnInsertStatement`, or prepares a new
+  ///             one if all of them are in use, like by the write of an
+  ///             archivable that writes another archivable of the same class.
+  ///
+  std::unique_ptr<ArchiveStatement> TakeInsertStatement() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns an insert statement that is no longer used so that
+  ///             later writes can reuse it instead of preparing their own.
+  ///
+  void ReturnInsertStatement(
+      std::unique_ptr<ArchiveStatement> statement) const;
+
   ArchiveStatement CreateQueryStatement(bool single) const;
 
  private:
@@ -42,6 +59,7 @@ class ArchiveClassRegistration {
   const ArchiveDef definition_;
   MemberColumnMap column_map_;
   bool is_valid_ = false;
+  mutable std::vector<std::unique_ptr<ArchiveStatement>> insert_statements_;
 
   ArchiveClassRegistration(const ArchiveClassRegistration&) = delete;
 
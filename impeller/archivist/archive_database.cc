@@ -59,6 +59,26 @@ ArchiveDatabase::ArchiveDatabase(const std::string& filename)
     return;
   }
 
+  /*
+   *  With a write-ahead log, committing a transaction appends to the log
+   *  instead of rewriting the database pages, and only checkpoints need to
+   *  sync. Archives are written far more often than they are read, so this
+   *  is worth the extra files. Archives that can't use a log, like in-memory
+   *  ones, just keep their journal mode.
+   */
+  {
+    ArchiveStatement journal_mode(handle_->Get(), "PRAGMA journal_mode=WAL;");
+    if (!journal_mode.IsValid() ||
+        journal_mode.Execute() == ArchiveStatement::Result::kFailure) {
+      VALIDATION_LOG << "Could not enable the archive write-ahead log.";
+    }
+    ArchiveStatement synchronous(handle_->Get(), "PRAGMA synchronous=NORMAL;");
+    if (!synchronous.IsValid() ||
+        synchronous.Execute() == ArchiveStatement::Result::kFailure) {
+      VALIDATION_LOG << "Could not relax the archive synchronization.";
+    }
+  }
+
   begin_transaction_stmt_ = std::unique_ptr<ArchiveStatement>(
       new ArchiveStatement(handle_->Get(), "BEGIN TRANSACTION;"));
 
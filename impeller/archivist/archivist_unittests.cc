@@ -186,6 +186,47 @@ TEST_F(ArchiveTest, ReadDataWithNames) {
   }
 }
 
+TEST_F(ArchiveTest, CommitsWritesInTransaction) {
+  Archive archive(GetArchiveFileName().c_str());
+  ASSERT_TRUE(archive.IsValid());
+
+  size_t count = 100;
+
+  std::vector<PrimaryKey::value_type> keys;
+  std::vector<uint64_t> values;
+
+  {
+    auto transaction = archive.CreateTransaction();
+    for (size_t i = 0; i < count; i++) {
+      Sample sample(i + 1);
+      keys.push_back(sample.GetPrimaryKey().value());
+      values.push_back(sample.GetSomeData());
+      ASSERT_TRUE(archive.Write(sample));
+    }
+    transaction.MarkWritesAsReadyForCommit();
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    Sample sample;
+    ASSERT_TRUE(archive.Read(keys[i], sample));
+    ASSERT_EQ(values[i], sample.GetSomeData());
+  }
+}
+
+TEST_F(ArchiveTest, RollsBackWritesInUncommittedTransaction) {
+  Archive archive(GetArchiveFileName().c_str());
+  ASSERT_TRUE(archive.IsValid());
+
+  Sample sample(42);
+  {
+    auto transaction = archive.CreateTransaction();
+    ASSERT_TRUE(archive.Write(sample));
+  }
+
+  Sample read;
+  ASSERT_FALSE(archive.Read(sample.GetPrimaryKey().value(), read));
+}
+
 TEST_F(ArchiveTest, CanReadWriteVectorOfArchivables) {
   Archive archive(GetArchiveFileName().c_str());
   ASSERT_TRUE(archive.IsValid());
@@ -4,6 +4,8 @@
 
 #include "impeller/core/allocator.h"
 
+#include <algorithm>
+
 #include "impeller/base/validation.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/core/formats.h"
@@ -11,7 +13,8 @@
 
 namespace impeller {
 
-Allocator::Allocator() = default;
+Allocator::Allocator()
+    : memory_tracker_(std::make_shared<DeviceMemoryTracker>()) {}
 
 Allocator::~Allocator() = default;
 
@@ -43,7 +46,30 @@ std::shared_ptr<DeviceBuffer> Allocator::CreateBufferWithCopy(
 
 std::shared_ptr<DeviceBuffer> Allocator::CreateBuffer(
     const DeviceBufferDescriptor& desc) {
-  return OnCreateBuffer(desc);
+  auto buffer = OnCreateBuffer(desc);
+  if (buffer) {
+    auto category = desc.storage_mode == StorageMode::kHostVisible
+                        ? DeviceMemoryCategory::kHostVisibleBuffer
+                        : DeviceMemoryCategory::kDeviceBuffer;
+    buffer->tracked_memory_ =
+        TrackedDeviceMemory(memory_tracker_, category, desc.size);
+  }
+  return buffer;
+}
+
+/// The bytes of all mip levels, faces and samples of a texture.
+static size_t EstimateTextureBytes(const TextureDescriptor& desc) {
+  size_t bytes = 0u;
+  ISize mip_size = desc.size;
+  for (size_t mip = 0u; mip < std::max<size_t>(desc.mip_count, 1u); mip++) {
+    bytes += mip_size.Area() * BytesPerPixelForPixelFormat(desc.format);
+    mip_size = ISize(std::max<int64_t>(mip_size.width / 2, 1),
+                     std::max<int64_t>(mip_size.height / 2, 1));
+  }
+  if (desc.type == TextureType::kTextureCube) {
+    bytes *= 6u;
+  }
+  return bytes * static_cast<size_t>(desc.sample_count);
 }
 
 std::shared_ptr<Texture> Allocator::CreateTexture(
@@ -55,11 +81,33 @@ std::shared_ptr<Texture> Allocator::CreateTexture(
     return nullptr;
   }
 
-  return OnCreateTexture(desc);
+  auto texture = OnCreateTexture(desc);
+  if (texture) {
+    auto category = TextureUsageIsRenderTarget(desc.usage)
+                        ? DeviceMemoryCategory::kRenderTarget
+                        : DeviceMemoryCategory::kTexture;
+    texture->tracked_memory_ = TrackedDeviceMemory(
+        memory_tracker_, category, EstimateTextureBytes(desc));
+  }
+  return texture;
 }
 
 void Allocator::DidAcquireSurfaceFrame() {}
 
+bool Allocator::HasUnifiedMemory() const {
+  return false;
+}
+
+DeviceMemoryUsage Allocator::GetDeviceMemoryUsage() const {
+  auto usage = memory_tracker_->GetUsage();
+  usage.device_heap_bytes = OnGetDeviceHeapUsage();
+  return usage;
+}
+
+std::optional<size_t> Allocator::OnGetDeviceHeapUsage() const {
+  return std::nullopt;
+}
+
 uint16_t Allocator::MinimumBytesPerRow(PixelFormat format) const {
   return BytesPerPixelForPixelFormat(format);
 }
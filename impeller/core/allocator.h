@@ -6,6 +6,7 @@
 
 #include "flutter/fml/mapping.h"
 #include "impeller/core/device_buffer_descriptor.h"
+#include "impeller/core/device_memory_usage.h"
 #include "impeller/core/texture.h"
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/geometry/size.h"
@@ -47,9 +48,38 @@ class Allocator {
   /// allocation pools.
   virtual void DidAcquireSurfaceFrame();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether host visible buffers created by this allocator are
+  ///             also device local, so the device can read them without a
+  ///             staging copy.
+  ///
+  ///             Host buffers suballocate straight from mapped device memory
+  ///             on allocators that report unified memory. Backends that do so
+  ///             must keep device buffers referenced by encoded commands alive
+  ///             until the device is done with them.
+  ///
+  virtual bool HasUnifiedMemory() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The device memory held by live buffers and textures created
+  ///             by this allocator, broken down by category. Can be called
+  ///             from any thread.
+  ///
+  ///             Resources that wrap memory owned by someone else, like
+  ///             onscreen textures, are not counted.
+  ///
+  DeviceMemoryUsage GetDeviceMemoryUsage() const;
+
  protected:
   Allocator();
 
+  //----------------------------------------------------------------------------
+  /// @brief      The device local memory in use by the process, as reported
+  ///             by the driver. Backends that can't query it return
+  ///             `std::nullopt`, which is the default.
+  ///
+  virtual std::optional<size_t> OnGetDeviceHeapUsage() const;
+
   virtual std::shared_ptr<DeviceBuffer> OnCreateBuffer(
       const DeviceBufferDescriptor& desc) = 0;
 
@@ -57,6 +87,8 @@ class Allocator {
       const TextureDescriptor& desc) = 0;
 
  private:
+  std::shared_ptr<DeviceMemoryTracker> memory_tracker_;
+
   Allocator(const Allocator&) = delete;
 
   Allocator& operator=(const Allocator&) = delete;
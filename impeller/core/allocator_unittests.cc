@@ -79,5 +79,57 @@ TEST(AllocatorTest, TextureDescriptorCompatibility) {
   }
 }
 
+TEST(AllocatorTest, TracksDeviceMemoryOfLiveResources) {
+  using ::testing::_;
+  using ::testing::Invoke;
+  using ::testing::Return;
+
+  MockAllocator allocator;
+  EXPECT_CALL(allocator, GetMaxTextureSizeSupported())
+      .WillRepeatedly(Return(ISize(4096, 4096)));
+  EXPECT_CALL(allocator, OnCreateBuffer(_))
+      .WillRepeatedly(Invoke([](const DeviceBufferDescriptor& desc) {
+        return std::make_shared<MockDeviceBuffer>(desc);
+      }));
+  EXPECT_CALL(allocator, OnCreateTexture(_))
+      .WillRepeatedly(Invoke([](const TextureDescriptor& desc) {
+        return std::make_shared<MockTexture>(desc);
+      }));
+
+  auto host_buffer = allocator.CreateBuffer(
+      {.storage_mode = StorageMode::kHostVisible, .size = 128});
+  auto device_buffer = allocator.CreateBuffer(
+      {.storage_mode = StorageMode::kDevicePrivate, .size = 256});
+  auto texture = allocator.CreateTexture({
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(4, 4),
+      .mip_count = 3,
+  });
+  auto render_target = allocator.CreateTexture({
+      .type = TextureType::kTexture2DMultisample,
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(10, 10),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget),
+      .sample_count = SampleCount::kCount4,
+  });
+
+  auto usage = allocator.GetDeviceMemoryUsage();
+  EXPECT_EQ(usage.GetBytes(DeviceMemoryCategory::kHostVisibleBuffer), 128u);
+  EXPECT_EQ(usage.GetBytes(DeviceMemoryCategory::kDeviceBuffer), 256u);
+  // 4x4, 2x2 and 1x1 mip levels.
+  EXPECT_EQ(usage.GetBytes(DeviceMemoryCategory::kTexture), 84u);
+  EXPECT_EQ(usage.GetBytes(DeviceMemoryCategory::kRenderTarget), 1600u);
+  EXPECT_EQ(usage.GetTrackedBytes(), 2068u);
+  EXPECT_FALSE(usage.device_heap_bytes.has_value());
+
+  host_buffer.reset();
+  render_target.reset();
+
+  usage = allocator.GetDeviceMemoryUsage();
+  EXPECT_EQ(usage.GetBytes(DeviceMemoryCategory::kHostVisibleBuffer), 0u);
+  EXPECT_EQ(usage.GetBytes(DeviceMemoryCategory::kRenderTarget), 0u);
+  EXPECT_EQ(usage.GetTrackedBytes(), 340u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -11,6 +11,7 @@
 #include "impeller/core/buffer.h"
 #include "impeller/core/buffer_view.h"
 #include "impeller/core/device_buffer_descriptor.h"
+#include "impeller/core/device_memory_usage.h"
 #include "impeller/core/range.h"
 #include "impeller/core/texture.h"
 
@@ -25,6 +26,13 @@ class DeviceBuffer : public Buffer,
                                     Range source_range,
                                     size_t offset = 0u);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Make writes made by the host through `OnGetContents` in the
+  ///             given range visible to the device. Only necessary for memory
+  ///             that is not host coherent.
+  ///
+  virtual void Flush(Range range) const;
+
   virtual bool SetLabel(const std::string& label) = 0;
 
   virtual bool SetLabel(const std::string& label, Range range) = 0;
@@ -54,6 +62,10 @@ class DeviceBuffer : public Buffer,
                                 size_t offset) = 0;
 
  private:
+  friend class Allocator;
+
+  TrackedDeviceMemory tracked_memory_;
+
   DeviceBuffer(const DeviceBuffer&) = delete;
 
   DeviceBuffer& operator=(const DeviceBuffer&) = delete;
@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/core/device_memory_usage.h"
+
+#include <numeric>
+
+#include "flutter/fml/logging.h"
+
+namespace impeller {
+
+size_t DeviceMemoryUsage::GetBytes(DeviceMemoryCategory category) const {
+  return bytes[static_cast<size_t>(category)];
+}
+
+size_t DeviceMemoryUsage::GetTrackedBytes() const {
+  return std::accumulate(bytes.begin(), bytes.end(), size_t{0u});
+}
+
+DeviceMemoryTracker::DeviceMemoryTracker() = default;
+
+DeviceMemoryTracker::~DeviceMemoryTracker() = default;
+
+void DeviceMemoryTracker::Add(DeviceMemoryCategory category, size_t bytes) {
+  bytes_[static_cast<size_t>(category)].fetch_add(bytes,
+                                                  std::memory_order_relaxed);
+}
+
+void DeviceMemoryTracker::Remove(DeviceMemoryCategory category, size_t bytes) {
+  auto previous = bytes_[static_cast<size_t>(category)].fetch_sub(
+      bytes, std::memory_order_relaxed);
+  FML_DCHECK(previous >= bytes);
+}
+
+DeviceMemoryUsage DeviceMemoryTracker::GetUsage() const {
+  DeviceMemoryUsage usage;
+  for (size_t i = 0u; i < kDeviceMemoryCategoryCount; i++) {
+    usage.bytes[i] = bytes_[i].load(std::memory_order_relaxed);
+  }
+  return usage;
+}
+
+TrackedDeviceMemory::TrackedDeviceMemory() = default;
+
+TrackedDeviceMemory::TrackedDeviceMemory(
+    std::shared_ptr<DeviceMemoryTracker> tracker,
+    DeviceMemoryCategory category,
+    size_t bytes)
+    : tracker_(std::move(tracker)), category_(category), bytes_(bytes) {
+  if (tracker_) {
+    tracker_->Add(category_, bytes_);
+  }
+}
+
+TrackedDeviceMemory::~TrackedDeviceMemory() {
+  Reset();
+}
+
+TrackedDeviceMemory::TrackedDeviceMemory(TrackedDeviceMemory&& other)
+    : tracker_(std::move(other.tracker_)),
+      category_(other.category_),
+      bytes_(other.bytes_) {
+  other.bytes_ = 0u;
+}
+
+TrackedDeviceMemory& TrackedDeviceMemory::operator=(
+    TrackedDeviceMemory&& other) {
+  if (this != &other) {
+    Reset();
+    tracker_ = std::move(other.tracker_);
+    category_ = other.category_;
+    bytes_ = other.bytes_;
+    other.bytes_ = 0u;
+  }
+  return *this;
+}
+
+size_t TrackedDeviceMemory::GetBytes() const {
+  return bytes_;
+}
+
+void TrackedDeviceMemory::Reset() {
+  if (tracker_) {
+    tracker_->Remove(category_, bytes_);
+    tracker_.reset();
+  }
+  bytes_ = 0u;
+}
+
+}  // namespace impeller
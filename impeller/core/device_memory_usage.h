@@ -0,0 +1,128 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      The kinds of resources whose device memory is tracked by an
+///             `Allocator`.
+///
+enum class DeviceMemoryCategory {
+  /// Buffers only the device can access.
+  kDeviceBuffer,
+  /// Buffers the host can map, like host buffer blocks and staging buffers.
+  kHostVisibleBuffer,
+  /// Textures that are only sampled from, like images and glyph atlases.
+  kTexture,
+  /// Textures that can be rendered to, including their multisample and
+  /// stencil attachments.
+  kRenderTarget,
+};
+
+constexpr size_t kDeviceMemoryCategoryCount = 4u;
+
+constexpr const char* DeviceMemoryCategoryToString(
+    DeviceMemoryCategory category) {
+  switch (category) {
+    case DeviceMemoryCategory::kDeviceBuffer:
+      return "DeviceBuffer";
+    case DeviceMemoryCategory::kHostVisibleBuffer:
+      return "HostVisibleBuffer";
+    case DeviceMemoryCategory::kTexture:
+      return "Texture";
+    case DeviceMemoryCategory::kRenderTarget:
+      return "RenderTarget";
+  }
+  return "Unknown";
+}
+
+//------------------------------------------------------------------------------
+/// @brief      A snapshot of the device memory used by the resources of an
+///             allocator.
+///
+struct DeviceMemoryUsage {
+  /// The bytes held by live resources of each category, indexed by
+  /// `DeviceMemoryCategory`. These are estimated from the descriptors the
+  /// resources were created with and don't include any padding or alignment
+  /// the driver adds.
+  std::array<size_t, kDeviceMemoryCategoryCount> bytes = {};
+
+  /// The bytes of device local memory in use by the process as reported by
+  /// the backend, when it can query it. Unlike the tracked bytes, this
+  /// includes memory not allocated through the allocator, like pipelines and
+  /// swapchain images.
+  std::optional<size_t> device_heap_bytes;
+
+  size_t GetBytes(DeviceMemoryCategory category) const;
+
+  size_t GetTrackedBytes() const;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Counts the bytes held by live resources of an allocator. Safe
+///             to use from any thread.
+///
+class DeviceMemoryTracker {
+ public:
+  DeviceMemoryTracker();
+
+  ~DeviceMemoryTracker();
+
+  void Add(DeviceMemoryCategory category, size_t bytes);
+
+  void Remove(DeviceMemoryCategory category, size_t bytes);
+
+  DeviceMemoryUsage GetUsage() const;
+
+ private:
+  std::array<std::atomic<size_t>, kDeviceMemoryCategoryCount> bytes_ = {};
+
+  DeviceMemoryTracker(const DeviceMemoryTracker&) = delete;
+
+  DeviceMemoryTracker& operator=(const DeviceMemoryTracker&) = delete;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      The device memory of a single resource, which is counted by a
+///             tracker for as long as this object is alive. Resources hold
+///             one so that their memory stops being counted as soon as they
+///             are collected.
+///
+class TrackedDeviceMemory {
+ public:
+  TrackedDeviceMemory();
+
+  TrackedDeviceMemory(std::shared_ptr<DeviceMemoryTracker> tracker,
+                      DeviceMemoryCategory category,
+                      size_t bytes);
+
+  ~TrackedDeviceMemory();
+
+  TrackedDeviceMemory(TrackedDeviceMemory&& other);
+
+  TrackedDeviceMemory& operator=(TrackedDeviceMemory&& other);
+
+  size_t GetBytes() const;
+
+ private:
+  std::shared_ptr<DeviceMemoryTracker> tracker_;
+  DeviceMemoryCategory category_ = DeviceMemoryCategory::kDeviceBuffer;
+  size_t bytes_ = 0u;
+
+  void Reset();
+
+  TrackedDeviceMemory(const TrackedDeviceMemory&) = delete;
+
+  TrackedDeviceMemory& operator=(const TrackedDeviceMemory&) = delete;
+};
+
+}  // namespace impeller
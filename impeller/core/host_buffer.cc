@@ -19,57 +19,146 @@ std::shared_ptr<HostBuffer> HostBuffer::Create() {
   return std::shared_ptr<HostBuffer>(new HostBuffer());
 }
 
-HostBuffer::HostBuffer() = default;
+HostBuffer::HostBuffer() {
+  for (auto& state : states_) {
+    state = std::make_shared<HostBufferState>();
+  }
+}
 
 HostBuffer::~HostBuffer() = default;
 
 void HostBuffer::SetLabel(std::string label) {
-  state_->label = std::move(label);
+  for (auto& state : states_) {
+    state->label = label;
+  }
+  label_ = std::move(label);
+}
+
+void HostBuffer::SetDeviceAllocator(
+    const std::shared_ptr<Allocator>& allocator) {
+  FML_DCHECK(GetLength() == 0u);
+  device_allocator_ =
+      allocator && allocator->HasUnifiedMemory() ? allocator : nullptr;
+  for (auto& state : states_) {
+    if (state->device_allocator != device_allocator_) {
+      state->device_blocks.clear();
+      state->device_allocator = device_allocator_;
+    }
+  }
+}
+
+BufferView HostBuffer::EmplaceDevice(const void* buffer,
+                                     size_t length,
+                                     size_t align) {
+  auto [block, range] =
+      states_[current_state_]->EmplaceDevice(length, align);
+  if (!block) {
+    return {};
+  }
+  auto contents = block->OnGetContents();
+  if (buffer) {
+    ::memmove(contents + range.offset, buffer, length);
+    block->Flush(range);
+  }
+  return BufferView{std::move(block), contents, range};
 }
 
 BufferView HostBuffer::Emplace(const void* buffer,
                                size_t length,
                                size_t align) {
-  auto [device_buffer, range] = state_->Emplace(buffer, length, align);
+  if (device_allocator_) {
+    return EmplaceDevice(buffer, length, align);
+  }
+  const auto& state = states_[current_state_];
+  auto [device_buffer, range] = state->Emplace(buffer, length, align);
   if (!device_buffer) {
     return {};
   }
-  return BufferView{state_, device_buffer, range};
+  return BufferView{state, device_buffer, range};
 }
 
 BufferView HostBuffer::Emplace(const void* buffer, size_t length) {
-  auto [device_buffer, range] = state_->Emplace(buffer, length);
+  if (device_allocator_) {
+    return EmplaceDevice(buffer, length, 0u);
+  }
+  const auto& state = states_[current_state_];
+  auto [device_buffer, range] = state->Emplace(buffer, length);
   if (!device_buffer) {
     return {};
   }
-  return BufferView{state_, device_buffer, range};
+  return BufferView{state, device_buffer, range};
 }
 
 BufferView HostBuffer::Emplace(size_t length,
                                size_t align,
                                const EmplaceProc& cb) {
-  auto [buffer, range] = state_->Emplace(length, align, cb);
+  if (device_allocator_) {
+    if (!cb) {
+      return {};
+    }
+    auto [block, range] =
+        states_[current_state_]->EmplaceDevice(length, align);
+    if (!block) {
+      return {};
+    }
+    auto contents = block->OnGetContents();
+    cb(contents + range.offset);
+    block->Flush(range);
+    return BufferView{std::move(block), contents, range};
+  }
+  const auto& state = states_[current_state_];
+  auto [buffer, range] = state->Emplace(length, align, cb);
   if (!buffer) {
     return {};
   }
-  return BufferView{state_, buffer, range};
+  return BufferView{state, buffer, range};
 }
 
 std::shared_ptr<const DeviceBuffer> HostBuffer::GetDeviceBuffer(
     Allocator& allocator) const {
-  return state_->GetDeviceBuffer(allocator);
+  return states_[current_state_]->GetDeviceBuffer(allocator);
 }
 
 void HostBuffer::Reset() {
-  state_->Reset();
+  last_frame_length_ = states_[current_state_]->GetEmplacedLength();
+  high_water_mark_ = std::max(high_water_mark_, last_frame_length_);
+
+  current_state_ = (current_state_ + 1) % kHostBufferArenaCount;
+  auto& state = states_[current_state_];
+
+  // Buffer views into this arena may still be held by work that is in flight.
+  // Instead of waiting on that work or clobbering its data, leave the arena to
+  // its other owners and start over with a fresh one. Views into device blocks
+  // reference the blocks instead of the arena. At steady state all references
+  // will have been dropped by the time the ring wraps around, and the arena is
+  // reused along with its previously reserved memory.
+  if (state.use_count() > 1 || state->HasReferencedDeviceBlocks()) {
+    state = std::make_shared<HostBufferState>();
+    state->label = label_;
+    state->device_allocator = device_allocator_;
+    return;
+  }
+  state->Reset();
 }
 
 size_t HostBuffer::GetSize() const {
-  return state_->GetReservedLength();
+  size_t size = 0u;
+  for (const auto& state : states_) {
+    size += state->GetCapacity();
+  }
+  return size;
 }
 
 size_t HostBuffer::GetLength() const {
-  return state_->GetLength();
+  return states_[current_state_]->GetEmplacedLength();
+}
+
+size_t HostBuffer::GetLastFrameLength() const {
+  return last_frame_length_;
+}
+
+size_t HostBuffer::GetHighWaterMark() const {
+  return std::max(high_water_mark_, GetLength());
 }
 
 std::pair<uint8_t*, Range> HostBuffer::HostBufferState::Emplace(
@@ -136,9 +225,66 @@ std::pair<uint8_t*, Range> HostBuffer::HostBufferState::Emplace(
   return Emplace(buffer, length);
 }
 
+std::pair<std::shared_ptr<DeviceBuffer>, Range>
+HostBuffer::HostBufferState::EmplaceDevice(size_t length, size_t align) {
+  if (!device_allocator) {
+    return {};
+  }
+  align = std::max<size_t>(align, 1u);
+  while (device_block_index < device_blocks.size()) {
+    const auto& block = device_blocks[device_block_index];
+    auto offset = (device_block_offset + align - 1u) / align * align;
+    if (offset + length <= block->GetDeviceBufferDescriptor().size) {
+      device_block_offset = offset + length;
+      device_length += length;
+      return std::make_pair(block, Range{offset, length});
+    }
+    device_block_index++;
+    device_block_offset = 0u;
+  }
+
+  DeviceBufferDescriptor desc;
+  desc.storage_mode = StorageMode::kHostVisible;
+  desc.size = std::max(kDeviceBlockSize, length);
+  auto block = device_allocator->CreateBuffer(desc);
+  if (!block || !block->OnGetContents()) {
+    return {};
+  }
+  block->SetLabel(label);
+  device_blocks.push_back(block);
+  device_block_index = device_blocks.size() - 1u;
+  device_block_offset = length;
+  device_length += length;
+  return std::make_pair(std::move(block), Range{0u, length});
+}
+
+size_t HostBuffer::HostBufferState::GetEmplacedLength() const {
+  return device_allocator ? device_length : GetLength();
+}
+
+size_t HostBuffer::HostBufferState::GetCapacity() const {
+  size_t capacity = GetReservedLength();
+  for (const auto& block : device_blocks) {
+    capacity += block->GetDeviceBufferDescriptor().size;
+  }
+  return capacity;
+}
+
+bool HostBuffer::HostBufferState::HasReferencedDeviceBlocks() const {
+  for (const auto& block : device_blocks) {
+    if (block.use_count() > 1) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void HostBuffer::HostBufferState::Reset() {
   generation += 1;
   device_buffer = nullptr;
+  device_block_index = 0u;
+  device_block_offset = 0u;
+  device_length = 0u;
   bool did_truncate = Truncate(0);
   FML_CHECK(did_truncate);
 }
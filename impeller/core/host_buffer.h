@@ -5,9 +5,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "impeller/base/allocation.h"
 #include "impeller/core/buffer.h"
@@ -16,6 +18,8 @@
 
 namespace impeller {
 
+class DeviceBuffer;
+
 class HostBuffer final : public Buffer {
  public:
   static std::shared_ptr<HostBuffer> Create();
@@ -25,6 +29,21 @@ class HostBuffer final : public Buffer {
 
   void SetLabel(std::string label);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Suballocate emplaced data directly from persistently mapped,
+  ///             host visible device buffers created by the given allocator
+  ///             instead of staging it in host memory and copying it to the
+  ///             device later.
+  ///
+  ///             This only takes effect if the allocator reports unified
+  ///             memory. Passing null (or an allocator without unified
+  ///             memory) reverts to staging in host memory. Must only be
+  ///             called while the buffer is empty.
+  ///
+  /// @param[in]  allocator  The allocator to suballocate device memory from.
+  ///
+  void SetDeviceAllocator(const std::shared_ptr<Allocator>& allocator);
+
   //----------------------------------------------------------------------------
   /// @brief      Emplace uniform data onto the host buffer. Ensure that backend
   ///             specific uniform alignment requirements are respected.
@@ -109,12 +128,24 @@ class HostBuffer final : public Buffer {
   BufferView Emplace(size_t length, size_t align, const EmplaceProc& cb);
 
   //----------------------------------------------------------------------------
-  /// @brief Resets the contents of the HostBuffer to nothing so it can be
-  ///        reused.
+  /// @brief      Resets the contents of the HostBuffer to nothing so it can be
+  ///             reused.
+  ///
+  ///             The HostBuffer cycles through `kHostBufferArenaCount` arenas,
+  ///             one per frame in flight. Resetting advances to the next arena
+  ///             instead of truncating the one that was just written to, so
+  ///             buffer views handed out before the reset remain valid while
+  ///             the GPU consumes them. An arena that is still referenced (by
+  ///             a command buffer that has not completed, for instance) is
+  ///             never waited on or overwritten. It is handed off to its
+  ///             remaining owners and replaced with a fresh one.
+  ///
   void Reset();
 
   //----------------------------------------------------------------------------
-  /// @brief Returns the capacity of the HostBuffer in memory in bytes.
+  /// @brief Returns the capacity of the HostBuffer in memory in bytes. This
+  ///        is the sum of the capacities of all arenas, including any device
+  ///        memory blocks they suballocate from.
   size_t GetSize() const;
 
   //----------------------------------------------------------------------------
@@ -122,6 +153,26 @@ class HostBuffer final : public Buffer {
   ///        bytes.
   size_t GetLength() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief Returns the number of bytes that were emplaced into the arena
+  ///        that was current before the most recent call to `Reset`.
+  size_t GetLastFrameLength() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief Returns the largest number of bytes that any one arena has held
+  ///        before being reset.
+  size_t GetHighWaterMark() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief The number of arenas the HostBuffer rotates through. This matches
+  ///        the maximum number of frames in flight of the backends.
+  static constexpr size_t kHostBufferArenaCount = 3u;
+
+  //----------------------------------------------------------------------------
+  /// @brief The minimum size of the device memory blocks arenas suballocate
+  ///        from when a device allocator with unified memory is set.
+  static constexpr size_t kDeviceBlockSize = 64u * 1024u;
+
  private:
   struct HostBufferState : public Buffer, public Allocation {
     std::shared_ptr<const DeviceBuffer> GetDeviceBuffer(
@@ -138,15 +189,40 @@ class HostBuffer final : public Buffer {
                                        size_t length,
                                        size_t align);
 
+    [[nodiscard]] std::pair<std::shared_ptr<DeviceBuffer>, Range>
+    EmplaceDevice(size_t length, size_t align);
+
     void Reset();
 
+    size_t GetEmplacedLength() const;
+
+    size_t GetCapacity() const;
+
+    bool HasReferencedDeviceBlocks() const;
+
     mutable std::shared_ptr<DeviceBuffer> device_buffer;
     mutable size_t device_buffer_generation = 0u;
     size_t generation = 1u;
     std::string label;
+
+    // Only used when suballocating directly from device memory.
+    std::shared_ptr<Allocator> device_allocator;
+    std::vector<std::shared_ptr<DeviceBuffer>> device_blocks;
+    size_t device_block_index = 0u;
+    size_t device_block_offset = 0u;
+    size_t device_length = 0u;
   };
 
-  std::shared_ptr<HostBufferState> state_ = std::make_shared<HostBufferState>();
+  [[nodiscard]] BufferView EmplaceDevice(const void* buffer,
+                                         size_t length,
+                                         size_t align);
+
+  std::array<std::shared_ptr<HostBufferState>, kHostBufferArenaCount> states_;
+  size_t current_state_ = 0u;
+  size_t last_frame_length_ = 0u;
+  size_t high_water_mark_ = 0u;
+  std::string label_;
+  std::shared_ptr<Allocator> device_allocator_;
 
   // |Buffer|
   std::shared_ptr<const DeviceBuffer> GetDeviceBuffer(
@@ -7,6 +7,7 @@
 #include <string_view>
 
 #include "flutter/fml/mapping.h"
+#include "impeller/core/device_memory_usage.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/geometry/size.h"
@@ -60,10 +61,13 @@ class Texture {
   bool mipmap_generated_ = false;
 
  private:
+  friend class Allocator;
+
   TextureCoordinateSystem coordinate_system_ =
       TextureCoordinateSystem::kRenderToTexture;
   const TextureDescriptor desc_;
   bool is_opaque_ = false;
+  TrackedDeviceMemory tracked_memory_;
 
   bool IsSliceValid(size_t slice) const;
 
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/parallel_for.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/aiks/color_filter.h"
 #include "impeller/core/formats.h"
@@ -22,6 +23,7 @@
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
 #include "impeller/entity/contents/runtime_effect_contents.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/geometry/convex_shadow.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/geometry/scalar.h"
@@ -44,6 +46,11 @@ DlDispatcher::DlDispatcher(IRect cull_rect) : canvas_(cull_rect) {}
 
 DlDispatcher::~DlDispatcher() = default;
 
+void DlDispatcher::SetConcurrentTaskRunner(
+    std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+  concurrent_task_runner_ = std::move(task_runner);
+}
+
 static BlendMode ToBlendMode(flutter::DlBlendMode mode) {
   switch (mode) {
     case flutter::DlBlendMode::kClear:
@@ -619,6 +626,7 @@ void DlDispatcher::setImageFilter(const flutter::DlImageFilter* filter) {
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::save() {
+  FlushPendingDraws();
   canvas_.Save();
 }
 
@@ -626,33 +634,47 @@ void DlDispatcher::save() {
 void DlDispatcher::saveLayer(const SkRect* bounds,
                              const flutter::SaveLayerOptions options,
                              const flutter::DlImageFilter* backdrop) {
+  FlushPendingDraws();
   auto paint = options.renders_with_attributes() ? paint_ : Paint{};
-  canvas_.SaveLayer(paint, skia_conversions::ToRect(bounds),
-                    ToImageFilter(backdrop));
+  std::shared_ptr<ImageFilter> backdrop_filter;
+  if (backdrop) {
+    if (!last_backdrop_dl_filter_ || *backdrop != *last_backdrop_dl_filter_) {
+      last_backdrop_dl_filter_ = backdrop->shared();
+      last_backdrop_filter_ = ToImageFilter(backdrop);
+    }
+    backdrop_filter = last_backdrop_filter_;
+  }
+  canvas_.SaveLayer(paint, skia_conversions::ToRect(bounds), backdrop_filter,
+                    options.can_distribute_opacity());
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::restore() {
+  FlushPendingDraws();
   canvas_.Restore();
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::translate(SkScalar tx, SkScalar ty) {
+  FlushPendingDraws();
   canvas_.Translate({tx, ty, 0.0});
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::scale(SkScalar sx, SkScalar sy) {
+  FlushPendingDraws();
   canvas_.Scale({sx, sy, 1.0});
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::rotate(SkScalar degrees) {
+  FlushPendingDraws();
   canvas_.Rotate(Degrees{degrees});
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::skew(SkScalar sx, SkScalar sy) {
+  FlushPendingDraws();
   canvas_.Skew(sx, sy);
 }
 
@@ -663,6 +685,7 @@ void DlDispatcher::transform2DAffine(SkScalar mxx,
                                      SkScalar myx,
                                      SkScalar myy,
                                      SkScalar myt) {
+  FlushPendingDraws();
   // clang-format off
   transformFullPerspective(
     mxx, mxy,  0, mxt,
@@ -690,6 +713,7 @@ void DlDispatcher::transformFullPerspective(SkScalar mxx,
                                             SkScalar mwy,
                                             SkScalar mwz,
                                             SkScalar mwt) {
+  FlushPendingDraws();
   // The order of arguments is row-major but Impeller matrices are
   // column-major.
   // clang-format off
@@ -705,6 +729,7 @@ void DlDispatcher::transformFullPerspective(SkScalar mxx,
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::transformReset() {
+  FlushPendingDraws();
   canvas_.ResetTransform();
   canvas_.Transform(initial_matrix_);
 }
@@ -721,11 +746,13 @@ static Entity::ClipOperation ToClipOperation(
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::clipRect(const SkRect& rect, ClipOp clip_op, bool is_aa) {
+  FlushPendingDraws();
   canvas_.ClipRect(skia_conversions::ToRect(rect), ToClipOperation(clip_op));
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::clipRRect(const SkRRect& rrect, ClipOp clip_op, bool is_aa) {
+  FlushPendingDraws();
   if (rrect.isRect()) {
     canvas_.ClipRect(skia_conversions::ToRect(rrect.rect()),
                      ToClipOperation(clip_op));
@@ -740,12 +767,14 @@ void DlDispatcher::clipRRect(const SkRRect& rrect, ClipOp clip_op, bool is_aa) {
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::clipPath(const SkPath& path, ClipOp clip_op, bool is_aa) {
+  FlushPendingDraws();
   canvas_.ClipPath(skia_conversions::ToPath(path), ToClipOperation(clip_op));
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawColor(flutter::DlColor color,
                              flutter::DlBlendMode dl_mode) {
+  FlushPendingDraws();
   Paint paint;
   paint.color = skia_conversions::ToColor(color);
   paint.blend_mode = ToBlendMode(dl_mode);
@@ -754,22 +783,33 @@ void DlDispatcher::drawColor(flutter::DlColor color,
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawPaint() {
+  FlushPendingDraws();
   canvas_.DrawPaint(paint_);
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawLine(const SkPoint& p0, const SkPoint& p1) {
+  FlushPendingDraws();
   canvas_.DrawLine(skia_conversions::ToPoint(p0), skia_conversions::ToPoint(p1),
                    paint_);
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawRect(const SkRect& rect) {
+  if (CanBatchDraws()) {
+    AddPendingDraw({
+        .type = PendingDraw::Type::kRect,
+        .rect = skia_conversions::ToRect(rect),
+    });
+    return;
+  }
+  FlushPendingDraws();
   canvas_.DrawRect(skia_conversions::ToRect(rect), paint_);
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawOval(const SkRect& bounds) {
+  FlushPendingDraws();
   if (bounds.width() == bounds.height()) {
     canvas_.DrawCircle(skia_conversions::ToPoint(bounds.center()),
                        bounds.width() * 0.5, paint_);
@@ -784,11 +824,30 @@ void DlDispatcher::drawOval(const SkRect& bounds) {
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawCircle(const SkPoint& center, SkScalar radius) {
+  if (CanBatchDraws()) {
+    AddPendingDraw({
+        .type = PendingDraw::Type::kCircle,
+        .rect = Rect::MakeLTRB(center.fX - radius, center.fY - radius,
+                               center.fX + radius, center.fY + radius),
+        .radii = Point(radius, radius),
+    });
+    return;
+  }
+  FlushPendingDraws();
   canvas_.DrawCircle(skia_conversions::ToPoint(center), radius, paint_);
 }
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawRRect(const SkRRect& rrect) {
+  if (rrect.isSimple() && CanBatchDraws()) {
+    AddPendingDraw({
+        .type = PendingDraw::Type::kRRect,
+        .rect = skia_conversions::ToRect(rrect.rect()),
+        .radii = skia_conversions::ToPoint(rrect.getSimpleRadii()),
+    });
+    return;
+  }
+  FlushPendingDraws();
   if (rrect.isSimple()) {
     canvas_.DrawRRect(skia_conversions::ToRect(rrect.rect()),
                       skia_conversions::ToPoint(rrect.getSimpleRadii()),
@@ -800,6 +859,7 @@ void DlDispatcher::drawRRect(const SkRRect& rrect) {
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawDRRect(const SkRRect& outer, const SkRRect& inner) {
+  FlushPendingDraws();
   PathBuilder builder;
   builder.AddPath(skia_conversions::ToPath(outer));
   builder.AddPath(skia_conversions::ToPath(inner));
@@ -808,9 +868,80 @@ void DlDispatcher::drawDRRect(const SkRRect& outer, const SkRRect& inner) {
 
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawPath(const SkPath& path) {
+  FlushPendingDraws();
   SimplifyOrDrawPath(canvas_, path, paint_);
 }
 
+bool DlDispatcher::CanBatchDraws() const {
+  return paint_.style == Paint::Style::kFill &&
+         paint_.color_source.GetType() == ColorSource::Type::kColor &&
+         paint_.blend_mode <= Entity::kLastPipelineBlendMode &&
+         !paint_.invert_colors && !paint_.image_filter &&
+         !paint_.color_filter && !paint_.mask_blur_descriptor.has_value();
+}
+
+void DlDispatcher::AddPendingDraw(const PendingDraw& draw) {
+  // Batchable paints only differ in their color and blend mode.
+  if (!pending_draws_.empty() &&
+      (!(pending_paint_.color == paint_.color) ||
+       pending_paint_.blend_mode != paint_.blend_mode)) {
+    FlushPendingDraws();
+  }
+  if (pending_draws_.empty()) {
+    pending_paint_ = paint_;
+  }
+  pending_draws_.push_back(draw);
+}
+
+void DlDispatcher::FlushPendingDraws() {
+  if (pending_draws_.empty()) {
+    return;
+  }
+  if (pending_draws_.size() == 1) {
+    const PendingDraw& draw = pending_draws_.front();
+    switch (draw.type) {
+      case PendingDraw::Type::kRect:
+        canvas_.DrawRect(draw.rect, pending_paint_);
+        break;
+      case PendingDraw::Type::kRRect:
+        canvas_.DrawRRect(draw.rect, draw.radii, pending_paint_);
+        break;
+      case PendingDraw::Type::kCircle:
+        canvas_.DrawCircle(draw.rect.GetOrigin() + draw.radii, draw.radii.x,
+                           pending_paint_);
+        break;
+    }
+    pending_draws_.clear();
+    return;
+  }
+
+  // Each of the shapes is a separate convex contour, so the path is
+  // tessellated into a single triangle strip. The contours are rasterized in
+  // order, so overlapping shapes blend exactly as they would as separate
+  // entities given a blend mode that the pipeline applies.
+  TRACE_EVENT0("impeller", "DlDispatcher::FlushPendingDraws");
+  PathBuilder builder;
+  builder.SetConvexity(Convexity::kConvex);
+  Rect bounds = pending_draws_.front().rect;
+  for (const PendingDraw& draw : pending_draws_) {
+    switch (draw.type) {
+      case PendingDraw::Type::kRect:
+        builder.AddRect(draw.rect);
+        break;
+      case PendingDraw::Type::kRRect:
+        builder.AddRoundedRect(draw.rect, draw.radii);
+        break;
+      case PendingDraw::Type::kCircle:
+        builder.AddCircle(draw.rect.GetOrigin() + draw.radii, draw.radii.x);
+        break;
+    }
+    bounds = bounds.Union(draw.rect);
+  }
+  builder.SetBounds(bounds);
+  canvas_.DrawPath(builder.TakePath(), pending_paint_);
+  pending_draws_.clear();
+}
+
 void DlDispatcher::SimplifyOrDrawPath(CanvasType& canvas,
                                       const SkPath& path,
                                       const Paint& paint) {
@@ -845,6 +976,7 @@ void DlDispatcher::drawArc(const SkRect& oval_bounds,
                            SkScalar start_degrees,
                            SkScalar sweep_degrees,
                            bool use_center) {
+  FlushPendingDraws();
   PathBuilder builder;
   builder.AddArc(skia_conversions::ToRect(oval_bounds), Degrees(start_degrees),
                  Degrees(sweep_degrees), use_center);
@@ -855,6 +987,7 @@ void DlDispatcher::drawArc(const SkRect& oval_bounds,
 void DlDispatcher::drawPoints(PointMode mode,
                               uint32_t count,
                               const SkPoint points[]) {
+  FlushPendingDraws();
   Paint paint = paint_;
   paint.style = Paint::Style::kStroke;
   switch (mode) {
@@ -892,6 +1025,7 @@ void DlDispatcher::drawPoints(PointMode mode,
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawVertices(const flutter::DlVertices* vertices,
                                 flutter::DlBlendMode dl_mode) {
+  FlushPendingDraws();
   canvas_.DrawVertices(MakeVertices(vertices), ToBlendMode(dl_mode), paint_);
 }
 
@@ -900,6 +1034,7 @@ void DlDispatcher::drawImage(const sk_sp<flutter::DlImage> image,
                              const SkPoint point,
                              flutter::DlImageSampling sampling,
                              bool render_with_attributes) {
+  FlushPendingDraws();
   if (!image) {
     return;
   }
@@ -931,6 +1066,7 @@ void DlDispatcher::drawImageRect(
     flutter::DlImageSampling sampling,
     bool render_with_attributes,
     SrcRectConstraint constraint = SrcRectConstraint::kFast) {
+  FlushPendingDraws();
   canvas_.DrawImageRect(
       std::make_shared<Image>(image->impeller_texture()),  // image
       skia_conversions::ToRect(src),                       // source rect
@@ -946,6 +1082,7 @@ void DlDispatcher::drawImageNine(const sk_sp<flutter::DlImage> image,
                                  const SkRect& dst,
                                  flutter::DlFilterMode filter,
                                  bool render_with_attributes) {
+  FlushPendingDraws();
   NinePatchConverter converter = {};
   converter.DrawNinePatch(
       std::make_shared<Image>(image->impeller_texture()),
@@ -964,6 +1101,7 @@ void DlDispatcher::drawAtlas(const sk_sp<flutter::DlImage> atlas,
                              flutter::DlImageSampling sampling,
                              const SkRect* cull_rect,
                              bool render_with_attributes) {
+  FlushPendingDraws();
   canvas_.DrawAtlas(std::make_shared<Image>(atlas->impeller_texture()),
                     skia_conversions::ToRSXForms(xform, count),
                     skia_conversions::ToRects(tex, count),
@@ -976,6 +1114,7 @@ void DlDispatcher::drawAtlas(const sk_sp<flutter::DlImage> atlas,
 void DlDispatcher::drawDisplayList(
     const sk_sp<flutter::DisplayList> display_list,
     SkScalar opacity) {
+  FlushPendingDraws();
   // Save all values that must remain untouched after the operation.
   Paint saved_paint = paint_;
   Matrix saved_initial_matrix = initial_matrix_;
@@ -1012,7 +1151,9 @@ void DlDispatcher::drawDisplayList(
     // so we need the canvas to transform those into the current local
     // coordinate space into which the DisplayList will be rendered.
     auto cull_bounds = canvas_.GetCurrentLocalCullingBounds();
-    if (cull_bounds.has_value()) {
+    if (DispatchConcurrently(*display_list, cull_bounds)) {
+      // The workers have recorded the display_list into this dispatcher.
+    } else if (cull_bounds.has_value()) {
       Rect cull_rect = cull_bounds.value();
       display_list->Dispatch(
           *this, SkRect::MakeLTRB(cull_rect.GetLeft(), cull_rect.GetTop(),
@@ -1026,15 +1167,81 @@ void DlDispatcher::drawDisplayList(
 
   // Restore all saved state back to what it was before we interpreted
   // the display_list
+  FlushPendingDraws();
   canvas_.RestoreToCount(restore_count);
   initial_matrix_ = saved_initial_matrix;
   paint_ = saved_paint;
 }
 
+bool DlDispatcher::DispatchConcurrently(
+    const flutter::DisplayList& display_list,
+    const std::optional<Rect>& cull_rect) {
+  if (!concurrent_task_runner_ ||
+      display_list.op_count() < kMinConcurrentDispatchOps) {
+    return false;
+  }
+  SkRect query = display_list.bounds();
+  if (cull_rect.has_value() &&
+      !query.intersect(SkRect::MakeLTRB(
+          cull_rect->GetLeft(), cull_rect->GetTop(), cull_rect->GetRight(),
+          cull_rect->GetBottom()))) {
+    return false;
+  }
+  TRACE_EVENT0("impeller", "DlDispatcher::DispatchConcurrently");
+  auto groups = display_list.rtree()->searchAndPartitionRects(query);
+  if (groups.size() < 2) {
+    return false;
+  }
+
+  // Spread the groups over the dispatches, largest first, so that each
+  // dispatch records a similar number of ops.
+  std::sort(groups.begin(), groups.end(),
+            [](const auto& a, const auto& b) { return a.size() > b.size(); });
+  std::vector<std::vector<int>> dispatches(
+      std::min(groups.size(), kMaxConcurrentDispatches));
+  for (const auto& group : groups) {
+    auto& dispatch = *std::min_element(
+        dispatches.begin(), dispatches.end(),
+        [](const auto& a, const auto& b) { return a.size() < b.size(); });
+    dispatch.insert(dispatch.end(), group.begin(), group.end());
+  }
+  for (auto& dispatch : dispatches) {
+    std::sort(dispatch.begin(), dispatch.end());
+  }
+
+  std::vector<Picture> pictures(dispatches.size());
+  auto record = [&display_list, &cull_rect, &dispatches, &pictures](size_t i) {
+    TRACE_EVENT0("impeller", "DlDispatcher::DispatchConcurrently::Record");
+    auto dispatcher = cull_rect.has_value()
+                          ? std::make_unique<DlDispatcher>(cull_rect.value())
+                          : std::make_unique<DlDispatcher>();
+    // The display_list may alter the clip, which must be restored at the end
+    // of each picture so that the pictures do not clip each other.
+    dispatcher->save();
+    display_list.Dispatch(*dispatcher, dispatches[i]);
+    dispatcher->restore();
+    pictures[i] = dispatcher->EndRecordingAsPicture();
+  };
+  fml::ParallelFor(concurrent_task_runner_, dispatches.size(), 1,
+                   [&record](size_t begin, size_t end) {
+                     for (size_t i = begin; i < end; i++) {
+                       record(i);
+                     }
+                   });
+
+  // The pictures were recorded in the local coordinates of the canvas,
+  // which |DrawPicture| transforms them from.
+  for (const Picture& picture : pictures) {
+    canvas_.DrawPicture(picture);
+  }
+  return true;
+}
+
 // |flutter::DlOpReceiver|
 void DlDispatcher::drawTextBlob(const sk_sp<SkTextBlob> blob,
                                 SkScalar x,
                                 SkScalar y) {
+  FlushPendingDraws();
   // When running with Impeller enabled Skia text blobs are converted to
   // Impeller text frames in paragraph_skia.cc
   UNIMPLEMENTED;
@@ -1043,6 +1250,7 @@ void DlDispatcher::drawTextBlob(const sk_sp<SkTextBlob> blob,
 void DlDispatcher::drawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
                                  SkScalar x,
                                  SkScalar y) {
+  FlushPendingDraws();
   canvas_.DrawTextFrame(text_frame,             //
                         impeller::Point{x, y},  //
                         paint_                  //
@@ -1050,11 +1258,43 @@ void DlDispatcher::drawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
 }
 
 // |flutter::DlOpReceiver|
+// Whether |SimplifyOrDrawPath| draws the path as a shape that has an analytic
+// mask blur.
+static bool HasAnalyticBlur(const SkPath& path) {
+  SkRect rect;
+  bool closed;
+  if (path.isRect(&rect, &closed) && closed) {
+    return true;
+  }
+  SkRRect rrect;
+  if (path.isRRect(&rrect) && rrect.isSimple()) {
+    return true;
+  }
+  return path.isOval(&rect) && rect.width() == rect.height();
+}
+
+static std::shared_ptr<VerticesGeometry> TessellatePathShadow(
+    const SkPath& path,
+    Sigma sigma,
+    Color color,
+    const Matrix& transform) {
+  auto polyline = skia_conversions::ToPath(path).CreatePolyline(
+      transform.GetMaxBasisLength());
+  if (polyline.contours.size() != 1u) {
+    return nullptr;
+  }
+  auto [start, end] = polyline.GetContourPointBounds(0u);
+  std::vector<Point> polygon(polyline.points->begin() + start,
+                             polyline.points->begin() + end);
+  return TessellateConvexShadow(polygon, sigma, color);
+}
+
 void DlDispatcher::drawShadow(const SkPath& path,
                               const flutter::DlColor color,
                               const SkScalar elevation,
                               bool transparent_occluder,
                               SkScalar dpr) {
+  FlushPendingDraws();
   Color spot_color = skia_conversions::ToColor(color);
   spot_color.alpha *= 0.25;
 
@@ -1103,13 +1343,26 @@ void DlDispatcher::drawShadow(const SkPath& path,
   canvas_.PreConcat(
       Matrix::MakeTranslation(Vector2(0, -occluder_z * light_position.y)));
 
-  SimplifyOrDrawPath(canvas_, path, paint);
+  // Rects, rrects, and circles are drawn with analytic blurs. Other convex
+  // paths are drawn as shadow meshes, which avoids blurring an offscreen
+  // texture.
+  std::shared_ptr<VerticesGeometry> shadow;
+  if (path.isConvex() && !HasAnalyticBlur(path)) {
+    shadow = TessellatePathShadow(path, paint.mask_blur_descriptor->sigma,
+                                  spot_color, canvas_.GetCurrentTransform());
+  }
+  if (shadow) {
+    canvas_.DrawVertices(shadow, BlendMode::kSourceOver, Paint{});
+  } else {
+    SimplifyOrDrawPath(canvas_, path, paint);
+  }
 
   canvas_.Restore();
 }
 
 Picture DlDispatcher::EndRecordingAsPicture() {
   TRACE_EVENT0("impeller", "DisplayListDispatcher::EndRecordingAsPicture");
+  FlushPendingDraws();
   return canvas_.EndRecordingAsPicture();
 }
 
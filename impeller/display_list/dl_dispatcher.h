@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <vector>
+
 #include "flutter/display_list/dl_op_receiver.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "impeller/aiks/canvas_type.h"
 #include "impeller/aiks/paint.h"
 
@@ -22,6 +27,15 @@ class DlDispatcher final : public flutter::DlOpReceiver {
 
   Picture EndRecordingAsPicture();
 
+  /// Allows |drawDisplayList| to record large DisplayLists concurrently on
+  /// |task_runner|. The parts of a DisplayList whose rtree bounds do not
+  /// share any pixels are recorded into separate pictures on the workers,
+  /// which are then drawn into this dispatcher. Since those parts never
+  /// touch the same pixels, the order in which they are drawn does not
+  /// change the result.
+  void SetConcurrentTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner);
+
   // |flutter::DlOpReceiver|
   void setAntiAlias(bool aa) override;
 
@@ -221,9 +235,53 @@ class DlDispatcher final : public flutter::DlOpReceiver {
                   SkScalar dpr) override;
 
  private:
+  // DisplayLists with fewer ops than this are always dispatched on the
+  // calling thread.
+  static constexpr unsigned int kMinConcurrentDispatchOps = 1000;
+  // The most pictures that a DisplayList is split into.
+  static constexpr size_t kMaxConcurrentDispatches = 4;
+
   Paint paint_;
   CanvasType canvas_;
   Matrix initial_matrix_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner_;
+  // The most recent backdrop filter passed to |saveLayer| and its conversion.
+  // Equal backdrop filters are converted to the same |ImageFilter| so that
+  // the |Canvas| can batch their backdrop reads.
+  std::shared_ptr<const flutter::DlImageFilter> last_backdrop_dl_filter_;
+  std::shared_ptr<ImageFilter> last_backdrop_filter_;
+
+  // Fills of rects, rrects and circles that have not been drawn yet. Runs of
+  // these that are drawn with the same batchable paint are drawn as a single
+  // entity with a multi-contour geometry by |FlushPendingDraws|.
+  struct PendingDraw {
+    enum class Type { kRect, kRRect, kCircle };
+
+    Type type;
+    // The bounds of the shape, which is the rect itself for rects.
+    Rect rect;
+    // The corner radii of rrects, or the radius of circles in |x|.
+    Point radii;
+  };
+  std::vector<PendingDraw> pending_draws_;
+  Paint pending_paint_;
+
+  // Whether fills with |paint_| can be drawn in one entity with each other,
+  // which requires a solid color, a blend mode that the pipeline applies and
+  // no filters.
+  bool CanBatchDraws() const;
+
+  void AddPendingDraw(const PendingDraw& draw);
+
+  // Draws and clears |pending_draws_|. Called before anything that draws or
+  // changes the transform or the clip of |canvas_|.
+  void FlushPendingDraws();
+
+  // Dispatches the parts of |display_list| within |cull_rect| concurrently
+  // on |concurrent_task_runner_| if it is large enough and splits into more
+  // than one part, and returns whether it did.
+  bool DispatchConcurrently(const flutter::DisplayList& display_list,
+                            const std::optional<Rect>& cull_rect);
 
   static void SimplifyOrDrawPath(CanvasType& canvas,
                                  const SkPath& path,
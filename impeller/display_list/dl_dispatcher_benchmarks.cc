@@ -0,0 +1,23 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/benchmarking/dl_op_benchmarks.h"
+#include "impeller/display_list/dl_dispatcher.h"
+
+namespace impeller {
+
+// Only the conversion of the ops into an Aiks picture is measured, the
+// picture is not rendered.
+[[maybe_unused]] static const bool kDlDispatcherBenchmarksRegistered =
+    flutter::testing::RegisterDisplayListDispatchOpBenchmarks(
+        "DlDispatcher",
+        [](const flutter::DisplayList& display_list, const SkRect& cull_rect) {
+          DlDispatcher dispatcher;
+          display_list.Dispatch(dispatcher, cull_rect);
+          auto picture = dispatcher.EndRecordingAsPicture();
+          benchmark::DoNotOptimize(picture);
+        });
+
+}  // namespace impeller
@@ -0,0 +1,291 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/effects/dl_image_filter.h"
+#include "flutter/display_list/effects/dl_mask_filter.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/runtime/test_font_data.h"
+#include "impeller/aiks/aiks_context.h"
+#include "impeller/display_list/dl_dispatcher.h"
+#include "impeller/playground/playground.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"
+#include "third_party/skia/include/core/SkFont.h"
+#include "third_party/skia/include/core/SkPath.h"
+#include "third_party/skia/include/core/SkRRect.h"
+#include "third_party/skia/include/core/SkTextBlob.h"
+
+namespace impeller {
+
+namespace {
+
+constexpr ISize kFrameSize = {800, 1200};
+
+using SceneCallback = sk_sp<flutter::DisplayList> (*)();
+
+SkFont CreateFont(SkScalar size) {
+  auto typefaces = flutter::GetTestFontData();
+  return SkFont(typefaces.empty() ? nullptr : typefaces.front(), size);
+}
+
+// Rows of cards with an avatar and two lines of text, scrolled part of the way
+// so that the first and last rows are cut off.
+sk_sp<flutter::DisplayList> MakeScrollingList() {
+  flutter::DisplayListBuilder builder;
+  SkFont title_font = CreateFont(18);
+  SkFont body_font = CreateFont(14);
+  builder.ClipRect(SkRect::MakeWH(kFrameSize.width, kFrameSize.height));
+  builder.Translate(0, -37);
+  for (int i = 0; i < 20; i++) {
+    SkScalar top = i * 64;
+    builder.DrawRRect(
+        SkRRect::MakeRectXY(SkRect::MakeXYWH(8, top + 4, 784, 56), 8, 8),
+        flutter::DlPaint(flutter::DlColor(0xFFF3EDF7)));
+    builder.DrawCircle(SkPoint::Make(40, top + 32), 20,
+                       flutter::DlPaint(flutter::DlColor(0xFF6750A4)));
+    builder.DrawTextBlob(
+        SkTextBlob::MakeFromString("List item title", title_font), 72,
+        top + 26, flutter::DlPaint());
+    builder.DrawTextBlob(
+        SkTextBlob::MakeFromString("Supporting text for the item", body_font),
+        72, top + 48, flutter::DlPaint(flutter::DlColor(0xFF49454F)));
+  }
+  return builder.Build();
+}
+
+// Shadowed cards behind a frosted glass app bar.
+sk_sp<flutter::DisplayList> MakeBlurs() {
+  flutter::DisplayListBuilder builder;
+  flutter::DlPaint shadow_paint(flutter::DlColor(0x80000000));
+  shadow_paint.setMaskFilter(
+      flutter::DlBlurMaskFilter::Make(flutter::DlBlurStyle::kNormal, 8));
+  for (int i = 0; i < 12; i++) {
+    SkRect card = SkRect::MakeXYWH(24 + (i % 2) * 384, 24 + (i / 2) * 190,
+                                   368, 160);
+    builder.DrawRRect(SkRRect::MakeRectXY(card.makeOffset(0, 4), 12, 12),
+                      shadow_paint);
+    builder.DrawRRect(SkRRect::MakeRectXY(card, 12, 12),
+                      flutter::DlPaint(flutter::DlColor(0xFF80DEEA)));
+  }
+  auto backdrop =
+      flutter::DlBlurImageFilter::Make(20, 20, flutter::DlTileMode::kClamp);
+  SkRect app_bar = SkRect::MakeWH(kFrameSize.width, 120);
+  builder.ClipRect(app_bar);
+  builder.SaveLayer(&app_bar, nullptr, backdrop.get());
+  builder.DrawRect(app_bar, flutter::DlPaint(flutter::DlColor(0x40FFFFFF)));
+  builder.Restore();
+  return builder.Build();
+}
+
+// A screen full of small text.
+sk_sp<flutter::DisplayList> MakeTextWall() {
+  flutter::DisplayListBuilder builder;
+  SkFont font = CreateFont(12);
+  auto blob = SkTextBlob::MakeFromString(
+      "The quick brown fox jumps over the lazy dog 0123456789", font);
+  for (int i = 0; i < 80; i++) {
+    builder.DrawTextBlob(blob, 8, 14 + i * 15, flutter::DlPaint());
+  }
+  return builder.Build();
+}
+
+// A filled area chart with a stroked outline and grid lines.
+sk_sp<flutter::DisplayList> MakeChart() {
+  flutter::DisplayListBuilder builder;
+  flutter::DlPaint grid_paint(flutter::DlColor(0xFFE0E0E0));
+  grid_paint.setDrawStyle(flutter::DlDrawStyle::kStroke);
+  grid_paint.setStrokeWidth(1);
+  for (int i = 0; i <= 10; i++) {
+    builder.DrawLine(SkPoint::Make(0, 100 + i * 100),
+                     SkPoint::Make(kFrameSize.width, 100 + i * 100),
+                     grid_paint);
+  }
+  SkPath line;
+  SkPath area;
+  area.moveTo(0, 1100);
+  for (int i = 0; i <= 500; i++) {
+    SkScalar x = i * kFrameSize.width / 500.0f;
+    SkScalar y = 600 + 300 * std::sin(i * 0.05f) * std::cos(i * 0.013f);
+    if (i == 0) {
+      line.moveTo(x, y);
+    } else {
+      line.lineTo(x, y);
+    }
+    area.lineTo(x, y);
+  }
+  area.lineTo(kFrameSize.width, 1100);
+  area.close();
+  builder.DrawPath(area, flutter::DlPaint(flutter::DlColor(0x402196F3)));
+  flutter::DlPaint line_paint(flutter::DlColor(0xFF2196F3));
+  line_paint.setDrawStyle(flutter::DlDrawStyle::kStroke);
+  line_paint.setStrokeWidth(3);
+  line_paint.setStrokeJoin(flutter::DlStrokeJoin::kRound);
+  builder.DrawPath(line, line_paint);
+  return builder.Build();
+}
+
+// Only used for its context, the window is never shown.
+class BenchmarkPlayground : public Playground {
+ public:
+  BenchmarkPlayground() : Playground(PlaygroundSwitches()) {}
+
+  // |Playground|
+  std::unique_ptr<fml::Mapping> OpenAssetAsMapping(
+      std::string asset_name) const override {
+    return nullptr;
+  }
+
+  // |Playground|
+  std::string GetWindowTitle() const override {
+    return "Impeller Render Benchmarks";
+  }
+};
+
+// The playground and renderer of each backend are created on first use and
+// shared by all benchmarks, as creating a context is slow.
+struct BackendState {
+  std::unique_ptr<BenchmarkPlayground> playground;
+  std::unique_ptr<AiksContext> aiks_context;
+  RenderTarget render_target;
+};
+
+BackendState* GetBackendState(PlaygroundBackend backend) {
+  static std::map<PlaygroundBackend, std::unique_ptr<BackendState>> states;
+  auto& state = states[backend];
+  if (state) {
+    return state->aiks_context ? state.get() : nullptr;
+  }
+  state = std::make_unique<BackendState>();
+  if (!Playground::SupportsBackend(backend)) {
+    return nullptr;
+  }
+  state->playground = std::make_unique<BenchmarkPlayground>();
+  state->playground->SetupContext(backend);
+  auto context = state->playground->GetContext();
+  if (!context) {
+    return nullptr;
+  }
+  auto aiks_context = std::make_unique<AiksContext>(
+      context, TypographerContextSkia::Make());
+  if (!aiks_context->IsValid()) {
+    return nullptr;
+  }
+  RenderTargetAllocator allocator(context->GetResourceAllocator());
+  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+    state->render_target = RenderTarget::CreateOffscreenMSAA(
+        *context, allocator, kFrameSize, "Benchmark Frame MSAA",
+        RenderTarget::kDefaultColorAttachmentConfigMSAA, std::nullopt);
+  } else {
+    state->render_target = RenderTarget::CreateOffscreen(
+        *context, allocator, kFrameSize, "Benchmark Frame",
+        RenderTarget::kDefaultColorAttachmentConfig, std::nullopt);
+  }
+  if (!state->render_target.IsValid()) {
+    return nullptr;
+  }
+  state->aiks_context = std::move(aiks_context);
+  return state.get();
+}
+
+// Returns once the GPU has finished all work submitted so far. Command buffers
+// complete in submission order, so waiting for an empty one is enough.
+bool WaitForGPU(const std::shared_ptr<Context>& context) {
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    return false;
+  }
+  fml::AutoResetWaitableEvent latch;
+  if (!command_buffer->SubmitCommands(
+          [&latch](CommandBuffer::Status) { latch.Signal(); })) {
+    return false;
+  }
+  latch.Wait();
+  return true;
+}
+
+}  // namespace
+
+// Measures the time it takes to draw a frame of a recorded scene, from
+// converting the display list to the GPU finishing the frame. The time until
+// the GPU finishes after the CPU is done encoding is also reported on its own
+// as GPUWaitTime. On OpenGL ES, commands complete on submission from the point
+// of view of Impeller, so there only the CPU side is measured.
+template <class... Args>
+static void BM_RenderScene(benchmark::State& state, Args&&... args) {
+  auto args_tuple = std::make_tuple(std::move(args)...);
+  auto backend = std::get<PlaygroundBackend>(args_tuple);
+  auto scene = std::get<SceneCallback>(args_tuple)();
+
+  BackendState* backend_state = GetBackendState(backend);
+  if (!backend_state) {
+    state.SkipWithError("Backend is not available.");
+    return;
+  }
+  auto& aiks_context = *backend_state->aiks_context;
+  auto context = aiks_context.GetContext();
+
+  // Warm up the pipelines and glyph atlases the scene needs, so that they
+  // aren't part of the first measured frame.
+  for (int i = 0; i < 2; i++) {
+    DlDispatcher dispatcher;
+    scene->Dispatch(dispatcher);
+    aiks_context.Render(dispatcher.EndRecordingAsPicture(),
+                        backend_state->render_target);
+  }
+  WaitForGPU(context);
+
+  std::chrono::duration<double> total_gpu_wait(0);
+  while (state.KeepRunning()) {
+    auto start = std::chrono::high_resolution_clock::now();
+    DlDispatcher dispatcher;
+    scene->Dispatch(dispatcher);
+    if (!aiks_context.Render(dispatcher.EndRecordingAsPicture(),
+                             backend_state->render_target)) {
+      state.SkipWithError("Could not render the scene.");
+      return;
+    }
+    auto encoded = std::chrono::high_resolution_clock::now();
+    if (!WaitForGPU(context)) {
+      state.SkipWithError("Could not wait for the GPU.");
+      return;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    total_gpu_wait += end - encoded;
+    state.SetIterationTime(
+        std::chrono::duration<double>(end - start).count());
+  }
+  state.counters["GPUWaitTime"] = benchmark::Counter(
+      total_gpu_wait.count(), benchmark::Counter::kAvgIterations);
+}
+
+#define RENDER_SCENE_BENCHMARKS(name, backend)                              \
+  BENCHMARK_CAPTURE(BM_RenderScene, scrolling_list_##name, backend,         \
+                    &MakeScrollingList)                                     \
+      ->UseManualTime()                                                     \
+      ->Unit(benchmark::kMicrosecond);                                      \
+  BENCHMARK_CAPTURE(BM_RenderScene, blurs_##name, backend, &MakeBlurs)      \
+      ->UseManualTime()                                                     \
+      ->Unit(benchmark::kMicrosecond);                                      \
+  BENCHMARK_CAPTURE(BM_RenderScene, text_wall_##name, backend,              \
+                    &MakeTextWall)                                          \
+      ->UseManualTime()                                                     \
+      ->Unit(benchmark::kMicrosecond);                                      \
+  BENCHMARK_CAPTURE(BM_RenderScene, chart_##name, backend, &MakeChart)      \
+      ->UseManualTime()                                                     \
+      ->Unit(benchmark::kMicrosecond);
+
+RENDER_SCENE_BENCHMARKS(metal, PlaygroundBackend::kMetal)
+RENDER_SCENE_BENCHMARKS(vulkan, PlaygroundBackend::kVulkan)
+RENDER_SCENE_BENCHMARKS(gles, PlaygroundBackend::kOpenGLES)
+
+}  // namespace impeller
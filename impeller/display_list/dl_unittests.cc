@@ -16,6 +16,7 @@
 #include "flutter/display_list/effects/dl_color_source.h"
 #include "flutter/display_list/effects/dl_image_filter.h"
 #include "flutter/display_list/effects/dl_mask_filter.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/testing/testing.h"
 #include "gtest/gtest.h"
 #include "impeller/display_list/dl_dispatcher.h"
@@ -1803,6 +1804,85 @@ TEST(DisplayListTest, CircleBoundsComputation) {
             Rect::MakeLTRB(-5, -5, 5, 5));
 }
 
+TEST(DisplayListTest, BatchesCompatibleFills) {
+  DlDispatcher dispatcher;
+  dispatcher.setColor(flutter::DlColor::kBlue());
+  for (int i = 0; i < 100; i++) {
+    dispatcher.drawCircle(SkPoint::Make(i * 10.0f, 0), 4);
+  }
+  dispatcher.drawRect(SkRect::MakeXYWH(0, 20, 10, 10));
+  dispatcher.drawRRect(
+      SkRRect::MakeRectXY(SkRect::MakeXYWH(20, 20, 10, 10), 2, 2));
+  // A new color, a stroke and a transform each end the batch.
+  dispatcher.setColor(flutter::DlColor::kRed());
+  dispatcher.drawRect(SkRect::MakeXYWH(40, 20, 10, 10));
+  dispatcher.setDrawStyle(flutter::DlDrawStyle::kStroke);
+  dispatcher.drawRect(SkRect::MakeXYWH(60, 20, 10, 10));
+  dispatcher.setDrawStyle(flutter::DlDrawStyle::kFill);
+  dispatcher.drawCircle(SkPoint::Make(0, 40), 4);
+  dispatcher.translate(10, 0);
+  dispatcher.drawCircle(SkPoint::Make(0, 40), 4);
+  auto picture = dispatcher.EndRecordingAsPicture();
+
+  EXPECT_EQ(picture.pass->GetElementCount(), 5u);
+
+  std::optional<Rect> coverage =
+      GetCoverageOfFirstEntity<SolidColorContents>(picture);
+  ASSERT_TRUE(coverage.has_value());
+  ASSERT_EQ(coverage.value_or(Rect::MakeMaximum()),
+            Rect::MakeLTRB(-4, -4, 994, 30));
+}
+
+TEST(DisplayListTest, DoesNotBatchFillsWithFilters) {
+  DlDispatcher dispatcher;
+  flutter::DlBlurMaskFilter mask_filter(flutter::DlBlurStyle::kNormal, 5);
+  dispatcher.setMaskFilter(&mask_filter);
+  dispatcher.drawRect(SkRect::MakeXYWH(0, 0, 10, 10));
+  dispatcher.drawRect(SkRect::MakeXYWH(20, 0, 10, 10));
+  dispatcher.setMaskFilter(nullptr);
+  dispatcher.setBlendMode(flutter::DlBlendMode::kMultiply);
+  dispatcher.drawRect(SkRect::MakeXYWH(40, 0, 10, 10));
+  dispatcher.drawRect(SkRect::MakeXYWH(60, 0, 10, 10));
+  auto picture = dispatcher.EndRecordingAsPicture();
+
+  EXPECT_EQ(picture.pass->GetElementCount(), 4u);
+}
+
+TEST(DisplayListTest, DispatchesSeparatePartsConcurrently) {
+  flutter::DisplayListBuilder builder(/*prepare_rtree=*/true);
+  flutter::DlPaint red(flutter::DlColor::kRed());
+  flutter::DlPaint blue(flutter::DlColor::kBlue());
+  // Two clusters of overlapping rects that are far apart.
+  for (int i = 0; i < 600; i++) {
+    builder.DrawRect(SkRect::MakeXYWH(i * 0.1f, 0, 10, 10),
+                     i % 2 ? red : blue);
+    builder.DrawRect(SkRect::MakeXYWH(200 + i * 0.1f, 0, 10, 10),
+                     i % 2 ? blue : red);
+  }
+  auto display_list = builder.Build();
+
+  auto loop = fml::ConcurrentMessageLoop::Create(2);
+  DlDispatcher dispatcher(Rect::MakeLTRB(0, 0, 1000, 1000));
+  dispatcher.SetConcurrentTaskRunner(loop->GetTaskRunner());
+  dispatcher.drawDisplayList(display_list, 1.0f);
+  auto picture = dispatcher.EndRecordingAsPicture();
+
+  size_t rect_count = 0;
+  size_t picture_count = 0;
+  picture.pass->IterateAllEntities([&](Entity& entity) {
+    auto contents = entity.GetContents();
+    if (std::dynamic_pointer_cast<SolidColorContents>(contents)) {
+      rect_count++;
+    } else if (std::dynamic_pointer_cast<ClipRestoreContents>(contents)) {
+      // Each picture that is drawn into the dispatcher restores its clip.
+      picture_count++;
+    }
+    return true;
+  });
+  EXPECT_EQ(rect_count, 1200u);
+  EXPECT_EQ(picture_count, 2u);
+}
+
 #ifdef IMPELLER_ENABLE_3D
 TEST_P(DisplayListTest, SceneColorSource) {
   // Load up the scene.
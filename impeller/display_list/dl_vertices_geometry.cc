@@ -59,7 +59,8 @@ std::shared_ptr<impeller::VerticesGeometry> MakeVertices(
     }
   }
   return std::make_shared<VerticesGeometry>(
-      positions, indices, texture_coordinates, colors, bounds, mode);
+      std::move(positions), std::move(indices), std::move(texture_coordinates),
+      std::move(colors), bounds, mode, vertices->unique_id());
 }
 
 }  // namespace impeller
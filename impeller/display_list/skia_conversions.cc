@@ -57,8 +57,11 @@ Path ToPath(const SkPath& path, Point shift) {
 
   PathBuilder builder;
   PathData data;
-  // Reserve a path size with some arbitrarily additional padding.
-  builder.Reserve(path.countPoints() + 8, path.countVerbs() + 8);
+  // Reserve a path size with some arbitrarily additional padding. Impeller
+  // components store their starting point, so each verb needs one more point
+  // than it takes in the SkPath.
+  builder.Reserve(path.countPoints() + path.countVerbs() + 8,
+                  path.countVerbs() + 8);
   auto verb = SkPath::Verb::kDone_Verb;
   do {
     verb = iterator.next(data.points);
@@ -126,6 +129,11 @@ Path ToPath(const SkPath& path, Point shift) {
   builder.Shift(shift);
   auto sk_bounds = path.getBounds().makeOutset(shift.x, shift.y);
   builder.SetBounds(ToRect(sk_bounds));
+  // Skia only changes the generation ID of a path when its points or verbs
+  // change, so it identifies a non-volatile path drawn in many frames.
+  if (!path.isVolatile() && shift.IsZero()) {
+    builder.SetCacheKey(path.getGenerationID());
+  }
   return builder.TakePath(fill_type);
 }
 
@@ -156,5 +156,22 @@ TEST(SkiaConversionsTest, GradientConversionNonMonotonic) {
   ASSERT_TRUE(ScalarNearlyEqual(converted_stops[3], 1.0f));
 }
 
+TEST(SkiaConversionsTest, OnlyNonVolatilePathsHaveCacheKeys) {
+  SkPath sk_path;
+  sk_path.addOval(SkRect::MakeXYWH(0, 0, 100, 50));
+
+  auto path = skia_conversions::ToPath(sk_path);
+  ASSERT_TRUE(path.GetCacheKey().has_value());
+  EXPECT_EQ(path.GetCacheKey().value(), sk_path.getGenerationID());
+
+  // Shifting the path changes its contents.
+  EXPECT_FALSE(skia_conversions::ToPath(sk_path, Point(10, 10))
+                   .GetCacheKey()
+                   .has_value());
+
+  sk_path.setIsVolatile(true);
+  EXPECT_FALSE(skia_conversions::ToPath(sk_path).GetCacheKey().has_value());
+}
+
 }  // namespace testing
 }  // namespace impeller
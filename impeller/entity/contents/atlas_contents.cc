@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <optional>
 #include <unordered_map>
 #include <utility>
@@ -21,6 +22,7 @@
 #include "impeller/entity/texture_fill.frag.h"
 #include "impeller/entity/texture_fill.vert.h"
 #include "impeller/geometry/color.h"
+#include "impeller/geometry/vector.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
@@ -199,13 +201,33 @@ bool AtlasContents::Render(const ContentContext& renderer,
   // approximation of them.
   auto coverage = ComputeBoundingBox();
 
+  auto dst_sampler_descriptor = sampler_descriptor_;
+  if (renderer.GetDeviceCapabilities().SupportsDecalSamplerAddressMode()) {
+    dst_sampler_descriptor.width_address_mode = SamplerAddressMode::kDecal;
+    dst_sampler_descriptor.height_address_mode = SamplerAddressMode::kDecal;
+  }
+  bool render_instanced = CanRenderInstanced(renderer);
+
   if (blend_mode_ == BlendMode::kSource || colors_.size() == 0) {
+    if (render_instanced) {
+      // Only the texture is drawn.
+      return RenderInstanced(renderer, entity, pass, BlendMode::kDestination,
+                             OptionsFromPassAndEntity(pass, entity),
+                             sampler_descriptor_);
+    }
     auto child_contents = AtlasTextureContents(*this);
     child_contents.SetAlpha(alpha_);
     child_contents.SetCoverage(coverage);
     return child_contents.Render(renderer, entity, pass);
   }
   if (blend_mode_ == BlendMode::kDestination) {
+    if (render_instanced) {
+      // Only the colors are drawn.
+      auto options = OptionsFromPassAndEntity(pass, entity);
+      options.blend_mode = BlendMode::kSourceOver;
+      return RenderInstanced(renderer, entity, pass, BlendMode::kSource,
+                             options, sampler_descriptor_);
+    }
     auto child_contents = AtlasColorContents(*this);
     child_contents.SetAlpha(alpha_);
     child_contents.SetCoverage(coverage);
@@ -218,6 +240,13 @@ bool AtlasContents::Render(const ContentContext& renderer,
 
   if (blend_mode_ <= BlendMode::kModulate) {
     // Simple Porter-Duff blends can be accomplished without a subpass.
+    if (render_instanced) {
+      return RenderInstanced(
+          renderer, entity, pass,
+          InvertPorterDuffBlend(blend_mode_).value_or(BlendMode::kSource),
+          OptionsFromPass(pass), dst_sampler_descriptor);
+    }
+
     using VS = PorterDuffBlendPipeline::VertexShader;
     using FS = PorterDuffBlendPipeline::FragmentShader;
 
@@ -255,11 +284,6 @@ bool AtlasContents::Render(const ContentContext& renderer,
     FS::FragInfo frag_info;
     VS::FrameInfo frame_info;
 
-    auto dst_sampler_descriptor = sampler_descriptor_;
-    if (renderer.GetDeviceCapabilities().SupportsDecalSamplerAddressMode()) {
-      dst_sampler_descriptor.width_address_mode = SamplerAddressMode::kDecal;
-      dst_sampler_descriptor.height_address_mode = SamplerAddressMode::kDecal;
-    }
     auto dst_sampler = renderer.GetContext()->GetSamplerLibrary()->GetSampler(
         dst_sampler_descriptor);
     FS::BindTextureSamplerDst(cmd, texture_, dst_sampler);
@@ -326,6 +350,99 @@ bool AtlasContents::Render(const ContentContext& renderer,
   return child_contents.Render(renderer, entity, pass);
 }
 
+// These values must correspond to the layout of `AtlasInstance` in
+// atlas_instanced.vert.
+struct AtlasInstanceData {
+  Vector4 basis;
+  Vector4 translation;
+  Vector4 sample_rect;
+  Color color;
+};
+
+bool AtlasContents::CanRenderInstanced(const ContentContext& renderer) const {
+  if (!renderer.GetDeviceCapabilities().SupportsSSBO()) {
+    return false;
+  }
+  return std::all_of(transforms_.begin(), transforms_.end(),
+                     [](const Matrix& matrix) { return matrix.IsAffine(); });
+}
+
+bool AtlasContents::RenderInstanced(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    BlendMode coefficients_blend_mode,
+    ContentContextOptions options,
+    const SamplerDescriptor& sampler_descriptor) const {
+  using VS = AtlasInstancedPipeline::VertexShader;
+  using FS = AtlasInstancedPipeline::FragmentShader;
+
+  if (texture_coords_.empty()) {
+    return true;
+  }
+
+  std::vector<AtlasInstanceData> instances;
+  instances.reserve(texture_coords_.size());
+  for (size_t i = 0; i < texture_coords_.size(); i++) {
+    const auto& matrix = transforms_[i];
+    const auto& sample_rect = texture_coords_[i];
+    instances.push_back(AtlasInstanceData{
+        .basis = Vector4(matrix.m[0], matrix.m[1], matrix.m[4], matrix.m[5]),
+        .translation = Vector4(matrix.m[12], matrix.m[13], 0, 0),
+        .sample_rect =
+            Vector4(sample_rect.origin.x, sample_rect.origin.y,
+                    sample_rect.size.width, sample_rect.size.height),
+        .color = colors_.empty() ? Color::BlackTransparent()
+                                 : colors_[i].Premultiply(),
+    });
+  }
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+  auto instance_buffer = host_buffer.Emplace(
+      instances.data(), instances.size() * sizeof(AtlasInstanceData),
+      DefaultUniformAlignment());
+
+  VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+  vtx_builder.AddVertices({{Point(0, 0)}, {Point(1, 0)}, {Point(0, 1)},
+                           {Point(1, 1)}});
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, SPrintF("DrawAtlas Instanced (%s)",
+                                  BlendModeToString(blend_mode_)));
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(host_buffer));
+  cmd.stencil_reference = entity.GetClipDepth();
+  cmd.instance_count = instances.size();
+  options.primitive_type = PrimitiveType::kTriangleStrip;
+  cmd.pipeline = renderer.GetAtlasInstancedPipeline(options);
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransform();
+  const auto texture_size = texture_->GetSize();
+  frame_info.texture_size = Vector2(texture_size.width, texture_size.height);
+  frame_info.texture_sampler_y_coord_scale = texture_->GetYCoordScale();
+  VS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+  VS::BindInstanceData(cmd, instance_buffer);
+
+  FS::FragInfo frag_info;
+  frag_info.output_alpha = alpha_;
+  frag_info.input_alpha = 1.0;
+  auto blend_coefficients =
+      kPorterDuffCoefficients[static_cast<int>(coefficients_blend_mode)];
+  frag_info.src_coeff = blend_coefficients[0];
+  frag_info.src_coeff_dst_alpha = blend_coefficients[1];
+  frag_info.dst_coeff = blend_coefficients[2];
+  frag_info.dst_coeff_src_alpha = blend_coefficients[3];
+  frag_info.dst_coeff_src_color = blend_coefficients[4];
+  FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+  FS::BindTextureSamplerDst(
+      cmd, texture_,
+      renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+          sampler_descriptor));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
 // AtlasTextureContents
 // ---------------------------------------------------------
 
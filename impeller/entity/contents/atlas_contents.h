@@ -15,6 +15,8 @@
 
 namespace impeller {
 
+struct ContentContextOptions;
+
 struct SubAtlasResult {
   // Sub atlas values.
   std::vector<Rect> sub_texture_coords;
@@ -77,6 +79,23 @@ class AtlasContents final : public Contents {
  private:
   Rect ComputeBoundingBox() const;
 
+  /// @brief Whether every sprite can be drawn as an instance of one quad,
+  ///        which needs storage buffers and affine transforms.
+  bool CanRenderInstanced(const ContentContext& renderer) const;
+
+  /// @brief Draw every sprite as an instance of one quad, reading the
+  ///        transform, sample rect and color of each from a storage buffer.
+  ///
+  ///        The texture and the colors are combined with the Porter-Duff
+  ///        coefficients of `coefficients_blend_mode`, as in the porter duff
+  ///        blend shader, where the texture is the destination.
+  bool RenderInstanced(const ContentContext& renderer,
+                       const Entity& entity,
+                       RenderPass& pass,
+                       BlendMode coefficients_blend_mode,
+                       ContentContextOptions options,
+                       const SamplerDescriptor& sampler_descriptor) const;
+
   std::shared_ptr<Texture> texture_;
   std::vector<Rect> texture_coords_;
   std::vector<Color> colors_;
@@ -30,6 +30,20 @@ void ClipContents::SetClipOperation(Entity::ClipOperation clip_op) {
   clip_op_ = clip_op;
 }
 
+std::optional<Rect> ClipContents::GetPixelAlignedRect(
+    const Entity& entity) const {
+  if (clip_op_ != Entity::ClipOperation::kIntersect || !geometry_ ||
+      !geometry_->IsAxisAlignedRect() ||
+      !entity.GetTransform().IsTranslationScaleOnly()) {
+    return std::nullopt;
+  }
+  auto coverage = geometry_->GetCoverage(entity.GetTransform());
+  if (!coverage.has_value() || Rect::RoundOut(*coverage) != *coverage) {
+    return std::nullopt;
+  }
+  return coverage;
+}
+
 std::optional<Rect> ClipContents::GetCoverage(const Entity& entity) const {
   return std::nullopt;
 };
@@ -121,7 +135,8 @@ bool ClipContents::Render(const ContentContext& renderer,
     options.stencil_operation = StencilOperation::kIncrementClamp;
   }
 
-  auto geometry_result = geometry_->GetPositionBuffer(renderer, entity, pass);
+  auto geometry_result =
+      geometry_->GetPositionBufferForSolidFill(renderer, entity, pass);
   options.primitive_type = geometry_result.type;
   cmd.pipeline = renderer.GetClipPipeline(options);
 
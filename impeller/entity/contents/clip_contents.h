@@ -25,6 +25,14 @@ class ClipContents final : public Contents {
 
   void SetClipOperation(Entity::ClipOperation clip_op);
 
+  //----------------------------------------------------------------------------
+  /// @brief  Returns the rect that this clip intersects the current clip
+  ///         with if the rect lands on pixel boundaries, in which case a
+  ///         scissor applies the clip exactly without touching the stencil
+  ///         buffer.
+  ///
+  std::optional<Rect> GetPixelAlignedRect(const Entity& entity) const;
+
   // |Contents|
   std::optional<Rect> GetCoverage(const Entity& entity) const override;
 
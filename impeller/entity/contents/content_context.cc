@@ -5,11 +5,17 @@
 #include "impeller/entity/contents/content_context.h"
 
 #include <memory>
+#include <sstream>
 
 #include "impeller/base/strings.h"
 #include "impeller/core/formats.h"
+#include "impeller/entity/contents/filters/filter_contents.h"
 #include "impeller/entity/contents/framebuffer_blend_contents.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/geometry/circle_mesh_cache.h"
+#include "impeller/entity/geometry/tessellation_cache.h"
+#include "impeller/entity/geometry/vertices_buffer_cache.h"
 #include "impeller/entity/render_target_cache.h"
 #include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/pipeline_descriptor.h"
@@ -144,8 +150,15 @@ void ContentContextOptions::ApplyToPipelineDescriptor(
   if (maybe_stencil.has_value()) {
     StencilAttachmentDescriptor stencil = maybe_stencil.value();
     stencil.stencil_compare = stencil_compare;
-    stencil.depth_stencil_pass = stencil_operation;
-    desc.SetStencilAttachmentDescriptors(stencil);
+    if (count_stencil_winding) {
+      StencilAttachmentDescriptor back = stencil;
+      stencil.depth_stencil_pass = StencilOperation::kIncrementWrap;
+      back.depth_stencil_pass = StencilOperation::kDecrementWrap;
+      desc.SetStencilAttachmentDescriptors(stencil, back);
+    } else {
+      stencil.depth_stencil_pass = stencil_operation;
+      desc.SetStencilAttachmentDescriptors(stencil);
+    }
   }
 
   desc.SetPrimitiveType(primitive_type);
@@ -153,6 +166,69 @@ void ContentContextOptions::ApplyToPipelineDescriptor(
   desc.SetPolygonMode(wireframe ? PolygonMode::kLine : PolygonMode::kFill);
 }
 
+std::string SerializePipelineVariantRecords(
+    const std::vector<PipelineVariantRecord>& records) {
+  std::stringstream stream;
+  for (const auto& record : records) {
+    const auto& o = record.options;
+    stream << record.prototype << '\t' << static_cast<int>(o.sample_count)
+           << ' ' << static_cast<int>(o.blend_mode) << ' '
+           << static_cast<int>(o.stencil_compare) << ' '
+           << static_cast<int>(o.stencil_operation) << ' '
+           << o.count_stencil_winding << ' '
+           << static_cast<int>(o.primitive_type) << ' '
+           << static_cast<int>(o.color_attachment_pixel_format) << ' '
+           << o.has_stencil_attachment << ' ' << o.wireframe << ' '
+           << o.is_for_rrect_blur_clear << '\n';
+  }
+  return stream.str();
+}
+
+std::vector<PipelineVariantRecord> ParsePipelineVariantRecords(
+    std::string_view serialized) {
+  std::vector<PipelineVariantRecord> records;
+  std::stringstream stream{std::string{serialized}};
+  std::string line;
+  while (std::getline(stream, line)) {
+    auto tab = line.find('\t');
+    if (tab == std::string::npos || tab == 0u) {
+      continue;
+    }
+    std::stringstream fields(line.substr(tab + 1));
+    int sample_count, blend_mode, stencil_compare, stencil_operation,
+        primitive_type, pixel_format;
+    bool count_stencil_winding, has_stencil_attachment, wireframe,
+        is_for_rrect_blur_clear;
+    if (!(fields >> sample_count >> blend_mode >> stencil_compare >>
+          stencil_operation >> count_stencil_winding >> primitive_type >>
+          pixel_format >> has_stencil_attachment >> wireframe >>
+          is_for_rrect_blur_clear)) {
+      continue;
+    }
+    if (blend_mode < 0 ||
+        blend_mode > static_cast<int>(Entity::kLastPipelineBlendMode)) {
+      continue;
+    }
+    records.push_back(PipelineVariantRecord{
+        .prototype = line.substr(0, tab),
+        .options = ContentContextOptions{
+            .sample_count = static_cast<SampleCount>(sample_count),
+            .blend_mode = static_cast<BlendMode>(blend_mode),
+            .stencil_compare = static_cast<CompareFunction>(stencil_compare),
+            .stencil_operation =
+                static_cast<StencilOperation>(stencil_operation),
+            .count_stencil_winding = count_stencil_winding,
+            .primitive_type = static_cast<PrimitiveType>(primitive_type),
+            .color_attachment_pixel_format =
+                static_cast<PixelFormat>(pixel_format),
+            .has_stencil_attachment = has_stencil_attachment,
+            .wireframe = wireframe,
+            .is_for_rrect_blur_clear = is_for_rrect_blur_clear,
+        }});
+  }
+  return records;
+}
+
 template <typename PipelineT>
 static std::unique_ptr<PipelineT> CreateDefaultPipeline(
     const Context& context) {
@@ -184,7 +260,11 @@ ContentContext::ContentContext(
       render_target_cache_(render_target_allocator == nullptr
                                ? std::make_shared<RenderTargetCache>(
                                      context_->GetResourceAllocator())
-                               : std::move(render_target_allocator)) {
+                               : std::move(render_target_allocator)),
+      gradient_texture_cache_(std::make_shared<GradientTextureCache>()),
+      tessellation_cache_(std::make_shared<TessellationCache>()),
+      circle_mesh_cache_(std::make_shared<CircleMeshCache>()),
+      vertices_buffer_cache_(std::make_shared<VerticesBufferCache>()) {
   if (!context_ || !context_->IsValid()) {
     return;
   }
@@ -205,12 +285,16 @@ ContentContext::ContentContext(
 #endif  // IMPELLER_DEBUG
 
   solid_fill_pipelines_.CreateDefault(*context_, options);
+  solid_fill_coverage_pipelines_.CreateDefault(*context_, options);
 
   if (context_->GetCapabilities()->SupportsSSBO()) {
     linear_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
     radial_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
     conical_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
     sweep_gradient_ssbo_fill_pipelines_.CreateDefault(*context_, options);
+  } else if (context_->GetBackendType() == Context::BackendType::kOpenGLES) {
+    uses_uber_gradient_fill_ = true;
+    uber_gradient_fill_pipelines_.CreateDefault(*context_, options);
   } else {
     linear_gradient_fill_pipelines_.CreateDefault(*context_, options);
     radial_gradient_fill_pipelines_.CreateDefault(*context_, options);
@@ -322,20 +406,34 @@ ContentContext::ContentContext(
   gaussian_blur_noalpha_nodecal_pipelines_.CreateDefault(*context_,
                                                          options_trianglestrip);
   border_mask_blur_pipelines_.CreateDefault(*context_, options_trianglestrip);
-  morphology_filter_pipelines_.CreateDefault(*context_, options_trianglestrip,
-                                             {supports_decal});
+  morphology_dilate_filter_pipelines_.CreateDefault(
+      *context_, options_trianglestrip,
+      {supports_decal,
+       static_cast<int32_t>(FilterContents::MorphType::kDilate)});
+  morphology_erode_filter_pipelines_.CreateDefault(
+      *context_, options_trianglestrip,
+      {supports_decal,
+       static_cast<int32_t>(FilterContents::MorphType::kErode)});
   color_matrix_color_filter_pipelines_.CreateDefault(*context_,
                                                      options_trianglestrip);
   linear_to_srgb_filter_pipelines_.CreateDefault(*context_,
                                                  options_trianglestrip);
   srgb_to_linear_filter_pipelines_.CreateDefault(*context_,
                                                  options_trianglestrip);
+  fused_color_filter_pipelines_.CreateDefault(*context_,
+                                              options_trianglestrip);
   glyph_atlas_pipelines_.CreateDefault(*context_, options);
-  glyph_atlas_color_pipelines_.CreateDefault(*context_, options);
+  glyph_atlas_color_pipelines_.CreateDefault(*context_, options, {0});
+  glyph_atlas_text_color_pipelines_.CreateDefault(*context_, options, {1});
+  glyph_atlas_sdf_pipelines_.CreateDefault(*context_, options);
   geometry_color_pipelines_.CreateDefault(*context_, options);
   yuv_to_rgb_filter_pipelines_.CreateDefault(*context_, options_trianglestrip);
   porter_duff_blend_pipelines_.CreateDefault(*context_, options_trianglestrip,
                                              {supports_decal});
+  if (context_->GetCapabilities()->SupportsSSBO()) {
+    atlas_instanced_pipelines_.CreateDefault(*context_, options_trianglestrip,
+                                             {supports_decal});
+  }
   // GLES only shader that is unsupported on macOS.
 #if defined(IMPELLER_ENABLE_OPENGLES) && !defined(FML_OS_MACOSX)
   if (GetContext()->GetBackendType() == Context::BackendType::kOpenGLES) {
@@ -451,6 +549,48 @@ std::shared_ptr<Tessellator> ContentContext::GetTessellator() const {
   return tessellator_;
 }
 
+std::vector<PipelineVariantRecord> ContentContext::GetPipelineVariantRecords()
+    const {
+  std::vector<PipelineVariantRecord> records;
+  std::vector<ContentContextOptions> options;
+  for (const auto* variants : variants_registry_) {
+    auto key = variants->GetPrototypeKey();
+    if (!key.has_value()) {
+      continue;
+    }
+    options.clear();
+    variants->CollectVariantOptions(options);
+    for (const auto& variant_options : options) {
+      records.push_back({.prototype = key.value(), .options = variant_options});
+    }
+  }
+  return records;
+}
+
+size_t ContentContext::CreatePipelineVariants(
+    const std::vector<PipelineVariantRecord>& records) const {
+  if (!IsValid()) {
+    return 0u;
+  }
+  std::unordered_map<std::string, VariantsBase*> variants_by_key;
+  for (auto* variants : variants_registry_) {
+    if (auto key = variants->GetPrototypeKey(); key.has_value()) {
+      variants_by_key[key.value()] = variants;
+    }
+  }
+  size_t created = 0u;
+  for (const auto& record : records) {
+    auto found = variants_by_key.find(record.prototype);
+    if (found == variants_by_key.end()) {
+      continue;
+    }
+    if (found->second->CreateVariant(record.options)) {
+      created++;
+    }
+  }
+  return created;
+}
+
 std::shared_ptr<Context> ContentContext::GetContext() const {
   return context_;
 }
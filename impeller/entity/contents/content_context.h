@@ -7,9 +7,14 @@
 #include <initializer_list>
 #include <memory>
 #include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/build_config.h"
+#include "flutter/fml/cache_statistics.h"
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
@@ -35,9 +40,11 @@
 #include "impeller/entity/color_matrix_color_filter.frag.h"
 #include "impeller/entity/color_matrix_color_filter.vert.h"
 #include "impeller/entity/conical_gradient_fill.frag.h"
+#include "impeller/entity/fused_color_filter.frag.h"
 #include "impeller/entity/glyph_atlas.frag.h"
 #include "impeller/entity/glyph_atlas.vert.h"
 #include "impeller/entity/glyph_atlas_color.frag.h"
+#include "impeller/entity/glyph_atlas_sdf.frag.h"
 #include "impeller/entity/gradient_fill.vert.h"
 #include "impeller/entity/linear_gradient_fill.frag.h"
 #include "impeller/entity/linear_to_srgb_filter.frag.h"
@@ -52,12 +59,15 @@
 #include "impeller/entity/rrect_blur.vert.h"
 #include "impeller/entity/solid_fill.frag.h"
 #include "impeller/entity/solid_fill.vert.h"
+#include "impeller/entity/solid_fill_coverage.frag.h"
+#include "impeller/entity/solid_fill_coverage.vert.h"
 #include "impeller/entity/srgb_to_linear_filter.frag.h"
 #include "impeller/entity/srgb_to_linear_filter.vert.h"
 #include "impeller/entity/sweep_gradient_fill.frag.h"
 #include "impeller/entity/texture_fill.frag.h"
 #include "impeller/entity/texture_fill.vert.h"
 #include "impeller/entity/tiled_texture_fill.frag.h"
+#include "impeller/entity/uber_gradient_fill.frag.h"
 #include "impeller/entity/uv.comp.h"
 #include "impeller/entity/vertices.frag.h"
 #include "impeller/entity/yuv_to_rgb_filter.frag.h"
@@ -71,6 +81,7 @@
 
 #include "impeller/typographer/glyph_atlas.h"
 
+#include "impeller/entity/atlas_instanced.vert.h"
 #include "impeller/entity/conical_gradient_ssbo_fill.frag.h"
 #include "impeller/entity/linear_gradient_ssbo_fill.frag.h"
 #include "impeller/entity/radial_gradient_ssbo_fill.frag.h"
@@ -102,6 +113,9 @@ using LinearGradientFillPipeline =
     RenderPipelineT<GradientFillVertexShader, LinearGradientFillFragmentShader>;
 using SolidFillPipeline =
     RenderPipelineT<SolidFillVertexShader, SolidFillFragmentShader>;
+using SolidFillCoveragePipeline =
+    RenderPipelineT<SolidFillCoverageVertexShader,
+                    SolidFillCoverageFragmentShader>;
 using RadialGradientFillPipeline =
     RenderPipelineT<GradientFillVertexShader, RadialGradientFillFragmentShader>;
 using ConicalGradientFillPipeline =
@@ -109,6 +123,8 @@ using ConicalGradientFillPipeline =
                     ConicalGradientFillFragmentShader>;
 using SweepGradientFillPipeline =
     RenderPipelineT<GradientFillVertexShader, SweepGradientFillFragmentShader>;
+using UberGradientFillPipeline =
+    RenderPipelineT<GradientFillVertexShader, UberGradientFillFragmentShader>;
 using LinearGradientSSBOFillPipeline =
     RenderPipelineT<GradientFillVertexShader,
                     LinearGradientSsboFillFragmentShader>;
@@ -150,12 +166,19 @@ using LinearToSrgbFilterPipeline =
 using SrgbToLinearFilterPipeline =
     RenderPipelineT<SrgbToLinearFilterVertexShader,
                     SrgbToLinearFilterFragmentShader>;
+using FusedColorFilterPipeline =
+    RenderPipelineT<ColorMatrixColorFilterVertexShader,
+                    FusedColorFilterFragmentShader>;
 using GlyphAtlasPipeline =
     RenderPipelineT<GlyphAtlasVertexShader, GlyphAtlasFragmentShader>;
 using GlyphAtlasColorPipeline =
     RenderPipelineT<GlyphAtlasVertexShader, GlyphAtlasColorFragmentShader>;
+using GlyphAtlasSdfPipeline =
+    RenderPipelineT<GlyphAtlasVertexShader, GlyphAtlasSdfFragmentShader>;
 using PorterDuffBlendPipeline =
     RenderPipelineT<PorterDuffBlendVertexShader, PorterDuffBlendFragmentShader>;
+using AtlasInstancedPipeline =
+    RenderPipelineT<AtlasInstancedVertexShader, PorterDuffBlendFragmentShader>;
 // Instead of requiring new shaders for clips, the solid fill stages are used
 // to redirect writing to the stencil instead of color attachments.
 using ClipPipeline = RenderPipelineT<ClipVertexShader, ClipFragmentShader>;
@@ -271,6 +294,10 @@ struct ContentContextOptions {
   BlendMode blend_mode = BlendMode::kSourceOver;
   CompareFunction stencil_compare = CompareFunction::kEqual;
   StencilOperation stencil_operation = StencilOperation::kKeep;
+  /// When set, front facing triangles increment the stencil value and back
+  /// facing triangles decrement it instead of applying `stencil_operation`,
+  /// wrapping around at either end. This counts the winding of a path.
+  bool count_stencil_winding = false;
   PrimitiveType primitive_type = PrimitiveType::kTriangle;
   PixelFormat color_attachment_pixel_format = PixelFormat::kUnknown;
   bool has_stencil_attachment = true;
@@ -281,8 +308,9 @@ struct ContentContextOptions {
     constexpr std::size_t operator()(const ContentContextOptions& o) const {
       return fml::HashCombine(
           o.sample_count, o.blend_mode, o.stencil_compare, o.stencil_operation,
-          o.primitive_type, o.color_attachment_pixel_format,
-          o.has_stencil_attachment, o.wireframe, o.is_for_rrect_blur_clear);
+          o.count_stencil_winding, o.primitive_type,
+          o.color_attachment_pixel_format, o.has_stencil_attachment,
+          o.wireframe, o.is_for_rrect_blur_clear);
     }
   };
 
@@ -293,6 +321,7 @@ struct ContentContextOptions {
              lhs.blend_mode == rhs.blend_mode &&
              lhs.stencil_compare == rhs.stencil_compare &&
              lhs.stencil_operation == rhs.stencil_operation &&
+             lhs.count_stencil_winding == rhs.count_stencil_winding &&
              lhs.primitive_type == rhs.primitive_type &&
              lhs.color_attachment_pixel_format ==
                  rhs.color_attachment_pixel_format &&
@@ -305,8 +334,41 @@ struct ContentContextOptions {
   void ApplyToPipelineDescriptor(PipelineDescriptor& desc) const;
 };
 
+//------------------------------------------------------------------------------
+/// @brief      A pipeline variant created lazily by a content context.
+///
+///             Variants are compiled the first time they are requested,
+///             which can stall a frame. A list of these records collected
+///             from a previous run can be replayed at startup so that the
+///             variants are compiled before they are needed.
+///
+struct PipelineVariantRecord {
+  /// The label and specialization constants of the prototype pipeline the
+  /// variant was derived from.
+  std::string prototype;
+  ContentContextOptions options;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Serialize pipeline variant records to a line based text format
+///             suitable for storing on disk.
+///
+std::string SerializePipelineVariantRecords(
+    const std::vector<PipelineVariantRecord>& records);
+
+//------------------------------------------------------------------------------
+/// @brief      Parse records serialized with `SerializePipelineVariantRecords`.
+///             Malformed lines are skipped.
+///
+std::vector<PipelineVariantRecord> ParsePipelineVariantRecords(
+    std::string_view serialized);
+
+class CircleMeshCache;
+class GradientTextureCache;
+class TessellationCache;
 class Tessellator;
 class RenderTargetCache;
+class VerticesBufferCache;
 
 class ContentContext {
  public:
@@ -325,6 +387,25 @@ class ContentContext {
 
   std::shared_ptr<Tessellator> GetTessellator() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Get a record of every pipeline variant created so far, not
+  ///             including the prototypes created eagerly by the constructor.
+  ///
+  std::vector<PipelineVariantRecord> GetPipelineVariantRecords() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Begin creating the variants in the given records, usually
+  ///             collected via `GetPipelineVariantRecords` in a previous run.
+  ///
+  ///             This does not wait for the variants to finish compiling.
+  ///             Records whose prototype is unknown or that already exist
+  ///             are ignored.
+  ///
+  /// @return     The number of variants that were created.
+  ///
+  size_t CreatePipelineVariants(
+      const std::vector<PipelineVariantRecord>& records) const;
+
 #ifdef IMPELLER_DEBUG
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetCheckerboardPipeline(
       ContentContextOptions opts) const {
@@ -381,11 +462,33 @@ class ContentContext {
     return GetPipeline(sweep_gradient_fill_pipelines_, opts);
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether gradients that are sampled from a texture are all
+  ///             drawn with the uber gradient pipeline, which selects the
+  ///             kind of gradient with a uniform, instead of a pipeline per
+  ///             kind.
+  ///
+  ///             This is the case on OpenGLES, where switching programs is
+  ///             expensive.
+  ///
+  bool UsesUberGradientFill() const { return uses_uber_gradient_fill_; }
+
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetUberGradientFillPipeline(
+      ContentContextOptions opts) const {
+    FML_DCHECK(UsesUberGradientFill());
+    return GetPipeline(uber_gradient_fill_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetSolidFillPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(solid_fill_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetSolidFillCoveragePipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(solid_fill_coverage_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetBlendPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(texture_blend_pipelines_, opts);
@@ -437,9 +540,14 @@ class ContentContext {
     return GetPipeline(border_mask_blur_pipelines_, opts);
   }
 
-  std::shared_ptr<Pipeline<PipelineDescriptor>> GetMorphologyFilterPipeline(
-      ContentContextOptions opts) const {
-    return GetPipeline(morphology_filter_pipelines_, opts);
+  std::shared_ptr<Pipeline<PipelineDescriptor>>
+  GetMorphologyDilateFilterPipeline(ContentContextOptions opts) const {
+    return GetPipeline(morphology_dilate_filter_pipelines_, opts);
+  }
+
+  std::shared_ptr<Pipeline<PipelineDescriptor>>
+  GetMorphologyErodeFilterPipeline(ContentContextOptions opts) const {
+    return GetPipeline(morphology_erode_filter_pipelines_, opts);
   }
 
   std::shared_ptr<Pipeline<PipelineDescriptor>>
@@ -457,6 +565,11 @@ class ContentContext {
     return GetPipeline(srgb_to_linear_filter_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetFusedColorFilterPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(fused_color_filter_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetClipPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(clip_pipelines_, opts);
@@ -472,6 +585,18 @@ class ContentContext {
     return GetPipeline(glyph_atlas_color_pipelines_, opts);
   }
 
+  /// Like |GetGlyphAtlasColorPipeline|, but the glyphs are tinted with the
+  /// text color instead of using the colors in the atlas.
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetGlyphAtlasTextColorPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(glyph_atlas_text_color_pipelines_, opts);
+  }
+
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetGlyphAtlasSdfPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(glyph_atlas_sdf_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetGeometryColorPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(geometry_color_pipelines_, opts);
@@ -487,6 +612,12 @@ class ContentContext {
     return GetPipeline(porter_duff_blend_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetAtlasInstancedPipeline(
+      ContentContextOptions opts) const {
+    FML_DCHECK(GetDeviceCapabilities().SupportsSSBO());
+    return GetPipeline(atlas_instanced_pipelines_, opts);
+  }
+
   // Advanced blends.
 
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetBlendColorPipeline(
@@ -691,14 +822,53 @@ class ContentContext {
     return render_target_cache_;
   }
 
+  std::shared_ptr<GradientTextureCache> GetGradientTextureCache() const {
+    return gradient_texture_cache_;
+  }
+
+  std::shared_ptr<TessellationCache> GetTessellationCache() const {
+    return tessellation_cache_;
+  }
+
+  std::shared_ptr<CircleMeshCache> GetCircleMeshCache() const {
+    return circle_mesh_cache_;
+  }
+
+  std::shared_ptr<VerticesBufferCache> GetVerticesBufferCache() const {
+    return vertices_buffer_cache_;
+  }
+
  private:
   std::shared_ptr<Context> context_;
   std::shared_ptr<LazyGlyphAtlas> lazy_glyph_atlas_;
 
+  class VariantsBase {
+   public:
+    virtual ~VariantsBase() = default;
+
+    /// @brief  A key identifying the prototype pipeline across launches.
+    ///         This is the label of the prototype along with its
+    ///         specialization constants since several prototypes share
+    ///         the same shaders.
+    virtual std::optional<std::string> GetPrototypeKey() const = 0;
+
+    /// @brief  Append the options of every variant created from the
+    ///         prototype, excluding the prototype itself.
+    virtual void CollectVariantOptions(
+        std::vector<ContentContextOptions>& options) const = 0;
+
+    /// @brief  Begin creating the variant for the given options if it does
+    ///         not already exist. This does not wait for the pipeline to be
+    ///         compiled.
+    virtual bool CreateVariant(const ContentContextOptions& options) = 0;
+  };
+
   template <class PipelineT>
-  class Variants {
+  class Variants final : public VariantsBase {
    public:
-    Variants() = default;
+    explicit Variants(std::vector<VariantsBase*>& registry) {
+      registry.push_back(this);
+    }
 
     void Set(const ContentContextOptions& options,
              std::unique_ptr<PipelineT> pipeline) {
@@ -740,6 +910,71 @@ class ContentContext {
 
     size_t GetPipelineCount() const { return pipelines_.size(); }
 
+    /// @brief  Create the variant for the given options from the prototype.
+    ///         The returned pipeline may still be compiling.
+    PipelineT* CreateVariantAsync(const ContentContextOptions& options) {
+      auto prototype = GetDefault();
+
+      // The prototype must always be initialized in the constructor.
+      FML_CHECK(prototype != nullptr);
+
+      auto pipeline = prototype->WaitAndGet();
+      if (!pipeline) {
+        return nullptr;
+      }
+
+      auto variant_future = pipeline->CreateVariant(
+          [&options, variants_count =
+                         GetPipelineCount()](PipelineDescriptor& desc) {
+            options.ApplyToPipelineDescriptor(desc);
+            desc.SetLabel(
+                SPrintF("%s V#%zu", desc.GetLabel().c_str(), variants_count));
+          });
+      auto variant = std::make_unique<PipelineT>(std::move(variant_future));
+      auto result = variant.get();
+      Set(options, std::move(variant));
+      return result;
+    }
+
+    // |VariantsBase|
+    std::optional<std::string> GetPrototypeKey() const override {
+      auto prototype = GetDefault();
+      if (!prototype) {
+        return std::nullopt;
+      }
+      auto desc = prototype->GetDescriptor();
+      if (!desc.has_value()) {
+        return std::nullopt;
+      }
+      std::stringstream key;
+      key << desc->GetLabel();
+      for (auto constant : desc->GetSpecializationConstants()) {
+        key << "," << constant;
+      }
+      return key.str();
+    }
+
+    // |VariantsBase|
+    void CollectVariantOptions(
+        std::vector<ContentContextOptions>& options) const override {
+      for (const auto& [variant_options, _] : pipelines_) {
+        if (default_options_.has_value() &&
+            ContentContextOptions::Equal{}(variant_options,
+                                           default_options_.value())) {
+          continue;
+        }
+        options.push_back(variant_options);
+      }
+    }
+
+    // |VariantsBase|
+    bool CreateVariant(const ContentContextOptions& options) override {
+      if (Get(options) != nullptr) {
+        return false;
+      }
+      return CreateVariantAsync(options) != nullptr;
+    }
+
    private:
     std::optional<ContentContextOptions> default_options_;
     std::unordered_map<ContentContextOptions,
@@ -753,101 +988,113 @@ class ContentContext {
     Variants& operator=(const Variants&) = delete;
   };
 
+  // Every variants container below, in declaration order. Used to record and
+  // replay the set of variants an application needs.
+  std::vector<VariantsBase*> variants_registry_;
+
   // These are mutable because while the prototypes are created eagerly, any
   // variants requested from that are lazily created and cached in the variants
   // map.
 
 #ifdef IMPELLER_DEBUG
-  mutable Variants<CheckerboardPipeline> checkerboard_pipelines_;
+  mutable Variants<CheckerboardPipeline> checkerboard_pipelines_{variants_registry_};
 #endif  // IMPELLER_DEBUG
 
-  mutable Variants<SolidFillPipeline> solid_fill_pipelines_;
-  mutable Variants<LinearGradientFillPipeline> linear_gradient_fill_pipelines_;
-  mutable Variants<RadialGradientFillPipeline> radial_gradient_fill_pipelines_;
+  mutable Variants<SolidFillPipeline> solid_fill_pipelines_{variants_registry_};
+  mutable Variants<SolidFillCoveragePipeline> solid_fill_coverage_pipelines_{
+      variants_registry_};
+  mutable Variants<LinearGradientFillPipeline> linear_gradient_fill_pipelines_{variants_registry_};
+  mutable Variants<RadialGradientFillPipeline> radial_gradient_fill_pipelines_{variants_registry_};
   mutable Variants<ConicalGradientFillPipeline>
-      conical_gradient_fill_pipelines_;
-  mutable Variants<SweepGradientFillPipeline> sweep_gradient_fill_pipelines_;
+      conical_gradient_fill_pipelines_{variants_registry_};
+  mutable Variants<SweepGradientFillPipeline> sweep_gradient_fill_pipelines_{variants_registry_};
+  mutable Variants<UberGradientFillPipeline> uber_gradient_fill_pipelines_{variants_registry_};
   mutable Variants<LinearGradientSSBOFillPipeline>
-      linear_gradient_ssbo_fill_pipelines_;
+      linear_gradient_ssbo_fill_pipelines_{variants_registry_};
   mutable Variants<RadialGradientSSBOFillPipeline>
-      radial_gradient_ssbo_fill_pipelines_;
+      radial_gradient_ssbo_fill_pipelines_{variants_registry_};
   mutable Variants<ConicalGradientSSBOFillPipeline>
-      conical_gradient_ssbo_fill_pipelines_;
+      conical_gradient_ssbo_fill_pipelines_{variants_registry_};
   mutable Variants<SweepGradientSSBOFillPipeline>
-      sweep_gradient_ssbo_fill_pipelines_;
-  mutable Variants<RRectBlurPipeline> rrect_blur_pipelines_;
-  mutable Variants<BlendPipeline> texture_blend_pipelines_;
-  mutable Variants<TexturePipeline> texture_pipelines_;
+      sweep_gradient_ssbo_fill_pipelines_{variants_registry_};
+  mutable Variants<RRectBlurPipeline> rrect_blur_pipelines_{variants_registry_};
+  mutable Variants<BlendPipeline> texture_blend_pipelines_{variants_registry_};
+  mutable Variants<TexturePipeline> texture_pipelines_{variants_registry_};
 #ifdef IMPELLER_ENABLE_OPENGLES
-  mutable Variants<TextureExternalPipeline> texture_external_pipelines_;
+  mutable Variants<TextureExternalPipeline> texture_external_pipelines_{variants_registry_};
   mutable Variants<TiledTextureExternalPipeline>
-      tiled_texture_external_pipelines_;
+      tiled_texture_external_pipelines_{variants_registry_};
 #endif  // IMPELLER_ENABLE_OPENGLES
-  mutable Variants<PositionUVPipeline> position_uv_pipelines_;
-  mutable Variants<TiledTexturePipeline> tiled_texture_pipelines_;
+  mutable Variants<PositionUVPipeline> position_uv_pipelines_{variants_registry_};
+  mutable Variants<TiledTexturePipeline> tiled_texture_pipelines_{variants_registry_};
   mutable Variants<GaussianBlurDecalPipeline>
-      gaussian_blur_noalpha_decal_pipelines_;
+      gaussian_blur_noalpha_decal_pipelines_{variants_registry_};
   mutable Variants<GaussianBlurPipeline>
-      gaussian_blur_noalpha_nodecal_pipelines_;
-  mutable Variants<BorderMaskBlurPipeline> border_mask_blur_pipelines_;
-  mutable Variants<MorphologyFilterPipeline> morphology_filter_pipelines_;
+      gaussian_blur_noalpha_nodecal_pipelines_{variants_registry_};
+  mutable Variants<BorderMaskBlurPipeline> border_mask_blur_pipelines_{variants_registry_};
+  mutable Variants<MorphologyFilterPipeline> morphology_dilate_filter_pipelines_{variants_registry_};
+  mutable Variants<MorphologyFilterPipeline> morphology_erode_filter_pipelines_{variants_registry_};
   mutable Variants<ColorMatrixColorFilterPipeline>
-      color_matrix_color_filter_pipelines_;
-  mutable Variants<LinearToSrgbFilterPipeline> linear_to_srgb_filter_pipelines_;
-  mutable Variants<SrgbToLinearFilterPipeline> srgb_to_linear_filter_pipelines_;
-  mutable Variants<ClipPipeline> clip_pipelines_;
-  mutable Variants<GlyphAtlasPipeline> glyph_atlas_pipelines_;
-  mutable Variants<GlyphAtlasColorPipeline> glyph_atlas_color_pipelines_;
-  mutable Variants<GeometryColorPipeline> geometry_color_pipelines_;
-  mutable Variants<YUVToRGBFilterPipeline> yuv_to_rgb_filter_pipelines_;
-  mutable Variants<PorterDuffBlendPipeline> porter_duff_blend_pipelines_;
+      color_matrix_color_filter_pipelines_{variants_registry_};
+  mutable Variants<LinearToSrgbFilterPipeline> linear_to_srgb_filter_pipelines_{variants_registry_};
+  mutable Variants<SrgbToLinearFilterPipeline> srgb_to_linear_filter_pipelines_{variants_registry_};
+  mutable Variants<FusedColorFilterPipeline> fused_color_filter_pipelines_{variants_registry_};
+  mutable Variants<ClipPipeline> clip_pipelines_{variants_registry_};
+  mutable Variants<GlyphAtlasPipeline> glyph_atlas_pipelines_{variants_registry_};
+  mutable Variants<GlyphAtlasColorPipeline> glyph_atlas_color_pipelines_{variants_registry_};
+  mutable Variants<GlyphAtlasColorPipeline> glyph_atlas_text_color_pipelines_{variants_registry_};
+  mutable Variants<GlyphAtlasSdfPipeline> glyph_atlas_sdf_pipelines_{variants_registry_};
+  mutable Variants<GeometryColorPipeline> geometry_color_pipelines_{variants_registry_};
+  mutable Variants<YUVToRGBFilterPipeline> yuv_to_rgb_filter_pipelines_{variants_registry_};
+  mutable Variants<PorterDuffBlendPipeline> porter_duff_blend_pipelines_{variants_registry_};
+  mutable Variants<AtlasInstancedPipeline> atlas_instanced_pipelines_{variants_registry_};
   // Advanced blends.
-  mutable Variants<BlendColorPipeline> blend_color_pipelines_;
-  mutable Variants<BlendColorBurnPipeline> blend_colorburn_pipelines_;
-  mutable Variants<BlendColorDodgePipeline> blend_colordodge_pipelines_;
-  mutable Variants<BlendDarkenPipeline> blend_darken_pipelines_;
-  mutable Variants<BlendDifferencePipeline> blend_difference_pipelines_;
-  mutable Variants<BlendExclusionPipeline> blend_exclusion_pipelines_;
-  mutable Variants<BlendHardLightPipeline> blend_hardlight_pipelines_;
-  mutable Variants<BlendHuePipeline> blend_hue_pipelines_;
-  mutable Variants<BlendLightenPipeline> blend_lighten_pipelines_;
-  mutable Variants<BlendLuminosityPipeline> blend_luminosity_pipelines_;
-  mutable Variants<BlendMultiplyPipeline> blend_multiply_pipelines_;
-  mutable Variants<BlendOverlayPipeline> blend_overlay_pipelines_;
-  mutable Variants<BlendSaturationPipeline> blend_saturation_pipelines_;
-  mutable Variants<BlendScreenPipeline> blend_screen_pipelines_;
-  mutable Variants<BlendSoftLightPipeline> blend_softlight_pipelines_;
+  mutable Variants<BlendColorPipeline> blend_color_pipelines_{variants_registry_};
+  mutable Variants<BlendColorBurnPipeline> blend_colorburn_pipelines_{variants_registry_};
+  mutable Variants<BlendColorDodgePipeline> blend_colordodge_pipelines_{variants_registry_};
+  mutable Variants<BlendDarkenPipeline> blend_darken_pipelines_{variants_registry_};
+  mutable Variants<BlendDifferencePipeline> blend_difference_pipelines_{variants_registry_};
+  mutable Variants<BlendExclusionPipeline> blend_exclusion_pipelines_{variants_registry_};
+  mutable Variants<BlendHardLightPipeline> blend_hardlight_pipelines_{variants_registry_};
+  mutable Variants<BlendHuePipeline> blend_hue_pipelines_{variants_registry_};
+  mutable Variants<BlendLightenPipeline> blend_lighten_pipelines_{variants_registry_};
+  mutable Variants<BlendLuminosityPipeline> blend_luminosity_pipelines_{variants_registry_};
+  mutable Variants<BlendMultiplyPipeline> blend_multiply_pipelines_{variants_registry_};
+  mutable Variants<BlendOverlayPipeline> blend_overlay_pipelines_{variants_registry_};
+  mutable Variants<BlendSaturationPipeline> blend_saturation_pipelines_{variants_registry_};
+  mutable Variants<BlendScreenPipeline> blend_screen_pipelines_{variants_registry_};
+  mutable Variants<BlendSoftLightPipeline> blend_softlight_pipelines_{variants_registry_};
   // Framebuffer Advanced blends.
   mutable Variants<FramebufferBlendColorPipeline>
-      framebuffer_blend_color_pipelines_;
+      framebuffer_blend_color_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendColorBurnPipeline>
-      framebuffer_blend_colorburn_pipelines_;
+      framebuffer_blend_colorburn_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendColorDodgePipeline>
-      framebuffer_blend_colordodge_pipelines_;
+      framebuffer_blend_colordodge_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendDarkenPipeline>
-      framebuffer_blend_darken_pipelines_;
+      framebuffer_blend_darken_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendDifferencePipeline>
-      framebuffer_blend_difference_pipelines_;
+      framebuffer_blend_difference_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendExclusionPipeline>
-      framebuffer_blend_exclusion_pipelines_;
+      framebuffer_blend_exclusion_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendHardLightPipeline>
-      framebuffer_blend_hardlight_pipelines_;
+      framebuffer_blend_hardlight_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendHuePipeline>
-      framebuffer_blend_hue_pipelines_;
+      framebuffer_blend_hue_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendLightenPipeline>
-      framebuffer_blend_lighten_pipelines_;
+      framebuffer_blend_lighten_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendLuminosityPipeline>
-      framebuffer_blend_luminosity_pipelines_;
+      framebuffer_blend_luminosity_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendMultiplyPipeline>
-      framebuffer_blend_multiply_pipelines_;
+      framebuffer_blend_multiply_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendOverlayPipeline>
-      framebuffer_blend_overlay_pipelines_;
+      framebuffer_blend_overlay_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendSaturationPipeline>
-      framebuffer_blend_saturation_pipelines_;
+      framebuffer_blend_saturation_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendScreenPipeline>
-      framebuffer_blend_screen_pipelines_;
+      framebuffer_blend_screen_pipelines_{variants_registry_};
   mutable Variants<FramebufferBlendSoftLightPipeline>
-      framebuffer_blend_softlight_pipelines_;
+      framebuffer_blend_softlight_pipelines_{variants_registry_};
   mutable std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
       point_field_compute_pipelines_;
   mutable std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
@@ -865,31 +1112,14 @@ class ContentContext {
       opts.wireframe = true;
     }
 
-    if (auto found = container.Get(opts)) {
-      return found->WaitAndGet();
+    auto variant = container.Get(opts);
+    if (variant) {
+      pipeline_variant_statistics_.RecordHit();
+    } else {
+      pipeline_variant_statistics_.RecordMiss();
+      variant = container.CreateVariantAsync(opts);
     }
-
-    auto prototype = container.GetDefault();
-
-    // The prototype must always be initialized in the constructor.
-    FML_CHECK(prototype != nullptr);
-
-    auto pipeline = prototype->WaitAndGet();
-    if (!pipeline) {
-      return nullptr;
-    }
-
-    auto variant_future = pipeline->CreateVariant(
-        [&opts, variants_count =
-                    container.GetPipelineCount()](PipelineDescriptor& desc) {
-          opts.ApplyToPipelineDescriptor(desc);
-          desc.SetLabel(
-              SPrintF("%s V#%zu", desc.GetLabel().c_str(), variants_count));
-        });
-    auto variant = std::make_unique<TypedPipeline>(std::move(variant_future));
-    auto variant_pipeline = variant->WaitAndGet();
-    container.Set(opts, std::move(variant));
-    return variant_pipeline;
+    return variant ? variant->WaitAndGet() : nullptr;
   }
 
   bool is_valid_ = false;
@@ -898,7 +1128,14 @@ class ContentContext {
   std::shared_ptr<scene::SceneContext> scene_context_;
 #endif  // IMPELLER_ENABLE_3D
   std::shared_ptr<RenderTargetAllocator> render_target_cache_;
+  std::shared_ptr<GradientTextureCache> gradient_texture_cache_;
+  std::shared_ptr<TessellationCache> tessellation_cache_;
+  std::shared_ptr<CircleMeshCache> circle_mesh_cache_;
+  std::shared_ptr<VerticesBufferCache> vertices_buffer_cache_;
   bool wireframe_ = false;
+  bool uses_uber_gradient_fill_ = false;
+  fml::CacheStatistics::Counters& pipeline_variant_statistics_ =
+      fml::CacheStatistics::GetCounters("ImpellerPipelineVariants");
 
   ContentContext(const ContentContext&) = delete;
 
@@ -47,6 +47,10 @@ bool Contents::IsOpaque() const {
   return false;
 }
 
+bool Contents::CanRenderWithoutMSAA(const Entity& entity) const {
+  return false;
+}
+
 Contents::ClipCoverage Contents::GetClipCoverage(
     const Entity& entity,
     const std::optional<Rect>& current_clip_coverage) const {
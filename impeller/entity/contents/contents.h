@@ -95,6 +95,13 @@ class Contents {
   ///
   virtual bool IsOpaque() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief Whether this Contents is rendered anti-aliased without a
+  ///        multisampled render target, so that a pass that only contains
+  ///        such contents can skip MSAA.
+  ///
+  virtual bool CanRenderWithoutMSAA(const Entity& entity) const;
+
   //----------------------------------------------------------------------------
   /// @brief Given the current pass space bounding rectangle of the clip
   ///        buffer, return the expected clip coverage after this draw call.
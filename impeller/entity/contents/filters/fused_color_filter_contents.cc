@@ -0,0 +1,188 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/filters/fused_color_filter_contents.h"
+
+#include <algorithm>
+#include <optional>
+
+#include "impeller/entity/contents/anonymous_contents.h"
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/contents/contents.h"
+#include "impeller/entity/contents/filters/blend_filter_contents.h"
+#include "impeller/geometry/point.h"
+#include "impeller/geometry/vector.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/sampler_library.h"
+
+namespace impeller {
+
+std::shared_ptr<ColorFilterContents> FusedColorFilterContents::MakeChain(
+    FilterInput::Ref input,
+    const std::vector<Stage>& stages,
+    AbsorbOpacity absorb_opacity) {
+  std::shared_ptr<ColorFilterContents> filter;
+  for (size_t begin = 0; begin < stages.size(); begin += kMaxStages) {
+    auto end = std::min(begin + kMaxStages, stages.size());
+    auto fused = std::make_shared<FusedColorFilterContents>();
+    fused->SetInputs({filter ? FilterInput::Make(filter) : input});
+    fused->SetStages({stages.begin() + begin, stages.begin() + end});
+    fused->SetAbsorbOpacity(filter ? AbsorbOpacity::kNo : absorb_opacity);
+    filter = std::move(fused);
+  }
+  return filter;
+}
+
+FusedColorFilterContents::FusedColorFilterContents() = default;
+
+FusedColorFilterContents::~FusedColorFilterContents() = default;
+
+void FusedColorFilterContents::SetStages(std::vector<Stage> stages) {
+  FML_DCHECK(stages.size() <= kMaxStages);
+  stages_ = std::move(stages);
+}
+
+// Packs a stage into the uniforms that fused_color_filter.frag reads it from.
+static void PackStage(const FusedColorFilterContents::Stage& stage,
+                      Scalar& kind,
+                      Matrix& m,
+                      Vector4& v) {
+  using Kind = FusedColorFilterContents::Stage::Kind;
+
+  kind = static_cast<Scalar>(stage.kind);
+  m = Matrix();
+  v = Vector4();
+  switch (stage.kind) {
+    case Kind::kMatrix: {
+      const float* matrix = stage.matrix.array;
+      v = Vector4(matrix[4], matrix[9], matrix[14], matrix[19]);
+      // clang-format off
+      m = Matrix(
+          matrix[0], matrix[5], matrix[10], matrix[15],
+          matrix[1], matrix[6], matrix[11], matrix[16],
+          matrix[2], matrix[7], matrix[12], matrix[17],
+          matrix[3], matrix[8], matrix[13], matrix[18]
+      );
+      // clang-format on
+      break;
+    }
+    case Kind::kBlend: {
+      FML_DCHECK(stage.blend_mode <= Entity::kLastPipelineBlendMode);
+      auto coefficients =
+          kPorterDuffCoefficients[static_cast<int>(stage.blend_mode)];
+      // clang-format off
+      m = Matrix(
+          coefficients[0], coefficients[1], coefficients[2], coefficients[3],
+          coefficients[4], 0, 0, 0,
+          0, 0, 0, 0,
+          0, 0, 0, 0
+      );
+      // clang-format on
+      auto color = stage.color.Premultiply();
+      v = Vector4(color.red, color.green, color.blue, color.alpha);
+      break;
+    }
+    case Kind::kNone:
+    case Kind::kSrgbToLinear:
+    case Kind::kLinearToSrgb:
+      break;
+  }
+}
+
+std::optional<Entity> FusedColorFilterContents::RenderFilter(
+    const FilterInput::Vector& inputs,
+    const ContentContext& renderer,
+    const Entity& entity,
+    const Matrix& effect_transform,
+    const Rect& coverage,
+    const std::optional<Rect>& coverage_hint) const {
+  using VS = FusedColorFilterPipeline::VertexShader;
+  using FS = FusedColorFilterPipeline::FragmentShader;
+
+  //----------------------------------------------------------------------------
+  /// Handle inputs.
+  ///
+
+  if (inputs.empty()) {
+    return std::nullopt;
+  }
+
+  auto input_snapshot =
+      inputs[0]->GetSnapshot("FusedColorFilter", renderer, entity);
+  if (!input_snapshot.has_value()) {
+    return std::nullopt;
+  }
+
+  FS::FragInfo frag_info;
+  std::vector<Stage> stages = stages_;
+  stages.resize(kMaxStages);
+  PackStage(stages[0], frag_info.stage0_kind, frag_info.stage0_m,
+            frag_info.stage0_v);
+  PackStage(stages[1], frag_info.stage1_kind, frag_info.stage1_m,
+            frag_info.stage1_v);
+  PackStage(stages[2], frag_info.stage2_kind, frag_info.stage2_m,
+            frag_info.stage2_v);
+  PackStage(stages[3], frag_info.stage3_kind, frag_info.stage3_m,
+            frag_info.stage3_v);
+  frag_info.input_alpha = GetAbsorbOpacity() == AbsorbOpacity::kYes
+                              ? input_snapshot->opacity
+                              : 1.0f;
+
+  //----------------------------------------------------------------------------
+  /// Create AnonymousContents for rendering.
+  ///
+  RenderProc render_proc = [input_snapshot, frag_info](
+                               const ContentContext& renderer,
+                               const Entity& entity, RenderPass& pass) -> bool {
+    Command cmd;
+    DEBUG_COMMAND_INFO(cmd, "Fused Color Filter");
+    cmd.stencil_reference = entity.GetClipDepth();
+
+    auto options = OptionsFromPassAndEntity(pass, entity);
+    options.primitive_type = PrimitiveType::kTriangleStrip;
+    cmd.pipeline = renderer.GetFusedColorFilterPipeline(options);
+
+    auto size = input_snapshot->texture->GetSize();
+
+    VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+    vtx_builder.AddVertices({
+        {Point(0, 0)},
+        {Point(1, 0)},
+        {Point(0, 1)},
+        {Point(1, 1)},
+    });
+    auto& host_buffer = pass.GetTransientsBuffer();
+    cmd.BindVertices(vtx_builder.CreateVertexBuffer(host_buffer));
+
+    VS::FrameInfo frame_info;
+    frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                     entity.GetTransform() * input_snapshot->transform *
+                     Matrix::MakeScale(Vector2(size));
+    frame_info.texture_sampler_y_coord_scale =
+        input_snapshot->texture->GetYCoordScale();
+
+    auto sampler = renderer.GetContext()->GetSamplerLibrary()->GetSampler({});
+    FS::BindInputTexture(cmd, input_snapshot->texture, sampler);
+    FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+
+    VS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+
+    return pass.AddCommand(std::move(cmd));
+  };
+
+  CoverageProc coverage_proc =
+      [coverage](const Entity& entity) -> std::optional<Rect> {
+    return coverage.TransformBounds(entity.GetTransform());
+  };
+
+  auto contents = AnonymousContents::Make(render_proc, coverage_proc);
+
+  Entity sub_entity;
+  sub_entity.SetContents(std::move(contents));
+  sub_entity.SetClipDepth(entity.GetClipDepth());
+  sub_entity.SetBlendMode(entity.GetBlendMode());
+  return sub_entity;
+}
+
+}  // namespace impeller
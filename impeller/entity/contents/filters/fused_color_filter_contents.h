@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "impeller/entity/contents/filters/color_filter_contents.h"
+#include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/geometry/color.h"
+
+namespace impeller {
+
+/// @brief Applies a sequence of color filters to its input in one pass, in
+///        place of a pass per filter with a texture between each of them.
+class FusedColorFilterContents final : public ColorFilterContents {
+ public:
+  /// The most stages that are applied in one pass.
+  static constexpr size_t kMaxStages = 4u;
+
+  struct Stage {
+    // These values must correspond to the kinds in fused_color_filter.frag.
+    enum class Kind {
+      kNone,
+      kMatrix,
+      kSrgbToLinear,
+      kLinearToSrgb,
+      kBlend,
+    };
+
+    Kind kind = Kind::kNone;
+    /// The matrix of a `kMatrix` stage.
+    ColorMatrix matrix = {};
+    /// The blend mode of a `kBlend` stage, which must be a Porter-Duff blend
+    /// mode.
+    BlendMode blend_mode = BlendMode::kSourceOver;
+    /// The color that a `kBlend` stage blends over its input.
+    Color color;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief  Applies the stages to the input in order, with a pass for every
+  ///         `kMaxStages` stages.
+  ///
+  ///         The opacity of the input is absorbed by the first pass.
+  ///
+  static std::shared_ptr<ColorFilterContents> MakeChain(
+      FilterInput::Ref input,
+      const std::vector<Stage>& stages,
+      AbsorbOpacity absorb_opacity);
+
+  FusedColorFilterContents();
+
+  ~FusedColorFilterContents() override;
+
+  /// @brief Sets the stages to apply, of which there may be at most
+  ///        `kMaxStages`.
+  void SetStages(std::vector<Stage> stages);
+
+ private:
+  // |FilterContents|
+  std::optional<Entity> RenderFilter(
+      const FilterInput::Vector& input_textures,
+      const ContentContext& renderer,
+      const Entity& entity,
+      const Matrix& effect_transform,
+      const Rect& coverage,
+      const std::optional<Rect>& coverage_hint) const override;
+
+  std::vector<Stage> stages_;
+
+  FusedColorFilterContents(const FusedColorFilterContents&) = delete;
+
+  FusedColorFilterContents& operator=(const FusedColorFilterContents&) =
+      delete;
+};
+
+}  // namespace impeller
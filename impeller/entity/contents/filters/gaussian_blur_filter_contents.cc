@@ -261,9 +261,22 @@ std::optional<Entity> GaussianBlurFilterContents::RenderFilter(
   Quad uvs =
       CalculateUVs(inputs[0], entity, input_snapshot->texture->GetSize());
 
+  // The first pass draws the input with its transparent gutter. Any further
+  // passes are needed for large sigmas only and keep halving the result.
+  std::vector<ISize> downsample_sizes = CalculateDownsampleSizes(
+      ISize(round(padded_size.x), round(padded_size.y)), subpass_size);
   std::shared_ptr<Texture> pass1_out_texture = MakeDownsampleSubpass(
       renderer, input_snapshot->texture, input_snapshot->sampler_descriptor,
-      uvs, subpass_size, padding);
+      uvs, downsample_sizes[0], padding);
+  for (size_t i = 1; i < downsample_sizes.size() && pass1_out_texture; i++) {
+    pass1_out_texture = MakeDownsampleSubpass(
+        renderer, pass1_out_texture, input_snapshot->sampler_descriptor,
+        Quad{Point(0, 0), Point(1, 0), Point(0, 1), Point(1, 1)},
+        downsample_sizes[i], /*padding=*/Vector2(0, 0));
+  }
+  if (!pass1_out_texture) {
+    return std::nullopt;
+  }
 
   Vector2 pass1_pixel_size = 1.0 / Vector2(pass1_out_texture->GetSize());
 
@@ -300,6 +313,22 @@ std::optional<Entity> GaussianBlurFilterContents::RenderFilter(
       entity.GetBlendMode(), entity.GetClipDepth());
 }
 
+std::vector<ISize> GaussianBlurFilterContents::CalculateDownsampleSizes(
+    const ISize& source_size,
+    const ISize& target_size) {
+  if (target_size.IsEmpty()) {
+    return {target_size};
+  }
+  std::vector<ISize> sizes;
+  ISize size = source_size;
+  do {
+    size = ISize(std::max((size.width + 1) / 2, target_size.width),
+                 std::max((size.height + 1) / 2, target_size.height));
+    sizes.push_back(size);
+  } while (size != target_size);
+  return sizes;
+}
+
 Scalar GaussianBlurFilterContents::CalculateBlurRadius(Scalar sigma) {
   return static_cast<Radius>(Sigma(sigma)).radius;
 }
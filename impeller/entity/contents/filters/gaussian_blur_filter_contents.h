@@ -5,6 +5,8 @@
 #pragma once
 
 #include <optional>
+#include <vector>
+
 #include "impeller/entity/contents/filters/filter_contents.h"
 
 namespace impeller {
@@ -47,6 +49,19 @@ class GaussianBlurFilterContents final : public FilterContents {
   /// Visible for testing.
   static Scalar CalculateScale(Scalar sigma);
 
+  /// Calculate the sizes of the passes that downsample a texture of
+  /// `source_size` to `target_size`.
+  ///
+  /// A single bilinear pass only averages the 2x2 texels nearest to each
+  /// output texel, so downsampling by more than half in one pass skips texels
+  /// and shimmers as the content moves. Larger downsamples are split into
+  /// passes that halve the size, dual filter style, with the last pass
+  /// producing `target_size`.
+  ///
+  /// Visible for testing.
+  static std::vector<ISize> CalculateDownsampleSizes(const ISize& source_size,
+                                                     const ISize& target_size);
+
  private:
   // |FilterContents|
   std::optional<Entity> RenderFilter(
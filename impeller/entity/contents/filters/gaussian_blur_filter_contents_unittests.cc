@@ -156,6 +156,66 @@ TEST_P(GaussianBlurFilterContentsTest, RenderCoverageMatchesGetCoverage) {
   }
 }
 
+TEST(GaussianBlurFilterContentsTest, CalculateDownsampleSizes) {
+  using Sizes = std::vector<ISize>;
+  EXPECT_EQ(GaussianBlurFilterContents::CalculateDownsampleSizes(
+                ISize(100, 100), ISize(100, 100)),
+            Sizes({ISize(100, 100)}));
+  EXPECT_EQ(GaussianBlurFilterContents::CalculateDownsampleSizes(
+                ISize(100, 100), ISize(60, 60)),
+            Sizes({ISize(60, 60)}));
+  EXPECT_EQ(GaussianBlurFilterContents::CalculateDownsampleSizes(
+                ISize(100, 100), ISize(50, 50)),
+            Sizes({ISize(50, 50)}));
+  EXPECT_EQ(GaussianBlurFilterContents::CalculateDownsampleSizes(
+                ISize(100, 100), ISize(12, 12)),
+            Sizes({ISize(50, 50), ISize(25, 25), ISize(13, 13),
+                   ISize(12, 12)}));
+  EXPECT_EQ(GaussianBlurFilterContents::CalculateDownsampleSizes(
+                ISize(101, 40), ISize(10, 10)),
+            Sizes({ISize(51, 20), ISize(26, 10), ISize(13, 10),
+                   ISize(10, 10)}));
+  EXPECT_EQ(GaussianBlurFilterContents::CalculateDownsampleSizes(
+                ISize(100, 100), ISize(0, 0)),
+            Sizes({ISize(0, 0)}));
+}
+
+TEST_P(GaussianBlurFilterContentsTest,
+       RenderCoverageMatchesGetCoverageLargeSigma) {
+  TextureDescriptor desc = {
+      .storage_mode = StorageMode::kDevicePrivate,
+      .format = PixelFormat::kB8G8R8A8UNormInt,
+      .size = ISize(100, 100),
+  };
+  std::shared_ptr<Texture> texture = MakeTexture(desc);
+  // Large enough to downsample in more than one pass.
+  Scalar sigma_radius_100 = CalculateSigmaForBlurRadius(100.0);
+  ASSERT_LT(GaussianBlurFilterContents::CalculateScale(sigma_radius_100), 0.5);
+  auto contents =
+      std::make_unique<GaussianBlurFilterContents>(sigma_radius_100);
+  contents->SetInputs({FilterInput::Make(texture)});
+  std::shared_ptr<ContentContext> renderer = GetContentContext();
+
+  Entity entity;
+  std::optional<Entity> result =
+      contents->GetEntity(*renderer, entity, /*coverage_hint=*/{});
+  EXPECT_TRUE(result.has_value());
+  if (result.has_value()) {
+    std::optional<Rect> result_coverage = result.value().GetCoverage();
+    std::optional<Rect> contents_coverage = contents->GetCoverage(entity);
+    EXPECT_TRUE(result_coverage.has_value());
+    EXPECT_TRUE(contents_coverage.has_value());
+    if (result_coverage.has_value() && contents_coverage.has_value()) {
+      // The rendered gutter is rounded up to whole pixels.
+      Rect expected = contents_coverage.value();
+      EXPECT_NEAR(result_coverage->GetLeft(), expected.GetLeft(), 1.0);
+      EXPECT_NEAR(result_coverage->GetTop(), expected.GetTop(), 1.0);
+      EXPECT_NEAR(result_coverage->GetRight(), expected.GetRight(), 1.0);
+      EXPECT_NEAR(result_coverage->GetBottom(), expected.GetBottom(), 1.0);
+    }
+  }
+}
+
 TEST_P(GaussianBlurFilterContentsTest,
        RenderCoverageMatchesGetCoverageTranslate) {
   TextureDescriptor desc = {
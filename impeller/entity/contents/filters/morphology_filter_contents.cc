@@ -105,7 +105,6 @@ std::optional<Entity> DirectionalMorphologyFilterContents::RenderFilter(
 
     FS::FragInfo frag_info;
     frag_info.radius = std::round(transformed_radius.GetLength());
-    frag_info.morph_type = static_cast<Scalar>(morph_type_);
     frag_info.uv_offset =
         input_snapshot->transform.Invert()
             .TransformDirection(transformed_radius)
@@ -117,7 +116,14 @@ std::optional<Entity> DirectionalMorphologyFilterContents::RenderFilter(
     auto options = OptionsFromPass(pass);
     options.primitive_type = PrimitiveType::kTriangleStrip;
     options.blend_mode = BlendMode::kSource;
-    cmd.pipeline = renderer.GetMorphologyFilterPipeline(options);
+    switch (morph_type_) {
+      case FilterContents::MorphType::kDilate:
+        cmd.pipeline = renderer.GetMorphologyDilateFilterPipeline(options);
+        break;
+      case FilterContents::MorphType::kErode:
+        cmd.pipeline = renderer.GetMorphologyErodeFilterPipeline(options);
+        break;
+    }
     cmd.BindVertices(vtx_builder.CreateVertexBuffer(host_buffer));
 
     auto sampler_descriptor = input_snapshot->sampler_descriptor;
@@ -16,6 +16,10 @@ class YUVToRGBFilterContents final : public FilterContents {
 
   void SetYUVColorSpace(YUVColorSpace yuv_color_space);
 
+  /// @brief  The matrix that the YUV to RGB filter shader multiplies YUV
+  ///         values by to convert them to RGB in the given color space.
+  static Matrix GetYUVToRGBMatrix(YUVColorSpace yuv_color_space);
+
  private:
   // |FilterContents|
   std::optional<Entity> RenderFilter(
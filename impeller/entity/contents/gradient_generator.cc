@@ -8,9 +8,12 @@
 
 #include "flutter/fml/logging.h"
 #include "impeller/core/texture.h"
+#include "impeller/entity/contents/clip_contents.h"
+#include "impeller/entity/contents/color_source_contents.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/renderer/context.h"
 #include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/sampler_library.h"
 
 namespace impeller {
 
@@ -53,4 +56,69 @@ std::vector<StopData> CreateGradientColors(const std::vector<Color>& colors,
   return result;
 }
 
+bool RenderUberGradient(const ContentContext& renderer,
+                        const Entity& entity,
+                        RenderPass& pass,
+                        const ColorSourceContents& contents,
+                        const UberGradient& gradient,
+                        std::shared_ptr<Texture> gradient_texture) {
+  using VS = UberGradientFillPipeline::VertexShader;
+  using FS = UberGradientFillPipeline::FragmentShader;
+
+  FS::FragInfo frag_info;
+  frag_info.center = gradient.center;
+  frag_info.end_point = gradient.end_point;
+  frag_info.kind = static_cast<Scalar>(gradient.kind);
+  frag_info.radius = gradient.radius;
+  frag_info.focus_radius = gradient.focus_radius;
+  frag_info.bias = gradient.bias;
+  frag_info.scale = gradient.scale;
+  frag_info.tile_mode = static_cast<Scalar>(gradient.tile_mode);
+  frag_info.decal_border_color = gradient.decal_border_color;
+  frag_info.texture_sampler_y_coord_scale = gradient_texture->GetYCoordScale();
+  frag_info.alpha = contents.GetOpacityFactor();
+  frag_info.half_texel = Vector2(0.5 / gradient_texture->GetSize().width,
+                                 0.5 / gradient_texture->GetSize().height);
+
+  auto geometry_result =
+      contents.GetGeometry()->GetPositionBuffer(renderer, entity, pass);
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = geometry_result.transform;
+  frame_info.matrix = contents.GetInverseEffectTransform();
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "UberGradientFill");
+  cmd.stencil_reference = entity.GetClipDepth();
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  if (geometry_result.prevent_overdraw) {
+    options.stencil_compare = CompareFunction::kEqual;
+    options.stencil_operation = StencilOperation::kIncrementClamp;
+  }
+  options.primitive_type = geometry_result.type;
+  cmd.pipeline = renderer.GetUberGradientFillPipeline(options);
+
+  cmd.BindVertices(std::move(geometry_result.vertex_buffer));
+  FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
+  SamplerDescriptor sampler_desc;
+  sampler_desc.min_filter = MinMagFilter::kLinear;
+  sampler_desc.mag_filter = MinMagFilter::kLinear;
+  FS::BindTextureSampler(
+      cmd, std::move(gradient_texture),
+      renderer.GetContext()->GetSamplerLibrary()->GetSampler(sampler_desc));
+  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+  if (!pass.AddCommand(std::move(cmd))) {
+    return false;
+  }
+
+  if (geometry_result.prevent_overdraw) {
+    auto restore = ClipRestoreContents();
+    restore.SetRestoreCoverage(contents.GetCoverage(entity));
+    return restore.Render(renderer, entity, pass);
+  }
+  return true;
+}
+
 }  // namespace impeller
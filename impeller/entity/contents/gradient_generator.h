@@ -11,6 +11,7 @@
 #include "flutter/fml/macros.h"
 #include "flutter/impeller/core/texture.h"
 #include "impeller/core/shader_types.h"
+#include "impeller/entity/entity.h"
 #include "impeller/geometry/color.h"
 #include "impeller/geometry/gradient.h"
 #include "impeller/geometry/path.h"
@@ -18,7 +19,10 @@
 
 namespace impeller {
 
+class ColorSourceContents;
+class ContentContext;
 class Context;
+class RenderPass;
 
 /**
  * @brief Create a host visible texture that contains the gradient defined
@@ -44,4 +48,41 @@ struct StopData {
 std::vector<StopData> CreateGradientColors(const std::vector<Color>& colors,
                                            const std::vector<Scalar>& stops);
 
+/// The kinds of gradient drawn by `uber_gradient_fill.frag`.
+enum class UberGradientKind {
+  kLinear,
+  kRadial,
+  kConical,
+  kSweep,
+};
+
+/// The parameters of a gradient drawn by `uber_gradient_fill.frag`. The
+/// fields that don't apply to the kind of gradient are ignored.
+struct UberGradient {
+  UberGradientKind kind = UberGradientKind::kLinear;
+  /// The start point of linear gradients and the center of the others.
+  Point center;
+  /// The end point of linear gradients and the focus of conical gradients.
+  Point end_point;
+  Scalar radius = 0.0;
+  Scalar focus_radius = 0.0;
+  Scalar bias = 0.0;
+  Scalar scale = 1.0;
+  Entity::TileMode tile_mode = Entity::TileMode::kClamp;
+  Color decal_border_color;
+};
+
+/**
+ * @brief Draw the geometry of the given contents with a gradient sampled from
+ * the gradient texture, using the uber gradient pipeline.
+ *
+ * This must only be used when `ContentContext::UsesUberGradientFill` is true.
+ */
+bool RenderUberGradient(const ContentContext& renderer,
+                        const Entity& entity,
+                        RenderPass& pass,
+                        const ColorSourceContents& contents,
+                        const UberGradient& gradient,
+                        std::shared_ptr<Texture> gradient_texture);
+
 }  // namespace impeller
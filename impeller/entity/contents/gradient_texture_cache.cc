@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/gradient_texture_cache.h"
+
+#include <functional>
+#include <string_view>
+
+#include "impeller/entity/contents/gradient_generator.h"
+
+namespace impeller {
+
+GradientTextureCache::GradientTextureCache(size_t max_entry_count)
+    : max_entry_count_(max_entry_count) {}
+
+GradientTextureCache::~GradientTextureCache() = default;
+
+std::shared_ptr<Texture> GradientTextureCache::GetOrCreateTexture(
+    const GradientData& gradient_data,
+    const std::shared_ptr<Context>& context) {
+  const auto& color_bytes = gradient_data.color_bytes;
+  auto hash = std::hash<std::string_view>{}(std::string_view(
+      reinterpret_cast<const char*>(color_bytes.data()), color_bytes.size()));
+
+  auto found = entries_by_hash_.find(hash);
+  if (found != entries_by_hash_.end()) {
+    auto entry = found->second;
+    if (entry->color_bytes == color_bytes) {
+      entries_.splice(entries_.begin(), entries_, entry);
+      return entry->texture;
+    }
+    // A different ramp with the same hash. Replace it, as the newer one is
+    // more likely to be drawn again.
+    entries_.erase(entry);
+    entries_by_hash_.erase(found);
+  }
+
+  auto texture = CreateGradientTexture(gradient_data, context);
+  if (!texture || max_entry_count_ == 0u) {
+    return texture;
+  }
+
+  if (entries_.size() >= max_entry_count_) {
+    entries_by_hash_.erase(entries_.back().hash);
+    entries_.pop_back();
+  }
+  entries_.push_front(Entry{
+      .hash = hash,
+      .color_bytes = color_bytes,
+      .texture = texture,
+  });
+  entries_by_hash_[hash] = entries_.begin();
+  return texture;
+}
+
+size_t GradientTextureCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+}  // namespace impeller
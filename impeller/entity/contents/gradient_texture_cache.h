@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "impeller/core/texture.h"
+#include "impeller/geometry/gradient.h"
+
+namespace impeller {
+
+class Context;
+
+/// @brief A cache of the textures that gradient ramps are sampled from when
+///        the gradient stops can't be passed to the shader directly.
+///
+///        Textures are keyed on their contents, so a gradient drawn with the
+///        same colors and stops in consecutive frames is only uploaded once.
+///        The least recently used texture is dropped once the cache is full.
+class GradientTextureCache {
+ public:
+  explicit GradientTextureCache(size_t max_entry_count = 64u);
+
+  ~GradientTextureCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief  Returns the texture holding the given gradient ramp, creating
+  ///         and uploading it if it isn't in the cache.
+  ///
+  /// @return The texture, or `nullptr` if one could not be created.
+  ///
+  std::shared_ptr<Texture> GetOrCreateTexture(
+      const GradientData& gradient_data,
+      const std::shared_ptr<Context>& context);
+
+  // visible for testing.
+  size_t GetEntryCount() const;
+
+ private:
+  struct Entry {
+    size_t hash;
+    std::vector<uint8_t> color_bytes;
+    std::shared_ptr<Texture> texture;
+  };
+
+  const size_t max_entry_count_;
+  // Ordered from the most to the least recently used.
+  std::list<Entry> entries_;
+  std::unordered_map<size_t, std::list<Entry>::iterator> entries_by_hash_;
+
+  GradientTextureCache(const GradientTextureCache&) = delete;
+
+  GradientTextureCache& operator=(const GradientTextureCache&) = delete;
+};
+
+}  // namespace impeller
@@ -0,0 +1,48 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/gradient_texture_cache.h"
+#include "impeller/entity/entity_playground.h"
+#include "impeller/geometry/gradient.h"
+#include "impeller/playground/playground_test.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace impeller {
+namespace testing {
+
+using EntityTest = EntityPlayground;
+
+TEST_P(EntityTest, GradientTextureCacheReusesMatchingRamps) {
+  GradientTextureCache cache(2u);
+  auto red_to_blue =
+      CreateGradientBuffer({Color::Red(), Color::Blue()}, {0.0, 1.0});
+  auto red_to_green =
+      CreateGradientBuffer({Color::Red(), Color::Green()}, {0.0, 1.0});
+
+  auto texture = cache.GetOrCreateTexture(red_to_blue, GetContext());
+  ASSERT_NE(texture, nullptr);
+  EXPECT_EQ(cache.GetOrCreateTexture(red_to_blue, GetContext()), texture);
+  EXPECT_NE(cache.GetOrCreateTexture(red_to_green, GetContext()), texture);
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+}
+
+TEST_P(EntityTest, GradientTextureCacheEvictsLeastRecentlyUsedRamp) {
+  GradientTextureCache cache(2u);
+  auto a = CreateGradientBuffer({Color::Red(), Color::Blue()}, {0.0, 1.0});
+  auto b = CreateGradientBuffer({Color::Red(), Color::Green()}, {0.0, 1.0});
+  auto c = CreateGradientBuffer({Color::Red(), Color::White()}, {0.0, 1.0});
+
+  auto texture_a = cache.GetOrCreateTexture(a, GetContext());
+  auto texture_b = cache.GetOrCreateTexture(b, GetContext());
+  // Touch |a| so that |b| is the least recently used.
+  EXPECT_EQ(cache.GetOrCreateTexture(a, GetContext()), texture_a);
+  cache.GetOrCreateTexture(c, GetContext());
+
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+  EXPECT_EQ(cache.GetOrCreateTexture(a, GetContext()), texture_a);
+  EXPECT_NE(cache.GetOrCreateTexture(b, GetContext()), texture_b);
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -9,6 +9,7 @@
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/shader_types.h"
@@ -22,50 +23,19 @@
 
 namespace impeller {
 
-void RuntimeEffectContents::SetRuntimeStage(
-    std::shared_ptr<RuntimeStage> runtime_stage) {
-  runtime_stage_ = std::move(runtime_stage);
-}
-
-void RuntimeEffectContents::SetUniformData(
-    std::shared_ptr<std::vector<uint8_t>> uniform_data) {
-  uniform_data_ = std::move(uniform_data);
-}
-
-void RuntimeEffectContents::SetTextureInputs(
-    std::vector<TextureInput> texture_inputs) {
-  texture_inputs_ = std::move(texture_inputs);
-}
-
-bool RuntimeEffectContents::CanInheritOpacity(const Entity& entity) const {
-  return false;
-}
-
-bool RuntimeEffectContents::Render(const ContentContext& renderer,
-                                   const Entity& entity,
-                                   RenderPass& pass) const {
-// TODO(jonahwilliams): FragmentProgram API is not fully wired up on Android.
-// Disable until this is complete so that integration tests and benchmarks can
-// run m3 applications.
-#ifdef FML_OS_ANDROID
-  return true;
-#else
-
-  auto context = renderer.GetContext();
-  auto library = context->GetShaderLibrary();
-
-  //--------------------------------------------------------------------------
-  /// Get or register shader.
-  ///
-
-  // TODO(113719): Register the shader function earlier.
+/// Returns the fragment function of the runtime stage, registering it with the
+/// shader library first if it is missing or out of date.
+static std::shared_ptr<const ShaderFunction> GetOrRegisterFunction(
+    const Context& context,
+    RuntimeStage& runtime_stage) {
+  auto library = context.GetShaderLibrary();
 
   std::shared_ptr<const ShaderFunction> function = library->GetFunction(
-      runtime_stage_->GetEntrypoint(), ShaderStage::kFragment);
+      runtime_stage.GetEntrypoint(), ShaderStage::kFragment);
 
-  if (function && runtime_stage_->IsDirty()) {
-    context->GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
-    library->UnregisterFunction(runtime_stage_->GetEntrypoint(),
+  if (function && runtime_stage.IsDirty()) {
+    context.GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
+    library->UnregisterFunction(runtime_stage.GetEntrypoint(),
                                 ShaderStage::kFragment);
 
     function = nullptr;
@@ -76,44 +46,41 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
     auto future = promise.get_future();
 
     library->RegisterFunction(
-        runtime_stage_->GetEntrypoint(),
-        ToShaderStage(runtime_stage_->GetShaderStage()),
-        runtime_stage_->GetCodeMapping(),
+        runtime_stage.GetEntrypoint(),
+        ToShaderStage(runtime_stage.GetShaderStage()),
+        runtime_stage.GetCodeMapping(),
         fml::MakeCopyable([promise = std::move(promise)](bool result) mutable {
           promise.set_value(result);
         }));
 
     if (!future.get()) {
       VALIDATION_LOG << "Failed to build runtime effect (entry point: "
-                     << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+                     << runtime_stage.GetEntrypoint() << ")";
+      return nullptr;
     }
 
-    function = library->GetFunction(runtime_stage_->GetEntrypoint(),
+    function = library->GetFunction(runtime_stage.GetEntrypoint(),
                                     ShaderStage::kFragment);
     if (!function) {
       VALIDATION_LOG
           << "Failed to fetch runtime effect function immediately after "
              "registering it (entry point: "
-          << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+          << runtime_stage.GetEntrypoint() << ")";
+      return nullptr;
     }
 
-    runtime_stage_->SetClean();
+    runtime_stage.SetClean();
   }
 
-  //--------------------------------------------------------------------------
-  /// Resolve geometry.
-  ///
-
-  auto geometry_result =
-      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
-
-  //--------------------------------------------------------------------------
-  /// Get or create runtime stage pipeline.
-  ///
+  return function;
+}
 
-  const auto& caps = context->GetCapabilities();
+static PipelineDescriptor CreatePipelineDescriptor(
+    const Context& context,
+    const RuntimeStage& runtime_stage,
+    const ContentContextOptions& options) {
+  auto library = context.GetShaderLibrary();
+  const auto& caps = context.GetCapabilities();
   const auto color_attachment_format = caps->GetDefaultColorFormat();
   const auto stencil_attachment_format = caps->GetDefaultStencilFormat();
 
@@ -122,7 +89,7 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
   desc.SetLabel("Runtime Stage");
   desc.AddStageEntrypoint(
       library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
-  desc.AddStageEntrypoint(library->GetFunction(runtime_stage_->GetEntrypoint(),
+  desc.AddStageEntrypoint(library->GetFunction(runtime_stage.GetEntrypoint(),
                                                ShaderStage::kFragment));
   auto vertex_descriptor = std::make_shared<VertexDescriptor>();
   vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs,
@@ -136,15 +103,103 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
   desc.SetStencilAttachmentDescriptors(stencil0);
   desc.SetStencilPixelFormat(stencil_attachment_format);
 
+  options.ApplyToPipelineDescriptor(desc);
+  return desc;
+}
+
+bool RuntimeEffectContents::BootstrapShader(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<RuntimeStage>& stage) {
+// Runtime effects aren't drawn on Android yet, see |Render|.
+#ifdef FML_OS_ANDROID
+  return true;
+#else
+  TRACE_EVENT0("impeller", "RuntimeEffectContents::BootstrapShader");
+  if (!context || !stage) {
+    return false;
+  }
+  if (!GetOrRegisterFunction(*context, *stage)) {
+    return false;
+  }
+
+  // Most runtime effects fill the onscreen MSAA pass. Starting to create that
+  // pipeline is enough for it to be found in the pipeline library, and thus
+  // in the backend pipeline cache on later launches, when it is first drawn.
+  ContentContextOptions options;
+  options.sample_count = SampleCount::kCount4;
+  options.color_attachment_pixel_format =
+      context->GetCapabilities()->GetDefaultColorFormat();
+  context->GetPipelineLibrary()->GetPipeline(
+      CreatePipelineDescriptor(*context, *stage, options));
+  return true;
+#endif  // FML_OS_ANDROID
+}
+
+void RuntimeEffectContents::SetRuntimeStage(
+    std::shared_ptr<RuntimeStage> runtime_stage) {
+  runtime_stage_ = std::move(runtime_stage);
+}
+
+void RuntimeEffectContents::SetUniformData(
+    std::shared_ptr<std::vector<uint8_t>> uniform_data) {
+  uniform_data_ = std::move(uniform_data);
+}
+
+void RuntimeEffectContents::SetTextureInputs(
+    std::vector<TextureInput> texture_inputs) {
+  texture_inputs_ = std::move(texture_inputs);
+}
+
+bool RuntimeEffectContents::CanInheritOpacity(const Entity& entity) const {
+  return false;
+}
+
+bool RuntimeEffectContents::Render(const ContentContext& renderer,
+                                   const Entity& entity,
+                                   RenderPass& pass) const {
+// TODO(jonahwilliams): FragmentProgram API is not fully wired up on Android.
+// Disable until this is complete so that integration tests and benchmarks can
+// run m3 applications.
+#ifdef FML_OS_ANDROID
+  return true;
+#else
+
+  auto context = renderer.GetContext();
+
+  //--------------------------------------------------------------------------
+  /// Get or register shader.
+  ///
+
+  // This is usually done by |BootstrapShader| when the runtime stage is
+  // loaded, but the stage may have been loaded without it.
+  if (!GetOrRegisterFunction(*context, *runtime_stage_)) {
+    return false;
+  }
+
+  //--------------------------------------------------------------------------
+  /// Resolve geometry.
+  ///
+
+  auto geometry_result =
+      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
+
+  //--------------------------------------------------------------------------
+  /// Get or create runtime stage pipeline.
+  ///
+
+  using VS = RuntimeEffectVertexShader;
+
   auto options = OptionsFromPassAndEntity(pass, entity);
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
   }
   options.primitive_type = geometry_result.type;
-  options.ApplyToPipelineDescriptor(desc);
 
-  auto pipeline = context->GetPipelineLibrary()->GetPipeline(desc).Get();
+  auto pipeline = context->GetPipelineLibrary()
+                      ->GetPipeline(CreatePipelineDescriptor(
+                          *context, *runtime_stage_, options))
+                      .Get();
   if (!pipeline) {
     VALIDATION_LOG << "Failed to get or create runtime effect pipeline.";
     return false;
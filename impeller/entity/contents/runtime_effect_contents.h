@@ -20,6 +20,20 @@ class RuntimeEffectContents final : public ColorSourceContents {
     std::shared_ptr<Texture> texture;
   };
 
+  //----------------------------------------------------------------------------
+  /// @brief      Registers the shader of a runtime stage and starts creating
+  ///             the pipeline it is usually drawn with. This way the first
+  ///             frame that draws with the stage doesn't wait on the driver
+  ///             compiling either.
+  ///
+  ///             This blocks until the shader is registered, so it should be
+  ///             called on a background thread.
+  ///
+  /// @return     Whether the shader could be registered.
+  ///
+  static bool BootstrapShader(const std::shared_ptr<Context>& context,
+                              const std::shared_ptr<RuntimeStage>& stage);
+
   void SetRuntimeStage(std::shared_ptr<RuntimeStage> runtime_stage);
 
   void SetUniformData(std::shared_ptr<std::vector<uint8_t>> uniform_data);
@@ -45,11 +45,30 @@ std::optional<Rect> SolidColorContents::GetCoverage(
   return geometry->GetCoverage(entity.GetTransform());
 };
 
+bool SolidColorContents::CanRenderWithoutMSAA(const Entity& entity) const {
+  auto geometry = GetGeometry();
+  return geometry != nullptr &&
+         geometry->SupportsAnalyticAntiAliasing(entity.GetTransform());
+}
+
 bool SolidColorContents::Render(const ContentContext& renderer,
                                 const Entity& entity,
                                 RenderPass& pass) const {
   auto capture = entity.GetCapture().CreateChild("SolidColorContents");
 
+  // Without MSAA, thin strokes are anti-aliased by the coverage ramp their
+  // geometry computes instead.
+  if (pass.GetSampleCount() == SampleCount::kCount1 &&
+      GetGeometry()->SupportsAnalyticAntiAliasing(entity.GetTransform())) {
+    return RenderWithCoverage(renderer, entity, pass);
+  }
+
+  if (auto stencil_then_cover =
+          GetGeometry()->GetStencilThenCoverBuffers(renderer, entity, pass)) {
+    return RenderStencilThenCover(renderer, entity, pass,
+                                  std::move(stencil_then_cover.value()));
+  }
+
   using VS = SolidFillPipeline::VertexShader;
 
   Command cmd;
@@ -57,7 +76,7 @@ bool SolidColorContents::Render(const ContentContext& renderer,
   cmd.stencil_reference = entity.GetClipDepth();
 
   auto geometry_result =
-      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
+      GetGeometry()->GetPositionBufferForSolidFill(renderer, entity, pass);
 
   auto options = OptionsFromPassAndEntity(pass, entity);
   if (geometry_result.prevent_overdraw) {
@@ -86,6 +105,91 @@ bool SolidColorContents::Render(const ContentContext& renderer,
   return true;
 }
 
+bool SolidColorContents::RenderWithCoverage(const ContentContext& renderer,
+                                            const Entity& entity,
+                                            RenderPass& pass) const {
+  using VS = SolidFillCoveragePipeline::VertexShader;
+
+  auto geometry_result =
+      GetGeometry()->GetPositionCoverageBuffer(renderer, entity, pass);
+  if (geometry_result.vertex_buffer.vertex_count == 0) {
+    return true;
+  }
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "Solid Fill (Coverage)");
+  cmd.stencil_reference = entity.GetClipDepth();
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  options.primitive_type = geometry_result.type;
+  cmd.pipeline = renderer.GetSolidFillCoveragePipeline(options);
+  cmd.BindVertices(std::move(geometry_result.vertex_buffer));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = geometry_result.transform;
+  frame_info.color = GetColor().Premultiply();
+  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
+bool SolidColorContents::RenderStencilThenCover(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    StencilThenCoverResult result) const {
+  // Stencil: count the winding, or the parity, of the path at each pixel.
+  {
+    using VS = ClipPipeline::VertexShader;
+
+    Command cmd;
+    DEBUG_COMMAND_INFO(cmd, "Solid Fill (Stencil)");
+    cmd.stencil_reference = entity.GetClipDepth();
+
+    auto options = OptionsFromPass(pass);
+    options.stencil_compare = CompareFunction::kAlways;
+    if (result.fill_type == FillType::kNonZero) {
+      options.count_stencil_winding = true;
+    } else {
+      options.stencil_operation = StencilOperation::kInvert;
+    }
+    options.primitive_type = result.stencil.type;
+    cmd.pipeline = renderer.GetClipPipeline(options);
+    cmd.BindVertices(std::move(result.stencil.vertex_buffer));
+
+    VS::FrameInfo frame_info;
+    frame_info.mvp = result.stencil.transform;
+    VS::BindFrameInfo(cmd,
+                      pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+    if (!pass.AddCommand(std::move(cmd))) {
+      return false;
+    }
+  }
+
+  // Cover: fill where the stencil is nonzero and reset it to the clip depth
+  // of the entity, which is zero, on the way.
+  using VS = SolidFillPipeline::VertexShader;
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "Solid Fill (Cover)");
+  cmd.stencil_reference = entity.GetClipDepth();
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  options.stencil_compare = CompareFunction::kNotEqual;
+  options.stencil_operation = StencilOperation::kSetToReferenceValue;
+  options.primitive_type = result.cover.type;
+  cmd.pipeline = renderer.GetSolidFillPipeline(options);
+  cmd.BindVertices(std::move(result.cover.vertex_buffer));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = result.cover.transform;
+  frame_info.color = GetColor().Premultiply();
+  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
 std::unique_ptr<SolidColorContents> SolidColorContents::Make(Path path,
                                                              Color color) {
   auto contents = std::make_unique<SolidColorContents>();
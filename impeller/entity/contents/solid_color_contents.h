@@ -42,6 +42,9 @@ class SolidColorContents final : public ColorSourceContents {
   // |Contents|
   std::optional<Rect> GetCoverage(const Entity& entity) const override;
 
+  // |Contents|
+  bool CanRenderWithoutMSAA(const Entity& entity) const override;
+
   // |Contents|
   bool Render(const ContentContext& renderer,
               const Entity& entity,
@@ -57,6 +60,15 @@ class SolidColorContents final : public ColorSourceContents {
  private:
   Color color_;
 
+  bool RenderWithCoverage(const ContentContext& renderer,
+                          const Entity& entity,
+                          RenderPass& pass) const;
+
+  bool RenderStencilThenCover(const ContentContext& renderer,
+                              const Entity& entity,
+                              RenderPass& pass,
+                              StencilThenCoverResult result) const;
+
   SolidColorContents(const SolidColorContents&) = delete;
 
   SolidColorContents& operator=(const SolidColorContents&) = delete;
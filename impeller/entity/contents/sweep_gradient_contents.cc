@@ -8,6 +8,7 @@
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/gradient_generator.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
 #include "impeller/entity/entity.h"
 #include "impeller/geometry/gradient.h"
 #include "impeller/renderer/render_pass.h"
@@ -137,11 +138,23 @@ bool SweepGradientContents::RenderTexture(const ContentContext& renderer,
 
   auto gradient_data = CreateGradientBuffer(colors_, stops_);
   auto gradient_texture =
-      CreateGradientTexture(gradient_data, renderer.GetContext());
+      renderer.GetGradientTextureCache()->GetOrCreateTexture(
+          gradient_data, renderer.GetContext());
   if (gradient_texture == nullptr) {
     return false;
   }
 
+  if (renderer.UsesUberGradientFill()) {
+    return RenderUberGradient(renderer, entity, pass, *this,
+                              {.kind = UberGradientKind::kSweep,
+                               .center = center_,
+                               .bias = bias_,
+                               .scale = scale_,
+                               .tile_mode = tile_mode_,
+                               .decal_border_color = decal_border_color_},
+                              std::move(gradient_texture));
+  }
+
   FS::FragInfo frag_info;
   frag_info.center = center_;
   frag_info.bias = bias_;
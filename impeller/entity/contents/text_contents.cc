@@ -4,11 +4,14 @@
 
 #include "impeller/entity/contents/text_contents.h"
 
+#include <algorithm>
 #include <cstring>
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "impeller/core/device_buffer.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/sampler_descriptor.h"
 #include "impeller/entity/contents/content_context.h"
@@ -25,7 +28,16 @@ TextContents::TextContents() = default;
 TextContents::~TextContents() = default;
 
 void TextContents::SetTextFrame(const std::shared_ptr<TextFrame>& frame) {
-  frame_ = frame;
+  frames_ = {PositionedTextFrame{.frame = frame}};
+}
+
+void TextContents::AddTextFrame(const std::shared_ptr<TextFrame>& frame,
+                                Point position) {
+  frames_.push_back({.frame = frame, .position = position});
+}
+
+size_t TextContents::GetTextFrameCount() const {
+  return frames_.size();
 }
 
 std::shared_ptr<GlyphAtlas> TextContents::ResolveAtlas(
@@ -49,7 +61,20 @@ Color TextContents::GetColor() const {
 }
 
 bool TextContents::CanInheritOpacity(const Entity& entity) const {
-  return !frame_->MaybeHasOverlapping();
+  for (size_t i = 0; i < frames_.size(); i++) {
+    if (frames_[i].frame->MaybeHasOverlapping()) {
+      return false;
+    }
+    const Rect bounds =
+        frames_[i].frame->GetBounds().Shift(frames_[i].position);
+    for (size_t j = 0; j < i; j++) {
+      if (bounds.IntersectsWithRect(
+              frames_[j].frame->GetBounds().Shift(frames_[j].position))) {
+        return false;
+      }
+    }
+  }
+  return true;
 }
 
 void TextContents::SetInheritedOpacity(Scalar opacity) {
@@ -65,13 +90,23 @@ void TextContents::SetForceTextColor(bool value) {
 }
 
 std::optional<Rect> TextContents::GetCoverage(const Entity& entity) const {
-  return frame_->GetBounds().TransformBounds(entity.GetTransform());
+  std::optional<Rect> bounds;
+  for (const PositionedTextFrame& frame : frames_) {
+    bounds = Rect::Union(
+        frame.frame->GetBounds().Shift(offset_ + frame.position), bounds);
+  }
+  if (!bounds.has_value()) {
+    return std::nullopt;
+  }
+  return bounds->TransformBounds(entity.GetTransform());
 }
 
 void TextContents::PopulateGlyphAtlas(
     const std::shared_ptr<LazyGlyphAtlas>& lazy_glyph_atlas,
     Scalar scale) {
-  lazy_glyph_atlas->AddTextFrame(*frame_, scale);
+  for (const PositionedTextFrame& frame : frames_) {
+    lazy_glyph_atlas->AddTextFrame(*frame.frame, scale);
+  }
   scale_ = scale;
 }
 
@@ -83,7 +118,35 @@ bool TextContents::Render(const ContentContext& renderer,
     return true;
   }
 
-  auto type = frame_->GetAtlasType();
+  // Consecutive frames that resolve to the same atlas share a pipeline and
+  // are drawn with one command. A change of atlas type starts a new command
+  // so that frames are still drawn in the order they were added.
+  std::vector<const PositionedTextFrame*> frames;
+  GlyphAtlas::Type frames_type = GlyphAtlas::Type::kAlphaBitmap;
+  for (const PositionedTextFrame& frame : frames_) {
+    auto type = frame.frame->GetAtlasType(scale_);
+    if (!frames.empty() && type != frames_type) {
+      if (!RenderFrames(renderer, entity, pass, frames_type, frames, color)) {
+        return false;
+      }
+      frames.clear();
+    }
+    frames_type = type;
+    frames.push_back(&frame);
+  }
+  if (frames.empty()) {
+    return true;
+  }
+  return RenderFrames(renderer, entity, pass, frames_type, frames, color);
+}
+
+bool TextContents::RenderFrames(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    GlyphAtlas::Type type,
+    const std::vector<const PositionedTextFrame*>& frames,
+    Color color) const {
   auto atlas =
       ResolveAtlas(*renderer.GetContext(), type, renderer.GetLazyGlyphAtlas());
 
@@ -97,10 +160,18 @@ bool TextContents::Render(const ContentContext& renderer,
   DEBUG_COMMAND_INFO(cmd, "TextFrame");
   auto opts = OptionsFromPassAndEntity(pass, entity);
   opts.primitive_type = PrimitiveType::kTriangle;
-  if (type == GlyphAtlas::Type::kAlphaBitmap) {
-    cmd.pipeline = renderer.GetGlyphAtlasPipeline(opts);
-  } else {
-    cmd.pipeline = renderer.GetGlyphAtlasColorPipeline(opts);
+  switch (type) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      cmd.pipeline = renderer.GetGlyphAtlasPipeline(opts);
+      break;
+    case GlyphAtlas::Type::kColorBitmap:
+      cmd.pipeline = force_text_color_
+                         ? renderer.GetGlyphAtlasTextColorPipeline(opts)
+                         : renderer.GetGlyphAtlasColorPipeline(opts);
+      break;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      cmd.pipeline = renderer.GetGlyphAtlasSdfPipeline(opts);
+      break;
   }
   cmd.stencil_reference = entity.GetClipDepth();
 
@@ -113,7 +184,6 @@ bool TextContents::Render(const ContentContext& renderer,
   frame_info.atlas_size =
       Vector2{static_cast<Scalar>(atlas->GetTexture()->GetSize().width),
               static_cast<Scalar>(atlas->GetTexture()->GetSize().height)};
-  frame_info.offset = offset_;
   frame_info.is_translation_scale =
       entity.GetTransform().IsTranslationScaleOnly();
   frame_info.entity_transform = entity.GetTransform();
@@ -121,16 +191,30 @@ bool TextContents::Render(const ContentContext& renderer,
 
   VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
 
-  if (type == GlyphAtlas::Type::kColorBitmap) {
-    using FSS = GlyphAtlasColorPipeline::FragmentShader;
+  if (type == GlyphAtlas::Type::kSignedDistanceField) {
+    // Anti-alias across roughly one device pixel. Glyphs are rasterized at a
+    // fixed size, so the run drawn smallest maps the most atlas pixels to
+    // each device pixel and needs the widest edge.
+    Scalar atlas_pixels_per_pixel = 0;
+    for (const PositionedTextFrame* frame : frames) {
+      for (const TextRun& run : frame->frame->GetRuns()) {
+        const auto point_size = run.GetFont().GetMetrics().point_size;
+        atlas_pixels_per_pixel = std::max(
+            atlas_pixels_per_pixel,
+            TextFrame::ComputeAtlasScale(type, scale_, point_size) / scale_);
+      }
+    }
+    using FSS = GlyphAtlasSdfPipeline::FragmentShader;
     FSS::FragInfo frag_info;
-    frag_info.use_text_color = force_text_color_ ? 1.0 : 0.0;
+    frag_info.smoothing = atlas_pixels_per_pixel /
+                          (4.0f * GlyphAtlas::kSignedDistanceFieldSpread);
     FSS::BindFragInfo(cmd,
                       pass.GetTransientsBuffer().EmplaceUniform(frag_info));
   }
 
   SamplerDescriptor sampler_desc;
-  if (frame_info.is_translation_scale) {
+  if (frame_info.is_translation_scale &&
+      type != GlyphAtlas::Type::kSignedDistanceField) {
     sampler_desc.min_filter = MinMagFilter::kNearest;
     sampler_desc.mag_filter = MinMagFilter::kNearest;
   } else {
@@ -139,6 +223,8 @@ bool TextContents::Render(const ContentContext& renderer,
     // on linear sampling to prevent crunchiness caused by the pixel grid not
     // being perfectly aligned.
     // The downside is that this slightly over-blurs rotated/skewed text.
+    // Signed distance fields are always sampled linearly since the edge is
+    // reconstructed from the interpolated distances.
     sampler_desc.min_filter = MinMagFilter::kLinear;
     sampler_desc.mag_filter = MinMagFilter::kLinear;
   }
@@ -164,56 +250,114 @@ bool TextContents::Render(const ContentContext& renderer,
 
   auto& host_buffer = pass.GetTransientsBuffer();
   size_t vertex_count = 0;
-  for (const auto& run : frame_->GetRuns()) {
-    vertex_count += run.GetGlyphPositions().size();
+  for (const PositionedTextFrame* frame : frames) {
+    for (const auto& run : frame->frame->GetRuns()) {
+      vertex_count += run.GetGlyphPositions().size();
+    }
   }
   vertex_count *= 6;
 
-  auto buffer_view = host_buffer.Emplace(
-      vertex_count * sizeof(VS::PerVertexData), alignof(VS::PerVertexData),
-      [&](uint8_t* contents) {
-        VS::PerVertexData vtx;
-        VS::PerVertexData* vtx_contents =
-            reinterpret_cast<VS::PerVertexData*>(contents);
-        for (const TextRun& run : frame_->GetRuns()) {
-          const Font& font = run.GetFont();
-          Scalar rounded_scale = TextFrame::RoundScaledFontSize(
-              scale_, font.GetMetrics().point_size);
-          const FontGlyphAtlas* font_atlas =
-              atlas->GetFontGlyphAtlas(font, rounded_scale);
-          if (!font_atlas) {
-            VALIDATION_LOG << "Could not find font in the atlas.";
+  // Text that is drawn again with the same frames, scale and atlas layout
+  // reuses the vertices generated the first time. The transform only affects
+  // the uniforms, apart from the scale.
+  const auto& lazy_atlas = renderer.GetLazyGlyphAtlas();
+  TextVertexCacheKey cache_key = {
+      .scale = scale_,
+      .type = type,
+      .atlas_generation = atlas->GetGeneration(),
+  };
+  cache_key.frames.reserve(frames.size());
+  for (const PositionedTextFrame* frame : frames) {
+    cache_key.frames.push_back(
+        {.frame = frame->frame, .position = offset_ + frame->position});
+  }
+
+  // Writes the vertices for all glyphs and returns whether every glyph was
+  // found in the atlas.
+  auto generate_vertices = [&](VS::PerVertexData* vtx_contents) {
+    VS::PerVertexData vtx;
+    bool found_all_glyphs = true;
+    for (const PositionedTextFrame* frame : frames) {
+      vtx.frame_offset = offset_ + frame->position;
+      for (const TextRun& run : frame->frame->GetRuns()) {
+        const Font& font = run.GetFont();
+        Scalar rounded_scale = TextFrame::ComputeAtlasScale(
+            type, scale_, font.GetMetrics().point_size);
+        const FontGlyphAtlas* font_atlas =
+            atlas->GetFontGlyphAtlas(font, rounded_scale);
+        if (!font_atlas) {
+          VALIDATION_LOG << "Could not find font in the atlas.";
+          found_all_glyphs = false;
+          continue;
+        }
+        // Distance field glyphs are stored with a margin that the quads
+        // must cover too.
+        const Scalar glyph_outset =
+            type == GlyphAtlas::Type::kSignedDistanceField
+                ? GlyphAtlas::kSignedDistanceFieldSpread / rounded_scale
+                : 0;
+
+        for (const TextRun::GlyphPosition& glyph_position :
+             run.GetGlyphPositions()) {
+          std::optional<Rect> maybe_atlas_glyph_bounds =
+              font_atlas->FindGlyphBounds(glyph_position.glyph);
+          if (!maybe_atlas_glyph_bounds.has_value()) {
+            VALIDATION_LOG << "Could not find glyph position in the atlas.";
+            found_all_glyphs = false;
             continue;
           }
-
-          for (const TextRun::GlyphPosition& glyph_position :
-               run.GetGlyphPositions()) {
-            std::optional<Rect> maybe_atlas_glyph_bounds =
-                font_atlas->FindGlyphBounds(glyph_position.glyph);
-            if (!maybe_atlas_glyph_bounds.has_value()) {
-              VALIDATION_LOG << "Could not find glyph position in the atlas.";
-              continue;
-            }
-            const Rect& atlas_glyph_bounds = maybe_atlas_glyph_bounds.value();
-            vtx.atlas_glyph_bounds = Vector4(
-                atlas_glyph_bounds.origin.x, atlas_glyph_bounds.origin.y,
-                atlas_glyph_bounds.size.width, atlas_glyph_bounds.size.height);
-            vtx.glyph_bounds = Vector4(glyph_position.glyph.bounds.origin.x,
-                                       glyph_position.glyph.bounds.origin.y,
-                                       glyph_position.glyph.bounds.size.width,
-                                       glyph_position.glyph.bounds.size.height);
-            vtx.glyph_position = glyph_position.position;
-
-            for (const Point& point : unit_points) {
-              vtx.unit_position = point;
-              std::memcpy(vtx_contents++, &vtx, sizeof(VS::PerVertexData));
-            }
+          const Rect& atlas_glyph_bounds = maybe_atlas_glyph_bounds.value();
+          vtx.atlas_glyph_bounds =
+              Vector4(atlas_glyph_bounds.origin.x,
+                      atlas_glyph_bounds.origin.y,
+                      atlas_glyph_bounds.size.width,
+                      atlas_glyph_bounds.size.height);
+          const Rect glyph_bounds =
+              glyph_position.glyph.bounds.Expand(glyph_outset);
+          vtx.glyph_bounds = Vector4(
+              glyph_bounds.origin.x, glyph_bounds.origin.y,
+              glyph_bounds.size.width, glyph_bounds.size.height);
+          vtx.glyph_position = glyph_position.position;
+
+          for (const Point& point : unit_points) {
+            vtx.unit_position = point;
+            std::memcpy(vtx_contents++, &vtx, sizeof(VS::PerVertexData));
           }
         }
-      });
+      }
+    }
+    return found_all_glyphs;
+  };
+
+  std::optional<BufferView> buffer_view;
+  if (vertex_count > 0) {
+    buffer_view = lazy_atlas->FindCachedVertices(cache_key);
+    if (!buffer_view.has_value() &&
+        lazy_atlas->ShouldCacheVertices(cache_key)) {
+      std::vector<VS::PerVertexData> vertices(vertex_count);
+      const bool found_all_glyphs = generate_vertices(vertices.data());
+      auto device_buffer =
+          renderer.GetContext()->GetResourceAllocator()->CreateBufferWithCopy(
+              reinterpret_cast<const uint8_t*>(vertices.data()),
+              vertices.size() * sizeof(VS::PerVertexData));
+      if (device_buffer) {
+        buffer_view = device_buffer->AsBufferView();
+        if (found_all_glyphs) {
+          lazy_atlas->CacheVertices(cache_key, buffer_view.value());
+        }
+      }
+    }
+  }
+  if (!buffer_view.has_value()) {
+    buffer_view = host_buffer.Emplace(
+        vertex_count * sizeof(VS::PerVertexData), alignof(VS::PerVertexData),
+        [&](uint8_t* contents) {
+          generate_vertices(reinterpret_cast<VS::PerVertexData*>(contents));
+        });
+  }
 
   cmd.BindVertices({
-      .vertex_buffer = buffer_view,
+      .vertex_buffer = buffer_view.value(),
       .index_buffer = {},
       .vertex_count = vertex_count,
       .index_type = IndexType::kNone,
@@ -28,6 +28,19 @@ class TextContents final : public Contents {
 
   void SetTextFrame(const std::shared_ptr<TextFrame>& frame);
 
+  //----------------------------------------------------------------------------
+  /// @brief  Append a text frame that is drawn at `position` in the local
+  ///         space of the entity, in addition to any frames already set.
+  ///
+  ///         All frames share the color and transform of these contents, and
+  ///         frames that use the same glyph atlas are drawn with a single
+  ///         command.
+  ///
+  void AddTextFrame(const std::shared_ptr<TextFrame>& frame, Point position);
+
+  /// @brief The number of text frames drawn by these contents.
+  size_t GetTextFrameCount() const;
+
   void SetColor(Color color);
 
   /// @brief Force the text color to apply to the rendered glyphs, even if those
@@ -62,7 +75,12 @@ class TextContents final : public Contents {
               RenderPass& pass) const override;
 
  private:
-  std::shared_ptr<TextFrame> frame_;
+  struct PositionedTextFrame {
+    std::shared_ptr<TextFrame> frame;
+    Point position;
+  };
+
+  std::vector<PositionedTextFrame> frames_;
   Scalar scale_ = 1.0;
   Color color_;
   Scalar inherited_opacity_ = 1.0;
@@ -74,6 +92,13 @@ class TextContents final : public Contents {
       GlyphAtlas::Type type,
       const std::shared_ptr<LazyGlyphAtlas>& lazy_atlas) const;
 
+  bool RenderFrames(const ContentContext& renderer,
+                    const Entity& entity,
+                    RenderPass& pass,
+                    GlyphAtlas::Type type,
+                    const std::vector<const PositionedTextFrame*>& frames,
+                    Color color) const;
+
   TextContents(const TextContents&) = delete;
 
   TextContents& operator=(const TextContents&) = delete;
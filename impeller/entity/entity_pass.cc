@@ -4,6 +4,7 @@
 
 #include "impeller/entity/entity_pass.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <variant>
@@ -44,6 +45,32 @@ std::tuple<std::optional<Color>, BlendMode> ElementAsBackgroundColor(
   }
   return {};
 }
+
+/// Draws a backdrop that was filtered ahead of time for a batch of sibling
+/// subpasses. The snapshot is positioned in the parent pass, like the
+/// backdrop filter contents that it replaces.
+std::shared_ptr<Contents> MakeBackdropFilterBatchContents(
+    const Snapshot& snapshot) {
+  return Contents::MakeAnonymous(
+      [snapshot](const ContentContext& renderer, const Entity& entity,
+                 RenderPass& pass) -> bool {
+        auto snapshot_entity = Entity::FromSnapshot(
+            snapshot, entity.GetBlendMode(), entity.GetClipDepth());
+        if (!snapshot_entity.has_value()) {
+          return true;
+        }
+        snapshot_entity->SetTransform(entity.GetTransform() *
+                                      snapshot.transform);
+        return snapshot_entity->Render(renderer, pass);
+      },
+      [snapshot](const Entity& entity) -> std::optional<Rect> {
+        auto coverage = snapshot.GetCoverage();
+        if (!coverage.has_value()) {
+          return std::nullopt;
+        }
+        return coverage->TransformBounds(entity.GetTransform());
+      });
+}
 }  // namespace
 
 const std::string EntityPass::kCaptureDocumentName = "EntityPass";
@@ -94,6 +121,20 @@ size_t EntityPass::GetSubpassesDepth() const {
   return max_subpass_depth + 1u;
 }
 
+bool EntityPass::CanRenderWithoutMSAA() const {
+  if (elements_.empty() || backdrop_filter_proc_) {
+    return false;
+  }
+  for (const auto& element : elements_) {
+    auto entity = std::get_if<Entity>(&element);
+    if (!entity || !entity->GetContents() ||
+        !entity->GetContents()->CanRenderWithoutMSAA(*entity)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 std::optional<Rect> EntityPass::GetElementsCoverage(
     std::optional<Rect> coverage_limit) const {
   std::optional<Rect> accumulated_coverage;
@@ -247,7 +288,8 @@ static const constexpr RenderTarget::AttachmentConfig kDefaultStencilConfig =
 
 static EntityPassTarget CreateRenderTarget(ContentContext& renderer,
                                            ISize size,
-                                           const Color& clear_color) {
+                                           const Color& clear_color,
+                                           bool enable_msaa = true) {
   auto context = renderer.GetContext();
 
   /// All of the load/store actions are managed by `InlinePassContext` when
@@ -256,7 +298,7 @@ static EntityPassTarget CreateRenderTarget(ContentContext& renderer,
   /// changed for the lifetime of the textures.
 
   RenderTarget target;
-  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+  if (enable_msaa && context->GetCapabilities()->SupportsOffscreenMSAA()) {
     target = RenderTarget::CreateOffscreenMSAA(
         *context,                          // context
         *renderer.GetRenderTargetCache(),  // allocator
@@ -319,6 +361,7 @@ bool EntityPass::Render(ContentContext& renderer,
 
   fml::ScopedCleanupClosure reset_state([&renderer]() {
     renderer.GetLazyGlyphAtlas()->ResetTextFrames();
+    renderer.GetVerticesBufferCache()->EndFrame();
     renderer.GetRenderTargetCache()->End();
   });
 
@@ -466,7 +509,7 @@ bool EntityPass::Render(ContentContext& renderer,
 }
 
 EntityPass::EntityResult EntityPass::GetEntityForElement(
-    const EntityPass::Element& element,
+    size_t element_index,
     ContentContext& renderer,
     Capture& capture,
     InlinePassContext& pass_context,
@@ -474,7 +517,9 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
     Point global_pass_position,
     uint32_t pass_depth,
     ClipCoverageStack& clip_coverage_stack,
-    size_t clip_depth_floor) const {
+    size_t clip_depth_floor,
+    BackdropFilterBatch& backdrop_filter_batch) const {
+  const EntityPass::Element& element = elements_[element_index];
   //--------------------------------------------------------------------------
   /// Setup entity element.
   ///
@@ -528,13 +573,24 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
     }
 
     std::shared_ptr<Contents> subpass_backdrop_filter_contents = nullptr;
-    if (subpass->backdrop_filter_proc_) {
+    const auto& batch_members = backdrop_filter_batch.members;
+    if (subpass->backdrop_filter_proc_ &&
+        backdrop_filter_batch.snapshot.has_value() &&
+        std::find(batch_members.begin(), batch_members.end(), subpass) !=
+            batch_members.end()) {
+      // The backdrop of this subpass was filtered along with the backdrop of
+      // an earlier sibling, and nothing that it samples has been drawn over
+      // since. Draw that result instead of reading the backdrop again.
+      subpass_backdrop_filter_contents =
+          MakeBackdropFilterBatchContents(*backdrop_filter_batch.snapshot);
+    } else if (subpass->backdrop_filter_proc_) {
       auto texture = pass_context.GetTexture();
       // Render the backdrop texture before any of the pass elements.
       const auto& proc = subpass->backdrop_filter_proc_;
-      subpass_backdrop_filter_contents =
+      std::shared_ptr<FilterContents> backdrop_filter =
           proc(FilterInput::Make(std::move(texture)),
                subpass->transform_.Basis(), Entity::RenderingMode::kSubpass);
+      subpass_backdrop_filter_contents = backdrop_filter;
 
       // If the very first thing we render in this EntityPass is a subpass that
       // happens to have a backdrop filter, than that backdrop filter will end
@@ -548,6 +604,33 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
       // rendering the backdrop, so if there's an active pass, end it prior to
       // rendering the subpass.
       pass_context.EndPass();
+
+      backdrop_filter_batch = {};
+      if (subpass->backdrop_filter_key_ && backdrop_filter) {
+        const auto& pass_render_target =
+            pass_context.GetPassTarget().GetRenderTarget();
+        backdrop_filter_batch = CollectBackdropFilterBatch(
+            element_index, *backdrop_filter, root_pass_size,
+            pass_render_target.GetRenderTargetSize(), global_pass_position,
+            clip_coverage_stack);
+      }
+      if (backdrop_filter_batch.members.size() > 1) {
+        // Filter the backdrop of the whole batch at once, while the pass
+        // texture still holds the backdrop that all of the members sample.
+        auto batch_coverage =
+            backdrop_filter_batch.coverage.Shift(-global_pass_position);
+        backdrop_filter_batch.snapshot = backdrop_filter->RenderToSnapshot(
+            renderer,                           // renderer
+            Entity(),                           // entity
+            batch_coverage,                     // coverage_limit
+            std::nullopt,                       // sampler_descriptor
+            true,                               // msaa_enabled
+            "Backdrop Filter Batch Snapshot");  // label
+        if (backdrop_filter_batch.snapshot.has_value()) {
+          subpass_backdrop_filter_contents =
+              MakeBackdropFilterBatchContents(*backdrop_filter_batch.snapshot);
+        }
+      }
     }
 
     if (clip_coverage_stack.empty()) {
@@ -599,9 +682,10 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
     }
 
     auto subpass_target = CreateRenderTarget(
-        renderer,                               // renderer
-        subpass_size,                           // size
-        subpass->GetClearColor(subpass_size));  // clear_color
+        renderer,                              // renderer
+        subpass_size,                          // size
+        subpass->GetClearColor(subpass_size),  // clear_color
+        !subpass->CanRenderWithoutMSAA());     // enable_msaa
 
     if (!subpass_target.IsValid()) {
       VALIDATION_LOG << "Subpass render target is invalid.";
@@ -676,6 +760,100 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
   FML_UNREACHABLE();
 }
 
+EntityPass::BackdropFilterBatch EntityPass::CollectBackdropFilterBatch(
+    size_t element_index,
+    const FilterContents& backdrop_filter,
+    ISize root_pass_size,
+    ISize pass_size,
+    Point global_pass_position,
+    const ClipCoverageStack& clip_coverage_stack) const {
+  BackdropFilterBatch batch;
+  const EntityPass* first_subpass =
+      std::get<std::unique_ptr<EntityPass>>(elements_[element_index]).get();
+  const Matrix effect_transform = first_subpass->transform_.Basis();
+  const auto pass_coverage =
+      Rect::MakeOriginSize(global_pass_position, Size(pass_size))
+          .Intersection(Rect::MakeSize(root_pass_size));
+  if (!pass_coverage.has_value() || clip_coverage_stack.empty()) {
+    return batch;
+  }
+
+  // Replays the clips of the elements that follow against a copy of the
+  // stack, mirroring |RenderElement|, and records the coverage of everything
+  // that they draw to this pass.
+  ClipCoverageStack clip_stack = clip_coverage_stack;
+  std::vector<Rect> drawn_coverage;
+  for (size_t i = element_index; i < elements_.size(); i++) {
+    const auto& element = elements_[i];
+    if (const auto* entity = std::get_if<Entity>(&element)) {
+      auto current_clip_coverage = clip_stack.back().coverage;
+      if (!entity->ShouldRender(current_clip_coverage)) {
+        continue;
+      }
+      auto clip_coverage = entity->GetClipCoverage(current_clip_coverage);
+      switch (clip_coverage.type) {
+        case Contents::ClipCoverage::Type::kNoChange: {
+          auto coverage = Rect::Intersection(entity->GetCoverage(),
+                                             current_clip_coverage);
+          if (coverage.has_value()) {
+            drawn_coverage.push_back(coverage.value());
+          }
+        } break;
+        case Contents::ClipCoverage::Type::kAppend:
+          clip_stack.push_back(
+              ClipCoverageLayer{.coverage = clip_coverage.coverage,
+                                .clip_depth = entity->GetClipDepth() + 1});
+          break;
+        case Contents::ClipCoverage::Type::kRestore:
+          if (clip_stack.back().clip_depth > entity->GetClipDepth()) {
+            clip_stack.resize(entity->GetClipDepth() -
+                              clip_stack.front().clip_depth + 1);
+          }
+          break;
+      }
+      continue;
+    }
+
+    const EntityPass* subpass =
+        std::get<std::unique_ptr<EntityPass>>(element).get();
+    if (subpass->delegate_->CanElide()) {
+      continue;
+    }
+    if (subpass->backdrop_filter_key_ != first_subpass->backdrop_filter_key_ ||
+        subpass->transform_.Basis() != effect_transform) {
+      break;
+    }
+
+    // A subpass with a backdrop filter covers everything within the current
+    // clip, see |GetEntityForElement|.
+    auto coverage =
+        Rect::Intersection(pass_coverage, clip_stack.back().coverage);
+    if (!coverage.has_value()) {
+      continue;
+    }
+    coverage = Rect::RoundOut(coverage.value());
+
+    auto source_coverage = backdrop_filter.GetSourceCoverage(
+        effect_transform, coverage->Shift(-global_pass_position));
+    if (!source_coverage.has_value()) {
+      break;
+    }
+    source_coverage = source_coverage->Shift(global_pass_position);
+    if (std::any_of(drawn_coverage.begin(), drawn_coverage.end(),
+                    [&source_coverage](const Rect& drawn) {
+                      return drawn.IntersectsWithRect(source_coverage.value());
+                    })) {
+      break;
+    }
+
+    batch.coverage = batch.members.empty() ? coverage.value()
+                                           : batch.coverage.Union(*coverage);
+    batch.members.push_back(subpass);
+    drawn_coverage.push_back(coverage.value());
+  }
+  return batch;
+}
+
 bool EntityPass::RenderElement(Entity& element_entity,
                                size_t clip_depth_floor,
                                InlinePassContext& pass_context,
@@ -697,6 +875,8 @@ bool EntityPass::RenderElement(Entity& element_entity,
   // blit the non-MSAA resolve texture of the previous pass to MSAA textures
   // (let alone a transient one).
   if (result.backdrop_texture) {
+    result.pass->SetDefaultScissor(std::nullopt);
+
     // Restore any clips that were recorded before the backdrop filter was
     // applied.
     auto& replay_entities = clip_replay_->GetReplayEntities();
@@ -751,9 +931,15 @@ bool EntityPass::RenderElement(Entity& element_entity,
       break;
     case Contents::ClipCoverage::Type::kAppend: {
       auto op = clip_coverage_stack.back().coverage;
+      // Only |ClipContents| append to the clip stack.
+      auto clip_contents =
+          static_cast<ClipContents*>(element_entity.GetContents().get());
+      bool is_scissor =
+          clip_contents->GetPixelAlignedRect(element_entity).has_value();
       clip_coverage_stack.push_back(
           ClipCoverageLayer{.coverage = clip_coverage.coverage,
-                            .clip_depth = element_entity.GetClipDepth() + 1});
+                            .clip_depth = element_entity.GetClipDepth() + 1,
+                            .is_scissor = is_scissor});
       FML_DCHECK(clip_coverage_stack.back().clip_depth ==
                  clip_coverage_stack.front().clip_depth +
                      clip_coverage_stack.size() - 1);
@@ -763,6 +949,10 @@ bool EntityPass::RenderElement(Entity& element_entity,
         // whole screen is already being clipped, so skip it.
         return true;
       }
+      if (is_scissor) {
+        // The scissor of the entities drawn within this clip applies it.
+        return true;
+      }
     } break;
     case Contents::ClipCoverage::Type::kRestore: {
       if (clip_coverage_stack.back().clip_depth <=
@@ -785,12 +975,21 @@ bool EntityPass::RenderElement(Entity& element_entity,
         // Make the coverage rectangle relative to the current pass.
         restore_coverage->origin -= global_pass_position;
       }
+      bool restores_stencil = std::any_of(
+          clip_coverage_stack.begin() + restoration_index + 1,
+          clip_coverage_stack.end(),
+          [](const ClipCoverageLayer& layer) { return !layer.is_scissor; });
       clip_coverage_stack.resize(restoration_index + 1);
 
       if (!clip_coverage_stack.back().coverage.has_value()) {
         // Running this restore op won't make anything renderable, so skip it.
         return true;
       }
+      if (!restores_stencil) {
+        // Every clip being restored was a scissor, which the entities drawn
+        // from here on no longer get.
+        return true;
+      }
 
       auto restore_contents =
           static_cast<ClipRestoreContents*>(element_entity.GetContents().get());
@@ -810,7 +1009,37 @@ bool EntityPass::RenderElement(Entity& element_entity,
   }
 #endif
 
-  element_entity.SetClipDepth(element_entity.GetClipDepth() - clip_depth_floor);
+  // Scissor clips don't increment the stencil buffer, so the stencil
+  // reference drops by one for each of them beneath the entity, and the
+  // entity is scissored to the current clip coverage instead.
+  size_t scissor_clip_count = 0;
+  for (const auto& layer : clip_coverage_stack) {
+    if (layer.is_scissor && layer.clip_depth <= element_entity.GetClipDepth()) {
+      scissor_clip_count++;
+    }
+  }
+  std::optional<IRect> scissor;
+  auto scissor_coverage = clip_coverage_stack.back().coverage;
+  if (scissor_clip_count > 0 && scissor_coverage.has_value()) {
+    scissor_coverage->origin -= global_pass_position;
+    auto rounded_coverage = Rect::RoundOut(scissor_coverage.value());
+    scissor = IRect::MakeSize(result.pass->GetRenderTargetSize())
+                  .Intersection(IRect::MakeLTRB(
+                      static_cast<int64_t>(rounded_coverage.GetLeft()),
+                      static_cast<int64_t>(rounded_coverage.GetTop()),
+                      static_cast<int64_t>(rounded_coverage.GetRight()),
+                      static_cast<int64_t>(rounded_coverage.GetBottom())));
+  }
+  if (scissor_clip_count > 0 && !scissor.has_value() &&
+      clip_coverage.type == Contents::ClipCoverage::Type::kNoChange) {
+    // Everything this entity draws is scissored away. Clips are still drawn,
+    // unscissored, to keep the recorded clips in step with the clip stack.
+    return true;
+  }
+  result.pass->SetDefaultScissor(scissor);
+
+  element_entity.SetClipDepth(element_entity.GetClipDepth() - clip_depth_floor -
+                              scissor_clip_count);
   clip_replay_->RecordEntity(element_entity, clip_coverage.type);
   if (!element_entity.Render(renderer, *result.pass)) {
     VALIDATION_LOG << "Failed to render entity.";
@@ -875,7 +1104,16 @@ bool EntityPass::OnRender(
                                     // Backdrop filters act as a entity before
                                     // everything and disrupt the optimization.
                                     !backdrop_filter_proc_;
-  for (const auto& element : elements_) {
+  BackdropFilterBatch backdrop_filter_batch;
+  // The coverage of everything drawn to the active pass, which reads of the
+  // pass texture won't see until the pass ends. Only advanced blends without
+  // framebuffer fetch read the pass texture between elements.
+  bool track_active_pass_coverage =
+      !renderer.GetDeviceCapabilities().SupportsFramebufferFetch();
+  std::optional<Rect> active_pass_coverage;
+  for (size_t element_index = 0; element_index < elements_.size();
+       element_index++) {
+    const auto& element = elements_[element_index];
     // Skip elements that are incorporated into the clear color.
     if (is_collapsing_clear_colors) {
       auto [entity_color, _] =
@@ -887,15 +1125,16 @@ bool EntityPass::OnRender(
     }
 
     EntityResult result =
-        GetEntityForElement(element,               // element
-                            renderer,              // renderer
-                            capture,               // capture
-                            pass_context,          // pass_context
-                            root_pass_size,        // root_pass_size
-                            global_pass_position,  // global_pass_position
-                            pass_depth,            // pass_depth
-                            clip_coverage_stack,   // clip_coverage_stack
-                            clip_depth_floor);     // clip_depth_floor
+        GetEntityForElement(element_index,          // element_index
+                            renderer,               // renderer
+                            capture,                // capture
+                            pass_context,           // pass_context
+                            root_pass_size,         // root_pass_size
+                            global_pass_position,   // global_pass_position
+                            pass_depth,             // pass_depth
+                            clip_coverage_stack,    // clip_coverage_stack
+                            clip_depth_floor,       // clip_depth_floor
+                            backdrop_filter_batch);  // backdrop_filter_batch
 
     switch (result.status) {
       case EntityResult::kSuccess:
@@ -908,6 +1147,14 @@ bool EntityPass::OnRender(
         continue;
     };
 
+    if (!pass_context.IsActive()) {
+      active_pass_coverage = std::nullopt;
+    }
+    std::optional<Rect> entity_coverage;
+    if (track_active_pass_coverage) {
+      entity_coverage = result.entity.GetCoverage();
+    }
+
     //--------------------------------------------------------------------------
     /// Setup advanced blends.
     ///
@@ -930,12 +1177,25 @@ bool EntityPass::OnRender(
         // to the render target texture so far need to execute before it's bound
         // for blending (otherwise the blend pass will end up executing before
         // all the previous commands in the active pass).
-
-        if (!pass_context.EndPass()) {
-          VALIDATION_LOG
-              << "Failed to end the current render pass in order to read from "
-                 "the backdrop texture and apply an advanced blend.";
-          return false;
+        //
+        // The pass only needs to end if this blend reads pixels that the
+        // active pass has drawn to, so that a run of advanced blends that
+        // don't overlap each other (or anything else drawn since the last
+        // read) all blend with the same backdrop.
+
+        bool reads_active_pass =
+            !entity_coverage.has_value() ||
+            !pass_context.CanReadTextureWhileActive() ||
+            (active_pass_coverage.has_value() &&
+             active_pass_coverage->IntersectsWithRect(*entity_coverage));
+        if (reads_active_pass) {
+          if (!pass_context.EndPass()) {
+            VALIDATION_LOG << "Failed to end the current render pass in order "
+                              "to read from the backdrop texture and apply an "
+                              "advanced blend.";
+            return false;
+          }
+          active_pass_coverage = std::nullopt;
         }
 
         // Amend an advanced blend filter to the contents, attaching the pass
@@ -967,6 +1227,7 @@ bool EntityPass::OnRender(
       // Specific validation logs are handled in `render_element()`.
       return false;
     }
+    active_pass_coverage = Rect::Union(active_pass_coverage, entity_coverage);
   }
 
 #ifdef IMPELLER_DEBUG
@@ -1078,6 +1339,13 @@ size_t EntityPass::GetElementCount() const {
   return elements_.size();
 }
 
+Entity* EntityPass::GetLastEntity() {
+  if (elements_.empty()) {
+    return nullptr;
+  }
+  return std::get_if<Entity>(&elements_.back());
+}
+
 std::unique_ptr<EntityPass> EntityPass::Clone() const {
   std::vector<Element> new_elements;
   new_elements.reserve(elements_.size());
@@ -1143,13 +1411,15 @@ Color EntityPass::GetClearColor(ISize target_size) const {
   return result.Premultiply();
 }
 
-void EntityPass::SetBackdropFilter(BackdropFilterProc proc) {
+void EntityPass::SetBackdropFilter(BackdropFilterProc proc,
+                                   const void* batch_key) {
   if (superpass_) {
     VALIDATION_LOG << "Backdrop filters cannot be set on EntityPasses that "
                       "have already been appended to another pass.";
   }
 
   backdrop_filter_proc_ = std::move(proc);
+  backdrop_filter_key_ = batch_key;
 }
 
 void EntityPass::SetEnableOffscreenCheckerboard(bool enabled) {
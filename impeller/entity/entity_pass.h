@@ -16,6 +16,7 @@
 #include "impeller/entity/entity_pass_delegate.h"
 #include "impeller/entity/inline_pass_context.h"
 #include "impeller/renderer/render_target.h"
+#include "impeller/renderer/snapshot.h"
 
 namespace impeller {
 
@@ -45,6 +46,9 @@ class EntityPass {
   struct ClipCoverageLayer {
     std::optional<Rect> coverage;
     size_t clip_depth;
+    /// Whether the clip that pushed this layer is applied by scissoring the
+    /// entities above it rather than by incrementing the stencil buffer.
+    bool is_scissor = false;
   };
 
   using ClipCoverageStack = std::vector<ClipCoverageLayer>;
@@ -127,6 +131,14 @@ class EntityPass {
   ///
   size_t GetElementCount() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief  Get the most recently added element if it is an entity.
+  ///
+  /// @return The last entity in this pass, or nullptr if the pass is empty or
+  ///         its last element is a subpass.
+  ///
+  Entity* GetLastEntity();
+
   void SetTransform(Matrix transform);
 
   void SetClipDepth(size_t clip_depth);
@@ -137,7 +149,20 @@ class EntityPass {
 
   Color GetClearColor(ISize size = ISize::Infinite()) const;
 
-  void SetBackdropFilter(BackdropFilterProc proc);
+  //----------------------------------------------------------------------------
+  /// @brief  Sets a filter to apply to the parent pass contents behind this
+  ///         pass before any of its elements are drawn.
+  ///
+  /// @param[in]  proc       Creates the filter for a given backdrop input.
+  /// @param[in]  batch_key  Optional. Sibling passes with the same non-null
+  ///                        key apply the same filter. When nothing drawn
+  ///                        between such siblings overlaps the backdrop that
+  ///                        they sample, the parent reads and filters their
+  ///                        backdrops once over the union of their coverage.
+  ///                        The key must outlive this pass.
+  ///
+  void SetBackdropFilter(BackdropFilterProc proc,
+                         const void* batch_key = nullptr);
 
   void SetEnableOffscreenCheckerboard(bool enabled);
 
@@ -165,6 +190,11 @@ class EntityPass {
   std::optional<Rect> GetElementsCoverage(
       std::optional<Rect> coverage_limit) const;
 
+  /// @brief  Whether every element of this pass is an entity that is
+  ///         anti-aliased without MSAA, so that the pass can be rendered to a
+  ///         single sample render target.
+  bool CanRenderWithoutMSAA() const;
+
  private:
   struct EntityResult {
     enum Status {
@@ -189,6 +219,34 @@ class EntityPass {
     static EntityResult Skip() { return {{}, kSkip}; }
   };
 
+  /// A run of sibling subpasses that share a single filtered read of the
+  /// parent pass backdrop. See |CollectBackdropFilterBatch|.
+  struct BackdropFilterBatch {
+    std::vector<const EntityPass*> members;
+    /// The union of the coverage of the members, in root pass space.
+    Rect coverage;
+    /// The filtered backdrop over |coverage|, in parent pass space.
+    std::optional<Snapshot> snapshot;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief  Collects the subpasses starting at |element_index| that can draw
+  ///         the backdrop filtered by |backdrop_filter| instead of reading
+  ///         the backdrop themselves.
+  ///
+  ///         The clip coverage of the elements that follow is tracked without
+  ///         rendering them. The batch ends at the first subpass with a
+  ///         different backdrop filter, or whose backdrop filter would sample
+  ///         pixels that have been drawn since the backdrop was read.
+  ///
+  BackdropFilterBatch CollectBackdropFilterBatch(
+      size_t element_index,
+      const FilterContents& backdrop_filter,
+      ISize root_pass_size,
+      ISize pass_size,
+      Point global_pass_position,
+      const ClipCoverageStack& clip_coverage_stack) const;
+
   bool RenderElement(Entity& element_entity,
                      size_t clip_depth_floor,
                      InlinePassContext& pass_context,
@@ -197,15 +255,17 @@ class EntityPass {
                      ClipCoverageStack& clip_coverage_stack,
                      Point global_pass_position) const;
 
-  EntityResult GetEntityForElement(const EntityPass::Element& element,
-                                   ContentContext& renderer,
-                                   Capture& capture,
-                                   InlinePassContext& pass_context,
-                                   ISize root_pass_size,
-                                   Point global_pass_position,
-                                   uint32_t pass_depth,
-                                   ClipCoverageStack& clip_coverage_stack,
-                                   size_t clip_depth_floor) const;
+  EntityResult GetEntityForElement(
+      size_t element_index,
+      ContentContext& renderer,
+      Capture& capture,
+      InlinePassContext& pass_context,
+      ISize root_pass_size,
+      Point global_pass_position,
+      uint32_t pass_depth,
+      ClipCoverageStack& clip_coverage_stack,
+      size_t clip_depth_floor,
+      BackdropFilterBatch& backdrop_filter_batch) const;
 
   //----------------------------------------------------------------------------
   /// @brief     OnRender is the internal command recording routine for
@@ -305,6 +365,7 @@ class EntityPass {
   uint32_t GetTotalPassReads(ContentContext& renderer) const;
 
   BackdropFilterProc backdrop_filter_proc_ = nullptr;
+  const void* backdrop_filter_key_ = nullptr;
 
   std::shared_ptr<EntityPassDelegate> delegate_ =
       EntityPassDelegate::MakeDefault();
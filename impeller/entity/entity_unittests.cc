@@ -30,9 +30,12 @@
 #include "impeller/entity/entity_pass.h"
 #include "impeller/entity/entity_pass_delegate.h"
 #include "impeller/entity/entity_playground.h"
+#include "impeller/entity/geometry/circle_mesh_cache.h"
 #include "impeller/entity/geometry/geometry.h"
 #include "impeller/entity/geometry/point_field_geometry.h"
 #include "impeller/entity/geometry/stroke_path_geometry.h"
+#include "impeller/entity/geometry/vertices_buffer_cache.h"
+#include "impeller/entity/geometry/vertices_geometry.h"
 #include "impeller/geometry/color.h"
 #include "impeller/geometry/geometry_asserts.h"
 #include "impeller/geometry/path_builder.h"
@@ -1363,6 +1366,215 @@ TEST_P(EntityTest, DrawAtlasNoColor) {
   ASSERT_TRUE(OpenPlaygroundHere(std::move(e)));
 }
 
+TEST_P(EntityTest, DrawAtlasIsInstancedWithStorageBuffers) {
+  auto atlas = CreateTextureForFixture("bay_bridge.jpg");
+  auto size = atlas->GetSize();
+  Scalar half_width = size.width / 2;
+  Scalar half_height = size.height / 2;
+  std::vector<Rect> texture_coordinates = {
+      Rect::MakeLTRB(0, 0, half_width, half_height),
+      Rect::MakeLTRB(half_width, 0, size.width, half_height),
+      Rect::MakeLTRB(0, half_height, half_width, size.height),
+      Rect::MakeLTRB(half_width, half_height, size.width, size.height)};
+  std::vector<Matrix> transforms = {
+      Matrix::MakeTranslation({0, 0, 0}),
+      Matrix::MakeTranslation({half_width, 0, 0}),
+      Matrix::MakeTranslation({0, half_height, 0}),
+      Matrix::MakeTranslation({half_width, half_height, 0})};
+  std::vector<Color> colors = {Color::Red(), Color::Green(), Color::Blue(),
+                               Color::Yellow()};
+  AtlasContents contents;
+  contents.SetTransforms(std::move(transforms));
+  contents.SetTextureCoordinates(std::move(texture_coordinates));
+  contents.SetTexture(atlas);
+  contents.SetColors(colors);
+  contents.SetBlendMode(BlendMode::kModulate);
+
+  auto content_context = GetContentContext();
+  auto buffer = content_context->GetContext()->CreateCommandBuffer();
+  auto render_target = RenderTarget::CreateOffscreenMSAA(
+      *content_context->GetContext(),
+      *content_context->GetRenderTargetCache(), {100, 100});
+  auto render_pass = buffer->CreateRenderPass(render_target);
+
+  ASSERT_TRUE(contents.Render(*content_context, {}, *render_pass));
+  const std::vector<Command>& commands = render_pass->GetCommands();
+  ASSERT_EQ(commands.size(), 1u);
+  if (GetContext()->GetCapabilities()->SupportsSSBO()) {
+    EXPECT_EQ(commands[0].instance_count, 4u);
+    EXPECT_EQ(commands[0].vertex_buffer.vertex_count, 4u);
+  } else {
+    EXPECT_EQ(commands[0].instance_count, 1u);
+    EXPECT_EQ(commands[0].vertex_buffer.vertex_count, 24u);
+  }
+}
+
+TEST_P(EntityTest, FilledCirclesShareCachedUnitCircleMesh) {
+  auto content_context = GetContentContext();
+  auto buffer = content_context->GetContext()->CreateCommandBuffer();
+  auto render_target = RenderTarget::CreateOffscreen(
+      *content_context->GetContext(),
+      *content_context->GetRenderTargetCache(), {100, 100});
+  auto render_pass = buffer->CreateRenderPass(render_target);
+  auto cache_size = content_context->GetCircleMeshCache()->GetEntryCount();
+
+  // Both radii are tessellated with the same number of divisions.
+  auto first = Geometry::MakeCircle({10, 10}, 10);
+  auto second = Geometry::MakeCircle({50, 40}, 10.5);
+  auto first_result = first->GetPositionBufferForSolidFill(
+      *content_context, {}, *render_pass);
+  auto second_result = second->GetPositionBufferForSolidFill(
+      *content_context, {}, *render_pass);
+
+  EXPECT_EQ(first_result.vertex_buffer.vertex_buffer.buffer,
+            second_result.vertex_buffer.vertex_buffer.buffer);
+  EXPECT_EQ(first_result.vertex_buffer.vertex_count,
+            second_result.vertex_buffer.vertex_count);
+  EXPECT_LE(content_context->GetCircleMeshCache()->GetEntryCount(),
+            cache_size + 1);
+
+  auto ortho = Matrix::MakeOrthographic(render_pass->GetRenderTargetSize());
+  EXPECT_MATRIX_NEAR(second_result.transform,
+                     ortho * Matrix::MakeTranslation({50, 40, 0}) *
+                         Matrix::MakeScale({10.5, 10.5, 1}));
+
+  // Stroked circles are still tessellated for each draw.
+  auto stroked = Geometry::MakeStrokedCircle({10, 10}, 10, 2);
+  auto stroked_result = stroked->GetPositionBufferForSolidFill(
+      *content_context, {}, *render_pass);
+  EXPECT_NE(stroked_result.vertex_buffer.vertex_buffer.buffer,
+            first_result.vertex_buffer.vertex_buffer.buffer);
+}
+
+TEST_P(EntityTest, VerticesWithCacheKeyReuseUploadedBuffers) {
+  auto content_context = GetContentContext();
+  auto buffer = content_context->GetContext()->CreateCommandBuffer();
+  auto render_target = RenderTarget::CreateOffscreen(
+      *content_context->GetContext(),
+      *content_context->GetRenderTargetCache(), {100, 100});
+  auto render_pass = buffer->CreateRenderPass(render_target);
+  auto& cache = *content_context->GetVerticesBufferCache();
+  auto cache_size = cache.GetEntryCount();
+
+  auto make_vertices = [](std::optional<uint64_t> cache_key) {
+    return std::make_shared<VerticesGeometry>(
+        std::vector<Point>{{0, 0}, {10, 0}, {0, 10}},
+        std::vector<uint16_t>{}, std::vector<Point>{}, std::vector<Color>{},
+        Rect::MakeLTRB(0, 0, 10, 10), VerticesGeometry::VertexMode::kTriangles,
+        cache_key);
+  };
+  auto draw = [&](std::optional<uint64_t> cache_key) {
+    return make_vertices(cache_key)
+        ->GetPositionBuffer(*content_context, {}, *render_pass)
+        .vertex_buffer.vertex_buffer.buffer;
+  };
+
+  // Vertices are only cached once they are drawn a second time.
+  auto first = draw(1234u);
+  auto second = draw(1234u);
+  auto third = draw(1234u);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(second, third);
+  EXPECT_EQ(cache.GetEntryCount(), cache_size + 1);
+
+  // Vertices without a key are uploaded on every draw.
+  EXPECT_NE(draw(std::nullopt), draw(std::nullopt));
+  EXPECT_EQ(cache.GetEntryCount(), cache_size + 1);
+
+  // Buffers of vertices that aren't drawn for a frame are dropped.
+  cache.EndFrame();
+  cache.EndFrame();
+  EXPECT_FALSE(cache.Find(1234u, GeometryVertexType::kPosition).has_value());
+}
+
+TEST_P(EntityTest, ThinStrokesUseAnalyticAntiAliasing) {
+  auto path = PathBuilder{}.MoveTo({10, 10}).LineTo({90, 10}).TakePath();
+  auto thin = Geometry::MakeStrokePath(path.Clone(), 1.0, 4.0, Cap::kSquare);
+  auto thick = Geometry::MakeStrokePath(path.Clone(), 10.0);
+
+  EXPECT_TRUE(thin->SupportsAnalyticAntiAliasing({}));
+  EXPECT_FALSE(
+      thin->SupportsAnalyticAntiAliasing(Matrix::MakeScale({4, 4, 1})));
+  EXPECT_FALSE(thick->SupportsAnalyticAntiAliasing({}));
+
+  auto content_context = GetContentContext();
+  auto buffer = content_context->GetContext()->CreateCommandBuffer();
+  auto render_target = RenderTarget::CreateOffscreen(
+      *content_context->GetContext(),
+      *content_context->GetRenderTargetCache(), {100, 100});
+  auto render_pass = buffer->CreateRenderPass(render_target);
+
+  // One segment with both caps is four rows of four vertices joined by
+  // three rows of quads.
+  auto result =
+      thin->GetPositionCoverageBuffer(*content_context, {}, *render_pass);
+  EXPECT_EQ(result.type, PrimitiveType::kTriangle);
+  EXPECT_EQ(result.vertex_buffer.vertex_count, 54u);
+  EXPECT_FALSE(result.prevent_overdraw);
+
+  SolidColorContents contents;
+  contents.SetGeometry(std::move(thin));
+  contents.SetColor(Color::Red());
+  EXPECT_TRUE(contents.CanRenderWithoutMSAA({}));
+  contents.SetGeometry(std::move(thick));
+  EXPECT_FALSE(contents.CanRenderWithoutMSAA({}));
+}
+
+TEST_P(EntityTest, ConcavePathsAreFilledWithStencilThenCover) {
+  auto content_context = GetContentContext();
+  auto buffer = content_context->GetContext()->CreateCommandBuffer();
+  auto render_target = RenderTarget::CreateOffscreen(
+      *content_context->GetContext(),
+      *content_context->GetRenderTargetCache(), {100, 100});
+  auto render_pass = buffer->CreateRenderPass(render_target);
+
+  // A quadrilateral with one reflex vertex. Its polyline repeats the first
+  // point to close it, so the fan has three triangles.
+  auto concave = Geometry::MakeFillPath(PathBuilder{}
+                                            .MoveTo({0, 0})
+                                            .LineTo({50, 20})
+                                            .LineTo({100, 0})
+                                            .LineTo({50, 100})
+                                            .Close()
+                                            .TakePath(FillType::kOdd));
+  Entity entity;
+  auto result = concave->GetStencilThenCoverBuffers(*content_context, entity,
+                                                    *render_pass);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->fill_type, FillType::kOdd);
+  EXPECT_EQ(result->stencil.vertex_buffer.index_type, IndexType::k32bit);
+  EXPECT_EQ(result->stencil.vertex_buffer.vertex_count, 9u);
+  EXPECT_EQ(result->cover.type, PrimitiveType::kTriangleStrip);
+  EXPECT_EQ(result->cover.vertex_buffer.vertex_count, 4u);
+
+  // The stencil counts the winding regardless of clips.
+  entity.SetClipDepth(1);
+  EXPECT_FALSE(concave
+                   ->GetStencilThenCoverBuffers(*content_context, entity,
+                                                *render_pass)
+                   .has_value());
+  entity.SetClipDepth(0);
+
+  // Convex paths and other fill types keep using the tessellator.
+  auto convex = Geometry::MakeFillPath(
+      PathBuilder{}.AddRect(Rect::MakeLTRB(0, 0, 10, 10)).TakePath());
+  EXPECT_FALSE(
+      convex->GetStencilThenCoverBuffers(*content_context, entity,
+                                         *render_pass)
+          .has_value());
+  auto positive = Geometry::MakeFillPath(PathBuilder{}
+                                             .MoveTo({0, 0})
+                                             .LineTo({50, 20})
+                                             .LineTo({100, 0})
+                                             .LineTo({50, 100})
+                                             .Close()
+                                             .TakePath(FillType::kPositive));
+  EXPECT_FALSE(
+      positive->GetStencilThenCoverBuffers(*content_context, entity,
+                                           *render_pass)
+          .has_value());
+}
+
 TEST_P(EntityTest, DrawAtlasWithColorAdvanced) {
   // Draws the image as four squares stiched together.
   auto atlas = CreateTextureForFixture("bay_bridge.jpg");
@@ -1686,6 +1898,37 @@ TEST_P(EntityTest, ClipContentsGetClipCoverageIsCorrect) {
   }
 }
 
+TEST_P(EntityTest, ClipContentsGetPixelAlignedRectIsCorrect) {
+  auto clip = std::make_shared<ClipContents>();
+  clip->SetClipOperation(Entity::ClipOperation::kIntersect);
+  clip->SetGeometry(Geometry::MakeRect(Rect::MakeLTRB(10, 10, 50, 50)));
+
+  Entity entity;
+  entity.SetTransform(Matrix::MakeTranslation({5, 5}));
+  auto rect = clip->GetPixelAlignedRect(entity);
+  ASSERT_TRUE(rect.has_value());
+  ASSERT_RECT_NEAR(rect.value(), Rect::MakeLTRB(15, 15, 55, 55));
+
+  // Lands between pixels.
+  entity.SetTransform(Matrix::MakeTranslation({0.5, 0}));
+  ASSERT_FALSE(clip->GetPixelAlignedRect(entity).has_value());
+
+  // Not axis-aligned.
+  entity.SetTransform(Matrix::MakeRotationZ(Degrees(45)));
+  ASSERT_FALSE(clip->GetPixelAlignedRect(entity).has_value());
+
+  // Differences can't be scissored.
+  entity.SetTransform({});
+  clip->SetClipOperation(Entity::ClipOperation::kDifference);
+  ASSERT_FALSE(clip->GetPixelAlignedRect(entity).has_value());
+
+  // Nor can paths.
+  clip->SetClipOperation(Entity::ClipOperation::kIntersect);
+  clip->SetGeometry(Geometry::MakeFillPath(
+      PathBuilder{}.AddRect(Rect::MakeLTRB(10, 10, 50, 50)).TakePath()));
+  ASSERT_FALSE(clip->GetPixelAlignedRect(entity).has_value());
+}
+
 TEST_P(EntityTest, RRectShadowTest) {
   auto callback = [&](ContentContext& context, RenderPass& pass) {
     static Color color = Color::Red();
@@ -2132,6 +2375,23 @@ TEST_P(EntityTest, RuntimeEffect) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+TEST_P(EntityTest, RuntimeEffectBootstrapRegistersShader) {
+  if (GetParam() != PlaygroundBackend::kMetal) {
+    GTEST_SKIP_("This backend doesn't support runtime effects.");
+  }
+
+  auto runtime_stage =
+      OpenAssetAsRuntimeStage("runtime_stage_example.frag.iplr");
+  ASSERT_TRUE(runtime_stage->IsDirty());
+
+  ASSERT_TRUE(
+      RuntimeEffectContents::BootstrapShader(GetContext(), runtime_stage));
+  ASSERT_FALSE(runtime_stage->IsDirty());
+  ASSERT_NE(GetContext()->GetShaderLibrary()->GetFunction(
+                runtime_stage->GetEntrypoint(), ShaderStage::kFragment),
+            nullptr);
+}
+
 TEST_P(EntityTest, InheritOpacityTest) {
   Entity entity;
 
@@ -2348,6 +2608,16 @@ TEST_P(EntityTest, SweepGradientContentsIsOpaque) {
   ASSERT_FALSE(contents.IsOpaque());
 }
 
+TEST_P(EntityTest, TextureGradientsUseUberPipelineOnOpenGLES) {
+  auto content_context =
+      ContentContext(GetContext(), TypographerContextSkia::Make());
+  ASSERT_TRUE(content_context.IsValid());
+  EXPECT_EQ(content_context.UsesUberGradientFill(),
+            GetContext()->GetBackendType() ==
+                    Context::BackendType::kOpenGLES &&
+                !GetContext()->GetCapabilities()->SupportsSSBO());
+}
+
 TEST_P(EntityTest, TiledTextureContentsIsOpaque) {
   auto bay_bridge = CreateTextureForFixture("bay_bridge.jpg");
   TiledTextureContents contents;
@@ -2518,13 +2788,62 @@ TEST_P(EntityTest, DecalSpecializationAppliedToMorphologyFilter) {
   auto content_context =
       ContentContext(GetContext(), TypographerContextSkia::Make());
 
-  auto default_color_burn = content_context.GetMorphologyFilterPipeline({});
+  auto dilate = content_context.GetMorphologyDilateFilterPipeline({});
+  auto erode = content_context.GetMorphologyErodeFilterPipeline({});
 
   auto decal_supported = static_cast<int32_t>(
       GetContext()->GetCapabilities()->SupportsDecalSamplerAddressMode());
-  std::vector<int32_t> expected_constants = {decal_supported};
-  ASSERT_EQ(default_color_burn->GetDescriptor().GetSpecializationConstants(),
-            expected_constants);
+  std::vector<int32_t> expected_dilate_constants = {decal_supported, 0};
+  ASSERT_EQ(dilate->GetDescriptor().GetSpecializationConstants(),
+            expected_dilate_constants);
+  std::vector<int32_t> expected_erode_constants = {decal_supported, 1};
+  ASSERT_EQ(erode->GetDescriptor().GetSpecializationConstants(),
+            expected_erode_constants);
+}
+
+TEST_P(EntityTest, TextColorSpecializationAppliedToGlyphAtlasColorPipelines) {
+  auto content_context =
+      ContentContext(GetContext(), TypographerContextSkia::Make());
+
+  auto atlas_color = content_context.GetGlyphAtlasColorPipeline({});
+  auto text_color = content_context.GetGlyphAtlasTextColorPipeline({});
+
+  ASSERT_EQ(atlas_color->GetDescriptor().GetSpecializationConstants(),
+            std::vector<int32_t>({0}));
+  ASSERT_EQ(text_color->GetDescriptor().GetSpecializationConstants(),
+            std::vector<int32_t>({1}));
+}
+
+TEST_P(EntityTest, PipelineVariantRecordsCanBeReplayed) {
+  auto content_context =
+      ContentContext(GetContext(), TypographerContextSkia::Make());
+  ASSERT_TRUE(content_context.GetPipelineVariantRecords().empty());
+
+  auto options = ContentContextOptions{
+      .sample_count = SampleCount::kCount1,
+      .blend_mode = BlendMode::kSource,
+      .color_attachment_pixel_format =
+          GetContext()->GetCapabilities()->GetDefaultColorFormat(),
+      .has_stencil_attachment = false};
+  ASSERT_TRUE(content_context.GetSolidFillPipeline(options));
+
+  auto records = content_context.GetPipelineVariantRecords();
+  ASSERT_EQ(records.size(), 1u);
+
+  auto parsed =
+      ParsePipelineVariantRecords(SerializePipelineVariantRecords(records));
+  ASSERT_EQ(parsed.size(), 1u);
+  EXPECT_EQ(parsed[0].prototype, records[0].prototype);
+  EXPECT_TRUE(ContentContextOptions::Equal{}(parsed[0].options, options));
+  EXPECT_TRUE(ParsePipelineVariantRecords("garbage\nSolid\t1 2\n").empty());
+
+  auto replayed = ContentContext(GetContext(), TypographerContextSkia::Make());
+  EXPECT_EQ(replayed.CreatePipelineVariants(parsed), 1u);
+  // Variants that already exist are not created again.
+  EXPECT_EQ(replayed.CreatePipelineVariants(parsed), 0u);
+
+  ASSERT_TRUE(replayed.GetSolidFillPipeline(options));
+  EXPECT_EQ(replayed.GetPipelineVariantRecords().size(), 1u);
 }
 
 }  // namespace testing
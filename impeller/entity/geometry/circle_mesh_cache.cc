@@ -0,0 +1,50 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/circle_mesh_cache.h"
+
+#include <vector>
+
+#include "flutter/fml/logging.h"
+#include "impeller/core/device_buffer.h"
+
+namespace impeller {
+
+CircleMeshCache::CircleMeshCache() = default;
+
+CircleMeshCache::~CircleMeshCache() = default;
+
+BufferView CircleMeshCache::GetUnitCircle(
+    Allocator& allocator,
+    const CircleTessellator& tessellator) {
+  size_t divisions = tessellator.GetQuadrantDivisionCount();
+  if (divisions > kMaxCachedDivisions) {
+    return {};
+  }
+  auto found = unit_circles_.find(divisions);
+  if (found != unit_circles_.end()) {
+    return found->second;
+  }
+
+  std::vector<Point> vertices;
+  vertices.reserve(tessellator.GetCircleVertexCount());
+  tessellator.GenerateCircleTriangleStrip(
+      [&vertices](const Point& p) { vertices.push_back(p); }, {0, 0}, 1.0f);
+  FML_DCHECK(vertices.size() == tessellator.GetCircleVertexCount());
+
+  auto buffer = allocator.CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>(vertices.data()),
+      vertices.size() * sizeof(Point));
+  if (!buffer) {
+    return {};
+  }
+  buffer->SetLabel("Unit Circle Mesh");
+  return unit_circles_[divisions] = buffer->AsBufferView();
+}
+
+size_t CircleMeshCache::GetEntryCount() const {
+  return unit_circles_.size();
+}
+
+}  // namespace impeller
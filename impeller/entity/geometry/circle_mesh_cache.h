@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+
+#include "impeller/core/allocator.h"
+#include "impeller/core/buffer_view.h"
+#include "impeller/tessellator/circle_tessellator.h"
+
+namespace impeller {
+
+/// @brief A cache of device buffers holding the tessellation of a unit circle
+///        centered on the origin, one per quadrant division count, kept
+///        across frames.
+///
+///        Filled circles render by scaling and translating the cached mesh
+///        with their transform instead of generating vertices on every draw.
+class CircleMeshCache {
+ public:
+  /// Circles with more quadrant divisions than this are large enough that
+  /// their tessellation is rarely shared, so they aren't cached.
+  static constexpr size_t kMaxCachedDivisions = 256u;
+
+  CircleMeshCache();
+
+  ~CircleMeshCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief  Returns a vertex buffer holding the triangle strip of a unit
+  ///         circle tessellated with the divisions of the given tessellator,
+  ///         creating it if needed. The vertices are tightly packed points
+  ///         in the order `CircleTessellator::GenerateCircleTriangleStrip`
+  ///         produces them.
+  ///
+  ///         Returns an empty view if there are too many divisions to cache
+  ///         or the buffer couldn't be allocated.
+  ///
+  BufferView GetUnitCircle(Allocator& allocator,
+                           const CircleTessellator& tessellator);
+
+  // visible for testing.
+  size_t GetEntryCount() const;
+
+ private:
+  std::unordered_map<size_t, BufferView> unit_circles_;
+
+  CircleMeshCache(const CircleMeshCache&) = delete;
+
+  CircleMeshCache& operator=(const CircleMeshCache&) = delete;
+};
+
+}  // namespace impeller
@@ -0,0 +1,204 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/convex_shadow.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "impeller/geometry/constants.h"
+#include "impeller/geometry/rect.h"
+
+namespace impeller {
+
+// The rings span this many sigmas on either side of the polygon, beyond which
+// the blur is within a fraction of a percent of opaque or transparent.
+static constexpr Scalar kShadowSigmas = 3.0f;
+
+// The number of rings, including the umbra and the transparent outer ring.
+static constexpr size_t kShadowRingCount = 13u;
+
+// The largest angle that the rings turn through between two points around a
+// corner.
+static constexpr Scalar kShadowMaxArcStep = kPi / 8.0f;
+
+// The coverage of a blurred half-plane at the given signed distance outside
+// of its edge.
+static Scalar BlurredEdgeCoverage(Scalar distance, Sigma sigma) {
+  return 0.5f * std::erfc(distance / (sigma.sigma * kSqrt2));
+}
+
+std::shared_ptr<VerticesGeometry> TessellateConvexShadow(
+    const std::vector<Point>& polygon,
+    Sigma sigma,
+    Color color) {
+  if (sigma.sigma <= kEhCloseEnough) {
+    return nullptr;
+  }
+
+  std::vector<Point> points;
+  points.reserve(polygon.size());
+  for (const auto& point : polygon) {
+    if (points.empty() ||
+        points.back().GetDistanceSquared(point) > kEhCloseEnough) {
+      points.push_back(point);
+    }
+  }
+  while (points.size() > 1u &&
+         points.back().GetDistanceSquared(points.front()) <= kEhCloseEnough) {
+    points.pop_back();
+  }
+  const size_t count = points.size();
+  if (count < 3u) {
+    return nullptr;
+  }
+
+  Scalar area = 0.0f;
+  for (size_t i = 0; i < count; i++) {
+    area += points[i].Cross(points[(i + 1) % count]);
+  }
+  if (std::abs(area) <= kEhCloseEnough) {
+    return nullptr;
+  }
+  const Scalar winding = area > 0.0f ? 1.0f : -1.0f;
+
+  // The outward unit normal of and length of the edge that starts at each
+  // point.
+  std::vector<Point> normals(count);
+  std::vector<Scalar> lengths(count);
+  for (size_t i = 0; i < count; i++) {
+    Point edge = points[(i + 1) % count] - points[i];
+    lengths[i] = edge.GetLength();
+    normals[i] = Point(edge.y, -edge.x) * (winding / lengths[i]);
+  }
+
+  // The angle that the outline turns through at each point. The polygon is
+  // convex if it always turns the same way, and only once around.
+  std::vector<Scalar> turns(count);
+  Scalar total_turn = 0.0f;
+  for (size_t i = 0; i < count; i++) {
+    const Point& in = normals[(i + count - 1) % count];
+    const Point& out = normals[i];
+    Scalar turn = std::atan2(in.Cross(out), in.Dot(out)) * winding;
+    if (turn < -kEhCloseEnough || in.Dot(out) <= -1.0f + kEhCloseEnough) {
+      return nullptr;
+    }
+    turns[i] = std::max(turn, 0.0f);
+    total_turn += turns[i];
+  }
+  if (std::abs(total_turn - 2.0f * kPi) > 0.01f) {
+    return nullptr;
+  }
+
+  // Insetting each edge by the extent of the rings moves its ends along it
+  // by tan(turn / 2) of that extent. The umbra only exists if no edge shrinks
+  // past zero length.
+  const Scalar extent = kShadowSigmas * sigma.sigma;
+  for (size_t i = 0; i < count; i++) {
+    Scalar shrink = extent * (std::tan(turns[i] * 0.5f) +
+                              std::tan(turns[(i + 1) % count] * 0.5f));
+    if (shrink > lengths[i]) {
+      return nullptr;
+    }
+  }
+
+  // Every ring has the same number of points per polygon point so that
+  // consecutive rings can be stitched together with quads. Rings outside of
+  // the polygon follow an arc of normals around each point, and rings on or
+  // inside of it repeat the mitered offset to match.
+  std::vector<Point> miters(count);
+  std::vector<std::vector<Point>> arcs(count);
+  size_t ring_point_count = 0u;
+  for (size_t i = 0; i < count; i++) {
+    const Point& in = normals[(i + count - 1) % count];
+    const Point& out = normals[i];
+    miters[i] = (in + out) / (1.0f + in.Dot(out));
+    if (turns[i] <= kShadowMaxArcStep) {
+      arcs[i].push_back(miters[i]);
+    } else {
+      size_t steps =
+          static_cast<size_t>(std::ceil(turns[i] / kShadowMaxArcStep));
+      for (size_t step = 0; step <= steps; step++) {
+        Scalar angle = turns[i] * winding * step / steps;
+        Scalar cosine = std::cos(angle);
+        Scalar sine = std::sin(angle);
+        arcs[i].push_back(Point(in.x * cosine - in.y * sine,
+                                in.x * sine + in.y * cosine));
+      }
+    }
+    ring_point_count += arcs[i].size();
+  }
+  if (ring_point_count * kShadowRingCount >
+      std::numeric_limits<uint16_t>::max()) {
+    return nullptr;
+  }
+
+  const Scalar max_coverage = BlurredEdgeCoverage(-extent, sigma);
+  const Scalar min_coverage = BlurredEdgeCoverage(extent, sigma);
+  const Color premultiplied = color.Premultiply();
+
+  std::vector<Point> vertices;
+  std::vector<Color> colors;
+  vertices.reserve(ring_point_count * kShadowRingCount);
+  colors.reserve(ring_point_count * kShadowRingCount);
+  std::vector<uint16_t> umbra_indices;
+  umbra_indices.reserve(count);
+  for (size_t ring = 0; ring < kShadowRingCount; ring++) {
+    Scalar distance =
+        -extent + 2.0f * extent * ring / (kShadowRingCount - 1u);
+    if (ring == kShadowRingCount - 1u) {
+      distance = extent;
+    }
+    Scalar coverage = (BlurredEdgeCoverage(distance, sigma) - min_coverage) /
+                      (max_coverage - min_coverage);
+    if (ring == 0u) {
+      coverage = 1.0f;
+    } else if (ring == kShadowRingCount - 1u) {
+      coverage = 0.0f;
+    }
+    Color ring_color = premultiplied * coverage;
+    for (size_t i = 0; i < count; i++) {
+      if (ring == 0u) {
+        umbra_indices.push_back(static_cast<uint16_t>(vertices.size()));
+      }
+      for (const auto& direction : arcs[i]) {
+        vertices.push_back(points[i] +
+                           (distance > 0.0f ? direction : miters[i]) *
+                               distance);
+        colors.push_back(ring_color);
+      }
+    }
+  }
+
+  std::vector<uint16_t> indices;
+  indices.reserve((count - 2u) * 3u +
+                  (kShadowRingCount - 1u) * ring_point_count * 6u);
+  for (size_t i = 1; i + 1 < count; i++) {
+    indices.push_back(umbra_indices[0]);
+    indices.push_back(umbra_indices[i]);
+    indices.push_back(umbra_indices[i + 1]);
+  }
+  for (size_t ring = 0; ring + 1 < kShadowRingCount; ring++) {
+    size_t inner = ring * ring_point_count;
+    size_t outer = inner + ring_point_count;
+    for (size_t j = 0; j < ring_point_count; j++) {
+      size_t next = (j + 1) % ring_point_count;
+      indices.push_back(static_cast<uint16_t>(inner + j));
+      indices.push_back(static_cast<uint16_t>(outer + j));
+      indices.push_back(static_cast<uint16_t>(outer + next));
+      indices.push_back(static_cast<uint16_t>(inner + j));
+      indices.push_back(static_cast<uint16_t>(outer + next));
+      indices.push_back(static_cast<uint16_t>(inner + next));
+    }
+  }
+
+  Rect bounds = Rect::MakePointBounds(vertices.begin(), vertices.end())
+                    .value_or(Rect());
+  return std::make_shared<VerticesGeometry>(
+      std::move(vertices), std::move(indices), std::vector<Point>{},
+      std::move(colors), bounds, VerticesGeometry::VertexMode::kTriangles);
+}
+
+}  // namespace impeller
@@ -0,0 +1,42 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "impeller/entity/geometry/vertices_geometry.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/point.h"
+#include "impeller/geometry/sigma.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Tessellates the shadow that a Gaussian blur of the given
+///             convex polygon would cast, without blurring anything.
+///
+///             The shadow is an opaque umbra inset from the polygon,
+///             surrounded by rings offset in and out of the polygon whose
+///             vertex colors follow the falloff of the blur across a
+///             straight edge. Outside convex corners, the rings are rounded.
+///             This is the approach taken by Skia's shadow utils, and it is
+///             close to a blur everywhere but near sharp corners.
+///
+/// @param[in]  polygon  The points of the polygon, in either winding
+///                      order. The last point may repeat the first.
+/// @param[in]  sigma    The sigma of the blur, in the space of the polygon.
+/// @param[in]  color    The unpremultiplied color of the shadow.
+///
+/// @return     The shadow as triangles with premultiplied vertex colors, or
+///             `nullptr` if the polygon isn't convex or is too narrow for
+///             the umbra to be inset from it.
+///
+std::shared_ptr<VerticesGeometry> TessellateConvexShadow(
+    const std::vector<Point>& polygon,
+    Sigma sigma,
+    Color color);
+
+}  // namespace impeller
@@ -6,6 +6,7 @@
 
 #include "flutter/impeller/entity/geometry/ellipse_geometry.h"
 
+#include "flutter/impeller/entity/geometry/circle_mesh_cache.h"
 #include "flutter/impeller/entity/geometry/line_geometry.h"
 #include "flutter/impeller/tessellator/circle_tessellator.h"
 
@@ -94,6 +95,43 @@ GeometryResult EllipseGeometry::GetPositionBuffer(
   };
 }
 
+// |Geometry|
+GeometryResult EllipseGeometry::GetPositionBufferForSolidFill(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  if (stroke_width_ >= 0) {
+    // The ratio of the inner and outer radii of stroked circles varies, so
+    // their tessellation can't be shared.
+    return GetPositionBuffer(renderer, entity, pass);
+  }
+
+  static_assert(sizeof(SolidFillVertexShader::PerVertexData) == sizeof(Point));
+  std::shared_ptr<Tessellator> tessellator = renderer.GetTessellator();
+  CircleTessellator circle_tessellator(tessellator, entity.GetTransform(),
+                                       radius_);
+  BufferView unit_circle = renderer.GetCircleMeshCache()->GetUnitCircle(
+      *renderer.GetContext()->GetResourceAllocator(), circle_tessellator);
+  if (!unit_circle) {
+    return GetPositionBuffer(renderer, entity, pass);
+  }
+
+  return GeometryResult{
+      .type = PrimitiveType::kTriangleStrip,
+      .vertex_buffer =
+          {
+              .vertex_buffer = std::move(unit_circle),
+              .vertex_count = circle_tessellator.GetCircleVertexCount(),
+              .index_type = IndexType::kNone,
+          },
+      .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransform() *
+                   Matrix::MakeTranslation({center_.x, center_.y, 0.0f}) *
+                   Matrix::MakeScale({radius_, radius_, 1.0f}),
+      .prevent_overdraw = false,
+  };
+}
+
 // |Geometry|
 GeometryResult EllipseGeometry::GetPositionUVBuffer(
     Rect texture_coverage,
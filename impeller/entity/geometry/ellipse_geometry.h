@@ -45,6 +45,11 @@ class EllipseGeometry final : public Geometry {
                                    const Entity& entity,
                                    RenderPass& pass) const override;
 
+  // |Geometry|
+  GeometryResult GetPositionBufferForSolidFill(const ContentContext& renderer,
+                                               const Entity& entity,
+                                               RenderPass& pass) const override;
+
   // |Geometry|
   GeometryVertexType GetVertexType() const override;
 
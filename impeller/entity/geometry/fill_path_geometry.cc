@@ -4,9 +4,68 @@
 
 #include "impeller/entity/geometry/fill_path_geometry.h"
 #include "impeller/core/formats.h"
+#include "impeller/entity/geometry/tessellation_cache.h"
 
 namespace impeller {
 
+// Tessellates the path the same way as uncached paths are, but into a
+// tessellation that outlives the tessellator's buffers.
+static std::optional<TessellationCache::Tessellation> TessellatePath(
+    Tessellator& tessellator,
+    const Path& path,
+    Scalar scale) {
+  TessellationCache::Tessellation tessellation;
+  if (path.GetFillType() == FillType::kNonZero &&  //
+      path.IsConvex()) {
+    tessellation.type = PrimitiveType::kTriangleStrip;
+    tessellation.vertices = tessellator.TessellateConvex(path, scale);
+    return tessellation;
+  }
+
+  auto result = tessellator.Tessellate(
+      path, scale,
+      [&tessellation](const float* vertices, size_t vertices_count,
+                      const uint16_t* indices, size_t indices_count) {
+        tessellation.vertices.reserve(vertices_count);
+        for (auto i = 0u; i < vertices_count * 2; i += 2) {
+          tessellation.vertices.emplace_back(vertices[i], vertices[i + 1]);
+        }
+        if (indices != nullptr) {
+          tessellation.indices.assign(indices, indices + indices_count);
+        }
+        return true;
+      });
+  if (result != Tessellator::Result::kSuccess) {
+    return std::nullopt;
+  }
+  tessellation.type = PrimitiveType::kTriangle;
+  return tessellation;
+}
+
+// Returns the tessellation of a path with a cache key, which is tessellated
+// at the bucketed scale and cached if it isn't in the cache. Returns nullptr
+// if the path can't be cached, in which case it is tessellated every frame.
+static const TessellationCache::Tessellation* GetCachedTessellation(
+    const ContentContext& renderer,
+    const Path& path,
+    Scalar scale) {
+  if (!path.GetCacheKey().has_value()) {
+    return nullptr;
+  }
+  auto& cache = *renderer.GetTessellationCache();
+  if (auto cached = cache.Get(path, scale)) {
+    return cached;
+  }
+  auto tessellation = TessellatePath(
+      *renderer.GetTessellator(), path,
+      TessellationCache::GetBucketedScale(scale));
+  if (!tessellation.has_value()) {
+    return nullptr;
+  }
+  cache.Put(path, scale, std::move(tessellation.value()));
+  return cache.Get(path, scale);
+}
+
 FillPathGeometry::FillPathGeometry(Path path, std::optional<Rect> inner_rect)
     : path_(std::move(path)), inner_rect_(inner_rect) {}
 
@@ -17,6 +76,32 @@ GeometryResult FillPathGeometry::GetPositionBuffer(
   auto& host_buffer = pass.GetTransientsBuffer();
   VertexBuffer vertex_buffer;
 
+  if (auto tessellation = GetCachedTessellation(
+          renderer, path_, entity.GetTransform().GetMaxBasisLength())) {
+    const auto& vertices = tessellation->vertices;
+    const auto& indices = tessellation->indices;
+    vertex_buffer.vertex_buffer = host_buffer.Emplace(
+        vertices.data(), vertices.size() * sizeof(Point), alignof(Point));
+    if (!indices.empty()) {
+      vertex_buffer.index_buffer =
+          host_buffer.Emplace(indices.data(), indices.size() * sizeof(uint16_t),
+                              alignof(uint16_t));
+      vertex_buffer.vertex_count = indices.size();
+      vertex_buffer.index_type = IndexType::k16bit;
+    } else {
+      vertex_buffer.index_buffer = {};
+      vertex_buffer.vertex_count = vertices.size();
+      vertex_buffer.index_type = IndexType::kNone;
+    }
+    return GeometryResult{
+        .type = tessellation->type,
+        .vertex_buffer = vertex_buffer,
+        .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                     entity.GetTransform(),
+        .prevent_overdraw = false,
+    };
+  }
+
   if (path_.GetFillType() == FillType::kNonZero &&  //
       path_.IsConvex()) {
     auto points = renderer.GetTessellator()->TessellateConvex(
@@ -79,6 +164,29 @@ GeometryResult FillPathGeometry::GetPositionUVBuffer(
   auto uv_transform =
       texture_coverage.GetNormalizingTransform() * effect_transform;
 
+  if (auto tessellation = GetCachedTessellation(
+          renderer, path_, entity.GetTransform().GetMaxBasisLength())) {
+    VertexBufferBuilder<VS::PerVertexData> vertex_builder;
+    vertex_builder.Reserve(tessellation->vertices.size());
+    for (const auto& vtx : tessellation->vertices) {
+      VS::PerVertexData data;
+      data.position = vtx;
+      data.texture_coords = uv_transform * vtx;
+      vertex_builder.AppendVertex(data);
+    }
+    for (auto index : tessellation->indices) {
+      vertex_builder.AppendIndex(index);
+    }
+    return GeometryResult{
+        .type = tessellation->type,
+        .vertex_buffer =
+            vertex_builder.CreateVertexBuffer(pass.GetTransientsBuffer()),
+        .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                     entity.GetTransform(),
+        .prevent_overdraw = false,
+    };
+  }
+
   if (path_.GetFillType() == FillType::kNonZero &&  //
       path_.IsConvex()) {
     auto points = renderer.GetTessellator()->TessellateConvex(
@@ -137,6 +245,85 @@ GeometryResult FillPathGeometry::GetPositionUVBuffer(
   };
 }
 
+// |Geometry|
+std::optional<StencilThenCoverResult>
+FillPathGeometry::GetStencilThenCoverBuffers(const ContentContext& renderer,
+                                             const Entity& entity,
+                                             RenderPass& pass) const {
+  // Convex paths are already drawn without libtess and paths with a cache
+  // key reuse their tessellation, so this is for the others.
+  auto fill_type = path_.GetFillType();
+  if ((fill_type != FillType::kNonZero && fill_type != FillType::kOdd) ||
+      path_.IsConvex() || path_.GetCacheKey().has_value() ||
+      entity.GetClipDepth() != 0 || !pass.HasStencilAttachment()) {
+    return std::nullopt;
+  }
+  auto bounds = path_.GetBoundingBox();
+  if (!bounds.has_value()) {
+    return std::nullopt;
+  }
+
+  auto polyline =
+      path_.CreatePolyline(entity.GetTransform().GetMaxBasisLength());
+
+  // Fan each contour out from its first point. Overlapping triangles of the
+  // fan cancel out in the stencil, leaving the winding of the contour.
+  std::vector<uint32_t> indices;
+  indices.reserve(polyline.points->size() * 3);
+  for (size_t i = 0; i < polyline.contours.size(); i++) {
+    auto [start, end] = polyline.GetContourPointBounds(i);
+    for (size_t point_i = start + 1; point_i + 1 < end; point_i++) {
+      indices.push_back(start);
+      indices.push_back(point_i);
+      indices.push_back(point_i + 1);
+    }
+  }
+  if (indices.empty()) {
+    return std::nullopt;
+  }
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+  auto transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransform();
+
+  VertexBuffer stencil_buffer;
+  stencil_buffer.vertex_buffer =
+      host_buffer.Emplace(polyline.points->data(),
+                          polyline.points->size() * sizeof(Point),
+                          alignof(Point));
+  stencil_buffer.index_buffer =
+      host_buffer.Emplace(indices.data(), indices.size() * sizeof(uint32_t),
+                          alignof(uint32_t));
+  stencil_buffer.vertex_count = indices.size();
+  stencil_buffer.index_type = IndexType::k32bit;
+
+  auto cover_points = bounds->GetPoints();
+  VertexBuffer cover_buffer;
+  cover_buffer.vertex_buffer =
+      host_buffer.Emplace(cover_points.data(), 8 * sizeof(float),
+                          alignof(float));
+  cover_buffer.vertex_count = 4;
+  cover_buffer.index_type = IndexType::kNone;
+
+  return StencilThenCoverResult{
+      .stencil =
+          GeometryResult{
+              .type = PrimitiveType::kTriangle,
+              .vertex_buffer = stencil_buffer,
+              .transform = transform,
+              .prevent_overdraw = false,
+          },
+      .cover =
+          GeometryResult{
+              .type = PrimitiveType::kTriangleStrip,
+              .vertex_buffer = cover_buffer,
+              .transform = transform,
+              .prevent_overdraw = false,
+          },
+      .fill_type = fill_type,
+  };
+}
+
 GeometryVertexType FillPathGeometry::GetVertexType() const {
   return GeometryVertexType::kPosition;
 }
@@ -28,6 +28,12 @@ class FillPathGeometry final : public Geometry {
                                    const Entity& entity,
                                    RenderPass& pass) const override;
 
+  // |Geometry|
+  std::optional<StencilThenCoverResult> GetStencilThenCoverBuffers(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass) const override;
+
   // |Geometry|
   GeometryVertexType GetVertexType() const override;
 
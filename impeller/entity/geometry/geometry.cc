@@ -129,6 +129,31 @@ std::shared_ptr<Geometry> Geometry::MakeStrokedCircle(Point center,
   return std::make_shared<EllipseGeometry>(center, radius, stroke_width);
 }
 
+GeometryResult Geometry::GetPositionBufferForSolidFill(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  return GetPositionBuffer(renderer, entity, pass);
+}
+
+std::optional<StencilThenCoverResult> Geometry::GetStencilThenCoverBuffers(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  return std::nullopt;
+}
+
+bool Geometry::SupportsAnalyticAntiAliasing(const Matrix& transform) const {
+  return false;
+}
+
+GeometryResult Geometry::GetPositionCoverageBuffer(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  return {};
+}
+
 bool Geometry::CoversArea(const Matrix& transform, const Rect& rect) const {
   return false;
 }
@@ -22,6 +22,18 @@ struct GeometryResult {
   bool prevent_overdraw;
 };
 
+/// @brief The two draws of a path filled with stencil-then-cover.
+struct StencilThenCoverResult {
+  /// Triangle fans of the contours of the path. Drawn into the stencil
+  /// buffer, they leave the winding of the path at each pixel, or its parity
+  /// for even-odd fills.
+  GeometryResult stencil;
+  /// A rectangle that covers the path, drawn where the stencil is nonzero.
+  GeometryResult cover;
+  /// Either `FillType::kNonZero` or `FillType::kOdd`.
+  FillType fill_type;
+};
+
 enum GeometryVertexType {
   kPosition,
   kColor,
@@ -82,6 +94,48 @@ class Geometry {
                                            const Entity& entity,
                                            RenderPass& pass) const = 0;
 
+  /// @brief    Like `GetPositionBuffer`, for contents that only use the
+  ///           vertex positions to place the geometry with the transform of
+  ///           the result, like solid fills and clips.
+  ///
+  ///           The vertices don't have to be in the local space of the
+  ///           geometry, which lets geometries return meshes that are shared
+  ///           between draws and folded into place by the transform. The
+  ///           default implementation returns `GetPositionBuffer`.
+  virtual GeometryResult GetPositionBufferForSolidFill(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass) const;
+
+  /// @brief    Returns the draws to fill this geometry through the stencil
+  ///           buffer instead of triangulating it on the CPU, or
+  ///           `std::nullopt` if it should be drawn with `GetPositionBuffer`.
+  ///
+  ///           The stencil draw must count the winding of the triangles
+  ///           regardless of the clip, so this is only offered for entities
+  ///           that aren't clipped.
+  virtual std::optional<StencilThenCoverResult> GetStencilThenCoverBuffers(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass) const;
+
+  /// @brief    Whether `GetPositionCoverageBuffer` can render this geometry
+  ///           anti-aliased under the given transform, so that it doesn't
+  ///           need a multisampled render target.
+  virtual bool SupportsAnalyticAntiAliasing(const Matrix& transform) const;
+
+  /// @brief    Returns vertices with a position and a coverage in [0, 1],
+  ///           which ramps down to zero over the last device pixel at the
+  ///           edges of the geometry. The vertices are in the layout of
+  ///           `SolidFillCoverageVertexShader::PerVertexData`.
+  ///
+  ///           Only valid if `SupportsAnalyticAntiAliasing` returns true for
+  ///           the entity transform.
+  virtual GeometryResult GetPositionCoverageBuffer(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass) const;
+
   virtual GeometryResult GetPositionUVBuffer(Rect texture_coverage,
                                              Matrix effect_transform,
                                              const ContentContext& renderer,
@@ -3,7 +3,10 @@
 // found in the LICENSE file.
 
 #include "flutter/testing/testing.h"
+#include "impeller/entity/geometry/convex_shadow.h"
 #include "impeller/entity/geometry/geometry.h"
+#include "impeller/entity/geometry/tessellation_cache.h"
+#include "impeller/geometry/geometry_asserts.h"
 #include "impeller/geometry/path_builder.h"
 
 namespace impeller {
@@ -62,5 +65,82 @@ TEST(EntityGeometryTest, LineGeometryCoverage) {
   }
 }
 
+TEST(EntityGeometryTest, ConvexShadowCoversPenumbra) {
+  std::vector<Point> square = {{0, 0}, {100, 0}, {100, 100}, {0, 100}};
+  auto shadow = TessellateConvexShadow(square, Sigma(2), Color::Red());
+  ASSERT_NE(shadow, nullptr);
+  EXPECT_TRUE(shadow->HasVertexColors());
+  EXPECT_RECT_NEAR(shadow->GetCoverage({}).value(),
+                   Rect::MakeLTRB(-6, -6, 106, 106));
+
+  // The winding order and a repeated closing point don't matter.
+  std::vector<Point> reversed = {{0, 0}, {0, 100}, {100, 100}, {100, 0}, {0, 0}};
+  shadow = TessellateConvexShadow(reversed, Sigma(2), Color::Red());
+  ASSERT_NE(shadow, nullptr);
+  EXPECT_RECT_NEAR(shadow->GetCoverage({}).value(),
+                   Rect::MakeLTRB(-6, -6, 106, 106));
+}
+
+TEST(EntityGeometryTest, ConvexShadowRejectsUnsupportedPolygons) {
+  std::vector<Point> concave = {{0, 0},    {100, 0}, {100, 100},
+                                {50, 100}, {50, 50}, {0, 50}};
+  EXPECT_EQ(TessellateConvexShadow(concave, Sigma(2), Color::Red()), nullptr);
+
+  // The umbra can't be inset from a square narrower than the penumbra.
+  std::vector<Point> narrow = {{0, 0}, {10, 0}, {10, 10}, {0, 10}};
+  EXPECT_EQ(TessellateConvexShadow(narrow, Sigma(5), Color::Red()), nullptr);
+
+  std::vector<Point> line = {{0, 0}, {10, 0}, {20, 0}};
+  EXPECT_EQ(TessellateConvexShadow(line, Sigma(2), Color::Red()), nullptr);
+}
+
+TEST(EntityGeometryTest, TessellationCacheBucketsScales) {
+  EXPECT_EQ(TessellationCache::GetBucketedScale(0), 0);
+  EXPECT_EQ(TessellationCache::GetBucketedScale(1), 1);
+  EXPECT_EQ(TessellationCache::GetBucketedScale(2), 2);
+  EXPECT_NEAR(TessellationCache::GetBucketedScale(1.1), kSqrt2, 1e-5);
+  EXPECT_NEAR(TessellationCache::GetBucketedScale(1.5), 2, 1e-5);
+}
+
+TEST(EntityGeometryTest, TessellationCacheOnlyCachesPathsWithKeys) {
+  TessellationCache cache;
+  auto path = PathBuilder{}.AddCircle({50, 50}, 25).TakePath();
+  cache.Put(path, 1, {.vertices = {{0, 0}, {1, 0}, {1, 1}}});
+  EXPECT_EQ(cache.GetEntryCount(), 0u);
+  EXPECT_EQ(cache.Get(path, 1), nullptr);
+
+  auto keyed_path =
+      PathBuilder{}.AddCircle({50, 50}, 25).SetCacheKey(1).TakePath();
+  cache.Put(keyed_path, 1, {.vertices = {{0, 0}, {1, 0}, {1, 1}}});
+  EXPECT_EQ(cache.GetEntryCount(), 1u);
+  ASSERT_NE(cache.Get(keyed_path, 1), nullptr);
+  EXPECT_EQ(cache.Get(keyed_path, 1)->vertices.size(), 3u);
+
+  // Scales in the same bucket share a tessellation.
+  EXPECT_NE(cache.Get(keyed_path, 0.8), nullptr);
+  EXPECT_EQ(cache.Get(keyed_path, 2), nullptr);
+}
+
+TEST(EntityGeometryTest, TessellationCacheEvictsLeastRecentlyUsed) {
+  TessellationCache cache(2 * 3 * sizeof(Point));
+  auto path_a = PathBuilder{}.AddCircle({0, 0}, 1).SetCacheKey(1).TakePath();
+  auto path_b = PathBuilder{}.AddCircle({0, 0}, 1).SetCacheKey(2).TakePath();
+  auto path_c = PathBuilder{}.AddCircle({0, 0}, 1).SetCacheKey(3).TakePath();
+  TessellationCache::Tessellation triangle = {
+      .vertices = {{0, 0}, {1, 0}, {1, 1}}};
+
+  cache.Put(path_a, 1, triangle);
+  cache.Put(path_b, 1, triangle);
+  EXPECT_EQ(cache.GetByteSize(), 2 * 3 * sizeof(Point));
+
+  // Using the first path makes the second the least recently used.
+  EXPECT_NE(cache.Get(path_a, 1), nullptr);
+  cache.Put(path_c, 1, triangle);
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+  EXPECT_NE(cache.Get(path_a, 1), nullptr);
+  EXPECT_EQ(cache.Get(path_b, 1), nullptr);
+  EXPECT_NE(cache.Get(path_c, 1), nullptr);
+}
+
 }  // namespace testing
 }  // namespace impeller
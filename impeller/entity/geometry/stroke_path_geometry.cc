@@ -240,9 +240,18 @@ StrokePathGeometry::CreateSolidStrokeVertices(
   // 512 is an arbitrary choice that should be big enough for most paths without
   // needing to reallocate. If we have motivating benchmarks we should raise or
   // lower this number, cause dnfield just made it up!
-  point_buffer->reserve(512);
+  //
+  // Long polylines (e.g. charts) need at least one point per linear component,
+  // so reserve that up front instead of growing the buffer repeatedly.
+  point_buffer->reserve(std::max<size_t>(
+      512u, path.GetComponentCount(Path::ComponentType::kLinear) +
+                path.GetComponentCount(Path::ComponentType::kContour)));
   auto polyline = path.CreatePolyline(scale, std::move(point_buffer));
 
+  // Each polyline segment emits four vertices. Joins and caps add a few more
+  // per contour, which is fine to grow into.
+  vtx_builder.Reserve(polyline.points->size() * 4);
+
   VS::PerVertexData vtx;
 
   // Offset state.
@@ -500,6 +509,161 @@ GeometryResult StrokePathGeometry::GetPositionUVBuffer(
   };
 }
 
+bool StrokePathGeometry::SupportsAnalyticAntiAliasing(
+    const Matrix& transform) const {
+  if (stroke_width_ < 0.0 || transform.HasPerspective() ||
+      transform.GetDeterminant() == 0) {
+    return false;
+  }
+  return stroke_width_ * transform.GetMaxBasisLength() <=
+         kMaxAnalyticAntiAliasingWidth;
+}
+
+// Each segment of the stroke is drawn as rows of four vertices across it: an
+// outer fringe vertex with zero coverage, two core vertices with full
+// coverage and another fringe vertex on the other side. The coverage is
+// interpolated over one device pixel centered on the edge of the stroke. The
+// ends of open contours get one more row past the end so that caps are
+// anti-aliased too. Joins are left to the overlap of adjacent segments, which
+// is invisible at the widths this is used for.
+VertexBufferBuilder<SolidFillCoverageVertexShader::PerVertexData, uint32_t>
+StrokePathGeometry::CreateCoverageStrokeVertices(const Path& path,
+                                                 Scalar stroke_width,
+                                                 Cap stroke_cap,
+                                                 Scalar scale) {
+  using PerVertexData = SolidFillCoverageVertexShader::PerVertexData;
+  VertexBufferBuilder<PerVertexData, uint32_t> vtx_builder;
+  auto polyline = path.CreatePolyline(scale);
+
+  // Hairlines (a stroke width of zero) are a single device pixel wide and
+  // thinner strokes are drawn that wide, with a coverage that makes up for
+  // it.
+  Scalar device_width = stroke_width * scale;
+  Scalar core_coverage =
+      stroke_width == 0 ? 1.0f : std::min(device_width, 1.0f);
+  device_width = std::max(device_width, 1.0f);
+  Scalar core_half_width = (device_width * 0.5f - 0.5f) / scale;
+  Scalar fringe_half_width = (device_width * 0.5f + 0.5f) / scale;
+  Scalar half_pixel = 0.5f / scale;
+  Scalar cap_extent =
+      stroke_cap == Cap::kButt ? 0.0f : device_width * 0.5f / scale;
+
+  vtx_builder.Reserve(polyline.points->size() * 8);
+  vtx_builder.ReserveIndices(polyline.points->size() * 18);
+
+  auto append_row = [&vtx_builder, core_half_width, fringe_half_width](
+                        Point center, Vector2 normal, Scalar coverage) {
+    vtx_builder.AppendVertex(PerVertexData{
+        .position = center - normal * fringe_half_width, .coverage = 0.0f});
+    vtx_builder.AppendVertex(PerVertexData{
+        .position = center - normal * core_half_width, .coverage = coverage});
+    vtx_builder.AppendVertex(PerVertexData{
+        .position = center + normal * core_half_width, .coverage = coverage});
+    vtx_builder.AppendVertex(PerVertexData{
+        .position = center + normal * fringe_half_width, .coverage = 0.0f});
+  };
+  // Connects the last two rows with three quads.
+  auto connect_rows = [&vtx_builder]() {
+    auto row = static_cast<uint32_t>(vtx_builder.GetVertexCount() - 8);
+    for (uint32_t i = 0; i < 3; i++) {
+      uint32_t a = row + i;
+      uint32_t b = row + 4 + i;
+      vtx_builder.AppendIndex(a);
+      vtx_builder.AppendIndex(a + 1);
+      vtx_builder.AppendIndex(b);
+      vtx_builder.AppendIndex(a + 1);
+      vtx_builder.AppendIndex(b + 1);
+      vtx_builder.AppendIndex(b);
+    }
+  };
+  auto add_segment = [&](Point p0, Point p1, Vector2 direction,
+                         bool is_start, bool is_end) {
+    Vector2 normal = {-direction.y, direction.x};
+    if (is_start) {
+      p0 = p0 - direction * cap_extent;
+      append_row(p0 - direction * half_pixel, normal, 0.0f);
+      append_row(p0 + direction * half_pixel, normal, core_coverage);
+      connect_rows();
+    } else {
+      append_row(p0, normal, core_coverage);
+    }
+    if (is_end) {
+      p1 = p1 + direction * cap_extent;
+      append_row(p1 - direction * half_pixel, normal, core_coverage);
+      connect_rows();
+      append_row(p1 + direction * half_pixel, normal, 0.0f);
+    } else {
+      append_row(p1, normal, core_coverage);
+    }
+    connect_rows();
+  };
+
+  for (size_t contour_i = 0; contour_i < polyline.contours.size();
+       contour_i++) {
+    const auto& contour = polyline.contours[contour_i];
+    auto [start_i, end_i] = polyline.GetContourPointBounds(contour_i);
+    if (end_i <= start_i) {
+      continue;
+    }
+    bool has_caps = !contour.is_closed;
+
+    // Single points only draw anything with square or round caps.
+    if (end_i - start_i == 1) {
+      if (has_caps && stroke_cap != Cap::kButt) {
+        Vector2 direction = contour.start_direction.IsZero()
+                                ? Vector2{1, 0}
+                                : -contour.start_direction;
+        Point point = polyline.GetPoint(start_i);
+        add_segment(point, point, direction, true, true);
+      }
+      continue;
+    }
+
+    // Find the last segment that isn't degenerate so that its end gets the
+    // cap.
+    size_t last_i = end_i - 1;
+    while (last_i > start_i &&
+           polyline.GetPoint(last_i) == polyline.GetPoint(last_i - 1)) {
+      last_i--;
+    }
+    bool is_first = true;
+    for (size_t point_i = start_i + 1; point_i <= last_i; point_i++) {
+      Point p0 = polyline.GetPoint(point_i - 1);
+      Point p1 = polyline.GetPoint(point_i);
+      if (p0 == p1) {
+        continue;
+      }
+      add_segment(p0, p1, (p1 - p0).Normalize(), has_caps && is_first,
+                  has_caps && point_i == last_i);
+      is_first = false;
+    }
+  }
+
+  return vtx_builder;
+}
+
+GeometryResult StrokePathGeometry::GetPositionCoverageBuffer(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  if (!SupportsAnalyticAntiAliasing(entity.GetTransform())) {
+    return {};
+  }
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+  auto vertex_builder =
+      CreateCoverageStrokeVertices(path_, stroke_width_, stroke_cap_,
+                                   entity.GetTransform().GetMaxBasisLength());
+
+  return GeometryResult{
+      .type = PrimitiveType::kTriangle,
+      .vertex_buffer = vertex_builder.CreateVertexBuffer(host_buffer),
+      .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransform(),
+      .prevent_overdraw = false,
+  };
+}
+
 GeometryVertexType StrokePathGeometry::GetVertexType() const {
   return GeometryVertexType::kPosition;
 }
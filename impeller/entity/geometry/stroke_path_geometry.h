@@ -27,6 +27,18 @@ class StrokePathGeometry final : public Geometry {
 
   Join GetStrokeJoin() const;
 
+  /// Strokes at most this many device pixels wide are drawn with analytic
+  /// anti-aliasing when the render target isn't multisampled.
+  static constexpr Scalar kMaxAnalyticAntiAliasingWidth = 2.0f;
+
+  // |Geometry|
+  bool SupportsAnalyticAntiAliasing(const Matrix& transform) const override;
+
+  // |Geometry|
+  GeometryResult GetPositionCoverageBuffer(const ContentContext& renderer,
+                                           const Entity& entity,
+                                           RenderPass& pass) const override;
+
  private:
   using VS = SolidFillVertexShader;
 
@@ -78,6 +90,13 @@ class StrokePathGeometry final : public Geometry {
                             const CapProc& cap_proc,
                             Scalar scale);
 
+  static VertexBufferBuilder<SolidFillCoverageVertexShader::PerVertexData,
+                             uint32_t>
+  CreateCoverageStrokeVertices(const Path& path,
+                               Scalar stroke_width,
+                               Cap stroke_cap,
+                               Scalar scale);
+
   static StrokePathGeometry::JoinProc GetJoinProc(Join stroke_join);
 
   static StrokePathGeometry::CapProc GetCapProc(Cap stroke_cap);
@@ -0,0 +1,126 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/tessellation_cache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/logging.h"
+
+namespace impeller {
+
+// Buckets are half an octave of scale wide, so paths are never tessellated at
+// more than about 1.41 times the scale they are drawn at.
+static constexpr Scalar kBucketsPerOctave = 2.0f;
+static constexpr int32_t kMaxScaleBucket = 32;
+
+// Paths drawn at a scale of zero are tessellated into straight lines, so all
+// of them share a bucket.
+static constexpr int32_t kZeroScaleBucket = std::numeric_limits<int32_t>::min();
+
+static int32_t GetScaleBucket(Scalar scale) {
+  if (!(scale > 0.0f)) {
+    return kZeroScaleBucket;
+  }
+  auto bucket = std::ceil(std::log2(scale) * kBucketsPerOctave);
+  return static_cast<int32_t>(std::clamp(
+      bucket, static_cast<Scalar>(-kMaxScaleBucket),
+      static_cast<Scalar>(kMaxScaleBucket)));
+}
+
+size_t TessellationCache::Tessellation::GetByteSize() const {
+  return vertices.size() * sizeof(Point) + indices.size() * sizeof(uint16_t);
+}
+
+std::size_t TessellationCache::Key::Hash::operator()(const Key& key) const {
+  return fml::HashCombine(key.path_key, static_cast<int>(key.fill_type),
+                          key.scale_bucket);
+}
+
+bool TessellationCache::Key::Equal::operator()(const Key& lhs,
+                                               const Key& rhs) const {
+  return lhs.path_key == rhs.path_key && lhs.fill_type == rhs.fill_type &&
+         lhs.scale_bucket == rhs.scale_bucket;
+}
+
+TessellationCache::TessellationCache(size_t max_byte_size)
+    : max_byte_size_(max_byte_size) {}
+
+TessellationCache::~TessellationCache() = default;
+
+Scalar TessellationCache::GetBucketedScale(Scalar scale) {
+  auto bucket = GetScaleBucket(scale);
+  if (bucket == kZeroScaleBucket) {
+    return 0.0f;
+  }
+  return std::max(std::exp2(bucket / kBucketsPerOctave), scale);
+}
+
+TessellationCache::Key TessellationCache::MakeKey(const Path& path,
+                                                  Scalar scale) {
+  FML_DCHECK(path.GetCacheKey().has_value());
+  return Key{
+      .path_key = path.GetCacheKey().value_or(0u),
+      .fill_type = path.GetFillType(),
+      .scale_bucket = GetScaleBucket(scale),
+  };
+}
+
+const TessellationCache::Tessellation* TessellationCache::Get(
+    const Path& path,
+    Scalar scale) {
+  if (!path.GetCacheKey().has_value()) {
+    return nullptr;
+  }
+  auto found = entries_by_key_.find(MakeKey(path, scale));
+  if (found == entries_by_key_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return &found->second->tessellation;
+}
+
+void TessellationCache::Put(const Path& path,
+                            Scalar scale,
+                            Tessellation tessellation) {
+  if (!path.GetCacheKey().has_value()) {
+    return;
+  }
+  auto key = MakeKey(path, scale);
+  auto found = entries_by_key_.find(key);
+  if (found != entries_by_key_.end()) {
+    byte_size_ -= found->second->tessellation.GetByteSize();
+    entries_.erase(found->second);
+    entries_by_key_.erase(found);
+  }
+
+  auto byte_size = tessellation.GetByteSize();
+  if (byte_size > max_byte_size_) {
+    return;
+  }
+  while (byte_size_ + byte_size > max_byte_size_) {
+    byte_size_ -= entries_.back().tessellation.GetByteSize();
+    entries_by_key_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+  entries_.push_front(Entry{
+      .key = key,
+      .tessellation = std::move(tessellation),
+  });
+  entries_by_key_[key] = entries_.begin();
+  byte_size_ += byte_size;
+}
+
+size_t TessellationCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+size_t TessellationCache::GetByteSize() const {
+  return byte_size_;
+}
+
+}  // namespace impeller
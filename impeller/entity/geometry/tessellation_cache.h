@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "impeller/core/formats.h"
+#include "impeller/geometry/path.h"
+#include "impeller/geometry/point.h"
+
+namespace impeller {
+
+/// @brief A cache of the tessellations of filled paths that have a cache key,
+///        kept across frames.
+///
+///        Paths are tessellated at the scale of the bucket that the scale
+///        they are drawn at falls in, so that a path drawn at slightly
+///        different scales in consecutive frames is only tessellated once.
+///        The least recently used tessellations are dropped once they take
+///        up more than the byte budget of the cache.
+class TessellationCache {
+ public:
+  struct Tessellation {
+    PrimitiveType type = PrimitiveType::kTriangle;
+    std::vector<Point> vertices;
+    /// Empty if the vertices aren't indexed.
+    std::vector<uint16_t> indices;
+
+    size_t GetByteSize() const;
+  };
+
+  explicit TessellationCache(size_t max_byte_size = 4u * 1024u * 1024u);
+
+  ~TessellationCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief  Returns the scale to tessellate a path drawn at the given scale
+  ///         at, which is never less than the given scale.
+  ///
+  static Scalar GetBucketedScale(Scalar scale);
+
+  //----------------------------------------------------------------------------
+  /// @brief  Returns the cached tessellation of the path at the bucketed
+  ///         scale, or nullptr if there is none.
+  ///
+  ///         The tessellation remains valid until the next call to `Put`.
+  ///
+  const Tessellation* Get(const Path& path, Scalar scale);
+
+  //----------------------------------------------------------------------------
+  /// @brief  Caches the tessellation of the path at the bucketed scale. The
+  ///         path must have a cache key.
+  ///
+  void Put(const Path& path, Scalar scale, Tessellation tessellation);
+
+  // visible for testing.
+  size_t GetEntryCount() const;
+
+  // visible for testing.
+  size_t GetByteSize() const;
+
+ private:
+  struct Key {
+    uint64_t path_key;
+    FillType fill_type;
+    int32_t scale_bucket;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const;
+    };
+
+    struct Equal {
+      bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+  };
+
+  struct Entry {
+    Key key;
+    Tessellation tessellation;
+  };
+
+  static Key MakeKey(const Path& path, Scalar scale);
+
+  const size_t max_byte_size_;
+  size_t byte_size_ = 0u;
+  // Ordered from the most to the least recently used.
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash, Key::Equal>
+      entries_by_key_;
+
+  TessellationCache(const TessellationCache&) = delete;
+
+  TessellationCache& operator=(const TessellationCache&) = delete;
+};
+
+}  // namespace impeller
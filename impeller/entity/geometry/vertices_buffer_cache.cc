@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/vertices_buffer_cache.h"
+
+#include <utility>
+
+#include "flutter/fml/hash_combine.h"
+
+namespace impeller {
+
+std::size_t VerticesBufferCache::Key::Hash::operator()(const Key& key) const {
+  return fml::HashCombine(key.vertices_key, static_cast<int>(key.vertex_type));
+}
+
+bool VerticesBufferCache::Key::Equal::operator()(const Key& lhs,
+                                                 const Key& rhs) const {
+  return lhs.vertices_key == rhs.vertices_key &&
+         lhs.vertex_type == rhs.vertex_type;
+}
+
+VerticesBufferCache::VerticesBufferCache() = default;
+
+VerticesBufferCache::~VerticesBufferCache() = default;
+
+std::optional<VertexBuffer> VerticesBufferCache::Find(
+    uint64_t key,
+    GeometryVertexType type) {
+  auto found = entries_.find(Key{key, type});
+  if (found == entries_.end()) {
+    return std::nullopt;
+  }
+  found->second.used = true;
+  return found->second.vertices;
+}
+
+bool VerticesBufferCache::ShouldCache(uint64_t key, GeometryVertexType type) {
+  // Remember the key, but only store vertices once it is seen again.
+  auto [entry, inserted] = entries_.try_emplace(Key{key, type});
+  entry->second.used = true;
+  return !inserted;
+}
+
+void VerticesBufferCache::Cache(uint64_t key,
+                                GeometryVertexType type,
+                                VertexBuffer vertices) {
+  entries_[Key{key, type}] = {.vertices = std::move(vertices)};
+}
+
+void VerticesBufferCache::EndFrame() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.used) {
+      it->second.used = false;
+      ++it;
+    } else {
+      it = entries_.erase(it);
+    }
+  }
+}
+
+size_t VerticesBufferCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+}  // namespace impeller
@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include "impeller/core/vertex_buffer.h"
+#include "impeller/entity/geometry/geometry.h"
+
+namespace impeller {
+
+/// @brief A cache of the device buffers that vertices geometries with a cache
+///        key upload their vertices and indices to, kept across frames.
+///
+///        Vertices that are drawn with the same key in consecutive frames,
+///        like the static meshes of a `Vertices` object, are uploaded on the
+///        second draw and reused from then on instead of being uploaded on
+///        every draw. Buffers of vertices that weren't drawn since the last
+///        call to `EndFrame` are dropped.
+class VerticesBufferCache {
+ public:
+  VerticesBufferCache();
+
+  ~VerticesBufferCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief  Returns the vertex buffer cached for the vertices with the given
+  ///         key laid out for the given vertex type, or `std::nullopt` on a
+  ///         cache miss.
+  ///
+  std::optional<VertexBuffer> Find(uint64_t key, GeometryVertexType type);
+
+  //----------------------------------------------------------------------------
+  /// @brief  Whether the vertex buffer for a key that missed the cache is
+  ///         worth storing. This is only the case for vertices that have been
+  ///         drawn since the last call to `EndFrame`, so that vertices which
+  ///         are rebuilt every frame don't keep a buffer alive for a frame.
+  ///
+  bool ShouldCache(uint64_t key, GeometryVertexType type);
+
+  //----------------------------------------------------------------------------
+  /// @brief  Stores a vertex buffer for reuse in later frames. The buffer
+  ///         views must refer to device buffers rather than transient memory.
+  ///
+  void Cache(uint64_t key, GeometryVertexType type, VertexBuffer vertices);
+
+  //----------------------------------------------------------------------------
+  /// @brief  Drops the vertex buffers of vertices that weren't drawn since
+  ///         the previous call.
+  ///
+  void EndFrame();
+
+  // visible for testing.
+  size_t GetEntryCount() const;
+
+ private:
+  struct Key {
+    uint64_t vertices_key;
+    GeometryVertexType vertex_type;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const;
+    };
+
+    struct Equal {
+      bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+  };
+
+  struct Entry {
+    std::optional<VertexBuffer> vertices;
+    bool used = true;
+  };
+
+  std::unordered_map<Key, Entry, Key::Hash, Key::Equal> entries_;
+
+  VerticesBufferCache(const VerticesBufferCache&) = delete;
+
+  VerticesBufferCache& operator=(const VerticesBufferCache&) = delete;
+};
+
+}  // namespace impeller
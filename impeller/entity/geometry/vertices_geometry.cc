@@ -6,8 +6,8 @@
 
 #include <utility>
 
-#include <utility>
 #include "impeller/core/formats.h"
+#include "impeller/entity/geometry/vertices_buffer_cache.h"
 
 namespace impeller {
 
@@ -57,13 +57,15 @@ VerticesGeometry::VerticesGeometry(std::vector<Point> vertices,
                                    std::vector<Point> texture_coordinates,
                                    std::vector<Color> colors,
                                    Rect bounds,
-                                   VertexMode vertex_mode)
+                                   VertexMode vertex_mode,
+                                   std::optional<uint64_t> cache_key)
     : vertices_(std::move(vertices)),
       colors_(std::move(colors)),
       texture_coordinates_(std::move(texture_coordinates)),
       indices_(std::move(indices)),
       bounds_(bounds),
-      vertex_mode_(vertex_mode) {
+      vertex_mode_(vertex_mode),
+      cache_key_(cache_key) {
   NormalizeIndices();
 }
 
@@ -108,14 +110,15 @@ std::optional<Rect> VerticesGeometry::GetTextureCoordinateCoverge() const {
                                texture_coordinates_.end());
 }
 
-GeometryResult VerticesGeometry::GetPositionBuffer(
+// Uploads the vertex data and indices to a new device buffer, with the
+// indices following the vertices.
+static std::optional<VertexBuffer> CreateVertexBuffer(
     const ContentContext& renderer,
-    const Entity& entity,
-    RenderPass& pass) const {
-  auto index_count = indices_.size();
-  auto vertex_count = vertices_.size();
-
-  size_t total_vtx_bytes = vertex_count * sizeof(float) * 2;
+    const uint8_t* vertex_data,
+    size_t total_vtx_bytes,
+    size_t vertex_count,
+    const std::vector<uint16_t>& indices) {
+  auto index_count = indices.size();
   size_t total_idx_bytes = index_count * sizeof(uint16_t);
 
   DeviceBufferDescriptor buffer_desc;
@@ -125,31 +128,60 @@ GeometryResult VerticesGeometry::GetPositionBuffer(
   auto buffer =
       renderer.GetContext()->GetResourceAllocator()->CreateBuffer(buffer_desc);
 
-  if (!buffer->CopyHostBuffer(
-          reinterpret_cast<const uint8_t*>(vertices_.data()),
-          Range{0, total_vtx_bytes}, 0)) {
-    return {};
+  if (!buffer->CopyHostBuffer(vertex_data, Range{0, total_vtx_bytes}, 0)) {
+    return std::nullopt;
+  }
+  if (index_count > 0u &&
+      !buffer->CopyHostBuffer(reinterpret_cast<const uint8_t*>(indices.data()),
+                              Range{0, total_idx_bytes}, total_vtx_bytes)) {
+    return std::nullopt;
   }
-  if (index_count > 0 &&
-      !buffer->CopyHostBuffer(
-          reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(indices_.data())),
-          Range{0, total_idx_bytes}, total_vtx_bytes)) {
+
+  return VertexBuffer{
+      .vertex_buffer = {.buffer = buffer, .range = Range{0, total_vtx_bytes}},
+      .index_buffer = {.buffer = buffer,
+                       .range = Range{total_vtx_bytes, total_idx_bytes}},
+      .vertex_count = index_count > 0 ? index_count : vertex_count,
+      .index_type = index_count > 0 ? IndexType::k16bit : IndexType::kNone,
+  };
+}
+
+std::optional<VertexBuffer> VerticesGeometry::GetCachedVertexBuffer(
+    const ContentContext& renderer,
+    GeometryVertexType type,
+    const std::function<std::optional<VertexBuffer>()>& create) const {
+  if (!cache_key_.has_value()) {
+    return create();
+  }
+  auto& cache = *renderer.GetVerticesBufferCache();
+  if (auto cached = cache.Find(cache_key_.value(), type)) {
+    return cached;
+  }
+  auto vertex_buffer = create();
+  if (vertex_buffer.has_value() &&
+      cache.ShouldCache(cache_key_.value(), type)) {
+    cache.Cache(cache_key_.value(), type, vertex_buffer.value());
+  }
+  return vertex_buffer;
+}
+
+GeometryResult VerticesGeometry::GetPositionBuffer(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  auto vertex_buffer = GetCachedVertexBuffer(
+      renderer, GeometryVertexType::kPosition, [&]() {
+        return CreateVertexBuffer(
+            renderer, reinterpret_cast<const uint8_t*>(vertices_.data()),
+            vertices_.size() * sizeof(Point), vertices_.size(), indices_);
+      });
+  if (!vertex_buffer.has_value()) {
     return {};
   }
 
   return GeometryResult{
       .type = GetPrimitiveType(),
-      .vertex_buffer =
-          {
-              .vertex_buffer = {.buffer = buffer,
-                                .range = Range{0, total_vtx_bytes}},
-              .index_buffer = {.buffer = buffer,
-                               .range =
-                                   Range{total_vtx_bytes, total_idx_bytes}},
-              .vertex_count = index_count > 0 ? index_count : vertex_count,
-              .index_type =
-                  index_count > 0 ? IndexType::k16bit : IndexType::kNone,
-          },
+      .vertex_buffer = std::move(vertex_buffer.value()),
       .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
                    entity.GetTransform(),
       .prevent_overdraw = false,
@@ -162,53 +194,28 @@ GeometryResult VerticesGeometry::GetPositionColorBuffer(
     RenderPass& pass) {
   using VS = GeometryColorPipeline::VertexShader;
 
-  auto index_count = indices_.size();
-  auto vertex_count = vertices_.size();
-
-  std::vector<VS::PerVertexData> vertex_data(vertex_count);
-  {
-    for (auto i = 0u; i < vertex_count; i++) {
-      vertex_data[i] = {
-          .position = vertices_[i],
-          .color = colors_[i],
-      };
-    }
-  }
-
-  size_t total_vtx_bytes = vertex_data.size() * sizeof(VS::PerVertexData);
-  size_t total_idx_bytes = index_count * sizeof(uint16_t);
-
-  DeviceBufferDescriptor buffer_desc;
-  buffer_desc.size = total_vtx_bytes + total_idx_bytes;
-  buffer_desc.storage_mode = StorageMode::kHostVisible;
-
-  auto buffer =
-      renderer.GetContext()->GetResourceAllocator()->CreateBuffer(buffer_desc);
-
-  if (!buffer->CopyHostBuffer(reinterpret_cast<uint8_t*>(vertex_data.data()),
-                              Range{0, total_vtx_bytes}, 0)) {
-    return {};
-  }
-  if (index_count > 0 &&
-      !buffer->CopyHostBuffer(
-          reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(indices_.data())),
-          Range{0, total_idx_bytes}, total_vtx_bytes)) {
+  auto vertex_buffer = GetCachedVertexBuffer(
+      renderer, GeometryVertexType::kColor, [&]() {
+        auto vertex_count = vertices_.size();
+        std::vector<VS::PerVertexData> vertex_data(vertex_count);
+        for (auto i = 0u; i < vertex_count; i++) {
+          vertex_data[i] = {
+              .position = vertices_[i],
+              .color = colors_[i],
+          };
+        }
+        return CreateVertexBuffer(
+            renderer, reinterpret_cast<const uint8_t*>(vertex_data.data()),
+            vertex_data.size() * sizeof(VS::PerVertexData), vertex_count,
+            indices_);
+      });
+  if (!vertex_buffer.has_value()) {
     return {};
   }
 
   return GeometryResult{
       .type = GetPrimitiveType(),
-      .vertex_buffer =
-          {
-              .vertex_buffer = {.buffer = buffer,
-                                .range = Range{0, total_vtx_bytes}},
-              .index_buffer = {.buffer = buffer,
-                               .range =
-                                   Range{total_vtx_bytes, total_idx_bytes}},
-              .vertex_count = index_count > 0 ? index_count : vertex_count,
-              .index_type =
-                  index_count > 0 ? IndexType::k16bit : IndexType::kNone,
-          },
+      .vertex_buffer = std::move(vertex_buffer.value()),
       .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
                    entity.GetTransform(),
       .prevent_overdraw = false,
@@ -223,22 +230,22 @@ GeometryResult VerticesGeometry::GetPositionUVBuffer(
     RenderPass& pass) const {
   using VS = TexturePipeline::VertexShader;
 
-  auto index_count = indices_.size();
   auto vertex_count = vertices_.size();
   auto uv_transform =
       texture_coverage.GetNormalizingTransform() * effect_transform;
   auto has_texture_coordinates = HasTextureCoordinates();
+  std::vector<Point> uvs(vertex_count);
+  uv_transform.TransformPoints(
+      has_texture_coordinates ? texture_coordinates_.data() : vertices_.data(),
+      uvs.data(), vertex_count);
   std::vector<VS::PerVertexData> vertex_data(vertex_count);
   {
     for (auto i = 0u; i < vertex_count; i++) {
-      auto vertex = vertices_[i];
-      auto texture_coord =
-          has_texture_coordinates ? texture_coordinates_[i] : vertices_[i];
-      auto uv = uv_transform * texture_coord;
+      auto uv = uvs[i];
       // From experimentation we need to clamp these values to < 1.0 or else
       // there can be flickering.
       vertex_data[i] = {
-          .position = vertex,
+          .position = vertices_[i],
           .texture_coords =
               Point(std::clamp(uv.x, 0.0f, 1.0f - kEhCloseEnough),
                     std::clamp(uv.y, 0.0f, 1.0f - kEhCloseEnough)),
@@ -246,40 +253,18 @@ GeometryResult VerticesGeometry::GetPositionUVBuffer(
     }
   }
 
-  size_t total_vtx_bytes = vertex_data.size() * sizeof(VS::PerVertexData);
-  size_t total_idx_bytes = index_count * sizeof(uint16_t);
-
-  DeviceBufferDescriptor buffer_desc;
-  buffer_desc.size = total_vtx_bytes + total_idx_bytes;
-  buffer_desc.storage_mode = StorageMode::kHostVisible;
-
-  auto buffer =
-      renderer.GetContext()->GetResourceAllocator()->CreateBuffer(buffer_desc);
-
-  if (!buffer->CopyHostBuffer(reinterpret_cast<uint8_t*>(vertex_data.data()),
-                              Range{0, total_vtx_bytes}, 0)) {
-    return {};
-  }
-  if (index_count > 0u &&
-      !buffer->CopyHostBuffer(
-          reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(indices_.data())),
-          Range{0, total_idx_bytes}, total_vtx_bytes)) {
+  // The texture coordinates depend on the coverage of the texture, so these
+  // vertices aren't cached.
+  auto vertex_buffer = CreateVertexBuffer(
+      renderer, reinterpret_cast<const uint8_t*>(vertex_data.data()),
+      vertex_data.size() * sizeof(VS::PerVertexData), vertex_count, indices_);
+  if (!vertex_buffer.has_value()) {
     return {};
   }
 
   return GeometryResult{
       .type = GetPrimitiveType(),
-      .vertex_buffer =
-          {
-              .vertex_buffer = {.buffer = buffer,
-                                .range = Range{0, total_vtx_bytes}},
-              .index_buffer = {.buffer = buffer,
-                               .range =
-                                   Range{total_vtx_bytes, total_idx_bytes}},
-              .vertex_count = index_count > 0 ? index_count : vertex_count,
-              .index_type =
-                  index_count > 0 ? IndexType::k16bit : IndexType::kNone,
-          },
+      .vertex_buffer = std::move(vertex_buffer.value()),
       .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
                    entity.GetTransform(),
       .prevent_overdraw = false,
@@ -4,11 +4,21 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <optional>
+
 #include "impeller/entity/geometry/geometry.h"
 
 namespace impeller {
 
 /// @brief A geometry that is created from a vertices object.
+///
+///        Geometries created with a cache key keep the vertex buffers they
+///        upload for their positions and colors in the
+///        `VerticesBufferCache`, so that vertices drawn every frame with the
+///        same key are only uploaded once. The key must identify the
+///        vertices, indices and colors of the geometry.
 class VerticesGeometry final : public Geometry {
  public:
   enum class VertexMode {
@@ -22,7 +32,8 @@ class VerticesGeometry final : public Geometry {
                    std::vector<Point> texture_coordinates,
                    std::vector<Color> colors,
                    Rect bounds,
-                   VerticesGeometry::VertexMode vertex_mode);
+                   VerticesGeometry::VertexMode vertex_mode,
+                   std::optional<uint64_t> cache_key = std::nullopt);
 
   ~VerticesGeometry() = default;
 
@@ -59,6 +70,14 @@ class VerticesGeometry final : public Geometry {
 
   PrimitiveType GetPrimitiveType() const;
 
+  // Returns the vertex buffer cached for the vertex type, or the one returned
+  // by |create| if there is none. The created buffer is cached if the
+  // geometry has a cache key.
+  std::optional<VertexBuffer> GetCachedVertexBuffer(
+      const ContentContext& renderer,
+      GeometryVertexType type,
+      const std::function<std::optional<VertexBuffer>()>& create) const;
+
   std::vector<Point> vertices_;
   std::vector<Color> colors_;
   std::vector<Point> texture_coordinates_;
@@ -66,6 +85,7 @@ class VerticesGeometry final : public Geometry {
   Rect bounds_;
   VerticesGeometry::VertexMode vertex_mode_ =
       VerticesGeometry::VertexMode::kTriangles;
+  std::optional<uint64_t> cache_key_;
 };
 
 }  // namespace impeller
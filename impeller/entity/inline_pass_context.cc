@@ -50,6 +50,17 @@ std::shared_ptr<Texture> InlinePassContext::GetTexture() {
   return pass_target_.GetRenderTarget().GetRenderTargetTexture();
 }
 
+bool InlinePassContext::CanReadTextureWhileActive() const {
+  if (!IsActive() || is_collapsed_ || pass_count_ < 2) {
+    return false;
+  }
+  const auto& color_attachments =
+      pass_target_.GetRenderTarget().GetColorAttachments();
+  auto color0 = color_attachments.find(0);
+  return color0 != color_attachments.end() &&
+         color0->second.resolve_texture == nullptr;
+}
+
 bool InlinePassContext::EndPass() {
   if (!IsActive()) {
     return true;
@@ -35,6 +35,18 @@ class InlinePassContext {
 
   std::shared_ptr<Texture> GetTexture();
 
+  //----------------------------------------------------------------------------
+  /// @brief  Whether the texture returned by |GetTexture| can be read while
+  ///         the current pass is active, in which case the read sees
+  ///         everything drawn by the passes that have ended and nothing
+  ///         drawn by the active one.
+  ///
+  ///         This isn't the case for the first pass, which hasn't cleared the
+  ///         texture yet, or for MSAA targets, which are flipped to a stale
+  ///         resolve texture when a pass is resumed.
+  ///
+  bool CanReadTextureWhileActive() const;
+
   bool EndPass();
 
   EntityPassTarget& GetPassTarget() const;
@@ -3,10 +3,18 @@
 // found in the LICENSE file.
 
 #include "impeller/entity/render_target_cache.h"
+
+#include "flutter/fml/cache_statistics.h"
 #include "impeller/renderer/render_target.h"
 
 namespace impeller {
 
+static fml::CacheStatistics::Counters& GetRenderTargetCacheStatistics() {
+  static fml::CacheStatistics::Counters& counters =
+      fml::CacheStatistics::GetCounters("ImpellerRenderTargetCache");
+  return counters;
+}
+
 RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator)
     : RenderTargetAllocator(std::move(allocator)) {}
 
@@ -24,9 +32,43 @@ void RenderTargetCache::End() {
       retain.push_back(td);
     }
   }
+  GetRenderTargetCacheStatistics().RecordEviction(texture_data_.size() -
+                                                  retain.size());
   texture_data_.swap(retain);
 }
 
+bool RenderTargetCache::IsAvailable(const TextureData& td) {
+  // A texture only referenced by the cache is no longer used by anything
+  // recorded this frame and may be aliased.
+  return !td.used_this_frame || td.texture.use_count() == 1;
+}
+
+size_t RenderTargetCache::GetIdleByteSize() const {
+  size_t bytes = 0;
+  for (const auto& td : texture_data_) {
+    if (td.texture.use_count() == 1) {
+      bytes += td.texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+    }
+  }
+  return bytes;
+}
+
+size_t RenderTargetCache::Trim(size_t bytes) {
+  size_t trimmed_bytes = 0;
+  for (auto it = texture_data_.begin();
+       it != texture_data_.end() && trimmed_bytes < bytes;) {
+    if (it->texture.use_count() == 1) {
+      trimmed_bytes +=
+          it->texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+      it = texture_data_.erase(it);
+      GetRenderTargetCacheStatistics().RecordEviction();
+    } else {
+      ++it;
+    }
+  }
+  return trimmed_bytes;
+}
+
 size_t RenderTargetCache::CachedTextureCount() const {
   return texture_data_.size();
 }
@@ -38,13 +80,15 @@ std::shared_ptr<Texture> RenderTargetCache::CreateTexture(
              static_cast<TextureUsageMask>(TextureUsage::kRenderTarget));
 
   for (auto& td : texture_data_) {
-    const auto other_desc = td.texture->GetTextureDescriptor();
     FML_DCHECK(td.texture != nullptr);
-    if (!td.used_this_frame && desc == other_desc) {
+    const auto other_desc = td.texture->GetTextureDescriptor();
+    if (IsAvailable(td) && desc == other_desc) {
       td.used_this_frame = true;
+      GetRenderTargetCacheStatistics().RecordHit();
       return td.texture;
     }
   }
+  GetRenderTargetCacheStatistics().RecordMiss();
   auto result = RenderTargetAllocator::CreateTexture(desc);
   if (result == nullptr) {
     return result;
@@ -12,6 +12,12 @@ namespace impeller {
 ///        allocated texture data for one frame.
 ///
 ///        Any textures unused after a frame are immediately discarded.
+///
+///        Textures are also aliased within a frame. Once every reference to a
+///        cached texture other than the one held by the cache has been
+///        dropped, its lifetime cannot overlap with that of any texture
+///        requested later and it is handed out again, even if it was already
+///        used earlier in the same frame.
 class RenderTargetCache : public RenderTargetAllocator {
  public:
   explicit RenderTargetCache(std::shared_ptr<Allocator> allocator);
@@ -28,6 +34,12 @@ class RenderTargetCache : public RenderTargetAllocator {
   std::shared_ptr<Texture> CreateTexture(
       const TextureDescriptor& desc) override;
 
+  // |RenderTargetAllocator|
+  size_t GetIdleByteSize() const override;
+
+  // |RenderTargetAllocator|
+  size_t Trim(size_t bytes) override;
+
   // visible for testing.
   size_t CachedTextureCount() const;
 
@@ -37,6 +49,8 @@ class RenderTargetCache : public RenderTargetAllocator {
     std::shared_ptr<Texture> texture;
   };
 
+  static bool IsAvailable(const TextureData& td);
+
   std::vector<TextureData> texture_data_;
 
   RenderTargetCache(const RenderTargetCache&) = delete;
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <limits>
 #include <memory>
 
 #include "flutter/testing/testing.h"
@@ -51,12 +52,15 @@ TEST(RenderTargetCacheTest, CachesUsedTexturesAcrossFrames) {
       .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
 
   render_target_cache.Start();
-  // Create two textures of the same exact size/shape. Both should be marked
-  // as used this frame, so the cached data set will contain two.
-  render_target_cache.CreateTexture(desc);
-  render_target_cache.CreateTexture(desc);
+  {
+    // Create two textures of the same exact size/shape that are both alive at
+    // the same time. Both should be marked as used this frame, so the cached
+    // data set will contain two.
+    auto first = render_target_cache.CreateTexture(desc);
+    auto second = render_target_cache.CreateTexture(desc);
 
-  ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
+    ASSERT_EQ(render_target_cache.CachedTextureCount(), 2u);
+  }
 
   render_target_cache.End();
   render_target_cache.Start();
@@ -70,6 +74,31 @@ TEST(RenderTargetCacheTest, CachesUsedTexturesAcrossFrames) {
   ASSERT_EQ(render_target_cache.CachedTextureCount(), 1u);
 }
 
+TEST(RenderTargetCacheTest, AliasesReleasedTexturesWithinAFrame) {
+  auto allocator = std::make_shared<TestAllocator>();
+  auto render_target_cache = RenderTargetCache(allocator);
+  auto desc = TextureDescriptor{
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(100, 100),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
+
+  render_target_cache.Start();
+  auto first = render_target_cache.CreateTexture(desc);
+  auto* first_ptr = first.get();
+  // The first texture is released before the second one is requested, so
+  // their lifetimes don't overlap and the allocation is reused.
+  first.reset();
+  auto second = render_target_cache.CreateTexture(desc);
+  EXPECT_EQ(second.get(), first_ptr);
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 1u);
+
+  // A texture that is still referenced is never aliased.
+  auto third = render_target_cache.CreateTexture(desc);
+  EXPECT_NE(third, second);
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 2u);
+  render_target_cache.End();
+}
+
 TEST(RenderTargetCacheTest, DoesNotPersistFailedAllocations) {
   auto allocator = std::make_shared<TestAllocator>();
   auto render_target_cache = RenderTargetCache(allocator);
@@ -85,5 +114,31 @@ TEST(RenderTargetCacheTest, DoesNotPersistFailedAllocations) {
   ASSERT_EQ(render_target_cache.CachedTextureCount(), 0u);
 }
 
+TEST(RenderTargetCacheTest, TrimReleasesOnlyTexturesNotInUse) {
+  auto allocator = std::make_shared<TestAllocator>();
+  auto render_target_cache = RenderTargetCache(allocator);
+  auto desc = TextureDescriptor{
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(100, 100),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
+  const size_t texture_bytes = desc.GetByteSizeOfBaseMipLevel();
+
+  render_target_cache.Start();
+  auto in_use = render_target_cache.CreateTexture(desc);
+  render_target_cache.CreateTexture(desc);
+  render_target_cache.CreateTexture(desc);
+  render_target_cache.End();
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 3u);
+  EXPECT_EQ(render_target_cache.GetIdleByteSize(), 2 * texture_bytes);
+
+  EXPECT_EQ(render_target_cache.Trim(1), texture_bytes);
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 2u);
+
+  EXPECT_EQ(render_target_cache.Trim(std::numeric_limits<size_t>::max()),
+            texture_bytes);
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 1u);
+  EXPECT_EQ(render_target_cache.GetIdleByteSize(), 0u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -0,0 +1,48 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <impeller/conversions.glsl>
+#include <impeller/types.glsl>
+
+uniform FrameInfo {
+  mat4 mvp;
+  vec2 texture_size;
+  float texture_sampler_y_coord_scale;
+}
+frame_info;
+
+// These values must correspond to the layout of `AtlasInstanceData` in
+// atlas_contents.cc.
+struct AtlasInstance {
+  // The x and y axes of the affine transform of the sprite.
+  vec4 basis;
+  // The translation of the transform of the sprite in xy.
+  vec4 translation;
+  // The origin and size of the sprite in the atlas, in texels.
+  vec4 sample_rect;
+  vec4 color;
+};
+
+readonly buffer InstanceData {
+  AtlasInstance instances[];
+}
+instance_data;
+
+// A corner of the unit square.
+in vec2 unit_position;
+
+out vec2 v_texture_coords;
+out f16vec4 v_color;
+
+void main() {
+  AtlasInstance instance = instance_data.instances[gl_InstanceIndex];
+  vec2 local = unit_position * instance.sample_rect.zw;
+  vec2 position = instance.basis.xy * local.x + instance.basis.zw * local.y +
+                  instance.translation.xy;
+  gl_Position = frame_info.mvp * vec4(position, 0.0, 1.0);
+  v_color = f16vec4(instance.color);
+  v_texture_coords =
+      IPRemapCoords((instance.sample_rect.xy + local) / frame_info.texture_size,
+                    frame_info.texture_sampler_y_coord_scale);
+}
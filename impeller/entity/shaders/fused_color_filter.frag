@@ -0,0 +1,96 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+precision mediump float;
+
+#include <impeller/color.glsl>
+#include <impeller/types.glsl>
+
+// These values must correspond to the order of the items in the
+// 'FusedColorFilterContents::Stage::Kind' enum class.
+const float kNone = 0.0;
+const float kMatrix = 1.0;
+const float kSrgbToLinear = 2.0;
+const float kLinearToSrgb = 3.0;
+const float kBlend = 4.0;
+
+uniform sampler2D input_texture;
+
+// For matrix stages, `m` and `v` are the matrix and the vector added to its
+// product. For blend stages, the first five elements of `m` are the Porter-Duff
+// coefficients of the blend, and `v` is the premultiplied color blended over
+// the input.
+uniform FragInfo {
+  mat4 stage0_m;
+  mat4 stage1_m;
+  mat4 stage2_m;
+  mat4 stage3_m;
+  vec4 stage0_v;
+  vec4 stage1_v;
+  vec4 stage2_v;
+  vec4 stage3_v;
+  float stage0_kind;
+  float stage1_kind;
+  float stage2_kind;
+  float stage3_kind;
+  float input_alpha;
+}
+frag_info;
+
+in highp vec2 v_texture_coords;
+
+out vec4 frag_color;
+
+// Applies a stage to an unpremultiplied color, returning an unpremultiplied
+// color.
+vec4 ApplyStage(vec4 color, float kind, mat4 m, vec4 v) {
+  if (kind == kMatrix) {
+    return clamp(m * color + v, 0.0, 1.0);
+  }
+  if (kind == kSrgbToLinear) {
+    for (int i = 0; i < 3; i++) {
+      if (color[i] <= 0.04045) {
+        color[i] = color[i] / 12.92;
+      } else {
+        color[i] = pow((color[i] + 0.055) / 1.055, 2.4);
+      }
+    }
+    return color;
+  }
+  if (kind == kLinearToSrgb) {
+    for (int i = 0; i < 3; i++) {
+      if (color[i] <= 0.0031308) {
+        color[i] = color[i] * 12.92;
+      } else {
+        color[i] = 1.055 * pow(color[i], 1.0 / 2.4) - 0.055;
+      }
+    }
+    return color;
+  }
+  if (kind == kBlend) {
+    vec4 dst = IPPremultiply(color);
+    vec4 src = v;
+    return IPUnpremultiply(src * (m[0][0] + dst.a * m[0][1]) +
+                           dst * (m[0][2] + src.a * m[0][3] + src * m[1][0]));
+  }
+  return color;
+}
+
+void main() {
+  vec4 input_color =
+      texture(input_texture, v_texture_coords) * frag_info.input_alpha;
+
+  // Filter inputs are premultiplied.
+  vec4 color = IPUnpremultiply(input_color);
+  color = ApplyStage(color, frag_info.stage0_kind, frag_info.stage0_m,
+                     frag_info.stage0_v);
+  color = ApplyStage(color, frag_info.stage1_kind, frag_info.stage1_m,
+                     frag_info.stage1_v);
+  color = ApplyStage(color, frag_info.stage2_kind, frag_info.stage2_m,
+                     frag_info.stage2_v);
+  color = ApplyStage(color, frag_info.stage3_kind, frag_info.stage3_m,
+                     frag_info.stage3_v);
+
+  frag_color = IPPremultiply(color);
+}
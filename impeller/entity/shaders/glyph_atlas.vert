@@ -9,7 +9,6 @@ uniform FrameInfo {
   mat4 mvp;
   mat4 entity_transform;
   vec2 atlas_size;
-  vec2 offset;
   f16vec4 text_color;
   float is_translation_scale;
 }
@@ -22,6 +21,8 @@ in vec4 glyph_bounds;
 
 in vec2 unit_position;
 in vec2 glyph_position;
+// The origin of the text frame this glyph belongs to, in entity space.
+in vec2 frame_offset;
 
 out vec2 v_uv;
 
@@ -50,7 +51,7 @@ vec2 project(mat4 m, vec2 v) {
 
 void main() {
   vec2 screen_offset =
-      round(project(frame_info.entity_transform, frame_info.offset));
+      round(project(frame_info.entity_transform, frame_offset));
 
   // For each glyph, we compute two rectangles. One for the vertex positions
   // and one for the texture coordinates (UVs).
@@ -74,7 +75,7 @@ void main() {
         0.0, 1.0);
   } else {
     position = frame_info.entity_transform *
-               vec4(frame_info.offset + glyph_position + glyph_bounds.xy +
+               vec4(frame_offset + glyph_position + glyph_bounds.xy +
                         unit_position * glyph_bounds.zw,
                     0.0, 1.0);
   }
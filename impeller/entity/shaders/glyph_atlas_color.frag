@@ -6,12 +6,9 @@ precision mediump float;
 
 #include <impeller/types.glsl>
 
-uniform f16sampler2D glyph_atlas_sampler;
+layout(constant_id = 0) const int use_text_color = 0;
 
-uniform FragInfo {
-  float use_text_color;
-}
-frag_info;
+uniform f16sampler2D glyph_atlas_sampler;
 
 in highp vec2 v_uv;
 
@@ -21,7 +18,7 @@ out f16vec4 frag_color;
 
 void main() {
   f16vec4 value = texture(glyph_atlas_sampler, v_uv);
-  if (frag_info.use_text_color == 1.0f) {
+  if (use_text_color == 1) {
     frag_color = value.aaaa * v_text_color;
   } else {
     frag_color = value * v_text_color.aaaa;
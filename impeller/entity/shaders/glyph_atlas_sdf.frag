@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+precision mediump float;
+
+#include <impeller/types.glsl>
+
+uniform f16sampler2D glyph_atlas_sampler;
+
+uniform FragInfo {
+  // Half the width of the anti-aliased edge, in normalized distance units.
+  float smoothing;
+}
+frag_info;
+
+in highp vec2 v_uv;
+
+IMPELLER_MAYBE_FLAT in f16vec4 v_text_color;
+
+out f16vec4 frag_color;
+
+void main() {
+  // The atlas stores the signed distance to the glyph outline remapped so
+  // that 0.5 lies on the edge and larger values are inside the glyph.
+  float distance = float(texture(glyph_atlas_sampler, v_uv).a);
+  float16_t coverage = float16_t(smoothstep(0.5 - frag_info.smoothing,
+                                            0.5 + frag_info.smoothing,
+                                            distance));
+  frag_color = coverage * v_text_color;
+}
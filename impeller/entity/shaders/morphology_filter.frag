@@ -5,6 +5,7 @@
 precision mediump float;
 
 layout(constant_id = 0) const int supports_decal = 1;
+layout(constant_id = 1) const int morph_type = 0;
 
 #include <impeller/constants.glsl>
 #include <impeller/texture.glsl>
@@ -12,16 +13,14 @@ layout(constant_id = 0) const int supports_decal = 1;
 
 // These values must correspond to the order of the items in the
 // 'FilterContents::MorphType' enum class.
-const float16_t kMorphTypeDilate = 0.0hf;
-const float16_t kMorphTypeErode = 1.0hf;
+const int kMorphTypeDilate = 0;
+const int kMorphTypeErode = 1;
 
 uniform f16sampler2D texture_sampler;
 
 uniform FragInfo {
   f16vec2 uv_offset;
   float16_t radius;
-  float16_t morph_type;
-  float supports_decal_sampler_address_mode;
 }
 frag_info;
 
@@ -31,7 +30,7 @@ out f16vec4 frag_color;
 
 void main() {
   f16vec4 result =
-      frag_info.morph_type == kMorphTypeDilate ? f16vec4(0.0) : f16vec4(1.0);
+      morph_type == kMorphTypeDilate ? f16vec4(0.0) : f16vec4(1.0);
   for (float16_t i = -frag_info.radius; i <= frag_info.radius; i++) {
     vec2 texture_coords = v_texture_coords + frag_info.uv_offset * i;
 
@@ -42,7 +41,7 @@ void main() {
       color = IPHalfSampleDecal(texture_sampler, texture_coords);
     }
 
-    if (frag_info.morph_type == kMorphTypeDilate) {
+    if (morph_type == kMorphTypeDilate) {
       result = max(color, result);
     } else {
       result = min(color, result);
@@ -0,0 +1,17 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+precision mediump float;
+
+#include <impeller/types.glsl>
+
+IMPELLER_MAYBE_FLAT in f16vec4 v_color;
+in float v_coverage;
+
+out f16vec4 frag_color;
+
+void main() {
+  // The color is premultiplied, so the coverage scales all of its channels.
+  frag_color = v_color * float16_t(v_coverage);
+}
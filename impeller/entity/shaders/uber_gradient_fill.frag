@@ -0,0 +1,76 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+precision mediump float;
+
+#include <impeller/color.glsl>
+#include <impeller/constants.glsl>
+#include <impeller/gradient.glsl>
+#include <impeller/texture.glsl>
+#include <impeller/types.glsl>
+
+// These values must correspond to the order of the items in the
+// 'UberGradientKind' enum class.
+const float kLinear = 0.0;
+const float kRadial = 1.0;
+const float kConical = 2.0;
+const float kSweep = 3.0;
+
+uniform sampler2D texture_sampler;
+
+uniform FragInfo {
+  // The start point of linear gradients and the center of the others.
+  highp vec2 center;
+  // The end point of linear gradients and the focus of conical gradients.
+  highp vec2 end_point;
+  float kind;
+  float radius;
+  float focus_radius;
+  float bias;
+  float scale;
+  float tile_mode;
+  vec4 decal_border_color;
+  float texture_sampler_y_coord_scale;
+  float alpha;
+  vec2 half_texel;
+}
+frag_info;
+
+highp in vec2 v_position;
+
+out vec4 frag_color;
+
+void main() {
+  float t;
+  if (frag_info.kind == kLinear) {
+    vec2 start_to_end = frag_info.end_point - frag_info.center;
+    vec2 start_to_position = v_position - frag_info.center;
+    t = dot(start_to_position, start_to_end) /
+        dot(start_to_end, start_to_end);
+  } else if (frag_info.kind == kRadial) {
+    t = length(v_position - frag_info.center) / frag_info.radius;
+  } else if (frag_info.kind == kConical) {
+    vec2 res =
+        IPComputeConicalT(frag_info.end_point, frag_info.focus_radius,
+                          frag_info.center, frag_info.radius, v_position);
+    if (res.y < 0.0) {
+      frag_color = vec4(0);
+      return;
+    }
+    t = res.x;
+  } else {
+    vec2 coord = v_position - frag_info.center;
+    float angle = atan(-coord.y, -coord.x);
+    t = (angle * k1Over2Pi + 0.5 + frag_info.bias) * frag_info.scale;
+  }
+
+  frag_color =
+      IPSampleLinearWithTileMode(texture_sampler,                          //
+                                 vec2(t, 0.5),                             //
+                                 frag_info.texture_sampler_y_coord_scale,  //
+                                 frag_info.half_texel,                     //
+                                 frag_info.tile_mode,                      //
+                                 frag_info.decal_border_color);
+  frag_color = IPPremultiply(frag_color) * frag_info.alpha;
+}
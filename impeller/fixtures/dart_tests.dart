@@ -227,3 +227,57 @@ void canCreateRenderPassAndSubmit() {
 
   commandBuffer.submit();
 }
+
+@pragma('vm:entry-point')
+void canSubmitCommandBufferAsync() {
+  final gpu.Texture? renderTexture =
+      gpu.gpuContext.createTexture(gpu.StorageMode.devicePrivate, 100, 100);
+  assert(renderTexture != null);
+
+  final gpu.CommandBuffer commandBuffer = gpu.gpuContext.createCommandBuffer();
+  final gpu.RenderTarget renderTarget = gpu.RenderTarget.singleColor(
+    gpu.ColorAttachment(texture: renderTexture!),
+  );
+  commandBuffer.createRenderPass(renderTarget);
+
+  // The future completes in a later UI task, after this entry point returns.
+  commandBuffer.submitAsync();
+}
+
+@pragma('vm:entry-point')
+void computePipelineThrowsForNonComputeShader() {
+  final gpu.ShaderLibrary? library = gpu.ShaderLibrary.fromAsset('playground');
+  assert(library != null);
+  final gpu.Shader? vertex = library!['UnlitVertex'];
+  assert(vertex != null);
+  String? exception;
+  try {
+    gpu.gpuContext.createComputePipeline(vertex!);
+  } catch (e) {
+    exception = e.toString();
+  }
+  assert(exception != null);
+}
+
+@pragma('vm:entry-point')
+void computePassDispatchThrowsWithoutPipeline() {
+  if (!gpu.gpuContext.doesSupportCompute) {
+    return;
+  }
+  final gpu.CommandBuffer commandBuffer = gpu.gpuContext.createCommandBuffer();
+  final gpu.ComputePass computePass = commandBuffer.createComputePass();
+  final gpu.DeviceBuffer? deviceBuffer =
+      gpu.gpuContext.createDeviceBuffer(gpu.StorageMode.hostVisible, 16);
+  assert(deviceBuffer != null);
+  computePass.bindBuffer(
+      0, gpu.BufferView(deviceBuffer!, offsetInBytes: 0, lengthInBytes: 16));
+  computePass.setGridSize(4, 1);
+  computePass.setThreadGroupSize(4, 1);
+  String? exception;
+  try {
+    computePass.dispatch();
+  } catch (e) {
+    exception = e.toString();
+  }
+  assert(exception!.contains('Failed to append dispatch'));
+}
@@ -4,8 +4,10 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 
+#include "impeller/geometry/matrix.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
+#include "impeller/geometry/rect.h"
 #include "impeller/tessellator/tessellator.h"
 
 namespace impeller {
@@ -18,6 +20,10 @@ Path CreateCubic();
 Path CreateQuadratic();
 /// Create a rounded rect.
 Path CreateRRect();
+/// A glyph outline made entirely of cubics, in font units.
+Path CreateCubicGlyph();
+/// Many small ovals and rounded rects, as found in SVG icon sets.
+Path CreateSVGIcons();
 }  // namespace
 
 static Tessellator tess;
@@ -82,10 +88,94 @@ static void BM_Convex(benchmark::State& state, Args&&... args) {
   state.counters["TotalPointCount"] = point_count;
 }
 
+static Matrix CreateAffineTransform() {
+  return Matrix::MakeTranslation({100, 200, 0}) *
+         Matrix::MakeRotationZ(Degrees{30}) * Matrix::MakeScale({2, 2, 1});
+}
+
+static Matrix CreatePerspectiveTransform() {
+  return Matrix::MakePerspective(Degrees{60}, 1.5, 1, 100) *
+         Matrix::MakeTranslation({0, 0, 10}) * CreateAffineTransform();
+}
+
+static void BM_TransformPoints(benchmark::State& state, Matrix transform) {
+  std::vector<Point> points(state.range(0));
+  for (size_t i = 0; i < points.size(); i++) {
+    points[i] = Point(i % 640, i / 640);
+  }
+  std::vector<Point> transformed(points.size());
+  for (auto _ : state) {
+    transform.TransformPoints(points.data(), transformed.data(),
+                              points.size());
+    benchmark::DoNotOptimize(transformed.data());
+  }
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+static void BM_TransformPointsOneByOne(benchmark::State& state,
+                                       Matrix transform) {
+  std::vector<Point> points(state.range(0));
+  for (size_t i = 0; i < points.size(); i++) {
+    points[i] = Point(i % 640, i / 640);
+  }
+  std::vector<Point> transformed(points.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < points.size(); i++) {
+      transformed[i] = transform * points[i];
+    }
+    benchmark::DoNotOptimize(transformed.data());
+  }
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+static void BM_MatrixMultiply(benchmark::State& state) {
+  Matrix a = CreateAffineTransform();
+  Matrix b = CreatePerspectiveTransform();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    Matrix result = a * b;
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_TransformBounds(benchmark::State& state, Matrix transform) {
+  Rect rect = Rect::MakeLTRB(10, 20, 300, 400);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect);
+    Rect bounds = rect.TransformBounds(transform);
+    benchmark::DoNotOptimize(bounds);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_TransformPoints, affine, CreateAffineTransform())
+    ->Range(16, 16384);
+BENCHMARK_CAPTURE(BM_TransformPoints,
+                  perspective,
+                  CreatePerspectiveTransform())
+    ->Range(16, 16384);
+BENCHMARK_CAPTURE(BM_TransformPointsOneByOne, affine, CreateAffineTransform())
+    ->Range(16, 16384);
+BENCHMARK(BM_MatrixMultiply);
+BENCHMARK_CAPTURE(BM_TransformBounds,
+                  translate_scale,
+                  Matrix::MakeTranslation({5, 5, 0}) *
+                      Matrix::MakeScale({2, 3, 1}));
+BENCHMARK_CAPTURE(BM_TransformBounds, affine, CreateAffineTransform());
+
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline, CreateCubic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline_tess, CreateCubic(), true);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline, CreateQuadratic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline_tess, CreateQuadratic(), true);
+BENCHMARK_CAPTURE(BM_Polyline, cubic_glyph_polyline, CreateCubicGlyph(), false);
+BENCHMARK_CAPTURE(BM_Polyline,
+                  cubic_glyph_polyline_tess,
+                  CreateCubicGlyph(),
+                  true);
+BENCHMARK_CAPTURE(BM_Polyline, svg_icons_polyline, CreateSVGIcons(), false);
+BENCHMARK_CAPTURE(BM_Polyline, svg_icons_polyline_tess, CreateSVGIcons(), true);
 BENCHMARK_CAPTURE(BM_Convex, rrect_convex, CreateRRect(), true);
 
 namespace {
@@ -359,5 +449,59 @@ Path CreateQuadratic() {
       .TakePath();
 }
 
+Path CreateCubicGlyph() {
+  // An "S" shaped outline with an em size of 2048, similar to the outlines
+  // produced for large text by the typographer.
+  return PathBuilder{}
+      .MoveTo({1112, 382})
+      .CubicCurveTo({1112, 487}, {1075, 568}, {1001, 625})
+      .CubicCurveTo({927, 683}, {801, 737}, {623, 788})
+      .CubicCurveTo({445, 839}, {318, 900}, {241, 971})
+      .CubicCurveTo({165, 1041}, {127, 1128}, {127, 1233})
+      .CubicCurveTo({127, 1351}, {174, 1449}, {268, 1526})
+      .CubicCurveTo({363, 1603}, {486, 1642}, {637, 1642})
+      .CubicCurveTo({740, 1642}, {832, 1622}, {913, 1582})
+      .CubicCurveTo({994, 1542}, {1057, 1487}, {1101, 1417})
+      .CubicCurveTo({1145, 1347}, {1167, 1271}, {1167, 1188})
+      .LineTo({968, 1188})
+      .CubicCurveTo({968, 1279}, {939, 1350}, {881, 1402})
+      .CubicCurveTo({823, 1454}, {742, 1480}, {637, 1480})
+      .CubicCurveTo({540, 1480}, {464, 1459}, {410, 1416})
+      .CubicCurveTo({356, 1374}, {329, 1315}, {329, 1239})
+      .CubicCurveTo({329, 1178}, {355, 1127}, {406, 1085})
+      .CubicCurveTo({458, 1043}, {546, 1005}, {670, 970})
+      .CubicCurveTo({795, 935}, {892, 896}, {962, 853})
+      .CubicCurveTo({1033, 811}, {1085, 761}, {1119, 704})
+      .CubicCurveTo({1154, 647}, {1171, 580}, {1171, 503})
+      .CubicCurveTo({1171, 383}, {1124, 287}, {1030, 215})
+      .CubicCurveTo({936, 144}, {811, 108}, {654, 108})
+      .CubicCurveTo({552, 108}, {457, 128}, {369, 167})
+      .CubicCurveTo({281, 207}, {213, 261}, {165, 330})
+      .CubicCurveTo({118, 399}, {94, 477}, {94, 565})
+      .LineTo({293, 565})
+      .CubicCurveTo({293, 474}, {327, 402}, {394, 349})
+      .CubicCurveTo({461, 297}, {548, 270}, {654, 270})
+      .CubicCurveTo({753, 270}, {829, 290}, {882, 331})
+      .CubicCurveTo({935, 371}, {961, 425}, {961, 494})
+      .Close()
+      .TakePath();
+}
+
+Path CreateSVGIcons() {
+  PathBuilder builder;
+  for (auto i = 0; i < 16; i++) {
+    for (auto j = 0; j < 16; j++) {
+      auto origin = Point(i * 24.0f, j * 24.0f);
+      if ((i + j) % 2 == 0) {
+        builder.AddOval(Rect::MakeOriginSize(origin + Point(2, 2), {20, 20}));
+      } else {
+        builder.AddRoundedRect(
+            Rect::MakeOriginSize(origin + Point(2, 2), {20, 20}), 4);
+      }
+    }
+  }
+  return builder.TakePath();
+}
+
 }  // namespace
 }  // namespace impeller
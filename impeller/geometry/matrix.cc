@@ -7,8 +7,107 @@
 #include <climits>
 #include <sstream>
 
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define IMPELLER_MATRIX_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IMPELLER_MATRIX_SSE 1
+#endif
+
 namespace impeller {
 
+static_assert(sizeof(Point) == 2 * sizeof(float));
+
+Matrix Matrix::operator*(const Matrix& o) const {
+#if defined(IMPELLER_MATRIX_NEON)
+  float32x4_t c0 = vld1q_f32(&m[0]);
+  float32x4_t c1 = vld1q_f32(&m[4]);
+  float32x4_t c2 = vld1q_f32(&m[8]);
+  float32x4_t c3 = vld1q_f32(&m[12]);
+  Matrix result;
+  for (int i = 0; i < 4; i++) {
+    const Scalar* column = &o.m[i * 4];
+    float32x4_t r = vmulq_n_f32(c0, column[0]);
+    r = vaddq_f32(r, vmulq_n_f32(c1, column[1]));
+    r = vaddq_f32(r, vmulq_n_f32(c2, column[2]));
+    r = vaddq_f32(r, vmulq_n_f32(c3, column[3]));
+    vst1q_f32(&result.m[i * 4], r);
+  }
+  return result;
+#elif defined(IMPELLER_MATRIX_SSE)
+  __m128 c0 = _mm_loadu_ps(&m[0]);
+  __m128 c1 = _mm_loadu_ps(&m[4]);
+  __m128 c2 = _mm_loadu_ps(&m[8]);
+  __m128 c3 = _mm_loadu_ps(&m[12]);
+  Matrix result;
+  for (int i = 0; i < 4; i++) {
+    const Scalar* column = &o.m[i * 4];
+    __m128 r = _mm_mul_ps(c0, _mm_set1_ps(column[0]));
+    r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(column[1])));
+    r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(column[2])));
+    r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(column[3])));
+    _mm_storeu_ps(&result.m[i * 4], r);
+  }
+  return result;
+#else
+  return Multiply(o);
+#endif
+}
+
+void Matrix::TransformPoints(const Point* source,
+                             Point* destination,
+                             size_t count) const {
+  if (HasPerspective()) {
+    for (size_t i = 0; i < count; i++) {
+      destination[i] = *this * source[i];
+    }
+    return;
+  }
+
+  size_t i = 0;
+  // Four points at a time, as separate vectors of their x and y coordinates.
+#if defined(IMPELLER_MATRIX_NEON)
+  for (; i + 4 <= count; i += 4) {
+    float32x4x2_t xy = vld2q_f32(reinterpret_cast<const float*>(source + i));
+    float32x4x2_t result;
+    result.val[0] = vaddq_f32(
+        vaddq_f32(vmulq_n_f32(xy.val[0], m[0]), vmulq_n_f32(xy.val[1], m[4])),
+        vdupq_n_f32(m[12]));
+    result.val[1] = vaddq_f32(
+        vaddq_f32(vmulq_n_f32(xy.val[0], m[1]), vmulq_n_f32(xy.val[1], m[5])),
+        vdupq_n_f32(m[13]));
+    vst2q_f32(reinterpret_cast<float*>(destination + i), result);
+  }
+#elif defined(IMPELLER_MATRIX_SSE)
+  const __m128 m0 = _mm_set1_ps(m[0]);
+  const __m128 m1 = _mm_set1_ps(m[1]);
+  const __m128 m4 = _mm_set1_ps(m[4]);
+  const __m128 m5 = _mm_set1_ps(m[5]);
+  const __m128 m12 = _mm_set1_ps(m[12]);
+  const __m128 m13 = _mm_set1_ps(m[13]);
+  for (; i + 4 <= count; i += 4) {
+    const float* in = reinterpret_cast<const float*>(source + i);
+    __m128 p01 = _mm_loadu_ps(in);
+    __m128 p23 = _mm_loadu_ps(in + 4);
+    __m128 x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+    __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m0), _mm_mul_ps(y, m4)),
+                           m12);
+    __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m1), _mm_mul_ps(y, m5)),
+                           m13);
+    float* out = reinterpret_cast<float*>(destination + i);
+    _mm_storeu_ps(out, _mm_unpacklo_ps(rx, ry));
+    _mm_storeu_ps(out + 4, _mm_unpackhi_ps(rx, ry));
+  }
+#endif
+  for (; i < count; i++) {
+    Point point = source[i];
+    destination[i] = {point.x * m[0] + point.y * m[4] + m[12],
+                      point.x * m[1] + point.y * m[5] + m[13]};
+  }
+}
+
 Matrix::Matrix(const MatrixDecomposition& d) : Matrix() {
   /*
    *  Apply perspective.
@@ -391,7 +391,8 @@ struct Matrix {
 
   Matrix operator-(const Vector3& t) const { return Translate(-t); }
 
-  Matrix operator*(const Matrix& m) const { return Multiply(m); }
+  /// Same as `Multiply`, vectorized on platforms with NEON or SSE.
+  Matrix operator*(const Matrix& m) const;
 
   Matrix operator+(const Matrix& m) const;
 
@@ -445,6 +446,18 @@ struct Matrix {
     return Vector2(v.x * m[0] + v.y * m[4], v.x * m[1] + v.y * m[5]);
   }
 
+  /// @brief  Transforms `count` points from `source` into `destination`, with
+  ///         the same result as `*this * point` for each. The two may be the
+  ///         same buffer.
+  ///
+  ///         The perspective divide is only done for matrices that have
+  ///         perspective and the affine case is vectorized on platforms with
+  ///         NEON or SSE, so prefer this over transforming points one at a
+  ///         time in loops.
+  void TransformPoints(const Point* source,
+                       Point* destination,
+                       size_t count) const;
+
   constexpr Quad Transform(const Quad& quad) const {
     return {
         *this * quad[0],
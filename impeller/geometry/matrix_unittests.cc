@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "flutter/impeller/geometry/matrix.h"
@@ -24,5 +26,40 @@ TEST(MatrixTest, Multiply) {
                                         11.0, 21.0, 0.0, 1.0)));
 }
 
+TEST(MatrixTest, VectorizedMultiplyMatchesScalarMultiply) {
+  Matrix a = Matrix::MakeTranslation({10, 20, 1}) *
+             Matrix::MakeRotationZ(Degrees{30}) *
+             Matrix::MakeScale({2, 3, 4});
+  Matrix b = Matrix::MakePerspective(Degrees{60}, 1.5, 1, 100) *
+             Matrix::MakeRotationX(Degrees{15});
+  EXPECT_MATRIX_NEAR(a * b, a.Multiply(b));
+  EXPECT_MATRIX_NEAR(b * a, b.Multiply(a));
+}
+
+TEST(MatrixTest, TransformPointsMatchesTransformingEachPoint) {
+  std::vector<Point> points;
+  for (int i = 0; i < 11; i++) {
+    points.emplace_back(i * 3.5f - 10, i * -2.0f + 4);
+  }
+  for (const auto& matrix : {
+           Matrix::MakeTranslation({10, 20, 0}) *
+               Matrix::MakeRotationZ(Degrees{45}) *
+               Matrix::MakeScale({2, 3, 1}),
+           Matrix::MakePerspective(Degrees{60}, 1.5, 1, 100) *
+               Matrix::MakeTranslation({0, 0, 10}),
+       }) {
+    std::vector<Point> transformed(points.size());
+    matrix.TransformPoints(points.data(), transformed.data(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+      EXPECT_POINT_NEAR(transformed[i], matrix * points[i]);
+    }
+
+    // In place.
+    auto in_place = points;
+    matrix.TransformPoints(in_place.data(), in_place.data(), in_place.size());
+    EXPECT_EQ(in_place, transformed);
+  }
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -4,6 +4,7 @@
 
 #include "impeller/geometry/path.h"
 
+#include <algorithm>
 #include <optional>
 #include <variant>
 
@@ -60,10 +61,37 @@ bool Path::IsConvex() const {
   return convexity_ == Convexity::kConvex;
 }
 
+std::optional<uint64_t> Path::GetCacheKey() const {
+  return cache_key_;
+}
+
+void Path::SetCacheKey(std::optional<uint64_t> key) {
+  cache_key_ = key;
+}
+
 void Path::SetConvexity(Convexity value) {
   convexity_ = value;
 }
 
+template <class T>
+static void ReserveAdditionalCapacity(std::vector<T>& vector,
+                                      size_t additional) {
+  const auto required = vector.size() + additional;
+  if (vector.capacity() < required) {
+    // Keep growing geometrically so that paths made of many shapes don't
+    // reallocate for every shape added.
+    vector.reserve(std::max(required, vector.capacity() * 2));
+  }
+}
+
+void Path::ReserveAdditional(size_t points,
+                             size_t components,
+                             size_t contours) {
+  ReserveAdditionalCapacity(points_, points);
+  ReserveAdditionalCapacity(components_, components);
+  ReserveAdditionalCapacity(contours_, contours);
+}
+
 void Path::Shift(Point shift) {
   for (auto i = 0u; i < points_.size(); i++) {
     points_[i] += shift;
@@ -389,6 +417,97 @@ std::optional<Rect> Path::GetBoundingBox() const {
   return computed_bounds_;
 }
 
+void Path::ComputeConvexity() {
+  convexity_ = Convexity::kUnknown;
+
+  // The polygon is walked once, without the repeated points. It is convex if
+  // it only turns one way and doesn't wind around more than once, which
+  // would make its edges change horizontal direction more than twice.
+  std::optional<Point> first;
+  std::optional<Point> second;
+  std::optional<Point> last;
+  std::optional<Vector2> last_edge;
+  Scalar turn = 0;
+  Scalar last_dx = 0;
+  int dx_changes = 0;
+  auto add_point = [&](Point point) -> bool {
+    if (!last.has_value()) {
+      first = last = point;
+      return true;
+    }
+    if (point == last.value()) {
+      return true;
+    }
+    if (!second.has_value()) {
+      second = point;
+    }
+    Vector2 edge = point - last.value();
+    if (last_edge.has_value()) {
+      Scalar cross = last_edge->Cross(edge);
+      if (cross == 0) {
+        // Doubling back on the previous edge.
+        if (last_edge->Dot(edge) < 0) {
+          return false;
+        }
+      } else if (turn == 0) {
+        turn = cross;
+      } else if ((cross > 0) != (turn > 0)) {
+        return false;
+      }
+    }
+    if (edge.x != 0) {
+      if (last_dx != 0 && (edge.x > 0) != (last_dx > 0)) {
+        dx_changes++;
+      }
+      last_dx = edge.x;
+    }
+    last_edge = edge;
+    last = point;
+    return true;
+  };
+
+  bool has_segments = false;
+  bool after_contour = false;
+  for (const auto& component : components_) {
+    size_t point_count = 0;
+    switch (component.type) {
+      case ComponentType::kContour:
+        after_contour = true;
+        continue;
+      case ComponentType::kLinear:
+        point_count = 2;
+        break;
+      case ComponentType::kQuadratic:
+        point_count = 3;
+        break;
+      case ComponentType::kCubic:
+        point_count = 4;
+        break;
+    }
+    // Only single contours are considered.
+    if (after_contour && has_segments) {
+      return;
+    }
+    after_contour = false;
+    has_segments = true;
+    for (size_t i = 0; i < point_count; i++) {
+      if (!add_point(points_[component.index + i])) {
+        return;
+      }
+    }
+  }
+
+  // Fills are implicitly closed, so walk back to the start and over the first
+  // edge again to check the turns at both ends.
+  if (!second.has_value() || !add_point(first.value()) ||
+      !add_point(second.value())) {
+    return;
+  }
+  if (turn != 0 && dx_changes <= 2) {
+    convexity_ = Convexity::kConvex;
+  }
+}
+
 void Path::ComputeBounds() {
   auto min_max = GetMinMaxCoveragePoints();
   if (!min_max.has_value()) {
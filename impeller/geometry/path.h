@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <set>
@@ -143,6 +144,13 @@ class Path {
 
   bool IsConvex() const;
 
+  /// @brief An identifier shared by every path with the same contents that
+  ///        won't change between frames, such as a non-volatile SkPath, or
+  ///        std::nullopt if there is none.
+  ///
+  ///        Geometries may cache the tessellation of a path with a key.
+  std::optional<uint64_t> GetCacheKey() const;
+
   template <class T>
   using Applier = std::function<void(size_t index, const T& component)>;
   void EnumerateComponents(
@@ -191,6 +199,12 @@ class Path {
 
   void SetBounds(Rect rect);
 
+  void SetCacheKey(std::optional<uint64_t> key);
+
+  /// @brief Make room for the given number of additional points, components
+  ///        and contours without reallocating each buffer as it grows.
+  void ReserveAdditional(size_t points, size_t components, size_t contours);
+
   Path& AddLinearComponent(const Point& p1, const Point& p2);
 
   Path& AddQuadraticComponent(const Point& p1,
@@ -210,6 +224,13 @@ class Path {
   /// with already computed bounds, such as an SkPath.
   void ComputeBounds();
 
+  /// @brief Called by `PathBuilder` to detect paths that are a single convex
+  ///        contour when the builder wasn't told the convexity.
+  ///
+  /// Curves are judged by their control points, which contain them, so a
+  /// curved path may be conservatively reported as not convex.
+  void ComputeConvexity();
+
   void SetContourClosed(bool is_closed);
 
   void Shift(Point shift);
@@ -231,6 +252,7 @@ class Path {
   std::vector<ContourComponent> contours_;
 
   std::optional<Rect> computed_bounds_;
+  std::optional<uint64_t> cache_key_;
 };
 
 }  // namespace impeller
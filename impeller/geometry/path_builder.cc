@@ -22,16 +22,20 @@ Path PathBuilder::TakePath(FillType fill) {
   auto path = std::move(prototype_);
   path.SetFillType(fill);
   path.SetConvexity(convexity_);
+  if (convexity_ == Convexity::kUnknown) {
+    path.ComputeConvexity();
+  }
   if (!did_compute_bounds_) {
     path.ComputeBounds();
   }
   did_compute_bounds_ = false;
+  prototype_.SetCacheKey(std::nullopt);
   return path;
 }
 
 void PathBuilder::Reserve(size_t point_size, size_t verb_size) {
   prototype_.points_.reserve(point_size);
-  prototype_.points_.reserve(verb_size);
+  prototype_.components_.reserve(verb_size);
 }
 
 PathBuilder& PathBuilder::MoveTo(Point point, bool relative) {
@@ -114,6 +118,9 @@ PathBuilder& PathBuilder::AddCubicCurve(Point p1,
 }
 
 PathBuilder& PathBuilder::AddRect(Rect rect) {
+  // A move, four lines with two points each, and the closing contour.
+  prototype_.ReserveAdditional(8u, 6u, 2u);
+
   current_ = rect.origin;
 
   auto tl = rect.origin;
@@ -150,6 +157,9 @@ PathBuilder& PathBuilder::AddRoundedRect(Rect rect, RoundingRadii radii) {
     return AddRect(rect);
   }
 
+  // A move, four lines and four cubics, plus the closing line and contour.
+  prototype_.ReserveAdditional(26u, 11u, 2u);
+
   current_ = rect.origin + Point{radii.top_left.x, 0.0};
 
   MoveTo({rect.origin.x + radii.top_left.x, rect.origin.y});
@@ -328,6 +338,9 @@ PathBuilder& PathBuilder::AddOval(const Rect& container) {
   const Point c = {container.origin.x + r.x, container.origin.y + r.y};
   const Point m = {kArcApproximationMagic * r.x, kArcApproximationMagic * r.y};
 
+  // A move and four cubics, plus the closing line and contour.
+  prototype_.ReserveAdditional(18u, 7u, 2u);
+
   MoveTo({c.x, c.y - r.y});
 
   //----------------------------------------------------------------------------
@@ -409,4 +422,9 @@ PathBuilder& PathBuilder::SetBounds(Rect bounds) {
   return *this;
 }
 
+PathBuilder& PathBuilder::SetCacheKey(uint64_t key) {
+  prototype_.SetCacheKey(key);
+  return *this;
+}
+
 }  // namespace impeller
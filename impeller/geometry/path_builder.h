@@ -103,6 +103,12 @@ class PathBuilder {
   ///        recomputing these bounds.
   PathBuilder& SetBounds(Rect bounds);
 
+  /// @brief Set the key that will be returned by `Path.GetCacheKey`.
+  ///
+  ///        The key must be unique to the contents of the path once it is
+  ///        taken, so it should be set after the path is built.
+  PathBuilder& SetCacheKey(uint64_t key);
+
   struct RoundingRadii {
     Point top_left;
     Point bottom_left;
@@ -100,7 +100,10 @@ Point QuadraticPathComponent::SolveDerivative(Scalar time) const {
 
 static Scalar ApproximateParabolaIntegral(Scalar x) {
   constexpr Scalar d = 0.67;
-  return x / (1.0 - d + sqrt(sqrt(pow(d, 4) + 0.25 * x * x)));
+  // This is evaluated for every point of every flattened curve, so avoid
+  // calling `pow` for what is a constant.
+  constexpr double d4 = static_cast<double>(d) * d * d * d;
+  return x / (1.0 - d + sqrt(sqrt(d4 + 0.25 * x * x)));
 }
 
 void QuadraticPathComponent::AppendPolylinePoints(
@@ -137,6 +140,7 @@ void QuadraticPathComponent::AppendPolylinePoints(
 
   auto line_count = std::max(1., ceil(0.5 * val / sqrt_tolerance));
   auto step = 1 / line_count;
+  points.reserve(points.size() + static_cast<size_t>(line_count));
   for (size_t i = 1; i < line_count; i += 1) {
     auto u = i * step;
     auto a = a0 + (a2 - a0) * u;
@@ -188,10 +192,10 @@ Point CubicPathComponent::SolveDerivative(Scalar time) const {
 void CubicPathComponent::AppendPolylinePoints(
     Scalar scale,
     std::vector<Point>& points) const {
-  auto quads = ToQuadraticPathComponents(.1);
-  for (const auto& quad : quads) {
-    quad.AppendPolylinePoints(scale, points);
-  }
+  ToQuadraticPathComponents(
+      .1, [scale, &points](const QuadraticPathComponent& quad) {
+        quad.AppendPolylinePoints(scale, points);
+      });
 }
 
 inline QuadraticPathComponent CubicPathComponent::Lower() const {
@@ -212,6 +216,16 @@ CubicPathComponent CubicPathComponent::Subsegment(Scalar t0, Scalar t1) const {
 std::vector<QuadraticPathComponent>
 CubicPathComponent::ToQuadraticPathComponents(Scalar accuracy) const {
   std::vector<QuadraticPathComponent> quads;
+  ToQuadraticPathComponents(accuracy,
+                            [&quads](const QuadraticPathComponent& quad) {
+                              quads.emplace_back(quad);
+                            });
+  return quads;
+}
+
+void CubicPathComponent::ToQuadraticPathComponents(
+    Scalar accuracy,
+    const QuadraticPathComponentProc& proc) const {
   // The maximum error, as a vector from the cubic to the best approximating
   // quadratic, is proportional to the third derivative, which is constant
   // across the segment. Thus, the error scales down as the third power of
@@ -229,17 +243,14 @@ CubicPathComponent::ToQuadraticPathComponents(Scalar accuracy) const {
   auto p = p2x2 - p1x2;
   auto err = p.Dot(p);
   auto quad_count = std::max(1., ceil(pow(err / max_hypot2, 1. / 6.0)));
-  quads.reserve(quad_count);
   for (size_t i = 0; i < quad_count; i++) {
     auto t0 = i / quad_count;
     auto t1 = (i + 1) / quad_count;
     auto seg = Subsegment(t0, t1);
     auto p1x2 = 3.0 * seg.cp1 - seg.p1;
     auto p2x2 = 3.0 * seg.cp2 - seg.p2;
-    quads.emplace_back(
-        QuadraticPathComponent(seg.p1, ((p1x2 + p2x2) / 4.0), seg.p2));
+    proc(QuadraticPathComponent(seg.p1, ((p1x2 + p2x2) / 4.0), seg.p2));
   }
-  return quads;
 }
 
 static inline bool NearEqual(Scalar a, Scalar b, Scalar epsilon) {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -127,6 +128,14 @@ struct CubicPathComponent {
   std::vector<QuadraticPathComponent> ToQuadraticPathComponents(
       Scalar accuracy) const;
 
+  using QuadraticPathComponentProc =
+      std::function<void(const QuadraticPathComponent& quad)>;
+
+  // Like the overload above, but hands each quadratic to the callback instead
+  // of collecting them in a vector.
+  void ToQuadraticPathComponents(Scalar accuracy,
+                                 const QuadraticPathComponentProc& proc) const;
+
   CubicPathComponent Subsegment(Scalar t0, Scalar t1) const;
 
   bool operator==(const CubicPathComponent& other) const {
@@ -443,6 +443,54 @@ TEST(PathTest, SimplePath) {
       });
 }
 
+TEST(PathTest, PathBuilderDetectsConvexPaths) {
+  EXPECT_TRUE(PathBuilder{}
+                  .AddRect(Rect::MakeLTRB(0, 0, 10, 10))
+                  .TakePath()
+                  .IsConvex());
+  EXPECT_TRUE(PathBuilder{}.AddCircle({50, 50}, 20).TakePath().IsConvex());
+  EXPECT_TRUE(PathBuilder{}
+                  .AddRoundedRect(Rect::MakeLTRB(0, 0, 100, 50), 10)
+                  .TakePath()
+                  .IsConvex());
+  // Fills are implicitly closed.
+  EXPECT_TRUE(PathBuilder{}
+                  .MoveTo({0, 0})
+                  .LineTo({10, 0})
+                  .LineTo({10, 10})
+                  .TakePath()
+                  .IsConvex());
+
+  // Concave.
+  EXPECT_FALSE(PathBuilder{}
+                   .MoveTo({0, 0})
+                   .LineTo({10, 0})
+                   .LineTo({5, 2})
+                   .LineTo({10, 10})
+                   .Close()
+                   .TakePath()
+                   .IsConvex());
+  // A pentagram only turns one way, but winds around twice.
+  EXPECT_FALSE(PathBuilder{}
+                   .MoveTo({50, 0})
+                   .LineTo({79, 90})
+                   .LineTo({2, 35})
+                   .LineTo({98, 35})
+                   .LineTo({21, 90})
+                   .Close()
+                   .TakePath()
+                   .IsConvex());
+  // Multiple contours.
+  EXPECT_FALSE(PathBuilder{}
+                   .AddRect(Rect::MakeLTRB(0, 0, 10, 10))
+                   .AddRect(Rect::MakeLTRB(20, 0, 30, 10))
+                   .TakePath()
+                   .IsConvex());
+  // Degenerate.
+  EXPECT_FALSE(
+      PathBuilder{}.MoveTo({0, 0}).LineTo({10, 10}).TakePath().IsConvex());
+}
+
 TEST(PathTest, CanBeCloned) {
   PathBuilder builder;
   builder.MoveTo({10, 10});
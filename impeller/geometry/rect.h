@@ -216,6 +216,14 @@ struct TRect {
   /// @brief  Creates a new bounding box that contains this transformed
   ///         rectangle.
   constexpr TRect TransformBounds(const Matrix& transform) const {
+    // Most transforms only translate and scale, which map the corners of the
+    // rectangle to the corners of its bounds.
+    if (transform.IsTranslationScaleOnly()) {
+      auto p1 = transform * origin;
+      auto p2 = transform * (origin + size);
+      return TRect::MakeLTRB(std::min(p1.x, p2.x), std::min(p1.y, p2.y),
+                             std::max(p1.x, p2.x), std::max(p1.y, p2.y));
+    }
     auto points = GetTransformedPoints(transform);
     auto bounds = TRect::MakePointBounds(points.begin(), points.end());
     if (bounds.has_value()) {
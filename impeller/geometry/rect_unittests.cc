@@ -248,5 +248,20 @@ TEST(RectTest, MakePointBoundsQuad) {
   }
 }
 
+TEST(RectTest, TransformBoundsOfTranslateScaleMatchesCorners) {
+  auto rect = Rect::MakeLTRB(10, 20, 30, 60);
+  for (const auto& transform : {
+           Matrix::MakeTranslation({5, -5, 0}),
+           Matrix::MakeTranslation({5, -5, 0}) * Matrix::MakeScale({-2, 3, 1}),
+           Matrix::MakeScale({0.5, -0.25, 1}),
+       }) {
+    ASSERT_TRUE(transform.IsTranslationScaleOnly());
+    auto points = rect.GetTransformedPoints(transform);
+    EXPECT_RECT_NEAR(rect.TransformBounds(transform),
+                     Rect::MakePointBounds(points.begin(), points.end())
+                         .value());
+  }
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -24,11 +24,18 @@ bool BufferBindingsGLES::RegisterVertexStageInput(
     const std::vector<ShaderStageIOSlot>& p_inputs,
     const std::vector<ShaderStageBufferLayout>& layouts) {
   std::vector<VertexAttribPointer> vertex_attrib_arrays;
+  uint32_t vertex_attrib_array_mask = 0u;
   for (auto i = 0u; i < p_inputs.size(); i++) {
     const auto& input = p_inputs[i];
     const auto& layout = layouts[input.binding];
     VertexAttribPointer attrib;
     attrib.index = input.location;
+    if (attrib.index >= StateCacheGLES::kMaxVertexAttribArrays) {
+      VALIDATION_LOG << "Vertex attribute location " << attrib.index
+                     << " is out of range.";
+      return false;
+    }
+    vertex_attrib_array_mask |= 1u << attrib.index;
     // Component counts must be 1, 2, 3 or 4. Do that validation now.
     if (input.vec_size < 1u || input.vec_size > 4u) {
       return false;
@@ -45,6 +52,7 @@ bool BufferBindingsGLES::RegisterVertexStageInput(
     vertex_attrib_arrays.emplace_back(attrib);
   }
   vertex_attrib_arrays_ = std::move(vertex_attrib_arrays);
+  vertex_attrib_array_mask_ = vertex_attrib_array_mask;
   return true;
 }
 
@@ -89,6 +97,38 @@ bool BufferBindingsGLES::ReadUniformsBindings(const ProcTableGLES& gl,
   GLint uniform_count = 0;
   gl.GetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
 
+  GLint uniform_block_count = 0;
+  if (gl.GetActiveUniformBlockName.IsAvailable() &&
+      gl.UniformBlockBinding.IsAvailable()) {
+    gl.GetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &uniform_block_count);
+  }
+  if (uniform_block_count > 0) {
+    GLint max_block_name_size = 0;
+    gl.GetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH,
+                    &max_block_name_size);
+    // Every block is bound at the binding point of the same index.
+    for (GLint i = 0; i < uniform_block_count; i++) {
+      std::vector<GLchar> name;
+      name.resize(max_block_name_size);
+      GLsizei written_count = 0u;
+      gl.GetActiveUniformBlockName(program,              // program
+                                   i,                    // index
+                                   max_block_name_size,  // buffer_size
+                                   &written_count,       // length
+                                   name.data()           // name
+      );
+      if (written_count <= 0) {
+        VALIDATION_LOG << "Uniform block name could not be read.";
+        return false;
+      }
+      gl.UniformBlockBinding(program, i, i);
+      uniform_block_bindings_[NormalizeUniformKey(std::string{
+          name.data(), static_cast<size_t>(written_count)})] = i;
+    }
+    gl.GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,
+                   &uniform_buffer_offset_alignment_);
+  }
+
   // Query the Program for all active uniform locations, and
   // record this via normalized key.
   for (GLint i = 0; i < uniform_count; i++) {
@@ -109,6 +149,10 @@ bool BufferBindingsGLES::ReadUniformsBindings(const ProcTableGLES& gl,
                         name.data()         // name
     );
     auto location = gl.GetUniformLocation(program, name.data());
+    if (location == -1 && uniform_block_count > 0) {
+      // Members of uniform blocks don't have locations.
+      continue;
+    }
     if (location == -1) {
       VALIDATION_LOG << "Could not query the location of an active uniform.";
       return false;
@@ -123,10 +167,11 @@ bool BufferBindingsGLES::ReadUniformsBindings(const ProcTableGLES& gl,
   return true;
 }
 
-bool BufferBindingsGLES::BindVertexAttributes(const ProcTableGLES& gl,
+bool BufferBindingsGLES::BindVertexAttributes(StateCacheGLES& state,
                                               size_t vertex_offset) const {
+  const auto& gl = state.GetProcTable();
+  state.SetEnabledVertexAttribArrays(vertex_attrib_array_mask_);
   for (const auto& array : vertex_attrib_arrays_) {
-    gl.EnableVertexAttribArray(array.index);
     gl.VertexAttribPointer(array.index,       // index
                            array.size,        // size (must be 1, 2, 3, or 4)
                            array.type,        // type
@@ -170,10 +215,16 @@ bool BufferBindingsGLES::BindUniformData(const ProcTableGLES& gl,
   return true;
 }
 
-bool BufferBindingsGLES::UnbindVertexAttributes(const ProcTableGLES& gl) const {
-  for (const auto& array : vertex_attrib_arrays_) {
-    gl.DisableVertexAttribArray(array.index);
+bool BufferBindingsGLES::UniformDataChanged(GLint location,
+                                            const void* data,
+                                            size_t length) {
+  auto& uploaded = uniform_data_[location];
+  if (uploaded.size() == length &&
+      std::memcmp(uploaded.data(), data, length) == 0) {
+    return false;
   }
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  uploaded.assign(bytes, bytes + length);
   return true;
 }
 
@@ -237,6 +288,23 @@ bool BufferBindingsGLES::BindUniformBuffer(const ProcTableGLES& gl,
     return false;
   }
   const auto& device_buffer_gles = DeviceBufferGLES::Cast(*device_buffer);
+
+  if (!uniform_block_bindings_.empty()) {
+    auto block =
+        uniform_block_bindings_.find(NormalizeUniformKey(metadata->name));
+    if (block != uniform_block_bindings_.end()) {
+      if (uniform_buffer_offset_alignment_ > 0 &&
+          buffer.resource.range.offset % uniform_buffer_offset_alignment_ !=
+              0u) {
+        VALIDATION_LOG << "Uniform buffer offset is not aligned to "
+                       << uniform_buffer_offset_alignment_ << " bytes.";
+        return false;
+      }
+      return device_buffer_gles.BindUniformBufferRange(block->second,
+                                                       buffer.resource.range);
+    }
+  }
+
   const uint8_t* buffer_ptr =
       device_buffer_gles.GetBufferData() + buffer.resource.range.offset;
 
@@ -277,6 +345,12 @@ bool BufferBindingsGLES::BindUniformBuffer(const ProcTableGLES& gl,
           reinterpret_cast<const GLfloat*>(array_element_buffer.data());
     }
 
+    if (member.type == ShaderType::kFloat &&
+        !UniformDataChanged(location, buffer_data,
+                            member.size * element_count)) {
+      continue;
+    }
+
     switch (member.type) {
       case ShaderType::kFloat:
         switch (member.size) {
@@ -385,7 +459,10 @@ std::optional<size_t> BufferBindingsGLES::BindTextures(
     //--------------------------------------------------------------------------
     /// Set the texture uniform location.
     ///
-    gl.Uniform1i(location, active_index);
+    const GLint unit = active_index;
+    if (UniformDataChanged(location, &unit, sizeof(unit))) {
+      gl.Uniform1i(location, unit);
+    }
 
     //--------------------------------------------------------------------------
     /// Bump up the active index at binding.
@@ -11,6 +11,7 @@
 #include "impeller/core/shader_types.h"
 #include "impeller/renderer/backend/gles/gles.h"
 #include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/backend/gles/state_cache_gles.h"
 #include "impeller/renderer/command.h"
 
 namespace impeller {
@@ -32,16 +33,13 @@ class BufferBindingsGLES {
 
   bool ReadUniformsBindings(const ProcTableGLES& gl, GLuint program);
 
-  bool BindVertexAttributes(const ProcTableGLES& gl,
-                            size_t vertex_offset) const;
+  bool BindVertexAttributes(StateCacheGLES& state, size_t vertex_offset) const;
 
   bool BindUniformData(const ProcTableGLES& gl,
                        Allocator& transients_allocator,
                        const Bindings& vertex_bindings,
                        const Bindings& fragment_bindings);
 
-  bool UnbindVertexAttributes(const ProcTableGLES& gl) const;
-
  private:
   //----------------------------------------------------------------------------
   /// @brief      The arguments to glVertexAttribPointer.
@@ -55,9 +53,20 @@ class BufferBindingsGLES {
     GLsizei offset = 0u;
   };
   std::vector<VertexAttribPointer> vertex_attrib_arrays_;
+  uint32_t vertex_attrib_array_mask_ = 0u;
 
   std::unordered_map<std::string, GLint> uniform_locations_;
 
+  // The binding points of the uniform blocks of the program, if it has any.
+  // Programs only have uniform blocks on OpenGL ES 3.
+  std::unordered_map<std::string, GLuint> uniform_block_bindings_;
+  GLint uniform_buffer_offset_alignment_ = 1;
+
+  // The data last uploaded to each uniform location of the program. Uniforms
+  // are program state, so uploads of unchanged data can be skipped even when
+  // other programs were used in between.
+  std::unordered_map<GLint, std::vector<uint8_t>> uniform_data_;
+
   using BindingMap = std::unordered_map<std::string, std::vector<GLint>>;
   BindingMap binding_map_ = {};
 
@@ -66,6 +75,8 @@ class BufferBindingsGLES {
 
   GLint ComputeTextureLocation(const ShaderMetadata* metadata);
 
+  bool UniformDataChanged(GLint location, const void* data, size_t length);
+
   bool BindUniformBuffer(const ProcTableGLES& gl,
                          Allocator& transients_allocator,
                          const BufferResource& buffer);
@@ -24,6 +24,8 @@ class DescriptionGLES {
 
   bool IsES() const;
 
+  Version GetGlVersion() const;
+
   std::string GetString() const;
 
   bool HasExtension(const std::string& ext) const;
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/gles/device_buffer_gles.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 
@@ -38,6 +39,11 @@ uint8_t* DeviceBufferGLES::OnGetContents() const {
   return backing_store_->GetBuffer();
 }
 
+// |DeviceBuffer|
+void DeviceBufferGLES::Flush(Range range) const {
+  MarkDirty(range);
+}
+
 // |DeviceBuffer|
 bool DeviceBufferGLES::OnCopyHostBuffer(const uint8_t* source,
                                         Range source_range,
@@ -52,7 +58,7 @@ bool DeviceBufferGLES::OnCopyHostBuffer(const uint8_t* source,
 
   std::memmove(backing_store_->GetBuffer() + offset,
                source + source_range.offset, source_range.length);
-  ++generation_;
+  MarkDirty(Range{offset, source_range.length});
 
   return true;
 }
@@ -63,6 +69,8 @@ static GLenum ToTarget(DeviceBufferGLES::BindingType type) {
       return GL_ARRAY_BUFFER;
     case DeviceBufferGLES::BindingType::kElementArrayBuffer:
       return GL_ELEMENT_ARRAY_BUFFER;
+    case DeviceBufferGLES::BindingType::kUniformBuffer:
+      return GL_UNIFORM_BUFFER;
   }
   FML_UNREACHABLE();
 }
@@ -83,16 +91,60 @@ bool DeviceBufferGLES::BindAndUploadDataIfNecessary(BindingType type) const {
   gl.BindBuffer(target_type, buffer.value());
 
   if (upload_generation_ != generation_) {
-    TRACE_EVENT1("impeller", "BufferData", "Bytes",
-                 std::to_string(backing_store_->GetLength()).c_str());
-    gl.BufferData(target_type, backing_store_->GetLength(),
-                  backing_store_->GetBuffer(), GL_STATIC_DRAW);
+    if (storage_allocated_ && dirty_range_.has_value()) {
+      // Only re-upload what changed instead of reallocating the storage.
+      TRACE_EVENT1("impeller", "BufferSubData", "Bytes",
+                   std::to_string(dirty_range_->length).c_str());
+      gl.BufferSubData(target_type, dirty_range_->offset, dirty_range_->length,
+                       backing_store_->GetBuffer() + dirty_range_->offset);
+    } else {
+      TRACE_EVENT1("impeller", "BufferData", "Bytes",
+                   std::to_string(backing_store_->GetLength()).c_str());
+      gl.BufferData(target_type, backing_store_->GetLength(),
+                    backing_store_->GetBuffer(), GL_STATIC_DRAW);
+      storage_allocated_ = true;
+    }
     upload_generation_ = generation_;
+    dirty_range_ = Range{};
   }
 
   return true;
 }
 
+bool DeviceBufferGLES::BindUniformBufferRange(GLuint binding,
+                                              Range range) const {
+  if (!BindAndUploadDataIfNecessary(BindingType::kUniformBuffer)) {
+    return false;
+  }
+  const auto& gl = reactor_->GetProcTable();
+  if (!gl.BindBufferRange.IsAvailable()) {
+    VALIDATION_LOG << "Uniform buffers require OpenGL ES 3.";
+    return false;
+  }
+  auto buffer = reactor_->GetGLHandle(handle_);
+  if (!buffer.has_value()) {
+    return false;
+  }
+  gl.BindBufferRange(GL_UNIFORM_BUFFER, binding, buffer.value(), range.offset,
+                     range.length);
+  return true;
+}
+
+void DeviceBufferGLES::MarkDirty(Range range) const {
+  ++generation_;
+  if (!dirty_range_.has_value()) {
+    return;
+  }
+  if (dirty_range_->length == 0u) {
+    dirty_range_ = range;
+    return;
+  }
+  auto begin = std::min(dirty_range_->offset, range.offset);
+  auto end = std::max(dirty_range_->offset + dirty_range_->length,
+                      range.offset + range.length);
+  dirty_range_ = Range{begin, end - begin};
+}
+
 // |DeviceBuffer|
 bool DeviceBufferGLES::SetLabel(const std::string& label) {
   reactor_->SetDebugLabel(handle_, label);
@@ -117,6 +169,7 @@ void DeviceBufferGLES::UpdateBufferData(
     update_buffer_data(backing_store_->GetBuffer(),
                        backing_store_->GetLength());
     ++generation_;
+    dirty_range_.reset();
   }
 }
 
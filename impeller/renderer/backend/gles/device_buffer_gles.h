@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/macros.h"
 #include "impeller/base/allocation.h"
@@ -26,6 +27,9 @@ class DeviceBufferGLES final
   // |DeviceBuffer|
   ~DeviceBufferGLES() override;
 
+  // |DeviceBuffer|
+  void Flush(Range range) const override;
+
   const uint8_t* GetBufferData() const;
 
   void UpdateBufferData(
@@ -34,16 +38,32 @@ class DeviceBufferGLES final
   enum class BindingType {
     kArrayBuffer,
     kElementArrayBuffer,
+    kUniformBuffer,
   };
 
   [[nodiscard]] bool BindAndUploadDataIfNecessary(BindingType type) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Binds a range of the buffer to an indexed uniform buffer
+  ///             binding point, uploading the buffer data first if necessary.
+  ///             Requires OpenGL ES 3.
+  ///
+  [[nodiscard]] bool BindUniformBufferRange(GLuint binding, Range range) const;
+
  private:
   ReactorGLES::Ref reactor_;
   HandleGLES handle_;
   mutable std::shared_ptr<Allocation> backing_store_;
   mutable uint32_t generation_ = 0;
   mutable uint32_t upload_generation_ = 0;
+  // Whether storage for the whole buffer has been allocated with
+  // `glBufferData`. Once it has been, only the dirty range is uploaded.
+  mutable bool storage_allocated_ = false;
+  // The range of the backing store modified since the last upload.
+  // `std::nullopt` if the whole buffer may have been modified.
+  mutable std::optional<Range> dirty_range_;
+
+  void MarkDirty(Range range) const;
 
   // |DeviceBuffer|
   uint8_t* OnGetContents() const override;
@@ -9,6 +9,7 @@
 #include "impeller/renderer/backend/gles/buffer_bindings_gles.h"
 #include "impeller/renderer/backend/gles/handle_gles.h"
 #include "impeller/renderer/backend/gles/reactor_gles.h"
+#include "impeller/renderer/backend/gles/state_cache_gles.h"
 #include "impeller/renderer/pipeline.h"
 
 namespace impeller {
@@ -24,9 +25,7 @@ class PipelineGLES final
 
   const HandleGLES& GetProgramHandle() const;
 
-  [[nodiscard]] bool BindProgram() const;
-
-  [[nodiscard]] bool UnbindProgram() const;
+  [[nodiscard]] bool BindProgram(StateCacheGLES& state) const;
 
   BufferBindingsGLES* GetBufferBindings() const;
 
@@ -128,6 +128,21 @@ ProcTableGLES::ProcTableGLES(Resolver resolver) {
     DiscardFramebufferEXT.Reset();
   }
 
+  if (!description_->HasExtension("GL_OES_EGL_image")) {
+    EGLImageTargetTexture2DOES.Reset();
+  }
+
+  // Some GLES 2 drivers resolve GLES 3 procs they don't implement.
+  if (!description_->GetGlVersion().IsAtLeast(Version(3, 0, 0))) {
+    BindBufferRange.Reset();
+    ClientWaitSync.Reset();
+    DeleteSync.Reset();
+    FenceSync.Reset();
+    GetActiveUniformBlockName.Reset();
+    UniformBlockBinding.Reset();
+    WaitSync.Reset();
+  }
+
   capabilities_ = std::make_shared<CapabilitiesGLES>(*this);
 
   is_valid_ = true;
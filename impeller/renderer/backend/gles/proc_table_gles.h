@@ -111,6 +111,7 @@ struct GLProc {
   PROC(BlendEquationSeparate);               \
   PROC(BlendFuncSeparate);                   \
   PROC(BufferData);                          \
+  PROC(BufferSubData);                       \
   PROC(CheckFramebufferStatus);              \
   PROC(Clear);                               \
   PROC(ClearColor);                          \
@@ -187,11 +188,20 @@ struct GLProc {
   PROC(GetShaderSource);                     \
   PROC(ReadPixels);
 
-#define FOR_EACH_IMPELLER_GLES3_PROC(PROC) PROC(BlitFramebuffer);
+#define FOR_EACH_IMPELLER_GLES3_PROC(PROC) \
+  PROC(BindBufferRange);                   \
+  PROC(BlitFramebuffer);                   \
+  PROC(ClientWaitSync);                    \
+  PROC(DeleteSync);                        \
+  PROC(FenceSync);                         \
+  PROC(GetActiveUniformBlockName);         \
+  PROC(UniformBlockBinding);               \
+  PROC(WaitSync);
 
 #define FOR_EACH_IMPELLER_EXT_PROC(PROC)    \
   PROC(DebugMessageControlKHR);             \
   PROC(DiscardFramebufferEXT);              \
+  PROC(EGLImageTargetTexture2DOES);         \
   PROC(FramebufferTexture2DMultisampleEXT); \
   PROC(PushDebugGroupKHR);                  \
   PROC(PopDebugGroupKHR);                   \
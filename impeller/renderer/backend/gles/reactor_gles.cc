@@ -19,10 +19,22 @@ ReactorGLES::ReactorGLES(std::unique_ptr<ProcTableGLES> gl)
     return;
   }
   can_set_debug_labels_ = proc_table_->GetDescription()->HasDebugExtension();
+  can_upload_concurrently_ = proc_table_->FenceSync.IsAvailable() &&
+                             proc_table_->WaitSync.IsAvailable() &&
+                             proc_table_->ClientWaitSync.IsAvailable() &&
+                             proc_table_->DeleteSync.IsAvailable();
   is_valid_ = true;
 }
 
-ReactorGLES::~ReactorGLES() = default;
+ReactorGLES::~ReactorGLES() {
+  Lock lock(upload_fences_mutex_);
+  if (!upload_fences_.empty() && CanReactOnCurrentThread()) {
+    for (auto fence : upload_fences_) {
+      proc_table_->DeleteSync(fence);
+    }
+  }
+  upload_fences_.clear();
+}
 
 bool ReactorGLES::IsValid() const {
   return is_valid_;
@@ -81,6 +93,36 @@ bool ReactorGLES::AddOperation(Operation operation) {
   return true;
 }
 
+bool ReactorGLES::AddUploadOperation(const HandleGLES& handle,
+                                     Operation operation) {
+  if (!operation) {
+    return false;
+  }
+  if (!can_upload_concurrently_ || !CanReactOnCurrentThread()) {
+    return AddOperation(std::move(operation));
+  }
+  {
+    ReaderLock handles_lock(handles_mutex_);
+    auto found = handles_.find(handle);
+    if (found == handles_.end() || !found->second.IsLive()) {
+      return AddOperation(std::move(operation));
+    }
+  }
+
+  TRACE_EVENT0("impeller", "ReactorGLES::UploadOperation");
+  const auto& gl = GetProcTable();
+  operation(*this);
+  auto fence = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  if (fence == nullptr) {
+    return false;
+  }
+  // Other contexts can only wait on the fence once it has been submitted.
+  gl.Flush();
+  Lock lock(upload_fences_mutex_);
+  upload_fences_.push_back(fence);
+  return true;
+}
+
 static std::optional<GLuint> CreateGLHandle(const ProcTableGLES& gl,
                                             HandleType type) {
   GLuint handle = GL_NONE;
@@ -193,7 +235,35 @@ bool ReactorGLES::ReactOnce() {
     return false;
   }
   TRACE_EVENT0("impeller", __FUNCTION__);
-  return ConsolidateHandles() && FlushOps();
+  if (!ConsolidateHandles()) {
+    return false;
+  }
+  WaitForUploads();
+  return FlushOps();
+}
+
+void ReactorGLES::WaitForUploads() {
+  Lock lock(upload_fences_mutex_);
+  if (upload_fences_.empty()) {
+    return;
+  }
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  const auto& gl = GetProcTable();
+  // Fences are kept until they are signaled, so that operations performed in
+  // any of the contexts of the workers wait for the uploads.
+  auto signaled = [&gl](GLsync fence) {
+    auto status = gl.ClientWaitSync(fence, 0, 0);
+    if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED ||
+        status == GL_WAIT_FAILED) {
+      gl.DeleteSync(fence);
+      return true;
+    }
+    gl.WaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+    return false;
+  };
+  upload_fences_.erase(
+      std::remove_if(upload_fences_.begin(), upload_fences_.end(), signaled),
+      upload_fences_.end());
 }
 
 bool ReactorGLES::ConsolidateHandles() {
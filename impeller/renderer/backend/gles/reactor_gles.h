@@ -208,6 +208,32 @@ class ReactorGLES {
   ///
   [[nodiscard]] bool AddOperation(Operation operation);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Adds an operation that uploads data to the OpenGL object of a
+  ///             reactor handle.
+  ///
+  ///             If the calling thread can react, the handle is live, and the
+  ///             context supports sync objects, the upload is performed on the
+  ///             calling thread right away. It doesn't wait for, or hold up,
+  ///             the operations being performed on other threads. A fence is
+  ///             inserted after the upload, and every reaction waits on the
+  ///             GPU for that fence, until it is signaled, before performing
+  ///             its operations.
+  ///
+  ///             Otherwise, the operation is added like any other.
+  ///
+  ///             The operation may only touch the OpenGL object of the given
+  ///             handle.
+  ///
+  /// @param[in]  handle     The handle whose object the operation uploads to.
+  /// @param[in]  operation  The operation
+  ///
+  /// @return     If the operation was performed or successfully queued for
+  ///             completion.
+  ///
+  [[nodiscard]] bool AddUploadOperation(const HandleGLES& handle,
+                                        Operation operation);
+
   //----------------------------------------------------------------------------
   /// @brief      Perform a reaction on the current thread if able.
   ///
@@ -246,11 +272,16 @@ class ReactorGLES {
   mutable RWMutex handles_mutex_;
   LiveHandles handles_ IPLR_GUARDED_BY(handles_mutex_);
 
+  // Fences inserted after concurrent uploads that may not be signaled yet.
+  Mutex upload_fences_mutex_;
+  std::vector<GLsync> upload_fences_ IPLR_GUARDED_BY(upload_fences_mutex_);
+
   mutable Mutex workers_mutex_;
   mutable std::map<WorkerID, std::weak_ptr<Worker>> workers_
       IPLR_GUARDED_BY(workers_mutex_);
 
   bool can_set_debug_labels_ = false;
+  bool can_upload_concurrently_ = false;
   bool is_valid_ = false;
 
   bool ReactOnce() IPLR_REQUIRES(ops_execution_mutex_);
@@ -261,6 +292,8 @@ class ReactorGLES {
 
   bool ConsolidateHandles();
 
+  void WaitForUploads();
+
   bool FlushOps();
 
   void SetupDebugGroups();
@@ -0,0 +1,210 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/gles/state_cache_gles.h"
+
+namespace impeller {
+
+/// Records the value and returns true if it differs from the cached one.
+template <typename T>
+static bool Update(std::optional<T>& cached, const T& value) {
+  if (cached.has_value() && cached.value() == value) {
+    return false;
+  }
+  cached = value;
+  return true;
+}
+
+template <typename T>
+static bool UpdateFaces(GLenum face,
+                        std::optional<T>& front,
+                        std::optional<T>& back,
+                        const T& value) {
+  bool changed = false;
+  if (face == GL_FRONT || face == GL_FRONT_AND_BACK) {
+    changed |= Update(front, value);
+  }
+  if (face == GL_BACK || face == GL_FRONT_AND_BACK) {
+    changed |= Update(back, value);
+  }
+  return changed;
+}
+
+StateCacheGLES::StateCacheGLES(const ProcTableGLES& gl) : gl_(gl) {}
+
+StateCacheGLES::~StateCacheGLES() = default;
+
+const ProcTableGLES& StateCacheGLES::GetProcTable() const {
+  return gl_;
+}
+
+void StateCacheGLES::Invalidate() {
+  capabilities_ = {};
+  blend_func_.reset();
+  blend_equation_.reset();
+  color_mask_.reset();
+  stencil_front_ = {};
+  stencil_back_ = {};
+  depth_func_.reset();
+  depth_mask_.reset();
+  viewport_.reset();
+  scissor_.reset();
+  cull_face_.reset();
+  front_face_.reset();
+  program_.reset();
+  known_vertex_attrib_arrays_ = 0u;
+  enabled_vertex_attrib_arrays_ = 0u;
+}
+
+void StateCacheGLES::SetCapability(GLenum capability, bool enabled) {
+  std::optional<Capability> tracked;
+  switch (capability) {
+    case GL_BLEND:
+      tracked = Capability::kBlend;
+      break;
+    case GL_CULL_FACE:
+      tracked = Capability::kCullFace;
+      break;
+    case GL_DEPTH_TEST:
+      tracked = Capability::kDepthTest;
+      break;
+    case GL_SCISSOR_TEST:
+      tracked = Capability::kScissorTest;
+      break;
+    case GL_STENCIL_TEST:
+      tracked = Capability::kStencilTest;
+      break;
+  }
+  if (tracked.has_value() &&
+      !Update(capabilities_[static_cast<size_t>(tracked.value())], enabled)) {
+    return;
+  }
+  if (enabled) {
+    gl_.Enable(capability);
+  } else {
+    gl_.Disable(capability);
+  }
+}
+
+void StateCacheGLES::BlendFuncSeparate(GLenum src_color,
+                                       GLenum dst_color,
+                                       GLenum src_alpha,
+                                       GLenum dst_alpha) {
+  if (Update(blend_func_, {src_color, dst_color, src_alpha, dst_alpha})) {
+    gl_.BlendFuncSeparate(src_color, dst_color, src_alpha, dst_alpha);
+  }
+}
+
+void StateCacheGLES::BlendEquationSeparate(GLenum mode_color,
+                                           GLenum mode_alpha) {
+  if (Update(blend_equation_, {mode_color, mode_alpha})) {
+    gl_.BlendEquationSeparate(mode_color, mode_alpha);
+  }
+}
+
+void StateCacheGLES::ColorMask(GLboolean red,
+                               GLboolean green,
+                               GLboolean blue,
+                               GLboolean alpha) {
+  if (Update(color_mask_, {red, green, blue, alpha})) {
+    gl_.ColorMask(red, green, blue, alpha);
+  }
+}
+
+void StateCacheGLES::StencilOpSeparate(GLenum face,
+                                       GLenum stencil_fail,
+                                       GLenum depth_fail,
+                                       GLenum depth_stencil_pass) {
+  if (UpdateFaces(face, stencil_front_.op, stencil_back_.op,
+                  {stencil_fail, depth_fail, depth_stencil_pass})) {
+    gl_.StencilOpSeparate(face, stencil_fail, depth_fail, depth_stencil_pass);
+  }
+}
+
+void StateCacheGLES::StencilFuncSeparate(GLenum face,
+                                         GLenum func,
+                                         GLint ref,
+                                         GLuint mask) {
+  if (UpdateFaces(face, stencil_front_.func, stencil_back_.func,
+                  {static_cast<GLint>(func), ref, static_cast<GLint>(mask)})) {
+    gl_.StencilFuncSeparate(face, func, ref, mask);
+  }
+}
+
+void StateCacheGLES::StencilMaskSeparate(GLenum face, GLuint mask) {
+  if (UpdateFaces(face, stencil_front_.write_mask, stencil_back_.write_mask,
+                  mask)) {
+    gl_.StencilMaskSeparate(face, mask);
+  }
+}
+
+void StateCacheGLES::DepthFunc(GLenum func) {
+  if (Update(depth_func_, func)) {
+    gl_.DepthFunc(func);
+  }
+}
+
+void StateCacheGLES::DepthMask(GLboolean flag) {
+  if (Update(depth_mask_, flag)) {
+    gl_.DepthMask(flag);
+  }
+}
+
+void StateCacheGLES::Viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+  if (Update(viewport_, {x, y, width, height})) {
+    gl_.Viewport(x, y, width, height);
+  }
+}
+
+void StateCacheGLES::Scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+  if (Update(scissor_, {x, y, width, height})) {
+    gl_.Scissor(x, y, width, height);
+  }
+}
+
+void StateCacheGLES::CullFace(GLenum mode) {
+  if (Update(cull_face_, mode)) {
+    gl_.CullFace(mode);
+  }
+}
+
+void StateCacheGLES::FrontFace(GLenum mode) {
+  if (Update(front_face_, mode)) {
+    gl_.FrontFace(mode);
+  }
+}
+
+void StateCacheGLES::UseProgram(GLuint program) {
+  if (Update(program_, program)) {
+    gl_.UseProgram(program);
+  }
+}
+
+void StateCacheGLES::SetEnabledVertexAttribArrays(uint32_t mask) {
+  for (GLuint index = 0u; index < kMaxVertexAttribArrays; index++) {
+    const uint32_t bit = 1u << index;
+    const bool enabled = (mask & bit) != 0u;
+    const bool known = (known_vertex_attrib_arrays_ & bit) != 0u;
+    const bool was_enabled = (enabled_vertex_attrib_arrays_ & bit) != 0u;
+    if (known && enabled == was_enabled) {
+      continue;
+    }
+    // Arrays whose state is unknown are only touched when they are needed.
+    // Disabling them as well would cost a call for every array up to the
+    // limit the first time.
+    if (!known && !enabled) {
+      continue;
+    }
+    if (enabled) {
+      gl_.EnableVertexAttribArray(index);
+      enabled_vertex_attrib_arrays_ |= bit;
+    } else {
+      gl_.DisableVertexAttribArray(index);
+      enabled_vertex_attrib_arrays_ &= ~bit;
+    }
+    known_vertex_attrib_arrays_ |= bit;
+  }
+}
+
+}  // namespace impeller
@@ -0,0 +1,133 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "impeller/renderer/backend/gles/gles.h"
+#include "impeller/renderer/backend/gles/proc_table_gles.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Shadows the OpenGL state that render passes set for every
+///             command and skips the calls that would set state to the value
+///             it already has.
+///
+///             All state starts out unknown, so the first call to set each
+///             piece of state always reaches OpenGL. Because the state is only
+///             known to the cache while all calls that modify it go through
+///             it, a cache must not outlive the reaction it is created in.
+///             Other users of the context, like the embedder, are free to
+///             change the state between reactions.
+///
+class StateCacheGLES {
+ public:
+  /// The most vertex attribute arrays whose state can be tracked.
+  static constexpr GLuint kMaxVertexAttribArrays = 32u;
+
+  explicit StateCacheGLES(const ProcTableGLES& gl);
+
+  ~StateCacheGLES();
+
+  const ProcTableGLES& GetProcTable() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Forgets all state, for use after OpenGL state has been
+  ///             modified without going through the cache.
+  ///
+  void Invalidate();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Enables or disables a capability like `GL_BLEND`.
+  ///             Capabilities that render passes don't use are always passed
+  ///             through.
+  ///
+  void SetCapability(GLenum capability, bool enabled);
+
+  void BlendFuncSeparate(GLenum src_color,
+                         GLenum dst_color,
+                         GLenum src_alpha,
+                         GLenum dst_alpha);
+
+  void BlendEquationSeparate(GLenum mode_color, GLenum mode_alpha);
+
+  void ColorMask(GLboolean red,
+                 GLboolean green,
+                 GLboolean blue,
+                 GLboolean alpha);
+
+  void StencilOpSeparate(GLenum face,
+                         GLenum stencil_fail,
+                         GLenum depth_fail,
+                         GLenum depth_stencil_pass);
+
+  void StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask);
+
+  void StencilMaskSeparate(GLenum face, GLuint mask);
+
+  void DepthFunc(GLenum func);
+
+  void DepthMask(GLboolean flag);
+
+  void Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  void Scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  void CullFace(GLenum mode);
+
+  void FrontFace(GLenum mode);
+
+  void UseProgram(GLuint program);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Enables exactly the vertex attribute arrays whose bits are
+  ///             set in the mask and disables all others.
+  ///
+  void SetEnabledVertexAttribArrays(uint32_t mask);
+
+ private:
+  enum class Capability {
+    kBlend,
+    kCullFace,
+    kDepthTest,
+    kScissorTest,
+    kStencilTest,
+  };
+  static constexpr size_t kCapabilityCount = 5u;
+
+  struct StencilFaceState {
+    std::optional<std::array<GLenum, 3>> op;
+    std::optional<std::array<GLint, 3>> func;
+    std::optional<GLuint> write_mask;
+  };
+
+  const ProcTableGLES& gl_;
+  std::array<std::optional<bool>, kCapabilityCount> capabilities_;
+  std::optional<std::array<GLenum, 4>> blend_func_;
+  std::optional<std::array<GLenum, 2>> blend_equation_;
+  std::optional<std::array<GLboolean, 4>> color_mask_;
+  StencilFaceState stencil_front_;
+  StencilFaceState stencil_back_;
+  std::optional<GLenum> depth_func_;
+  std::optional<GLboolean> depth_mask_;
+  std::optional<std::array<GLint, 4>> viewport_;
+  std::optional<std::array<GLint, 4>> scissor_;
+  std::optional<GLenum> cull_face_;
+  std::optional<GLenum> front_face_;
+  std::optional<GLuint> program_;
+  // The vertex attribute arrays whose state is known, and which of those are
+  // enabled.
+  uint32_t known_vertex_attrib_arrays_ = 0u;
+  uint32_t enabled_vertex_attrib_arrays_ = 0u;
+
+  StateCacheGLES(const StateCacheGLES&) = delete;
+
+  StateCacheGLES& operator=(const StateCacheGLES&) = delete;
+};
+
+}  // namespace impeller
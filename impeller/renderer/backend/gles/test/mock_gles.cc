@@ -159,6 +159,27 @@ void mockDeleteQueriesEXT(GLsizei size, const GLuint* queries) {
 static_assert(CheckSameSignature<decltype(mockDeleteQueriesEXT),  //
                                  decltype(glDeleteQueriesEXT)>::value);
 
+void mockEnable(GLenum cap) {
+  RecordGLCall("glEnable");
+}
+
+static_assert(CheckSameSignature<decltype(mockEnable),  //
+                                 decltype(glEnable)>::value);
+
+void mockDisable(GLenum cap) {
+  RecordGLCall("glDisable");
+}
+
+static_assert(CheckSameSignature<decltype(mockDisable),  //
+                                 decltype(glDisable)>::value);
+
+void mockViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+  RecordGLCall("glViewport");
+}
+
+static_assert(CheckSameSignature<decltype(mockViewport),  //
+                                 decltype(glViewport)>::value);
+
 std::shared_ptr<MockGLES> MockGLES::Init(
     const std::optional<std::vector<const unsigned char*>>& extensions) {
   // If we cannot obtain a lock, MockGLES is already being used elsewhere.
@@ -195,6 +216,12 @@ const ProcTableGLES::Resolver kMockResolver = [](const char* name) {
     return reinterpret_cast<void*>(mockGetQueryObjectui64vEXT);
   } else if (strcmp(name, "glGetQueryObjectuivEXT") == 0) {
     return reinterpret_cast<void*>(mockGetQueryObjectuivEXT);
+  } else if (strcmp(name, "glEnable") == 0) {
+    return reinterpret_cast<void*>(&mockEnable);
+  } else if (strcmp(name, "glDisable") == 0) {
+    return reinterpret_cast<void*>(&mockDisable);
+  } else if (strcmp(name, "glViewport") == 0) {
+    return reinterpret_cast<void*>(&mockViewport);
   } else {
     return reinterpret_cast<void*>(&doNothing);
   }
@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/testing/testing.h"  // IWYU pragma: keep
+#include "gtest/gtest.h"
+#include "impeller/renderer/backend/gles/state_cache_gles.h"
+#include "impeller/renderer/backend/gles/test/mock_gles.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(StateCacheGLES, SkipsRedundantCapabilityChanges) {
+  auto mock_gles = MockGLES::Init();
+  StateCacheGLES state(mock_gles->GetProcTable());
+
+  state.SetCapability(GL_BLEND, true);
+  state.SetCapability(GL_BLEND, true);
+  state.SetCapability(GL_SCISSOR_TEST, false);
+  state.SetCapability(GL_SCISSOR_TEST, false);
+  state.SetCapability(GL_BLEND, false);
+
+  auto calls = mock_gles->GetCapturedCalls();
+  EXPECT_EQ(calls, std::vector<std::string>(
+                       {"glEnable", "glDisable", "glDisable"}));
+}
+
+TEST(StateCacheGLES, SkipsRedundantViewportChanges) {
+  auto mock_gles = MockGLES::Init();
+  StateCacheGLES state(mock_gles->GetProcTable());
+
+  state.Viewport(0, 0, 100, 100);
+  state.Viewport(0, 0, 100, 100);
+  state.Viewport(0, 0, 200, 100);
+
+  auto calls = mock_gles->GetCapturedCalls();
+  EXPECT_EQ(calls, std::vector<std::string>({"glViewport", "glViewport"}));
+}
+
+TEST(StateCacheGLES, InvalidateForgetsState) {
+  auto mock_gles = MockGLES::Init();
+  StateCacheGLES state(mock_gles->GetProcTable());
+
+  state.SetCapability(GL_DEPTH_TEST, true);
+  state.Viewport(0, 0, 100, 100);
+  state.Invalidate();
+  state.SetCapability(GL_DEPTH_TEST, true);
+  state.Viewport(0, 0, 100, 100);
+
+  auto calls = mock_gles->GetCapturedCalls();
+  EXPECT_EQ(calls, std::vector<std::string>(
+                       {"glEnable", "glViewport", "glEnable", "glViewport"}));
+}
+
+}  // namespace testing
+}  // namespace impeller
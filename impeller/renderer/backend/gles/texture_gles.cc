@@ -268,7 +268,8 @@ bool TextureGLES::OnSetContents(std::shared_ptr<const fml::Mapping> mapping,
     }
   };
 
-  contents_initialized_ = reactor_->AddOperation(texture_upload);
+  contents_initialized_ =
+      reactor_->AddUploadOperation(handle_, std::move(texture_upload));
   return contents_initialized_;
 }
 
@@ -47,6 +47,12 @@ class AllocatorMTL final : public Allocator {
   // |Allocator|
   ISize GetMaxTextureSizeSupported() const override;
 
+  // |Allocator|
+  bool HasUnifiedMemory() const override;
+
+  // |Allocator|
+  std::optional<size_t> OnGetDeviceHeapUsage() const override;
+
   AllocatorMTL(const AllocatorMTL&) = delete;
 
   AllocatorMTL& operator=(const AllocatorMTL&) = delete;
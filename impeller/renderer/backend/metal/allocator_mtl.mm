@@ -229,4 +229,16 @@ ISize AllocatorMTL::GetMaxTextureSizeSupported() const {
   return max_texture_supported_;
 }
 
+bool AllocatorMTL::HasUnifiedMemory() const {
+  return supports_uma_;
+}
+
+// |Allocator|
+std::optional<size_t> AllocatorMTL::OnGetDeviceHeapUsage() const {
+  if (@available(ios 11.0, tvos 11.0, macOS 10.13, *)) {
+    return [device_ currentAllocatedSize];
+  }
+  return std::nullopt;
+}
+
 }  // namespace impeller
@@ -19,6 +19,9 @@ class ContextMTL;
 /// @brief Approximate the GPU frame time by computing a difference between the
 ///        smallest GPUStartTime and largest GPUEndTime for all command buffers
 ///        submitted in a frame workload.
+///
+///        The GPU time of each labelled command buffer is also reported as a
+///        "GPUTracer::CommandBuffer" instant event.
 class GPUTracerMTL : public std::enable_shared_from_this<GPUTracerMTL> {
  public:
   GPUTracerMTL() = default;
@@ -8,6 +8,7 @@
 #include "impeller/renderer/backend/metal/formats_mtl.h"
 
 #include <memory>
+#include <string>
 
 #include "impeller/renderer/backend/metal/gpu_tracer_mtl.h"
 
@@ -39,6 +40,13 @@ void GPUTracerMTL::RecordCmdBuffer(id<MTLCommandBuffer> buffer) {
           state.smallest_timestamp, static_cast<Scalar>(buffer.GPUStartTime));
       state.largest_timestamp = std::max(
           state.largest_timestamp, static_cast<Scalar>(buffer.GPUEndTime));
+      if (buffer.label.length > 0) {
+        auto cmd_buffer_ms =
+            std::to_string((buffer.GPUEndTime - buffer.GPUStartTime) * 1000);
+        TRACE_EVENT_INSTANT2("flutter", "GPUTracer::CommandBuffer",  //
+                             "Label", buffer.label.UTF8String,        //
+                             "TimeMS", cmd_buffer_ms.c_str());
+      }
 
       if (state.pending_buffers == 0) {
         auto gpu_ms =
@@ -4,6 +4,9 @@
 
 #include "impeller/renderer/backend/metal/render_pass_mtl.h"
 
+#include <array>
+#include <optional>
+
 #include "flutter/fml/closure.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
@@ -179,7 +182,33 @@ bool RenderPassMTL::OnEncodeCommands(const Context& context) const {
   fml::ScopedCleanupClosure auto_end(
       [render_command_encoder]() { [render_command_encoder endEncoding]; });
 
-  return EncodeCommands(context.GetResourceAllocator(), render_command_encoder);
+  if (!EncodeCommands(context.GetResourceAllocator(), render_command_encoder)) {
+    return false;
+  }
+
+  // On unified memory devices, buffer views may point straight into shared
+  // device buffers that the host buffer reuses once they are released. Keep
+  // them alive till the GPU is done with this command buffer.
+  if (context.GetResourceAllocator()->HasUnifiedMemory()) {
+    auto retained =
+        std::make_shared<std::vector<std::shared_ptr<const Buffer>>>();
+    auto retain = [&retained](const Bindings& bindings) {
+      for (const auto& buffer : bindings.buffers) {
+        retained->push_back(buffer.second.view.resource.buffer);
+      }
+    };
+    for (const auto& command : commands_) {
+      retained->push_back(command.vertex_buffer.vertex_buffer.buffer);
+      retained->push_back(command.vertex_buffer.index_buffer.buffer);
+      retain(command.vertex_bindings);
+      retain(command.fragment_bindings);
+    }
+    [buffer_ addCompletedHandler:^(id<MTLCommandBuffer> buffer) {
+      retained->clear();
+    }];
+  }
+
+  return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -219,17 +248,25 @@ struct PassBindingsCache {
                  uint64_t index,
                  uint64_t offset,
                  id<MTLBuffer> buffer) {
-    auto& buffers_map = buffers_[stage];
-    auto found = buffers_map.find(index);
-    if (found != buffers_map.end() && found->second.buffer == buffer) {
+    auto stage_index = GetStageIndex(stage);
+    if (!stage_index.has_value()) {
+      VALIDATION_LOG << "Cannot bind buffer to unknown shader stage.";
+      return false;
+    }
+    if (index >= kMaxBufferBindings) {
+      VALIDATION_LOG << "Buffer binding index " << index << " is out of range.";
+      return false;
+    }
+    auto& bound = buffers_[stage_index.value()][index];
+    if (bound.buffer == buffer) {
       // The right buffer is bound. Check if its offset needs to be updated.
-      if (found->second.offset == offset) {
+      if (bound.offset == offset) {
         // Buffer and its offset is identical. Nothing to do.
         return true;
       }
 
       // Only the offset needs to be updated.
-      found->second.offset = offset;
+      bound.offset = offset;
 
       switch (stage) {
         case ShaderStage::kVertex:
@@ -244,7 +281,7 @@ struct PassBindingsCache {
       }
       return true;
     }
-    buffers_map[index] = {buffer, static_cast<size_t>(offset)};
+    bound = {buffer, static_cast<size_t>(offset)};
     switch (stage) {
       case ShaderStage::kVertex:
         [encoder_ setVertexBuffer:buffer offset:offset atIndex:index];
@@ -260,13 +297,22 @@ struct PassBindingsCache {
   }
 
   bool SetTexture(ShaderStage stage, uint64_t index, id<MTLTexture> texture) {
-    auto& texture_map = textures_[stage];
-    auto found = texture_map.find(index);
-    if (found != texture_map.end() && found->second == texture) {
+    auto stage_index = GetStageIndex(stage);
+    if (!stage_index.has_value()) {
+      VALIDATION_LOG << "Cannot bind texture to unknown shader stage.";
+      return false;
+    }
+    if (index >= kMaxTextureBindings) {
+      VALIDATION_LOG << "Texture binding index " << index
+                     << " is out of range.";
+      return false;
+    }
+    auto& bound = textures_[stage_index.value()][index];
+    if (bound == texture) {
       // Already bound.
       return true;
     }
-    texture_map[index] = texture;
+    bound = texture;
     switch (stage) {
       case ShaderStage::kVertex:
         [encoder_ setVertexTexture:texture atIndex:index];
@@ -284,13 +330,22 @@ struct PassBindingsCache {
   bool SetSampler(ShaderStage stage,
                   uint64_t index,
                   id<MTLSamplerState> sampler) {
-    auto& sampler_map = samplers_[stage];
-    auto found = sampler_map.find(index);
-    if (found != sampler_map.end() && found->second == sampler) {
+    auto stage_index = GetStageIndex(stage);
+    if (!stage_index.has_value()) {
+      VALIDATION_LOG << "Cannot bind sampler to unknown shader stage.";
+      return false;
+    }
+    if (index >= kMaxSamplerBindings) {
+      VALIDATION_LOG << "Sampler binding index " << index
+                     << " is out of range.";
+      return false;
+    }
+    auto& bound = samplers_[stage_index.value()][index];
+    if (bound == sampler) {
       // Already bound.
       return true;
     }
-    sampler_map[index] = sampler;
+    bound = sampler;
     switch (stage) {
       case ShaderStage::kVertex:
         [encoder_ setVertexSamplerState:sampler atIndex:index];
@@ -305,6 +360,39 @@ struct PassBindingsCache {
     return false;
   }
 
+  void SetFrontFacingWinding(MTLWinding winding) {
+    if (winding_.has_value() && winding_.value() == winding) {
+      return;
+    }
+    [encoder_ setFrontFacingWinding:winding];
+    winding_ = winding;
+  }
+
+  void SetCullMode(MTLCullMode cull_mode) {
+    if (cull_mode_.has_value() && cull_mode_.value() == cull_mode) {
+      return;
+    }
+    [encoder_ setCullMode:cull_mode];
+    cull_mode_ = cull_mode;
+  }
+
+  void SetTriangleFillMode(MTLTriangleFillMode fill_mode) {
+    if (fill_mode_.has_value() && fill_mode_.value() == fill_mode) {
+      return;
+    }
+    [encoder_ setTriangleFillMode:fill_mode];
+    fill_mode_ = fill_mode;
+  }
+
+  void SetStencilReferenceValue(uint32_t stencil_reference) {
+    if (stencil_reference_.has_value() &&
+        stencil_reference_.value() == stencil_reference) {
+      return;
+    }
+    [encoder_ setStencilReferenceValue:stencil_reference];
+    stencil_reference_ = stencil_reference;
+  }
+
   void SetViewport(const Viewport& viewport) {
     if (viewport_.has_value() && viewport_.value() == viewport) {
       return;
@@ -336,22 +424,44 @@ struct PassBindingsCache {
   }
 
  private:
+  // The binding limits of the Metal argument tables. Bindings are tracked in
+  // flat tables instead of maps, as lookups happen for every binding of every
+  // command in the pass.
+  static constexpr size_t kMaxBufferBindings = 31u;
+  static constexpr size_t kMaxTextureBindings = 128u;
+  static constexpr size_t kMaxSamplerBindings = 16u;
+  static constexpr size_t kStageCount = 2u;
+
   struct BufferOffsetPair {
     id<MTLBuffer> buffer = nullptr;
     size_t offset = 0u;
   };
-  using BufferMap = std::map<uint64_t, BufferOffsetPair>;
-  using TextureMap = std::map<uint64_t, id<MTLTexture>>;
-  using SamplerMap = std::map<uint64_t, id<MTLSamplerState>>;
+  template <typename T, size_t N>
+  using StageTables = std::array<std::array<T, N>, kStageCount>;
+
+  static std::optional<size_t> GetStageIndex(ShaderStage stage) {
+    switch (stage) {
+      case ShaderStage::kVertex:
+        return 0u;
+      case ShaderStage::kFragment:
+        return 1u;
+      default:
+        return std::nullopt;
+    }
+  }
 
   const id<MTLRenderCommandEncoder> encoder_;
   id<MTLRenderPipelineState> pipeline_ = nullptr;
   id<MTLDepthStencilState> depth_stencil_ = nullptr;
-  std::map<ShaderStage, BufferMap> buffers_;
-  std::map<ShaderStage, TextureMap> textures_;
-  std::map<ShaderStage, SamplerMap> samplers_;
+  StageTables<BufferOffsetPair, kMaxBufferBindings> buffers_;
+  StageTables<id<MTLTexture>, kMaxTextureBindings> textures_;
+  StageTables<id<MTLSamplerState>, kMaxSamplerBindings> samplers_;
   std::optional<Viewport> viewport_;
   std::optional<IRect> scissor_;
+  std::optional<MTLWinding> winding_;
+  std::optional<MTLCullMode> cull_mode_;
+  std::optional<MTLTriangleFillMode> fill_mode_;
+  std::optional<uint32_t> stencil_reference_;
 };
 
 static bool Bind(PassBindingsCache& pass,
@@ -456,14 +566,14 @@ bool RenderPassMTL::EncodeCommands(const std::shared_ptr<Allocator>& allocator,
     pass_bindings.SetScissor(
         command.scissor.value_or(IRect::MakeSize(GetRenderTargetSize())));
 
-    [encoder setFrontFacingWinding:pipeline_desc.GetWindingOrder() ==
-                                           WindingOrder::kClockwise
-                                       ? MTLWindingClockwise
-                                       : MTLWindingCounterClockwise];
-    [encoder setCullMode:ToMTLCullMode(pipeline_desc.GetCullMode())];
-    [encoder setTriangleFillMode:ToMTLTriangleFillMode(
-                                     pipeline_desc.GetPolygonMode())];
-    [encoder setStencilReferenceValue:command.stencil_reference];
+    pass_bindings.SetFrontFacingWinding(
+        pipeline_desc.GetWindingOrder() == WindingOrder::kClockwise
+            ? MTLWindingClockwise
+            : MTLWindingCounterClockwise);
+    pass_bindings.SetCullMode(ToMTLCullMode(pipeline_desc.GetCullMode()));
+    pass_bindings.SetTriangleFillMode(
+        ToMTLTriangleFillMode(pipeline_desc.GetPolygonMode()));
+    pass_bindings.SetStencilReferenceValue(command.stencil_reference);
 
     if (!Bind(pass_bindings, *allocator, ShaderStage::kVertex,
               VertexDescriptor::kReservedVertexBufferIndex,
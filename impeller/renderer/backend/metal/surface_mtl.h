@@ -5,6 +5,8 @@
 #pragma once
 
 #include <QuartzCore/CAMetalLayer.h>
+#include <functional>
+#include <future>
 #include <memory>
 
 #include "flutter/fml/macros.h"
@@ -43,6 +45,31 @@ class SurfaceMTL final : public Surface {
       id<CAMetalDrawable> drawable,
       std::optional<IRect> clip_rect = std::nullopt);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a surface for the next drawable of the given Metal
+  ///             layer without waiting for that drawable. The drawable is
+  ///             acquired from the future the first time its texture is
+  ///             needed, which is when the root pass is encoded or when the
+  ///             surface is presented. This keeps any wait in nextDrawable
+  ///             off the part of the frame that encodes offscreen passes.
+  ///
+  /// @param[in]  context          The context
+  /// @param[in]  layer            The layer the drawable is acquired from. Its
+  ///                              pixel format and drawable size describe the
+  ///                              drawable texture.
+  /// @param[in]  drawable_future  The deferred drawable of `layer`, as
+  ///                              returned by `GetDrawableDeferred`.
+  /// @param[in]  clip_rect        The damage rect if partial repaint is in
+  ///                              use.
+  ///
+  /// @return     A pointer to the surface or null.
+  ///
+  static std::unique_ptr<SurfaceMTL> MakeFromMetalLayer(
+      const std::shared_ptr<Context>& context,
+      CAMetalLayer* layer,
+      const std::shared_future<id<CAMetalDrawable>>& drawable_future,
+      std::optional<IRect> clip_rect = std::nullopt);
+
   static std::unique_ptr<SurfaceMTL> MakeFromTexture(
       const std::shared_ptr<Context>& context,
       id<MTLTexture> texture,
@@ -69,9 +96,23 @@ class SurfaceMTL final : public Surface {
   std::shared_ptr<Texture> destination_texture_;
   bool requires_blit_ = false;
   std::optional<IRect> clip_rect_;
+  std::shared_future<id<CAMetalDrawable>> drawable_future_;
 
   static bool ShouldPerformPartialRepaint(std::optional<IRect> damage_rect);
 
+  using WrapTextureProc =
+      std::function<std::shared_ptr<Texture>(const TextureDescriptor&)>;
+
+  static std::unique_ptr<SurfaceMTL> Make(
+      const std::shared_ptr<Context>& context,
+      PixelFormat format,
+      ISize texture_size,
+      const WrapTextureProc& wrap_resolve_texture,
+      const WrapTextureProc& wrap_destination_texture,
+      std::optional<IRect> clip_rect,
+      id<CAMetalDrawable> drawable,
+      std::shared_future<id<CAMetalDrawable>> drawable_future);
+
   SurfaceMTL(const std::weak_ptr<Context>& context,
              const RenderTarget& target,
              std::shared_ptr<Texture> resolve_texture,
@@ -79,7 +120,8 @@ class SurfaceMTL final : public Surface {
              std::shared_ptr<Texture> source_texture,
              std::shared_ptr<Texture> destination_texture,
              bool requires_blit,
-             std::optional<IRect> clip_rect);
+             std::optional<IRect> clip_rect,
+             std::shared_future<id<CAMetalDrawable>> drawable_future = {});
 
   SurfaceMTL(const SurfaceMTL&) = delete;
 
@@ -10,6 +10,7 @@
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/renderer/backend/metal/context_mtl.h"
 #include "impeller/renderer/backend/metal/formats_mtl.h"
+#include "impeller/renderer/backend/metal/lazy_drawable_holder.h"
 #include "impeller/renderer/backend/metal/texture_mtl.h"
 #include "impeller/renderer/render_target.h"
 
@@ -42,7 +43,10 @@ id<CAMetalDrawable> SurfaceMTL::GetMetalDrawableAndValidate(
 
 static std::optional<RenderTarget> WrapTextureWithRenderTarget(
     Allocator& allocator,
-    id<MTLTexture> texture,
+    PixelFormat format,
+    ISize texture_size,
+    const std::function<std::shared_ptr<Texture>(const TextureDescriptor&)>&
+        wrap_texture,
     bool requires_blit,
     std::optional<IRect> clip_rect) {
   // compositor_context.cc will offset the rendering by the clip origin. Here we
@@ -56,12 +60,11 @@ static std::optional<RenderTarget> WrapTextureWithRenderTarget(
     }
     root_size = ISize(clip_rect->size.width, clip_rect->size.height);
   } else {
-    root_size = {static_cast<ISize::Type>(texture.width),
-                 static_cast<ISize::Type>(texture.height)};
+    root_size = texture_size;
   }
 
   TextureDescriptor resolve_tex_desc;
-  resolve_tex_desc.format = FromMTLPixelFormat(texture.pixelFormat);
+  resolve_tex_desc.format = format;
   resolve_tex_desc.size = root_size;
   resolve_tex_desc.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget) |
                            static_cast<uint64_t>(TextureUsage::kShaderRead);
@@ -79,7 +82,7 @@ static std::optional<RenderTarget> WrapTextureWithRenderTarget(
     resolve_tex_desc.compression_type = CompressionType::kLossy;
     resolve_tex = allocator.CreateTexture(resolve_tex_desc);
   } else {
-    resolve_tex = TextureMTL::Create(resolve_tex_desc, texture);
+    resolve_tex = wrap_texture(resolve_tex_desc);
   }
 
   if (!resolve_tex) {
@@ -124,19 +127,60 @@ std::unique_ptr<SurfaceMTL> SurfaceMTL::MakeFromMetalLayerDrawable(
                                      drawable);
 }
 
+std::unique_ptr<SurfaceMTL> SurfaceMTL::MakeFromMetalLayer(
+    const std::shared_ptr<Context>& context,
+    CAMetalLayer* layer,
+    const std::shared_future<id<CAMetalDrawable>>& drawable_future,
+    std::optional<IRect> clip_rect) {
+  if (layer == nil || !drawable_future.valid()) {
+    return nullptr;
+  }
+  auto wrap_drawable_texture = [drawable_future](
+                                   const TextureDescriptor& desc) {
+    return CreateTextureFromDrawableFuture(desc, drawable_future);
+  };
+  ISize drawable_size = {static_cast<ISize::Type>(layer.drawableSize.width),
+                         static_cast<ISize::Type>(layer.drawableSize.height)};
+  return Make(context, FromMTLPixelFormat(layer.pixelFormat), drawable_size,
+              wrap_drawable_texture, wrap_drawable_texture, clip_rect,
+              /*drawable=*/nil, drawable_future);
+}
+
 std::unique_ptr<SurfaceMTL> SurfaceMTL::MakeFromTexture(
     const std::shared_ptr<Context>& context,
     id<MTLTexture> texture,
     std::optional<IRect> clip_rect,
     id<CAMetalDrawable> drawable) {
+  ISize texture_size = {static_cast<ISize::Type>(texture.width),
+                        static_cast<ISize::Type>(texture.height)};
+  return Make(
+      context, FromMTLPixelFormat(texture.pixelFormat), texture_size,
+      [texture](const TextureDescriptor& desc) {
+        return TextureMTL::Create(desc, texture);
+      },
+      [texture](const TextureDescriptor& desc) {
+        return TextureMTL::Wrapper(desc, texture);
+      },
+      clip_rect, drawable, /*drawable_future=*/{});
+}
+
+std::unique_ptr<SurfaceMTL> SurfaceMTL::Make(
+    const std::shared_ptr<Context>& context,
+    PixelFormat format,
+    ISize texture_size,
+    const WrapTextureProc& wrap_resolve_texture,
+    const WrapTextureProc& wrap_destination_texture,
+    std::optional<IRect> clip_rect,
+    id<CAMetalDrawable> drawable,
+    std::shared_future<id<CAMetalDrawable>> drawable_future) {
   bool partial_repaint_blit_required = ShouldPerformPartialRepaint(clip_rect);
 
   // The returned render target is the texture that Impeller will render the
   // root pass to. If partial repaint is in use, this may be a new texture which
   // is smaller than the given MTLTexture.
-  auto render_target =
-      WrapTextureWithRenderTarget(*context->GetResourceAllocator(), texture,
-                                  partial_repaint_blit_required, clip_rect);
+  auto render_target = WrapTextureWithRenderTarget(
+      *context->GetResourceAllocator(), format, texture_size,
+      wrap_resolve_texture, partial_repaint_blit_required, clip_rect);
   if (!render_target) {
     return nullptr;
   }
@@ -157,9 +201,8 @@ std::unique_ptr<SurfaceMTL> SurfaceMTL::MakeFromTexture(
     // target, but override the size with the drawable's size.
     auto destination_descriptor =
         render_target->GetRenderTargetTexture()->GetTextureDescriptor();
-    destination_descriptor.size = {static_cast<ISize::Type>(texture.width),
-                                   static_cast<ISize::Type>(texture.height)};
-    destination_texture = TextureMTL::Wrapper(destination_descriptor, texture);
+    destination_descriptor.size = texture_size;
+    destination_texture = wrap_destination_texture(destination_descriptor);
   } else {
     // When not partial repaint blit is needed, the render target texture _is_
     // the drawable texture.
@@ -174,7 +217,8 @@ std::unique_ptr<SurfaceMTL> SurfaceMTL::MakeFromTexture(
       source_texture,                           // source_texture
       destination_texture,                      // destination_texture
       partial_repaint_blit_required,            // requires_blit
-      clip_rect                                 // clip_rect
+      clip_rect,                                // clip_rect
+      std::move(drawable_future)                // drawable_future
       ));
 }
 
@@ -185,7 +229,8 @@ SurfaceMTL::SurfaceMTL(const std::weak_ptr<Context>& context,
                        std::shared_ptr<Texture> source_texture,
                        std::shared_ptr<Texture> destination_texture,
                        bool requires_blit,
-                       std::optional<IRect> clip_rect)
+                       std::optional<IRect> clip_rect,
+                       std::shared_future<id<CAMetalDrawable>> drawable_future)
     : Surface(target),
       context_(context),
       resolve_texture_(std::move(resolve_texture)),
@@ -193,7 +238,8 @@ SurfaceMTL::SurfaceMTL(const std::weak_ptr<Context>& context,
       source_texture_(std::move(source_texture)),
       destination_texture_(std::move(destination_texture)),
       requires_blit_(requires_blit),
-      clip_rect_(clip_rect) {}
+      clip_rect_(clip_rect),
+      drawable_future_(std::move(drawable_future)) {}
 
 // |Surface|
 SurfaceMTL::~SurfaceMTL() = default;
@@ -250,7 +296,14 @@ bool SurfaceMTL::Present() const {
   ContextMTL::Cast(context.get())->GetGPUTracer()->MarkFrameEnd();
 #endif  // IMPELLER_DEBUG
 
-  if (drawable_) {
+  // A deferred drawable that nothing has touched yet is acquired here, as it
+  // still has to be presented.
+  id<CAMetalDrawable> drawable = drawable_;
+  if (!drawable && drawable_future_.valid()) {
+    drawable = drawable_future_.get();
+  }
+
+  if (drawable) {
     id<MTLCommandBuffer> command_buffer =
         ContextMTL::Cast(context.get())
             ->CreateMTLCommandBuffer("Present Waiter Command Buffer");
@@ -262,9 +315,9 @@ bool SurfaceMTL::Present() const {
       TRACE_EVENT0("flutter", "waitUntilScheduled");
       [command_buffer commit];
       [command_buffer waitUntilScheduled];
-      [drawable_ present];
+      [drawable present];
     } else {
-      [command_buffer presentDrawable:drawable_];
+      [command_buffer presentDrawable:drawable];
       [command_buffer commit];
     }
   }
@@ -92,9 +92,14 @@ AllocatorVK::AllocatorVK(std::weak_ptr<Context> context,
     : context_(std::move(context)), device_holder_(device_holder) {
   TRACE_EVENT0("impeller", "CreateAllocatorVK");
 
-  auto limits = physical_device.getProperties().limits;
+  const auto properties = physical_device.getProperties();
+  auto limits = properties.limits;
   max_texture_size_.width = max_texture_size_.height =
       limits.maxImageDimension2D;
+  // Integrated GPUs share memory with the host. Host visible buffers are
+  // device local and tracked by the command encoder till the fence signals.
+  has_unified_memory_ =
+      properties.deviceType == vk::PhysicalDeviceType::eIntegratedGpu;
 
   VmaVulkanFunctions proc_table = {};
 
@@ -148,6 +153,8 @@ AllocatorVK::AllocatorVK(std::weak_ptr<Context> context,
   allocator_.reset(allocator);
   supports_memoryless_textures_ =
       capabilities.SupportsDeviceTransientTextures();
+  supports_fixed_rate_compression_ =
+      capabilities.SupportsFixedRateCompression();
   is_valid_ = true;
 }
 
@@ -163,6 +170,31 @@ ISize AllocatorVK::GetMaxTextureSizeSupported() const {
   return max_texture_size_;
 }
 
+bool AllocatorVK::HasUnifiedMemory() const {
+  return has_unified_memory_;
+}
+
+// |Allocator|
+std::optional<size_t> AllocatorVK::OnGetDeviceHeapUsage() const {
+  if (!is_valid_) {
+    return std::nullopt;
+  }
+  const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+  ::vmaGetMemoryProperties(allocator_.get(), &memory_properties);
+  // Without VK_EXT_memory_budget, VMA reports the memory of the blocks it has
+  // allocated itself.
+  VmaBudget budgets[VK_MAX_MEMORY_HEAPS] = {};
+  ::vmaGetHeapBudgets(allocator_.get(), budgets);
+  size_t bytes = 0u;
+  for (uint32_t i = 0u; i < memory_properties->memoryHeapCount; i++) {
+    if (memory_properties->memoryHeaps[i].flags &
+        VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+      bytes += budgets[i].usage;
+    }
+  }
+  return bytes;
+}
+
 static constexpr vk::ImageUsageFlags ToVKImageUsageFlags(
     PixelFormat format,
     TextureUsageMask usage,
@@ -263,7 +295,8 @@ class AllocatedTextureSourceVK final : public TextureSourceVK {
                            const TextureDescriptor& desc,
                            VmaAllocator allocator,
                            vk::Device device,
-                           bool supports_memoryless_textures)
+                           bool supports_memoryless_textures,
+                           bool supports_fixed_rate_compression)
       : TextureSourceVK(desc), resource_(std::move(resource_manager)) {
     FML_DCHECK(desc.format != PixelFormat::kUnknown);
     TRACE_EVENT0("impeller", "CreateDeviceTexture");
@@ -286,6 +319,17 @@ class AllocatedTextureSourceVK final : public TextureSourceVK {
                             supports_memoryless_textures);
     image_info.sharingMode = vk::SharingMode::eExclusive;
 
+    // Let the driver pick a fixed compression rate for textures that can be
+    // compressed lossily, the way Metal does for them.
+    vk::ImageCompressionControlEXT compression_control;
+    if (supports_fixed_rate_compression &&
+        desc.compression_type == CompressionType::kLossy &&
+        desc.storage_mode == StorageMode::kDevicePrivate) {
+      compression_control.flags =
+          vk::ImageCompressionFlagBitsEXT::eFixedRateDefault;
+      image_info.pNext = &compression_control;
+    }
+
     VmaAllocationCreateInfo alloc_nfo = {};
 
     alloc_nfo.usage = ToVMAMemoryUsage();
@@ -412,7 +456,8 @@ std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
       desc,                                            //
       allocator_.get(),                                //
       device_holder->GetDevice(),                      //
-      supports_memoryless_textures_                    //
+      supports_memoryless_textures_,                   //
+      supports_fixed_rate_compression_                 //
   );
   if (!source->IsValid()) {
     return nullptr;
@@ -33,6 +33,8 @@ class AllocatorVK final : public Allocator {
   ISize max_texture_size_;
   bool is_valid_ = false;
   bool supports_memoryless_textures_ = false;
+  bool supports_fixed_rate_compression_ = false;
+  bool has_unified_memory_ = false;
   // TODO(jonahwilliams): figure out why CI can't create these buffer pools.
   bool created_buffer_pool_ = true;
   uint32_t frame_count_ = 0;
@@ -62,6 +64,12 @@ class AllocatorVK final : public Allocator {
   // |Allocator|
   ISize GetMaxTextureSizeSupported() const override;
 
+  // |Allocator|
+  bool HasUnifiedMemory() const override;
+
+  // |Allocator|
+  std::optional<size_t> OnGetDeviceHeapUsage() const override;
+
   AllocatorVK(const AllocatorVK&) = delete;
 
   AllocatorVK& operator=(const AllocatorVK&) = delete;
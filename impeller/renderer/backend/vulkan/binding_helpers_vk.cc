@@ -3,6 +3,11 @@
 // found in the LICENSE file.
 
 #include "impeller/renderer/backend/vulkan/binding_helpers_vk.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "flutter/fml/hash_combine.h"
 #include "fml/status.h"
 #include "impeller/renderer/backend/vulkan/command_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/command_encoder_vk.h"
@@ -114,6 +119,53 @@ static bool BindBuffers(const Bindings& bindings,
   return true;
 }
 
+template <class VulkanHandle>
+static uint64_t HandleToKey(VulkanHandle handle) {
+  // Non-dispatchable handles are 64-bit integers on 32-bit platforms and
+  // pointers elsewhere.
+  auto native = static_cast<typename VulkanHandle::NativeType>(handle);
+  uint64_t key = 0u;
+  ::memcpy(&key, &native, std::min(sizeof(key), sizeof(native)));
+  return key;
+}
+
+// Appends everything that ends up being written into a descriptor set for the
+// given bindings to the key. Two commands with equal keys can share a set.
+static bool AppendDescriptorSetKey(const Bindings& bindings,
+                                   Allocator& allocator,
+                                   std::vector<uint64_t>& key) {
+  for (const auto& [buffer_index, data] : bindings.buffers) {
+    auto device_buffer = data.view.resource.buffer->GetDeviceBuffer(allocator);
+    if (!device_buffer) {
+      return false;
+    }
+    const auto& buffer_vk = DeviceBufferVK::Cast(*device_buffer);
+    key.push_back(data.slot.binding);
+    key.push_back(HandleToKey(buffer_vk.GetBuffer()));
+    key.push_back(data.view.resource.range.offset);
+    key.push_back(data.view.resource.range.length);
+  }
+  for (const auto& [index, data] : bindings.sampled_images) {
+    key.push_back(data.slot.binding);
+    key.push_back(
+        HandleToKey(TextureVK::Cast(*data.texture.resource).GetImageView()));
+    key.push_back(HandleToKey(SamplerVK::Cast(*data.sampler).GetSampler()));
+  }
+  return true;
+}
+
+namespace {
+struct DescriptorSetKeyHash {
+  std::size_t operator()(const std::vector<uint64_t>& key) const {
+    std::size_t seed = key.size();
+    for (auto value : key) {
+      fml::HashCombineSeed(seed, value);
+    }
+    return seed;
+  }
+};
+}  // namespace
+
 fml::StatusOr<std::vector<vk::DescriptorSet>> AllocateAndBindDescriptorSets(
     const ContextVK& context,
     const std::shared_ptr<CommandEncoderVK>& encoder,
@@ -122,29 +174,58 @@ fml::StatusOr<std::vector<vk::DescriptorSet>> AllocateAndBindDescriptorSets(
     return std::vector<vk::DescriptorSet>{};
   }
 
-  // Step 1: Determine the total number of buffer and sampler descriptor
-  // sets required. Collect this information along with the layout information
-  // to allocate a correctly sized descriptor pool.
+  auto& allocator = *context.GetResourceAllocator();
+
+  // Step 1: Commands in a pass frequently bind the same pipeline layout with
+  // the same buffers, textures and samplers. Those all share one descriptor
+  // set so that it is only allocated and written once. Determine the unique
+  // sets along with the total number of buffer and sampler descriptors they
+  // require in order to allocate a correctly sized descriptor pool.
+  std::unordered_map<std::vector<uint64_t>, size_t, DescriptorSetKeyHash>
+      unique_keys;
+  std::vector<size_t> unique_set_indices;
+  std::vector<const Command*> unique_commands;
+  unique_set_indices.reserve(commands.size());
+  unique_commands.reserve(commands.size());
+
   size_t buffer_count = 0;
   size_t samplers_count = 0;
   std::vector<vk::DescriptorSetLayout> layouts;
   layouts.reserve(commands.size());
 
   for (const auto& command : commands) {
+    const auto layout =
+        PipelineVK::Cast(*command.pipeline).GetDescriptorSetLayout();
+
+    std::vector<uint64_t> key;
+    key.push_back(HandleToKey(layout));
+    if (!AppendDescriptorSetKey(command.vertex_bindings, allocator, key) ||
+        !AppendDescriptorSetKey(command.fragment_bindings, allocator, key)) {
+      return fml::Status(fml::StatusCode::kUnknown,
+                         "Failed to get device buffer for binding.");
+    }
+
+    auto [it, inserted] =
+        unique_keys.try_emplace(std::move(key), unique_commands.size());
+    unique_set_indices.push_back(it->second);
+    if (!inserted) {
+      continue;
+    }
+
+    unique_commands.push_back(&command);
     buffer_count += command.vertex_bindings.buffers.size();
     buffer_count += command.fragment_bindings.buffers.size();
     samplers_count += command.fragment_bindings.sampled_images.size();
 
-    layouts.emplace_back(
-        PipelineVK::Cast(*command.pipeline).GetDescriptorSetLayout());
+    layouts.emplace_back(layout);
   }
   auto descriptor_result =
       encoder->AllocateDescriptorSets(buffer_count, samplers_count, layouts);
   if (!descriptor_result.ok()) {
     return descriptor_result.status();
   }
-  auto descriptor_sets = descriptor_result.value();
-  if (descriptor_sets.empty()) {
+  auto unique_descriptor_sets = descriptor_result.value();
+  if (unique_descriptor_sets.empty()) {
     return fml::Status();
   }
 
@@ -157,19 +238,20 @@ fml::StatusOr<std::vector<vk::DescriptorSet>> AllocateAndBindDescriptorSets(
   buffers.reserve(buffer_count);
   writes.reserve(samplers_count + buffer_count);
 
-  auto& allocator = *context.GetResourceAllocator();
   auto desc_index = 0u;
-  for (const auto& command : commands) {
-    auto desc_set = command.pipeline->GetDescriptor()
+  for (const auto* command : unique_commands) {
+    auto desc_set = command->pipeline->GetDescriptor()
                         .GetVertexDescriptor()
                         ->GetDescriptorSetLayouts();
 
-    if (!BindBuffers(command.vertex_bindings, allocator, encoder,
-                     descriptor_sets[desc_index], desc_set, buffers, writes) ||
-        !BindBuffers(command.fragment_bindings, allocator, encoder,
-                     descriptor_sets[desc_index], desc_set, buffers, writes) ||
-        !BindImages(command.fragment_bindings, allocator, encoder,
-                    descriptor_sets[desc_index], images, writes)) {
+    if (!BindBuffers(command->vertex_bindings, allocator, encoder,
+                     unique_descriptor_sets[desc_index], desc_set, buffers,
+                     writes) ||
+        !BindBuffers(command->fragment_bindings, allocator, encoder,
+                     unique_descriptor_sets[desc_index], desc_set, buffers,
+                     writes) ||
+        !BindImages(command->fragment_bindings, allocator, encoder,
+                    unique_descriptor_sets[desc_index], images, writes)) {
       return fml::Status(fml::StatusCode::kUnknown,
                          "Failed to bind texture or buffer.");
     }
@@ -177,6 +259,13 @@ fml::StatusOr<std::vector<vk::DescriptorSet>> AllocateAndBindDescriptorSets(
   }
 
   context.GetDevice().updateDescriptorSets(writes, {});
+
+  // Step 3: Map every command back to its (possibly shared) descriptor set.
+  std::vector<vk::DescriptorSet> descriptor_sets;
+  descriptor_sets.reserve(commands.size());
+  for (auto index : unique_set_indices) {
+    descriptor_sets.push_back(unique_descriptor_sets[index]);
+  }
   return descriptor_sets;
 }
 
@@ -59,6 +59,7 @@ TEST(BlitCommandVkTest, BlitCopyBufferToTextureCommandVK) {
                        .size = 1,
                    })
                    ->AsBufferView();
+  cmd.destination_region = IRect::MakeSize(cmd.destination->GetSize());
   bool result = cmd.Encode(*encoder.get());
   EXPECT_TRUE(result);
   EXPECT_TRUE(encoder->IsTracking(cmd.source.buffer));
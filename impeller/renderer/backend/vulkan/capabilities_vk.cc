@@ -156,6 +156,8 @@ static const char* GetDeviceExtensionName(OptionalDeviceExtensionVK ext) {
   switch (ext) {
     case OptionalDeviceExtensionVK::kEXTPipelineCreationFeedback:
       return VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME;
+    case OptionalDeviceExtensionVK::kEXTImageCompressionControl:
+      return VK_EXT_IMAGE_COMPRESSION_CONTROL_EXTENSION_NAME;
     case OptionalDeviceExtensionVK::kLast:
       return "Unknown";
   }
@@ -401,9 +403,30 @@ bool CapabilitiesVK::SetPhysicalDevice(const vk::PhysicalDevice& device) {
     });
   }
 
+  supports_fixed_rate_compression_ = SupportsImageCompressionControl(device);
+
   return true;
 }
 
+bool CapabilitiesVK::SupportsImageCompressionControl(
+    const vk::PhysicalDevice& physical_device) const {
+  auto exts = GetSupportedDeviceExtensions(physical_device);
+  if (!exts.has_value() ||
+      exts->find(VK_EXT_IMAGE_COMPRESSION_CONTROL_EXTENSION_NAME) ==
+          exts->end()) {
+    return false;
+  }
+  auto features = physical_device.getFeatures2<
+      vk::PhysicalDeviceFeatures2,
+      vk::PhysicalDeviceImageCompressionControlFeaturesEXT>();
+  return features.get<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>()
+      .imageCompressionControl;
+}
+
+bool CapabilitiesVK::SupportsFixedRateCompression() const {
+  return supports_fixed_rate_compression_;
+}
+
 // |Capabilities|
 bool CapabilitiesVK::SupportsOffscreenMSAA() const {
   return true;
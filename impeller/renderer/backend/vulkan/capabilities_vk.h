@@ -22,6 +22,8 @@ class ContextVK;
 enum class OptionalDeviceExtensionVK : uint32_t {
   // https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VK_EXT_pipeline_creation_feedback.html
   kEXTPipelineCreationFeedback,
+  // https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VK_EXT_image_compression_control.html
+  kEXTImageCompressionControl,
   kLast,
 };
 
@@ -56,6 +58,21 @@ class CapabilitiesVK final : public Capabilities,
 
   const vk::PhysicalDeviceProperties& GetPhysicalDeviceProperties() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether textures that ask for lossy compression can be
+  ///             created with fixed-rate compression on the given device. The
+  ///             logical device must be created with the image compression
+  ///             control feature enabled for this to be used.
+  ///
+  bool SupportsImageCompressionControl(
+      const vk::PhysicalDevice& physical_device) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether textures that ask for lossy compression are created
+  ///             with fixed-rate compression on the current device.
+  ///
+  bool SupportsFixedRateCompression() const;
+
   void SetOffscreenFormat(PixelFormat pixel_format) const;
 
   // |Capabilities|
@@ -110,6 +127,7 @@ class CapabilitiesVK final : public Capabilities,
   vk::PhysicalDeviceProperties device_properties_;
   bool supports_compute_subgroups_ = false;
   bool supports_device_transient_textures_ = false;
+  bool supports_fixed_rate_compression_ = false;
   bool is_valid_ = false;
 
   bool HasExtension(const std::string& ext) const;
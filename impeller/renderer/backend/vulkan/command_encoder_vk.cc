@@ -120,8 +120,12 @@ std::shared_ptr<CommandEncoderVK> CommandEncoderFactoryVK::Create() {
     return nullptr;
   }
 
-  auto tracked_objects = std::make_shared<TrackedObjectsVK>(
-      context, tls_pool, context->GetGPUTracer()->CreateGPUProbe());
+  auto probe = context->GetGPUTracer()->CreateGPUProbe();
+  if (label_.has_value()) {
+    probe->SetLabel(label_.value());
+  }
+  auto tracked_objects =
+      std::make_shared<TrackedObjectsVK>(context, tls_pool, std::move(probe));
   auto queue = context->GetGraphicsQueue();
 
   if (!tracked_objects || !tracked_objects->IsValid() || !queue) {
@@ -198,9 +202,8 @@ bool CommandEncoderVK::Submit(SubmitCallback callback) {
     VALIDATION_LOG << "Device lost.";
     return false;
   }
-  auto [fence_result, fence] = strong_device->GetDevice().createFenceUnique({});
-  if (fence_result != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Failed to create fence: " << vk::to_string(fence_result);
+  auto fence = fence_waiter_->AcquireFence();
+  if (!fence) {
     return false;
   }
 
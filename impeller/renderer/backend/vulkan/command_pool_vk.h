@@ -24,7 +24,10 @@ class CommandPoolRecyclerVK;
 /// the lifecycle of a single |vk::CommandPool| by returning to the origin
 /// (|CommandPoolRecyclerVK|) when it is destroyed to be reused.
 ///
-/// @warning    This class is not thread-safe.
+/// @warning    This class is not thread-safe. Each instance is handed out to
+///             a single thread by |CommandPoolRecyclerVK::Get|, so threads
+///             recording command buffers concurrently each use their own pool
+///             and never contend on a shared lock.
 ///
 /// @see        |CommandPoolRecyclerVK|
 class CommandPoolVK final {
@@ -16,9 +16,11 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "flutter/fml/cpu_affinity.h"
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/backend/vulkan/allocator_vk.h"
@@ -78,6 +80,21 @@ static std::vector<vk::DeviceQueueCreateInfo> GetQueueCreateInfos(
   return infos;
 }
 
+static uint64_t HashShaderLibraries(
+    const std::vector<std::shared_ptr<fml::Mapping>>& libraries) {
+  size_t hash = 0u;
+  for (const auto& library : libraries) {
+    if (!library) {
+      continue;
+    }
+    fml::HashCombineSeed(
+        hash, std::hash<std::string_view>{}(std::string_view{
+                  reinterpret_cast<const char*>(library->GetMapping()),
+                  library->GetSize()}));
+  }
+  return hash;
+}
+
 static std::optional<QueueIndexVK> PickQueue(const vk::PhysicalDevice& device,
                                              vk::QueueFlagBits flags) {
   // This can be modified to ensure that dedicated queues are returned for each
@@ -136,12 +153,12 @@ void ContextVK::Setup(Settings settings) {
     fml::RequestAffinity(fml::CpuAffinity::kEfficiency);
   });
 
+  // Currently we only use the worker task pool for small parts of a frame
+  // workload, if this changes the affinity may need to be adjusted.
   raster_message_loop_ = fml::ConcurrentMessageLoop::Create(
-      std::min(4u, std::thread::hardware_concurrency()));
+      std::min(4u, std::thread::hardware_concurrency()),
+      fml::CpuAffinity::kNotPerformance);
   raster_message_loop_->PostTaskToAllWorkers([]() {
-    // Currently we only use the worker task pool for small parts of a frame
-    // workload, if this changes this setting may need to be adjusted.
-    fml::RequestAffinity(fml::CpuAffinity::kNotPerformance);
 #ifdef FML_OS_ANDROID
     if (::setpriority(PRIO_PROCESS, gettid(), -5) != 0) {
       FML_LOG(ERROR) << "Failed to set Workers task runner priority";
@@ -323,6 +340,14 @@ void ContextVK::Setup(Settings settings) {
   device_info.setPEnabledFeatures(&enabled_features.value());
   // Device layers are deprecated and ignored.
 
+  // Lets textures that ask for lossy compression use fixed-rate compression,
+  // as they already do on Metal.
+  vk::PhysicalDeviceImageCompressionControlFeaturesEXT compression_control;
+  if (caps->SupportsImageCompressionControl(device_holder->physical_device)) {
+    compression_control.imageCompressionControl = VK_TRUE;
+    device_info.setPNext(&compression_control);
+  }
+
   {
     auto device_result =
         device_holder->physical_device.createDeviceUnique(device_info);
@@ -356,12 +381,16 @@ void ContextVK::Setup(Settings settings) {
   }
 
   //----------------------------------------------------------------------------
-  /// Setup the pipeline library.
+  /// Setup the pipeline library. The on-disk pipeline cache is keyed by the
+  /// shaders so that a cache written by a different engine build is discarded.
   ///
+  const auto shader_libraries_hash =
+      HashShaderLibraries(settings.shader_libraries_data);
   auto pipeline_library = std::shared_ptr<PipelineLibraryVK>(
       new PipelineLibraryVK(device_holder,                         //
                             caps,                                  //
                             std::move(settings.cache_directory),   //
+                            shader_libraries_hash,                 //
                             raster_message_loop_->GetTaskRunner()  //
                             ));
 
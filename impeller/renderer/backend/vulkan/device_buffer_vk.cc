@@ -46,6 +46,12 @@ bool DeviceBufferVK::OnCopyHostBuffer(const uint8_t* source,
   return true;
 }
 
+void DeviceBufferVK::Flush(Range range) const {
+  ::vmaFlushAllocation(resource_->buffer.get().allocator,
+                       resource_->buffer.get().allocation, range.offset,
+                       range.length);
+}
+
 bool DeviceBufferVK::SetLabel(const std::string& label) {
   auto context = context_.lock();
   if (!context || !resource_->buffer.is_valid()) {
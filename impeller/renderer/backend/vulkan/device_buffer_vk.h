@@ -62,6 +62,9 @@ class DeviceBufferVK final : public DeviceBuffer,
                         Range source_range,
                         size_t offset) override;
 
+  // |DeviceBuffer|
+  void Flush(Range range) const override;
+
   // |DeviceBuffer|
   bool SetLabel(const std::string& label) override;
 
@@ -15,6 +15,10 @@
 
 namespace impeller {
 
+// The most signaled fences kept around for reuse. Each frame usually submits
+// a handful of command buffers, so this covers a few frames in flight.
+static constexpr size_t kMaxFreeFences = 16u;
+
 class WaitSetEntry {
  public:
   static std::shared_ptr<WaitSetEntry> Create(vk::UniqueFence p_fence,
@@ -32,6 +36,8 @@ class WaitSetEntry {
 
   const vk::Fence& GetFence() const { return fence_.get(); }
 
+  vk::UniqueFence TakeFence() { return std::move(fence_); }
+
   bool IsSignalled() const { return is_signalled_; }
 
  private:
@@ -62,6 +68,27 @@ FenceWaiterVK::~FenceWaiterVK() {
   waiter_thread_->join();
 }
 
+vk::UniqueFence FenceWaiterVK::AcquireFence() {
+  {
+    std::scoped_lock lock(free_fences_mutex_);
+    if (!free_fences_.empty()) {
+      auto fence = std::move(free_fences_.front());
+      free_fences_.pop_front();
+      return fence;
+    }
+  }
+  auto device_holder = device_holder_.lock();
+  if (!device_holder) {
+    return {};
+  }
+  auto [result, fence] = device_holder->GetDevice().createFenceUnique({});
+  if (result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to create fence: " << vk::to_string(result);
+    return {};
+  }
+  return std::move(fence);
+}
+
 bool FenceWaiterVK::AddFence(vk::UniqueFence fence,
                              const fml::closure& callback) {
   TRACE_EVENT0("flutter", "FenceWaiterVK::AddFence");
@@ -113,6 +140,10 @@ void FenceWaiterVK::Main() {
 
     if (terminate) {
       WaitUntilEmpty();
+      // The device may be torn down soon after the waiter is terminated, so
+      // don't keep fences created from it around.
+      std::scoped_lock lock(free_fences_mutex_);
+      free_fences_.clear();
       break;
     }
 
@@ -196,15 +227,57 @@ bool FenceWaiterVK::Wait() {
         wait_set_.end());
   }
 
+  std::vector<vk::UniqueFence> signaled_fences;
+  signaled_fences.reserve(erased_entries.size());
+  for (const auto& entry : erased_entries) {
+    signaled_fences.emplace_back(entry->TakeFence());
+  }
+
   {
     TRACE_EVENT0("impeller", "ClearSignaledFences");
     // Erase the erased entries which will invoke callbacks.
     erased_entries.clear();  // Bit redundant because of scope but hey.
   }
 
+  RecycleFences(device, std::move(signaled_fences));
+
   return true;
 }
 
+void FenceWaiterVK::RecycleFences(const vk::Device& device,
+                                  std::vector<vk::UniqueFence> fences) {
+  if (fences.empty()) {
+    return;
+  }
+  {
+    std::scoped_lock lock(free_fences_mutex_);
+    if (free_fences_.size() >= kMaxFreeFences) {
+      return;
+    }
+    fences.resize(
+        std::min(fences.size(), kMaxFreeFences - free_fences_.size()));
+  }
+
+  // Reset all the fences with a single call instead of creating new ones for
+  // the submissions they will be reused for.
+  std::vector<vk::Fence> raw_fences;
+  raw_fences.reserve(fences.size());
+  for (const auto& fence : fences) {
+    raw_fences.emplace_back(fence.get());
+  }
+  if (device.resetFences(raw_fences) != vk::Result::eSuccess) {
+    return;
+  }
+
+  std::scoped_lock lock(free_fences_mutex_);
+  for (auto& fence : fences) {
+    if (free_fences_.size() >= kMaxFreeFences) {
+      break;
+    }
+    free_fences_.emplace_back(std::move(fence));
+  }
+}
+
 void FenceWaiterVK::Terminate() {
   {
     std::scoped_lock lock(wait_set_mutex_);
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -31,6 +32,15 @@ class FenceWaiterVK {
 
   void Terminate();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns an unsignaled fence to submit work with, reusing the
+  ///             fence of an earlier submission whose callback has run if one
+  ///             is available.
+  ///
+  /// @return     The fence, or a null fence if one could not be created.
+  ///
+  vk::UniqueFence AcquireFence();
+
   bool AddFence(vk::UniqueFence fence, const fml::closure& callback);
 
  private:
@@ -42,6 +52,8 @@ class FenceWaiterVK {
   std::condition_variable wait_set_cv_;
   WaitSet wait_set_;
   bool terminate_ = false;
+  std::mutex free_fences_mutex_;
+  std::deque<vk::UniqueFence> free_fences_;
 
   explicit FenceWaiterVK(std::weak_ptr<DeviceHolder> device_holder);
 
@@ -49,6 +61,8 @@ class FenceWaiterVK {
 
   bool Wait();
   void WaitUntilEmpty();
+  void RecycleFences(const vk::Device& device,
+                     std::vector<vk::UniqueFence> fences);
 
   FenceWaiterVK(const FenceWaiterVK&) = delete;
 
@@ -126,5 +126,29 @@ TEST(FenceWaiterVKTest, InProgressFencesStillWaitIfTerminated) {
   signal.Wait();
 }
 
+TEST(FenceWaiterVKTest, ReusesSignaledFences) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const waiter = context->GetFenceWaiter();
+
+  auto fence = waiter->AcquireFence();
+  ASSERT_TRUE(fence);
+  auto raw_fence = MockFence::GetRawPointer(fence);
+  auto signal = fml::ManualResetWaitableEvent();
+  waiter->AddFence(std::move(fence), [&signal]() { signal.Signal(); });
+  signal.Wait();
+
+  // The first fence is recycled after its callback runs, before the waiter
+  // looks at fences added later. Wait for a second fence to be sure the first
+  // one is back in the pool.
+  auto signal2 = fml::ManualResetWaitableEvent();
+  auto fence2 = context->GetDevice().createFenceUnique({}).value;
+  waiter->AddFence(std::move(fence2), [&signal2]() { signal2.Signal(); });
+  signal2.Wait();
+
+  auto reused_fence = waiter->AcquireFence();
+  ASSERT_TRUE(reused_fence);
+  EXPECT_EQ(MockFence::GetRawPointer(reused_fence), raw_fence);
+}
+
 }  // namespace testing
 }  // namespace impeller
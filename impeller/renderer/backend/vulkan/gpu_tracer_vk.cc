@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <thread>
 #include <utility>
 #include "fml/logging.h"
@@ -61,6 +62,7 @@ void GPUTracerVK::MarkFrameEnd() {
 
   state.pending_buffers = 0;
   state.current_index = 0;
+  state.cmd_buffers.clear();
   in_frame_ = false;
 }
 
@@ -104,6 +106,7 @@ void GPUTracerVK::RecordCmdBufferStart(const vk::CommandBuffer& buffer,
   buffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe,
                         trace_states_[current_state_].query_pool.get(),
                         state.current_index);
+  probe.start_query_ = state.current_index;
   state.current_index += 1;
   if (!probe.index_.has_value()) {
     state.pending_buffers += 1;
@@ -126,6 +129,11 @@ void GPUTracerVK::RecordCmdBufferEnd(const vk::CommandBuffer& buffer,
 
   buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe,
                         state.query_pool.get(), state.current_index);
+  // The start of the cmd buffer may have been recorded in the pool of the
+  // previous frame.
+  if (probe.index_ == current_state_) {
+    probe.end_query_ = state.current_index;
+  }
 
   state.current_index += 1;
   if (!probe.index_.has_value()) {
@@ -134,7 +142,8 @@ void GPUTracerVK::RecordCmdBufferEnd(const vk::CommandBuffer& buffer,
   }
 }
 
-void GPUTracerVK::OnFenceComplete(size_t frame_index) {
+void GPUTracerVK::OnFenceComplete(size_t frame_index,
+                                  const GPUProbe& probe) {
   if (!enabled_) {
     return;
   }
@@ -143,6 +152,10 @@ void GPUTracerVK::OnFenceComplete(size_t frame_index) {
 
   FML_DCHECK(state.pending_buffers > 0);
   state.pending_buffers -= 1;
+  if (probe.start_query_.has_value() && probe.end_query_.has_value()) {
+    state.cmd_buffers.push_back({probe.label_, probe.start_query_.value(),
+                                 probe.end_query_.value()});
+  }
 
   if (state.pending_buffers == 0) {
     auto buffer_count = state.current_index;
@@ -176,6 +189,21 @@ void GPUTracerVK::OnFenceComplete(size_t frame_index) {
     FML_TRACE_COUNTER("flutter", "GPUTracer",
                       reinterpret_cast<int64_t>(this),  // Trace Counter ID
                       "FrameTimeMS", gpu_ms);
+
+    for (const auto& cmd_buffer : state.cmd_buffers) {
+      if (cmd_buffer.label.empty() || bits[cmd_buffer.end_query] <
+                                          bits[cmd_buffer.start_query]) {
+        continue;
+      }
+      auto cmd_buffer_ms = std::to_string(
+          ((bits[cmd_buffer.end_query] - bits[cmd_buffer.start_query]) *
+           timestamp_period_) /
+          1000000);
+      TRACE_EVENT_INSTANT2("flutter", "GPUTracer::CommandBuffer",  //
+                           "Label", cmd_buffer.label.c_str(),      //
+                           "TimeMS", cmd_buffer_ms.c_str());
+    }
+    state.cmd_buffers.clear();
   }
 }
 
@@ -190,7 +218,7 @@ GPUProbe::~GPUProbe() {
   if (!tracer) {
     return;
   }
-  tracer->OnFenceComplete(index_.value());
+  tracer->OnFenceComplete(index_.value(), *this);
 }
 
 void GPUProbe::RecordCmdBufferStart(const vk::CommandBuffer& buffer) {
@@ -201,6 +229,10 @@ void GPUProbe::RecordCmdBufferStart(const vk::CommandBuffer& buffer) {
   tracer->RecordCmdBufferStart(buffer, *this);
 }
 
+void GPUProbe::SetLabel(std::string label) {
+  label_ = std::move(label);
+}
+
 void GPUProbe::RecordCmdBufferEnd(const vk::CommandBuffer& buffer) {
   auto tracer = tracer_.lock();
   if (!tracer) {
@@ -3,7 +3,9 @@
 // found in the LICENSE file.
 
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder.h"
@@ -15,6 +17,12 @@ class GPUProbe;
 
 /// @brief A class that uses timestamp queries to record the approximate GPU
 /// execution time.
+///
+/// Besides the time of the whole frame, the time of each labelled cmd buffer
+/// is reported as a "GPUTracer::CommandBuffer" instant event. Entity passes,
+/// and contents that render to subpasses like blurs, advanced blends and
+/// runtime effects, encode into their own cmd buffers, so these attribute the
+/// GPU time of a frame to the passes and filters that make it up.
 class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
  public:
   explicit GPUTracerVK(const std::shared_ptr<DeviceHolder>& device_holder);
@@ -42,10 +50,8 @@ class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
 
   static const constexpr size_t kTraceStatesSize = 32u;
 
-  /// @brief Signal that the cmd buffer is completed.
-  ///
-  ///        If [frame_index] is std::nullopt, this frame recording is ignored.
-  void OnFenceComplete(size_t frame);
+  /// @brief Signal that the cmd buffer traced by [probe] is completed.
+  void OnFenceComplete(size_t frame, const GPUProbe& probe);
 
   /// @brief Record a timestamp query into the provided cmd buffer to record
   ///        start time.
@@ -57,10 +63,18 @@ class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
 
   const std::shared_ptr<DeviceHolder> device_holder_;
 
+  /// The queries of a completed cmd buffer of a frame.
+  struct CmdBufferQueries {
+    std::string label;
+    size_t start_query = 0;
+    size_t end_query = 0;
+  };
+
   struct GPUTraceState {
     size_t current_index = 0;
     size_t pending_buffers = 0;
     vk::UniqueQueryPool query_pool;
+    std::vector<CmdBufferQueries> cmd_buffers;
   };
 
   mutable Mutex trace_state_mutex_;
@@ -103,11 +117,17 @@ class GPUProbe {
   ///        time.
   void RecordCmdBufferEnd(const vk::CommandBuffer& buffer);
 
+  /// @brief The label the GPU time of the cmd buffer is reported with.
+  void SetLabel(std::string label);
+
  private:
   friend class GPUTracerVK;
 
   std::weak_ptr<GPUTracerVK> tracer_;
   std::optional<size_t> index_ = std::nullopt;
+  std::string label_;
+  std::optional<size_t> start_query_ = std::nullopt;
+  std::optional<size_t> end_query_ = std::nullopt;
 };
 
 }  // namespace impeller
@@ -6,7 +6,10 @@
 
 #include "impeller/renderer/backend/vulkan/pipeline_cache_vk.h"
 
+#include <cstring>
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
 #include "flutter/fml/mapping.h"
 #include "impeller/base/validation.h"
@@ -16,25 +19,98 @@ namespace impeller {
 static constexpr const char* kPipelineCacheFileName =
     "flutter.impeller.vkcache";
 
+// Bump this when changes to how pipelines are created make previously cached
+// pipelines useless.
+static constexpr uint32_t kPipelineCacheVersion = 1u;
+
+static constexpr uint32_t kPipelineCacheMagic = 0x494d5043;  // 'IMPC'
+
+/// The header prepended to the driver's pipeline cache data on disk.
+struct PipelineCacheHeaderVK {
+  uint32_t magic = kPipelineCacheMagic;
+  uint32_t version = kPipelineCacheVersion;
+  uint32_t vendor_id = 0u;
+  uint32_t device_id = 0u;
+  uint32_t driver_version = 0u;
+  uint32_t api_version = 0u;
+  uint8_t uuid[VK_UUID_SIZE] = {};
+  uint64_t engine_hash = 0u;
+  uint64_t data_size = 0u;
+
+  PipelineCacheHeaderVK() = default;
+
+  PipelineCacheHeaderVK(const CapabilitiesVK& caps,
+                        uint64_t p_engine_hash,
+                        uint64_t p_data_size)
+      : engine_hash(p_engine_hash), data_size(p_data_size) {
+    const auto& props = caps.GetPhysicalDeviceProperties();
+    vendor_id = props.vendorID;
+    device_id = props.deviceID;
+    driver_version = props.driverVersion;
+    api_version = props.apiVersion;
+    std::memcpy(uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+  }
+
+  bool IsCompatibleWith(const PipelineCacheHeaderVK& other) const {
+    return magic == other.magic &&                    //
+           version == other.version &&                //
+           vendor_id == other.vendor_id &&            //
+           device_id == other.device_id &&            //
+           driver_version == other.driver_version &&  //
+           api_version == other.api_version &&        //
+           engine_hash == other.engine_hash &&        //
+           std::memcmp(uuid, other.uuid, VK_UUID_SIZE) == 0;
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<PipelineCacheHeaderVK>);
+
 static bool VerifyExistingCache(const fml::Mapping& mapping,
-                                const CapabilitiesVK& caps) {
-  return true;
+                                const CapabilitiesVK& caps,
+                                uint64_t engine_hash) {
+  if (mapping.GetSize() < sizeof(PipelineCacheHeaderVK)) {
+    return false;
+  }
+  PipelineCacheHeaderVK header;
+  std::memcpy(&header, mapping.GetMapping(), sizeof(header));
+  if (header.data_size != mapping.GetSize() - sizeof(header)) {
+    return false;
+  }
+  return header.IsCompatibleWith(
+      PipelineCacheHeaderVK{caps, engine_hash, header.data_size});
 }
 
 static std::shared_ptr<fml::Mapping> DecorateCacheWithMetadata(
-    std::shared_ptr<fml::Mapping> data) {
-  return data;
+    std::shared_ptr<fml::Mapping> data,
+    const CapabilitiesVK& caps,
+    uint64_t engine_hash) {
+  const PipelineCacheHeaderVK header{caps, engine_hash, data->GetSize()};
+  auto decorated = std::make_shared<std::vector<uint8_t>>(sizeof(header) +
+                                                          data->GetSize());
+  std::memcpy(decorated->data(), &header, sizeof(header));
+  std::memcpy(decorated->data() + sizeof(header), data->GetMapping(),
+              data->GetSize());
+  return std::make_shared<fml::NonOwnedMapping>(
+      decorated->data(), decorated->size(), [decorated](auto, auto) {});
 }
 
 static std::unique_ptr<fml::Mapping> RemoveMetadataFromCache(
     std::unique_ptr<fml::Mapping> data) {
-  return data;
+  if (!data || data->GetSize() < sizeof(PipelineCacheHeaderVK)) {
+    return nullptr;
+  }
+  std::shared_ptr<fml::Mapping> shared_data = std::move(data);
+  return std::make_unique<fml::NonOwnedMapping>(
+      shared_data->GetMapping() + sizeof(PipelineCacheHeaderVK),
+      shared_data->GetSize() - sizeof(PipelineCacheHeaderVK),
+      [shared_data](auto, auto) {});
 }
 
 static std::unique_ptr<fml::Mapping> OpenCacheFile(
     const fml::UniqueFD& base_directory,
     const std::string& cache_file_name,
-    const CapabilitiesVK& caps) {
+    const CapabilitiesVK& caps,
+    uint64_t engine_hash) {
   if (!base_directory.is_valid()) {
     return nullptr;
   }
@@ -43,7 +119,9 @@ static std::unique_ptr<fml::Mapping> OpenCacheFile(
   if (!mapping) {
     return nullptr;
   }
-  if (!VerifyExistingCache(*mapping, caps)) {
+  if (!VerifyExistingCache(*mapping, caps, engine_hash)) {
+    FML_LOG(INFO) << "Discarding pipeline cache written by a different driver "
+                     "or engine version.";
     return nullptr;
   }
   mapping = RemoveMetadataFromCache(std::move(mapping));
@@ -55,10 +133,12 @@ static std::unique_ptr<fml::Mapping> OpenCacheFile(
 
 PipelineCacheVK::PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
                                  std::shared_ptr<DeviceHolder> device_holder,
-                                 fml::UniqueFD cache_directory)
+                                 fml::UniqueFD cache_directory,
+                                 uint64_t engine_hash)
     : caps_(std::move(caps)),
       device_holder_(device_holder),
-      cache_directory_(std::move(cache_directory)) {
+      cache_directory_(std::move(cache_directory)),
+      engine_hash_(engine_hash) {
   if (!caps_ || !device_holder->GetDevice()) {
     return;
   }
@@ -66,7 +146,8 @@ PipelineCacheVK::PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
   const auto& vk_caps = CapabilitiesVK::Cast(*caps_);
 
   auto existing_cache_data =
-      OpenCacheFile(cache_directory_, kPipelineCacheFileName, vk_caps);
+      OpenCacheFile(cache_directory_, kPipelineCacheFileName, vk_caps,
+                    engine_hash_);
 
   vk::PipelineCacheCreateInfo cache_info;
   if (existing_cache_data) {
@@ -79,6 +160,7 @@ PipelineCacheVK::PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
 
   if (result == vk::Result::eSuccess) {
     cache_ = std::move(existing_cache);
+    did_load_cache_from_disk_ = !!existing_cache_data;
   } else {
     // Even though we perform consistency checks because we don't trust the
     // driver, the driver may have additional information that may cause it to
@@ -113,6 +195,17 @@ bool PipelineCacheVK::IsValid() const {
   return is_valid_;
 }
 
+bool PipelineCacheVK::DidLoadCacheFromDisk() const {
+  return did_load_cache_from_disk_;
+}
+
+void PipelineCacheVK::RecordPipelineCacheLookup(bool hit) {
+  cache_lookups_++;
+  if (hit) {
+    cache_hits_++;
+  }
+}
+
 vk::UniquePipeline PipelineCacheVK::CreatePipeline(
     const vk::GraphicsPipelineCreateInfo& info) {
   std::shared_ptr<DeviceHolder> strong_device = device_holder_.lock();
@@ -126,6 +219,7 @@ vk::UniquePipeline PipelineCacheVK::CreatePipeline(
     VALIDATION_LOG << "Could not create graphics pipeline: "
                    << vk::to_string(result);
   }
+  pipelines_since_persist_++;
   return std::move(pipeline);
 }
 
@@ -142,6 +236,7 @@ vk::UniquePipeline PipelineCacheVK::CreatePipeline(
     VALIDATION_LOG << "Could not create compute pipeline: "
                    << vk::to_string(result);
   }
+  pipelines_since_persist_++;
   return std::move(pipeline);
 }
 
@@ -166,16 +261,32 @@ std::shared_ptr<fml::Mapping> PipelineCacheVK::CopyPipelineCacheData() const {
       shared_data->data(), shared_data->size(), [shared_data](auto, auto) {});
 }
 
-void PipelineCacheVK::PersistCacheToDisk() const {
+void PipelineCacheVK::PersistCacheToDisk() {
   if (!cache_directory_.is_valid()) {
     return;
   }
+  Lock lock(persist_mutex_);
+  if (!did_report_hit_rate_) {
+    did_report_hit_rate_ = true;
+    if (const size_t lookups = cache_lookups_.load(); lookups > 0u) {
+      FML_LOG(INFO) << "Pipeline cache "
+                    << (did_load_cache_from_disk_ ? "loaded from disk"
+                                                  : "created empty")
+                    << " served " << cache_hits_.load() << " of " << lookups
+                    << " pipelines.";
+    }
+  }
+  if (pipelines_since_persist_.exchange(0u) == 0u) {
+    // Nothing new to write since the last time.
+    return;
+  }
   auto data = CopyPipelineCacheData();
   if (!data) {
     VALIDATION_LOG << "Could not copy pipeline cache data.";
     return;
   }
-  data = DecorateCacheWithMetadata(std::move(data));
+  data = DecorateCacheWithMetadata(std::move(data), *GetCapabilities(),
+                                   engine_hash_);
   if (!data) {
     VALIDATION_LOG
         << "Could not decorate pipeline cache with additional metadata.";
@@ -4,13 +4,29 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "flutter/fml/file.h"
 #include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/capabilities_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder.h"
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      A Vulkan pipeline cache that is seeded from and persisted to a
+///             file in the cache directory.
+///
+///             The file is prefixed with a header identifying the driver that
+///             produced it along with a hash of the engine shaders. A cache
+///             written by a different driver or engine build is discarded
+///             instead of being handed to the driver.
+///
+///             Since the cache is seeded from the previous session's data,
+///             each persisted cache contains the pipelines of every session
+///             that came before it.
+///
 class PipelineCacheVK {
  public:
   // The [device] is passed in directly so that it can be used in the
@@ -19,7 +35,8 @@ class PipelineCacheVK {
   // initialization.
   explicit PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
                            std::shared_ptr<DeviceHolder> device_holder,
-                           fml::UniqueFD cache_directory);
+                           fml::UniqueFD cache_directory,
+                           uint64_t engine_hash = 0u);
 
   ~PipelineCacheVK();
 
@@ -31,14 +48,38 @@ class PipelineCacheVK {
 
   const CapabilitiesVK* GetCapabilities() const;
 
-  void PersistCacheToDisk() const;
+  //----------------------------------------------------------------------------
+  /// @brief      Write the cache to disk if pipelines were created since it was
+  ///             last written. This may be called from any thread.
+  ///
+  void PersistCacheToDisk();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the cache was seeded with data from a previous
+  ///             session.
+  ///
+  bool DidLoadCacheFromDisk() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record whether the driver found a pipeline in the cache as
+  ///             reported by pipeline creation feedback. The hit rate is
+  ///             logged the first time the cache is persisted.
+  ///
+  void RecordPipelineCacheLookup(bool hit);
 
  private:
   const std::shared_ptr<const Capabilities> caps_;
   std::weak_ptr<DeviceHolder> device_holder_;
   const fml::UniqueFD cache_directory_;
+  const uint64_t engine_hash_;
   vk::UniquePipelineCache cache_;
   bool is_valid_ = false;
+  bool did_load_cache_from_disk_ = false;
+  std::atomic_size_t pipelines_since_persist_ = 0u;
+  std::atomic_size_t cache_lookups_ = 0u;
+  std::atomic_size_t cache_hits_ = 0u;
+  Mutex persist_mutex_;
+  bool did_report_hit_rate_ IPLR_GUARDED_BY(persist_mutex_) = false;
 
   std::shared_ptr<fml::Mapping> CopyPipelineCacheData() const;
 
@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/file.h"
+#include "flutter/testing/testing.h"  // IWYU pragma: keep.
+#include "impeller/renderer/backend/vulkan/context_vk.h"
+#include "impeller/renderer/backend/vulkan/pipeline_cache_vk.h"
+#include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
+
+namespace impeller {
+namespace testing {
+
+static fml::UniqueFD OpenCacheDirectory(
+    const fml::ScopedTemporaryDirectory& directory) {
+  return fml::OpenDirectory(directory.path().c_str(), false,
+                            fml::FilePermission::kReadWrite);
+}
+
+TEST(PipelineCacheVKTest, PersistedCacheIsLoadedBySameEngine) {
+  auto const context = MockVulkanContextBuilder().Build();
+  fml::ScopedTemporaryDirectory directory;
+
+  {
+    PipelineCacheVK cache(context->GetCapabilities(),
+                          context->GetDeviceHolder(),
+                          OpenCacheDirectory(directory), 42u);
+    ASSERT_TRUE(cache.IsValid());
+    EXPECT_FALSE(cache.DidLoadCacheFromDisk());
+    EXPECT_TRUE(cache.CreatePipeline(vk::GraphicsPipelineCreateInfo{}));
+    cache.PersistCacheToDisk();
+  }
+
+  PipelineCacheVK same_engine(context->GetCapabilities(),
+                              context->GetDeviceHolder(),
+                              OpenCacheDirectory(directory), 42u);
+  EXPECT_TRUE(same_engine.DidLoadCacheFromDisk());
+
+  PipelineCacheVK other_engine(context->GetCapabilities(),
+                               context->GetDeviceHolder(),
+                               OpenCacheDirectory(directory), 7u);
+  EXPECT_FALSE(other_engine.DidLoadCacheFromDisk());
+
+  context->Shutdown();
+}
+
+TEST(PipelineCacheVKTest, DoesNotPersistWithoutNewPipelines) {
+  auto const context = MockVulkanContextBuilder().Build();
+  fml::ScopedTemporaryDirectory directory;
+
+  {
+    PipelineCacheVK cache(context->GetCapabilities(),
+                          context->GetDeviceHolder(),
+                          OpenCacheDirectory(directory));
+    cache.PersistCacheToDisk();
+  }
+
+  PipelineCacheVK cache(context->GetCapabilities(), context->GetDeviceHolder(),
+                        OpenCacheDirectory(directory));
+  EXPECT_FALSE(cache.DidLoadCacheFromDisk());
+
+  context->Shutdown();
+}
+
+}  // namespace testing
+}  // namespace impeller
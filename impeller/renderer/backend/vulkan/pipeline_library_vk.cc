@@ -9,6 +9,7 @@
 #include <optional>
 #include <sstream>
 
+#include "flutter/fml/cache_statistics.h"
 #include "flutter/fml/container.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/promise.h"
@@ -26,11 +27,13 @@ PipelineLibraryVK::PipelineLibraryVK(
     const std::shared_ptr<DeviceHolder>& device_holder,
     std::shared_ptr<const Capabilities> caps,
     fml::UniqueFD cache_directory,
+    uint64_t engine_hash,
     std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
     : device_holder_(device_holder),
       pso_cache_(std::make_shared<PipelineCacheVK>(std::move(caps),
                                                    device_holder,
-                                                   std::move(cache_directory))),
+                                                   std::move(cache_directory),
+                                                   engine_hash)),
       worker_task_runner_(std::move(worker_task_runner)) {
   FML_DCHECK(worker_task_runner_);
   if (!pso_cache_->IsValid() || !worker_task_runner_) {
@@ -207,11 +210,15 @@ static void ReportPipelineCreationFeedbackToTrace(
   static int64_t gPipelineCacheHits = 0;
   static int64_t gPipelineCacheMisses = 0;
   static int64_t gPipelines = 0;
+  static fml::CacheStatistics::Counters& cache_statistics =
+      fml::CacheStatistics::GetCounters("ImpellerPipelineCacheVK");
   if (feedback.pPipelineCreationFeedback->flags &
       vk::PipelineCreationFeedbackFlagBits::eApplicationPipelineCacheHit) {
     gPipelineCacheHits++;
+    cache_statistics.RecordHit();
   } else {
     gPipelineCacheMisses++;
+    cache_statistics.RecordMiss();
   }
   gPipelines++;
   static constexpr int64_t kImpellerPipelineTraceID = 1988;
@@ -479,6 +486,9 @@ std::unique_ptr<PipelineVK> PipelineLibraryVK::CreatePipeline(
 
   if (supports_pipeline_creation_feedback) {
     ReportPipelineCreationFeedback(desc, feedback);
+    pso_cache_->RecordPipelineCacheLookup(static_cast<bool>(
+        feedback.pPipelineCreationFeedback->flags &
+        vk::PipelineCreationFeedbackFlagBits::eApplicationPipelineCacheHit));
   }
 
   ContextVK::SetDebugName(strong_device->GetDevice(), *pipeline_layout.value,
@@ -624,24 +634,29 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
 
   auto weak_this = weak_from_this();
 
-  worker_task_runner_->PostTask([descriptor, weak_this, promise]() {
-    auto thiz = weak_this.lock();
-    if (!thiz) {
-      promise->set_value(nullptr);
-      VALIDATION_LOG << "Pipeline library was collected before the pipeline "
-                        "could be created.";
-      return;
-    }
+  // Pipelines are usually created because a frame needs them.
+  worker_task_runner_->PostTask(
+      [descriptor, weak_this, promise]() {
+        auto thiz = weak_this.lock();
+        if (!thiz) {
+          promise->set_value(nullptr);
+          VALIDATION_LOG << "Pipeline library was collected before the "
+                            "pipeline could be created.";
+          return;
+        }
 
-    auto pipeline = PipelineLibraryVK::Cast(*thiz).CreatePipeline(descriptor);
-    if (!pipeline) {
-      promise->set_value(nullptr);
-      VALIDATION_LOG << "Could not create pipeline: " << descriptor.GetLabel();
-      return;
-    }
+        auto pipeline =
+            PipelineLibraryVK::Cast(*thiz).CreatePipeline(descriptor);
+        if (!pipeline) {
+          promise->set_value(nullptr);
+          VALIDATION_LOG << "Could not create pipeline: "
+                         << descriptor.GetLabel();
+          return;
+        }
 
-    promise->set_value(std::move(pipeline));
-  });
+        promise->set_value(std::move(pipeline));
+      },
+      fml::ConcurrentTaskPriority::kLatencySensitive);
 
   return pipeline_future;
 }
@@ -670,25 +685,28 @@ PipelineFuture<ComputePipelineDescriptor> PipelineLibraryVK::GetPipeline(
 
   auto weak_this = weak_from_this();
 
-  worker_task_runner_->PostTask([descriptor, weak_this, promise]() {
-    auto self = weak_this.lock();
-    if (!self) {
-      promise->set_value(nullptr);
-      VALIDATION_LOG << "Pipeline library was collected before the pipeline "
-                        "could be created.";
-      return;
-    }
+  worker_task_runner_->PostTask(
+      [descriptor, weak_this, promise]() {
+        auto self = weak_this.lock();
+        if (!self) {
+          promise->set_value(nullptr);
+          VALIDATION_LOG << "Pipeline library was collected before the "
+                            "pipeline could be created.";
+          return;
+        }
 
-    auto pipeline =
-        PipelineLibraryVK::Cast(*self).CreateComputePipeline(descriptor);
-    if (!pipeline) {
-      promise->set_value(nullptr);
-      VALIDATION_LOG << "Could not create pipeline: " << descriptor.GetLabel();
-      return;
-    }
+        auto pipeline =
+            PipelineLibraryVK::Cast(*self).CreateComputePipeline(descriptor);
+        if (!pipeline) {
+          promise->set_value(nullptr);
+          VALIDATION_LOG << "Could not create pipeline: "
+                         << descriptor.GetLabel();
+          return;
+        }
 
-    promise->set_value(std::move(pipeline));
-  });
+        promise->set_value(std::move(pipeline));
+      },
+      fml::ConcurrentTaskPriority::kLatencySensitive);
 
   return pipeline_future;
 }
@@ -705,7 +723,14 @@ void PipelineLibraryVK::RemovePipelinesWithEntryPoint(
 }
 
 void PipelineLibraryVK::DidAcquireSurfaceFrame() {
-  if (++frames_acquired_ == 50u) {
+  // Persist shortly after startup and then periodically. Applications are
+  // frequently killed without the context being shut down, so waiting until
+  // then would lose pipelines created during the session. Persisting is a
+  // no-op if no pipelines were created since the last time.
+  const auto frames = ++frames_acquired_;
+  if (frames == kFramesBeforeFirstPersist ||
+      (frames > kFramesBeforeFirstPersist &&
+       (frames - kFramesBeforeFirstPersist) % kFramesBetweenPersists == 0u)) {
     PersistPipelineCacheToDisk();
   }
 }
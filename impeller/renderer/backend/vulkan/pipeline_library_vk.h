@@ -42,6 +42,8 @@ class PipelineLibraryVK final
   Mutex compute_pipelines_mutex_;
   ComputePipelineMap compute_pipelines_
       IPLR_GUARDED_BY(compute_pipelines_mutex_);
+  static constexpr size_t kFramesBeforeFirstPersist = 50u;
+  static constexpr size_t kFramesBetweenPersists = 1000u;
   std::atomic_size_t frames_acquired_ = 0u;
   bool is_valid_ = false;
 
@@ -49,6 +51,7 @@ class PipelineLibraryVK final
       const std::shared_ptr<DeviceHolder>& device_holder,
       std::shared_ptr<const Capabilities> caps,
       fml::UniqueFD cache_directory,
+      uint64_t engine_hash,
       std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner);
 
   // |PipelineLibrary|
@@ -40,7 +40,11 @@ static vk::AttachmentDescription CreateAttachmentDescription(
   auto load_action = attachment.load_action;
   auto store_action = attachment.store_action;
 
-  if (current_layout == vk::ImageLayout::eUndefined) {
+  if (texture_ptr == &Attachment::resolve_texture) {
+    // The resolve at the end of the subpass overwrites every pixel of the
+    // resolve attachment, so loading or clearing it first only costs bandwidth.
+    load_action = LoadAction::kDontCare;
+  } else if (current_layout == vk::ImageLayout::eUndefined) {
     load_action = LoadAction::kClear;
   }
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "flutter/fml/macros.h"
 #include "impeller/base/comparable.h"
 #include "impeller/base/thread.h"
@@ -28,6 +30,13 @@ class ShaderLibraryVK final : public ShaderLibrary {
   const UniqueID library_id_;
   mutable RWMutex functions_mutex_;
   ShaderFunctionMap functions_ IPLR_GUARDED_BY(functions_mutex_);
+  // The code of the shaders from the archives whose modules haven't been
+  // created yet. Modules are created the first time a function is requested.
+  std::unordered_map<ShaderKey,
+                     std::shared_ptr<fml::Mapping>,
+                     ShaderKey::Hash,
+                     ShaderKey::Equal>
+      pending_functions_ IPLR_GUARDED_BY(functions_mutex_);
   bool is_valid_ = false;
 
   ShaderLibraryVK(
@@ -48,6 +57,11 @@ class ShaderLibraryVK final : public ShaderLibrary {
                         ShaderStage stage,
                         const std::shared_ptr<fml::Mapping>& code);
 
+  std::shared_ptr<const ShaderFunction> CreateFunction(
+      const std::string& key_name,
+      ShaderStage stage,
+      const fml::Mapping& code) const;
+
   // |ShaderLibrary|
   void UnregisterFunction(std::string name, ShaderStage stage) override;
 
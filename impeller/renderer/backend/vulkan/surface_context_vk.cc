@@ -36,6 +36,11 @@ std::shared_ptr<ShaderLibrary> SurfaceContextVK::GetShaderLibrary() const {
   return parent_->GetShaderLibrary();
 }
 
+const std::shared_ptr<fml::ConcurrentTaskRunner>
+SurfaceContextVK::GetConcurrentWorkerTaskRunner() const {
+  return parent_->GetConcurrentWorkerTaskRunner();
+}
+
 std::shared_ptr<SamplerLibrary> SurfaceContextVK::GetSamplerLibrary() const {
   return parent_->GetSamplerLibrary();
 }
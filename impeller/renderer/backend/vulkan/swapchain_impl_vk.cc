@@ -20,6 +20,19 @@ namespace impeller {
 
 static constexpr size_t kMaxFramesInFlight = 3u;
 
+// The presentation engine may hold on to all but `image_count -
+// min_image_count + 1` of the swapchain images. Keeping more frames in flight
+// than that only moves the wait for the next frame from the frame fences into
+// the driver's image acquisition, which queues up frames behind the display
+// and adds latency.
+static size_t GetFramesInFlight(size_t image_count, size_t min_image_count) {
+  if (image_count < min_image_count) {
+    return 1u;
+  }
+  return std::clamp<size_t>(image_count - min_image_count + 1u, 1u,
+                            kMaxFramesInFlight);
+}
+
 // Number of frames to poll for orientation changes. For example `1u` means
 // that the orientation will be polled every frame, while `2u` means that the
 // orientation will be polled every other frame.
@@ -277,7 +290,9 @@ SwapchainImplVK::SwapchainImplVK(
   }
 
   std::vector<std::unique_ptr<FrameSynchronizer>> synchronizers;
-  for (size_t i = 0u; i < kMaxFramesInFlight; i++) {
+  const size_t frames_in_flight =
+      GetFramesInFlight(swapchain_images.size(), caps.minImageCount);
+  for (size_t i = 0u; i < frames_in_flight; i++) {
     auto sync = std::make_unique<FrameSynchronizer>(vk_context.GetDevice());
     if (!sync->is_valid) {
       VALIDATION_LOG << "Could not create frame synchronizers.";
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -232,6 +233,22 @@ VkResult vkCreatePipelineCache(VkDevice device,
   return VK_SUCCESS;
 }
 
+VkResult vkGetPipelineCacheData(VkDevice device,
+                                VkPipelineCache pipelineCache,
+                                size_t* pDataSize,
+                                void* pData) {
+  MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
+  mock_device->AddCalledFunction("vkGetPipelineCacheData");
+  static constexpr uint8_t kData[] = {0xde, 0xad, 0xbe, 0xef};
+  if (pData == nullptr) {
+    *pDataSize = sizeof(kData);
+    return VK_SUCCESS;
+  }
+  *pDataSize = std::min(*pDataSize, sizeof(kData));
+  memcpy(pData, kData, *pDataSize);
+  return VK_SUCCESS;
+}
+
 VkResult vkCreateCommandPool(VkDevice device,
                              const VkCommandPoolCreateInfo* pCreateInfo,
                              const VkAllocationCallbacks* pAllocator,
@@ -487,6 +504,12 @@ VkResult vkWaitForFences(VkDevice device,
   return VK_SUCCESS;
 }
 
+VkResult vkResetFences(VkDevice device,
+                       uint32_t fenceCount,
+                       const VkFence* fences) {
+  return VK_SUCCESS;
+}
+
 VkResult vkGetFenceStatus(VkDevice device, VkFence fence) {
   MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
   MockFence* mock_fence = reinterpret_cast<MockFence*>(fence);
@@ -593,6 +616,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return (PFN_vkVoidFunction)vkGetPhysicalDeviceMemoryProperties;
   } else if (strcmp("vkCreatePipelineCache", pName) == 0) {
     return (PFN_vkVoidFunction)vkCreatePipelineCache;
+  } else if (strcmp("vkGetPipelineCacheData", pName) == 0) {
+    return (PFN_vkVoidFunction)vkGetPipelineCacheData;
   } else if (strcmp("vkCreateCommandPool", pName) == 0) {
     return (PFN_vkVoidFunction)vkCreateCommandPool;
   } else if (strcmp("vkResetCommandPool", pName) == 0) {
@@ -663,6 +688,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return (PFN_vkVoidFunction)vkQueueSubmit;
   } else if (strcmp("vkWaitForFences", pName) == 0) {
     return (PFN_vkVoidFunction)vkWaitForFences;
+  } else if (strcmp("vkResetFences", pName) == 0) {
+    return (PFN_vkVoidFunction)vkResetFences;
   } else if (strcmp("vkGetFenceStatus", pName) == 0) {
     return (PFN_vkVoidFunction)vkGetFenceStatus;
   } else if (strcmp("vkCreateDebugUtilsMessengerEXT", pName) == 0) {
@@ -129,26 +129,39 @@ bool BlitPass::AddCopy(std::shared_ptr<Texture> source,
 
 bool BlitPass::AddCopy(BufferView source,
                        std::shared_ptr<Texture> destination,
-                       IPoint destination_origin,
+                       std::optional<IRect> destination_region,
                        std::string label) {
   if (!destination) {
     VALIDATION_LOG << "Attempted to add a texture blit with no destination.";
     return false;
   }
 
+  if (!destination_region.has_value()) {
+    destination_region = IRect::MakeSize(destination->GetSize());
+  }
+
+  if (destination_region->IsEmpty() ||
+      !IRect::MakeSize(destination->GetSize())
+           .Contains(destination_region.value())) {
+    VALIDATION_LOG
+        << "Attempted to add a texture blit with an invalid destination "
+           "region.";
+    return false;
+  }
+
   auto bytes_per_pixel =
       BytesPerPixelForPixelFormat(destination->GetTextureDescriptor().format);
-  auto bytes_per_image =
-      destination->GetTextureDescriptor().size.Area() * bytes_per_pixel;
+  auto bytes_per_region = destination_region->size.Area() * bytes_per_pixel;
 
-  if (source.range.length != bytes_per_image) {
+  if (source.range.length != static_cast<size_t>(bytes_per_region)) {
     VALIDATION_LOG
         << "Attempted to add a texture blit with out of bounds access.";
     return false;
   }
 
   return OnCopyBufferToTextureCommand(std::move(source), std::move(destination),
-                                      destination_origin, std::move(label));
+                                      destination_region.value(),
+                                      std::move(label));
 }
 
 bool BlitPass::GenerateMipmap(std::shared_ptr<Texture> texture,
@@ -73,5 +73,34 @@ TEST_P(BlitPassTest, BlitPassesForMatchingFormats) {
   EXPECT_TRUE(blit_pass->AddCopy(src, dst));
 }
 
+TEST_P(BlitPassTest, BufferToTextureBlitRejectsInvalidRegions) {
+  ScopedValidationDisable scope;  // avoid noise in output.
+  auto context = GetContext();
+  auto cmd_buffer = context->CreateCommandBuffer();
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+
+  TextureDescriptor dst_format;
+  dst_format.format = PixelFormat::kR8G8B8A8UNormInt;
+  dst_format.size = {100, 100};
+  auto dst = context->GetResourceAllocator()->CreateTexture(dst_format);
+
+  auto src = context->GetResourceAllocator()->CreateBuffer({
+      .size = 10 * 10 * 4,
+  });
+  ASSERT_TRUE(src);
+
+  // Extends past the bottom right of the destination.
+  EXPECT_FALSE(blit_pass->AddCopy(src->AsBufferView(), dst,
+                                  IRect::MakeXYWH(95, 95, 10, 10)));
+  // Source is too small for the destination region.
+  EXPECT_FALSE(blit_pass->AddCopy(src->AsBufferView(), dst,
+                                  IRect::MakeXYWH(0, 0, 20, 20)));
+  // Source is too small for the entire texture.
+  EXPECT_FALSE(blit_pass->AddCopy(src->AsBufferView(), dst));
+  // Empty regions are rejected.
+  EXPECT_FALSE(blit_pass->AddCopy(src->AsBufferView(), dst,
+                                  IRect::MakeXYWH(10, 10, 0, 0)));
+}
+
 }  // namespace testing
 }  // namespace impeller
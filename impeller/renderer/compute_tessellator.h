@@ -16,6 +16,12 @@ namespace impeller {
 /// @brief      A utility that generates triangles of the specified fill type
 ///             given a path.
 ///
+///             This is not yet used by the entity geometries. The shaders
+///             only produce butt capped strokes without joins, merge all
+///             contours into a single polyline, and rely on the whole path
+///             fitting in a single workgroup's shared memory. Paths large
+///             enough to benefit from GPU tessellation exceed those limits.
+///
 class ComputeTessellator {
  public:
   ComputeTessellator();
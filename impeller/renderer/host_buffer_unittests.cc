@@ -3,11 +3,16 @@
 // found in the LICENSE file.
 
 #include "flutter/testing/testing.h"
+#include "impeller/core/device_buffer.h"
 #include "impeller/core/host_buffer.h"
+#include "impeller/renderer/testing/mocks.h"
 
 namespace impeller {
 namespace testing {
 
+using ::testing::_;
+using ::testing::Return;
+
 TEST(HostBufferTest, TestInitialization) {
   ASSERT_TRUE(HostBuffer::Create());
   // Newly allocated buffers don't touch the heap till they have to.
@@ -75,5 +80,112 @@ TEST(HostBufferTest, CanEmplaceWithAlignment) {
   }
 }
 
+TEST(HostBufferTest, ResetPreservesContentsOfPreviousArena) {
+  auto buffer = HostBuffer::Create();
+
+  uint32_t value = 0xAABBCCDD;
+  auto view = buffer->Emplace(value);
+  ASSERT_TRUE(view);
+
+  buffer->Reset();
+  EXPECT_EQ(buffer->GetLength(), 0u);
+  EXPECT_EQ(buffer->GetLastFrameLength(), sizeof(uint32_t));
+
+  // Writing into the next arena must not disturb the previous frame's data.
+  uint32_t other = 0x11223344;
+  auto other_view = buffer->Emplace(other);
+  ASSERT_TRUE(other_view);
+  EXPECT_NE(view.contents, other_view.contents);
+  EXPECT_EQ(*reinterpret_cast<uint32_t*>(view.contents + view.range.offset),
+            0xAABBCCDD);
+}
+
+TEST(HostBufferTest, ArenasAreReusedAtSteadyState) {
+  auto buffer = HostBuffer::Create();
+
+  uint8_t* first_contents = nullptr;
+  for (size_t i = 0; i < HostBuffer::kHostBufferArenaCount * 2; i++) {
+    auto view = buffer->Emplace(uint64_t{i});
+    ASSERT_TRUE(view);
+    if (i == 0) {
+      first_contents = view.contents;
+    } else if (i % HostBuffer::kHostBufferArenaCount == 0) {
+      // The arena was released by everyone else and its allocation is kept.
+      EXPECT_EQ(view.contents, first_contents);
+    }
+    view = {};
+    buffer->Reset();
+  }
+  EXPECT_EQ(buffer->GetHighWaterMark(), sizeof(uint64_t));
+}
+
+TEST(HostBufferTest, ReferencedArenaIsNotOverwritten) {
+  auto buffer = HostBuffer::Create();
+
+  uint32_t value = 42u;
+  // Simulates a buffer view held by a command buffer still in flight.
+  auto in_flight = buffer->Emplace(value);
+  ASSERT_TRUE(in_flight);
+
+  for (size_t i = 0; i < HostBuffer::kHostBufferArenaCount; i++) {
+    buffer->Reset();
+  }
+
+  // The ring wrapped around but the referenced arena was replaced instead of
+  // being truncated.
+  auto view = buffer->Emplace(uint32_t{7u});
+  ASSERT_TRUE(view);
+  EXPECT_NE(view.buffer, in_flight.buffer);
+  EXPECT_EQ(
+      *reinterpret_cast<uint32_t*>(in_flight.contents + in_flight.range.offset),
+      42u);
+}
+
+TEST(HostBufferTest, EmplacesDirectlyIntoDeviceMemoryWithUnifiedMemory) {
+  auto allocator = std::make_shared<MockAllocator>();
+  EXPECT_CALL(*allocator, HasUnifiedMemory()).WillRepeatedly(Return(true));
+
+  std::vector<uint8_t> storage(HostBuffer::kDeviceBlockSize);
+  std::shared_ptr<MockDeviceBuffer> block;
+  EXPECT_CALL(*allocator, OnCreateBuffer(_))
+      .WillOnce([&](const DeviceBufferDescriptor& desc) {
+        EXPECT_EQ(desc.storage_mode, StorageMode::kHostVisible);
+        block = std::make_shared<MockDeviceBuffer>(desc);
+        EXPECT_CALL(*block, OnGetContents())
+            .WillRepeatedly(Return(storage.data()));
+        return block;
+      });
+
+  auto buffer = HostBuffer::Create();
+  buffer->SetDeviceAllocator(allocator);
+
+  auto view = buffer->Emplace(uint32_t{42u});
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view.buffer, block);
+  EXPECT_EQ(view.contents, storage.data());
+  EXPECT_EQ(*reinterpret_cast<uint32_t*>(storage.data() + view.range.offset),
+            42u);
+
+  // Subsequent emplacements are suballocated from the same block.
+  auto other_view = buffer->Emplace(uint32_t{7u});
+  ASSERT_TRUE(other_view);
+  EXPECT_EQ(other_view.buffer, block);
+  EXPECT_EQ(other_view.range.offset, 4u);
+  EXPECT_EQ(buffer->GetLength(), 2 * sizeof(uint32_t));
+}
+
+TEST(HostBufferTest, StagesInHostMemoryWithoutUnifiedMemory) {
+  auto allocator = std::make_shared<MockAllocator>();
+  EXPECT_CALL(*allocator, HasUnifiedMemory()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*allocator, OnCreateBuffer(_)).Times(0);
+
+  auto buffer = HostBuffer::Create();
+  buffer->SetDeviceAllocator(allocator);
+
+  auto view = buffer->Emplace(uint32_t{42u});
+  ASSERT_TRUE(view);
+  EXPECT_EQ(buffer->GetLength(), sizeof(uint32_t));
+}
+
 }  // namespace  testing
 }  // namespace impeller
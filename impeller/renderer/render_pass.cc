@@ -18,6 +18,8 @@ RenderPass::RenderPass(std::weak_ptr<const Context> context,
   auto strong_context = context_.lock();
   FML_DCHECK(strong_context);
   transients_buffer_ = strong_context->GetHostBufferPool().Grab();
+  transients_buffer_->SetDeviceAllocator(
+      strong_context->GetResourceAllocator());
 }
 
 RenderPass::~RenderPass() {
@@ -65,6 +67,10 @@ bool RenderPass::AddCommand(Command&& command) {
     return false;
   }
 
+  if (!command.scissor.has_value()) {
+    command.scissor = default_scissor_;
+  }
+
   if (command.scissor.has_value()) {
     auto target_rect = IRect::MakeSize(render_target_.GetRenderTargetSize());
     if (!target_rect.Contains(command.scissor.value())) {
@@ -85,6 +91,10 @@ bool RenderPass::AddCommand(Command&& command) {
   return true;
 }
 
+void RenderPass::SetDefaultScissor(std::optional<IRect> scissor) {
+  default_scissor_ = scissor;
+}
+
 bool RenderPass::EncodeCommands() const {
   auto context = context_.lock();
   // The context could have been collected in the meantime.
@@ -59,6 +59,15 @@ class RenderPass {
   ///
   bool AddCommand(Command&& command);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Set the scissor given to the commands that are subsequently
+  ///             added without a scissor of their own.
+  ///
+  /// @param[in]  scissor  The scissor, or `std::nullopt` to leave the
+  ///                      commands unscissored.
+  ///
+  void SetDefaultScissor(std::optional<IRect> scissor);
+
   //----------------------------------------------------------------------------
   /// @brief      Encode the recorded commands to the underlying command buffer.
   ///
@@ -100,6 +109,7 @@ class RenderPass {
   const RenderTarget render_target_;
   std::shared_ptr<HostBuffer> transients_buffer_;
   std::vector<Command> commands_;
+  std::optional<IRect> default_scissor_;
 
   RenderPass(std::weak_ptr<const Context> context, const RenderTarget& target);
 
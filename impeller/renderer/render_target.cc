@@ -22,6 +22,14 @@ void RenderTargetAllocator::Start() {}
 
 void RenderTargetAllocator::End() {}
 
+size_t RenderTargetAllocator::GetIdleByteSize() const {
+  return 0u;
+}
+
+size_t RenderTargetAllocator::Trim(size_t bytes) {
+  return 0u;
+}
+
 std::shared_ptr<Texture> RenderTargetAllocator::CreateTexture(
     const TextureDescriptor& desc) {
   return allocator_->CreateTexture(desc);
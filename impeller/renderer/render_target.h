@@ -41,6 +41,16 @@ class RenderTargetAllocator {
   ///        This may be used to deallocate any unused textures.
   virtual void End();
 
+  /// @brief The bytes of the textures that are retained for reuse but not
+  ///        used by anything else right now.
+  virtual size_t GetIdleByteSize() const;
+
+  /// @brief Release retained textures that are not in use until at least
+  ///        `bytes` have been freed or none are left.
+  ///
+  /// @return The bytes of the released textures.
+  virtual size_t Trim(size_t bytes);
+
  private:
   std::shared_ptr<Allocator> allocator_;
 };
@@ -177,6 +177,10 @@ DART_TEST_CASE(textureAsImageThrowsWhenNotShaderReadable);
 DART_TEST_CASE(canCreateShaderLibrary);
 
 DART_TEST_CASE(canCreateRenderPassAndSubmit);
+DART_TEST_CASE(canSubmitCommandBufferAsync);
+
+DART_TEST_CASE(computePipelineThrowsForNonComputeShader);
+DART_TEST_CASE(computePassDispatchThrowsWithoutPipeline);
 
 }  // namespace testing
 }  // namespace impeller
@@ -40,6 +40,7 @@ class MockDeviceBuffer : public DeviceBuffer {
 class MockAllocator : public Allocator {
  public:
   MOCK_METHOD(ISize, GetMaxTextureSizeSupported, (), (const, override));
+  MOCK_METHOD(bool, HasUnifiedMemory, (), (const, override));
   MOCK_METHOD(std::shared_ptr<DeviceBuffer>,
               OnCreateBuffer,
               (const DeviceBufferDescriptor& desc),
@@ -80,7 +81,7 @@ class MockBlitPass : public BlitPass {
               OnCopyBufferToTextureCommand,
               (BufferView source,
                std::shared_ptr<Texture> destination,
-               IPoint destination_origin,
+               IRect destination_region,
                std::string label),
               (override));
   MOCK_METHOD(bool,
@@ -104,8 +104,28 @@ RuntimeStage::RuntimeStage(std::shared_ptr<fml::Mapping> payload)
 }
 
 RuntimeStage::~RuntimeStage() = default;
-RuntimeStage::RuntimeStage(RuntimeStage&&) = default;
-RuntimeStage& RuntimeStage::operator=(RuntimeStage&&) = default;
+
+RuntimeStage::RuntimeStage(RuntimeStage&& other)
+    : stage_(other.stage_),
+      payload_(std::move(other.payload_)),
+      entrypoint_(std::move(other.entrypoint_)),
+      code_mapping_(std::move(other.code_mapping_)),
+      sksl_mapping_(std::move(other.sksl_mapping_)),
+      uniforms_(std::move(other.uniforms_)),
+      is_valid_(other.is_valid_),
+      is_dirty_(other.is_dirty_.load()) {}
+
+RuntimeStage& RuntimeStage::operator=(RuntimeStage&& other) {
+  stage_ = other.stage_;
+  payload_ = std::move(other.payload_);
+  entrypoint_ = std::move(other.entrypoint_);
+  code_mapping_ = std::move(other.code_mapping_);
+  sksl_mapping_ = std::move(other.sksl_mapping_);
+  uniforms_ = std::move(other.uniforms_);
+  is_valid_ = other.is_valid_;
+  is_dirty_ = other.is_dirty_.load();
+  return *this;
+}
 
 bool RuntimeStage::IsValid() const {
   return is_valid_;
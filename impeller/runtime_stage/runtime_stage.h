@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -48,7 +49,9 @@ class RuntimeStage {
   std::shared_ptr<fml::Mapping> sksl_mapping_;
   std::vector<RuntimeUniformDescription> uniforms_;
   bool is_valid_ = false;
-  bool is_dirty_ = true;
+  // Shaders may be registered on a background thread while the stage is being
+  // drawn.
+  std::atomic<bool> is_dirty_ = true;
 
   RuntimeStage(const RuntimeStage&) = delete;
 
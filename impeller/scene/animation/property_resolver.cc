@@ -66,11 +66,27 @@ TimelineResolver::TimelineKey TimelineResolver::GetTimelineKey(SecondsF time) {
   if (time.count() >= times_.back()) {
     return {.index = times_.size() - 1, .lerp = 1};
   }
-  auto it = std::lower_bound(times_.begin(), times_.end(), time.count());
-  size_t index = std::distance(times_.begin(), it);
+  // The keyframe at `index` is the first one at or after `time`. Playback
+  // usually moves forward by less than a keyframe per frame, so the keyframe
+  // of the previous lookup and the one after it are checked before searching
+  // the whole timeline.
+  auto is_key = [this, t = time.count()](size_t index) {
+    return index > 0 && index < times_.size() && times_[index - 1] < t &&
+           t <= times_[index];
+  };
+  size_t index = last_index_;
+  if (!is_key(index)) {
+    if (is_key(index + 1)) {
+      index++;
+    } else {
+      auto it = std::lower_bound(times_.begin(), times_.end(), time.count());
+      index = std::distance(times_.begin(), it);
+    }
+  }
+  last_index_ = index;
 
-  Scalar previous_time = *(it - 1);
-  Scalar next_time = *it;
+  Scalar previous_time = times_[index - 1];
+  Scalar next_time = times_[index];
   return {.index = index,
           .lerp = (time.count() - previous_time) / (next_time - previous_time)};
 }
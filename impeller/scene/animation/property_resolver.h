@@ -71,6 +71,10 @@ class TimelineResolver : public PropertyResolver {
   TimelineKey GetTimelineKey(SecondsF time);
 
   std::vector<Scalar> times_;
+
+ private:
+  /// The keyframe index found by the previous call to |GetTimelineKey|.
+  size_t last_index_ = 0;
 };
 
 class TranslationTimelineResolver final : public TimelineResolver {
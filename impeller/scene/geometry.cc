@@ -4,6 +4,7 @@
 
 #include "impeller/scene/geometry.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <ostream>
@@ -19,10 +20,70 @@
 #include "impeller/scene/importer/scene_flatbuffers.h"
 #include "impeller/scene/shaders/skinned.vert.h"
 #include "impeller/scene/shaders/unskinned.vert.h"
+#include "impeller/scene/shaders/unskinned_instanced.vert.h"
 
 namespace impeller {
 namespace scene {
 
+//------------------------------------------------------------------------------
+/// AxisAlignedBox
+///
+
+bool AxisAlignedBox::IsOutsideClipVolume(const Matrix& mvp) const {
+  // Count the corners outside of each clip plane. The box is outside of the
+  // clip volume when all of its corners are outside of the same plane.
+  // Visible depths are in [0, w].
+  size_t left = 0, right = 0, bottom = 0, top = 0, front = 0, back = 0;
+  for (size_t i = 0; i < 8; i++) {
+    Vector4 corner = mvp * Vector4((i & 1) ? max.x : min.x,
+                                   (i & 2) ? max.y : min.y,
+                                   (i & 4) ? max.z : min.z, 1.0);
+    left += corner.x < -corner.w;
+    right += corner.x > corner.w;
+    bottom += corner.y < -corner.w;
+    top += corner.y > corner.w;
+    front += corner.z < 0;
+    back += corner.z > corner.w;
+  }
+  return left == 8 || right == 8 || bottom == 8 || top == 8 || front == 8 ||
+         back == 8;
+}
+
+static std::optional<AxisAlignedBox> ComputeBounds(
+    const flatbuffers::Vector<const fb::Vertex*>& vertices) {
+  if (vertices.size() == 0) {
+    return std::nullopt;
+  }
+  const auto& first = vertices.Get(0)->position();
+  AxisAlignedBox bounds = {
+      .min = Vector3(first.x(), first.y(), first.z()),
+      .max = Vector3(first.x(), first.y(), first.z()),
+  };
+  for (const fb::Vertex* vertex : vertices) {
+    const auto& fb_position = vertex->position();
+    Vector3 position(fb_position.x(), fb_position.y(), fb_position.z());
+    bounds.min = bounds.min.Min(position);
+    bounds.max = bounds.max.Max(position);
+  }
+  return bounds;
+}
+
+// Binds the view-projection and the model transform of every instance for
+// the instanced unskinned vertex shader.
+static void BindUnskinnedInstances(HostBuffer& buffer,
+                                   const Matrix& view_transform,
+                                   const std::vector<Matrix>& transforms,
+                                   Command& command) {
+  UnskinnedInstancedVertexShader::FrameInfo info;
+  info.view_projection = view_transform;
+  UnskinnedInstancedVertexShader::BindFrameInfo(command,
+                                                buffer.EmplaceUniform(info));
+  UnskinnedInstancedVertexShader::BindInstanceData(
+      command, buffer.Emplace(transforms.data(),
+                              transforms.size() * sizeof(Matrix),
+                              DefaultUniformAlignment()));
+}
+
 //------------------------------------------------------------------------------
 /// Geometry
 ///
@@ -64,6 +125,9 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
   const uint8_t* vertices_start;
   size_t vertices_bytes;
   bool is_skinned;
+  // Skinned vertices move with their joints, so their bind pose positions
+  // don't bound them.
+  std::optional<AxisAlignedBox> bounds;
 
   switch (mesh.vertices_type()) {
     case fb::VertexBuffer::UnskinnedVertexBuffer: {
@@ -72,6 +136,7 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
       vertices_start = reinterpret_cast<const uint8_t*>(vertices->Get(0));
       vertices_bytes = vertices->size() * sizeof(fb::Vertex);
       is_skinned = false;
+      bounds = ComputeBounds(*vertices);
       break;
     }
     case fb::VertexBuffer::SkinnedVertexBuffer: {
@@ -116,16 +181,37 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
       .vertex_count = mesh.indices()->count(),
       .index_type = index_type,
   };
-  return MakeVertexBuffer(std::move(vertex_buffer), is_skinned);
+  auto geometry = MakeVertexBuffer(std::move(vertex_buffer), is_skinned);
+  geometry->SetLocalBounds(bounds);
+  return geometry;
+}
+
+void Geometry::BindInstancesToCommand(const SceneContext& scene_context,
+                                      HostBuffer& buffer,
+                                      const Matrix& view_transform,
+                                      const std::vector<Matrix>& transforms,
+                                      Command& command) const {
+  VALIDATION_LOG << "This geometry cannot be instanced.";
 }
 
 void Geometry::SetJointsTexture(const std::shared_ptr<Texture>& texture) {}
 
+const std::optional<AxisAlignedBox>& Geometry::GetLocalBounds() const {
+  return local_bounds_;
+}
+
+void Geometry::SetLocalBounds(std::optional<AxisAlignedBox> bounds) {
+  local_bounds_ = bounds;
+}
+
 //------------------------------------------------------------------------------
 /// CuboidGeometry
 ///
 
-CuboidGeometry::CuboidGeometry() = default;
+CuboidGeometry::CuboidGeometry() {
+  SetLocalBounds(AxisAlignedBox{.min = Vector3(0, 0, 0),
+                                .max = Vector3(1, 1, 0)});
+}
 
 CuboidGeometry::~CuboidGeometry() = default;
 
@@ -173,6 +259,18 @@ void CuboidGeometry::BindToCommand(const SceneContext& scene_context,
   UnskinnedVertexShader::BindFrameInfo(command, buffer.EmplaceUniform(info));
 }
 
+// |Geometry|
+void CuboidGeometry::BindInstancesToCommand(
+    const SceneContext& scene_context,
+    HostBuffer& buffer,
+    const Matrix& view_transform,
+    const std::vector<Matrix>& transforms,
+    Command& command) const {
+  command.BindVertices(
+      GetVertexBuffer(*scene_context.GetContext()->GetResourceAllocator()));
+  BindUnskinnedInstances(buffer, view_transform, transforms, command);
+}
+
 //------------------------------------------------------------------------------
 /// UnskinnedVertexBufferGeometry
 ///
@@ -211,6 +309,18 @@ void UnskinnedVertexBufferGeometry::BindToCommand(
   UnskinnedVertexShader::BindFrameInfo(command, buffer.EmplaceUniform(info));
 }
 
+// |Geometry|
+void UnskinnedVertexBufferGeometry::BindInstancesToCommand(
+    const SceneContext& scene_context,
+    HostBuffer& buffer,
+    const Matrix& view_transform,
+    const std::vector<Matrix>& transforms,
+    Command& command) const {
+  command.BindVertices(
+      GetVertexBuffer(*scene_context.GetContext()->GetResourceAllocator()));
+  BindUnskinnedInstances(buffer, view_transform, transforms, command);
+}
+
 //------------------------------------------------------------------------------
 /// SkinnedVertexBufferGeometry
 ///
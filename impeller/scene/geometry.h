@@ -5,6 +5,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/core/allocator.h"
@@ -24,6 +26,19 @@ namespace scene {
 class CuboidGeometry;
 class UnskinnedVertexBufferGeometry;
 
+/// An axis-aligned box in the local space of a geometry.
+struct AxisAlignedBox {
+  Vector3 min;
+  Vector3 max;
+
+  /// Whether the box lies entirely outside of the clip volume once
+  /// transformed by |mvp|, in which case nothing it contains is visible.
+  ///
+  /// This is conservative: some boxes outside of the view frustum are not
+  /// reported as such when they straddle the extension of a clip plane.
+  bool IsOutsideClipVolume(const Matrix& mvp) const;
+};
+
 class Geometry {
  public:
   virtual ~Geometry();
@@ -46,7 +61,25 @@ class Geometry {
                              const Matrix& transform,
                              Command& command) const = 0;
 
+  /// Binds the vertices of the geometry and one transform per instance for
+  /// a draw with the `kUnskinnedInstanced` pipeline. Only unskinned geometry
+  /// can be instanced.
+  virtual void BindInstancesToCommand(const SceneContext& scene_context,
+                                      HostBuffer& buffer,
+                                      const Matrix& view_transform,
+                                      const std::vector<Matrix>& transforms,
+                                      Command& command) const;
+
   virtual void SetJointsTexture(const std::shared_ptr<Texture>& texture);
+
+  /// The bounds of the vertices of the geometry, used to skip drawing
+  /// geometry outside of the view. Geometry without bounds is always drawn.
+  const std::optional<AxisAlignedBox>& GetLocalBounds() const;
+
+  void SetLocalBounds(std::optional<AxisAlignedBox> bounds);
+
+ private:
+  std::optional<AxisAlignedBox> local_bounds_;
 };
 
 class CuboidGeometry final : public Geometry {
@@ -69,6 +102,13 @@ class CuboidGeometry final : public Geometry {
                      const Matrix& transform,
                      Command& command) const override;
 
+  // |Geometry|
+  void BindInstancesToCommand(const SceneContext& scene_context,
+                              HostBuffer& buffer,
+                              const Matrix& view_transform,
+                              const std::vector<Matrix>& transforms,
+                              Command& command) const override;
+
  private:
   Vector3 size_;
 
@@ -97,6 +137,13 @@ class UnskinnedVertexBufferGeometry final : public Geometry {
                      const Matrix& transform,
                      Command& command) const override;
 
+  // |Geometry|
+  void BindInstancesToCommand(const SceneContext& scene_context,
+                              HostBuffer& buffer,
+                              const Matrix& view_transform,
+                              const std::vector<Matrix>& transforms,
+                              Command& command) const override;
+
  private:
   VertexBuffer vertex_buffer_;
 
@@ -12,7 +12,9 @@ namespace scene {
 enum class GeometryType {
   kUnskinned = 0,
   kSkinned = 1,
-  kLastType = kSkinned,
+  /// Unskinned geometry drawn once per transform of an instanced draw.
+  kUnskinnedInstanced = 2,
+  kLastType = kUnskinnedInstanced,
 };
 enum class MaterialType {
   kUnlit = 0,
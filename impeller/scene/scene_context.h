@@ -52,6 +52,10 @@ class SceneContext {
 
   std::shared_ptr<Texture> GetPlaceholderTexture() const;
 
+  /// Whether unskinned geometry can be drawn with instanced draws. This
+  /// requires storage buffers for the per-instance transforms.
+  bool SupportsInstancing() const;
+
  private:
   class PipelineVariants {
    public:
@@ -4,7 +4,12 @@
 
 #include "flutter/fml/macros.h"
 
+#include <map>
+#include <utility>
+
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/strings.h"
 #include "impeller/renderer/command.h"
 #include "impeller/renderer/render_target.h"
 #include "impeller/scene/scene_context.h"
@@ -44,6 +49,39 @@ static void EncodeCommand(const SceneContext& scene_context,
   render_pass.AddCommand(std::move(cmd));
 }
 
+// Commands that draw the same geometry with the same material, which are
+// encoded as a single instanced draw.
+struct SceneCommandBatch {
+  std::string label;
+  Geometry* geometry;
+  Material* material;
+  std::vector<Matrix> transforms;
+};
+
+static void EncodeInstancedCommand(const SceneContext& scene_context,
+                                   const Matrix& view_transform,
+                                   RenderPass& render_pass,
+                                   const SceneCommandBatch& batch) {
+  auto& host_buffer = render_pass.GetTransientsBuffer();
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, SPrintF("%s (%zu instances)", batch.label.c_str(),
+                                  batch.transforms.size()));
+  cmd.stencil_reference = 0;
+  cmd.instance_count = batch.transforms.size();
+
+  cmd.pipeline = scene_context.GetPipeline(
+      PipelineKey{GeometryType::kUnskinnedInstanced,
+                  batch.material->GetMaterialType()},
+      batch.material->GetContextOptions(render_pass));
+
+  batch.geometry->BindInstancesToCommand(scene_context, host_buffer,
+                                         view_transform, batch.transforms, cmd);
+  batch.material->BindToCommand(scene_context, host_buffer, cmd);
+
+  render_pass.AddCommand(std::move(cmd));
+}
+
 std::shared_ptr<CommandBuffer> SceneEncoder::BuildSceneCommandBuffer(
     const SceneContext& scene_context,
     const Matrix& camera_transform,
@@ -90,8 +128,54 @@ std::shared_ptr<CommandBuffer> SceneEncoder::BuildSceneCommandBuffer(
     return nullptr;
   }
 
+  // Skip the commands whose geometry is outside of the view, and gather the
+  // remaining draws of the same unskinned geometry and material into batches
+  // that are drawn with one instanced command. Batches are encoded in the
+  // order of their first command.
+  const bool supports_instancing = scene_context.SupportsInstancing();
+  std::vector<SceneCommandBatch> batches;
+  std::map<std::pair<Geometry*, Material*>, size_t> batch_indices;
+  std::vector<const SceneCommand*> single_commands;
+  size_t culled_count = 0;
   for (auto& command : commands_) {
-    EncodeCommand(scene_context, camera_transform, *render_pass, command);
+    const auto& bounds = command.geometry->GetLocalBounds();
+    if (bounds.has_value() &&
+        bounds->IsOutsideClipVolume(camera_transform * command.transform)) {
+      culled_count++;
+      continue;
+    }
+    if (!supports_instancing ||
+        command.geometry->GetGeometryType() != GeometryType::kUnskinned) {
+      single_commands.push_back(&command);
+      continue;
+    }
+    auto key = std::make_pair(command.geometry, command.material);
+    auto [found, inserted] = batch_indices.try_emplace(key, batches.size());
+    if (inserted) {
+      batches.push_back({.label = command.label,
+                         .geometry = command.geometry,
+                         .material = command.material});
+    }
+    batches[found->second].transforms.push_back(command.transform);
+  }
+  FML_TRACE_COUNTER("impeller", "SceneEncoder", 0,  //
+                    "Commands", commands_.size() - culled_count,
+                    "Culled", culled_count);
+
+  for (const auto& batch : batches) {
+    if (batch.transforms.size() == 1u) {
+      EncodeCommand(scene_context, camera_transform, *render_pass,
+                    SceneCommand{.label = batch.label,
+                                 .transform = batch.transforms.front(),
+                                 .geometry = batch.geometry,
+                                 .material = batch.material});
+    } else {
+      EncodeInstancedCommand(scene_context, camera_transform, *render_pass,
+                             batch);
+    }
+  }
+  for (const auto* command : single_commands) {
+    EncodeCommand(scene_context, camera_transform, *render_pass, *command);
   }
 
   if (!render_pass->EncodeCommands()) {
@@ -70,6 +70,66 @@ TEST_P(SceneTest, CuboidUnlit) {
   OpenPlaygroundHere(callback);
 }
 
+TEST(AxisAlignedBoxTest, IsOutsideClipVolume) {
+  auto view_projection =
+      Matrix::MakePerspective(Radians(kPiOver4), 1.0f, 0.1f, 100.0f);
+  AxisAlignedBox box = {.min = Vector3(-1, -1, -1), .max = Vector3(1, 1, 1)};
+
+  // In front of the camera.
+  EXPECT_FALSE(box.IsOutsideClipVolume(view_projection *
+                                       Matrix::MakeTranslation({0, 0, 10})));
+  // Straddling the left edge of the view.
+  EXPECT_FALSE(box.IsOutsideClipVolume(view_projection *
+                                       Matrix::MakeTranslation({-4, 0, 10})));
+  // Behind the camera.
+  EXPECT_TRUE(box.IsOutsideClipVolume(view_projection *
+                                      Matrix::MakeTranslation({0, 0, -10})));
+  // Beyond the far plane.
+  EXPECT_TRUE(box.IsOutsideClipVolume(view_projection *
+                                      Matrix::MakeTranslation({0, 0, 200})));
+  // Off to the side.
+  EXPECT_TRUE(box.IsOutsideClipVolume(view_projection *
+                                      Matrix::MakeTranslation({50, 0, 10})));
+}
+
+TEST_P(SceneTest, RepeatedCuboidsAreInstanced) {
+  auto scene_context = std::make_shared<SceneContext>(GetContext());
+
+  Renderer::RenderCallback callback = [&](RenderTarget& render_target) {
+    auto scene = Scene(scene_context);
+
+    // Every node shares the same geometry and material, so the nodes in view
+    // are drawn with a single instanced command when storage buffers are
+    // supported.
+    std::shared_ptr<Geometry> geometry = Geometry::MakeCuboid({1, 1, 0});
+    std::shared_ptr<Material> material = Material::MakeUnlit();
+    for (int x = -25; x < 25; x++) {
+      for (int y = -20; y < 20; y++) {
+        Mesh mesh;
+        mesh.AddPrimitive({geometry, material});
+        auto node = std::make_shared<Node>();
+        node->SetLocalTransform(Matrix::MakeTranslation(
+                                    {x * 1.5f, y * 1.5f, 0}) *
+                                Matrix::MakeScale({0.5f, 0.5f, 1}));
+        node->SetMesh(std::move(mesh));
+        scene.GetRoot().AddChild(node);
+      }
+    }
+
+    auto camera = Camera::MakePerspective(
+                      /* fov */ Radians(kPiOver4),
+                      /* position */ {0, 0, -40})
+                      .LookAt(
+                          /* target */ Vector3(),
+                          /* up */ {0, 1, 0});
+
+    scene.Render(render_target, camera);
+    return true;
+  };
+
+  OpenPlaygroundHere(callback);
+}
+
 TEST_P(SceneTest, FlutterLogo) {
   auto allocator = GetContext()->GetResourceAllocator();
 
@@ -62,30 +62,49 @@ Skin::Skin(Skin&&) = default;
 
 Skin& Skin::operator=(Skin&&) = default;
 
+Matrix Skin::GetJointModelTransform(const Node* joint) {
+  if (auto found = model_transforms_.find(joint);
+      found != model_transforms_.end()) {
+    return found->second;
+  }
+  Matrix transform = joint->GetLocalTransform();
+  const Node* parent = joint->GetParent();
+  if (parent && parent->IsJoint()) {
+    transform = GetJointModelTransform(parent) * transform;
+  }
+  model_transforms_[joint] = transform;
+  return transform;
+}
+
 std::shared_ptr<Texture> Skin::GetJointsTexture(Allocator& allocator) {
-  // Each joint has a matrix. 1 matrix = 16 floats. 1 pixel = 4 floats.
-  // Therefore, each joint needs 4 pixels.
-  auto required_pixels = joints_.size() * 4;
-  auto dimension_size = std::max(
-      2u,
-      Allocation::NextPowerOfTwoSize(std::ceil(std::sqrt(required_pixels))));
-
-  impeller::TextureDescriptor texture_descriptor;
-  texture_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
-  texture_descriptor.format = PixelFormat::kR32G32B32A32Float;
-  texture_descriptor.size = {dimension_size, dimension_size};
-  texture_descriptor.mip_count = 1u;
-
-  auto result = allocator.CreateTexture(texture_descriptor);
-  result->SetLabel("Joints Texture");
+  auto& result = joints_textures_[next_joints_texture_];
   if (!result) {
-    FML_LOG(ERROR) << "Could not create joint texture.";
-    return nullptr;
+    // Each joint has a matrix. 1 matrix = 16 floats. 1 pixel = 4 floats.
+    // Therefore, each joint needs 4 pixels.
+    auto required_pixels = joints_.size() * 4;
+    auto dimension_size = std::max(
+        2u,
+        Allocation::NextPowerOfTwoSize(std::ceil(std::sqrt(required_pixels))));
+
+    impeller::TextureDescriptor texture_descriptor;
+    texture_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+    texture_descriptor.format = PixelFormat::kR32G32B32A32Float;
+    texture_descriptor.size = {dimension_size, dimension_size};
+    texture_descriptor.mip_count = 1u;
+
+    result = allocator.CreateTexture(texture_descriptor);
+    if (!result) {
+      FML_LOG(ERROR) << "Could not create joint texture.";
+      return nullptr;
+    }
+    result->SetLabel("Joints Texture");
   }
+  next_joints_texture_ = (next_joints_texture_ + 1) % kJointsTextureCount;
 
-  std::vector<Matrix> joints;
-  joints.resize(result->GetSize().Area() / 4, Matrix());
+  auto& joints = joint_matrices_;
+  joints.assign(result->GetSize().Area() / 4, Matrix());
   FML_DCHECK(joints.size() >= joints_.size());
+  model_transforms_.clear();
   for (size_t joint_i = 0; joint_i < joints_.size(); joint_i++) {
     const Node* joint = joints_[joint_i].get();
     if (!joint) {
@@ -95,9 +114,8 @@ std::shared_ptr<Texture> Skin::GetJointsTexture(Allocator& allocator) {
 
     // Compute a model space matrix for the joint by walking up the bones to the
     // skeleton root.
-    while (joint && joint->IsJoint()) {
-      joints[joint_i] = joint->GetLocalTransform() * joints[joint_i];
-      joint = joint->GetParent();
+    if (joint->IsJoint()) {
+      joints[joint_i] = GetJointModelTransform(joint);
     }
 
     // Get the joint transform relative to the default pose of the bone by
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 
 #include "flutter/fml/macros.h"
 
@@ -32,9 +34,23 @@ class Skin final {
  private:
   Skin();
 
+  /// The model space transform of a joint, found by walking up the bones to
+  /// the skeleton root. Joints shared by several bones are only walked once
+  /// per call to |GetJointsTexture|.
+  Matrix GetJointModelTransform(const Node* joint);
+
   std::vector<std::shared_ptr<Node>> joints_;
   std::vector<Matrix> inverse_bind_matrices_;
 
+  // Frames that are still in flight may be sampling the joints of previous
+  // frames, so a few textures are cycled instead of reallocating one for
+  // every frame.
+  static constexpr size_t kJointsTextureCount = 3u;
+  std::array<std::shared_ptr<Texture>, kJointsTextureCount> joints_textures_;
+  size_t next_joints_texture_ = 0u;
+  std::vector<Matrix> joint_matrices_;
+  std::unordered_map<const Node*, Matrix> model_transforms_;
+
   Skin(const Skin&) = delete;
 
   Skin& operator=(const Skin&) = delete;
@@ -4,21 +4,30 @@
 
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
+#include <cstring>
 #include <numeric>
 #include <utility>
 
+#include "flutter/fml/cache_statistics.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/allocation.h"
 #include "impeller/core/allocator.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/context.h"
 #include "impeller/typographer/backends/skia/glyph_atlas_context_skia.h"
 #include "impeller/typographer/backends/skia/typeface_skia.h"
+#include "impeller/typographer/glyph_usage_log.h"
 #include "impeller/typographer/rectangle_packer.h"
+#include "impeller/typographer/signed_distance_field.h"
 #include "impeller/typographer/typographer_context.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkFont.h"
+#include "third_party/skia/include/core/SkString.h"
 #include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/core/SkTypeface.h"
 
 namespace impeller {
 
@@ -27,11 +36,15 @@ namespace impeller {
 //              https://github.com/flutter/flutter/issues/114563
 constexpr auto kPadding = 2;
 
-std::shared_ptr<TypographerContext> TypographerContextSkia::Make() {
-  return std::make_shared<TypographerContextSkia>();
+std::shared_ptr<TypographerContext> TypographerContextSkia::Make(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner) {
+  return std::make_shared<TypographerContextSkia>(
+      std::move(worker_task_runner));
 }
 
-TypographerContextSkia::TypographerContextSkia() = default;
+TypographerContextSkia::TypographerContextSkia(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
+    : TypographerContext(std::move(worker_task_runner)) {}
 
 TypographerContextSkia::~TypographerContextSkia() = default;
 
@@ -40,35 +53,65 @@ TypographerContextSkia::CreateGlyphAtlasContext() const {
   return std::make_shared<GlyphAtlasContextSkia>();
 }
 
+static void RecordGlyphUsage(GlyphUsageLog& usage_log,
+                             const std::vector<FontGlyphPair>& pairs) {
+  const SkTypeface* last_typeface = nullptr;
+  SkString family_name;
+  for (const FontGlyphPair& pair : pairs) {
+    const auto& typeface =
+        TypefaceSkia::Cast(*pair.scaled_font.font.GetTypeface())
+            .GetSkiaTypeface();
+    if (typeface.get() != last_typeface) {
+      typeface->getFamilyName(&family_name);
+      last_typeface = typeface.get();
+    }
+    usage_log.RecordGlyph(family_name.c_str(), pair.glyph.index);
+  }
+}
+
+// The number of pixels of distance field around each glyph.
+static int64_t ComputeGlyphSpread(GlyphAtlas::Type type) {
+  return type == GlyphAtlas::Type::kSignedDistanceField
+             ? GlyphAtlas::kSignedDistanceFieldSpread
+             : 0;
+}
+
+static ISize ComputeGlyphSize(const FontGlyphPair& pair,
+                              GlyphAtlas::Type type) {
+  const auto size =
+      ISize::Ceil(pair.glyph.bounds.size * pair.scaled_font.scale);
+  const auto spread = 2 * ComputeGlyphSpread(type);
+  return ISize(size.width + spread, size.height + spread);
+}
+
 static size_t PairsFitInAtlasOfSize(
     const std::vector<FontGlyphPair>& pairs,
+    GlyphAtlas::Type type,
     const ISize& atlas_size,
+    int64_t max_glyph_height,
     std::vector<Rect>& glyph_positions,
-    const std::shared_ptr<RectanglePacker>& rect_packer) {
+    GlyphAtlasContext& atlas_context) {
   if (atlas_size.IsEmpty()) {
     return false;
   }
 
+  atlas_context.ResetPages(atlas_size, max_glyph_height + kPadding);
+
   glyph_positions.clear();
   glyph_positions.reserve(pairs.size());
 
   size_t i = 0;
   for (auto it = pairs.begin(); it != pairs.end(); ++i, ++it) {
-    const auto& pair = *it;
-
-    const auto glyph_size =
-        ISize::Ceil(pair.glyph.bounds.size * pair.scaled_font.scale);
-    IPoint16 location_in_atlas;
-    if (!rect_packer->addRect(glyph_size.width + kPadding,   //
-                              glyph_size.height + kPadding,  //
-                              &location_in_atlas             //
-                              )) {
+    const auto glyph_size = ComputeGlyphSize(*it, type);
+    auto location_in_atlas = atlas_context.AllocateRect(
+        ISize(glyph_size.width + kPadding, glyph_size.height + kPadding));
+    if (!location_in_atlas.has_value()) {
       return pairs.size() - i;
     }
-    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas.x(),  //
-                                                location_in_atlas.y(),  //
-                                                glyph_size.width,       //
-                                                glyph_size.height       //
+    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas->x,  //
+                                                location_in_atlas->y,  //
+                                                glyph_size.width,      //
+                                                glyph_size.height      //
                                                 ));
   }
 
@@ -76,37 +119,41 @@ static size_t PairsFitInAtlasOfSize(
 }
 
 static bool CanAppendToExistingAtlas(
-    const std::shared_ptr<GlyphAtlas>& atlas,
     const std::vector<FontGlyphPair>& extra_pairs,
+    GlyphAtlas::Type type,
     std::vector<Rect>& glyph_positions,
-    ISize atlas_size,
-    const std::shared_ptr<RectanglePacker>& rect_packer) {
+    std::vector<IRect>& evicted_regions,
+    GlyphAtlasContext& atlas_context) {
   TRACE_EVENT0("impeller", __FUNCTION__);
-  if (!rect_packer || atlas_size.IsEmpty()) {
+  if (atlas_context.GetPageCount() == 0 ||
+      atlas_context.GetAtlasSize().IsEmpty()) {
     return false;
   }
 
   // We assume that all existing glyphs will fit. After all, they fit before.
   // The glyph_positions only contains the values for the additional glyphs
-  // from extra_pairs.
+  // from extra_pairs. When the atlas is full, pages whose glyphs have not been
+  // used recently are evicted to make room.
   FML_DCHECK(glyph_positions.size() == 0);
   glyph_positions.reserve(extra_pairs.size());
   for (size_t i = 0; i < extra_pairs.size(); i++) {
-    const FontGlyphPair& pair = extra_pairs[i];
-
-    const auto glyph_size =
-        ISize::Ceil(pair.glyph.bounds.size * pair.scaled_font.scale);
-    IPoint16 location_in_atlas;
-    if (!rect_packer->addRect(glyph_size.width + kPadding,   //
-                              glyph_size.height + kPadding,  //
-                              &location_in_atlas             //
-                              )) {
-      return false;
+    const auto glyph_size = ComputeGlyphSize(extra_pairs[i], type);
+    const auto padded_size =
+        ISize(glyph_size.width + kPadding, glyph_size.height + kPadding);
+
+    auto location_in_atlas = atlas_context.AllocateRect(padded_size);
+    while (!location_in_atlas.has_value()) {
+      auto evicted_region = atlas_context.EvictLeastRecentlyUsedPage();
+      if (!evicted_region.has_value()) {
+        return false;
+      }
+      evicted_regions.push_back(evicted_region.value());
+      location_in_atlas = atlas_context.AllocateRect(padded_size);
     }
-    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas.x(),  //
-                                                location_in_atlas.y(),  //
-                                                glyph_size.width,       //
-                                                glyph_size.height       //
+    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas->x,  //
+                                                location_in_atlas->y,  //
+                                                glyph_size.width,      //
+                                                glyph_size.height      //
                                                 ));
   }
 
@@ -124,18 +171,21 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
 
   TRACE_EVENT0("impeller", __FUNCTION__);
 
-  ISize current_size = type == GlyphAtlas::Type::kAlphaBitmap
+  int64_t max_glyph_height = 0;
+  for (const auto& pair : pairs) {
+    max_glyph_height = std::max<int64_t>(max_glyph_height,
+                                         ComputeGlyphSize(pair, type).height);
+  }
+
+  ISize current_size = type != GlyphAtlas::Type::kColorBitmap
                            ? ISize(kMinAlphaBitmapSize, kMinAlphaBitmapSize)
                            : ISize(kMinAtlasSize, kMinAtlasSize);
   size_t total_pairs = pairs.size() + 1;
   do {
-    auto rect_packer = std::shared_ptr<RectanglePacker>(
-        RectanglePacker::Factory(current_size.width, current_size.height));
-
-    auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
-                                                 glyph_positions, rect_packer);
+    auto remaining_pairs =
+        PairsFitInAtlasOfSize(pairs, type, current_size, max_glyph_height,
+                              glyph_positions, *atlas_context);
     if (remaining_pairs == 0) {
-      atlas_context->UpdateRectPacker(rect_packer);
       return current_size;
     } else if (remaining_pairs < std::ceil(total_pairs / 2)) {
       current_size = ISize::MakeWH(
@@ -185,11 +235,16 @@ static void DrawGlyph(SkCanvas* canvas,
   );
 }
 
+// Draws the pairs in `[start, end)`. Each invocation wraps the bitmap in its
+// own surface so that disjoint ranges can be drawn concurrently.
 static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
                               const std::shared_ptr<SkBitmap>& bitmap,
-                              const std::vector<FontGlyphPair>& new_pairs) {
+                              const std::vector<FontGlyphPair>& new_pairs,
+                              size_t start,
+                              size_t end) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   FML_DCHECK(bitmap != nullptr);
+  FML_DCHECK(end <= new_pairs.size());
 
   auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
   if (!surface) {
@@ -201,13 +256,30 @@ static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
   }
 
   bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+  const auto spread = ComputeGlyphSpread(atlas.GetType());
 
-  for (const FontGlyphPair& pair : new_pairs) {
+  for (size_t i = start; i < end; i++) {
+    const FontGlyphPair& pair = new_pairs[i];
     auto pos = atlas.FindFontGlyphBounds(pair);
     if (!pos.has_value()) {
       continue;
     }
-    DrawGlyph(canvas, pair.scaled_font, pair.glyph, pos.value(), has_color);
+    if (spread == 0) {
+      DrawGlyph(canvas, pair.scaled_font, pair.glyph, pos.value(), has_color);
+      continue;
+    }
+
+    // Signed distance fields are computed from the coverage of the glyph
+    // drawn inset by the spread on each side of its location.
+    DrawGlyph(canvas, pair.scaled_font, pair.glyph,
+              pos.value().Expand(-static_cast<Scalar>(spread)), has_color);
+    const auto region = IRect(pos.value());
+    ConvertCoverageToSignedDistanceField(
+        bitmap->getAddr8(region.origin.x, region.origin.y),  //
+        region.size,                                         //
+        bitmap->rowBytes(),                                  //
+        spread                                               //
+    );
   }
   return true;
 }
@@ -220,6 +292,7 @@ static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
 
   switch (atlas.GetType()) {
     case GlyphAtlas::Type::kAlphaBitmap:
+    case GlyphAtlas::Type::kSignedDistanceField:
       image_info = SkImageInfo::MakeA8(atlas_size.width, atlas_size.height);
       break;
     case GlyphAtlas::Type::kColorBitmap:
@@ -232,24 +305,6 @@ static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
     return nullptr;
   }
 
-  auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
-  if (!surface) {
-    return nullptr;
-  }
-  auto canvas = surface->getCanvas();
-  if (!canvas) {
-    return nullptr;
-  }
-
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
-
-  atlas.IterateGlyphs([canvas, has_color](const ScaledFont& scaled_font,
-                                          const Glyph& glyph,
-                                          const Rect& location) -> bool {
-    DrawGlyph(canvas, scaled_font, glyph, location, has_color);
-    return true;
-  });
-
   return bitmap;
 }
 
@@ -269,6 +324,87 @@ static bool UpdateGlyphTextureAtlas(std::shared_ptr<SkBitmap> bitmap,
   return texture->SetContents(mapping);
 }
 
+static std::optional<IRect> ComputeDirtyRegion(
+    const std::vector<Rect>& glyph_positions,
+    const std::vector<IRect>& evicted_regions,
+    const ISize& atlas_size) {
+  std::optional<Rect> bounds;
+  for (const auto& position : glyph_positions) {
+    bounds = Rect::Union(bounds, position);
+  }
+  // Evicted pages were cleared in the bitmap and must be uploaded in full so
+  // that stale glyphs do not bleed into the padding around new ones.
+  for (const auto& region : evicted_regions) {
+    bounds = Rect::Union(bounds, Rect(region));
+  }
+  if (!bounds.has_value()) {
+    return std::nullopt;
+  }
+  return IRect(Rect::RoundOut(bounds.value()))
+      .Intersection(IRect::MakeSize(atlas_size));
+}
+
+//------------------------------------------------------------------------------
+/// @brief      Upload only the region of the bitmap that the newly appended
+///             glyphs were drawn into. Re-uploading the entire atlas for a
+///             handful of new glyphs (common when typing CJK text) is
+///             prohibitively expensive for large atlases.
+///
+static bool UpdateGlyphTextureAtlasRegion(
+    Context& context,
+    const std::shared_ptr<SkBitmap>& bitmap,
+    const std::shared_ptr<Texture>& texture,
+    const IRect& region) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  // TODO(https://github.com/flutter/flutter/issues/123468): copying buffers to
+  // textures is not implemented for GLES.
+  if (!context.GetCapabilities()->SupportsBufferToTextureBlits()) {
+    return UpdateGlyphTextureAtlas(bitmap, texture);
+  }
+
+  FML_DCHECK(bitmap != nullptr);
+  const size_t bytes_per_pixel = bitmap->bytesPerPixel();
+  const size_t region_row_bytes = region.size.width * bytes_per_pixel;
+  const size_t region_bytes = region_row_bytes * region.size.height;
+
+  auto buffer = context.GetResourceAllocator()->CreateBuffer({
+      .storage_mode = StorageMode::kHostVisible,
+      .size = region_bytes,
+  });
+  if (!buffer) {
+    return false;
+  }
+  auto contents = buffer->OnGetContents();
+  if (!contents) {
+    return false;
+  }
+  for (auto row = 0; row < region.size.height; row++) {
+    ::memcpy(contents + row * region_row_bytes,
+             bitmap->getAddr(region.origin.x, region.origin.y + row),
+             region_row_bytes);
+  }
+  buffer->Flush(Range{0, region_bytes});
+
+  auto command_buffer = context.CreateCommandBuffer();
+  if (!command_buffer) {
+    return false;
+  }
+  command_buffer->SetLabel("GlyphAtlas Update Command Buffer");
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    return false;
+  }
+  blit_pass->SetLabel("GlyphAtlas Update Blit Pass");
+  if (!blit_pass->AddCopy(buffer->AsBufferView(), texture, region)) {
+    return false;
+  }
+  if (!blit_pass->EncodeCommands(context.GetResourceAllocator())) {
+    return false;
+  }
+  return command_buffer->SubmitCommands();
+}
+
 static std::shared_ptr<Texture> UploadGlyphTextureAtlas(
     const std::shared_ptr<Allocator>& allocator,
     std::shared_ptr<SkBitmap> bitmap,
@@ -326,18 +462,26 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
     return last_atlas;
   }
 
+  atlas_context->AdvanceGeneration();
+
   // ---------------------------------------------------------------------------
   // Step 1: Determine if the atlas type and font glyph pairs are compatible
-  //         with the current atlas and reuse if possible.
+  //         with the current atlas and reuse if possible. Pages holding glyphs
+  //         that are still in use are marked so that they are not evicted.
   // ---------------------------------------------------------------------------
   std::vector<FontGlyphPair> new_glyphs;
+  size_t reused_glyph_count = 0u;
   for (const auto& font_value : font_glyph_map) {
     const ScaledFont& scaled_font = font_value.first;
     const FontGlyphAtlas* font_glyph_atlas =
         last_atlas->GetFontGlyphAtlas(scaled_font.font, scaled_font.scale);
     if (font_glyph_atlas) {
       for (const Glyph& glyph : font_value.second) {
-        if (!font_glyph_atlas->FindGlyphBounds(glyph)) {
+        auto bounds = font_glyph_atlas->FindGlyphBounds(glyph);
+        if (bounds.has_value()) {
+          atlas_context->MarkGlyphUsed(bounds.value());
+          reused_glyph_count++;
+        } else {
           new_glyphs.emplace_back(scaled_font, glyph);
         }
       }
@@ -347,22 +491,31 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
       }
     }
   }
+  static fml::CacheStatistics::Counters& atlas_statistics =
+      fml::CacheStatistics::GetCounters("ImpellerGlyphAtlas");
+  atlas_statistics.RecordHit(reused_glyph_count);
+  atlas_statistics.RecordMiss(new_glyphs.size());
   if (last_atlas->GetType() == type && new_glyphs.size() == 0) {
     return last_atlas;
   }
+  if (const auto& usage_log = GetGlyphUsageLog()) {
+    RecordGlyphUsage(*usage_log, new_glyphs);
+  }
 
   // ---------------------------------------------------------------------------
   // Step 2: Determine if the additional missing glyphs can be appended to the
-  //         existing bitmap without recreating the atlas. This requires that
-  //         the type is identical.
+  //         existing bitmap without recreating the atlas, evicting the least
+  //         recently used pages if necessary. This requires that the type is
+  //         identical.
   // ---------------------------------------------------------------------------
   std::vector<Rect> glyph_positions;
+  std::vector<IRect> evicted_regions;
   if (last_atlas->GetType() == type &&
-      CanAppendToExistingAtlas(last_atlas, new_glyphs, glyph_positions,
-                               atlas_context->GetAtlasSize(),
-                               atlas_context->GetRectPacker())) {
+      CanAppendToExistingAtlas(new_glyphs, type, glyph_positions,
+                               evicted_regions, *atlas_context)) {
     // The old bitmap will be reused and only the additional glyphs will be
     // added.
+    atlas_statistics.RecordEviction(evicted_regions.size());
 
     // ---------------------------------------------------------------------------
     // Step 3a: Record the positions in the glyph atlas of the newly added
@@ -373,17 +526,33 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
     }
 
     // ---------------------------------------------------------------------------
-    // Step 4a: Draw new font-glyph pairs into the existing bitmap.
+    // Step 4a: Clear any evicted pages and draw new font-glyph pairs into the
+    //          existing bitmap.
     // ---------------------------------------------------------------------------
     auto bitmap = atlas_context_skia.GetBitmap();
-    if (!UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs)) {
+    for (const auto& region : evicted_regions) {
+      bitmap->eraseArea(SkIRect::MakeXYWH(region.origin.x, region.origin.y,
+                                          region.size.width,
+                                          region.size.height),
+                        SK_ColorTRANSPARENT);
+    }
+    if (!RasterizeGlyphs(new_glyphs.size(), [&](size_t start, size_t end) {
+          return UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs, start, end);
+        })) {
       return nullptr;
     }
 
     // ---------------------------------------------------------------------------
-    // Step 5a: Update the existing texture with the updated bitmap.
+    // Step 5a: Update the region of the existing texture that the new glyphs
+    //          were drawn into.
     // ---------------------------------------------------------------------------
-    if (!UpdateGlyphTextureAtlas(bitmap, last_atlas->GetTexture())) {
+    auto dirty_region =
+        ComputeDirtyRegion(glyph_positions, evicted_regions,
+                           atlas_context->GetAtlasSize());
+    if (dirty_region.has_value() &&
+        !UpdateGlyphTextureAtlasRegion(context, bitmap,
+                                       last_atlas->GetTexture(),
+                                       dirty_region.value())) {
       return nullptr;
     }
     return last_atlas;
@@ -444,6 +613,12 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   if (!bitmap) {
     return nullptr;
   }
+  if (!RasterizeGlyphs(font_glyph_pairs.size(), [&](size_t start, size_t end) {
+        return UpdateAtlasBitmap(*glyph_atlas, bitmap, font_glyph_pairs, start,
+                                 end);
+      })) {
+    return nullptr;
+  }
   atlas_context_skia.UpdateBitmap(bitmap);
 
   // ---------------------------------------------------------------------------
@@ -452,6 +627,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   PixelFormat format;
   switch (type) {
     case GlyphAtlas::Type::kAlphaBitmap:
+    case GlyphAtlas::Type::kSignedDistanceField:
       format = PixelFormat::kA8UNormInt;
       break;
     case GlyphAtlas::Type::kColorBitmap:
@@ -11,9 +11,18 @@ namespace impeller {
 
 class TypographerContextSkia : public TypographerContext {
  public:
-  static std::shared_ptr<TypographerContext> Make();
-
-  TypographerContextSkia();
+  //----------------------------------------------------------------------------
+  /// @brief      Create a Skia backed typographer context.
+  ///
+  /// @param[in]  worker_task_runner  An optional task runner used to
+  ///                                 rasterize large batches of new glyphs
+  ///                                 in parallel.
+  ///
+  static std::shared_ptr<TypographerContext> Make(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
+
+  explicit TypographerContextSkia(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
 
   ~TypographerContextSkia() override;
 
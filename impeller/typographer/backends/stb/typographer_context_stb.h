@@ -13,9 +13,18 @@ namespace impeller {
 
 class TypographerContextSTB : public TypographerContext {
  public:
-  static std::unique_ptr<TypographerContext> Make();
-
-  TypographerContextSTB();
+  //----------------------------------------------------------------------------
+  /// @brief      Create an STB backed typographer context.
+  ///
+  /// @param[in]  worker_task_runner  An optional task runner used to
+  ///                                 rasterize large batches of new glyphs
+  ///                                 in parallel.
+  ///
+  static std::unique_ptr<TypographerContext> Make(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
+
+  explicit TypographerContextSTB(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
 
   ~TypographerContextSTB() override;
 
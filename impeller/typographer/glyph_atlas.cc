@@ -4,11 +4,23 @@
 
 #include "impeller/typographer/glyph_atlas.h"
 
+#include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <utility>
 
 namespace impeller {
 
+// Small atlases are not worth splitting. Their pages would only fit a handful
+// of glyphs each.
+static constexpr int64_t kMinPageHeight = 256;
+static constexpr int64_t kMaxPageCount = 4;
+
+static uint64_t NextGlyphAtlasGeneration() {
+  static std::atomic<uint64_t> next_generation = 0u;
+  return next_generation++;
+}
+
 GlyphAtlasContext::GlyphAtlasContext()
     : atlas_(std::make_shared<GlyphAtlas>(GlyphAtlas::Type::kAlphaBitmap)),
       atlas_size_(ISize(0, 0)) {}
@@ -23,22 +35,98 @@ const ISize& GlyphAtlasContext::GetAtlasSize() const {
   return atlas_size_;
 }
 
-std::shared_ptr<RectanglePacker> GlyphAtlasContext::GetRectPacker() const {
-  return rect_packer_;
-}
-
 void GlyphAtlasContext::UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas,
                                          ISize size) {
   atlas_ = std::move(atlas);
   atlas_size_ = size;
 }
 
-void GlyphAtlasContext::UpdateRectPacker(
-    std::shared_ptr<RectanglePacker> rect_packer) {
-  rect_packer_ = std::move(rect_packer);
+void GlyphAtlasContext::ResetPages(ISize atlas_size, int64_t min_page_height) {
+  pages_.clear();
+  if (atlas_size.IsEmpty()) {
+    return;
+  }
+
+  const auto page_count = std::clamp<int64_t>(
+      atlas_size.height / std::max(kMinPageHeight, min_page_height), 1,
+      kMaxPageCount);
+  const auto page_height = atlas_size.height / page_count;
+  pages_.reserve(page_count);
+  for (int64_t i = 0; i < page_count; i++) {
+    const auto top = i * page_height;
+    const auto bottom =
+        i == page_count - 1 ? atlas_size.height : top + page_height;
+    const auto bounds = IRect::MakeLTRB(0, top, atlas_size.width, bottom);
+    pages_.push_back(Page{
+        .bounds = bounds,
+        .rect_packer = std::shared_ptr<RectanglePacker>(
+            RectanglePacker::Factory(bounds.size.width, bounds.size.height)),
+        .last_used_generation = generation_,
+    });
+  }
+}
+
+size_t GlyphAtlasContext::GetPageCount() const {
+  return pages_.size();
+}
+
+std::shared_ptr<RectanglePacker> GlyphAtlasContext::GetRectPacker(
+    size_t page_index) const {
+  if (page_index >= pages_.size()) {
+    return nullptr;
+  }
+  return pages_[page_index].rect_packer;
 }
 
-GlyphAtlas::GlyphAtlas(Type type) : type_(type) {}
+void GlyphAtlasContext::AdvanceGeneration() {
+  generation_++;
+}
+
+void GlyphAtlasContext::MarkGlyphUsed(const Rect& glyph_bounds) {
+  const auto origin = IPoint(glyph_bounds.origin.x, glyph_bounds.origin.y);
+  for (auto& page : pages_) {
+    if (page.bounds.Contains(origin)) {
+      page.last_used_generation = generation_;
+      return;
+    }
+  }
+}
+
+std::optional<IPoint> GlyphAtlasContext::AllocateRect(ISize size) {
+  for (auto& page : pages_) {
+    IPoint16 location;
+    if (page.rect_packer->addRect(size.width, size.height, &location)) {
+      page.last_used_generation = generation_;
+      return page.bounds.origin + IPoint(location.x(), location.y());
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<IRect> GlyphAtlasContext::EvictLeastRecentlyUsedPage() {
+  Page* least_recently_used = nullptr;
+  for (auto& page : pages_) {
+    if (page.last_used_generation == generation_) {
+      continue;
+    }
+    if (!least_recently_used || page.last_used_generation <
+                                    least_recently_used->last_used_generation) {
+      least_recently_used = &page;
+    }
+  }
+  if (!least_recently_used) {
+    return std::nullopt;
+  }
+
+  least_recently_used->rect_packer->reset();
+  // The page is about to be filled with glyphs for the current generation.
+  least_recently_used->last_used_generation = generation_;
+  atlas_->RemoveGlyphsInRegion(Rect(least_recently_used->bounds));
+  return least_recently_used->bounds;
+}
+
+GlyphAtlas::GlyphAtlas(Type type)
+    : type_(type), generation_(NextGlyphAtlasGeneration()) {}
 
 GlyphAtlas::~GlyphAtlas() = default;
 
@@ -81,6 +169,34 @@ const FontGlyphAtlas* GlyphAtlas::GetFontGlyphAtlas(const Font& font,
   return &found->second;
 }
 
+size_t GlyphAtlas::RemoveGlyphsInRegion(const Rect& region) {
+  size_t count = 0u;
+  for (auto it = font_atlas_map_.begin(); it != font_atlas_map_.end();) {
+    auto& positions = it->second.positions_;
+    for (auto glyph_it = positions.begin(); glyph_it != positions.end();) {
+      if (region.Contains(glyph_it->second.origin)) {
+        glyph_it = positions.erase(glyph_it);
+        count++;
+      } else {
+        ++glyph_it;
+      }
+    }
+    if (positions.empty()) {
+      it = font_atlas_map_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (count > 0u) {
+    generation_ = NextGlyphAtlasGeneration();
+  }
+  return count;
+}
+
+uint64_t GlyphAtlas::GetGeneration() const {
+  return generation_;
+}
+
 size_t GlyphAtlas::GetGlyphCount() const {
   return std::accumulate(font_atlas_map_.begin(), font_atlas_map_.end(), 0,
                          [](const int a, const auto& b) {
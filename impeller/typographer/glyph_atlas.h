@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/core/texture.h"
@@ -41,8 +42,21 @@ class GlyphAtlas {
     /// colors.
     ///
     kColorBitmap,
+
+    //--------------------------------------------------------------------------
+    /// The glyphs are represented at a fixed reference size as an 8-bit
+    /// signed distance field. A single entry per glyph can be rendered
+    /// crisply at any scale, which suits large and animated text.
+    ///
+    kSignedDistanceField,
   };
 
+  //----------------------------------------------------------------------------
+  /// The number of pixels around each glyph in a signed distance field atlas
+  /// over which the distance to the glyph outline is encoded.
+  ///
+  static constexpr int64_t kSignedDistanceFieldSpread = 8;
+
   //----------------------------------------------------------------------------
   /// @brief      Create an empty glyph atlas.
   ///
@@ -82,6 +96,28 @@ class GlyphAtlas {
   ///
   void AddTypefaceGlyphPosition(const FontGlyphPair& pair, Rect rect);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Remove all font-glyph pairs located within the given region of
+  ///             the atlas.
+  ///
+  /// @param[in]  region  The region of the atlas to clear.
+  ///
+  /// @return     The number of font-glyph pairs removed.
+  ///
+  size_t RemoveGlyphsInRegion(const Rect& region);
+
+  //----------------------------------------------------------------------------
+  /// @brief      An identifier for the current placement of glyphs in this
+  ///             atlas. It is unique across all atlases and changes whenever
+  ///             glyphs are removed, so data derived from glyph locations can
+  ///             be reused for as long as the generation stays the same.
+  ///             Adding glyphs does not move existing ones and keeps the
+  ///             generation.
+  ///
+  /// @return     The generation.
+  ///
+  uint64_t GetGeneration() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Get the number of unique font-glyph pairs in this atlas.
   ///
@@ -130,6 +166,7 @@ class GlyphAtlas {
  private:
   const Type type_;
   std::shared_ptr<Texture> texture_;
+  uint64_t generation_;
 
   std::unordered_map<ScaledFont, FontGlyphAtlas> font_atlas_map_;
 
@@ -153,23 +190,74 @@ class GlyphAtlasContext {
   /// @brief      Retrieve the size of the current glyph atlas.
   const ISize& GetAtlasSize() const;
 
-  //----------------------------------------------------------------------------
-  /// @brief      Retrieve the previous (if any) rect packer.
-  std::shared_ptr<RectanglePacker> GetRectPacker() const;
-
   //----------------------------------------------------------------------------
   /// @brief      Update the context with a newly constructed glyph atlas.
   void UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas, ISize size);
 
-  void UpdateRectPacker(std::shared_ptr<RectanglePacker> rect_packer);
+  //----------------------------------------------------------------------------
+  /// @brief      Split an atlas of the given size into horizontal pages, each
+  ///             with its own rect packer. Pages are individually evicted
+  ///             when the atlas runs out of space so that only the glyphs in
+  ///             the least recently used page need to be re-rasterized.
+  ///
+  /// @param[in]  atlas_size       The size of the atlas.
+  /// @param[in]  min_page_height  The minimum height of each page. This must
+  ///                              be large enough for the tallest glyph.
+  ///
+  void ResetPages(ISize atlas_size, int64_t min_page_height = 0);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of pages the atlas is split into.
+  size_t GetPageCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the rect packer (if any) for the given page.
+  std::shared_ptr<RectanglePacker> GetRectPacker(size_t page_index) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Start a new generation of page usage. Pages not marked as
+  ///             used since the last call become candidates for eviction.
+  ///             Called once per glyph atlas update.
+  void AdvanceGeneration();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Mark the page containing a glyph at the given location as
+  ///             used in the current generation.
+  void MarkGlyphUsed(const Rect& glyph_bounds);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Find space for a rect of the given size in any page.
+  ///
+  /// @return     The location of the rect in the atlas. `std::nullopt` if no
+  ///             page has enough space.
+  ///
+  std::optional<IPoint> AllocateRect(ISize size);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Evict the least recently used page not used in the current
+  ///             generation. Glyphs in the page are removed from the atlas
+  ///             and its rect packer is emptied.
+  ///
+  /// @return     The region of the atlas that was evicted. The caller is
+  ///             responsible for clearing it. `std::nullopt` if all pages
+  ///             are in use.
+  ///
+  std::optional<IRect> EvictLeastRecentlyUsedPage();
 
  protected:
   GlyphAtlasContext();
 
  private:
+  struct Page {
+    IRect bounds;
+    std::shared_ptr<RectanglePacker> rect_packer;
+    uint64_t last_used_generation = 0;
+  };
+
   std::shared_ptr<GlyphAtlas> atlas_;
   ISize atlas_size_;
-  std::shared_ptr<RectanglePacker> rect_packer_;
+  std::vector<Page> pages_;
+  uint64_t generation_ = 0;
 
   GlyphAtlasContext(const GlyphAtlasContext&) = delete;
 
@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/typographer/glyph_usage_log.h"
+
+#include <charconv>
+#include <limits>
+#include <sstream>
+
+namespace impeller {
+
+GlyphUsageLog::GlyphUsageLog() = default;
+
+GlyphUsageLog::~GlyphUsageLog() = default;
+
+std::shared_ptr<GlyphUsageLog> GlyphUsageLog::Parse(std::string_view log) {
+  auto result = std::make_shared<GlyphUsageLog>();
+  while (!log.empty()) {
+    auto line_end = log.find('\n');
+    auto line = log.substr(0, line_end);
+    log = line_end == std::string_view::npos ? std::string_view{}
+                                             : log.substr(line_end + 1);
+
+    auto separator = line.find('\t');
+    if (separator == std::string_view::npos || separator == 0) {
+      continue;
+    }
+    std::string family_name(line.substr(0, separator));
+    auto glyphs = line.substr(separator + 1);
+    while (!glyphs.empty()) {
+      auto glyph_end = glyphs.find(' ');
+      auto glyph = glyphs.substr(0, glyph_end);
+      glyphs = glyph_end == std::string_view::npos
+                   ? std::string_view{}
+                   : glyphs.substr(glyph_end + 1);
+
+      uint32_t index = 0;
+      auto [end, error] =
+          std::from_chars(glyph.data(), glyph.data() + glyph.size(), index);
+      if (error != std::errc() || end != glyph.data() + glyph.size() ||
+          index > std::numeric_limits<uint16_t>::max()) {
+        continue;
+      }
+      result->RecordGlyph(family_name, static_cast<uint16_t>(index));
+    }
+  }
+  return result;
+}
+
+void GlyphUsageLog::RecordGlyph(const std::string& family_name,
+                                uint16_t glyph_index) {
+  Lock lock(mutex_);
+  glyphs_[family_name].insert(glyph_index);
+}
+
+std::set<uint16_t> GlyphUsageLog::GetGlyphs(
+    const std::string& family_name) const {
+  Lock lock(mutex_);
+  auto found = glyphs_.find(family_name);
+  if (found == glyphs_.end()) {
+    return {};
+  }
+  return found->second;
+}
+
+bool GlyphUsageLog::IsEmpty() const {
+  Lock lock(mutex_);
+  return glyphs_.empty();
+}
+
+std::string GlyphUsageLog::Serialize() const {
+  Lock lock(mutex_);
+  std::stringstream stream;
+  for (const auto& [family_name, glyphs] : glyphs_) {
+    stream << family_name << '\t';
+    bool first = true;
+    for (auto glyph : glyphs) {
+      if (!first) {
+        stream << ' ';
+      }
+      stream << glyph;
+      first = false;
+    }
+    stream << '\n';
+  }
+  return stream.str();
+}
+
+}  // namespace impeller
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "impeller/base/thread.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Records the glyphs of each font family that were rendered.
+///
+///             A log serialized at the end of one session can be bundled with
+///             an application so that later sessions only keep the recorded
+///             glyphs of large fonts in memory. Each line of the serialized
+///             log contains a family name, a tab and the space separated
+///             indices of the glyphs that were used.
+///
+///             Glyphs may be recorded from multiple threads.
+///
+class GlyphUsageLog {
+ public:
+  GlyphUsageLog();
+
+  ~GlyphUsageLog();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Create a log from the output of `Serialize`. Lines that are
+  ///             not in the expected format are ignored.
+  ///
+  static std::shared_ptr<GlyphUsageLog> Parse(std::string_view log);
+
+  void RecordGlyph(const std::string& family_name, uint16_t glyph_index);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The glyphs recorded for a family.
+  ///
+  /// @return     The glyph indices. Empty if the family has not been used.
+  ///
+  std::set<uint16_t> GetGlyphs(const std::string& family_name) const;
+
+  bool IsEmpty() const;
+
+  std::string Serialize() const;
+
+ private:
+  mutable Mutex mutex_;
+  std::map<std::string, std::set<uint16_t>> glyphs_ IPLR_GUARDED_BY(mutex_);
+
+  GlyphUsageLog(const GlyphUsageLog&) = delete;
+
+  GlyphUsageLog& operator=(const GlyphUsageLog&) = delete;
+};
+
+}  // namespace impeller
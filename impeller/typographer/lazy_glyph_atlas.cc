@@ -19,23 +19,142 @@ LazyGlyphAtlas::LazyGlyphAtlas(
                          : nullptr),
       color_context_(typographer_context_
                          ? typographer_context_->CreateGlyphAtlasContext()
-                         : nullptr) {}
+                         : nullptr),
+      sdf_context_(typographer_context_
+                       ? typographer_context_->CreateGlyphAtlasContext()
+                       : nullptr) {}
 
 LazyGlyphAtlas::~LazyGlyphAtlas() = default;
 
 void LazyGlyphAtlas::AddTextFrame(const TextFrame& frame, Scalar scale) {
   FML_DCHECK(atlas_map_.empty());
-  if (frame.GetAtlasType() == GlyphAtlas::Type::kAlphaBitmap) {
-    frame.CollectUniqueFontGlyphPairs(alpha_glyph_map_, scale);
-  } else {
-    frame.CollectUniqueFontGlyphPairs(color_glyph_map_, scale);
+  switch (frame.GetAtlasType(scale)) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      frame.CollectUniqueFontGlyphPairs(alpha_glyph_map_, scale);
+      break;
+    case GlyphAtlas::Type::kColorBitmap:
+      frame.CollectUniqueFontGlyphPairs(color_glyph_map_, scale);
+      break;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      frame.CollectUniqueFontGlyphPairs(sdf_glyph_map_, scale);
+      break;
   }
 }
 
 void LazyGlyphAtlas::ResetTextFrames() {
   alpha_glyph_map_.clear();
   color_glyph_map_.clear();
+  sdf_glyph_map_.clear();
   atlas_map_.clear();
+
+  // Drop the vertices of text that wasn't drawn since the last reset.
+  for (auto it = vertex_cache_.begin(); it != vertex_cache_.end();) {
+    if (it->second.used) {
+      it->second.used = false;
+      ++it;
+    } else {
+      it = vertex_cache_.erase(it);
+    }
+  }
+}
+
+std::optional<BufferView> LazyGlyphAtlas::FindCachedVertices(
+    const TextVertexCacheKey& key) {
+  auto found = vertex_cache_.find(key);
+  if (found == vertex_cache_.end()) {
+    return std::nullopt;
+  }
+  found->second.used = true;
+  return found->second.vertices;
+}
+
+bool LazyGlyphAtlas::ShouldCacheVertices(const TextVertexCacheKey& key) {
+  // Remember the key, but only store vertices once it is seen again.
+  auto [entry, inserted] = vertex_cache_.try_emplace(key);
+  entry->second.used = true;
+  return !inserted;
+}
+
+void LazyGlyphAtlas::CacheVertices(const TextVertexCacheKey& key,
+                                   BufferView vertices) {
+  vertex_cache_[key] = {.vertices = std::move(vertices)};
+}
+
+size_t LazyGlyphAtlas::GetCachedVerticesCount() const {
+  return vertex_cache_.size();
+}
+
+static size_t GetAtlasByteSize(
+    const std::shared_ptr<GlyphAtlasContext>& context) {
+  if (!context || !context->GetGlyphAtlas() ||
+      !context->GetGlyphAtlas()->GetTexture()) {
+    return 0u;
+  }
+  return context->GetGlyphAtlas()
+      ->GetTexture()
+      ->GetTextureDescriptor()
+      .GetByteSizeOfBaseMipLevel();
+}
+
+size_t LazyGlyphAtlas::GetTrimmableByteSize() const {
+  size_t bytes = 0;
+  for (const auto& [key, cached] : vertex_cache_) {
+    if (cached.vertices.has_value()) {
+      bytes += cached.vertices->range.length;
+    }
+  }
+  return bytes + GetAtlasByteSize(alpha_context_) +
+         GetAtlasByteSize(color_context_) + GetAtlasByteSize(sdf_context_);
+}
+
+size_t LazyGlyphAtlas::Trim(size_t bytes) {
+  size_t trimmed_bytes = 0;
+  for (auto it = vertex_cache_.begin();
+       it != vertex_cache_.end() && trimmed_bytes < bytes;) {
+    if (it->second.vertices.has_value()) {
+      trimmed_bytes += it->second.vertices->range.length;
+    }
+    it = vertex_cache_.erase(it);
+  }
+
+  for (auto* context : {&alpha_context_, &color_context_, &sdf_context_}) {
+    if (trimmed_bytes >= bytes) {
+      break;
+    }
+    size_t atlas_bytes = GetAtlasByteSize(*context);
+    if (atlas_bytes == 0u) {
+      continue;
+    }
+    atlas_map_.clear();
+    *context = typographer_context_->CreateGlyphAtlasContext();
+    trimmed_bytes += atlas_bytes;
+  }
+  return trimmed_bytes;
+}
+
+const FontGlyphMap& LazyGlyphAtlas::GetGlyphMap(GlyphAtlas::Type type) const {
+  switch (type) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      return alpha_glyph_map_;
+    case GlyphAtlas::Type::kColorBitmap:
+      return color_glyph_map_;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      return sdf_glyph_map_;
+  }
+  FML_UNREACHABLE();
+}
+
+const std::shared_ptr<GlyphAtlasContext>& LazyGlyphAtlas::GetAtlasContext(
+    GlyphAtlas::Type type) const {
+  switch (type) {
+    case GlyphAtlas::Type::kAlphaBitmap:
+      return alpha_context_;
+    case GlyphAtlas::Type::kColorBitmap:
+      return color_context_;
+    case GlyphAtlas::Type::kSignedDistanceField:
+      return sdf_context_;
+  }
+  FML_UNREACHABLE();
 }
 
 std::shared_ptr<GlyphAtlas> LazyGlyphAtlas::CreateOrGetGlyphAtlas(
@@ -59,12 +178,8 @@ std::shared_ptr<GlyphAtlas> LazyGlyphAtlas::CreateOrGetGlyphAtlas(
     return nullptr;
   }
 
-  auto& glyph_map = type == GlyphAtlas::Type::kAlphaBitmap ? alpha_glyph_map_
-                                                           : color_glyph_map_;
-  auto atlas_context =
-      type == GlyphAtlas::Type::kAlphaBitmap ? alpha_context_ : color_context_;
-  auto atlas = typographer_context_->CreateGlyphAtlas(context, type,
-                                                      atlas_context, glyph_map);
+  auto atlas = typographer_context_->CreateGlyphAtlas(
+      context, type, GetAtlasContext(type), GetGlyphMap(type));
   if (!atlas || !atlas->IsValid()) {
     VALIDATION_LOG << "Could not create valid atlas.";
     return nullptr;
@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
+#include "impeller/core/buffer_view.h"
 #include "impeller/renderer/context.h"
 #include "impeller/typographer/glyph_atlas.h"
 #include "impeller/typographer/text_frame.h"
@@ -14,6 +19,59 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      Identifies the glyph vertices generated for a sequence of text
+///             frames, drawn at the given positions and scale from a glyph
+///             atlas of the given type and generation.
+///
+struct TextVertexCacheKey {
+  struct Frame {
+    std::shared_ptr<TextFrame> frame;
+    Point position;
+  };
+
+  std::vector<Frame> frames;
+  Scalar scale = 1.0;
+  GlyphAtlas::Type type = GlyphAtlas::Type::kAlphaBitmap;
+  uint64_t atlas_generation = 0u;
+};
+
+}  // namespace impeller
+
+template <>
+struct std::hash<impeller::TextVertexCacheKey> {
+  std::size_t operator()(const impeller::TextVertexCacheKey& key) const {
+    std::size_t hash = fml::HashCombine(key.scale, static_cast<int>(key.type),
+                                        key.atlas_generation);
+    for (const auto& frame : key.frames) {
+      fml::HashCombineSeed(hash, frame.frame.get(), frame.position.x,
+                           frame.position.y);
+    }
+    return hash;
+  }
+};
+
+template <>
+struct std::equal_to<impeller::TextVertexCacheKey> {
+  bool operator()(const impeller::TextVertexCacheKey& lhs,
+                  const impeller::TextVertexCacheKey& rhs) const {
+    if (lhs.scale != rhs.scale || lhs.type != rhs.type ||
+        lhs.atlas_generation != rhs.atlas_generation ||
+        lhs.frames.size() != rhs.frames.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < lhs.frames.size(); i++) {
+      if (lhs.frames[i].frame != rhs.frames[i].frame ||
+          lhs.frames[i].position != rhs.frames[i].position) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+namespace impeller {
+
 class LazyGlyphAtlas {
  public:
   explicit LazyGlyphAtlas(
@@ -29,16 +87,79 @@ class LazyGlyphAtlas {
       Context& context,
       GlyphAtlas::Type type) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Find glyph vertices that were previously stored with
+  ///             `CacheVertices` for an identical key.
+  ///
+  ///             Entries are retained across frames for as long as they are
+  ///             used at least once between calls to `ResetTextFrames`. An
+  ///             entry keeps its text frames alive, so the identity of a
+  ///             cached frame is never reused by another frame.
+  ///
+  /// @return     The cached vertices, or `std::nullopt` on a cache miss.
+  ///
+  std::optional<BufferView> FindCachedVertices(const TextVertexCacheKey& key);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the vertices for a key that missed the cache are
+  ///             worth storing. This is only the case for text that has been
+  ///             drawn before, so that text which changes every frame doesn't
+  ///             allocate a device buffer every frame.
+  ///
+  bool ShouldCacheVertices(const TextVertexCacheKey& key);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Store glyph vertices for reuse in later frames. The buffer
+  ///             view must refer to a device buffer rather than transient
+  ///             memory.
+  ///
+  void CacheVertices(const TextVertexCacheKey& key, BufferView vertices);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of text vertex cache entries, including text
+  ///             that was drawn once but whose vertices aren't stored yet.
+  ///
+  size_t GetCachedVerticesCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The bytes that `Trim` can free: those of the stored glyph
+  ///             vertices and of the glyph atlas textures.
+  ///
+  size_t GetTrimmableByteSize() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drop stored glyph vertices, and then whole glyph atlases,
+  ///             until at least `bytes` have been freed. Dropped atlases are
+  ///             rebuilt from scratch the next time text is drawn. This must
+  ///             not be called while a frame is being rendered.
+  ///
+  /// @return     The bytes that were freed.
+  ///
+  size_t Trim(size_t bytes);
+
  private:
   std::shared_ptr<TypographerContext> typographer_context_;
 
   FontGlyphMap alpha_glyph_map_;
   FontGlyphMap color_glyph_map_;
+  FontGlyphMap sdf_glyph_map_;
   std::shared_ptr<GlyphAtlasContext> alpha_context_;
   std::shared_ptr<GlyphAtlasContext> color_context_;
+  std::shared_ptr<GlyphAtlasContext> sdf_context_;
   mutable std::unordered_map<GlyphAtlas::Type, std::shared_ptr<GlyphAtlas>>
       atlas_map_;
 
+  struct CachedVertices {
+    std::optional<BufferView> vertices;
+    bool used = true;
+  };
+  std::unordered_map<TextVertexCacheKey, CachedVertices> vertex_cache_;
+
+  const FontGlyphMap& GetGlyphMap(GlyphAtlas::Type type) const;
+
+  const std::shared_ptr<GlyphAtlasContext>& GetAtlasContext(
+      GlyphAtlas::Type type) const;
+
   LazyGlyphAtlas(const LazyGlyphAtlas&) = delete;
 
   LazyGlyphAtlas& operator=(const LazyGlyphAtlas&) = delete;
@@ -0,0 +1,147 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/typographer/signed_distance_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace impeller {
+
+namespace {
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+// Scratch space for the one dimensional transform, sized for the longest row
+// or column of the mask.
+struct DistanceTransformScratch {
+  explicit DistanceTransformScratch(size_t length)
+      : input(length),
+        output(length),
+        vertices(length),
+        boundaries(length + 1) {}
+
+  std::vector<float> input;
+  std::vector<float> output;
+  std::vector<int64_t> vertices;
+  std::vector<float> boundaries;
+};
+
+// The one dimensional squared Euclidean distance transform from Felzenszwalb
+// and Huttenlocher, "Distance Transforms of Sampled Functions". Computes the
+// lower envelope of the parabolas rooted at each sample in linear time.
+void DistanceTransform1D(DistanceTransformScratch& scratch, int64_t length) {
+  const auto& f = scratch.input;
+  auto& v = scratch.vertices;
+  auto& z = scratch.boundaries;
+
+  int64_t k = 0;
+  v[0] = 0;
+  z[0] = -kInfinity;
+  z[1] = kInfinity;
+  for (int64_t q = 1; q < length; q++) {
+    if (f[q] == kInfinity) {
+      continue;
+    }
+    while (true) {
+      int64_t p = v[k];
+      if (f[p] == kInfinity) {
+        // Nothing to intersect with, replace the vertex outright.
+        v[k] = q;
+        z[k + 1] = kInfinity;
+        break;
+      }
+      float s = ((f[q] + q * q) - (f[p] + p * p)) / (2.0f * (q - p));
+      if (s <= z[k]) {
+        // The new parabola hides the previous vertex entirely.
+        k--;
+        continue;
+      }
+      k++;
+      v[k] = q;
+      z[k] = s;
+      z[k + 1] = kInfinity;
+      break;
+    }
+  }
+
+  k = 0;
+  for (int64_t q = 0; q < length; q++) {
+    while (z[k + 1] < q) {
+      k++;
+    }
+    int64_t p = v[k];
+    scratch.output[q] =
+        f[p] == kInfinity ? kInfinity : (q - p) * (q - p) + f[p];
+  }
+}
+
+// Replaces each value of the grid with the squared distance to the nearest
+// zero valued sample.
+void DistanceTransform2D(std::vector<float>& grid,
+                         int64_t width,
+                         int64_t height,
+                         DistanceTransformScratch& scratch) {
+  for (int64_t x = 0; x < width; x++) {
+    for (int64_t y = 0; y < height; y++) {
+      scratch.input[y] = grid[y * width + x];
+    }
+    DistanceTransform1D(scratch, height);
+    for (int64_t y = 0; y < height; y++) {
+      grid[y * width + x] = scratch.output[y];
+    }
+  }
+  for (int64_t y = 0; y < height; y++) {
+    std::copy_n(grid.begin() + y * width, width, scratch.input.begin());
+    DistanceTransform1D(scratch, width);
+    std::copy_n(scratch.output.begin(), width, grid.begin() + y * width);
+  }
+}
+
+}  // namespace
+
+void ConvertCoverageToSignedDistanceField(uint8_t* pixels,
+                                          ISize size,
+                                          size_t row_bytes,
+                                          Scalar spread) {
+  if (pixels == nullptr || size.IsEmpty() || spread <= 0) {
+    return;
+  }
+  const int64_t width = size.width;
+  const int64_t height = size.height;
+
+  // Distances from pixels outside of the shape to the shape and from pixels
+  // inside of the shape to the background.
+  std::vector<float> outside(width * height);
+  std::vector<float> inside(width * height);
+  for (int64_t y = 0; y < height; y++) {
+    const uint8_t* row = pixels + y * row_bytes;
+    for (int64_t x = 0; x < width; x++) {
+      bool is_inside = row[x] >= 128;
+      outside[y * width + x] = is_inside ? 0.0f : kInfinity;
+      inside[y * width + x] = is_inside ? kInfinity : 0.0f;
+    }
+  }
+
+  DistanceTransformScratch scratch(std::max(width, height));
+  DistanceTransform2D(outside, width, height, scratch);
+  DistanceTransform2D(inside, width, height, scratch);
+
+  for (int64_t y = 0; y < height; y++) {
+    uint8_t* row = pixels + y * row_bytes;
+    for (int64_t x = 0; x < width; x++) {
+      // Samples sit at pixel centers, so the edge lies halfway between an
+      // inside pixel and its outside neighbor.
+      float distance = std::sqrt(outside[y * width + x]) -
+                       std::sqrt(inside[y * width + x]);
+      distance += distance > 0 ? -0.5f : 0.5f;
+      float value = std::clamp(0.5f - distance / (2.0f * spread), 0.0f, 1.0f);
+      row[x] = static_cast<uint8_t>(std::round(value * 255.0f));
+    }
+  }
+}
+
+}  // namespace impeller
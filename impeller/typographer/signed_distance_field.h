@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "impeller/geometry/scalar.h"
+#include "impeller/geometry/size.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Converts an 8-bit coverage mask into an 8-bit signed distance
+///             field in place.
+///
+///             Pixels with at least half coverage are considered inside the
+///             shape. Each output pixel encodes the distance to the nearest
+///             edge remapped so that 128 lies on the edge, 255 is `spread`
+///             pixels inside the shape and 0 is `spread` pixels outside of
+///             it. The mask should leave at least `spread` pixels of empty
+///             space around the shape so that the field is not clipped.
+///
+/// @param[in]  pixels     The first pixel of the mask.
+/// @param[in]  size       The size of the mask in pixels.
+/// @param[in]  row_bytes  The number of bytes between the starts of rows.
+/// @param[in]  spread     The distance in pixels covered by the field.
+///
+void ConvertCoverageToSignedDistanceField(uint8_t* pixels,
+                                          ISize size,
+                                          size_t row_bytes,
+                                          Scalar spread);
+
+}  // namespace impeller
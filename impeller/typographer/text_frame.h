@@ -28,6 +28,31 @@ class TextFrame {
 
   static Scalar RoundScaledFontSize(Scalar scale, Scalar point_size);
 
+  //----------------------------------------------------------------------------
+  /// @brief      The scale at which glyphs of the given point size are
+  ///             rasterized into an atlas of the given type.
+  ///
+  ///             Bitmap atlases rasterize glyphs at the (rounded) scale they
+  ///             are drawn at. Signed distance field atlases rasterize every
+  ///             glyph at the same reference pixel size regardless of the
+  ///             scale it is drawn at.
+  ///
+  static Scalar ComputeAtlasScale(GlyphAtlas::Type type,
+                                  Scalar scale,
+                                  Scalar point_size);
+
+  //----------------------------------------------------------------------------
+  /// The pixel size glyphs are rasterized at in signed distance field atlases.
+  ///
+  static constexpr Scalar kSignedDistanceFieldGlyphSize = 64.0f;
+
+  //----------------------------------------------------------------------------
+  /// The smallest on-screen font size, in pixels, that is rendered from a
+  /// signed distance field atlas. Smaller text keeps using bitmap atlases
+  /// which preserve hinting and fine detail.
+  ///
+  static constexpr Scalar kSignedDistanceFieldMinFontSize = 72.0f;
+
   //----------------------------------------------------------------------------
   /// @brief      The conservative bounding box for this text frame.
   ///
@@ -64,6 +89,16 @@ class TextFrame {
   /// @brief      The type of atlas this run should be emplaced in.
   GlyphAtlas::Type GetAtlasType() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The type of atlas this run should be emplaced in when drawn
+  ///             at the given scale.
+  ///
+  ///             Frames without color glyphs whose runs are all at least
+  ///             `kSignedDistanceFieldMinFontSize` pixels tall on screen are
+  ///             emplaced in a signed distance field atlas.
+  ///
+  GlyphAtlas::Type GetAtlasType(Scalar scale) const;
+
   TextFrame& operator=(TextFrame&& other) = default;
 
   TextFrame(const TextFrame& other) = default;
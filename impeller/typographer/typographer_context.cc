@@ -4,11 +4,23 @@
 
 #include "impeller/typographer/typographer_context.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/trace_event.h"
+
 namespace impeller {
 
-TypographerContext::TypographerContext() {
+// Below this many glyphs per task the cost of waking up a worker outweighs
+// the rasterization work handed to it.
+static constexpr size_t kMinGlyphsPerRasterizationTask = 32u;
+static constexpr size_t kMaxRasterizationTasks = 4u;
+
+TypographerContext::TypographerContext(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
+    : worker_task_runner_(std::move(worker_task_runner)) {
   is_valid_ = true;
 }
 
@@ -18,4 +30,48 @@ bool TypographerContext::IsValid() const {
   return is_valid_;
 }
 
+void TypographerContext::SetGlyphUsageLog(
+    std::shared_ptr<GlyphUsageLog> usage_log) {
+  usage_log_ = std::move(usage_log);
+}
+
+const std::shared_ptr<GlyphUsageLog>& TypographerContext::GetGlyphUsageLog()
+    const {
+  return usage_log_;
+}
+
+bool TypographerContext::RasterizeGlyphs(
+    size_t glyph_count,
+    const RasterizeGlyphsProc& rasterize) const {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  const size_t task_count =
+      worker_task_runner_
+          ? std::clamp(glyph_count / kMinGlyphsPerRasterizationTask,
+                       static_cast<size_t>(1u), kMaxRasterizationTasks)
+          : 1u;
+  if (task_count <= 1u) {
+    return glyph_count == 0u || rasterize(0u, glyph_count);
+  }
+
+  const size_t glyphs_per_task = (glyph_count + task_count - 1) / task_count;
+  std::atomic_bool success = true;
+  fml::CountDownLatch latch(task_count - 1);
+  for (size_t i = 1; i < task_count; i++) {
+    const size_t start = i * glyphs_per_task;
+    const size_t end = std::min(start + glyphs_per_task, glyph_count);
+    worker_task_runner_->PostTask([&rasterize, &success, &latch, start, end]() {
+      TRACE_EVENT0("impeller", "RasterizeGlyphsOnWorker");
+      if (start < end && !rasterize(start, end)) {
+        success = false;
+      }
+      latch.CountDown();
+    });
+  }
+  if (!rasterize(0u, glyphs_per_task)) {
+    success = false;
+  }
+  latch.Wait();
+  return success;
+}
+
 }  // namespace impeller
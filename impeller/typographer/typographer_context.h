@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/context.h"
 #include "impeller/typographer/glyph_atlas.h"
+#include "impeller/typographer/glyph_usage_log.h"
 
 namespace impeller {
 
@@ -37,15 +40,45 @@ class TypographerContext {
       std::shared_ptr<GlyphAtlasContext> atlas_context,
       const FontGlyphMap& font_glyph_map) const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Record every glyph that is added to an atlas created by this
+  ///             context into the given log. Pass nullptr to stop recording.
+  ///
+  void SetGlyphUsageLog(std::shared_ptr<GlyphUsageLog> usage_log);
+
+  const std::shared_ptr<GlyphUsageLog>& GetGlyphUsageLog() const;
+
  protected:
   //----------------------------------------------------------------------------
   /// @brief      Create a new context to render text that talks to an
   ///             underlying graphics context.
   ///
-  TypographerContext();
+  /// @param[in]  worker_task_runner  An optional task runner used to
+  ///                                 rasterize glyphs in parallel.
+  ///
+  explicit TypographerContext(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
+
+  using RasterizeGlyphsProc = std::function<bool(size_t start, size_t end)>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Rasterize `glyph_count` glyphs by invoking `rasterize` on
+  ///             disjoint `[start, end)` ranges. Large batches are split
+  ///             across the worker task runner with the calling thread taking
+  ///             the first range. Returns once every range has completed.
+  ///
+  ///             The callback may be invoked concurrently and must only write
+  ///             to pixels covered by the glyphs in its range.
+  ///
+  /// @return     If every invocation of `rasterize` succeeded.
+  ///
+  bool RasterizeGlyphs(size_t glyph_count,
+                       const RasterizeGlyphsProc& rasterize) const;
 
  private:
   bool is_valid_ = false;
+  std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner_;
+  std::shared_ptr<GlyphUsageLog> usage_log_;
 
   TypographerContext(const TypographerContext&) = delete;
 
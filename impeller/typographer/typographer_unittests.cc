@@ -2,12 +2,18 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/testing/testing.h"
 #include "impeller/playground/playground_test.h"
+#include "impeller/typographer/backends/skia/glyph_atlas_context_skia.h"
 #include "impeller/typographer/backends/skia/text_frame_skia.h"
+#include "impeller/typographer/backends/skia/typeface_skia.h"
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
+#include "impeller/typographer/glyph_usage_log.h"
 #include "impeller/typographer/lazy_glyph_atlas.h"
 #include "impeller/typographer/rectangle_packer.h"
+#include "impeller/typographer/signed_distance_field.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -126,6 +132,209 @@ TEST_P(TypographerTest, LazyAtlasTracksColor) {
   ASSERT_FALSE(color_atlas == bitmap_atlas);
 }
 
+TEST_P(TypographerTest, LazyAtlasRetainsVerticesOfRepeatedText) {
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("hello", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  LazyGlyphAtlas lazy_atlas(TypographerContextSkia::Make());
+  TextVertexCacheKey key = {
+      .frames = {{.frame = frame, .position = {10, 20}}},
+      .scale = 1.0f,
+      .type = GlyphAtlas::Type::kAlphaBitmap,
+      .atlas_generation = 1u,
+  };
+
+  // Text drawn for the first time is only remembered.
+  ASSERT_FALSE(lazy_atlas.FindCachedVertices(key).has_value());
+  ASSERT_FALSE(lazy_atlas.ShouldCacheVertices(key));
+  lazy_atlas.ResetTextFrames();
+
+  // Drawing it again stores its vertices.
+  ASSERT_FALSE(lazy_atlas.FindCachedVertices(key).has_value());
+  ASSERT_TRUE(lazy_atlas.ShouldCacheVertices(key));
+  auto buffer = GetContext()->GetResourceAllocator()->CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>("vertices"), 8u);
+  ASSERT_TRUE(buffer);
+  lazy_atlas.CacheVertices(key, buffer->AsBufferView());
+  lazy_atlas.ResetTextFrames();
+
+  auto cached = lazy_atlas.FindCachedVertices(key);
+  ASSERT_TRUE(cached.has_value());
+  EXPECT_EQ(cached->buffer, buffer);
+
+  // A different position, scale or atlas generation is a different key.
+  auto moved_key = key;
+  moved_key.frames[0].position = {10, 30};
+  EXPECT_FALSE(lazy_atlas.FindCachedVertices(moved_key).has_value());
+  auto evicted_key = key;
+  evicted_key.atlas_generation = 2u;
+  EXPECT_FALSE(lazy_atlas.FindCachedVertices(evicted_key).has_value());
+
+  // Entries not used since the last reset are dropped.
+  lazy_atlas.ResetTextFrames();
+  lazy_atlas.ResetTextFrames();
+  EXPECT_EQ(lazy_atlas.GetCachedVerticesCount(), 0u);
+}
+
+TEST_P(TypographerTest, LazyAtlasTrimsStoredVertices) {
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("hello", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  LazyGlyphAtlas lazy_atlas(TypographerContextSkia::Make());
+  TextVertexCacheKey key = {
+      .frames = {{.frame = frame, .position = {10, 20}}},
+      .scale = 1.0f,
+      .type = GlyphAtlas::Type::kAlphaBitmap,
+      .atlas_generation = 1u,
+  };
+  ASSERT_FALSE(lazy_atlas.ShouldCacheVertices(key));
+  ASSERT_TRUE(lazy_atlas.ShouldCacheVertices(key));
+  auto buffer = GetContext()->GetResourceAllocator()->CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>("vertices"), 8u);
+  ASSERT_TRUE(buffer);
+  lazy_atlas.CacheVertices(key, buffer->AsBufferView());
+  EXPECT_GE(lazy_atlas.GetTrimmableByteSize(), 8u);
+
+  EXPECT_GE(lazy_atlas.Trim(1), 8u);
+  EXPECT_EQ(lazy_atlas.GetCachedVerticesCount(), 0u);
+  EXPECT_FALSE(lazy_atlas.FindCachedVertices(key).has_value());
+}
+
+TEST_P(TypographerTest, GlyphAtlasGenerationChangesWhenGlyphsAreRemoved) {
+  GlyphAtlas atlas(GlyphAtlas::Type::kAlphaBitmap);
+  GlyphAtlas other_atlas(GlyphAtlas::Type::kAlphaBitmap);
+  EXPECT_NE(atlas.GetGeneration(), other_atlas.GetGeneration());
+
+  SkFont sk_font;
+  auto frame =
+      MakeTextFrameFromTextBlobSkia(SkTextBlob::MakeFromString("ab", sk_font));
+  const auto& run = frame->GetRuns()[0];
+  const auto& positions = run.GetGlyphPositions();
+  ScaledFont scaled_font{run.GetFont(), 1.0f};
+  auto generation = atlas.GetGeneration();
+
+  atlas.AddTypefaceGlyphPosition({scaled_font, positions[0].glyph},
+                                 Rect::MakeXYWH(0, 0, 10, 10));
+  atlas.AddTypefaceGlyphPosition({scaled_font, positions[1].glyph},
+                                 Rect::MakeXYWH(20, 0, 10, 10));
+  EXPECT_EQ(atlas.GetGeneration(), generation);
+
+  EXPECT_EQ(atlas.RemoveGlyphsInRegion(Rect::MakeXYWH(100, 0, 10, 10)), 0u);
+  EXPECT_EQ(atlas.GetGeneration(), generation);
+
+  EXPECT_EQ(atlas.RemoveGlyphsInRegion(Rect::MakeXYWH(0, 0, 15, 15)), 1u);
+  EXPECT_NE(atlas.GetGeneration(), generation);
+}
+
+TEST_P(TypographerTest, GlyphUsageLogRoundTrips) {
+  GlyphUsageLog log;
+  ASSERT_TRUE(log.IsEmpty());
+  log.RecordGlyph("Material Icons", 42);
+  log.RecordGlyph("Material Icons", 7);
+  log.RecordGlyph("Material Icons", 42);
+  log.RecordGlyph("Roboto", 3);
+  ASSERT_EQ(log.Serialize(), "Material Icons\t7 42\nRoboto\t3\n");
+
+  // Malformed lines and glyph indices are skipped.
+  auto parsed = GlyphUsageLog::Parse(log.Serialize() +
+                                     "no glyphs\n\t1\nOther\t1 x 70000 2");
+  EXPECT_EQ(parsed->GetGlyphs("Material Icons"),
+            (std::set<uint16_t>{7u, 42u}));
+  EXPECT_EQ(parsed->GetGlyphs("Roboto"), (std::set<uint16_t>{3u}));
+  EXPECT_EQ(parsed->GetGlyphs("Other"), (std::set<uint16_t>{1u, 2u}));
+  EXPECT_TRUE(parsed->GetGlyphs("no glyphs").empty());
+}
+
+TEST_P(TypographerTest, GlyphAtlasRecordsGlyphUsage) {
+  auto context = TypographerContextSkia::Make();
+  auto usage_log = std::make_shared<GlyphUsageLog>();
+  context->SetGlyphUsageLog(usage_log);
+  auto atlas_context = context->CreateGlyphAtlasContext();
+
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("hello", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+  auto atlas = CreateGlyphAtlas(*GetContext(), context.get(),
+                                GlyphAtlas::Type::kAlphaBitmap, 1.0f,
+                                atlas_context, *frame);
+  ASSERT_NE(atlas, nullptr);
+
+  SkString family_name;
+  TypefaceSkia::Cast(*frame->GetRuns()[0].GetFont().GetTypeface())
+      .GetSkiaTypeface()
+      ->getFamilyName(&family_name);
+  // "hello" has four distinct characters.
+  EXPECT_EQ(usage_log->GetGlyphs(family_name.c_str()).size(), 4u);
+}
+
+TEST_P(TypographerTest, LargeTextUsesSignedDistanceFieldAtlas) {
+  auto context = TypographerContextSkia::Make();
+  auto atlas_context = context->CreateGlyphAtlasContext();
+  ASSERT_TRUE(context && context->IsValid());
+  SkFont sk_font;
+  sk_font.setSize(100);
+  auto blob = SkTextBlob::MakeFromString("hello", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  ASSERT_EQ(frame->GetAtlasType(0.5f), GlyphAtlas::Type::kAlphaBitmap);
+  ASSERT_EQ(frame->GetAtlasType(1.0f), GlyphAtlas::Type::kSignedDistanceField);
+
+  // Glyphs are rasterized once regardless of the scale they are drawn at.
+  FontGlyphMap font_glyph_map;
+  frame->CollectUniqueFontGlyphPairs(font_glyph_map, 1.0f);
+  frame->CollectUniqueFontGlyphPairs(font_glyph_map, 3.5f);
+  ASSERT_EQ(font_glyph_map.size(), 1u);
+
+  auto atlas = context->CreateGlyphAtlas(*GetContext(),
+                                         GlyphAtlas::Type::kSignedDistanceField,
+                                         atlas_context, font_glyph_map);
+  ASSERT_NE(atlas, nullptr);
+  ASSERT_NE(atlas->GetTexture(), nullptr);
+  ASSERT_EQ(atlas->GetType(), GlyphAtlas::Type::kSignedDistanceField);
+  ASSERT_EQ(atlas->GetTexture()->GetTextureDescriptor().format,
+            PixelFormat::kA8UNormInt);
+  ASSERT_EQ(atlas->GetGlyphCount(), 4llu);
+
+  atlas->IterateGlyphs([&](const ScaledFont& scaled_font, const Glyph& glyph,
+                           const Rect& rect) -> bool {
+    EXPECT_GE(rect.size.width, 2 * GlyphAtlas::kSignedDistanceFieldSpread);
+    EXPECT_GE(rect.size.height, 2 * GlyphAtlas::kSignedDistanceFieldSpread);
+    return true;
+  });
+}
+
+TEST_P(TypographerTest, CanConvertCoverageToSignedDistanceField) {
+  constexpr int64_t kSize = 32;
+  constexpr Scalar kSpread = 4;
+  // A filled square inset by 8 pixels.
+  std::vector<uint8_t> pixels(kSize * kSize, 0);
+  for (int64_t y = 8; y < 24; y++) {
+    for (int64_t x = 8; x < 24; x++) {
+      pixels[y * kSize + x] = 255;
+    }
+  }
+
+  ConvertCoverageToSignedDistanceField(pixels.data(), ISize(kSize, kSize),
+                                       kSize, kSpread);
+
+  const uint8_t* row = pixels.data() + 16 * kSize;
+  // Far outside and deep inside the square saturate.
+  EXPECT_EQ(row[0], 0u);
+  EXPECT_EQ(row[16], 255u);
+  // The edge lies halfway between the last outside and first inside pixel.
+  EXPECT_NEAR(row[7] + row[8], 255, 2);
+  // The distance increases monotonically towards the center.
+  for (int64_t x = 1; x <= 16; x++) {
+    EXPECT_GE(row[x], row[x - 1]);
+  }
+}
+
 TEST_P(TypographerTest, GlyphAtlasWithOddUniqueGlyphSize) {
   auto context = TypographerContextSkia::Make();
   auto atlas_context = context->CreateGlyphAtlasContext();
@@ -220,7 +429,7 @@ TEST_P(TypographerTest, GlyphAtlasTextureIsRecycledIfUnchanged) {
   auto atlas = CreateGlyphAtlas(
       *GetContext(), context.get(), GlyphAtlas::Type::kAlphaBitmap, 1.0f,
       atlas_context, *MakeTextFrameFromTextBlobSkia(blob));
-  auto old_packer = atlas_context->GetRectPacker();
+  auto old_packer = atlas_context->GetRectPacker(0);
 
   ASSERT_NE(atlas, nullptr);
   ASSERT_NE(atlas->GetTexture(), nullptr);
@@ -237,7 +446,7 @@ TEST_P(TypographerTest, GlyphAtlasTextureIsRecycledIfUnchanged) {
   ASSERT_EQ(atlas, next_atlas);
   auto* second_texture = next_atlas->GetTexture().get();
 
-  auto new_packer = atlas_context->GetRectPacker();
+  auto new_packer = atlas_context->GetRectPacker(0);
 
   ASSERT_EQ(second_texture, first_texture);
   ASSERT_EQ(old_packer, new_packer);
@@ -253,7 +462,7 @@ TEST_P(TypographerTest, GlyphAtlasTextureIsRecreatedIfTypeChanges) {
   auto atlas = CreateGlyphAtlas(
       *GetContext(), context.get(), GlyphAtlas::Type::kAlphaBitmap, 1.0f,
       atlas_context, *MakeTextFrameFromTextBlobSkia(blob));
-  auto old_packer = atlas_context->GetRectPacker();
+  auto old_packer = atlas_context->GetRectPacker(0);
 
   ASSERT_NE(atlas, nullptr);
   ASSERT_NE(atlas->GetTexture(), nullptr);
@@ -271,7 +480,7 @@ TEST_P(TypographerTest, GlyphAtlasTextureIsRecreatedIfTypeChanges) {
   ASSERT_NE(atlas, next_atlas);
   auto* second_texture = next_atlas->GetTexture().get();
 
-  auto new_packer = atlas_context->GetRectPacker();
+  auto new_packer = atlas_context->GetRectPacker(0);
 
   ASSERT_NE(second_texture, first_texture);
   ASSERT_NE(old_packer, new_packer);
@@ -293,6 +502,96 @@ TEST_P(TypographerTest, MaybeHasOverlapping) {
   ASSERT_FALSE(frame_2->MaybeHasOverlapping());
 }
 
+TEST_P(TypographerTest, GlyphsRasterizedOnWorkersMatchSerialRasterization) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  auto serial_context = TypographerContextSkia::Make();
+  auto parallel_context = TypographerContextSkia::Make(loop->GetTaskRunner());
+  auto serial_atlas_context = serial_context->CreateGlyphAtlasContext();
+  auto parallel_atlas_context = parallel_context->CreateGlyphAtlasContext();
+
+  SkFont sk_font;
+  // Enough unique glyphs to be split across several workers.
+  auto blob = SkTextBlob::MakeFromString(
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+      "!@#$%^&*()-_=+[]{};:'\",.<>/?",
+      sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  auto serial_atlas = CreateGlyphAtlas(
+      *GetContext(), serial_context.get(), GlyphAtlas::Type::kAlphaBitmap,
+      1.0f, serial_atlas_context, *frame);
+  auto parallel_atlas = CreateGlyphAtlas(
+      *GetContext(), parallel_context.get(), GlyphAtlas::Type::kAlphaBitmap,
+      1.0f, parallel_atlas_context, *frame);
+  ASSERT_NE(serial_atlas, nullptr);
+  ASSERT_NE(parallel_atlas, nullptr);
+  ASSERT_EQ(serial_atlas->GetGlyphCount(), parallel_atlas->GetGlyphCount());
+
+  auto serial_bitmap =
+      GlyphAtlasContextSkia::Cast(*serial_atlas_context).GetBitmap();
+  auto parallel_bitmap =
+      GlyphAtlasContextSkia::Cast(*parallel_atlas_context).GetBitmap();
+  ASSERT_EQ(serial_bitmap->computeByteSize(),
+            parallel_bitmap->computeByteSize());
+  EXPECT_EQ(::memcmp(serial_bitmap->getPixels(), parallel_bitmap->getPixels(),
+                     serial_bitmap->computeByteSize()),
+            0);
+}
+
+TEST_P(TypographerTest, GlyphAtlasContextEvictsLeastRecentlyUsedPage) {
+  auto context = TypographerContextSkia::Make();
+  auto atlas_context = context->CreateGlyphAtlasContext();
+  ASSERT_TRUE(context && context->IsValid());
+
+  atlas_context->ResetPages(ISize(1024, 1024));
+  ASSERT_EQ(atlas_context->GetPageCount(), 4u);
+
+  // Fill up one page per generation.
+  for (auto i = 0; i < 4; i++) {
+    atlas_context->AdvanceGeneration();
+    auto location = atlas_context->AllocateRect(ISize(1024, 256));
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->y, i * 256);
+  }
+  EXPECT_FALSE(atlas_context->AllocateRect(ISize(10, 10)).has_value());
+
+  // The first page is the least recently used, but is still in use.
+  atlas_context->AdvanceGeneration();
+  atlas_context->MarkGlyphUsed(Rect::MakeXYWH(10, 10, 10, 10));
+
+  auto evicted = atlas_context->EvictLeastRecentlyUsedPage();
+  ASSERT_TRUE(evicted.has_value());
+  EXPECT_EQ(evicted.value(), IRect::MakeXYWH(0, 256, 1024, 256));
+
+  auto location = atlas_context->AllocateRect(ISize(10, 10));
+  ASSERT_TRUE(location.has_value());
+  EXPECT_EQ(location->y, 256);
+
+  evicted = atlas_context->EvictLeastRecentlyUsedPage();
+  ASSERT_TRUE(evicted.has_value());
+  EXPECT_EQ(evicted.value(), IRect::MakeXYWH(0, 512, 1024, 256));
+  evicted = atlas_context->EvictLeastRecentlyUsedPage();
+  ASSERT_TRUE(evicted.has_value());
+  EXPECT_EQ(evicted.value(), IRect::MakeXYWH(0, 768, 1024, 256));
+
+  // Every page has now been used in the current generation.
+  EXPECT_FALSE(atlas_context->EvictLeastRecentlyUsedPage().has_value());
+}
+
+TEST_P(TypographerTest, SmallGlyphAtlasIsNotPaged) {
+  auto context = TypographerContextSkia::Make();
+  auto atlas_context = context->CreateGlyphAtlasContext();
+  ASSERT_TRUE(context && context->IsValid());
+
+  atlas_context->ResetPages(ISize(128, 128));
+  EXPECT_EQ(atlas_context->GetPageCount(), 1u);
+
+  // Pages must be tall enough for the tallest glyph.
+  atlas_context->ResetPages(ISize(1024, 1024), 400);
+  EXPECT_EQ(atlas_context->GetPageCount(), 2u);
+}
+
 TEST_P(TypographerTest, RectanglePackerAddsNonoverlapingRectangles) {
   auto packer = RectanglePacker::Factory(200, 100);
   ASSERT_NE(packer, nullptr);
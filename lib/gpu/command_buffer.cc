@@ -4,9 +4,12 @@
 
 #include "flutter/lib/gpu/command_buffer.h"
 
+#include <variant>
+
 #include "dart_api.h"
 #include "fml/make_copyable.h"
 #include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_pass.h"
 #include "impeller/renderer/render_pass.h"
 #include "lib/ui/ui_dart_state.h"
 #include "tonic/converter/dart_converter.h"
@@ -31,17 +34,31 @@ void CommandBuffer::AddRenderPass(
   encodables_.push_back(std::move(render_pass));
 }
 
-bool CommandBuffer::Submit() {
+void CommandBuffer::AddComputePass(
+    std::shared_ptr<impeller::ComputePass> compute_pass) {
+  encodables_.push_back(std::move(compute_pass));
+}
+
+bool CommandBuffer::EncodeCommands() {
+  bool success = true;
   for (auto& encodable : encodables_) {
-    encodable->EncodeCommands();
+    success &= std::visit(
+        [](auto& pass) { return pass->EncodeCommands(); }, encodable);
+  }
+  return success;
+}
+
+bool CommandBuffer::Submit() {
+  if (!EncodeCommands()) {
+    return false;
   }
   return command_buffer_->SubmitCommands();
 }
 
 bool CommandBuffer::Submit(
     const impeller::CommandBuffer::CompletionCallback& completion_callback) {
-  for (auto& encodable : encodables_) {
-    encodable->EncodeCommands();
+  if (!EncodeCommands()) {
+    return false;
   }
   return command_buffer_->SubmitCommands(completion_callback);
 }
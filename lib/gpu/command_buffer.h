@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include <memory>
+#include <variant>
+#include <vector>
+
 #include "flutter/lib/gpu/context.h"
 #include "flutter/lib/gpu/export.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/render_pass.h"
 
 namespace flutter {
 namespace gpu {
@@ -24,6 +30,8 @@ class CommandBuffer : public RefCountedDartWrappable<CommandBuffer> {
 
   void AddRenderPass(std::shared_ptr<impeller::RenderPass> render_pass);
 
+  void AddComputePass(std::shared_ptr<impeller::ComputePass> compute_pass);
+
   bool Submit();
   bool Submit(
       const impeller::CommandBuffer::CompletionCallback& completion_callback);
@@ -31,8 +39,15 @@ class CommandBuffer : public RefCountedDartWrappable<CommandBuffer> {
   ~CommandBuffer() override;
 
  private:
+  using Encodable = std::variant<std::shared_ptr<impeller::RenderPass>,
+                                 std::shared_ptr<impeller::ComputePass>>;
+
   std::shared_ptr<impeller::CommandBuffer> command_buffer_;
-  std::vector<std::shared_ptr<impeller::RenderPass>> encodables_;
+  // Passes are encoded in the order they were added, so that compute work
+  // that produces data for a later render pass runs before it.
+  std::vector<Encodable> encodables_;
+
+  bool EncodeCommands();
 
   FML_DISALLOW_COPY_AND_ASSIGN(CommandBuffer);
 };
@@ -0,0 +1,144 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/gpu/compute_pass.h"
+
+#include "flutter/lib/gpu/compute_pipeline.h"
+#include "fml/memory/ref_ptr.h"
+#include "impeller/core/buffer_view.h"
+#include "impeller/core/shader_types.h"
+#include "impeller/geometry/size.h"
+#include "tonic/converter/dart_converter.h"
+
+namespace flutter {
+namespace gpu {
+
+IMPLEMENT_WRAPPERTYPEINFO(flutter_gpu, ComputePass);
+
+ComputePass::ComputePass() = default;
+
+ComputePass::~ComputePass() = default;
+
+impeller::ComputeCommand& ComputePass::GetCommand() {
+  return command_;
+}
+
+impeller::ComputePass& ComputePass::GetComputePass() {
+  return *compute_pass_;
+}
+
+bool ComputePass::Begin(flutter::gpu::CommandBuffer& command_buffer) {
+  compute_pass_ = command_buffer.GetCommandBuffer()->CreateComputePass();
+  if (!compute_pass_) {
+    return false;
+  }
+  command_buffer.AddComputePass(compute_pass_);
+  return true;
+}
+
+void ComputePass::SetPipeline(fml::RefPtr<ComputePipeline> pipeline) {
+  compute_pipeline_ = std::move(pipeline);
+}
+
+bool ComputePass::Dispatch() {
+  if (!compute_pipeline_) {
+    return false;
+  }
+  impeller::ComputeCommand result = command_;
+  result.pipeline = compute_pipeline_->GetPipeline();
+  return compute_pass_->AddCommand(std::move(result));
+}
+
+}  // namespace gpu
+}  // namespace flutter
+
+//----------------------------------------------------------------------------
+/// Exports
+///
+
+void InternalFlutterGpu_ComputePass_Initialize(Dart_Handle wrapper) {
+  auto res = fml::MakeRefCounted<flutter::gpu::ComputePass>();
+  res->AssociateWithDartWrapper(wrapper);
+}
+
+Dart_Handle InternalFlutterGpu_ComputePass_Begin(
+    flutter::gpu::ComputePass* wrapper,
+    flutter::gpu::CommandBuffer* command_buffer) {
+  if (!wrapper->Begin(*command_buffer)) {
+    return tonic::ToDart("Failed to begin ComputePass");
+  }
+  return Dart_Null();
+}
+
+void InternalFlutterGpu_ComputePass_BindPipeline(
+    flutter::gpu::ComputePass* wrapper,
+    flutter::gpu::ComputePipeline* pipeline) {
+  auto ref = fml::RefPtr<flutter::gpu::ComputePipeline>(pipeline);
+  wrapper->SetPipeline(std::move(ref));
+}
+
+template <typename TBuffer>
+static bool BindBuffer(flutter::gpu::ComputePass* wrapper,
+                       int binding_index,
+                       TBuffer* buffer,
+                       int offset_in_bytes,
+                       int length_in_bytes) {
+  // Compute commands keep a pointer to the metadata, so it must outlive the
+  // command. Only GLES reads the metadata, and it doesn't support compute.
+  static const impeller::ShaderMetadata kMetadata;
+
+  impeller::ShaderUniformSlot slot;
+  slot.ext_res_0 = binding_index;
+  slot.binding = binding_index;
+  return wrapper->GetCommand().BindResource(
+      impeller::ShaderStage::kCompute, slot, kMetadata,
+      impeller::BufferView{
+          .buffer = buffer->GetBuffer(),
+          .range = impeller::Range(offset_in_bytes, length_in_bytes),
+      });
+}
+
+bool InternalFlutterGpu_ComputePass_BindBufferDevice(
+    flutter::gpu::ComputePass* wrapper,
+    int binding_index,
+    flutter::gpu::DeviceBuffer* device_buffer,
+    int offset_in_bytes,
+    int length_in_bytes) {
+  return BindBuffer(wrapper, binding_index, device_buffer, offset_in_bytes,
+                    length_in_bytes);
+}
+
+bool InternalFlutterGpu_ComputePass_BindBufferHost(
+    flutter::gpu::ComputePass* wrapper,
+    int binding_index,
+    flutter::gpu::HostBuffer* host_buffer,
+    int offset_in_bytes,
+    int length_in_bytes) {
+  return BindBuffer(wrapper, binding_index, host_buffer, offset_in_bytes,
+                    length_in_bytes);
+}
+
+void InternalFlutterGpu_ComputePass_ClearBindings(
+    flutter::gpu::ComputePass* wrapper) {
+  wrapper->GetCommand().bindings = {};
+}
+
+void InternalFlutterGpu_ComputePass_SetGridSize(
+    flutter::gpu::ComputePass* wrapper,
+    int width,
+    int height) {
+  wrapper->GetComputePass().SetGridSize(impeller::ISize(width, height));
+}
+
+void InternalFlutterGpu_ComputePass_SetThreadGroupSize(
+    flutter::gpu::ComputePass* wrapper,
+    int width,
+    int height) {
+  wrapper->GetComputePass().SetThreadGroupSize(impeller::ISize(width, height));
+}
+
+bool InternalFlutterGpu_ComputePass_Dispatch(
+    flutter::gpu::ComputePass* wrapper) {
+  return wrapper->Dispatch();
+}
@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/lib/gpu/command_buffer.h"
+#include "flutter/lib/gpu/compute_pipeline.h"
+#include "flutter/lib/gpu/export.h"
+#include "flutter/lib/ui/dart_wrapper.h"
+#include "fml/memory/ref_ptr.h"
+#include "impeller/renderer/compute_command.h"
+#include "impeller/renderer/compute_pass.h"
+#include "lib/gpu/device_buffer.h"
+#include "lib/gpu/host_buffer.h"
+
+namespace flutter {
+namespace gpu {
+
+class ComputePass : public RefCountedDartWrappable<ComputePass> {
+  DEFINE_WRAPPERTYPEINFO();
+  FML_FRIEND_MAKE_REF_COUNTED(ComputePass);
+
+ public:
+  ComputePass();
+
+  ~ComputePass() override;
+
+  impeller::ComputeCommand& GetCommand();
+
+  impeller::ComputePass& GetComputePass();
+
+  bool Begin(flutter::gpu::CommandBuffer& command_buffer);
+
+  void SetPipeline(fml::RefPtr<ComputePipeline> pipeline);
+
+  bool Dispatch();
+
+ private:
+  std::shared_ptr<impeller::ComputePass> compute_pass_;
+
+  // Command encoding state.
+  impeller::ComputeCommand command_;
+  fml::RefPtr<ComputePipeline> compute_pipeline_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ComputePass);
+};
+
+}  // namespace gpu
+}  // namespace flutter
+
+//----------------------------------------------------------------------------
+/// Exports
+///
+
+extern "C" {
+
+FLUTTER_GPU_EXPORT
+extern void InternalFlutterGpu_ComputePass_Initialize(Dart_Handle wrapper);
+
+FLUTTER_GPU_EXPORT
+extern Dart_Handle InternalFlutterGpu_ComputePass_Begin(
+    flutter::gpu::ComputePass* wrapper,
+    flutter::gpu::CommandBuffer* command_buffer);
+
+FLUTTER_GPU_EXPORT
+extern void InternalFlutterGpu_ComputePass_BindPipeline(
+    flutter::gpu::ComputePass* wrapper,
+    flutter::gpu::ComputePipeline* pipeline);
+
+FLUTTER_GPU_EXPORT
+extern bool InternalFlutterGpu_ComputePass_BindBufferDevice(
+    flutter::gpu::ComputePass* wrapper,
+    int binding_index,
+    flutter::gpu::DeviceBuffer* device_buffer,
+    int offset_in_bytes,
+    int length_in_bytes);
+
+FLUTTER_GPU_EXPORT
+extern bool InternalFlutterGpu_ComputePass_BindBufferHost(
+    flutter::gpu::ComputePass* wrapper,
+    int binding_index,
+    flutter::gpu::HostBuffer* host_buffer,
+    int offset_in_bytes,
+    int length_in_bytes);
+
+FLUTTER_GPU_EXPORT
+extern void InternalFlutterGpu_ComputePass_ClearBindings(
+    flutter::gpu::ComputePass* wrapper);
+
+FLUTTER_GPU_EXPORT
+extern void InternalFlutterGpu_ComputePass_SetGridSize(
+    flutter::gpu::ComputePass* wrapper,
+    int width,
+    int height);
+
+FLUTTER_GPU_EXPORT
+extern void InternalFlutterGpu_ComputePass_SetThreadGroupSize(
+    flutter::gpu::ComputePass* wrapper,
+    int width,
+    int height);
+
+FLUTTER_GPU_EXPORT
+extern bool InternalFlutterGpu_ComputePass_Dispatch(
+    flutter::gpu::ComputePass* wrapper);
+
+}  // extern "C"
@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/gpu/compute_pipeline.h"
+
+#include "flutter/lib/gpu/shader.h"
+#include "impeller/renderer/compute_pipeline_descriptor.h"
+#include "impeller/renderer/pipeline_library.h"
+#include "tonic/converter/dart_converter.h"
+
+namespace flutter {
+namespace gpu {
+
+IMPLEMENT_WRAPPERTYPEINFO(flutter_gpu, ComputePipeline);
+
+ComputePipeline::ComputePipeline(
+    fml::RefPtr<flutter::gpu::Shader> compute_shader,
+    std::shared_ptr<impeller::Pipeline<impeller::ComputePipelineDescriptor>>
+        pipeline)
+    : compute_shader_(std::move(compute_shader)),
+      pipeline_(std::move(pipeline)) {}
+
+ComputePipeline::~ComputePipeline() = default;
+
+const std::shared_ptr<
+    impeller::Pipeline<impeller::ComputePipelineDescriptor>>&
+ComputePipeline::GetPipeline() const {
+  return pipeline_;
+}
+
+}  // namespace gpu
+}  // namespace flutter
+
+//----------------------------------------------------------------------------
+/// Exports
+///
+
+Dart_Handle InternalFlutterGpu_ComputePipeline_Initialize(
+    Dart_Handle wrapper,
+    flutter::gpu::Context* gpu_context,
+    flutter::gpu::Shader* compute_shader) {
+  auto& context = *gpu_context->GetContext();
+  if (!context.GetCapabilities()->SupportsCompute()) {
+    return tonic::ToDart("The GPU context doesn't support compute");
+  }
+  if (compute_shader->GetShaderStage() != impeller::ShaderStage::kCompute) {
+    return tonic::ToDart("ComputePipelines require a compute shader");
+  }
+
+  // Lazily register the shader synchronously if it hasn't been already.
+  if (!compute_shader->RegisterSync(*gpu_context)) {
+    return tonic::ToDart("Failed to register the compute shader");
+  }
+
+  impeller::ComputePipelineDescriptor desc;
+  desc.SetStageEntrypoint(
+      compute_shader->GetFunctionFromLibrary(*context.GetShaderLibrary()));
+  auto pipeline = context.GetPipelineLibrary()->GetPipeline(desc).Get();
+  if (!pipeline || !pipeline->IsValid()) {
+    return tonic::ToDart("Failed to create the compute pipeline");
+  }
+
+  auto res = fml::MakeRefCounted<flutter::gpu::ComputePipeline>(
+      fml::RefPtr<flutter::gpu::Shader>(compute_shader), std::move(pipeline));
+  res->AssociateWithDartWrapper(wrapper);
+
+  return Dart_Null();
+}
@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/lib/gpu/context.h"
+#include "flutter/lib/gpu/export.h"
+#include "flutter/lib/gpu/shader.h"
+#include "flutter/lib/ui/dart_wrapper.h"
+#include "impeller/renderer/compute_pipeline_descriptor.h"
+#include "impeller/renderer/pipeline.h"
+
+namespace flutter {
+namespace gpu {
+
+class ComputePipeline : public RefCountedDartWrappable<ComputePipeline> {
+  DEFINE_WRAPPERTYPEINFO();
+  FML_FRIEND_MAKE_REF_COUNTED(ComputePipeline);
+
+ public:
+  ComputePipeline(
+      fml::RefPtr<flutter::gpu::Shader> compute_shader,
+      std::shared_ptr<impeller::Pipeline<impeller::ComputePipelineDescriptor>>
+          pipeline);
+
+  ~ComputePipeline() override;
+
+  /// Unlike render pipelines, compute pipelines don't depend on any pass
+  /// state, so the Impeller pipeline is resolved once when this is created
+  /// and reused for every dispatch.
+  const std::shared_ptr<
+      impeller::Pipeline<impeller::ComputePipelineDescriptor>>&
+  GetPipeline() const;
+
+ private:
+  fml::RefPtr<flutter::gpu::Shader> compute_shader_;
+  std::shared_ptr<impeller::Pipeline<impeller::ComputePipelineDescriptor>>
+      pipeline_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ComputePipeline);
+};
+
+}  // namespace gpu
+}  // namespace flutter
+
+//----------------------------------------------------------------------------
+/// Exports
+///
+
+extern "C" {
+
+FLUTTER_GPU_EXPORT
+extern Dart_Handle InternalFlutterGpu_ComputePipeline_Initialize(
+    Dart_Handle wrapper,
+    flutter::gpu::Context* gpu_context,
+    flutter::gpu::Shader* compute_shader);
+
+}  // extern "C"
@@ -95,3 +95,8 @@ extern int InternalFlutterGpu_Context_GetDefaultDepthStencilFormat(
           ->GetCapabilities()
           ->GetDefaultDepthStencilFormat()));
 }
+
+extern bool InternalFlutterGpu_Context_DoesSupportCompute(
+    flutter::gpu::Context* wrapper) {
+  return wrapper->GetContext()->GetCapabilities()->SupportsCompute();
+}
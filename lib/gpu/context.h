@@ -66,4 +66,8 @@ FLUTTER_GPU_EXPORT
 extern int InternalFlutterGpu_Context_GetDefaultDepthStencilFormat(
     flutter::gpu::Context* wrapper);
 
+FLUTTER_GPU_EXPORT
+extern bool InternalFlutterGpu_Context_DoesSupportCompute(
+    flutter::gpu::Context* wrapper);
+
 }  // extern "C"
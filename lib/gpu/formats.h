@@ -285,6 +285,7 @@ constexpr impeller::StoreAction ToImpellerStoreAction(int value) {
 enum class FlutterGPUShaderStage {
   kVertex,
   kFragment,
+  kCompute,
 };
 
 constexpr impeller::ShaderStage ToImpellerShaderStage(
@@ -294,6 +295,8 @@ constexpr impeller::ShaderStage ToImpellerShaderStage(
       return impeller::ShaderStage::kVertex;
     case FlutterGPUShaderStage::kFragment:
       return impeller::ShaderStage::kFragment;
+    case FlutterGPUShaderStage::kCompute:
+      return impeller::ShaderStage::kCompute;
   }
 }
 
@@ -308,8 +311,9 @@ constexpr FlutterGPUShaderStage FromImpellerShaderStage(
       return FlutterGPUShaderStage::kVertex;
     case impeller::ShaderStage::kFragment:
       return FlutterGPUShaderStage::kFragment;
-    case impeller::ShaderStage::kUnknown:
     case impeller::ShaderStage::kCompute:
+      return FlutterGPUShaderStage::kCompute;
+    case impeller::ShaderStage::kUnknown:
       FML_LOG(FATAL) << "Invalid Flutter GPU ShaderStage "
                      << static_cast<size_t>(value);
       FML_UNREACHABLE();
@@ -11,6 +11,7 @@
 ///  * [Flutter GPU Wiki page](https://github.com/flutter/flutter/wiki/Flutter-GPU).
 library flutter_gpu;
 
+import 'dart:async';
 import 'dart:ffi';
 import 'dart:nativewrappers';
 import 'dart:typed_data';
@@ -21,6 +22,8 @@ export 'src/smoketest.dart';
 
 part 'src/buffer.dart';
 part 'src/command_buffer.dart';
+part 'src/compute_pass.dart';
+part 'src/compute_pipeline.dart';
 part 'src/context.dart';
 part 'src/formats.dart';
 part 'src/texture.dart';
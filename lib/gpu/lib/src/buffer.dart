@@ -33,6 +33,9 @@ mixin Buffer {
 
   bool _bindAsUniform(RenderPass renderPass, UniformSlot slot,
       int offsetInBytes, int lengthInBytes);
+
+  bool _bindToComputePass(ComputePass computePass, int bindingIndex,
+      int offsetInBytes, int lengthInBytes);
 }
 
 /// [DeviceBuffer] is a region of memory allocated on the device heap
@@ -82,6 +85,13 @@ base class DeviceBuffer extends NativeFieldWrapperClass1 with Buffer {
         this, offsetInBytes, lengthInBytes);
   }
 
+  @override
+  bool _bindToComputePass(ComputePass computePass, int bindingIndex,
+      int offsetInBytes, int lengthInBytes) {
+    return computePass._bindBufferDevice(
+        bindingIndex, this, offsetInBytes, lengthInBytes);
+  }
+
   /// Wrap with native counterpart.
   @Native<Bool Function(Handle, Pointer<Void>, Int, Int)>(
       symbol: 'InternalFlutterGpu_DeviceBuffer_Initialize')
@@ -160,6 +170,13 @@ base class HostBuffer extends NativeFieldWrapperClass1 with Buffer {
         this, offsetInBytes, lengthInBytes);
   }
 
+  @override
+  bool _bindToComputePass(ComputePass computePass, int bindingIndex,
+      int offsetInBytes, int lengthInBytes) {
+    return computePass._bindBufferHost(
+        bindingIndex, this, offsetInBytes, lengthInBytes);
+  }
+
   /// Wrap with native counterpart.
   @Native<Void Function(Handle)>(
       symbol: 'InternalFlutterGpu_HostBuffer_Initialize')
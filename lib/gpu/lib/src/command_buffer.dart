@@ -18,6 +18,10 @@ base class CommandBuffer extends NativeFieldWrapperClass1 {
     return RenderPass._(this, renderTarget);
   }
 
+  ComputePass createComputePass() {
+    return ComputePass._(this);
+  }
+
   void submit({CompletionCallback? completionCallback}) {
     String? error = _submit(completionCallback);
     if (error != null) {
@@ -25,6 +29,25 @@ base class CommandBuffer extends NativeFieldWrapperClass1 {
     }
   }
 
+  /// Submits the encoded commands, returning a future that completes once
+  /// the GPU has finished executing them.
+  ///
+  /// Unlike waiting on the rendered result, this doesn't block the calling
+  /// thread, so the next frame's commands can be encoded while the GPU is
+  /// still busy with this one. The future completes with an error if the
+  /// commands fail to execute.
+  Future<void> submitAsync() {
+    final Completer<void> completer = Completer<void>();
+    submit(completionCallback: (bool success) {
+      if (success) {
+        completer.complete();
+      } else {
+        completer.completeError(Exception('CommandBuffer execution failed'));
+      }
+    });
+    return completer.future;
+  }
+
   /// Wrap with native counterpart.
   @Native<Bool Function(Handle, Pointer<Void>)>(
       symbol: 'InternalFlutterGpu_CommandBuffer_Initialize')
@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// ignore_for_file: public_member_api_docs
+
+part of flutter_gpu;
+
+/// Records compute shader dispatches into a [CommandBuffer].
+///
+/// Passes are encoded in the order they are created, so buffers written by a
+/// [ComputePass] can be read by a [RenderPass] created after it on the same
+/// [CommandBuffer].
+base class ComputePass extends NativeFieldWrapperClass1 {
+  /// Creates a new ComputePass.
+  ComputePass._(CommandBuffer commandBuffer) {
+    _initialize();
+    String? error = _begin(commandBuffer);
+    if (error != null) {
+      throw Exception(error);
+    }
+  }
+
+  void bindPipeline(ComputePipeline pipeline) {
+    _bindPipeline(pipeline);
+  }
+
+  /// Binds a uniform or storage buffer to the given [bindingIndex] of the
+  /// compute shader.
+  void bindBuffer(int bindingIndex, BufferView bufferView) {
+    bool success = bufferView.buffer._bindToComputePass(
+        this, bindingIndex, bufferView.offsetInBytes, bufferView.lengthInBytes);
+    if (!success) {
+      throw Exception("Failed to bind buffer");
+    }
+  }
+
+  void clearBindings() {
+    _clearBindings();
+  }
+
+  /// Sets the number of invocations of the compute shader in each dimension.
+  ///
+  /// The grid size applies to every dispatch recorded by this pass.
+  void setGridSize(int width, int height) {
+    _setGridSize(width, height);
+  }
+
+  /// Sets the number of invocations that are grouped together in each
+  /// dimension. This should match the local size declared by the shader.
+  ///
+  /// The thread group size applies to every dispatch recorded by this pass.
+  void setThreadGroupSize(int width, int height) {
+    _setThreadGroupSize(width, height);
+  }
+
+  void dispatch() {
+    if (!_dispatch()) {
+      throw Exception("Failed to append dispatch");
+    }
+  }
+
+  /// Wrap with native counterpart.
+  @Native<Void Function(Handle)>(
+      symbol: 'InternalFlutterGpu_ComputePass_Initialize')
+  external void _initialize();
+
+  @Native<Handle Function(Pointer<Void>, Pointer<Void>)>(
+      symbol: 'InternalFlutterGpu_ComputePass_Begin')
+  external String? _begin(CommandBuffer commandBuffer);
+
+  @Native<Void Function(Pointer<Void>, Pointer<Void>)>(
+      symbol: 'InternalFlutterGpu_ComputePass_BindPipeline')
+  external void _bindPipeline(ComputePipeline pipeline);
+
+  @Native<Bool Function(Pointer<Void>, Int, Pointer<Void>, Int, Int)>(
+      symbol: 'InternalFlutterGpu_ComputePass_BindBufferDevice')
+  external bool _bindBufferDevice(int bindingIndex, DeviceBuffer buffer,
+      int offsetInBytes, int lengthInBytes);
+
+  @Native<Bool Function(Pointer<Void>, Int, Pointer<Void>, Int, Int)>(
+      symbol: 'InternalFlutterGpu_ComputePass_BindBufferHost')
+  external bool _bindBufferHost(int bindingIndex, HostBuffer buffer,
+      int offsetInBytes, int lengthInBytes);
+
+  @Native<Void Function(Pointer<Void>)>(
+      symbol: 'InternalFlutterGpu_ComputePass_ClearBindings')
+  external void _clearBindings();
+
+  @Native<Void Function(Pointer<Void>, Int, Int)>(
+      symbol: 'InternalFlutterGpu_ComputePass_SetGridSize')
+  external void _setGridSize(int width, int height);
+
+  @Native<Void Function(Pointer<Void>, Int, Int)>(
+      symbol: 'InternalFlutterGpu_ComputePass_SetThreadGroupSize')
+  external void _setThreadGroupSize(int width, int height);
+
+  @Native<Bool Function(Pointer<Void>)>(
+      symbol: 'InternalFlutterGpu_ComputePass_Dispatch')
+  external bool _dispatch();
+}
@@ -104,6 +104,19 @@ base class GpuContext extends NativeFieldWrapperClass1 {
     return RenderPipeline._(this, vertexShader, fragmentShader);
   }
 
+  /// Whether this context supports [ComputePipeline]s and [ComputePass]es.
+  bool get doesSupportCompute {
+    return _doesSupportCompute();
+  }
+
+  /// Creates a pipeline that runs the given compute [shader].
+  ///
+  /// Throws an exception if the context doesn't support compute (see
+  /// [doesSupportCompute]) or if [shader] isn't a compute shader.
+  ComputePipeline createComputePipeline(Shader shader) {
+    return ComputePipeline._(this, shader);
+  }
+
   /// Associates the default Impeller context with this Context.
   @Native<Handle Function(Handle)>(
       symbol: 'InternalFlutterGpu_Context_InitializeDefault')
@@ -120,6 +133,10 @@ base class GpuContext extends NativeFieldWrapperClass1 {
   @Native<Int Function(Pointer<Void>)>(
       symbol: 'InternalFlutterGpu_Context_GetDefaultDepthStencilFormat')
   external int _getDefaultDepthStencilFormat();
+
+  @Native<Bool Function(Pointer<Void>)>(
+      symbol: 'InternalFlutterGpu_Context_DoesSupportCompute')
+  external bool _doesSupportCompute();
 }
 
 /// The default graphics context.
@@ -104,6 +104,7 @@ enum StoreAction {
 enum ShaderStage {
   vertex,
   fragment,
+  compute,
 }
 
 enum MinMagFilter {
@@ -444,7 +444,8 @@ abstract class SceneBuilder {
   ///  - 0x02: visualizeRasterizerStatistics - graph raster thread frame times
   ///  - 0x04: displayEngineStatistics - show UI thread frame time
   ///  - 0x08: visualizeEngineStatistics - graph UI thread frame times
-  /// Set enabledOptions to 0x0F to enable all the currently defined features.
+  ///  - 0x10: displayCacheStatistics - show the hit rates of engine caches
+  /// Set enabledOptions to 0x1F to enable all the currently defined features.
   ///
   /// The "UI thread" is the thread that includes all the execution of the main
   /// Dart isolate (the isolate that can call [FlutterView.render]). The UI
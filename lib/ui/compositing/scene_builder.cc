@@ -203,7 +203,11 @@ void SceneBuilder::pushShaderMask(Dart_Handle layer_handle,
 }
 
 void SceneBuilder::addRetained(const fml::RefPtr<EngineLayer>& retainedLayer) {
-  AddLayer(retainedLayer->Layer());
+  auto layer = retainedLayer->Layer();
+  if (layer) {
+    layer->set_retained(true);
+  }
+  AddLayer(std::move(layer));
 }
 
 void SceneBuilder::pop() {
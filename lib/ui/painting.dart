@@ -3032,7 +3032,7 @@ base class _NativePath extends NativeFieldWrapperClass1 implements Path {
     }
   }
 
-  @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double)>(symbol: 'Path::addPath')
+  @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double)>(symbol: 'Path::addPath', isLeaf: true)
   external void _addPath(_NativePath path, double dx, double dy);
 
   @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double, Handle)>(symbol: 'Path::addPathWithMatrix')
@@ -3049,7 +3049,7 @@ base class _NativePath extends NativeFieldWrapperClass1 implements Path {
     }
   }
 
-  @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double)>(symbol: 'Path::extendWithPath')
+  @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double)>(symbol: 'Path::extendWithPath', isLeaf: true)
   external void _extendWithPath(_NativePath path, double dx, double dy);
 
   @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double, Handle)>(symbol: 'Path::extendWithPathAndMatrix')
@@ -5864,7 +5864,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     _clipPath(path as _NativePath, doAntiAlias);
   }
 
-  @Native<Void Function(Pointer<Void>, Pointer<Void>, Bool)>(symbol: 'Canvas::clipPath')
+  @Native<Void Function(Pointer<Void>, Pointer<Void>, Bool)>(symbol: 'Canvas::clipPath', isLeaf: true)
   external void _clipPath(_NativePath path, bool doAntiAlias);
 
   @override
@@ -179,9 +179,9 @@ void Canvas::clipRRect(const RRect& rrect, bool doAntiAlias) {
 }
 
 void Canvas::clipPath(const CanvasPath* path, bool doAntiAlias) {
+  // This is a leaf call, so it can't throw. The Dart side only passes
+  // _NativePaths, which always have a native peer.
   if (!path) {
-    Dart_ThrowException(
-        ToDart("Canvas.clipPath called with non-genuine Path."));
     return;
   }
   if (display_list_builder_) {
@@ -0,0 +1,113 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <functional>
+#include <string_view>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+DecodedImageCache::DecodedImageCache(size_t max_bytes)
+    : max_bytes_(max_bytes) {}
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+DecodedImageCache::Key DecodedImageCache::MakeKey(const SkData& encoded,
+                                                  uint32_t target_width,
+                                                  uint32_t target_height) {
+  std::string_view bytes(static_cast<const char*>(encoded.data()),
+                         encoded.size());
+  return {
+      .hash = std::hash<std::string_view>{}(bytes),
+      .encoded_size = encoded.size(),
+      .target_width = target_width,
+      .target_height = target_height,
+  };
+}
+
+sk_sp<DlImage> DecodedImageCache::Get(const Key& key, const SkData& encoded) {
+  std::scoped_lock lock(mutex_);
+  auto entry = Find(key, encoded);
+  if (entry == entries_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, entry);
+  return entry->image;
+}
+
+void DecodedImageCache::Put(const Key& key,
+                            sk_sp<SkData> encoded,
+                            sk_sp<DlImage> image) {
+  if (!encoded || !image) {
+    return;
+  }
+  size_t byte_size = encoded->size() + image->GetApproximateByteSize();
+  if (byte_size > max_bytes_) {
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+  auto existing = Find(key, *encoded);
+  if (existing != entries_.end()) {
+    Evict(existing);
+  }
+  while (byte_size_ + byte_size > max_bytes_) {
+    FML_DCHECK(!entries_.empty());
+    Evict(std::prev(entries_.end()));
+  }
+  entries_.push_front({
+      .key = key,
+      .encoded = std::move(encoded),
+      .image = std::move(image),
+      .byte_size = byte_size,
+  });
+  index_.emplace(key, entries_.begin());
+  byte_size_ += byte_size;
+}
+
+void DecodedImageCache::Clear() {
+  std::scoped_lock lock(mutex_);
+  index_.clear();
+  entries_.clear();
+  byte_size_ = 0;
+}
+
+size_t DecodedImageCache::GetByteSize() const {
+  std::scoped_lock lock(mutex_);
+  return byte_size_;
+}
+
+size_t DecodedImageCache::GetEntryCount() const {
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+DecodedImageCache::EntryList::iterator DecodedImageCache::Find(
+    const Key& key,
+    const SkData& encoded) {
+  auto [begin, end] = index_.equal_range(key);
+  for (auto it = begin; it != end; ++it) {
+    if (it->second->encoded->equals(&encoded)) {
+      return it->second;
+    }
+  }
+  return entries_.end();
+}
+
+void DecodedImageCache::Evict(EntryList::iterator entry) {
+  auto [begin, end] = index_.equal_range(entry->key);
+  for (auto it = begin; it != end; ++it) {
+    if (it->second == entry) {
+      index_.erase(it);
+      break;
+    }
+  }
+  byte_size_ -= entry->byte_size;
+  entries_.erase(entry);
+}
+
+}  // namespace flutter
@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace flutter {
+
+/// @brief  A least recently used cache of decoded images, keyed by the
+///         contents of the encoded data they were decoded from and the size
+///         they were decoded to. This lets the same bytes decoded through
+///         different buffers, codecs or engines be decoded only once.
+///
+///         The cache holds on to the encoded data of each entry so that a hash
+///         collision can never return the wrong image. Both the encoded data
+///         and the decoded image count towards the byte budget.
+///
+///         The cache may be shared by engines spawned from one another, which
+///         is why it is safe to use from any thread.
+class DecodedImageCache {
+ public:
+  struct Key {
+    size_t hash;
+    size_t encoded_size;
+    uint32_t target_width;
+    uint32_t target_height;
+
+    bool operator==(const Key& other) const {
+      return hash == other.hash && encoded_size == other.encoded_size &&
+             target_width == other.target_width &&
+             target_height == other.target_height;
+    }
+  };
+
+  /// @brief  Creates a cache that holds at most `max_bytes` of encoded and
+  ///         decoded data.
+  explicit DecodedImageCache(size_t max_bytes);
+
+  ~DecodedImageCache();
+
+  /// @brief  Hashes the contents of `encoded`. This is linear in the size of
+  ///         the data, so callers that look an image up and then insert it
+  ///         should make the key once.
+  static Key MakeKey(const SkData& encoded,
+                     uint32_t target_width,
+                     uint32_t target_height);
+
+  /// @brief  Returns the image decoded from `encoded` for `key`, or nullptr
+  ///         if there is none, and marks it as the most recently used.
+  sk_sp<DlImage> Get(const Key& key, const SkData& encoded);
+
+  /// @brief  Inserts `image`, decoded from `encoded`, evicting the least
+  ///         recently used entries until the cache fits its budget. Images
+  ///         that do not fit on their own are not cached.
+  void Put(const Key& key, sk_sp<SkData> encoded, sk_sp<DlImage> image);
+
+  /// @brief  Drops every entry.
+  void Clear();
+
+  size_t GetByteSize() const;
+
+  size_t GetEntryCount() const;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return key.hash; }
+  };
+
+  struct Entry {
+    Key key;
+    sk_sp<SkData> encoded;
+    sk_sp<DlImage> image;
+    size_t byte_size;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  const size_t max_bytes_;
+  mutable std::mutex mutex_;
+  // Most recently used first.
+  EntryList entries_;
+  std::unordered_multimap<Key, EntryList::iterator, KeyHash> index_;
+  size_t byte_size_ = 0;
+
+  EntryList::iterator Find(const Key& key, const SkData& encoded);
+
+  void Evict(EntryList::iterator entry);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
@@ -0,0 +1,110 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <string>
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class FakeDlImage : public DlImage {
+ public:
+  explicit FakeDlImage(size_t byte_size) : byte_size_(byte_size) {}
+
+  sk_sp<SkImage> skia_image() const override { return nullptr; }
+
+  std::shared_ptr<impeller::Texture> impeller_texture() const override {
+    return nullptr;
+  }
+
+  bool isOpaque() const override { return false; }
+
+  bool isTextureBacked() const override { return true; }
+
+  bool isUIThreadSafe() const override { return true; }
+
+  SkISize dimensions() const override { return SkISize::Make(1, 1); }
+
+  size_t GetApproximateByteSize() const override { return byte_size_; }
+
+ private:
+  size_t byte_size_;
+};
+
+sk_sp<SkData> MakeData(const std::string& bytes) {
+  return SkData::MakeWithCopy(bytes.data(), bytes.size());
+}
+
+}  // namespace
+
+TEST(DecodedImageCacheTest, SharesImagesForEqualBytes) {
+  DecodedImageCache cache(1000);
+  auto first = MakeData("encoded");
+  auto second = MakeData("encoded");
+  auto image = sk_make_sp<FakeDlImage>(100);
+
+  auto key = DecodedImageCache::MakeKey(*first, 10, 10);
+  EXPECT_EQ(cache.Get(key, *first), nullptr);
+  cache.Put(key, first, image);
+
+  // Different buffers with the same contents share the decoded image.
+  auto second_key = DecodedImageCache::MakeKey(*second, 10, 10);
+  EXPECT_EQ(cache.Get(second_key, *second), image);
+  EXPECT_EQ(cache.GetByteSize(), first->size() + 100);
+
+  // Decoding to another size is a different entry.
+  auto other_size_key = DecodedImageCache::MakeKey(*second, 5, 5);
+  EXPECT_EQ(cache.Get(other_size_key, *second), nullptr);
+}
+
+TEST(DecodedImageCacheTest, NeverReturnsImagesOfOtherBytes) {
+  DecodedImageCache cache(1000);
+  auto encoded = MakeData("encoded");
+  auto other = MakeData("Encoded");
+  auto key = DecodedImageCache::MakeKey(*encoded, 10, 10);
+  cache.Put(key, encoded, sk_make_sp<FakeDlImage>(100));
+
+  // Even if the hashes were to collide, the bytes are compared.
+  EXPECT_EQ(cache.Get(key, *other), nullptr);
+}
+
+TEST(DecodedImageCacheTest, EvictsLeastRecentlyUsedImages) {
+  auto a = MakeData("a");
+  auto b = MakeData("b");
+  auto c = MakeData("c");
+  auto a_key = DecodedImageCache::MakeKey(*a, 1, 1);
+  auto b_key = DecodedImageCache::MakeKey(*b, 1, 1);
+  auto c_key = DecodedImageCache::MakeKey(*c, 1, 1);
+  // Room for two entries of 100 bytes plus their encoded byte.
+  DecodedImageCache cache(202);
+
+  cache.Put(a_key, a, sk_make_sp<FakeDlImage>(100));
+  cache.Put(b_key, b, sk_make_sp<FakeDlImage>(100));
+  // Using a makes b the least recently used.
+  EXPECT_NE(cache.Get(a_key, *a), nullptr);
+  cache.Put(c_key, c, sk_make_sp<FakeDlImage>(100));
+
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+  EXPECT_NE(cache.Get(a_key, *a), nullptr);
+  EXPECT_EQ(cache.Get(b_key, *b), nullptr);
+  EXPECT_NE(cache.Get(c_key, *c), nullptr);
+  EXPECT_EQ(cache.GetByteSize(), 202u);
+
+  // Images that are larger than the whole budget are not cached.
+  cache.Put(b_key, b, sk_make_sp<FakeDlImage>(1000));
+  EXPECT_EQ(cache.Get(b_key, *b), nullptr);
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetEntryCount(), 0u);
+  EXPECT_EQ(cache.GetByteSize(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -15,6 +15,10 @@
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 
+#if IMPELLER_SUPPORTS_RENDERING
+#include "impeller/entity/contents/runtime_effect_contents.h"
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 #include "third_party/skia/include/core/SkString.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
@@ -58,6 +62,23 @@ std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
   if (UIDartState::Current()->IsImpellerEnabled()) {
     runtime_effect_ = DlRuntimeEffect::MakeImpeller(
         std::make_unique<impeller::RuntimeStage>(std::move(runtime_stage)));
+#if IMPELLER_SUPPORTS_RENDERING
+    // Compile the shader on the IO thread now instead of on the raster thread
+    // the first time the program is drawn with.
+    UIDartState::Current()->GetTaskRunners().GetIOTaskRunner()->PostTask(
+        [io_manager = UIDartState::Current()->GetIOManager(),
+         runtime_stage = runtime_effect_->runtime_stage()]() {
+          if (!io_manager) {
+            return;
+          }
+          auto context = io_manager->GetImpellerContext();
+          if (!context) {
+            return;
+          }
+          impeller::RuntimeEffectContents::BootstrapShader(context,
+                                                           runtime_stage);
+        });
+#endif  // IMPELLER_SUPPORTS_RENDERING
   } else {
     const auto& code_mapping = runtime_stage.GetSkSLMapping();
     auto code_size = code_mapping->GetSize();
@@ -21,10 +21,11 @@ std::unique_ptr<ImageDecoder> ImageDecoder::Make(
 #if IMPELLER_SUPPORTS_RENDERING
   if (settings.enable_impeller) {
     return std::make_unique<ImageDecoderImpeller>(
-        runners,                            //
-        std::move(concurrent_task_runner),  //
-        std::move(io_manager),              //
-        settings.enable_wide_gamut,         //
+        runners,                             //
+        std::move(concurrent_task_runner),   //
+        std::move(io_manager),               //
+        settings.enable_wide_gamut,          //
+        settings.enable_yuv_image_decoding,  //
         gpu_disabled_switch);
   }
 #endif  // IMPELLER_SUPPORTS_RENDERING
@@ -54,4 +55,14 @@ fml::WeakPtr<ImageDecoder> ImageDecoder::GetWeakPtr() const {
   return weak_factory_.GetWeakPtr();
 }
 
+const std::shared_ptr<DecodedImageCache>& ImageDecoder::GetDecodedImageCache()
+    const {
+  return decoded_image_cache_;
+}
+
+void ImageDecoder::SetDecodedImageCache(
+    std::shared_ptr<DecodedImageCache> cache) {
+  decoded_image_cache_ = std::move(cache);
+}
+
 }  // namespace flutter
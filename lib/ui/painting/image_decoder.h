@@ -12,6 +12,7 @@
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/lib/ui/io_manager.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
 namespace flutter {
@@ -46,6 +47,12 @@ class ImageDecoder {
 
   fml::WeakPtr<ImageDecoder> GetWeakPtr() const;
 
+  // The cache consulted by codecs before they ask this decoder to decode an
+  // image, or nullptr if decoded images are not cached.
+  const std::shared_ptr<DecodedImageCache>& GetDecodedImageCache() const;
+
+  void SetDecodedImageCache(std::shared_ptr<DecodedImageCache> cache);
+
  protected:
   TaskRunners runners_;
   std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner_;
@@ -57,6 +64,7 @@ class ImageDecoder {
       fml::WeakPtr<IOManager> io_manager);
 
  private:
+  std::shared_ptr<DecodedImageCache> decoded_image_cache_;
   fml::WeakPtrFactory<ImageDecoder> weak_factory_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoder);
@@ -4,30 +4,50 @@
 
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 
+#include <atomic>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/parallel_for.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/core/allocator.h"
 #include "flutter/impeller/core/texture.h"
 #include "flutter/impeller/display_list/dl_image_impeller.h"
+#include "flutter/impeller/renderer/blit_pass.h"
 #include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
 #include "impeller/base/strings.h"
 #include "impeller/display_list/skia_conversions.h"
+#include "impeller/entity/contents/filters/yuv_to_rgb_filter_contents.h"
+#include "impeller/entity/yuv_to_rgb_filter.frag.h"
+#include "impeller/entity/yuv_to_rgb_filter.vert.h"
+#include "impeller/geometry/matrix.h"
 #include "impeller/geometry/size.h"
+#include "impeller/renderer/pipeline_builder.h"
+#include "impeller/renderer/pipeline_library.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/renderer/sampler_library.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
 #include "third_party/skia/include/core/SkAlphaType.h"
 #include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkColorType.h"
+#include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkMallocPixelRef.h"
+#include "third_party/skia/include/core/SkMatrix.h"
+#include "third_party/skia/include/core/SkPaint.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
 #include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkPoint.h"
 #include "third_party/skia/include/core/SkSamplingOptions.h"
+#include "third_party/skia/include/core/SkShader.h"
 #include "third_party/skia/include/core/SkSize.h"
 
 namespace flutter {
@@ -110,6 +130,63 @@ bool IsWideGamut(const SkColorSpace* color_space) {
   float area = CalculateArea(rgb);
   return area > kSrgbGamutArea;
 }
+
+// Destinations with more pixels than this are scaled in bands of about this
+// many pixels each.
+constexpr size_t kPixelsPerScaleBand = 512 * 512;
+
+/**
+ *  Scales |src| to |dst| like `SkPixmap::scalePixels`, but splits large
+ *  destinations into bands of rows that are drawn on the workers of |runner|
+ *  and the calling thread. Every band is drawn through the transform that maps
+ *  all of |src| onto all of |dst|, so each pixel is sampled the same way no
+ *  matter which band it is in.
+ */
+bool ScalePixels(const SkPixmap& src,
+                 const SkPixmap& dst,
+                 const SkSamplingOptions& sampling,
+                 const std::shared_ptr<fml::ConcurrentTaskRunner>& runner) {
+  sk_sp<SkImage> image = SkImages::RasterFromPixmap(src, nullptr, nullptr);
+  if (!image) {
+    return false;
+  }
+  const SkMatrix scale = SkMatrix::RectToRect(SkRect::Make(src.bounds()),
+                                              SkRect::Make(dst.bounds()));
+  sk_sp<SkShader> shader = image->makeShader(
+      SkTileMode::kClamp, SkTileMode::kClamp, sampling, scale);
+
+  std::atomic_bool success = true;
+  auto draw_rows = [&](size_t begin, size_t end) {
+    SkPixmap band;
+    SkIRect rows = SkIRect::MakeLTRB(0, static_cast<int32_t>(begin),
+                                     dst.width(), static_cast<int32_t>(end));
+    if (!dst.extractSubset(&band, rows)) {
+      success = false;
+      return;
+    }
+    auto canvas = SkCanvas::MakeRasterDirect(band.info(), band.writable_addr(),
+                                             band.rowBytes());
+    if (!canvas) {
+      success = false;
+      return;
+    }
+    canvas->translate(0, -static_cast<SkScalar>(begin));
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    paint.setShader(shader);
+    canvas->drawPaint(paint);
+  };
+
+  const size_t width = std::max(dst.width(), 1);
+  const size_t rows_per_band = std::max<size_t>(kPixelsPerScaleBand / width, 1);
+  if (!runner || static_cast<size_t>(dst.height()) <= rows_per_band) {
+    draw_rows(0, dst.height());
+  } else {
+    TRACE_EVENT0("impeller", "ScalePixelsInBands");
+    fml::ParallelFor(runner, dst.height(), rows_per_band, draw_rows);
+  }
+  return success;
+}
 }  // namespace
 
 ImageDecoderImpeller::ImageDecoderImpeller(
@@ -117,10 +194,13 @@ ImageDecoderImpeller::ImageDecoderImpeller(
     std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
     const fml::WeakPtr<IOManager>& io_manager,
     bool supports_wide_gamut,
+    bool decode_yuv_planes,
     const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch)
     : ImageDecoder(runners, std::move(concurrent_task_runner), io_manager),
       supports_wide_gamut_(supports_wide_gamut),
-      gpu_disabled_switch_(gpu_disabled_switch) {
+      decode_yuv_planes_(decode_yuv_planes),
+      gpu_disabled_switch_(gpu_disabled_switch),
+      upload_queue_(std::make_shared<TextureUploadQueue>()) {
   std::promise<std::shared_ptr<impeller::Context>> context_promise;
   context_ = context_promise.get_future();
   runners_.GetIOTaskRunner()->PostTask(fml::MakeCopyable(
@@ -132,6 +212,21 @@ ImageDecoderImpeller::ImageDecoderImpeller(
 
 ImageDecoderImpeller::~ImageDecoderImpeller() = default;
 
+TextureUploadQueue::TextureUploadQueue() = default;
+
+TextureUploadQueue::~TextureUploadQueue() = default;
+
+bool TextureUploadQueue::Push(PendingTextureUpload upload) {
+  std::scoped_lock lock(mutex_);
+  uploads_.push_back(std::move(upload));
+  return uploads_.size() == 1;
+}
+
+std::vector<PendingTextureUpload> TextureUploadQueue::TakeAll() {
+  std::scoped_lock lock(mutex_);
+  return std::exchange(uploads_, {});
+}
+
 static SkColorType ChooseCompatibleColorType(SkColorType type) {
   switch (type) {
     case kRGBA_F32_SkColorType:
@@ -150,7 +245,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
     SkISize target_size,
     impeller::ISize max_texture_size,
     bool supports_wide_gamut,
-    const std::shared_ptr<impeller::Allocator>& allocator) {
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   if (!descriptor) {
     std::string decode_error("Invalid descriptor (should never happen)");
@@ -268,9 +364,10 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
     FML_DLOG(ERROR) << decode_error;
     return DecompressResult{.decode_error = decode_error};
   }
-  if (!bitmap->pixmap().scalePixels(
-          scaled_bitmap->pixmap(),
-          SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone))) {
+  if (!ScalePixels(
+          bitmap->pixmap(), scaled_bitmap->pixmap(),
+          SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone),
+          concurrent_task_runner)) {
     FML_LOG(ERROR) << "Could not scale decoded bitmap data.";
   }
   scaled_bitmap->setImmutable();
@@ -284,11 +381,266 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
                           .image_info = scaled_bitmap->info()};
 }
 
-/// Only call this method if the GPU is available.
-static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
+sk_sp<DlImage> ImageDecoderImpeller::DecodeToTexture(
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    impeller::ISize max_texture_size,
+    bool supports_wide_gamut,
     const std::shared_ptr<impeller::Context>& context,
-    const std::shared_ptr<impeller::DeviceBuffer>& buffer,
-    const SkImageInfo& image_info) {
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  if (!descriptor || !descriptor->is_compressed() || !context) {
+    return nullptr;
+  }
+  const auto& base_image_info = descriptor->image_info();
+  if (supports_wide_gamut && IsWideGamut(base_image_info.colorSpace())) {
+    return nullptr;
+  }
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  target_size.set(std::min(static_cast<int32_t>(max_texture_size.width),
+                           target_size.width()),
+                  std::min(static_cast<int32_t>(max_texture_size.height),
+                           target_size.height()));
+  const SkColorType color_type =
+      ChooseCompatibleColorType(base_image_info.colorType());
+  const SkAlphaType alpha_type =
+      ChooseCompatibleAlphaType(base_image_info.alphaType());
+  const auto image_info = base_image_info.makeDimensions(target_size)
+                              .makeColorType(color_type)
+                              .makeAlphaType(alpha_type);
+
+  sk_sp<DlImage> image;
+  gpu_disabled_switch->Execute(fml::SyncSwitch::Handlers().SetIfFalse(
+      [&image, descriptor, &image_info, &context] {
+        image = descriptor->get_texture(image_info, context);
+      }));
+  if (image && image->dimensions() != target_size) {
+    FML_DLOG(ERROR) << "Image generator decoded a texture of the wrong size.";
+    return nullptr;
+  }
+  return image;
+}
+
+std::optional<YUVDecompressResult> ImageDecoderImpeller::DecompressYUVPlanes(
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    impeller::ISize max_texture_size,
+    const std::shared_ptr<impeller::Allocator>& allocator) {
+  if (!descriptor || !descriptor->is_compressed() || !allocator) {
+    return std::nullopt;
+  }
+  // Resizing and the conversion to RGB happen together on the CPU, so
+  // images that are resized are left to DecompressTexture.
+  if (target_size != descriptor->image_info().dimensions() ||
+      target_size.width() > max_texture_size.width ||
+      target_size.height() > max_texture_size.height) {
+    return std::nullopt;
+  }
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  ImpellerAllocator y_allocator(allocator);
+  ImpellerAllocator uv_allocator(allocator);
+  SkBitmap y_plane;
+  SkBitmap uv_plane;
+  if (!descriptor->get_yuv_planes(&y_allocator, &y_plane, &uv_allocator,
+                                  &uv_plane)) {
+    return std::nullopt;
+  }
+  if (y_plane.dimensions() != target_size ||
+      y_plane.colorType() != kGray_8_SkColorType ||
+      uv_plane.colorType() != kR8G8_unorm_SkColorType) {
+    FML_DLOG(ERROR) << "Image generator decoded unexpected YUV planes.";
+    return std::nullopt;
+  }
+  return YUVDecompressResult{
+      .y_buffer = y_allocator.GetDeviceBuffer(),
+      .uv_buffer = uv_allocator.GetDeviceBuffer(),
+      .y_size = y_plane.dimensions(),
+      .uv_size = uv_plane.dimensions(),
+  };
+}
+
+std::pair<sk_sp<DlImage>, std::string>
+ImageDecoderImpeller::UploadYUVPlanesToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    const YUVDecompressResult& planes) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  using VS = impeller::YuvToRgbFilterVertexShader;
+  using FS = impeller::YuvToRgbFilterFragmentShader;
+
+  if (!context) {
+    return std::make_pair(nullptr, "No Impeller context is available");
+  }
+  if (!planes.y_buffer || !planes.uv_buffer) {
+    return std::make_pair(nullptr, "No Impeller device buffer is available");
+  }
+  auto allocator = context->GetResourceAllocator();
+  const impeller::ISize size = {planes.y_size.width(), planes.y_size.height()};
+
+  impeller::TextureDescriptor y_descriptor;
+  y_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  y_descriptor.format = impeller::PixelFormat::kR8UNormInt;
+  y_descriptor.size = size;
+  impeller::TextureDescriptor uv_descriptor = y_descriptor;
+  uv_descriptor.format = impeller::PixelFormat::kR8G8UNormInt;
+  uv_descriptor.size = {planes.uv_size.width(), planes.uv_size.height()};
+
+  // The planes are rendered to a texture without mipmaps, which is then
+  // copied to the final texture so that its mipmaps can be generated.
+  impeller::TextureDescriptor rgba_descriptor;
+  rgba_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  rgba_descriptor.format = context->GetCapabilities()->GetDefaultColorFormat();
+  rgba_descriptor.size = size;
+  rgba_descriptor.usage =
+      static_cast<impeller::TextureUsageMask>(
+          impeller::TextureUsage::kRenderTarget) |
+      static_cast<impeller::TextureUsageMask>(
+          impeller::TextureUsage::kShaderRead);
+  impeller::TextureDescriptor dest_descriptor;
+  dest_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  dest_descriptor.format = rgba_descriptor.format;
+  dest_descriptor.size = size;
+  dest_descriptor.mip_count = size.MipCount();
+  dest_descriptor.compression_type = impeller::CompressionType::kLossy;
+
+  auto y_texture = allocator->CreateTexture(y_descriptor);
+  auto uv_texture = allocator->CreateTexture(uv_descriptor);
+  auto rgba_texture = allocator->CreateTexture(rgba_descriptor);
+  auto dest_texture = allocator->CreateTexture(dest_descriptor);
+  if (!y_texture || !uv_texture || !rgba_texture || !dest_texture) {
+    std::string decode_error("Could not create Impeller texture.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  dest_texture->SetLabel(
+      impeller::SPrintF("ui.Image(%p)", dest_texture.get()).c_str());
+
+  auto pipeline_descriptor =
+      impeller::PipelineBuilder<VS, FS>::MakeDefaultPipelineDescriptor(
+          *context);
+  if (!pipeline_descriptor.has_value()) {
+    std::string decode_error("Could not create YUV to RGB pipeline.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  impeller::ColorAttachmentDescriptor color0;
+  color0.format = rgba_descriptor.format;
+  color0.blending_enabled = false;
+  pipeline_descriptor->SetColorAttachmentDescriptor(0u, color0);
+  pipeline_descriptor->ClearStencilAttachments();
+  pipeline_descriptor->ClearDepthAttachment();
+  pipeline_descriptor->SetPrimitiveType(
+      impeller::PrimitiveType::kTriangleStrip);
+  // The pipeline library caches pipelines by their descriptor, so this only
+  // waits for the pipeline to be created for the first image.
+  auto pipeline = context->GetPipelineLibrary()
+                      ->GetPipeline(std::move(pipeline_descriptor.value()))
+                      .Get();
+  if (!pipeline) {
+    std::string decode_error("Could not create YUV to RGB pipeline.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    std::string decode_error(
+        "Could not create command buffer for YUV conversion.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  command_buffer->SetLabel("YUV Conversion Command Buffer");
+
+  auto upload_pass = command_buffer->CreateBlitPass();
+  if (!upload_pass) {
+    std::string decode_error("Could not create blit pass for YUV planes.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  upload_pass->SetLabel("YUV Planes Blit Pass");
+  upload_pass->AddCopy(planes.y_buffer->AsBufferView(), y_texture);
+  upload_pass->AddCopy(planes.uv_buffer->AsBufferView(), uv_texture);
+  upload_pass->EncodeCommands(allocator);
+
+  impeller::ColorAttachment color_attachment;
+  color_attachment.texture = rgba_texture;
+  color_attachment.load_action = impeller::LoadAction::kDontCare;
+  color_attachment.store_action = impeller::StoreAction::kStore;
+  impeller::RenderTarget render_target;
+  render_target.SetColorAttachment(color_attachment, 0u);
+  auto render_pass = command_buffer->CreateRenderPass(render_target);
+  if (!render_pass) {
+    std::string decode_error("Could not create render pass for YUV planes.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  render_pass->SetLabel("YUV Conversion Render Pass");
+
+  impeller::Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "YUV to RGB");
+  cmd.pipeline = std::move(pipeline);
+  impeller::VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+  vtx_builder.AddVertices({
+      {impeller::Point(0, 0)},
+      {impeller::Point(1, 0)},
+      {impeller::Point(0, 1)},
+      {impeller::Point(1, 1)},
+  });
+  auto& host_buffer = render_pass->GetTransientsBuffer();
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(host_buffer));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = impeller::Matrix::MakeOrthographic(size) *
+                   impeller::Matrix::MakeScale(impeller::Vector2(size));
+  frame_info.texture_sampler_y_coord_scale = y_texture->GetYCoordScale();
+  FS::FragInfo frag_info;
+  frag_info.yuv_color_space =
+      static_cast<impeller::Scalar>(impeller::YUVColorSpace::kBT601FullRange);
+  frag_info.matrix = impeller::YUVToRGBFilterContents::GetYUVToRGBMatrix(
+      impeller::YUVColorSpace::kBT601FullRange);
+
+  auto sampler = context->GetSamplerLibrary()->GetSampler({});
+  FS::BindYTexture(cmd, y_texture, sampler);
+  FS::BindUvTexture(cmd, uv_texture, sampler);
+  FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+  VS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+  if (!render_pass->AddCommand(std::move(cmd)) ||
+      !render_pass->EncodeCommands()) {
+    std::string decode_error("Could not encode YUV conversion.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  auto mipmap_pass = command_buffer->CreateBlitPass();
+  if (!mipmap_pass) {
+    std::string decode_error(
+        "Could not create blit pass for mipmap generation.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  mipmap_pass->SetLabel("Mipmap Blit Pass");
+  mipmap_pass->AddCopy(rgba_texture, dest_texture);
+  if (dest_descriptor.mip_count > 1) {
+    mipmap_pass->GenerateMipmap(dest_texture);
+  }
+  mipmap_pass->EncodeCommands(allocator);
+
+  if (!command_buffer->SubmitCommands()) {
+    std::string decode_error("Failed to submit YUV conversion command buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  return std::make_pair(
+      impeller::DlImageImpeller::Make(std::move(dest_texture)), std::string());
+}
+
+/// Create a device private texture and add the commands that fill it from the
+/// buffer, and generate its mipmaps, to the blit pass.
+static std::pair<std::shared_ptr<impeller::Texture>, std::string>
+AddUploadToBlitPass(const std::shared_ptr<impeller::Context>& context,
+                    impeller::BlitPass& blit_pass,
+                    const std::shared_ptr<impeller::DeviceBuffer>& buffer,
+                    const SkImageInfo& image_info) {
   const auto pixel_format =
       impeller::skia_conversions::ToPixelFormat(image_info.colorType());
   if (!pixel_format) {
@@ -316,6 +668,18 @@ static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
   dest_texture->SetLabel(
       impeller::SPrintF("ui.Image(%p)", dest_texture.get()).c_str());
 
+  blit_pass.AddCopy(buffer->AsBufferView(), dest_texture);
+  if (texture_descriptor.size.MipCount() > 1) {
+    blit_pass.GenerateMipmap(dest_texture);
+  }
+  return std::make_pair(std::move(dest_texture), std::string());
+}
+
+/// Only call this method if the GPU is available.
+static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::DeviceBuffer>& buffer,
+    const SkImageInfo& image_info) {
   auto command_buffer = context->CreateCommandBuffer();
   if (!command_buffer) {
     std::string decode_error(
@@ -333,9 +697,9 @@ static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
     return std::make_pair(nullptr, decode_error);
   }
   blit_pass->SetLabel("Mipmap Blit Pass");
-  blit_pass->AddCopy(buffer->AsBufferView(), dest_texture);
-  if (texture_descriptor.size.MipCount() > 1) {
-    blit_pass->GenerateMipmap(dest_texture);
+  auto upload = AddUploadToBlitPass(context, *blit_pass, buffer, image_info);
+  if (!upload.first) {
+    return std::make_pair(nullptr, upload.second);
   }
 
   blit_pass->EncodeCommands(context->GetResourceAllocator());
@@ -346,7 +710,55 @@ static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
   }
 
   return std::make_pair(
-      impeller::DlImageImpeller::Make(std::move(dest_texture)), std::string());
+      impeller::DlImageImpeller::Make(std::move(upload.first)), std::string());
+}
+
+/// Only call this method if the GPU is available.
+static void UnsafeUploadTexturesToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::vector<PendingTextureUpload>& uploads) {
+  auto fail_all = [&uploads](const std::string& decode_error) {
+    FML_DLOG(ERROR) << decode_error;
+    for (const auto& upload : uploads) {
+      upload.result(nullptr, decode_error);
+    }
+  };
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    fail_all("Could not create command buffer for mipmap generation.");
+    return;
+  }
+  command_buffer->SetLabel("Mipmap Command Buffer");
+
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    fail_all("Could not create blit pass for mipmap generation.");
+    return;
+  }
+  blit_pass->SetLabel("Mipmap Blit Pass");
+  std::vector<std::pair<std::shared_ptr<impeller::Texture>, std::string>>
+      textures;
+  textures.reserve(uploads.size());
+  for (const auto& upload : uploads) {
+    textures.push_back(AddUploadToBlitPass(context, *blit_pass, upload.buffer,
+                                           upload.image_info));
+  }
+
+  blit_pass->EncodeCommands(context->GetResourceAllocator());
+  if (!command_buffer->SubmitCommands()) {
+    fail_all("Failed to submit blit pass command buffer.");
+    return;
+  }
+
+  for (size_t i = 0; i < uploads.size(); i++) {
+    auto& [texture, decode_error] = textures[i];
+    if (!texture) {
+      uploads[i].result(nullptr, decode_error);
+      continue;
+    }
+    uploads[i].result(impeller::DlImageImpeller::Make(std::move(texture)),
+                      std::string());
+  }
 }
 
 std::pair<sk_sp<DlImage>, std::string>
@@ -380,6 +792,39 @@ ImageDecoderImpeller::UploadTextureToPrivate(
   return result;
 }
 
+void ImageDecoderImpeller::UploadTexturesToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    std::vector<PendingTextureUpload> uploads,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (uploads.empty()) {
+    return;
+  }
+  if (!context) {
+    for (const auto& upload : uploads) {
+      upload.result(nullptr, "No Impeller context is available");
+    }
+    return;
+  }
+
+  gpu_disabled_switch->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfFalse([&uploads, &context] {
+            UnsafeUploadTexturesToPrivate(context, uploads);
+          })
+          .SetIfTrue([&uploads, &context, &gpu_disabled_switch] {
+            for (const auto& upload : uploads) {
+              // create_mips is false because we already know the GPU is
+              // disabled.
+              auto [image, decode_error] = UploadTextureToStorage(
+                  context, upload.bitmap, gpu_disabled_switch,
+                  impeller::StorageMode::kHostVisible,
+                  /*create_mips=*/false);
+              upload.result(image, decode_error);
+            }
+          }));
+}
+
 std::pair<sk_sp<DlImage>, std::string>
 ImageDecoderImpeller::UploadTextureToStorage(
     const std::shared_ptr<impeller::Context>& context,
@@ -410,6 +855,9 @@ ImageDecoderImpeller::UploadTextureToStorage(
   texture_descriptor.size = {image_info.width(), image_info.height()};
   texture_descriptor.mip_count =
       create_mips ? texture_descriptor.size.MipCount() : 1;
+  if (storage_mode == impeller::StorageMode::kDevicePrivate) {
+    texture_descriptor.compression_type = impeller::CompressionType::kLossy;
+  }
 
   auto texture =
       context->GetResourceAllocator()->CreateTexture(texture_descriptor);
@@ -500,8 +948,11 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
        context = context_.get(),                                  //
        target_size = SkISize::Make(target_width, target_height),  //
        io_runner = runners_.GetIOTaskRunner(),                    //
+       concurrent_task_runner = concurrent_task_runner_,          //
        result,
        supports_wide_gamut = supports_wide_gamut_,  //
+       decode_yuv_planes = decode_yuv_planes_,      //
+       upload_queue = upload_queue_,                //
        gpu_disabled_switch = gpu_disabled_switch_]() {
         if (!context) {
           result(nullptr, "No Impeller context is available");
@@ -510,38 +961,95 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
 
-        // Always decompress on the concurrent runner.
-        auto bitmap_result = DecompressTexture(
-            raw_descriptor, target_size, max_size_supported,
-            supports_wide_gamut, context->GetResourceAllocator());
-        if (!bitmap_result.device_buffer) {
-          result(nullptr, bitmap_result.decode_error);
+        // Decoders that write straight into memory the GPU can import skip
+        // the staging buffer and the upload.
+        if (auto image = DecodeToTexture(raw_descriptor, target_size,
+                                         max_size_supported,
+                                         supports_wide_gamut, context,
+                                         gpu_disabled_switch)) {
+          result(image, std::string());
           return;
         }
-        auto upload_texture_and_invoke_result = [result, context, bitmap_result,
-                                                 gpu_disabled_switch]() {
-          sk_sp<DlImage> image;
-          std::string decode_error;
+
+        auto decompress_and_upload = [raw_descriptor, context, target_size,
+                                      max_size_supported, io_runner,
+                                      concurrent_task_runner, result,
+                                      supports_wide_gamut, upload_queue,
+                                      gpu_disabled_switch]() {
+          // Always decompress on the concurrent runner.
+          auto bitmap_result = DecompressTexture(
+              raw_descriptor, target_size, max_size_supported,
+              supports_wide_gamut, context->GetResourceAllocator(),
+              concurrent_task_runner);
+          if (!bitmap_result.device_buffer) {
+            result(nullptr, bitmap_result.decode_error);
+            return;
+          }
+          // TODO(jonahwilliams):
+          // https://github.com/flutter/flutter/issues/123058 Technically we
+          // don't need to post tasks to the io runner, but without this
+          // forced serialization we can end up overloading the GPU and/or
+          // competing with raster workloads.
           if (!kShouldUseMallocDeviceBuffer &&
               context->GetCapabilities()->SupportsBufferToTextureBlits()) {
-            std::tie(image, decode_error) = UploadTextureToPrivate(
-                context, bitmap_result.device_buffer, bitmap_result.image_info,
-                bitmap_result.sk_bitmap, gpu_disabled_switch);
-            result(image, decode_error);
-          } else {
-            std::tie(image, decode_error) = UploadTextureToStorage(
+            // Images that finish decoding before the IO thread gets to the
+            // first of them share its command buffer.
+            if (upload_queue->Push({.buffer = bitmap_result.device_buffer,
+                                    .image_info = bitmap_result.image_info,
+                                    .bitmap = bitmap_result.sk_bitmap,
+                                    .result = result})) {
+              io_runner->PostTask(
+                  [context, upload_queue, gpu_disabled_switch]() {
+                    UploadTexturesToPrivate(context, upload_queue->TakeAll(),
+                                            gpu_disabled_switch);
+                  });
+            }
+            return;
+          }
+          io_runner->PostTask([result, context, bitmap_result,
+                               gpu_disabled_switch]() {
+            auto [image, decode_error] = UploadTextureToStorage(
                 context, bitmap_result.sk_bitmap, gpu_disabled_switch,
                 impeller::StorageMode::kDevicePrivate,
                 /*create_mips=*/true);
             result(image, decode_error);
-          }
+          });
         };
-        // TODO(jonahwilliams):
-        // https://github.com/flutter/flutter/issues/123058 Technically we
-        // don't need to post tasks to the io runner, but without this
-        // forced serialization we can end up overloading the GPU and/or
-        // competing with raster workloads.
-        io_runner->PostTask(upload_texture_and_invoke_result);
+
+        // The planes are converted with a pipeline created off the raster
+        // thread, which the OpenGL ES pipeline library does not support.
+        if (decode_yuv_planes && !kShouldUseMallocDeviceBuffer &&
+            context->GetBackendType() !=
+                impeller::Context::BackendType::kOpenGLES &&
+            context->GetCapabilities()->SupportsBufferToTextureBlits()) {
+          auto planes =
+              DecompressYUVPlanes(raw_descriptor, target_size,
+                                  max_size_supported,
+                                  context->GetResourceAllocator());
+          if (planes.has_value()) {
+            io_runner->PostTask([result, context, planes = planes.value(),
+                                 gpu_disabled_switch, concurrent_task_runner,
+                                 decompress_and_upload]() {
+              bool uploaded = false;
+              gpu_disabled_switch->Execute(
+                  fml::SyncSwitch::Handlers().SetIfFalse(
+                      [&uploaded, &result, &context, &planes] {
+                        auto [image, decode_error] =
+                            UploadYUVPlanesToPrivate(context, planes);
+                        result(image, decode_error);
+                        uploaded = true;
+                      }));
+              // Without the GPU the planes cannot be converted, so the image
+              // is decoded to RGBA after all.
+              if (!uploaded) {
+                concurrent_task_runner->PostTask(decompress_and_upload);
+              }
+            });
+            return;
+          }
+        }
+
+        decompress_and_upload();
       });
 }
 
@@ -6,6 +6,9 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_IMPELLER_H_
 
 #include <future>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
@@ -44,6 +47,44 @@ struct DecompressResult {
   std::string decode_error;
 };
 
+struct YUVDecompressResult {
+  std::shared_ptr<impeller::DeviceBuffer> y_buffer;
+  std::shared_ptr<impeller::DeviceBuffer> uv_buffer;
+  SkISize y_size;
+  SkISize uv_size;
+};
+
+/// A decoded image that waits to be uploaded to a device private texture.
+struct PendingTextureUpload {
+  std::shared_ptr<impeller::DeviceBuffer> buffer;
+  SkImageInfo image_info;
+  std::shared_ptr<SkBitmap> bitmap;
+  ImageDecoder::ImageResult result;
+};
+
+/// Collects the images that finish decoding while the IO thread is busy, so
+/// that they are uploaded with a single command buffer.
+class TextureUploadQueue {
+ public:
+  TextureUploadQueue();
+
+  ~TextureUploadQueue();
+
+  /// @brief  Queue an upload.
+  /// @return Whether the queue was empty, in which case the caller posts a
+  ///         task that uploads the queue.
+  bool Push(PendingTextureUpload upload);
+
+  /// @brief  Remove every queued upload.
+  std::vector<PendingTextureUpload> TakeAll();
+
+ private:
+  std::mutex mutex_;
+  std::vector<PendingTextureUpload> uploads_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TextureUploadQueue);
+};
+
 class ImageDecoderImpeller final : public ImageDecoder {
  public:
   ImageDecoderImpeller(
@@ -51,6 +92,7 @@ class ImageDecoderImpeller final : public ImageDecoder {
       std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
       const fml::WeakPtr<IOManager>& io_manager,
       bool supports_wide_gamut,
+      bool decode_yuv_planes,
       const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
 
   ~ImageDecoderImpeller() override;
@@ -61,13 +103,65 @@ class ImageDecoderImpeller final : public ImageDecoder {
               uint32_t target_height,
               const ImageResult& result) override;
 
+  /// @brief Decode the image on the calling thread and resize it to the
+  ///        target size. Large images are resized on the workers of
+  ///        `concurrent_task_runner` too, if one is given.
   static DecompressResult DecompressTexture(
       ImageDescriptor* descriptor,
       SkISize target_size,
       impeller::ISize max_texture_size,
       bool supports_wide_gamut,
+      const std::shared_ptr<impeller::Allocator>& allocator,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner =
+          nullptr);
+
+  /// @brief Decode the image straight into a texture if its generator can,
+  ///        for example with a hardware decoder.
+  /// @param descriptor       The image to decode.
+  /// @param target_size      The size that the texture must have.
+  /// @param max_texture_size The largest texture the context supports.
+  /// @param supports_wide_gamut Whether wide gamut images are decoded with
+  ///                         their gamut, in which case they are left to
+  ///                         `DecompressTexture`.
+  /// @param context          The Impeller graphics context.
+  /// @param gpu_disabled_switch Whether the GPU is available.
+  /// @return                 A DlImage, or null if the image has to be
+  ///                         decoded with `DecompressTexture` instead.
+  /// @see   `ImageGenerator::GetTexture`
+  static sk_sp<DlImage> DecodeToTexture(
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      impeller::ISize max_texture_size,
+      bool supports_wide_gamut,
+      const std::shared_ptr<impeller::Context>& context,
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+
+  /// @brief Decode the luma and chroma planes of the image, if it is stored
+  ///        that way and is decoded at its full size.
+  /// @param descriptor       The image to decode.
+  /// @param target_size      The size that the image is decoded to.
+  /// @param max_texture_size The largest texture the context supports.
+  /// @param allocator        The allocator to allocate the planes with.
+  /// @return                 Host buffers with the planes, or std::nullopt if
+  ///                         the image has to be decoded with
+  ///                         `DecompressTexture` instead.
+  /// @see   `ImageGenerator::GetYUVPlanes`
+  static std::optional<YUVDecompressResult> DecompressYUVPlanes(
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      impeller::ISize max_texture_size,
       const std::shared_ptr<impeller::Allocator>& allocator);
 
+  /// @brief Upload the planes to device private textures and convert them
+  ///        to a mipmapped RGBA texture with the YUV to RGB filter shader.
+  ///        Only call this method if the GPU is available.
+  /// @param context The Impeller graphics context.
+  /// @param planes  The planes returned by `DecompressYUVPlanes`.
+  /// @return        A DlImage.
+  static std::pair<sk_sp<DlImage>, std::string> UploadYUVPlanesToPrivate(
+      const std::shared_ptr<impeller::Context>& context,
+      const YUVDecompressResult& planes);
+
   /// @brief Create a device private texture from the provided host buffer.
   ///        This method is only suported on the metal backend.
   /// @param context    The Impeller graphics context.
@@ -83,6 +177,18 @@ class ImageDecoderImpeller final : public ImageDecoder {
       const std::shared_ptr<SkBitmap>& bitmap,
       const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
 
+  /// @brief Create device private textures from the provided host buffers
+  ///        with a single command buffer, and invoke the result of each
+  ///        upload. If the GPU is disabled, every image is uploaded to a
+  ///        host visible texture instead.
+  /// @param context   The Impeller graphics context.
+  /// @param uploads   The images to upload.
+  /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  static void UploadTexturesToPrivate(
+      const std::shared_ptr<impeller::Context>& context,
+      std::vector<PendingTextureUpload> uploads,
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+
   /// @brief Create a host visible texture from the provided bitmap.
   /// @param context     The Impeller graphics context.
   /// @param bitmap      A bitmap containg the image to be uploaded.
@@ -102,7 +208,9 @@ class ImageDecoderImpeller final : public ImageDecoder {
   using FutureContext = std::shared_future<std::shared_ptr<impeller::Context>>;
   FutureContext context_;
   const bool supports_wide_gamut_;
+  const bool decode_yuv_planes_;
   std::shared_ptr<fml::SyncSwitch> gpu_disabled_switch_;
+  std::shared_ptr<TextureUploadQueue> upload_queue_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoderImpeller);
 };
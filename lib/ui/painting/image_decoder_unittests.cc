@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "flutter/common/task_runners.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/impeller/core/allocator.h"
@@ -30,6 +31,10 @@
 #include "third_party/skia/include/core/SkSize.h"
 #include "third_party/skia/include/encode/SkPngEncoder.h"
 
+#if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/impeller/display_list/dl_image_impeller.h"
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 // CREATE_NATIVE_ENTRY is leaky by design
 // NOLINTBEGIN(clang-analyzer-core.StackAddressEscape)
 
@@ -220,6 +225,104 @@ class UnknownImageGenerator : public ImageGenerator {
   SkImageInfo info_;
 };
 
+#if IMPELLER_SUPPORTS_RENDERING
+/// An image generator that pretends to decode straight into textures, the
+/// way a hardware decoder would.
+class TextureImageGenerator : public ImageGenerator {
+ public:
+  explicit TextureImageGenerator(SkISize texture_size)
+      : info_(SkImageInfo::Make(100,
+                                100,
+                                kRGBA_8888_SkColorType,
+                                kPremul_SkAlphaType)),
+        texture_size_(texture_size) {}
+  ~TextureImageGenerator() = default;
+  const SkImageInfo& GetInfo() { return info_; }
+
+  unsigned int GetFrameCount() const { return 1; }
+
+  unsigned int GetPlayCount() const { return 1; }
+
+  const ImageGenerator::FrameInfo GetFrameInfo(unsigned int frame_index) {
+    return {std::nullopt, 0, SkCodecAnimation::DisposalMethod::kKeep};
+  }
+
+  SkISize GetScaledDimensions(float scale) {
+    return SkISize::Make(info_.width(), info_.height());
+  }
+
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) {
+    get_pixels_count_++;
+    return false;
+  };
+
+  sk_sp<DlImage> GetTexture(
+      const SkImageInfo& info,
+      const std::shared_ptr<impeller::Context>& context) override {
+    requested_texture_info_ = info;
+    impeller::TextureDescriptor desc;
+    desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
+    desc.size = {texture_size_.width(), texture_size_.height()};
+    return impeller::DlImageImpeller::Make(
+        context->GetResourceAllocator()->CreateTexture(desc));
+  }
+
+  std::optional<SkImageInfo> requested_texture_info_;
+  size_t get_pixels_count_ = 0;
+
+ private:
+  SkImageInfo info_;
+  SkISize texture_size_;
+};
+
+TEST_F(ImageDecoderFixtureTest, ImpellerDecodesToTextureWhenGeneratorCan) {
+  auto context = std::make_shared<impeller::TestImpellerContext>();
+  auto generator =
+      std::make_shared<TextureImageGenerator>(SkISize::Make(50, 25));
+  auto descriptor =
+      fml::MakeRefCounted<ImageDescriptor>(SkData::MakeEmpty(), generator);
+
+  auto image = ImageDecoderImpeller::DecodeToTexture(
+      descriptor.get(), SkISize::Make(50, 25), {2048, 2048},
+      /*supports_wide_gamut=*/false, context,
+      std::make_shared<fml::SyncSwitch>());
+  ASSERT_TRUE(image);
+  EXPECT_EQ(image->dimensions(), SkISize::Make(50, 25));
+  ASSERT_TRUE(generator->requested_texture_info_.has_value());
+  EXPECT_EQ(generator->requested_texture_info_->dimensions(),
+            SkISize::Make(50, 25));
+  EXPECT_EQ(generator->requested_texture_info_->colorType(),
+            kRGBA_8888_SkColorType);
+  EXPECT_EQ(generator->get_pixels_count_, 0u);
+}
+
+TEST_F(ImageDecoderFixtureTest, ImpellerDecodeToTextureFallsBack) {
+  auto context = std::make_shared<impeller::TestImpellerContext>();
+  auto generator =
+      std::make_shared<TextureImageGenerator>(SkISize::Make(100, 100));
+  auto descriptor =
+      fml::MakeRefCounted<ImageDescriptor>(SkData::MakeEmpty(), generator);
+
+  // A texture of the wrong size is dropped.
+  EXPECT_FALSE(ImageDecoderImpeller::DecodeToTexture(
+      descriptor.get(), SkISize::Make(50, 50), {2048, 2048},
+      /*supports_wide_gamut=*/false, context,
+      std::make_shared<fml::SyncSwitch>()));
+
+  // The generator is not asked while GPU access is disabled.
+  generator->requested_texture_info_.reset();
+  EXPECT_FALSE(ImageDecoderImpeller::DecodeToTexture(
+      descriptor.get(), SkISize::Make(100, 100), {2048, 2048},
+      /*supports_wide_gamut=*/false, context,
+      std::make_shared<fml::SyncSwitch>(true)));
+  EXPECT_FALSE(generator->requested_texture_info_.has_value());
+}
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 TEST_F(ImageDecoderFixtureTest, InvalidImageResultsError) {
   auto loop = fml::ConcurrentMessageLoop::Create();
   auto thread_task_runner = CreateNewThread();
@@ -342,6 +445,40 @@ TEST_F(ImageDecoderFixtureTest, ImpellerUploadToSharedNoGpu) {
   ASSERT_EQ(result.second, "");
 }
 
+TEST_F(ImageDecoderFixtureTest, ImpellerUploadsQueuedTexturesTogether) {
+#if !IMPELLER_SUPPORTS_RENDERING
+  GTEST_SKIP() << "Impeller only test.";
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  TextureUploadQueue queue;
+  size_t result_count = 0;
+  auto info = SkImageInfo::Make(10, 10, SkColorType::kRGBA_8888_SkColorType,
+                                SkAlphaType::kPremul_SkAlphaType);
+  for (int i = 0; i < 3; i++) {
+    auto bitmap = std::make_shared<SkBitmap>();
+    bitmap->allocPixels(info, 10 * 4);
+    impeller::DeviceBufferDescriptor desc;
+    desc.size = bitmap->computeByteSize();
+    PendingTextureUpload upload{
+        .buffer = std::make_shared<impeller::TestImpellerDeviceBuffer>(desc),
+        .image_info = info,
+        .bitmap = bitmap,
+        .result = [&result_count](auto image, auto decode_error) {
+          result_count++;
+        }};
+    // Only the first upload needs a task to upload the queue.
+    EXPECT_EQ(queue.Push(std::move(upload)), i == 0);
+  }
+
+  auto context = std::make_shared<impeller::TestImpellerContext>();
+  auto gpu_enabled_switch = std::make_shared<fml::SyncSwitch>(false);
+  ImageDecoderImpeller::UploadTexturesToPrivate(context, queue.TakeAll(),
+                                                gpu_enabled_switch);
+  EXPECT_EQ(context->command_buffer_count_, 1ul);
+  EXPECT_EQ(result_count, 3ul);
+  EXPECT_TRUE(queue.TakeAll().empty());
+}
+
 TEST_F(ImageDecoderFixtureTest, ImpellerNullColorspace) {
   auto info = SkImageInfo::Make(10, 10, SkColorType::kRGBA_8888_SkColorType,
                                 SkAlphaType::kPremul_SkAlphaType);
@@ -369,6 +506,48 @@ TEST_F(ImageDecoderFixtureTest, ImpellerNullColorspace) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST_F(ImageDecoderFixtureTest, ImpellerResizesLargeImagesInParallel) {
+  auto info = SkImageInfo::Make(1024, 1024, kRGBA_8888_SkColorType,
+                                kPremul_SkAlphaType);
+  SkBitmap bitmap;
+  bitmap.allocPixels(info);
+  for (int y = 0; y < info.height(); y++) {
+    uint8_t* row = static_cast<uint8_t*>(bitmap.getAddr(0, y));
+    for (int x = 0; x < info.width(); x++) {
+      row[x * 4 + 0] = x & 0xFF;
+      row[x * 4 + 1] = y & 0xFF;
+      row[x * 4 + 2] = (x ^ y) & 0xFF;
+      row[x * 4 + 3] = 0xFF;
+    }
+  }
+  auto data =
+      SkData::MakeWithCopy(bitmap.getPixels(), bitmap.computeByteSize());
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(
+      std::move(data), info, bitmap.rowBytes());
+
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  auto loop = fml::ConcurrentMessageLoop::Create(4);
+  auto serial = ImageDecoderImpeller::DecompressTexture(
+      descriptor.get(), SkISize::Make(1000, 900), {2048, 2048},
+      /*supports_wide_gamut=*/false, allocator);
+  auto parallel = ImageDecoderImpeller::DecompressTexture(
+      descriptor.get(), SkISize::Make(1000, 900), {2048, 2048},
+      /*supports_wide_gamut=*/false, allocator, loop->GetTaskRunner());
+  ASSERT_TRUE(serial.sk_bitmap);
+  ASSERT_TRUE(parallel.sk_bitmap);
+  ASSERT_EQ(parallel.sk_bitmap->dimensions(), SkISize::Make(1000, 900));
+  // Splitting the resize into bands does not change a single pixel.
+  for (int y = 0; y < 900; y++) {
+    ASSERT_EQ(memcmp(serial.sk_bitmap->getAddr(0, y),
+                     parallel.sk_bitmap->getAddr(0, y), 1000 * 4),
+              0)
+        << "Row " << y << " differs.";
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 TEST_F(ImageDecoderFixtureTest, ImpellerPixelConversion32F) {
   auto info = SkImageInfo::Make(10, 10, SkColorType::kRGBA_F32_SkColorType,
                                 SkAlphaType::kUnpremul_SkAlphaType);
@@ -734,6 +913,86 @@ TEST(ImageDecoderTest, VerifySimpleDecoding) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+#if IMPELLER_SUPPORTS_RENDERING
+/// An allocator that remembers the largest buffer it was asked for.
+class SizeRecordingAllocator : public impeller::Allocator {
+ public:
+  size_t largest_buffer_size = 0;
+
+ private:
+  impeller::ISize GetMaxTextureSizeSupported() const override {
+    return impeller::ISize{2048, 2048};
+  }
+
+  std::shared_ptr<impeller::DeviceBuffer> OnCreateBuffer(
+      const impeller::DeviceBufferDescriptor& desc) override {
+    largest_buffer_size = std::max(largest_buffer_size, desc.size);
+    return std::make_shared<impeller::TestImpellerDeviceBuffer>(desc);
+  }
+
+  std::shared_ptr<impeller::Texture> OnCreateTexture(
+      const impeller::TextureDescriptor& desc) override {
+    return std::make_shared<impeller::TestImpellerTexture>(desc);
+  }
+};
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+TEST(ImageDecoderTest, ThumbnailsAreDecodedAtAReducedSize) {
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  ASSERT_EQ(generator->GetInfo().dimensions(), SkISize::Make(600, 200));
+
+  // The smallest of 1/2, 1/4 and 1/8 that still covers the desired scale.
+  EXPECT_EQ(generator->GetScaledDimensions(0.1f), SkISize::Make(75, 25));
+  EXPECT_EQ(generator->GetScaledDimensions(0.2f), SkISize::Make(150, 50));
+  EXPECT_EQ(generator->GetScaledDimensions(0.5f), SkISize::Make(300, 100));
+
+#if IMPELLER_SUPPORTS_RENDERING
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  auto allocator = std::make_shared<SizeRecordingAllocator>();
+  auto result = ImageDecoderImpeller::DecompressTexture(
+      descriptor.get(), SkISize::Make(60, 20), {2048, 2048},
+      /*supports_wide_gamut=*/false, allocator);
+  ASSERT_TRUE(result.sk_bitmap);
+  EXPECT_EQ(result.sk_bitmap->dimensions(), SkISize::Make(60, 20));
+  // Nothing larger than the 1/8 scale decode is allocated.
+  EXPECT_LE(allocator->largest_buffer_size, 75u * 25u * 4u);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+TEST(ImageDecoderTest, YUVPlanesAreOnlyDecodedForUprightImages) {
+  // The planes of a rotated image would have to be rotated before they are
+  // converted, so the generator leaves such images to the RGBA decode.
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  SkBitmap::HeapAllocator allocator;
+  SkBitmap y_plane;
+  SkBitmap uv_plane;
+  EXPECT_FALSE(
+      generator->GetYUVPlanes(&allocator, &y_plane, &allocator, &uv_plane));
+  EXPECT_TRUE(y_plane.isNull());
+  EXPECT_TRUE(uv_plane.isNull());
+
+#if IMPELLER_SUPPORTS_RENDERING
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  auto impeller_allocator = std::make_shared<SizeRecordingAllocator>();
+  EXPECT_FALSE(ImageDecoderImpeller::DecompressYUVPlanes(
+                   descriptor.get(), SkISize::Make(600, 200), {2048, 2048},
+                   impeller_allocator)
+                   .has_value());
+  EXPECT_EQ(impeller_allocator->largest_buffer_size, 0u);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 TEST(ImageDecoderTest, ImagesWithTransparencyArePremulAlpha) {
   auto data = flutter::testing::OpenFixtureAsSkData("heart_end.png");
   ASSERT_TRUE(data);
@@ -1044,6 +1303,131 @@ TEST_F(ImageDecoderFixtureTest,
   PostTaskSync(runners.GetIOTaskRunner(), [&]() { io_manager.reset(); });
 }
 
+/// An image generator that records the frames it decodes.
+class FrameRecordingImageGenerator : public ImageGenerator {
+ public:
+  explicit FrameRecordingImageGenerator(
+      std::shared_ptr<ImageGenerator> generator)
+      : generator_(std::move(generator)) {}
+  ~FrameRecordingImageGenerator() = default;
+  const SkImageInfo& GetInfo() { return generator_->GetInfo(); }
+
+  unsigned int GetFrameCount() const { return generator_->GetFrameCount(); }
+
+  unsigned int GetPlayCount() const { return generator_->GetPlayCount(); }
+
+  const ImageGenerator::FrameInfo GetFrameInfo(unsigned int frame_index) {
+    return generator_->GetFrameInfo(frame_index);
+  }
+
+  SkISize GetScaledDimensions(float scale) {
+    return generator_->GetScaledDimensions(scale);
+  }
+
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) {
+    decoded_frames_.push_back(frame_index);
+    return generator_->GetPixels(info, pixels, row_bytes, frame_index,
+                                 prior_frame);
+  };
+
+  // Only accessed on the IO thread.
+  std::vector<unsigned int> decoded_frames_;
+
+ private:
+  std::shared_ptr<ImageGenerator> generator_;
+};
+
+TEST_F(ImageDecoderFixtureTest, MultiFrameCodecDecodesTheNextFrameAhead) {
+  auto settings = CreateSettingsForFixture();
+  auto vm_ref = DartVMRef::Create(settings);
+  auto vm_data = vm_ref.GetVMData();
+
+  auto gif_mapping = flutter::testing::OpenFixtureAsSkData("hello_loop_2.gif");
+
+  ASSERT_TRUE(gif_mapping);
+
+  ImageGeneratorRegistry registry;
+  auto generator = std::make_shared<FrameRecordingImageGenerator>(
+      registry.CreateCompatibleGenerator(gif_mapping));
+  const unsigned int frame_count = generator->GetFrameCount();
+  ASSERT_GT(frame_count, 1u);
+
+  TaskRunners runners(GetCurrentTestName(),         // label
+                      CreateNewThread("platform"),  // platform
+                      CreateNewThread("raster"),    // raster
+                      CreateNewThread("ui"),        // ui
+                      CreateNewThread("io")         // io
+  );
+
+  std::unique_ptr<TestIOManager> io_manager;
+  fml::RefPtr<MultiFrameCodec> codec;
+  fml::AutoResetWaitableEvent latch;
+
+  auto validate_frame_callback = [&latch](Dart_NativeArguments args) {
+    EXPECT_FALSE(Dart_IsNull(Dart_GetNativeArgument(args, 0)));
+    latch.Signal();
+  };
+
+  AddNativeCallback("ValidateFrameCallback",
+                    CREATE_NATIVE_ENTRY(validate_frame_callback));
+  // Setup the IO manager.
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() {
+    io_manager = std::make_unique<TestIOManager>(runners.GetIOTaskRunner());
+  });
+
+  auto isolate = RunDartCodeInIsolate(vm_ref, settings, runners, "main", {},
+                                      GetDefaultKernelFilePath(),
+                                      io_manager->GetWeakIOManager());
+
+  auto get_next_frame = [&]() {
+    PostTaskSync(runners.GetUITaskRunner(), [&]() {
+      EXPECT_TRUE(isolate->RunInIsolateScope([&]() -> bool {
+        Dart_Handle library = Dart_RootLibrary();
+        if (Dart_IsError(library)) {
+          return false;
+        }
+        Dart_Handle closure =
+            Dart_GetField(library, Dart_NewStringFromCString("frameCallback"));
+        if (Dart_IsError(closure) || !Dart_IsClosure(closure)) {
+          return false;
+        }
+        if (!codec) {
+          codec = fml::MakeRefCounted<MultiFrameCodec>(generator);
+        }
+        codec->getNextFrame(closure);
+        return true;
+      }));
+    });
+    latch.Wait();
+  };
+
+  get_next_frame();
+  // The frame after the one returned has been decoded as well.
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() {
+    EXPECT_EQ(generator->decoded_frames_, std::vector<unsigned int>({0u, 1u}));
+  });
+
+  get_next_frame();
+  // The second frame was returned without being decoded again.
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() {
+    EXPECT_EQ(generator->decoded_frames_,
+              std::vector<unsigned int>({0u, 1u, 2u % frame_count}));
+  });
+
+  // Destroy the Isolate
+  isolate = nullptr;
+
+  // Destroy the MultiFrameCodec
+  PostTaskSync(runners.GetUITaskRunner(), [&]() { codec = nullptr; });
+
+  // Destroy the IO manager
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() { io_manager.reset(); });
+}
+
 }  // namespace testing
 }  // namespace flutter
 
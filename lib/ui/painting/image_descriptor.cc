@@ -131,4 +131,20 @@ bool ImageDescriptor::get_pixels(const SkPixmap& pixmap) const {
                                pixmap.rowBytes());
 }
 
+sk_sp<DlImage> ImageDescriptor::get_texture(
+    const SkImageInfo& info,
+    const std::shared_ptr<impeller::Context>& context) const {
+  FML_DCHECK(generator_);
+  return generator_->GetTexture(info, context);
+}
+
+bool ImageDescriptor::get_yuv_planes(SkBitmap::Allocator* y_allocator,
+                                     SkBitmap* y_plane,
+                                     SkBitmap::Allocator* uv_allocator,
+                                     SkBitmap* uv_plane) const {
+  FML_DCHECK(generator_);
+  return generator_->GetYUVPlanes(y_allocator, y_plane, uv_allocator,
+                                  uv_plane);
+}
+
 }  // namespace flutter
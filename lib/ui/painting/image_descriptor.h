@@ -110,6 +110,21 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
 
+  /// @brief  Decodes this image straight into a texture, if backed by an
+  ///         `ImageGenerator` that can.
+  /// @see    `ImageGenerator::GetTexture`
+  sk_sp<DlImage> get_texture(
+      const SkImageInfo& info,
+      const std::shared_ptr<impeller::Context>& context) const;
+
+  /// @brief  Decodes the luma and chroma planes of this image, if backed by
+  ///         an `ImageGenerator` that can.
+  /// @see    `ImageGenerator::GetYUVPlanes`
+  bool get_yuv_planes(SkBitmap::Allocator* y_allocator,
+                      SkBitmap* y_plane,
+                      SkBitmap::Allocator* uv_allocator,
+                      SkBitmap* uv_plane) const;
+
   void dispose() {
     buffer_.reset();
     generator_.reset();
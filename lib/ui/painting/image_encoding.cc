@@ -78,6 +78,17 @@ sk_sp<SkData> CopyImageByteData(const sk_sp<SkImage>& raster_image,
 
   // The color types already match. No need to swizzle. Return early.
   if (pixmap.colorType() == color_type && pixmap.alphaType() == alpha_type) {
+    // Images read back for this request alone are not referenced by anything
+    // else, so their tightly packed pixels are handed to the data as is.
+    if (raster_image->unique() &&
+        pixmap.rowBytes() == pixmap.info().minRowBytes()) {
+      return SkData::MakeWithProc(
+          pixmap.addr(), pixmap.computeByteSize(),
+          [](const void* ptr, void* context) {
+            static_cast<SkImage*>(context)->unref();
+          },
+          sk_sp<SkImage>(raster_image).release());
+    }
     return SkData::MakeWithCopy(pixmap.addr(), pixmap.computeByteSize());
   }
 
@@ -108,6 +119,7 @@ void EncodeImageAndInvokeDataCallback(
     const fml::RefPtr<fml::TaskRunner>& ui_task_runner,
     const fml::RefPtr<fml::TaskRunner>& raster_task_runner,
     const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner,
     const fml::WeakPtr<GrDirectContext>& resource_context,
     const fml::TaskRunnerAffineWeakPtr<SnapshotDelegate>& snapshot_delegate,
     const std::shared_ptr<const fml::SyncSwitch>& is_gpu_disabled_sync_switch,
@@ -122,14 +134,28 @@ void EncodeImageAndInvokeDataCallback(
   // EncodeImage.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   auto encode_task =
-      [callback_task = std::move(callback_task), format,
-       ui_task_runner](const fml::StatusOr<sk_sp<SkImage>>& raster_image) {
+      [callback_task = std::move(callback_task), format, ui_task_runner,
+       concurrent_task_runner](
+          const fml::StatusOr<sk_sp<SkImage>>& raster_image) {
         if (raster_image.ok()) {
-          sk_sp<SkData> encoded = EncodeImage(raster_image.value(), format);
-          ui_task_runner->PostTask([callback_task = callback_task,
-                                    encoded = std::move(encoded)]() mutable {
-            callback_task(std::move(encoded));
-          });
+          auto invoke_callback = [callback_task,
+                                  ui_task_runner](sk_sp<SkData> encoded) {
+            ui_task_runner->PostTask([callback_task = callback_task,
+                                      encoded = std::move(encoded)]() mutable {
+              callback_task(std::move(encoded));
+            });
+          };
+          // Compressing a large image takes long enough to hold up the other
+          // work on the thread that read it back, while the raw formats are
+          // at most a copy.
+          if (format == kPNG && concurrent_task_runner) {
+            concurrent_task_runner->PostTask(
+                [invoke_callback, image = raster_image.value()]() {
+                  invoke_callback(EncodeImage(image, kPNG));
+                });
+          } else {
+            invoke_callback(EncodeImage(raster_image.value(), format));
+          }
         } else {
           ui_task_runner->PostTask([callback_task = callback_task,
                                     raster_image = raster_image]() mutable {
@@ -179,13 +205,15 @@ Dart_Handle EncodeImage(CanvasImage* canvas_image,
        image_format, ui_task_runner = task_runners.GetUITaskRunner(),
        raster_task_runner = task_runners.GetRasterTaskRunner(),
        io_task_runner = task_runners.GetIOTaskRunner(),
+       concurrent_task_runner =
+           UIDartState::Current()->GetConcurrentTaskRunner(),
        io_manager = UIDartState::Current()->GetIOManager(),
        snapshot_delegate = UIDartState::Current()->GetSnapshotDelegate(),
        is_impeller_enabled =
            UIDartState::Current()->IsImpellerEnabled()]() mutable {
         EncodeImageAndInvokeDataCallback(
             image, std::move(callback), image_format, ui_task_runner,
-            raster_task_runner, io_task_runner,
+            raster_task_runner, io_task_runner, concurrent_task_runner,
             io_manager->GetResourceContext(), snapshot_delegate,
             io_manager->GetIsGpuDisabledSyncSwitch(),
             io_manager->GetImpellerContext(), is_impeller_enabled);
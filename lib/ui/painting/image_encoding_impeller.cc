@@ -174,8 +174,9 @@ void ImageEncodingImpeller::ConvertDlImageToSkImage(
       encode_task(fml::Status(fml::StatusCode::kUnknown, ""));
       return;
     }
-    auto sk_image = ConvertBufferToSkImage(buffer, color_type, dimensions);
-    encode_task(sk_image);
+    // The image is handed off rather than copied so that the encoder can tell
+    // it holds the only reference to the pixels.
+    encode_task(ConvertBufferToSkImage(buffer, color_type, dimensions));
   };
 
   if (!command_buffer->SubmitCommands(completion)) {
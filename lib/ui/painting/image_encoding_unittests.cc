@@ -189,6 +189,28 @@ TEST_F(ShellTest, EncodeImageAccessesSyncSwitch) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST(ImageEncodingTest, RawEncodingOfUnsharedImageDoesNotCopy) {
+  SkImageInfo info = SkImageInfo::Make(10, 10, kRGBA_8888_SkColorType,
+                                       kPremul_SkAlphaType);
+  sk_sp<SkImage> image = SkImages::RasterFromData(
+      info, SkData::MakeZeroInitialized(info.computeMinByteSize()),
+      info.minRowBytes());
+  ASSERT_TRUE(image);
+  SkPixmap pixmap;
+  ASSERT_TRUE(image->peekPixels(&pixmap));
+
+  sk_sp<SkData> shared = EncodeImage(image, ImageByteFormat::kRawRGBA);
+  ASSERT_TRUE(shared);
+  EXPECT_EQ(shared->data(), pixmap.addr());
+  EXPECT_EQ(shared->size(), info.computeMinByteSize());
+
+  // Now that the data references the image too, encoding it again copies.
+  sk_sp<SkData> copied = EncodeImage(image, ImageByteFormat::kRawRGBA);
+  ASSERT_TRUE(copied);
+  EXPECT_NE(copied->data(), pixmap.addr());
+  EXPECT_TRUE(copied->equals(shared.get()));
+}
+
 #if IMPELLER_SUPPORTS_RENDERING
 using ::impeller::testing::MockAllocator;
 using ::impeller::testing::MockBlitPass;
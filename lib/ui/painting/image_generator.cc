@@ -11,11 +11,25 @@
 #include "third_party/skia/include/codec/SkPixmapUtils.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 
 namespace flutter {
 
 ImageGenerator::~ImageGenerator() = default;
 
+sk_sp<DlImage> ImageGenerator::GetTexture(
+    const SkImageInfo& info,
+    const std::shared_ptr<impeller::Context>& context) {
+  return nullptr;
+}
+
+bool ImageGenerator::GetYUVPlanes(SkBitmap::Allocator* y_allocator,
+                                  SkBitmap* y_plane,
+                                  SkBitmap::Allocator* uv_allocator,
+                                  SkBitmap* uv_plane) {
+  return false;
+}
+
 sk_sp<SkImage> ImageGenerator::GetImage() {
   SkImageInfo info = GetInfo();
 
@@ -135,6 +149,24 @@ const ImageGenerator::FrameInfo BuiltinSkiaCodecImageGenerator::GetFrameInfo(
 SkISize BuiltinSkiaCodecImageGenerator::GetScaledDimensions(
     float desired_scale) {
   SkISize size = codec_->getScaledDimensions(desired_scale);
+  if (size == codec_->dimensions() && codec_->getFrameCount() == 1) {
+    // Codecs that scale while decoding to any size, such as WebP, do not
+    // report scaled dimensions. Offer them the same 1/2, 1/4 and 1/8 steps
+    // that JPEG decodes to, picking the smallest one that is still at least
+    // as large as the desired size.
+    for (int denominator = 8; denominator >= 2; denominator /= 2) {
+      if (desired_scale > 1.0f / denominator) {
+        continue;
+      }
+      SkISize scaled = SkISize::Make(
+          (size.width() + denominator - 1) / denominator,
+          (size.height() + denominator - 1) / denominator);
+      if (codec_->dimensionsSupported(scaled)) {
+        size = scaled;
+        break;
+      }
+    }
+  }
   if (SkEncodedOriginSwapsWidthHeight(codec_->getOrigin())) {
     std::swap(size.fWidth, size.fHeight);
   }
@@ -188,6 +220,72 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return SkPixmapUtils::Orient(output_pixmap, temp_pixmap, origin);
 }
 
+bool BuiltinSkiaCodecImageGenerator::GetYUVPlanes(
+    SkBitmap::Allocator* y_allocator,
+    SkBitmap* y_plane,
+    SkBitmap::Allocator* uv_allocator,
+    SkBitmap* uv_plane) {
+  // Planes decoded from images with a color profile could not be color
+  // managed, and those of rotated images would have to be rotated too.
+  if (codec_->getFrameCount() != 1 || codec_->getICCProfile() ||
+      codec_->getOrigin() != kTopLeft_SkEncodedOrigin) {
+    return false;
+  }
+  SkYUVAPixmapInfo pixmap_info;
+  if (!codec_->queryYUVAInfo(SkYUVAPixmapInfo::SupportedDataTypes::All(),
+                             &pixmap_info) ||
+      pixmap_info.dataType() != SkYUVAPixmapInfo::DataType::kUnorm8) {
+    return false;
+  }
+  const SkYUVAInfo& yuva_info = pixmap_info.yuvaInfo();
+  if (yuva_info.planeConfig() != SkYUVAInfo::PlaneConfig::kY_U_V ||
+      yuva_info.subsampling() != SkYUVAInfo::Subsampling::k420 ||
+      yuva_info.yuvColorSpace() != kJPEG_Full_SkYUVColorSpace ||
+      yuva_info.origin() != kTopLeft_SkEncodedOrigin ||
+      yuva_info.dimensions() != codec_->dimensions()) {
+    return false;
+  }
+
+  SkISize plane_sizes[SkYUVAInfo::kMaxPlanes];
+  if (yuva_info.planeDimensions(plane_sizes) != 3) {
+    return false;
+  }
+  SkBitmap u_plane;
+  SkBitmap v_plane;
+  y_plane->setInfo(SkImageInfo::Make(plane_sizes[0], kGray_8_SkColorType,
+                                     kOpaque_SkAlphaType));
+  if (!y_plane->tryAllocPixels(y_allocator) ||
+      !u_plane.tryAllocPixels(SkImageInfo::Make(
+          plane_sizes[1], kGray_8_SkColorType, kOpaque_SkAlphaType)) ||
+      !v_plane.tryAllocPixels(SkImageInfo::Make(
+          plane_sizes[2], kGray_8_SkColorType, kOpaque_SkAlphaType))) {
+    return false;
+  }
+  const SkPixmap plane_pixmaps[SkYUVAInfo::kMaxPlanes] = {
+      y_plane->pixmap(), u_plane.pixmap(), v_plane.pixmap()};
+  auto pixmaps = SkYUVAPixmaps::FromExternalPixmaps(yuva_info, plane_pixmaps);
+  if (!pixmaps.isValid() ||
+      codec_->getYUVAPlanes(pixmaps) != SkCodec::Result::kSuccess) {
+    return false;
+  }
+
+  uv_plane->setInfo(SkImageInfo::Make(plane_sizes[1], kR8G8_unorm_SkColorType,
+                                      kOpaque_SkAlphaType));
+  if (!uv_plane->tryAllocPixels(uv_allocator)) {
+    return false;
+  }
+  for (int y = 0; y < plane_sizes[1].height(); y++) {
+    const uint8_t* u_row = u_plane.getAddr8(0, y);
+    const uint8_t* v_row = v_plane.getAddr8(0, y);
+    uint8_t* uv_row = static_cast<uint8_t*>(uv_plane->getAddr(0, y));
+    for (int x = 0; x < plane_sizes[1].width(); x++) {
+      uv_row[2 * x] = u_row[x];
+      uv_row[2 * x + 1] = v_row[x];
+    }
+  }
+  return true;
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
   auto codec = SkCodec::MakeFromData(std::move(data));
@@ -5,16 +5,24 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_H_
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_H_
 
+#include <memory>
 #include <optional>
+
+#include "flutter/display_list/image/dl_image.h"
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/codec/SkCodec.h"
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkImageGenerator.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkSize.h"
 
+namespace impeller {
+class Context;
+}  // namespace impeller
+
 namespace flutter {
 
 /// @brief  The minimal interface necessary for defining a decoder that can be
@@ -135,6 +143,47 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief      Decode the first frame of the image straight into an Impeller
+  ///             texture. Generators backed by a hardware decoder that writes
+  ///             into memory the GPU can import (such as an `AHardwareBuffer`
+  ///             or an `IOSurface`) can implement this to wrap the decoded
+  ///             image without copying it through a staging buffer.
+  /// @param[in]  info     The size and color info of the texture, chosen the
+  ///                      same way as for `GetPixels`.
+  /// @param[in]  context  The Impeller context to create the texture with.
+  /// @return     The decoded image, or null if this generator cannot decode
+  ///             the image to a texture of exactly this size, in which case
+  ///             the image is decoded with `GetPixels` instead. The default
+  ///             implementation always returns null.
+  /// @note       This method is called on a concurrent worker thread, and only
+  ///             while GPU access is enabled.
+  /// @see        `GetPixels`
+  virtual sk_sp<DlImage> GetTexture(
+      const SkImageInfo& info,
+      const std::shared_ptr<impeller::Context>& context);
+
+  /// @brief      Decode the first frame of the image at its full size into
+  ///             separate luma and chroma planes, skipping the conversion to
+  ///             RGB. The planes use 4:2:0 subsampling and full range BT.601
+  ///             coefficients, the way baseline JPEGs are encoded.
+  /// @param[in]  y_allocator   The allocator to allocate `y_plane` with.
+  /// @param[out] y_plane       The luma plane, as `kGray_8_SkColorType`
+  ///                           pixels at the size of the image.
+  /// @param[in]  uv_allocator  The allocator to allocate `uv_plane` with.
+  /// @param[out] uv_plane      The interleaved chroma planes, as
+  ///                           `kR8G8_unorm_SkColorType` pixels at half the
+  ///                           size of the image, rounded up.
+  /// @return     True if the planes were decoded. Images that are not stored
+  ///             this way, or that carry an orientation or a color profile,
+  ///             are decoded with `GetPixels` instead. The default
+  ///             implementation always returns false.
+  /// @note       This method is called on a concurrent worker thread.
+  /// @see        `GetPixels`
+  virtual bool GetYUVPlanes(SkBitmap::Allocator* y_allocator,
+                            SkBitmap* y_plane,
+                            SkBitmap::Allocator* uv_allocator,
+                            SkBitmap* uv_plane);
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -212,6 +261,12 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool GetYUVPlanes(SkBitmap::Allocator* y_allocator,
+                    SkBitmap* y_plane,
+                    SkBitmap::Allocator* uv_allocator,
+                    SkBitmap* uv_plane) override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
 #include "flutter/lib/ui/painting/image.h"
 #if IMPELLER_SUPPORTS_RENDERING
@@ -181,6 +182,37 @@ MultiFrameCodec::State::GetNextFrameImage(
                         std::string());
 }
 
+MultiFrameCodec::State::DecodedFrame MultiFrameCodec::State::DecodeNextFrame(
+    fml::WeakPtr<GrDirectContext> resourceContext,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+    const std::shared_ptr<impeller::Context>& impeller_context,
+    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
+  DecodedFrame frame;
+  std::tie(frame.image, frame.decode_error) =
+      GetNextFrameImage(std::move(resourceContext), gpu_disable_sync_switch,
+                        impeller_context, std::move(unref_queue));
+  if (frame.image) {
+    frame.duration = generator_->GetFrameInfo(nextFrameIndex_).duration;
+  }
+  nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
+  return frame;
+}
+
+void MultiFrameCodec::State::PrefetchNextFrame(
+    fml::WeakPtr<GrDirectContext> resourceContext,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+    const std::shared_ptr<impeller::Context>& impeller_context,
+    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
+  // A single frame would be decoded again for nothing.
+  if (prefetchedFrame_.has_value() || frameCount_ < 2) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "MultiFrameCodec::PrefetchNextFrame");
+  prefetchedFrame_ =
+      DecodeNextFrame(std::move(resourceContext), gpu_disable_sync_switch,
+                      impeller_context, std::move(unref_queue));
+}
+
 void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     std::unique_ptr<tonic::DartPersistentValue> callback,
     const fml::RefPtr<fml::TaskRunner>& ui_task_runner,
@@ -189,21 +221,22 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
     size_t trace_id,
     const std::shared_ptr<impeller::Context>& impeller_context) {
+  DecodedFrame frame;
+  if (prefetchedFrame_.has_value()) {
+    frame = std::move(prefetchedFrame_.value());
+    prefetchedFrame_.reset();
+  } else {
+    frame = DecodeNextFrame(std::move(resourceContext), gpu_disable_sync_switch,
+                            impeller_context, std::move(unref_queue));
+  }
   fml::RefPtr<CanvasImage> image = nullptr;
   int duration = 0;
-  sk_sp<DlImage> dlImage;
-  std::string decode_error;
-  std::tie(dlImage, decode_error) =
-      GetNextFrameImage(std::move(resourceContext), gpu_disable_sync_switch,
-                        impeller_context, std::move(unref_queue));
-  if (dlImage) {
+  std::string decode_error = std::move(frame.decode_error);
+  if (frame.image) {
     image = CanvasImage::Create();
-    image->set_image(dlImage);
-    ImageGenerator::FrameInfo frameInfo =
-        generator_->GetFrameInfo(nextFrameIndex_);
-    duration = frameInfo.duration;
+    image->set_image(std::move(frame.image));
+    duration = frame.duration;
   }
-  nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
 
   // The static leak checker gets confused by the use of fml::MakeCopyable.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
@@ -258,6 +291,20 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
             io_manager->GetIsGpuDisabledSyncSwitch(), trace_id,
             io_manager->GetImpellerContext());
       }));
+  // Posted separately so that the frame asked for is returned before the one
+  // after it is decoded.
+  task_runners.GetIOTaskRunner()->PostTask(
+      [weak_state = std::weak_ptr<MultiFrameCodec::State>(state_),
+       io_manager = dart_state->GetIOManager()]() {
+        auto state = weak_state.lock();
+        if (!state || !io_manager) {
+          return;
+        }
+        state->PrefetchNextFrame(io_manager->GetResourceContext(),
+                                 io_manager->GetIsGpuDisabledSyncSwitch(),
+                                 io_manager->GetImpellerContext(),
+                                 io_manager->GetSkiaUnrefQueue());
+      });
 
   return Dart_Null();
   // The static leak checker gets confused by the control flow, unique
@@ -59,6 +59,17 @@ class MultiFrameCodec : public Codec {
     // method was kRestoreBGColor.
     std::optional<SkIRect> restoreBGColorRect_;
 
+    struct DecodedFrame {
+      sk_sp<DlImage> image;
+      std::string decode_error;
+      int duration = 0;
+    };
+
+    // The frame at |nextFrameIndex_|, if it was decoded before it was asked
+    // for. Animations ask for the next frame only once they show the current
+    // one, so decoding a frame ahead keeps the decode off the critical path.
+    std::optional<DecodedFrame> prefetchedFrame_;
+
     std::pair<sk_sp<DlImage>, std::string> GetNextFrameImage(
         fml::WeakPtr<GrDirectContext> resourceContext,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
@@ -73,6 +84,21 @@ class MultiFrameCodec : public Codec {
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
         size_t trace_id,
         const std::shared_ptr<impeller::Context>& impeller_context);
+
+    // Decodes the frame at |nextFrameIndex_| and moves on to the one after.
+    DecodedFrame DecodeNextFrame(
+        fml::WeakPtr<GrDirectContext> resourceContext,
+        const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+        const std::shared_ptr<impeller::Context>& impeller_context,
+        fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue);
+
+    // Decodes the frame that the next call to |getNextFrame| will return, if
+    // it has not been decoded already.
+    void PrefetchNextFrame(
+        fml::WeakPtr<GrDirectContext> resourceContext,
+        const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+        const std::shared_ptr<impeller::Context>& impeller_context,
+        fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue);
   };
 
   // Shared across the UI and IO task runners.
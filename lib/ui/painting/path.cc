@@ -212,8 +212,9 @@ void CanvasPath::addRRect(const RRect& rrect) {
 }
 
 void CanvasPath::addPath(CanvasPath* path, double dx, double dy) {
+  // This is a leaf call, so it can't throw. The Dart side only passes
+  // _NativePaths, which always have a native peer.
   if (!path) {
-    Dart_ThrowException(ToDart("Path.addPath called with non-genuine Path."));
     return;
   }
   mutable_path().addPath(path->path(), SafeNarrow(dx), SafeNarrow(dy),
@@ -243,9 +244,8 @@ void CanvasPath::addPathWithMatrix(CanvasPath* path,
 }
 
 void CanvasPath::extendWithPath(CanvasPath* path, double dx, double dy) {
+  // This is a leaf call, so it can't throw. See |addPath|.
   if (!path) {
-    Dart_ThrowException(
-        ToDart("Path.extendWithPath called with non-genuine Path."));
     return;
   }
   mutable_path().addPath(path->path(), SafeNarrow(dx), SafeNarrow(dy),
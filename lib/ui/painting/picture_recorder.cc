@@ -4,8 +4,12 @@
 
 #include "flutter/lib/ui/painting/picture_recorder.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "flutter/lib/ui/painting/canvas.h"
 #include "flutter/lib/ui/painting/picture.h"
+#include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
@@ -15,6 +19,22 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, PictureRecorder);
 
+namespace {
+
+// The op bytes of the most recently ended recording, used to size the
+// storage of the next one. Successive pictures of a frame tend to be of
+// similar size, and |DisplayListBuilder::Build| releases any unused room.
+std::atomic<size_t> last_recording_bytes = 0;
+
+// Recordings larger than this don't reserve more than this up front.
+constexpr size_t kMaxReservedRecordingBytes = 64 * 1024;
+
+// Recordings are sealed into chunks of at least this many op bytes, which
+// the raster thread prepares while the rest of the picture is recorded.
+constexpr size_t kMinRecordingChunkBytes = 256 * 1024;
+
+}  // namespace
+
 void PictureRecorder::Create(Dart_Handle wrapper) {
   UIDartState::ThrowIfUIOperationsProhibited();
   auto res = fml::MakeRefCounted<PictureRecorder>();
@@ -28,6 +48,19 @@ PictureRecorder::~PictureRecorder() {}
 sk_sp<DisplayListBuilder> PictureRecorder::BeginRecording(SkRect bounds) {
   display_list_builder_ =
       sk_make_sp<DisplayListBuilder>(bounds, /*prepare_rtree=*/true);
+  display_list_builder_->ReserveBytes(
+      std::min(last_recording_bytes.load(std::memory_order_relaxed),
+               kMaxReservedRecordingBytes));
+  // For huge pictures, like map tiles or document pages, this builds the
+  // rtree of each chunk on the raster thread while the rest of the picture
+  // is recorded, rather than for the whole picture once it is first culled.
+  auto raster_task_runner =
+      UIDartState::Current()->GetTaskRunners().GetRasterTaskRunner();
+  display_list_builder_->SetChunkCallback(
+      kMinRecordingChunkBytes,
+      [raster_task_runner](const sk_sp<DisplayList>& chunk) {
+        raster_task_runner->PostTask([chunk]() { chunk->rtree(); });
+      });
   return display_list_builder_;
 }
 
@@ -38,6 +71,13 @@ void PictureRecorder::endRecording(Dart_Handle dart_picture) {
 
   auto display_list = display_list_builder_->Build();
   display_list_builder_ = nullptr;
+  last_recording_bytes.store(display_list->bytes(false),
+                             std::memory_order_relaxed);
+
+  // Lists often record the same small picture for each of their items, so
+  // share a single DisplayList between all of the recordings of it.
+  display_list = UIDartState::Current()->GetDisplayListInterner().Intern(
+      std::move(display_list));
 
   FML_DCHECK(display_list->has_rtree());
   Picture::CreateAndAssociateWithDartWrapper(dart_picture, display_list);
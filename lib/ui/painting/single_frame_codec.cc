@@ -68,8 +68,7 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
   fml::RefPtr<SingleFrameCodec>* raw_codec_ref =
       new fml::RefPtr<SingleFrameCodec>(this);
 
-  decoder->Decode(
-      descriptor_, target_width_, target_height_,
+  ImageDecoder::ImageResult on_decoded =
       [raw_codec_ref](auto image, auto decode_error) {
         std::unique_ptr<fml::RefPtr<SingleFrameCodec>> codec_ref(raw_codec_ref);
         fml::RefPtr<SingleFrameCodec> codec(std::move(*codec_ref));
@@ -104,7 +103,32 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
                              tonic::ToDart(0), tonic::ToDart(decode_error)});
         }
         codec->pending_callbacks_.clear();
-      });
+      };
+
+  const auto& cache = decoder->GetDecodedImageCache();
+  sk_sp<SkData> encoded = descriptor_->data();
+  if (cache && descriptor_->is_compressed() && encoded) {
+    auto key = DecodedImageCache::MakeKey(*encoded, target_width_,
+                                          target_height_);
+    if (auto image = cache->Get(key, *encoded)) {
+      // Still complete asynchronously, the way a decode would.
+      dart_state->GetTaskRunners().GetUITaskRunner()->PostTask(
+          [on_decoded, image = std::move(image)]() {
+            on_decoded(image, std::string());
+          });
+    } else {
+      decoder->Decode(descriptor_, target_width_, target_height_,
+                      [on_decoded, cache, key, encoded = std::move(encoded)](
+                          auto image, auto decode_error) {
+                        if (image) {
+                          cache->Put(key, encoded, image);
+                        }
+                        on_decoded(std::move(image), std::move(decode_error));
+                      });
+    }
+  } else {
+    decoder->Decode(descriptor_, target_width_, target_height_, on_decoded);
+  }
 
   // The encoded data is no longer needed now that it has been handed off
   // to the decoder.
@@ -1702,13 +1702,22 @@ class FrameTiming {
   /// frame.
   Duration get vsyncOverhead => _rawDuration(FramePhase.buildStart) - _rawDuration(FramePhase.vsyncStart);
 
+  /// The duration between the end of the build and the start of the
+  /// rasterization, which the frame spent queued for the raster thread.
+  ///
+  /// This grows when the raster thread falls behind the UI thread, and is part
+  /// of the latency of the frame even if neither [buildDuration] nor
+  /// [rasterDuration] is long.
+  Duration get queueDuration => _rawDuration(FramePhase.rasterStart) - _rawDuration(FramePhase.buildFinish);
+
   /// The timespan between vsync start and raster finish.
   ///
   /// To achieve the lowest latency on an X fps display, this should not exceed
   /// 1000/X milliseconds.
   /// {@macro dart.ui.FrameTiming.fps_milliseconds}
   ///
-  /// See also [vsyncOverhead], [buildDuration] and [rasterDuration].
+  /// See also [vsyncOverhead], [buildDuration], [queueDuration] and
+  /// [rasterDuration].
   Duration get totalSpan => _rawDuration(FramePhase.rasterFinish) - _rawDuration(FramePhase.vsyncStart);
 
   /// The number of layers stored in the raster cache during the frame.
@@ -2992,6 +2992,18 @@ abstract class Paragraph {
   /// The [ParagraphConstraints] control how wide the text is allowed to be.
   void layout(ParagraphConstraints constraints);
 
+  /// Computes the size and position of each glyph in the paragraph without
+  /// blocking the UI thread.
+  ///
+  /// Shaping happens on a background thread, which allows long paragraphs to
+  /// be laid out ahead of time, for example while scrolling. Once the returned
+  /// future completes, the paragraph behaves as if [layout] had been called
+  /// with the same constraints.
+  ///
+  /// The paragraph must not be laid out, painted, queried or disposed until
+  /// the returned future completes.
+  Future<void> layoutAsync(ParagraphConstraints constraints);
+
   /// Returns a list of text boxes that enclose the given text range.
   ///
   /// The [boxHeightStyle] and [boxWidthStyle] parameters allow customization
@@ -3149,6 +3161,7 @@ base class _NativeParagraph extends NativeFieldWrapperClass1 implements Paragrap
 
   @override
   void layout(ParagraphConstraints constraints) {
+    assert(!_layoutPending, 'Paragraph.layout called while Paragraph.layoutAsync is in progress.');
     _layout(constraints.width);
     assert(() {
       _needsLayout = false;
@@ -3158,6 +3171,31 @@ base class _NativeParagraph extends NativeFieldWrapperClass1 implements Paragrap
   @Native<Void Function(Pointer<Void>, Double)>(symbol: 'Paragraph::layout', isLeaf: true)
   external void _layout(double width);
 
+  bool _layoutPending = false;
+
+  @override
+  Future<void> layoutAsync(ParagraphConstraints constraints) {
+    assert(!_layoutPending, 'Paragraph.layoutAsync has already been called and not completed.');
+    final Future<void> result = _futurize((_Callback<void> callback) {
+      return _layoutAsync(constraints.width, callback);
+    });
+    _layoutPending = true;
+    assert(() {
+      _needsLayout = true;
+      return true;
+    }());
+    return result.whenComplete(() {
+      _layoutPending = false;
+      assert(() {
+        _needsLayout = false;
+        return true;
+      }());
+    });
+  }
+
+  @Native<Handle Function(Pointer<Void>, Double, Handle)>(symbol: 'Paragraph::layoutAsync')
+  external String? _layoutAsync(double width, _Callback<void> callback);
+
   List<TextBox> _decodeTextBoxes(Float32List encoded) {
     final int count = encoded.length ~/ 5;
     final List<TextBox> boxes = <TextBox>[];
@@ -3254,7 +3292,7 @@ base class _NativeParagraph extends NativeFieldWrapperClass1 implements Paragrap
   // Redirecting the paint function in this way solves some dependency problems
   // in the C++ code. If we straighten out the C++ dependencies, we can remove
   // this indirection.
-  @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double)>(symbol: 'Paragraph::paint')
+  @Native<Void Function(Pointer<Void>, Pointer<Void>, Double, Double)>(symbol: 'Paragraph::paint', isLeaf: true)
   external void _paint(_NativeCanvas canvas, double x, double y);
 
   @override
@@ -3288,7 +3326,7 @@ base class _NativeParagraph extends NativeFieldWrapperClass1 implements Paragrap
   external LineMetrics? _getLineMetricsAt(int lineNumber, Function constructor);
 
   @override
-  @Native<Uint32 Function(Pointer<Void>)>(symbol: 'Paragraph::getNumberOfLines')
+  @Native<Uint32 Function(Pointer<Void>)>(symbol: 'Paragraph::getNumberOfLines', isLeaf: true)
   external int get numberOfLines;
 
   @override
@@ -3296,12 +3334,13 @@ base class _NativeParagraph extends NativeFieldWrapperClass1 implements Paragrap
     final int lineNumber = _getLineNumber(codeUnitOffset);
     return lineNumber < 0 ? null : lineNumber;
   }
-  @Native<Int32 Function(Pointer<Void>, Uint32)>(symbol: 'Paragraph::getLineNumberAt')
+  @Native<Int32 Function(Pointer<Void>, Uint32)>(symbol: 'Paragraph::getLineNumberAt', isLeaf: true)
   external int _getLineNumber(int codeUnitOffset);
 
   @override
   void dispose() {
     assert(!_disposed);
+    assert(!_layoutPending, 'Paragraph.dispose called while Paragraph.layoutAsync is in progress.');
     assert(() {
       _disposed = true;
       return true;
@@ -4,9 +4,12 @@
 
 #include "flutter/lib/ui/text/asset_manager_font_provider.h"
 
+#include <set>
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/tools/font-subset/font_subset.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkStream.h"
@@ -22,11 +25,38 @@ void MappingReleaseProc(const void* ptr, void* context) {
   delete reinterpret_cast<fml::Mapping*>(context);
 }
 
+void BlobReleaseProc(const void* ptr, void* context) {
+  hb_blob_destroy(reinterpret_cast<hb_blob_t*>(context));
+}
+
+// Returns a typeface with only the given glyphs of the font in |data|, or
+// nullptr if the font could not be subset.
+sk_sp<SkTypeface> MakeSubsetTypeface(const sk_sp<SkData>& data,
+                                     const std::set<uint16_t>& glyphs) {
+  HarfbuzzWrappers::HbBlobPtr font_blob(hb_blob_create(
+      reinterpret_cast<const char*>(data->data()), data->size(),
+      HB_MEMORY_MODE_READONLY, nullptr, nullptr));
+  HarfbuzzWrappers::HbBlobPtr subset_blob =
+      font_subset::SubsetFontToGlyphs(font_blob.get(), glyphs);
+  if (!subset_blob) {
+    return nullptr;
+  }
+
+  unsigned int subset_length = 0;
+  const char* subset_data =
+      hb_blob_get_data(subset_blob.get(), &subset_length);
+  sk_sp<SkData> subset = SkData::MakeWithProc(
+      subset_data, subset_length, BlobReleaseProc, subset_blob.release());
+  return txt::GetDefaultFontManager()->makeFromData(std::move(subset));
+}
+
 }  // anonymous namespace
 
 AssetManagerFontProvider::AssetManagerFontProvider(
-    std::shared_ptr<AssetManager> asset_manager)
-    : asset_manager_(std::move(asset_manager)) {}
+    std::shared_ptr<AssetManager> asset_manager,
+    std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage)
+    : asset_manager_(std::move(asset_manager)),
+      glyph_usage_(std::move(glyph_usage)) {}
 
 AssetManagerFontProvider::~AssetManagerFontProvider() = default;
 
@@ -51,8 +81,10 @@ sk_sp<SkFontStyleSet> AssetManagerFontProvider::MatchFamily(
   return found->second;
 }
 
-void AssetManagerFontProvider::RegisterAsset(const std::string& family_name,
-                                             const std::string& asset) {
+void AssetManagerFontProvider::RegisterAsset(
+    const std::string& family_name,
+    const std::string& asset,
+    std::optional<SkFontStyle> style) {
   std::string canonical_name = CanonicalFamilyName(family_name);
   auto family_it = registered_families_.find(canonical_name);
 
@@ -60,23 +92,28 @@ void AssetManagerFontProvider::RegisterAsset(const std::string& family_name,
     family_names_.push_back(family_name);
     auto value = std::make_pair(
         canonical_name,
-        sk_make_sp<AssetManagerFontStyleSet>(asset_manager_, family_name));
+        sk_make_sp<AssetManagerFontStyleSet>(asset_manager_, family_name,
+                                             glyph_usage_));
     family_it = registered_families_.emplace(value).first;
   }
 
-  family_it->second->registerAsset(asset);
+  family_it->second->registerAsset(asset, style);
 }
 
 AssetManagerFontStyleSet::AssetManagerFontStyleSet(
     std::shared_ptr<AssetManager> asset_manager,
-    std::string family_name)
+    std::string family_name,
+    std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage)
     : asset_manager_(std::move(asset_manager)),
-      family_name_(std::move(family_name)) {}
+      family_name_(std::move(family_name)),
+      glyph_usage_(std::move(glyph_usage)) {}
 
 AssetManagerFontStyleSet::~AssetManagerFontStyleSet() = default;
 
-void AssetManagerFontStyleSet::registerAsset(const std::string& asset) {
-  assets_.emplace_back(asset);
+void AssetManagerFontStyleSet::registerAsset(
+    const std::string& asset,
+    std::optional<SkFontStyle> style) {
+  assets_.emplace_back(asset, style);
 }
 
 int AssetManagerFontStyleSet::count() {
@@ -88,9 +125,16 @@ void AssetManagerFontStyleSet::getStyle(int index,
                                         SkString* name) {
   FML_DCHECK(index < static_cast<int>(assets_.size()));
   if (style) {
-    sk_sp<SkTypeface> typeface(createTypeface(index));
-    if (typeface) {
-      *style = typeface->fontStyle();
+    // Style matching queries every font in the family. Avoid loading fonts
+    // whose style was declared when they were registered.
+    const TypefaceAsset& asset = assets_[index];
+    if (asset.style.has_value()) {
+      *style = asset.style.value();
+    } else {
+      sk_sp<SkTypeface> typeface(createTypeface(index));
+      if (typeface) {
+        *style = typeface->fontStyle();
+      }
     }
   }
   if (name) {
@@ -106,6 +150,10 @@ auto AssetManagerFontStyleSet::createTypeface(int i) -> CreateTypefaceRet {
 
   TypefaceAsset& asset = assets_[index];
   if (!asset.typeface) {
+    TRACE_EVENT1("flutter", "AssetManagerFontStyleSet::createTypeface", "asset",
+                 asset.asset.c_str());
+    // The typeface reads font data directly out of the mapping. File backed
+    // and uncompressed APK assets are memory mapped rather than copied.
     std::unique_ptr<fml::Mapping> asset_mapping =
         asset_manager_->GetAsMapping(asset.asset);
     if (asset_mapping == nullptr) {
@@ -126,6 +174,21 @@ auto AssetManagerFontStyleSet::createTypeface(int i) -> CreateTypefaceRet {
                       << family_name_;
       return nullptr;
     }
+
+    // Glyph usage is recorded by the name the font gives its family, which
+    // may differ from the family it was registered under.
+    if (glyph_usage_) {
+      SkString font_family_name;
+      asset.typeface->getFamilyName(&font_family_name);
+      std::set<uint16_t> glyphs =
+          glyph_usage_->GetGlyphs(font_family_name.c_str());
+      if (!glyphs.empty()) {
+        TRACE_EVENT0("flutter", "SubsetFontAsset");
+        if (auto subset = MakeSubsetTypeface(asset_data, glyphs)) {
+          asset.typeface = std::move(subset);
+        }
+      }
+    }
   }
 
   return CreateTypefaceRet(SkRef(asset.typeface.get()));
@@ -136,8 +199,10 @@ auto AssetManagerFontStyleSet::matchStyle(const SkFontStyle& pattern)
   return matchStyleCSS3(pattern);
 }
 
-AssetManagerFontStyleSet::TypefaceAsset::TypefaceAsset(std::string a)
-    : asset(std::move(a)) {}
+AssetManagerFontStyleSet::TypefaceAsset::TypefaceAsset(
+    std::string a,
+    std::optional<SkFontStyle> s)
+    : asset(std::move(a)), style(s) {}
 
 AssetManagerFontStyleSet::TypefaceAsset::TypefaceAsset(
     const AssetManagerFontStyleSet::TypefaceAsset& other) = default;
@@ -6,12 +6,14 @@
 #define FLUTTER_LIB_UI_TEXT_ASSET_MANAGER_FONT_PROVIDER_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "flutter/assets/asset_manager.h"
 #include "flutter/fml/macros.h"
+#include "impeller/typographer/glyph_usage_log.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkTypeface.h"
 #include "txt/font_asset_provider.h"
@@ -20,12 +22,17 @@ namespace flutter {
 
 class AssetManagerFontStyleSet : public SkFontStyleSet {
  public:
-  AssetManagerFontStyleSet(std::shared_ptr<AssetManager> asset_manager,
-                           std::string family_name);
+  AssetManagerFontStyleSet(
+      std::shared_ptr<AssetManager> asset_manager,
+      std::string family_name,
+      std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage = nullptr);
 
   ~AssetManagerFontStyleSet() override;
 
-  void registerAsset(const std::string& asset);
+  // Registers a font asset in this family. When the style of the font is
+  // known ahead of time, style matching does not need to load the font.
+  void registerAsset(const std::string& asset,
+                     std::optional<SkFontStyle> style = std::nullopt);
 
   // |SkFontStyleSet|
   int count() override;
@@ -46,15 +53,17 @@ class AssetManagerFontStyleSet : public SkFontStyleSet {
  private:
   std::shared_ptr<AssetManager> asset_manager_;
   std::string family_name_;
+  std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage_;
 
   struct TypefaceAsset {
-    explicit TypefaceAsset(std::string a);
+    TypefaceAsset(std::string a, std::optional<SkFontStyle> s);
 
     TypefaceAsset(const TypefaceAsset& other);
 
     ~TypefaceAsset();
 
     std::string asset;
+    std::optional<SkFontStyle> style;
     sk_sp<SkTypeface> typeface;
   };
   std::vector<TypefaceAsset> assets_;
@@ -64,12 +73,21 @@ class AssetManagerFontStyleSet : public SkFontStyleSet {
 
 class AssetManagerFontProvider : public txt::FontAssetProvider {
  public:
+  // If |glyph_usage| is provided, fonts are subset to the glyphs it recorded
+  // for their family when they are loaded. Fonts without recorded glyphs are
+  // loaded in full.
   explicit AssetManagerFontProvider(
-      std::shared_ptr<AssetManager> asset_manager);
+      std::shared_ptr<AssetManager> asset_manager,
+      std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage = nullptr);
 
   ~AssetManagerFontProvider() override;
 
-  void RegisterAsset(const std::string& family_name, const std::string& asset);
+  // Registers a font asset. The typeface is only loaded from the asset
+  // manager the first time it is requested. If |style| is provided, it is
+  // used to match the font against requested styles without loading it.
+  void RegisterAsset(const std::string& family_name,
+                     const std::string& asset,
+                     std::optional<SkFontStyle> style = std::nullopt);
 
   // |FontAssetProvider|
   size_t GetFamilyCount() const override;
@@ -82,6 +100,7 @@ class AssetManagerFontProvider : public txt::FontAssetProvider {
 
  private:
   std::shared_ptr<AssetManager> asset_manager_;
+  std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage_;
   std::unordered_map<std::string, sk_sp<AssetManagerFontStyleSet>>
       registered_families_;
   std::vector<std::string> family_names_;
@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/text/asset_manager_font_provider.h"
+
+#include "flutter/assets/asset_manager.h"
+#include "flutter/assets/asset_resolver.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class CountingAssetResolver final : public AssetResolver {
+ public:
+  explicit CountingAssetResolver(std::shared_ptr<int> mapping_requests)
+      : mapping_requests_(std::move(mapping_requests)) {}
+
+  // |AssetResolver|
+  bool IsValid() const override { return true; }
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override { return true; }
+
+  // |AssetResolver|
+  AssetResolverType GetType() const override {
+    return AssetResolverType::kDirectoryAssetBundle;
+  }
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override {
+    (*mapping_requests_)++;
+    return nullptr;
+  }
+
+ private:
+  std::shared_ptr<int> mapping_requests_;
+};
+
+}  // namespace
+
+TEST(AssetManagerFontProviderTest, DeclaredStylesDoNotLoadFonts) {
+  auto mapping_requests = std::make_shared<int>(0);
+  auto asset_manager = std::make_shared<AssetManager>();
+  asset_manager->PushBack(
+      std::make_unique<CountingAssetResolver>(mapping_requests));
+
+  AssetManagerFontProvider font_provider(asset_manager);
+  font_provider.RegisterAsset("Noto", "fonts/Noto-Regular.otf",
+                              SkFontStyle::Normal());
+  font_provider.RegisterAsset("Noto", "fonts/Noto-Bold.otf",
+                              SkFontStyle::Bold());
+  font_provider.RegisterAsset("Noto", "fonts/Noto-Unknown.otf");
+  ASSERT_EQ(*mapping_requests, 0);
+
+  sk_sp<SkFontStyleSet> style_set = font_provider.MatchFamily("Noto");
+  ASSERT_TRUE(style_set);
+  ASSERT_EQ(style_set->count(), 3);
+
+  SkFontStyle style;
+  style_set->getStyle(1, &style, nullptr);
+  EXPECT_EQ(style.weight(), SkFontStyle::kBold_Weight);
+  EXPECT_EQ(*mapping_requests, 0);
+
+  // Fonts without a declared style are loaded to determine their style.
+  style_set->getStyle(2, &style, nullptr);
+  EXPECT_EQ(*mapping_requests, 1);
+}
+
+}  // namespace testing
+}  // namespace flutter
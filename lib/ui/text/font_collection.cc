@@ -5,6 +5,9 @@
 #include "flutter/lib/ui/text/font_collection.h"
 
 #include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
 
 #include "flutter/lib/ui/text/asset_manager_font_provider.h"
 #include "flutter/lib/ui/ui_dart_state.h"
@@ -30,6 +33,32 @@
 
 namespace flutter {
 
+namespace {
+
+constexpr char kGlyphUsageLogAssetName[] = "FontGlyphUsage.txt";
+
+// Returns the style declared for a font in the manifest, if any. Fonts without
+// a declared weight or style are loaded to determine their style.
+template <typename Value>
+std::optional<SkFontStyle> GetDeclaredFontStyle(const Value& family_font) {
+  auto weight = family_font.FindMember("weight");
+  auto style = family_font.FindMember("style");
+  bool has_weight = weight != family_font.MemberEnd() && weight->value.IsInt();
+  bool has_style = style != family_font.MemberEnd() && style->value.IsString();
+  if (!has_weight && !has_style) {
+    return std::nullopt;
+  }
+  int font_weight =
+      has_weight ? weight->value.GetInt() : SkFontStyle::kNormal_Weight;
+  SkFontStyle::Slant slant =
+      has_style && std::string(style->value.GetString()) == "italic"
+          ? SkFontStyle::kItalic_Slant
+          : SkFontStyle::kUpright_Slant;
+  return SkFontStyle(font_weight, SkFontStyle::kNormal_Width, slant);
+}
+
+}  // namespace
+
 FontCollection::FontCollection()
     : collection_(std::make_shared<txt::FontCollection>()) {
   dynamic_font_manager_ = sk_make_sp<txt::DynamicFontManager>();
@@ -93,8 +122,19 @@ void FontCollection::RegisterFonts(
     return;
   }
 
-  auto font_provider =
-      std::make_unique<AssetManagerFontProvider>(asset_manager);
+  // A glyph usage log recorded by the typographer in an earlier session may
+  // be bundled next to the manifest. Fonts are then subset to the glyphs that
+  // were used when they are loaded.
+  std::shared_ptr<const impeller::GlyphUsageLog> glyph_usage;
+  if (std::unique_ptr<fml::Mapping> glyph_usage_mapping =
+          asset_manager->GetAsMapping(kGlyphUsageLogAssetName)) {
+    glyph_usage = impeller::GlyphUsageLog::Parse(std::string_view(
+        reinterpret_cast<const char*>(glyph_usage_mapping->GetMapping()),
+        glyph_usage_mapping->GetSize()));
+  }
+
+  auto font_provider = std::make_unique<AssetManagerFontProvider>(
+      asset_manager, std::move(glyph_usage));
 
   for (const auto& family : document.GetArray()) {
     auto family_name = family.FindMember("family");
@@ -118,9 +158,9 @@ void FontCollection::RegisterFonts(
         continue;
       }
 
-      // TODO(chinmaygarde): Handle weights and styles.
       font_provider->RegisterAsset(family_name->value.GetString(),
-                                   font_asset->value.GetString());
+                                   font_asset->value.GetString(),
+                                   GetDeclaredFontStyle(family_font));
     }
   }
 
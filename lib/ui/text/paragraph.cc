@@ -4,10 +4,14 @@
 
 #include "flutter/lib/ui/text/paragraph.h"
 
+#include <mutex>
+
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "third_party/skia/modules/skparagraph/include/DartTypes.h"
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
@@ -15,12 +19,22 @@
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
 
 namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Paragraph);
 
+// Paragraphs share the typeface caches of their font collection, which are not
+// safe to use from multiple threads. Layouts on the UI thread and on workers
+// are serialized so that asynchronous layouts only ever contend with each
+// other or with a synchronous layout that happens at the same time.
+static std::mutex& GetLayoutMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
 Paragraph::Paragraph(std::unique_ptr<txt::Paragraph> paragraph)
     : m_paragraph_(std::move(paragraph)) {}
 
@@ -59,9 +73,52 @@ bool Paragraph::didExceedMaxLines() {
 }
 
 void Paragraph::layout(double width) {
+  std::scoped_lock lock(GetLayoutMutex());
   m_paragraph_->Layout(width);
 }
 
+Dart_Handle Paragraph::layoutAsync(double width, Dart_Handle callback_handle) {
+  UIDartState::ThrowIfUIOperationsProhibited();
+  if (!Dart_IsClosure(callback_handle)) {
+    return tonic::ToDart("Callback must be a function");
+  }
+  if (!m_paragraph_) {
+    return tonic::ToDart("Paragraph has been disposed");
+  }
+
+  auto* dart_state = UIDartState::Current();
+  auto ui_task_runner = dart_state->GetTaskRunners().GetUITaskRunner();
+  auto* callback_ptr =
+      new tonic::DartPersistentValue(dart_state, callback_handle);
+
+  // The UI task holds the last reference to the paragraph so that it is
+  // released on the UI thread.
+  auto ui_task = fml::MakeCopyable(
+      [callback_ptr, paragraph = fml::Ref(this)]() mutable {
+        std::unique_ptr<tonic::DartPersistentValue> callback(callback_ptr);
+        paragraph.reset();
+        auto dart_state = callback->dart_state().lock();
+        if (!dart_state) {
+          return;
+        }
+        tonic::DartState::Scope scope(dart_state);
+        tonic::DartInvoke(callback->Get(), {Dart_TypeVoid()});
+      });
+
+  dart_state->GetConcurrentTaskRunner()->PostTask(
+      [paragraph = this, width, ui_task_runner = std::move(ui_task_runner),
+       ui_task]() {
+        {
+          std::scoped_lock lock(GetLayoutMutex());
+          if (paragraph->m_paragraph_) {
+            paragraph->m_paragraph_->Layout(width);
+          }
+        }
+        ui_task_runner->PostTask(ui_task);
+      });
+  return Dart_Null();
+}
+
 void Paragraph::paint(Canvas* canvas, double x, double y) {
   if (!m_paragraph_ || !canvas) {
     // disposed.
@@ -249,7 +306,10 @@ int Paragraph::getLineNumberAt(size_t utf16Offset) const {
 }
 
 void Paragraph::dispose() {
-  m_paragraph_.reset();
+  {
+    std::scoped_lock lock(GetLayoutMutex());
+    m_paragraph_.reset();
+  }
   ClearDartWrapper();
 }
 
@@ -36,6 +36,21 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
   bool didExceedMaxLines();
 
   void layout(double width);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Lays out the paragraph on a worker thread from the concurrent
+  ///             task runner and invokes the callback on the UI thread once
+  ///             it is done.
+  ///
+  ///             The paragraph must not be used from Dart until the callback
+  ///             has been invoked.
+  ///
+  /// @param[in]  width            The width to lay the paragraph out at.
+  /// @param[in]  callback_handle  The closure to invoke when layout is done.
+  ///
+  /// @return     Null on success or an error message string.
+  ///
+  Dart_Handle layoutAsync(double width, Dart_Handle callback_handle);
   void paint(Canvas* canvas, double x, double y);
 
   tonic::Float32List getRectsForRange(unsigned start,
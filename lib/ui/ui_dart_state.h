@@ -11,6 +11,7 @@
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/display_list/utils/dl_interner.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/synchronization/waitable_event.h"
@@ -142,6 +143,12 @@ class UIDartState : public tonic::DartState {
 
   std::shared_ptr<IsolateNameServer> GetIsolateNameServer() const;
 
+  /// The interner that the pictures recorded by this isolate are collapsed
+  /// with. It is advanced at the start of each frame.
+  DisplayListInterner& GetDisplayListInterner() {
+    return display_list_interner_;
+  }
+
   tonic::DartErrorHandleType GetLastError();
 
   // Logs `print` messages from the application via an embedder-specified
@@ -196,6 +203,7 @@ class UIDartState : public tonic::DartState {
   LogMessageCallback log_message_callback_;
   const std::shared_ptr<IsolateNameServer> isolate_name_server_;
   UIDartState::Context context_;
+  DisplayListInterner display_list_interner_;
 
   void AddOrRemoveTaskObserver(bool add);
 };
@@ -4,6 +4,7 @@
 
 #include "flutter/lib/ui/window/platform_configuration.h"
 
+#include <cstdlib>
 #include <cstring>
 
 #include "flutter/common/constants.h"
@@ -23,8 +24,38 @@
 namespace flutter {
 namespace {
 
-Dart_Handle ToByteData(const fml::Mapping& buffer) {
-  return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
+void FinalizeMallocMapping(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+// Small buffers are cheaper to copy into the Dart heap than to finalize.
+// Larger ones are handed to Dart without copying them.
+Dart_Handle ToByteData(fml::MallocMapping buffer) {
+  if (buffer.GetSize() < tonic::DartByteData::kExternalSizeThreshold) {
+    return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
+  }
+  const intptr_t length = buffer.GetSize();
+  uint8_t* bytes = buffer.Release();
+  return Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, bytes, length, bytes, length,
+      FinalizeMallocMapping);
+}
+
+void FinalizePointerDataPacket(void* isolate_callback_data, void* peer) {
+  delete reinterpret_cast<PointerDataPacket*>(peer);
+}
+
+// Small packets are cheaper to copy into the Dart heap than to finalize.
+Dart_Handle ToByteData(std::unique_ptr<PointerDataPacket> packet) {
+  std::vector<uint8_t>& buffer = packet->mutable_data();
+  if (buffer.size() < tonic::DartByteData::kExternalSizeThreshold) {
+    return tonic::DartByteData::Create(buffer.data(), buffer.size());
+  }
+  void* bytes = buffer.data();
+  const intptr_t length = buffer.size();
+  return Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, bytes, length, packet.release(), length,
+      FinalizePointerDataPacket);
 }
 
 }  // namespace
@@ -299,7 +330,7 @@ void PlatformConfiguration::DispatchPlatformMessage(
   }
   tonic::DartState::Scope scope(dart_state);
   Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
+      (message->hasData()) ? ToByteData(message->releaseData()) : Dart_Null();
   if (Dart_IsError(data_handle)) {
     FML_DLOG(WARNING)
         << "Dropping platform message because of a Dart error on channel: "
@@ -320,7 +351,7 @@ void PlatformConfiguration::DispatchPlatformMessage(
 }
 
 void PlatformConfiguration::DispatchPointerDataPacket(
-    const PointerDataPacket& packet) {
+    std::unique_ptr<PointerDataPacket> packet) {
   std::shared_ptr<tonic::DartState> dart_state =
       dispatch_pointer_data_packet_.dart_state().lock();
   if (!dart_state) {
@@ -328,9 +359,7 @@ void PlatformConfiguration::DispatchPointerDataPacket(
   }
   tonic::DartState::Scope scope(dart_state);
 
-  const std::vector<uint8_t>& buffer = packet.data();
-  Dart_Handle data_handle =
-      tonic::DartByteData::Create(buffer.data(), buffer.size());
+  Dart_Handle data_handle = ToByteData(std::move(packet));
   if (Dart_IsError(data_handle)) {
     return;
   }
@@ -350,7 +379,7 @@ void PlatformConfiguration::DispatchSemanticsAction(int32_t node_id,
   tonic::DartState::Scope scope(dart_state);
 
   Dart_Handle args_handle =
-      (args.GetSize() <= 0) ? Dart_Null() : ToByteData(args);
+      (args.GetSize() <= 0) ? Dart_Null() : ToByteData(std::move(args));
 
   if (Dart_IsError(args_handle)) {
     return;
@@ -371,6 +400,10 @@ void PlatformConfiguration::BeginFrame(fml::TimePoint frameTime,
   }
   tonic::DartState::Scope scope(dart_state);
 
+  // Pictures that have not been recorded again for a while no longer need
+  // to be shared with new recordings.
+  UIDartState::Current()->GetDisplayListInterner().OnFrame();
+
   int64_t microseconds = (frameTime - fml::TimePoint()).ToMicroseconds();
 
   tonic::CheckAndHandleError(
@@ -395,9 +395,11 @@ class PlatformConfiguration final {
   ///             it pointer events. This call originates in the platform view
   ///             and has been forwarded through the engine to here.
   ///
+  ///             Large packets are handed to Dart without being copied.
+  ///
   /// @param[in]  packet  The pointer event(s) serialized into a packet.
   ///
-  void DispatchPointerDataPacket(const PointerDataPacket& packet);
+  void DispatchPointerDataPacket(std::unique_ptr<PointerDataPacket> packet);
 
   //----------------------------------------------------------------------------
   /// @brief      Notifies the framework that the embedder encountered an
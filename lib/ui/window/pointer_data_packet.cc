@@ -6,6 +6,7 @@
 #include "flutter/fml/logging.h"
 
 #include <cstring>
+#include <unordered_map>
 
 namespace flutter {
 
@@ -33,4 +34,48 @@ size_t PointerDataPacket::GetLength() const {
   return data_.size() / sizeof(PointerData);
 }
 
+// static
+std::unique_ptr<PointerDataPacket> PointerDataPacket::Coalesce(
+    const std::vector<std::unique_ptr<PointerDataPacket>>& packets) {
+  std::vector<PointerData> events;
+  std::vector<bool> dropped;
+  // The index in |events| of the last event of each device, if it can still
+  // be coalesced with the next one.
+  std::unordered_map<int64_t, size_t> last_moves;
+  for (const auto& packet : packets) {
+    for (size_t i = 0; i < packet->GetLength(); i++) {
+      PointerData data = packet->GetPointerData(i);
+      const bool is_move = data.change == PointerData::Change::kMove &&
+                           data.signal_kind == PointerData::SignalKind::kNone;
+      auto last_move = last_moves.find(data.device);
+      if (last_move != last_moves.end()) {
+        if (is_move) {
+          const PointerData& previous = events[last_move->second];
+          data.physical_delta_x += previous.physical_delta_x;
+          data.physical_delta_y += previous.physical_delta_y;
+          dropped[last_move->second] = true;
+        }
+        last_moves.erase(last_move);
+      }
+      if (is_move) {
+        last_moves[data.device] = events.size();
+      }
+      events.push_back(data);
+      dropped.push_back(false);
+    }
+  }
+
+  size_t count = 0;
+  for (bool is_dropped : dropped) {
+    count += is_dropped ? 0 : 1;
+  }
+  auto coalesced = std::make_unique<PointerDataPacket>(count);
+  for (size_t i = 0, j = 0; i < events.size(); i++) {
+    if (!dropped[i]) {
+      coalesced->SetPointerData(j++, events[i]);
+    }
+  }
+  return coalesced;
+}
+
 }  // namespace flutter
@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_WINDOW_POINTER_DATA_PACKET_H_
 
 #include <cstring>
+#include <memory>
 #include <vector>
 
 #include "flutter/fml/macros.h"
@@ -23,6 +24,13 @@ class PointerDataPacket {
   PointerData GetPointerData(size_t i) const;
   size_t GetLength() const;
   const std::vector<uint8_t>& data() const { return data_; }
+  std::vector<uint8_t>& mutable_data() { return data_; }
+
+  /// Merges |packets| into one packet, in order. A move of a pointer is
+  /// dropped if the next event of the same pointer is also a move, which then
+  /// takes on the dropped move's deltas.
+  static std::unique_ptr<PointerDataPacket> Coalesce(
+      const std::vector<std::unique_ptr<PointerDataPacket>>& packets);
 
  private:
   std::vector<uint8_t> data_;
@@ -5,6 +5,7 @@
 #include "flutter/lib/ui/window/pointer_data.h"
 
 #include <cstring>
+#include <iterator>
 
 #include "gtest/gtest.h"
 #include "pointer_data_packet.h"
@@ -65,5 +66,56 @@ TEST(PointerDataPacketTest, CanGetLength) {
   ASSERT_EQ(packet->GetLength(), (size_t)6);
 }
 
+TEST(PointerDataPacketTest, CoalesceMergesMovesOfTheSamePointer) {
+  std::vector<std::unique_ptr<PointerDataPacket>> packets;
+  PointerData data;
+  for (int i = 0; i < 3; i++) {
+    auto packet = std::make_unique<PointerDataPacket>(2);
+    CreateSimpleSimulatedPointerData(data, PointerData::Change::kMove, 1,
+                                     i + 1, 0, 1);
+    data.physical_delta_x = 1;
+    packet->SetPointerData(0, data);
+    CreateSimpleSimulatedPointerData(data, PointerData::Change::kMove, 2, 0,
+                                     i + 1, 1);
+    data.physical_delta_y = 1;
+    packet->SetPointerData(1, data);
+    packets.push_back(std::move(packet));
+  }
+
+  auto coalesced = PointerDataPacket::Coalesce(packets);
+  ASSERT_EQ(coalesced->GetLength(), 2u);
+  PointerData first = coalesced->GetPointerData(0);
+  EXPECT_EQ(first.device, 1);
+  EXPECT_EQ(first.physical_x, 3.0);
+  EXPECT_EQ(first.physical_delta_x, 3.0);
+  PointerData second = coalesced->GetPointerData(1);
+  EXPECT_EQ(second.device, 2);
+  EXPECT_EQ(second.physical_y, 3.0);
+  EXPECT_EQ(second.physical_delta_y, 3.0);
+}
+
+TEST(PointerDataPacketTest, CoalesceKeepsMovesAroundOtherEvents) {
+  std::vector<std::unique_ptr<PointerDataPacket>> packets;
+  PointerData data;
+  PointerData::Change changes[] = {
+      PointerData::Change::kMove, PointerData::Change::kMove,
+      PointerData::Change::kUp, PointerData::Change::kDown,
+      PointerData::Change::kMove};
+  for (size_t i = 0; i < std::size(changes); i++) {
+    auto packet = std::make_unique<PointerDataPacket>(1);
+    CreateSimpleSimulatedPointerData(data, changes[i], 1, i, 0, 1);
+    packet->SetPointerData(0, data);
+    packets.push_back(std::move(packet));
+  }
+
+  auto coalesced = PointerDataPacket::Coalesce(packets);
+  ASSERT_EQ(coalesced->GetLength(), 4u);
+  EXPECT_EQ(coalesced->GetPointerData(0).change, PointerData::Change::kMove);
+  EXPECT_EQ(coalesced->GetPointerData(0).physical_x, 1.0);
+  EXPECT_EQ(coalesced->GetPointerData(1).change, PointerData::Change::kUp);
+  EXPECT_EQ(coalesced->GetPointerData(2).change, PointerData::Change::kDown);
+  EXPECT_EQ(coalesced->GetPointerData(3).change, PointerData::Change::kMove);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -215,6 +215,9 @@ class FrameTiming {
 
   Duration get vsyncOverhead => _rawDuration(FramePhase.buildStart) - _rawDuration(FramePhase.vsyncStart);
 
+  Duration get queueDuration =>
+      _rawDuration(FramePhase.rasterStart) - _rawDuration(FramePhase.buildFinish);
+
   Duration get totalSpan =>
       _rawDuration(FramePhase.rasterFinish) - _rawDuration(FramePhase.vsyncStart);
 
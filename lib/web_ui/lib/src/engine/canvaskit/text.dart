@@ -716,6 +716,13 @@ class CkParagraph implements ui.Paragraph {
     }
   }
 
+  @override
+  Future<void> layoutAsync(ui.ParagraphConstraints constraints) async {
+    // The web has no worker threads to shape text on, so the paragraph is
+    // laid out immediately.
+    layout(constraints);
+  }
+
   @override
   ui.TextRange getLineBoundary(ui.TextPosition position) {
     assert(!_disposed, 'Paragraph has been disposed.');
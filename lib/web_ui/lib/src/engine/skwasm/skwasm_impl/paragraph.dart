@@ -136,6 +136,13 @@ class SkwasmParagraph extends SkwasmObjectWrapper<RawParagraph> implements ui.Pa
     }
   }
 
+  @override
+  Future<void> layoutAsync(ui.ParagraphConstraints constraints) async {
+    // The web has no worker threads to shape text on, so the paragraph is
+    // laid out immediately.
+    layout(constraints);
+  }
+
   List<ui.TextBox> _convertTextBoxList(TextBoxListHandle listHandle) {
     final int length = textBoxListGetLength(listHandle);
     return withStackScope((StackScope scope) {
@@ -118,6 +118,13 @@ class CanvasParagraph implements ui.Paragraph {
     _cachedDomElement = null;
   }
 
+  @override
+  Future<void> layoutAsync(ui.ParagraphConstraints constraints) async {
+    // The web has no worker threads to shape text on, so the paragraph is
+    // laid out immediately.
+    layout(constraints);
+  }
+
   // TODO(mdebbar): Returning true means we always require a bitmap canvas. Revisit
   // this decision once `CanvasParagraph` is fully implemented.
   /// Whether this paragraph is doing arbitrary paint operations that require
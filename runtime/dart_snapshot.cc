@@ -32,11 +32,14 @@ const char* DartSnapshot::kIsolateInstructionsSymbol =
 static std::unique_ptr<const fml::Mapping> GetFileMapping(
     const std::string& path,
     bool executable) {
-  if (executable) {
-    return fml::FileMapping::CreateReadExecute(path);
-  } else {
-    return fml::FileMapping::CreateReadOnly(path);
+  auto mapping = executable ? fml::FileMapping::CreateReadExecute(path)
+                            : fml::FileMapping::CreateReadOnly(path);
+  // All of a snapshot is read while the isolate starts. Start paging it in
+  // now so that doesn't wait on the disk.
+  if (mapping) {
+    mapping->Prefetch();
   }
+  return mapping;
 }
 
 // The first party embedders don't yet use the stable embedder API and depend on
@@ -74,12 +77,14 @@ static std::shared_ptr<const fml::Mapping> SearchMapping(
     }
   }
 
-  // Look in application specified native library if specified.
+  // Look in application specified native library if specified. As with
+  // files, start paging in the segment that holds the snapshot right away.
   for (const std::string& path : native_library_path) {
     auto native_library = fml::NativeLibrary::Create(path.c_str());
     auto symbol_mapping = std::make_unique<const fml::SymbolMapping>(
         native_library, native_library_symbol_name);
     if (symbol_mapping->GetMapping() != nullptr) {
+      symbol_mapping->Prefetch();
       return symbol_mapping;
     }
   }
@@ -90,6 +95,7 @@ static std::shared_ptr<const fml::Mapping> SearchMapping(
     auto symbol_mapping = std::make_unique<const fml::SymbolMapping>(
         loaded_process, native_library_symbol_name);
     if (symbol_mapping->GetMapping() != nullptr) {
+      symbol_mapping->Prefetch();
       return symbol_mapping;
     }
   }
@@ -264,6 +270,22 @@ bool DartSnapshot::IsDontNeedSafe() const {
   return true;
 }
 
+void DartSnapshot::PrefetchData() const {
+  if (!data_ || !data_->GetMapping()) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "DartSnapshot::PrefetchData");
+  // The smallest page size of the supported platforms.
+  constexpr size_t kPageSize = 4096;
+  const volatile uint8_t* mapping = data_->GetMapping();
+  const size_t size = data_->GetSize();
+  uint8_t sum = 0;
+  for (size_t offset = 0; offset < size; offset += kPageSize) {
+    sum += mapping[offset];
+  }
+  static_cast<void>(sum);
+}
+
 bool DartSnapshot::IsNullSafetyEnabled(const fml::Mapping* kernel) const {
   return ::Dart_DetectNullSafety(
       nullptr,           // script_uri (unsupported by Flutter)
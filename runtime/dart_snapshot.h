@@ -165,6 +165,14 @@ class DartSnapshot : public fml::RefCountedThreadSafe<DartSnapshot> {
   ///             safe to use with madvise(DONTNEED).
   bool IsDontNeedSafe() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Reads a byte from every page of the heap snapshot, so that
+  ///             the page faults are taken before an isolate is created from
+  ///             it, possibly on another thread. This may be called from any
+  ///             thread.
+  ///
+  void PrefetchData() const;
+
   bool IsNullSafetyEnabled(
       const fml::Mapping* application_kernel_mapping) const;
 
@@ -441,7 +441,7 @@ class RuntimeController : public PlatformConfigurationClient {
   /// @return     If the pointer data message was dispatched. This may fail is
   ///             an isolate is not running.
   ///
-  bool DispatchPointerDataPacket(const PointerDataPacket& packet);
+  bool DispatchPointerDataPacket(std::unique_ptr<PointerDataPacket> packet);
 
   //----------------------------------------------------------------------------
   /// @brief      Dispatch the semantics action to the specified accessibility
@@ -42,6 +42,14 @@ const std::string_view
         "_flutter.renderFrameWithRasterStats";
 const std::string_view ServiceProtocol::kReloadAssetFonts =
     "_flutter.reloadAssetFonts";
+const std::string_view ServiceProtocol::kGetFlightRecorderExtensionName =
+    "_flutter.getFlightRecorder";
+const std::string_view ServiceProtocol::kGetGpuMemoryUsageExtensionName =
+    "_flutter.getGpuMemoryUsage";
+const std::string_view ServiceProtocol::kGetStartupTimelineExtensionName =
+    "_flutter.getStartupTimeline";
+const std::string_view ServiceProtocol::kGetCacheStatisticsExtensionName =
+    "_flutter.getCacheStatistics";
 
 static constexpr std::string_view kViewIdPrefx = "_flutterView/";
 static constexpr std::string_view kListViewsExtensionName =
@@ -63,6 +71,10 @@ ServiceProtocol::ServiceProtocol()
           kEstimateRasterCacheMemoryExtensionName,
           kRenderFrameWithRasterStatsExtensionName,
           kReloadAssetFonts,
+          kGetFlightRecorderExtensionName,
+          kGetGpuMemoryUsageExtensionName,
+          kGetStartupTimelineExtensionName,
+          kGetCacheStatisticsExtensionName,
       }),
       handlers_mutex_(fml::SharedMutex::Create()) {}
 
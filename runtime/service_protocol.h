@@ -31,6 +31,10 @@ class ServiceProtocol {
   static const std::string_view kEstimateRasterCacheMemoryExtensionName;
   static const std::string_view kRenderFrameWithRasterStatsExtensionName;
   static const std::string_view kReloadAssetFonts;
+  static const std::string_view kGetFlightRecorderExtensionName;
+  static const std::string_view kGetGpuMemoryUsageExtensionName;
+  static const std::string_view kGetStartupTimelineExtensionName;
+  static const std::string_view kGetCacheStatisticsExtensionName;
 
   class Handler {
    public:
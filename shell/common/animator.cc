@@ -6,6 +6,7 @@
 
 #include "flutter/common/constants.h"
 #include "flutter/flow/frame_timings.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
@@ -20,32 +21,45 @@ namespace {
 constexpr fml::TimeDelta kNotifyIdleTaskWaitTime =
     fml::TimeDelta::FromMilliseconds(51);
 
+uint32_t GetPipelineDepth(const TaskRunners& task_runners,
+                          uint32_t requested_depth) {
+#if !SHELL_ENABLE_METAL
+  // TODO(dnfield): We should remove this logic and set the pipeline depth
+  // back to 2 in this case. See
+  // https://github.com/flutter/engine/pull/9132 for discussion.
+  if (task_runners.GetPlatformTaskRunner() ==
+      task_runners.GetRasterTaskRunner()) {
+    return 1;
+  }
+#endif  // !SHELL_ENABLE_METAL
+  return requested_depth > 0 ? requested_depth : 2;
+}
+
 }  // namespace
 
 Animator::Animator(Delegate& delegate,
                    const TaskRunners& task_runners,
-                   std::unique_ptr<VsyncWaiter> waiter)
+                   std::unique_ptr<VsyncWaiter> waiter,
+                   uint32_t pipeline_depth)
     : delegate_(delegate),
       task_runners_(task_runners),
       waiter_(std::move(waiter)),
-#if SHELL_ENABLE_METAL
-      layer_tree_pipeline_(std::make_shared<FramePipeline>(2)),
-#else   // SHELL_ENABLE_METAL
-      // TODO(dnfield): We should remove this logic and set the pipeline depth
-      // back to 2 in this case. See
-      // https://github.com/flutter/engine/pull/9132 for discussion.
       layer_tree_pipeline_(std::make_shared<FramePipeline>(
-          task_runners.GetPlatformTaskRunner() ==
-                  task_runners.GetRasterTaskRunner()
-              ? 1
-              : 2)),
-#endif  // SHELL_ENABLE_METAL
+          GetPipelineDepth(task_runners, pipeline_depth))),
       pending_frame_semaphore_(1),
       weak_factory_(this) {
 }
 
 Animator::~Animator() = default;
 
+void Animator::SetFramePacer(std::shared_ptr<const FramePacer> pacer) {
+  frame_pacer_ = std::move(pacer);
+}
+
+void Animator::EnableContentFrameRate() {
+  content_frame_rate_tracker_ = std::make_unique<ContentFrameRateTracker>();
+}
+
 void Animator::EnqueueTraceFlowId(uint64_t trace_flow_id) {
   fml::TaskRunner::RunNowOrPostTask(
       task_runners_.GetUITaskRunner(),
@@ -234,6 +248,18 @@ void Animator::RequestFrame(bool regenerate_layer_trees) {
     return;
   }
 
+  if (content_frame_rate_tracker_) {
+    // A frame requested between BeginFrame and EndFrame is chained to the
+    // one being built.
+    content_frame_rate_tracker_->RecordFrameRequest(
+        fml::TimePoint::Now(), frame_timings_recorder_ != nullptr);
+    double frame_rate = content_frame_rate_tracker_->GetPreferredFrameRate();
+    if (frame_rate != preferred_frame_rate_) {
+      preferred_frame_rate_ = frame_rate;
+      waiter_->SetPreferredFrameRate(frame_rate);
+    }
+  }
+
   // The AwaitVSync is going to call us back at the next VSync. However, we want
   // to be reasonably certain that the UI thread is not in the middle of a
   // particularly expensive callout. We post the AwaitVSync to run right after
@@ -258,10 +284,34 @@ void Animator::AwaitVSync() {
         if (self) {
           if (self->CanReuseLastLayerTrees()) {
             self->DrawLastLayerTrees(std::move(frame_timings_recorder));
-          } else {
-            self->BeginFrame(std::move(frame_timings_recorder));
-            self->EndFrame();
+            return;
+          }
+          fml::TimeDelta start_delay =
+              self->frame_pacer_
+                  ? self->frame_pacer_->GetStartDelay(
+                        fml::TimePoint::Now(),
+                        frame_timings_recorder->GetVsyncTargetTime())
+                  : fml::TimeDelta::Zero();
+          if (start_delay > fml::TimeDelta::Zero()) {
+            // The frame would be done long before its target time. Build it
+            // later, from more recent input. No other frame can be begun in
+            // the meantime, as |pending_frame_semaphore_| is only signaled
+            // by BeginFrame.
+            TRACE_EVENT0("flutter", "Animator::PaceFrame");
+            self->task_runners_.GetUITaskRunner()->PostDelayedTask(
+                fml::MakeCopyable(
+                    [self, frame_timings_recorder =
+                               std::move(frame_timings_recorder)]() mutable {
+                      if (self) {
+                        self->BeginFrame(std::move(frame_timings_recorder));
+                        self->EndFrame();
+                      }
+                    }),
+                start_delay);
+            return;
           }
+          self->BeginFrame(std::move(frame_timings_recorder));
+          self->EndFrame();
         }
       });
   if (has_rendered_) {
@@ -13,6 +13,8 @@
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/synchronization/semaphore.h"
 #include "flutter/fml/time/time_point.h"
+#include "flutter/shell/common/content_frame_rate_tracker.h"
+#include "flutter/shell/common/frame_pacer.h"
 #include "flutter/shell/common/pipeline.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/vsync_waiter.h"
@@ -45,12 +47,22 @@ class Animator final {
         std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) = 0;
   };
 
+  // A `pipeline_depth` of 0 picks the default depth for the task runners.
   Animator(Delegate& delegate,
            const TaskRunners& task_runners,
-           std::unique_ptr<VsyncWaiter> waiter);
+           std::unique_ptr<VsyncWaiter> waiter,
+           uint32_t pipeline_depth = 0);
 
   ~Animator();
 
+  // Paces the start of frames with |pacer|, or starts them at the vsync if
+  // it is null.
+  void SetFramePacer(std::shared_ptr<const FramePacer> pacer);
+
+  // Tells the vsync waiter the lowest refresh rate that the content being
+  // animated needs, as the frames are requested.
+  void EnableContentFrameRate();
+
   void RequestFrame(bool regenerate_layer_trees = true);
 
   //--------------------------------------------------------------------------
@@ -124,6 +136,9 @@ class Animator final {
   bool frame_scheduled_ = false;
   std::deque<uint64_t> trace_flow_ids_;
   bool has_rendered_ = false;
+  std::shared_ptr<const FramePacer> frame_pacer_;
+  std::unique_ptr<ContentFrameRateTracker> content_frame_rate_tracker_;
+  double preferred_frame_rate_ = 0;
 
   fml::WeakPtrFactory<Animator> weak_factory_;
 
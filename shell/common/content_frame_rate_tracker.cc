@@ -0,0 +1,59 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/content_frame_rate_tracker.h"
+
+namespace flutter {
+
+namespace {
+
+// The rates the display is asked for, slowest first. Content that is just
+// faster than one of these, as measured, still gets it.
+constexpr double kFrameRates[] = {24.0, 30.0, 60.0};
+constexpr double kFrameRateTolerance = 0.97;
+
+}  // namespace
+
+void ContentFrameRateTracker::RecordFrameRequest(fml::TimePoint now,
+                                                 bool during_frame) {
+  if (during_frame) {
+    Reset();
+    preferred_frame_rate_ = 0;
+    return;
+  }
+  if (has_last_request_) {
+    fml::TimeDelta interval = now - last_request_;
+    if (interval > kIdleInterval) {
+      Reset();
+    } else {
+      intervals_[interval_count_ % kHistorySize] = interval;
+      interval_count_++;
+    }
+  }
+  last_request_ = now;
+  has_last_request_ = true;
+  if (interval_count_ < kHistorySize) {
+    return;
+  }
+
+  fml::TimeDelta total;
+  for (const fml::TimeDelta& interval : intervals_) {
+    total = total + interval;
+  }
+  double content_rate = kHistorySize / total.ToSecondsF();
+  preferred_frame_rate_ = 0;
+  for (double rate : kFrameRates) {
+    if (rate >= content_rate * kFrameRateTolerance) {
+      preferred_frame_rate_ = rate;
+      break;
+    }
+  }
+}
+
+void ContentFrameRateTracker::Reset() {
+  interval_count_ = 0;
+  has_last_request_ = false;
+}
+
+}  // namespace flutter
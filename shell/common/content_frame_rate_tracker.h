@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_CONTENT_FRAME_RATE_TRACKER_H_
+#define FLUTTER_SHELL_COMMON_CONTENT_FRAME_RATE_TRACKER_H_
+
+#include <array>
+#include <cstddef>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// Works out the lowest display refresh rate that the content being animated
+/// still needs, so that the display can be asked to refresh less often when
+/// nothing on screen changes at its full rate.
+///
+/// A frame that is requested while another frame is being built comes from
+/// an animation that runs at the display's rate, such as a ticker, and
+/// removes any preference right away. Frames that are requested on their
+/// own, such as by a video decoding into a texture, are timed instead: once
+/// |kHistorySize| of them have been requested, their average rate picks the
+/// lowest of 24, 30 and 60 Hz that is not slower than the content. A gap of
+/// more than |kIdleInterval| between requests starts the timing over.
+///
+/// This class is only used on the UI thread.
+class ContentFrameRateTracker {
+ public:
+  static constexpr size_t kHistorySize = 8;
+  static constexpr fml::TimeDelta kIdleInterval =
+      fml::TimeDelta::FromMilliseconds(100);
+
+  ContentFrameRateTracker() = default;
+
+  /// Records that a frame was requested at |now|, and whether the request
+  /// was made while another frame was being built.
+  void RecordFrameRequest(fml::TimePoint now, bool during_frame);
+
+  /// The refresh rate in Hz that the content needs, or 0 if the display
+  /// should refresh as fast as it can.
+  double GetPreferredFrameRate() const { return preferred_frame_rate_; }
+
+ private:
+  std::array<fml::TimeDelta, kHistorySize> intervals_;
+  size_t interval_count_ = 0;
+  fml::TimePoint last_request_;
+  bool has_last_request_ = false;
+  double preferred_frame_rate_ = 0;
+
+  void Reset();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ContentFrameRateTracker);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_CONTENT_FRAME_RATE_TRACKER_H_
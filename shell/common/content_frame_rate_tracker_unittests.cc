@@ -0,0 +1,96 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/content_frame_rate_tracker.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Requests |count| frames, none of them during a frame, |interval| apart,
+// and returns the time of the last request.
+fml::TimePoint RequestFrames(ContentFrameRateTracker& tracker,
+                             fml::TimePoint start,
+                             size_t count,
+                             fml::TimeDelta interval) {
+  fml::TimePoint now = start;
+  for (size_t i = 0; i < count; i++) {
+    now = now + interval;
+    tracker.RecordFrameRequest(now, false);
+  }
+  return now;
+}
+
+}  // namespace
+
+TEST(ContentFrameRateTrackerTest, NoPreferenceWithoutEnoughHistory) {
+  ContentFrameRateTracker tracker;
+  RequestFrames(tracker, fml::TimePoint::Now(),
+                ContentFrameRateTracker::kHistorySize,
+                fml::TimeDelta::FromMicroseconds(33333));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 0);
+}
+
+TEST(ContentFrameRateTrackerTest, PicksLowestRateThatKeepsUp) {
+  ContentFrameRateTracker tracker;
+  fml::TimePoint now = fml::TimePoint::Now();
+  const size_t count = ContentFrameRateTracker::kHistorySize + 1;
+
+  now = RequestFrames(tracker, now, count,
+                      fml::TimeDelta::FromMicroseconds(41667));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 24);
+
+  now = RequestFrames(tracker, now, count,
+                      fml::TimeDelta::FromMicroseconds(33333));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 30);
+
+  // Slightly faster than 30 Hz content is still shown at 30 Hz.
+  now = RequestFrames(tracker, now, count,
+                      fml::TimeDelta::FromMicroseconds(33000));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 30);
+
+  now = RequestFrames(tracker, now, count,
+                      fml::TimeDelta::FromMicroseconds(25000));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 60);
+
+  RequestFrames(tracker, now, count, fml::TimeDelta::FromMicroseconds(8333));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 0);
+}
+
+TEST(ContentFrameRateTrackerTest, RequestDuringFrameRemovesPreference) {
+  ContentFrameRateTracker tracker;
+  fml::TimePoint now = RequestFrames(
+      tracker, fml::TimePoint::Now(), ContentFrameRateTracker::kHistorySize + 1,
+      fml::TimeDelta::FromMicroseconds(33333));
+  ASSERT_EQ(tracker.GetPreferredFrameRate(), 30);
+
+  tracker.RecordFrameRequest(now + fml::TimeDelta::FromMilliseconds(16), true);
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 0);
+}
+
+TEST(ContentFrameRateTrackerTest, IdleGapRestartsTiming) {
+  ContentFrameRateTracker tracker;
+  const size_t count = ContentFrameRateTracker::kHistorySize + 1;
+  fml::TimePoint now = RequestFrames(tracker, fml::TimePoint::Now(), count,
+                                     fml::TimeDelta::FromMicroseconds(33333));
+  ASSERT_EQ(tracker.GetPreferredFrameRate(), 30);
+
+  // The gap is not counted as a slow frame, and the preference is kept
+  // until enough new requests have been timed.
+  now = now + ContentFrameRateTracker::kIdleInterval +
+        fml::TimeDelta::FromMilliseconds(1);
+  tracker.RecordFrameRequest(now, false);
+  now = RequestFrames(tracker, now, ContentFrameRateTracker::kHistorySize - 1,
+                      fml::TimeDelta::FromMicroseconds(16667));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 30);
+
+  RequestFrames(tracker, now, 1, fml::TimeDelta::FromMicroseconds(16667));
+  EXPECT_EQ(tracker.GetPreferredFrameRate(), 60);
+}
+
+}  // namespace testing
+}  // namespace flutter
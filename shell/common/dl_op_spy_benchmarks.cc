@@ -0,0 +1,22 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/benchmarking/dl_op_benchmarks.h"
+#include "flutter/shell/common/dl_op_spy.h"
+
+namespace flutter {
+
+// The spy runs over every picture the rasterizer checks for content, so its
+// cost per op is part of the frame.
+[[maybe_unused]] static const bool kDlOpSpyBenchmarksRegistered =
+    testing::RegisterDisplayListDispatchOpBenchmarks(
+        "DlOpSpy",
+        [](const DisplayList& display_list, const SkRect& cull_rect) {
+          DlOpSpy spy;
+          display_list.Dispatch(spy, cull_rect);
+          benchmark::DoNotOptimize(spy.did_draw());
+        });
+
+}  // namespace flutter
@@ -60,6 +60,10 @@ Engine::Engine(
       task_runners_(task_runners),
       weak_factory_(this) {
   pointer_data_dispatcher_ = dispatcher_maker(*this);
+  if (settings_.decoded_image_cache_max_bytes > 0) {
+    image_decoder_->SetDecodedImageCache(std::make_shared<DecodedImageCache>(
+        settings_.decoded_image_cache_max_bytes));
+  }
 }
 
 Engine::Engine(Delegate& delegate,
@@ -130,6 +134,15 @@ std::unique_ptr<Engine> Engine::Spawn(
       /*font_collection=*/font_collection_,
       /*runtime_controller=*/nullptr,
       /*gpu_disabled_switch=*/gpu_disabled_switch);
+  // Spawned engines share decoded images with this one, as long as they
+  // decode images the same way.
+  if (settings.enable_impeller == settings_.enable_impeller &&
+      settings.enable_wide_gamut == settings_.enable_wide_gamut &&
+      image_decoder_->GetDecodedImageCache() &&
+      result->image_decoder_->GetDecodedImageCache()) {
+    result->image_decoder_->SetDecodedImageCache(
+        image_decoder_->GetDecodedImageCache());
+  }
   result->runtime_controller_ = runtime_controller_->Spawn(
       /*p_client=*/*result,
       /*advisory_script_uri=*/settings.advisory_script_uri,
@@ -142,6 +155,10 @@ std::unique_ptr<Engine> Engine::Spawn(
       /*image_decoder=*/result->GetImageDecoderWeakPtr(),
       /*image_generator_registry=*/result->GetImageGeneratorRegistry(),
       /*snapshot_delegate=*/std::move(snapshot_delegate));
+  result->fonts_registered_by_spawner_ =
+      asset_manager_ != nullptr &&
+      settings.use_asset_fonts == settings_.use_asset_fonts &&
+      settings.use_test_fonts == settings_.use_test_fonts;
   result->initial_route_ = initial_route;
   return result;
 }
@@ -181,6 +198,15 @@ bool Engine::UpdateAssetManager(
     return false;
   }
 
+  // Registering the fonts again would parse the manifest, reload the fonts
+  // whose style isn't declared and clear the shaping caches of every engine
+  // sharing the collection. Later asset managers, like the ones hot reload
+  // brings, are registered as usual.
+  if (fonts_registered_by_spawner_) {
+    fonts_registered_by_spawner_ = false;
+    return true;
+  }
+
   // Using libTXT as the text engine.
   if (settings_.use_asset_fonts) {
     font_collection_->RegisterFonts(asset_manager_);
@@ -518,7 +544,7 @@ void Engine::DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
                               uint64_t trace_flow_id) {
   animator_->EnqueueTraceFlowId(trace_flow_id);
   if (runtime_controller_) {
-    runtime_controller_->DispatchPointerDataPacket(*packet);
+    runtime_controller_->DispatchPointerDataPacket(std::move(packet));
   }
 }
 
@@ -1030,6 +1030,10 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   std::string initial_route_;
   std::shared_ptr<AssetManager> asset_manager_;
   std::shared_ptr<FontCollection> font_collection_;
+  // Set on a spawned engine until it gets its first asset manager. The font
+  // collection is shared with the spawning engine, which has already
+  // registered the fonts of the assets that the spawned engine runs from.
+  bool fonts_registered_by_spawner_ = false;
   const std::unique_ptr<ImageDecoder> image_decoder_;
   ImageGeneratorRegistry image_generator_registry_;
   TaskRunners task_runners_;
@@ -177,6 +177,45 @@ class MockPlatformMessageHandler : public PlatformMessageHandler {
               (override));
 };
 
+// Counts how often the font manifest is looked up, which happens each time
+// fonts are registered from the assets.
+class FontManifestCountingResolver : public AssetResolver {
+ public:
+  explicit FontManifestCountingResolver(std::shared_ptr<int> lookups)
+      : lookups_(std::move(lookups)) {}
+
+  // |AssetResolver|
+  bool IsValid() const override { return true; }
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override { return true; }
+
+  // |AssetResolver|
+  AssetResolverType GetType() const override {
+    return AssetResolverType::kDirectoryAssetBundle;
+  }
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override {
+    if (asset_name == "FontManifest.json") {
+      (*lookups_)++;
+    }
+    return nullptr;
+  }
+
+ private:
+  std::shared_ptr<int> lookups_;
+};
+
+std::shared_ptr<AssetManager> MakeFontManifestCountingAssetManager(
+    const std::shared_ptr<int>& lookups) {
+  auto asset_manager = std::make_shared<AssetManager>();
+  asset_manager->PushBack(
+      std::make_unique<FontManifestCountingResolver>(lookups));
+  return asset_manager;
+}
+
 std::unique_ptr<PlatformMessage> MakePlatformMessage(
     const std::string& channel,
     const std::map<std::string, std::string>& values,
@@ -476,6 +515,46 @@ TEST_F(EngineTest, SpawnSharesFontLibrary) {
   });
 }
 
+TEST_F(EngineTest, SpawnDoesNotRegisterSharedFontsAgain) {
+  PostUITaskSync([this] {
+    MockRuntimeDelegate client;
+    auto mock_runtime_controller =
+        std::make_unique<MockRuntimeController>(client, task_runners_);
+    auto vm_ref = DartVMRef::Create(settings_);
+    EXPECT_CALL(*mock_runtime_controller, GetDartVM())
+        .WillRepeatedly(::testing::Return(vm_ref.get()));
+    auto engine = std::make_unique<Engine>(
+        /*delegate=*/delegate_,
+        /*dispatcher_maker=*/dispatcher_maker_,
+        /*image_decoder_task_runner=*/image_decoder_task_runner_,
+        /*task_runners=*/task_runners_,
+        /*settings=*/settings_,
+        /*animator=*/std::move(animator_),
+        /*io_manager=*/io_manager_,
+        /*font_collection=*/std::make_shared<FontCollection>(),
+        /*runtime_controller=*/std::move(mock_runtime_controller),
+        /*gpu_disabled_switch=*/std::make_shared<fml::SyncSwitch>());
+
+    auto lookups = std::make_shared<int>(0);
+    EXPECT_TRUE(engine->UpdateAssetManager(
+        MakeFontManifestCountingAssetManager(lookups)));
+    EXPECT_EQ(*lookups, 1);
+
+    auto spawn =
+        engine->Spawn(delegate_, dispatcher_maker_, settings_, nullptr,
+                      std::string(), io_manager_, snapshot_delegate_, nullptr);
+    ASSERT_TRUE(spawn != nullptr);
+    EXPECT_TRUE(spawn->UpdateAssetManager(
+        MakeFontManifestCountingAssetManager(lookups)));
+    EXPECT_EQ(*lookups, 1);
+
+    // Assets that change later are registered.
+    EXPECT_TRUE(spawn->UpdateAssetManager(
+        MakeFontManifestCountingAssetManager(lookups)));
+    EXPECT_EQ(*lookups, 2);
+  });
+}
+
 TEST_F(EngineTest, SpawnWithCustomInitialRoute) {
   PostUITaskSync([this] {
     MockRuntimeDelegate client;
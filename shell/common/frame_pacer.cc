@@ -0,0 +1,45 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_pacer.h"
+
+#include <algorithm>
+
+namespace flutter {
+
+void FramePacer::RecordFrame(fml::TimeDelta build_time,
+                             fml::TimeDelta raster_time) {
+  std::scoped_lock lock(mutex_);
+  frame_times_[frame_count_ % kHistorySize] = build_time + raster_time;
+  frame_count_++;
+}
+
+fml::TimeDelta FramePacer::GetPredictedFrameTime() const {
+  std::scoped_lock lock(mutex_);
+  return GetPredictedFrameTimeLocked();
+}
+
+fml::TimeDelta FramePacer::GetStartDelay(fml::TimePoint now,
+                                         fml::TimePoint target_time) const {
+  fml::TimeDelta predicted_frame_time;
+  {
+    std::scoped_lock lock(mutex_);
+    predicted_frame_time = GetPredictedFrameTimeLocked();
+  }
+  if (predicted_frame_time == fml::TimeDelta::Zero()) {
+    return fml::TimeDelta::Zero();
+  }
+  fml::TimePoint latest_start = target_time - predicted_frame_time;
+  return std::max(latest_start - now, fml::TimeDelta::Zero());
+}
+
+fml::TimeDelta FramePacer::GetPredictedFrameTimeLocked() const {
+  if (frame_count_ < kHistorySize) {
+    return fml::TimeDelta::Zero();
+  }
+  return *std::max_element(frame_times_.begin(), frame_times_.end()) +
+         kSafetyMargin;
+}
+
+}  // namespace flutter
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_FRAME_PACER_H_
+#define FLUTTER_SHELL_COMMON_FRAME_PACER_H_
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// Decides how long the UI thread should wait after a vsync before it starts
+/// building a frame, so that the frame is rasterized just before its target
+/// time rather than long before it.
+///
+/// Starting later means the frame is built from more recent input, and that
+/// frames don't pile up in the pipeline waiting for the raster thread. How
+/// long a frame takes is predicted from the slowest of the last
+/// |kHistorySize| frames, plus |kSafetyMargin|. No delay is suggested until
+/// that many frames have been recorded.
+///
+/// Frames are recorded from the raster thread and the delay is asked for on
+/// the UI thread, so this class is thread safe.
+class FramePacer {
+ public:
+  static constexpr size_t kHistorySize = 16;
+  static constexpr fml::TimeDelta kSafetyMargin =
+      fml::TimeDelta::FromMilliseconds(2);
+
+  FramePacer() = default;
+
+  /// Records how long the last frame took to build and to rasterize.
+  void RecordFrame(fml::TimeDelta build_time, fml::TimeDelta raster_time);
+
+  /// How long a frame is expected to take to build and rasterize, or zero if
+  /// too few frames have been recorded to tell.
+  fml::TimeDelta GetPredictedFrameTime() const;
+
+  /// How long to wait from |now| before building the frame that must be
+  /// rasterized by |target_time|. Zero if the frame should start right away.
+  fml::TimeDelta GetStartDelay(fml::TimePoint now,
+                               fml::TimePoint target_time) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::array<fml::TimeDelta, kHistorySize> frame_times_;
+  size_t frame_count_ = 0;
+
+  fml::TimeDelta GetPredictedFrameTimeLocked() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FramePacer);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_FRAME_PACER_H_
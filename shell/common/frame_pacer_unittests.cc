@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_pacer.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+fml::TimeDelta Ms(int64_t milliseconds) {
+  return fml::TimeDelta::FromMilliseconds(milliseconds);
+}
+
+void RecordFrames(FramePacer& pacer,
+                  size_t count,
+                  fml::TimeDelta build_time,
+                  fml::TimeDelta raster_time) {
+  for (size_t i = 0; i < count; i++) {
+    pacer.RecordFrame(build_time, raster_time);
+  }
+}
+
+}  // namespace
+
+TEST(FramePacerTest, NoDelayWithoutEnoughHistory) {
+  FramePacer pacer;
+  RecordFrames(pacer, FramePacer::kHistorySize - 1, Ms(2), Ms(2));
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_EQ(pacer.GetPredictedFrameTime(), fml::TimeDelta::Zero());
+  EXPECT_EQ(pacer.GetStartDelay(now, now + Ms(16)), fml::TimeDelta::Zero());
+}
+
+TEST(FramePacerTest, DelaysStartSoFrameFinishesBeforeTarget) {
+  FramePacer pacer;
+  RecordFrames(pacer, FramePacer::kHistorySize, Ms(3), Ms(4));
+  EXPECT_EQ(pacer.GetPredictedFrameTime(), Ms(7) + FramePacer::kSafetyMargin);
+
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_EQ(pacer.GetStartDelay(now, now + Ms(16)),
+            Ms(9) - FramePacer::kSafetyMargin);
+}
+
+TEST(FramePacerTest, PredictsFromSlowestRecentFrame) {
+  FramePacer pacer;
+  RecordFrames(pacer, FramePacer::kHistorySize - 1, Ms(2), Ms(2));
+  pacer.RecordFrame(Ms(5), Ms(5));
+  EXPECT_EQ(pacer.GetPredictedFrameTime(), Ms(10) + FramePacer::kSafetyMargin);
+
+  // The slow frame is forgotten once enough faster frames have followed it.
+  RecordFrames(pacer, FramePacer::kHistorySize, Ms(2), Ms(2));
+  EXPECT_EQ(pacer.GetPredictedFrameTime(), Ms(4) + FramePacer::kSafetyMargin);
+}
+
+TEST(FramePacerTest, NoDelayWhenFramesTakeLongerThanTheyHave) {
+  FramePacer pacer;
+  RecordFrames(pacer, FramePacer::kHistorySize, Ms(10), Ms(10));
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_EQ(pacer.GetStartDelay(now, now + Ms(16)), fml::TimeDelta::Zero());
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/memory_trimmer.h"
+
+#include <limits>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+MemoryTrimmer::MemoryTrimmer() = default;
+
+MemoryTrimmer::~MemoryTrimmer() = default;
+
+void MemoryTrimmer::RegisterCache(std::string name,
+                                  EstimateCallback estimate_callback,
+                                  TrimCallback trim_callback) {
+  caches_.push_back({
+      .name = std::move(name),
+      .estimate_callback = std::move(estimate_callback),
+      .trim_callback = std::move(trim_callback),
+  });
+}
+
+size_t MemoryTrimmer::EstimateTrimmableBytes() const {
+  size_t bytes = 0;
+  for (const Cache& cache : caches_) {
+    bytes += cache.estimate_callback();
+  }
+  return bytes;
+}
+
+size_t MemoryTrimmer::GetTargetBytes(MemoryPressureLevel level) const {
+  switch (level) {
+    case MemoryPressureLevel::kModerate:
+      return (EstimateTrimmableBytes() + 1) / 2;
+    case MemoryPressureLevel::kCritical:
+      return std::numeric_limits<size_t>::max();
+  }
+  FML_UNREACHABLE();
+}
+
+size_t MemoryTrimmer::Trim(MemoryPressureLevel level) {
+  TRACE_EVENT0("flutter", "MemoryTrimmer::Trim");
+  const size_t target_bytes = GetTargetBytes(level);
+  size_t trimmed_bytes = 0;
+  for (Cache& cache : caches_) {
+    if (trimmed_bytes >= target_bytes) {
+      break;
+    }
+    size_t cache_bytes = cache.trim_callback(target_bytes - trimmed_bytes);
+    FML_DLOG(INFO) << "Trimmed " << cache_bytes << " bytes from "
+                   << cache.name;
+    trimmed_bytes += cache_bytes;
+  }
+  return trimmed_bytes;
+}
+
+}  // namespace flutter
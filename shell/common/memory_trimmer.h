@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_MEMORY_TRIMMER_H_
+#define FLUTTER_SHELL_COMMON_MEMORY_TRIMMER_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+/// How urgently the platform wants memory back.
+enum class MemoryPressureLevel {
+  /// Free about half of what the caches could give back, starting with the
+  /// caches that are cheapest to fill again.
+  kModerate,
+  /// Free everything the caches can give back.
+  kCritical,
+};
+
+/// Frees just enough memory from a set of caches to answer a memory pressure
+/// notification, instead of dropping every cache at once.
+///
+/// Each cache registers a callback that estimates how many bytes it could
+/// give back, and one that frees at least a given number of bytes. Caches
+/// are trimmed in the order they were registered, so caches that are cheap
+/// to fill again should be registered first.
+///
+/// This class is not thread-safe. The callbacks are called on the thread
+/// that calls |Trim|, which must be the thread the caches are used on.
+class MemoryTrimmer {
+ public:
+  /// Returns the number of bytes that the cache could free.
+  using EstimateCallback = std::function<size_t()>;
+
+  /// Frees at least the given number of bytes if the cache can, and returns
+  /// the number of bytes that it freed.
+  using TrimCallback = std::function<size_t(size_t bytes)>;
+
+  MemoryTrimmer();
+
+  ~MemoryTrimmer();
+
+  void RegisterCache(std::string name,
+                     EstimateCallback estimate_callback,
+                     TrimCallback trim_callback);
+
+  /// The number of bytes that all the caches together could free.
+  size_t EstimateTrimmableBytes() const;
+
+  /// The number of bytes that |Trim| aims to free for |level|.
+  size_t GetTargetBytes(MemoryPressureLevel level) const;
+
+  /// Trims the caches in order until the target for |level| is met, and
+  /// returns the number of bytes that were freed.
+  size_t Trim(MemoryPressureLevel level);
+
+ private:
+  struct Cache {
+    std::string name;
+    EstimateCallback estimate_callback;
+    TrimCallback trim_callback;
+  };
+
+  std::vector<Cache> caches_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MemoryTrimmer);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_MEMORY_TRIMMER_H_
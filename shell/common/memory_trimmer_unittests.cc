@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/memory_trimmer.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// A cache that holds |bytes| in entries of |entry_bytes| each.
+struct FakeCache {
+  size_t bytes;
+  size_t entry_bytes;
+
+  size_t Trim(size_t target) {
+    size_t trimmed = 0;
+    while (trimmed < target && bytes > 0) {
+      size_t entry = std::min(entry_bytes, bytes);
+      bytes -= entry;
+      trimmed += entry;
+    }
+    return trimmed;
+  }
+};
+
+void Register(MemoryTrimmer& trimmer,
+              const std::string& name,
+              FakeCache& cache,
+              std::vector<std::string>* trimmed_caches) {
+  trimmer.RegisterCache(
+      name, [&cache]() { return cache.bytes; },
+      [&cache, name, trimmed_caches](size_t bytes) {
+        trimmed_caches->push_back(name);
+        return cache.Trim(bytes);
+      });
+}
+
+}  // namespace
+
+TEST(MemoryTrimmerTest, ModeratePressureFreesHalfInRegistrationOrder) {
+  MemoryTrimmer trimmer;
+  FakeCache first{.bytes = 300, .entry_bytes = 100};
+  FakeCache second{.bytes = 500, .entry_bytes = 100};
+  FakeCache third{.bytes = 200, .entry_bytes = 100};
+  std::vector<std::string> trimmed_caches;
+  Register(trimmer, "first", first, &trimmed_caches);
+  Register(trimmer, "second", second, &trimmed_caches);
+  Register(trimmer, "third", third, &trimmed_caches);
+  EXPECT_EQ(trimmer.EstimateTrimmableBytes(), 1000u);
+  EXPECT_EQ(trimmer.GetTargetBytes(MemoryPressureLevel::kModerate), 500u);
+
+  EXPECT_EQ(trimmer.Trim(MemoryPressureLevel::kModerate), 500u);
+  EXPECT_EQ(first.bytes, 0u);
+  EXPECT_EQ(second.bytes, 300u);
+  EXPECT_EQ(third.bytes, 200u);
+  // The last cache is not asked once the target is met.
+  EXPECT_EQ(trimmed_caches, std::vector<std::string>({"first", "second"}));
+}
+
+TEST(MemoryTrimmerTest, CriticalPressureFreesEverything) {
+  MemoryTrimmer trimmer;
+  FakeCache first{.bytes = 300, .entry_bytes = 100};
+  FakeCache second{.bytes = 50, .entry_bytes = 100};
+  std::vector<std::string> trimmed_caches;
+  Register(trimmer, "first", first, &trimmed_caches);
+  Register(trimmer, "second", second, &trimmed_caches);
+
+  EXPECT_EQ(trimmer.Trim(MemoryPressureLevel::kCritical), 350u);
+  EXPECT_EQ(trimmer.EstimateTrimmableBytes(), 0u);
+  EXPECT_EQ(trimmed_caches, std::vector<std::string>({"first", "second"}));
+}
+
+TEST(MemoryTrimmerTest, CachesMayFreeMoreThanAsked) {
+  MemoryTrimmer trimmer;
+  FakeCache coarse{.bytes = 800, .entry_bytes = 800};
+  FakeCache fine{.bytes = 200, .entry_bytes = 1};
+  std::vector<std::string> trimmed_caches;
+  Register(trimmer, "coarse", coarse, &trimmed_caches);
+  Register(trimmer, "fine", fine, &trimmed_caches);
+
+  EXPECT_EQ(trimmer.Trim(MemoryPressureLevel::kModerate), 800u);
+  EXPECT_EQ(fine.bytes, 200u);
+  EXPECT_EQ(trimmed_caches, std::vector<std::string>({"coarse"}));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -30,6 +30,10 @@ static void CheckTextSkData(const sk_sp<SkData>& data,
   ASSERT_EQ(data_string, expected);
 }
 
+static sk_sp<SkData> MakeTextSkData(const std::string& text) {
+  return SkData::MakeWithCopy(text.data(), text.size());
+}
+
 static void ResetAssetManager() {
   PersistentCache::SetAssetManager(nullptr);
   ASSERT_EQ(PersistentCache::GetCacheForProcess()->LoadSkSLs().size(), 0u);
@@ -199,5 +203,95 @@ TEST_F(PersistentCacheTest, PurgeAllowsFutureSkSLCache) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(PersistentCacheTest, StoresAreWrittenBehindOnTheIOThread) {
+  sk_sp<SkData> first_key = MakeTextSkData("first");
+  sk_sp<SkData> second_key = MakeTextSkData("second");
+  sk_sp<SkData> old_value = MakeTextSkData("old");
+  sk_sp<SkData> new_value = MakeTextSkData("new");
+
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::ResetCacheForProcess();
+
+  auto settings = CreateSettingsForFixture();
+  settings.cache_sksl = true;
+  auto config = RunConfiguration::InferFromSettings(settings);
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  RunEngine(shell.get(), std::move(config));
+  auto persistent_cache = PersistentCache::GetCacheForProcess();
+  ASSERT_EQ(persistent_cache->LoadSkSLs().size(), 0u);
+
+  // The second store of the first key replaces the first one.
+  StorePersistentCache(persistent_cache, *first_key, *old_value);
+  StorePersistentCache(persistent_cache, *second_key, *old_value);
+  StorePersistentCache(persistent_cache, *first_key, *new_value);
+  std::promise<bool> io_flushed;
+  shell->GetTaskRunners().GetIOTaskRunner()->PostTask(
+      [&io_flushed]() { io_flushed.set_value(true); });
+  io_flushed.get_future().get();  // Wait for the IO thread to flush the files.
+
+  auto shaders = persistent_cache->LoadSkSLs();
+  ASSERT_EQ(shaders.size(), 2u);
+  if (shaders[0].key->equals(second_key.get())) {
+    std::swap(shaders[0], shaders[1]);
+  }
+  CheckTextSkData(shaders[0].value, "new");
+  CheckTextSkData(shaders[1].value, "old");
+
+  // Cleanup
+  fml::RemoveFilesInDirectory(base_dir.fd());
+  DestroyShell(std::move(shell));
+}
+
+TEST_F(PersistentCacheTest, CachedSkSLsArePreferredOverPackagedOnes) {
+  // Avoid polluting unit tests output by hiding INFO level logging.
+  fml::LogSettings warning_only = {fml::kLogWarning};
+  fml::ScopedSetLogSettings scoped_set_log_settings(warning_only);
+
+  // "IE" is the Base32 encoding of "A", and "eA==" the Base64 encoding of "x".
+  const std::string kTestJson =
+      "{\n"
+      "  \"data\": {\n"
+      "    \"IE\": \"eA==\"\n"
+      "  }\n"
+      "}\n";
+  fml::ScopedTemporaryDirectory asset_dir;
+  auto data = std::make_unique<fml::DataMapping>(
+      std::vector<uint8_t>{kTestJson.begin(), kTestJson.end()});
+  fml::WriteAtomically(asset_dir.fd(), PersistentCache::kAssetFileName, *data);
+
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::ResetCacheForProcess();
+
+  auto settings = CreateSettingsForFixture();
+  settings.cache_sksl = true;
+  settings.assets_path = asset_dir.path();
+  auto config = RunConfiguration::InferFromSettings(settings);
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  RunEngine(shell.get(), std::move(config));
+  auto persistent_cache = PersistentCache::GetCacheForProcess();
+  ASSERT_EQ(persistent_cache->LoadSkSLs().size(), 1u);
+
+  StorePersistentCache(persistent_cache, *MakeTextSkData("A"),
+                       *MakeTextSkData("cached"));
+  std::promise<bool> io_flushed;
+  shell->GetTaskRunners().GetIOTaskRunner()->PostTask(
+      [&io_flushed]() { io_flushed.set_value(true); });
+  io_flushed.get_future().get();  // Wait for the IO thread to flush the file.
+
+  auto shaders = persistent_cache->LoadSkSLs();
+  ASSERT_EQ(shaders.size(), 1u);
+  CheckTextSkData(shaders[0].value, "cached");
+
+  // Cleanup
+  PersistentCache::SetAssetManager(nullptr);
+  fml::RemoveFilesInDirectory(base_dir.fd());
+  fml::UnlinkFile(asset_dir.fd(), PersistentCache::kAssetFileName);
+  DestroyShell(std::move(shell));
+}
+
 }  // namespace testing
 }  // namespace flutter
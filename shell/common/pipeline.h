@@ -8,6 +8,7 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer_tree.h"
@@ -181,6 +182,20 @@ class Pipeline {
 
   /// @note Procedure doesn't copy all closures.
   [[nodiscard]] PipelineConsumeResult Consume(const Consumer& consumer) {
+    return ConsumeSkippingStale(consumer, nullptr);
+  }
+
+  using StalePredicate = std::function<bool(const Resource& resource)>;
+
+  /// Like |Consume|, but first drops the items at the front of the queue for
+  /// which `is_stale` returns true, as long as a newer item is queued behind
+  /// them. The consumer gets the oldest item that isn't stale, or the newest
+  /// one if all of them are.
+  ///
+  /// A null `is_stale` drops nothing.
+  [[nodiscard]] PipelineConsumeResult ConsumeSkippingStale(
+      const Consumer& consumer,
+      const StalePredicate& is_stale) {
     if (consumer == nullptr) {
       return PipelineConsumeResult::NoneAvailable;
     }
@@ -192,14 +207,31 @@ class Pipeline {
     ResourcePtr resource;
     size_t trace_id = 0;
     size_t items_count = 0;
+    std::vector<std::pair<ResourcePtr, size_t>> dropped;
 
     {
       std::scoped_lock lock(queue_mutex_);
+      // Each dropped item must be accounted for in |available_| just like the
+      // consumed one. An item is only counted once its commit has signaled.
+      while (is_stale && queue_.size() > 1 &&
+             (!queue_.front().first || is_stale(*queue_.front().first)) &&
+             available_.TryWait()) {
+        dropped.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
       std::tie(resource, trace_id) = std::move(queue_.front());
       queue_.pop_front();
       items_count = queue_.size();
     }
 
+    for (auto& [dropped_resource, dropped_trace_id] : dropped) {
+      dropped_resource.reset();
+      empty_.Signal();
+      --inflight_;
+      TRACE_FLOW_END("flutter", "PipelineItem", dropped_trace_id);
+      TRACE_EVENT_ASYNC_END0("flutter", "PipelineItem", dropped_trace_id);
+    }
+
     consumer(std::move(resource));
 
     empty_.Signal();
@@ -107,6 +107,55 @@ TEST(PipelineTest, PushingMultiProcessesInOrder) {
   ASSERT_EQ(consume_result_2, PipelineConsumeResult::Done);
 }
 
+TEST(PipelineTest, ConsumeSkippingStaleDropsStaleItemsWithNewerBehind) {
+  const int depth = 4;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
+  for (int i = 1; i <= 3; i++) {
+    Continuation continuation = pipeline->Produce();
+    ASSERT_TRUE(continuation.Complete(std::make_unique<int>(i)).success);
+  }
+
+  // Items below 3 are stale, so 1 and 2 are dropped.
+  auto is_stale = [](const int& v) { return v < 3; };
+  int consumed = 0;
+  PipelineConsumeResult consume_result = pipeline->ConsumeSkippingStale(
+      [&consumed](std::unique_ptr<int> v) { consumed = *v; }, is_stale);
+  ASSERT_EQ(consume_result, PipelineConsumeResult::Done);
+  ASSERT_EQ(consumed, 3);
+
+  // The dropped items no longer take up room in the pipeline.
+  for (int i = 0; i < depth; i++) {
+    ASSERT_TRUE(pipeline->Produce());
+  }
+}
+
+TEST(PipelineTest, ConsumeSkippingStaleKeepsNewestAndFreshItems) {
+  const int depth = 3;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
+  for (int i = 1; i <= 3; i++) {
+    Continuation continuation = pipeline->Produce();
+    ASSERT_TRUE(continuation.Complete(std::make_unique<int>(i)).success);
+  }
+
+  // Only 2 is stale, but 1 is in front of it and isn't.
+  auto is_stale = [](const int& v) { return v == 2; };
+  int consumed = 0;
+  auto consumer = [&consumed](std::unique_ptr<int> v) { consumed = *v; };
+  ASSERT_EQ(pipeline->ConsumeSkippingStale(consumer, is_stale),
+            PipelineConsumeResult::MoreAvailable);
+  ASSERT_EQ(consumed, 1);
+  ASSERT_EQ(pipeline->ConsumeSkippingStale(consumer, is_stale),
+            PipelineConsumeResult::Done);
+  ASSERT_EQ(consumed, 3);
+
+  // The last item is consumed even if it is stale.
+  Continuation continuation = pipeline->Produce();
+  ASSERT_TRUE(continuation.Complete(std::make_unique<int>(2)).success);
+  ASSERT_EQ(pipeline->ConsumeSkippingStale(consumer, is_stale),
+            PipelineConsumeResult::Done);
+  ASSERT_EQ(consumed, 2);
+}
+
 TEST(PipelineTest, ProduceIfEmptyDoesNotConsumeWhenQueueIsNotEmpty) {
   const int depth = 2;
   std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
@@ -137,6 +137,10 @@ void PlatformView::MarkTextureFrameAvailable(int64_t texture_id) {
   delegate_.OnPlatformViewMarkTextureFrameAvailable(texture_id);
 }
 
+void PlatformView::PrepareToEmbedPlatformViews() {
+  delegate_.OnPlatformViewPrepareToEmbedPlatformViews();
+}
+
 std::unique_ptr<Surface> PlatformView::CreateRenderingSurface() {
   // We have a default implementation because tests create a platform view but
   // never a rendering surface.
@@ -226,6 +226,13 @@ class PlatformView {
     virtual void OnPlatformViewMarkTextureFrameAvailable(
         int64_t texture_id) = 0;
 
+    //--------------------------------------------------------------------------
+    /// @brief      Notifies the delegate that the embedder expects a frame
+    ///             with platform views soon. The rasterizer may get ready to
+    ///             draw platform views before that frame arrives.
+    ///
+    virtual void OnPlatformViewPrepareToEmbedPlatformViews() = 0;
+
     //--------------------------------------------------------------------------
     /// @brief      Loads the dart shared library into the dart VM. When the
     ///             dart library is loaded successfully, the dart future
@@ -677,6 +684,17 @@ class PlatformView {
   ///
   void MarkTextureFrameAvailable(int64_t texture_id);
 
+  //--------------------------------------------------------------------------
+  /// @brief      Used by the embedder to hint that a frame with platform views
+  ///             is likely to be drawn soon, for example right after it
+  ///             created a platform view for the framework.
+  ///
+  ///             If the platform views are drawn with the raster and platform
+  ///             threads merged, the threads are merged ahead of that frame,
+  ///             which then is not dropped and retried to wait for the merge.
+  ///
+  void PrepareToEmbedPlatformViews();
+
   //--------------------------------------------------------------------------
   /// @brief      Directly invokes platform-specific APIs to compute the
   ///             locale the platform would have natively resolved to.
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
+#include <algorithm>
+
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -15,6 +17,11 @@ SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
     : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
 
+ResamplingPointerDataDispatcher::ResamplingPointerDataDispatcher(
+    Delegate& delegate)
+    : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
+ResamplingPointerDataDispatcher::~ResamplingPointerDataDispatcher() = default;
+
 void DefaultPointerDataDispatcher::DispatchPacket(
     std::unique_ptr<PointerDataPacket> packet,
     uint64_t trace_flow_id) {
@@ -72,4 +79,160 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+namespace {
+
+bool IsResampledMove(const PointerData& data) {
+  return data.change == PointerData::Change::kMove &&
+         data.signal_kind == PointerData::SignalKind::kNone;
+}
+
+}  // namespace
+
+void ResamplingPointerDataDispatcher::DispatchPacket(
+    std::unique_ptr<PointerDataPacket> packet,
+    uint64_t trace_flow_id) {
+  TRACE_EVENT0_WITH_FLOW_IDS("flutter",
+                             "ResamplingPointerDataDispatcher::DispatchPacket",
+                             /*flow_id_count=*/1, &trace_flow_id);
+  TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
+
+  const size_t length = packet->GetLength();
+  bool only_moves = length > 0;
+  for (size_t i = 0; i < length && only_moves; i++) {
+    PointerData data = packet->GetPointerData(i);
+    only_moves = IsResampledMove(data) && pointers_.count(data.device) > 0;
+  }
+
+  if (only_moves) {
+    for (size_t i = 0; i < length; i++) {
+      PointerData data = packet->GetPointerData(i);
+      PointerState& state = pointers_[data.device];
+      state.previous = state.latest;
+      state.latest = data;
+      state.has_previous = true;
+      state.has_pending_move = true;
+    }
+    pending_trace_flow_ids_.push_back(trace_flow_id);
+    ScheduleSecondaryVsyncCallback();
+    return;
+  }
+
+  // The held back moves happened before anything in this packet.
+  DispatchPendingMoves(std::nullopt);
+  for (size_t i = 0; i < length; i++) {
+    PointerData data = packet->GetPointerData(i);
+    switch (data.change) {
+      case PointerData::Change::kDown: {
+        PointerState& state = pointers_[data.device];
+        state = PointerState();
+        state.latest = data;
+        state.dispatched_x = data.physical_x;
+        state.dispatched_y = data.physical_y;
+        break;
+      }
+      case PointerData::Change::kMove: {
+        auto found = pointers_.find(data.device);
+        if (found != pointers_.end() && IsResampledMove(data)) {
+          found->second.previous = found->second.latest;
+          found->second.latest = data;
+          found->second.has_previous = true;
+          found->second.dispatched_x = data.physical_x;
+          found->second.dispatched_y = data.physical_y;
+        }
+        break;
+      }
+      case PointerData::Change::kUp:
+      case PointerData::Change::kCancel:
+      case PointerData::Change::kRemove:
+        pointers_.erase(data.device);
+        break;
+      default:
+        break;
+    }
+  }
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               trace_flow_id);
+}
+
+void ResamplingPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
+  delegate_.ScheduleSecondaryVsyncCallback(
+      reinterpret_cast<uintptr_t>(this),
+      [dispatcher = weak_factory_.GetWeakPtr()]() {
+        if (dispatcher) {
+          dispatcher->DispatchPendingMoves(fml::TimePoint::Now() -
+                                           kResampleLatency);
+        }
+      });
+}
+
+void ResamplingPointerDataDispatcher::DispatchPendingMoves(
+    std::optional<fml::TimePoint> sample_time) {
+  if (pending_trace_flow_ids_.empty()) {
+    return;
+  }
+  TRACE_EVENT0("flutter",
+               "ResamplingPointerDataDispatcher::DispatchPendingMoves");
+
+  std::vector<PointerData> moves;
+  for (auto& [device, state] : pointers_) {
+    if (!state.has_pending_move) {
+      continue;
+    }
+    PointerData move = sample_time.has_value() && state.has_previous
+                           ? Resample(state.previous, state.latest,
+                                      sample_time.value())
+                           : state.latest;
+    move.physical_delta_x = move.physical_x - state.dispatched_x;
+    move.physical_delta_y = move.physical_y - state.dispatched_y;
+    state.dispatched_x = move.physical_x;
+    state.dispatched_y = move.physical_y;
+    state.has_pending_move = false;
+    moves.push_back(move);
+  }
+
+  // Only the flow of the last packet is carried on to the frame that the
+  // moves are dispatched for.
+  uint64_t trace_flow_id = pending_trace_flow_ids_.back();
+  pending_trace_flow_ids_.pop_back();
+  for (uint64_t coalesced_flow_id : pending_trace_flow_ids_) {
+    TRACE_FLOW_END("flutter", "PointerEvent", coalesced_flow_id);
+  }
+  pending_trace_flow_ids_.clear();
+
+  auto packet = std::make_unique<PointerDataPacket>(moves.size());
+  for (size_t i = 0; i < moves.size(); i++) {
+    packet->SetPointerData(i, moves[i]);
+  }
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               trace_flow_id);
+}
+
+PointerData ResamplingPointerDataDispatcher::Resample(
+    const PointerData& previous,
+    const PointerData& latest,
+    fml::TimePoint sample_time) {
+  const int64_t interval = latest.time_stamp - previous.time_stamp;
+  const int64_t sample = sample_time.ToEpochDelta().ToMicroseconds();
+  if (interval < kMinSampleInterval.ToMicroseconds() ||
+      sample < previous.time_stamp) {
+    return latest;
+  }
+  // Predict no further ahead than half the time between the events, as
+  // that is as much as they say about where the pointer is going.
+  const int64_t max_sample =
+      latest.time_stamp +
+      std::min<int64_t>(kMaxPrediction.ToMicroseconds(), interval / 2);
+  const int64_t clamped_sample = std::min(sample, max_sample);
+  const double alpha =
+      static_cast<double>(clamped_sample - previous.time_stamp) / interval;
+
+  PointerData resampled = latest;
+  resampled.time_stamp = clamped_sample;
+  resampled.physical_x =
+      previous.physical_x + alpha * (latest.physical_x - previous.physical_x);
+  resampled.physical_y =
+      previous.physical_y + alpha * (latest.physical_y - previous.physical_y);
+  return resampled;
+}
+
 }  // namespace flutter
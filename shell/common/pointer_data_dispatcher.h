@@ -5,6 +5,12 @@
 #ifndef POINTER_DATA_DISPATCHER_H_
 #define POINTER_DATA_DISPATCHER_H_
 
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/shell/common/animator.h"
 
@@ -163,6 +169,80 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
 };
 
+//------------------------------------------------------------------------------
+/// A dispatcher that moves pointers to where they were at the time of each
+/// VSYNC, rather than to wherever the last event that happened to arrive
+/// before it put them. This keeps scrolling smooth when the digitizer samples
+/// at a rate that is not a multiple of the refresh rate, such as 240Hz and up,
+/// without holding events back for a whole frame.
+///
+/// It works as follows:
+///
+/// Packets that only move pointers that are down are held until the next
+/// VSYNC. At the VSYNC, each pointer that moved gets one move event, at the
+/// position interpolated between its last two events for the sample time,
+/// which is `kResampleLatency` before the VSYNC. If the last event is older
+/// than the sample time, the position is extrapolated instead, by no more than
+/// `kMaxPrediction` or half the time between the two events. The VSYNC time is
+/// taken to be when the secondary VSYNC callback runs.
+///
+/// Any other packet, such as one that puts a pointer down or lifts it, is
+/// dispatched right away, after the moves that are held back.
+///
+/// The event times must be on the same clock as `fml::TimePoint::Now`, which
+/// is the case for the Android and iOS embeddings.
+class ResamplingPointerDataDispatcher : public DefaultPointerDataDispatcher {
+ public:
+  static constexpr fml::TimeDelta kResampleLatency =
+      fml::TimeDelta::FromMilliseconds(5);
+  static constexpr fml::TimeDelta kMaxPrediction =
+      fml::TimeDelta::FromMilliseconds(8);
+  // Events closer together than this are too noisy to resample from.
+  static constexpr fml::TimeDelta kMinSampleInterval =
+      fml::TimeDelta::FromMilliseconds(2);
+
+  explicit ResamplingPointerDataDispatcher(Delegate& delegate);
+
+  // |PointerDataDispatcer|
+  void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                      uint64_t trace_flow_id) override;
+
+  virtual ~ResamplingPointerDataDispatcher();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns `latest` moved to where the pointer would have been
+  ///             at `sample_time`, going by `previous` and `latest`, which
+  ///             are the last two events of the pointer. Its deltas are left
+  ///             as is.
+  ///
+  static PointerData Resample(const PointerData& previous,
+                              const PointerData& latest,
+                              fml::TimePoint sample_time);
+
+ private:
+  struct PointerState {
+    PointerData previous;
+    PointerData latest;
+    bool has_previous = false;
+    bool has_pending_move = false;
+    double dispatched_x = 0;
+    double dispatched_y = 0;
+  };
+
+  // Dispatches the held back moves, resampled for |sample_time| if there is
+  // one.
+  void DispatchPendingMoves(std::optional<fml::TimePoint> sample_time);
+  void ScheduleSecondaryVsyncCallback();
+
+  // Keyed by |PointerData::device|, for the pointers that are down.
+  std::map<int64_t, PointerState> pointers_;
+  std::vector<uint64_t> pending_trace_flow_ids_;
+
+  // WeakPtrFactory must be the last member.
+  fml::WeakPtrFactory<ResamplingPointerDataDispatcher> weak_factory_;
+  FML_DISALLOW_COPY_AND_ASSIGN(ResamplingPointerDataDispatcher);
+};
+
 //--------------------------------------------------------------------------
 /// @brief      Signature for constructing PointerDataDispatcher.
 ///
@@ -0,0 +1,182 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/pointer_data_dispatcher.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class FakeDispatcherDelegate : public PointerDataDispatcher::Delegate {
+ public:
+  void DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                        uint64_t trace_flow_id) override {
+    for (size_t i = 0; i < packet->GetLength(); i++) {
+      dispatched.push_back(packet->GetPointerData(i));
+    }
+  }
+
+  void ScheduleSecondaryVsyncCallback(uintptr_t id,
+                                      const fml::closure& callback) override {
+    vsync_callback = callback;
+  }
+
+  void FireVsync() {
+    fml::closure callback = std::move(vsync_callback);
+    vsync_callback = nullptr;
+    if (callback) {
+      callback();
+    }
+  }
+
+  std::vector<PointerData> dispatched;
+  fml::closure vsync_callback;
+};
+
+PointerData CreatePointerData(PointerData::Change change,
+                              fml::TimePoint time,
+                              double x,
+                              double y) {
+  PointerData data;
+  data.Clear();
+  data.time_stamp = time.ToEpochDelta().ToMicroseconds();
+  data.change = change;
+  data.kind = PointerData::DeviceKind::kTouch;
+  data.signal_kind = PointerData::SignalKind::kNone;
+  data.physical_x = x;
+  data.physical_y = y;
+  return data;
+}
+
+std::unique_ptr<PointerDataPacket> CreatePacket(const PointerData& data) {
+  auto packet = std::make_unique<PointerDataPacket>(1);
+  packet->SetPointerData(0, data);
+  return packet;
+}
+
+fml::TimeDelta Ms(int64_t milliseconds) {
+  return fml::TimeDelta::FromMilliseconds(milliseconds);
+}
+
+}  // namespace
+
+TEST(ResamplingPointerDataDispatcherTest, ResampleInterpolatesBetweenEvents) {
+  fml::TimePoint start = fml::TimePoint::Now();
+  PointerData previous =
+      CreatePointerData(PointerData::Change::kMove, start, 0, 0);
+  PointerData latest =
+      CreatePointerData(PointerData::Change::kMove, start + Ms(4), 40, 80);
+  PointerData resampled = ResamplingPointerDataDispatcher::Resample(
+      previous, latest, start + Ms(1));
+  EXPECT_EQ(resampled.time_stamp,
+            (start + Ms(1)).ToEpochDelta().ToMicroseconds());
+  EXPECT_DOUBLE_EQ(resampled.physical_x, 10);
+  EXPECT_DOUBLE_EQ(resampled.physical_y, 20);
+}
+
+TEST(ResamplingPointerDataDispatcherTest, ResampleLimitsPrediction) {
+  fml::TimePoint start = fml::TimePoint::Now();
+  PointerData previous =
+      CreatePointerData(PointerData::Change::kMove, start, 0, 0);
+  PointerData latest =
+      CreatePointerData(PointerData::Change::kMove, start + Ms(4), 40, 0);
+
+  // No further ahead than half the time between the events.
+  PointerData resampled = ResamplingPointerDataDispatcher::Resample(
+      previous, latest, start + Ms(20));
+  EXPECT_EQ(resampled.time_stamp,
+            (start + Ms(6)).ToEpochDelta().ToMicroseconds());
+  EXPECT_DOUBLE_EQ(resampled.physical_x, 60);
+
+  // And no further ahead than |kMaxPrediction|.
+  latest = CreatePointerData(PointerData::Change::kMove, start + Ms(40), 40, 0);
+  resampled = ResamplingPointerDataDispatcher::Resample(previous, latest,
+                                                        start + Ms(100));
+  EXPECT_EQ(resampled.time_stamp,
+            (start + Ms(40) + ResamplingPointerDataDispatcher::kMaxPrediction)
+                .ToEpochDelta()
+                .ToMicroseconds());
+  EXPECT_DOUBLE_EQ(resampled.physical_x, 48);
+}
+
+TEST(ResamplingPointerDataDispatcherTest, ResampleNeedsEventsFarEnoughApart) {
+  fml::TimePoint start = fml::TimePoint::Now();
+  PointerData previous =
+      CreatePointerData(PointerData::Change::kMove, start, 0, 0);
+  PointerData latest =
+      CreatePointerData(PointerData::Change::kMove, start + Ms(1), 10, 0);
+  PointerData resampled = ResamplingPointerDataDispatcher::Resample(
+      previous, latest, start + Ms(2));
+  EXPECT_EQ(resampled.time_stamp, latest.time_stamp);
+  EXPECT_DOUBLE_EQ(resampled.physical_x, 10);
+}
+
+TEST(ResamplingPointerDataDispatcherTest, CoalescesMovesUntilVsync) {
+  FakeDispatcherDelegate delegate;
+  ResamplingPointerDataDispatcher dispatcher(delegate);
+  fml::TimePoint start = fml::TimePoint::Now() - Ms(100);
+
+  dispatcher.DispatchPacket(
+      CreatePacket(CreatePointerData(PointerData::Change::kDown, start, 0, 0)),
+      1);
+  ASSERT_EQ(delegate.dispatched.size(), 1u);
+  EXPECT_EQ(delegate.vsync_callback, nullptr);
+
+  for (int i = 1; i <= 4; i++) {
+    dispatcher.DispatchPacket(
+        CreatePacket(CreatePointerData(PointerData::Change::kMove,
+                                       start + Ms(4 * i), 10 * i, 0)),
+        1 + i);
+  }
+  EXPECT_EQ(delegate.dispatched.size(), 1u);
+
+  // The vsync is long after the last move, so the move is predicted as far
+  // ahead as it can be.
+  delegate.FireVsync();
+  ASSERT_EQ(delegate.dispatched.size(), 2u);
+  const PointerData& move = delegate.dispatched.back();
+  EXPECT_EQ(move.change, PointerData::Change::kMove);
+  EXPECT_EQ(move.time_stamp, (start + Ms(18)).ToEpochDelta().ToMicroseconds());
+  EXPECT_DOUBLE_EQ(move.physical_x, 45);
+  EXPECT_DOUBLE_EQ(move.physical_delta_x, 45);
+
+  // Nothing moved since.
+  delegate.FireVsync();
+  EXPECT_EQ(delegate.dispatched.size(), 2u);
+}
+
+TEST(ResamplingPointerDataDispatcherTest, DispatchesHeldMovesBeforeUp) {
+  FakeDispatcherDelegate delegate;
+  ResamplingPointerDataDispatcher dispatcher(delegate);
+  fml::TimePoint start = fml::TimePoint::Now();
+
+  dispatcher.DispatchPacket(
+      CreatePacket(CreatePointerData(PointerData::Change::kDown, start, 0, 0)),
+      1);
+  dispatcher.DispatchPacket(
+      CreatePacket(CreatePointerData(PointerData::Change::kMove,
+                                     start + Ms(4), 5, 0)),
+      2);
+  dispatcher.DispatchPacket(
+      CreatePacket(
+          CreatePointerData(PointerData::Change::kUp, start + Ms(8), 5, 0)),
+      3);
+
+  ASSERT_EQ(delegate.dispatched.size(), 3u);
+  EXPECT_EQ(delegate.dispatched[1].change, PointerData::Change::kMove);
+  EXPECT_DOUBLE_EQ(delegate.dispatched[1].physical_x, 5);
+  EXPECT_EQ(delegate.dispatched[2].change, PointerData::Change::kUp);
+
+  // The move is not dispatched again at the vsync.
+  delegate.FireVsync();
+  EXPECT_EQ(delegate.dispatched.size(), 3u);
+}
+
+}  // namespace testing
+}  // namespace flutter
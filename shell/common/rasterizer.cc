@@ -12,10 +12,16 @@
 #include "flutter/common/constants.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/flow/layers/offscreen_surface.h"
+#include "flutter/fml/parallel_for.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/base64.h"
 #include "flutter/shell/common/serialization_callbacks.h"
+#if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/lib/ui/painting/image_encoding_impeller.h"
+#include "impeller/entity/contents/content_context.h"  // nogncheck
+#include "impeller/typographer/lazy_glyph_atlas.h"     // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #include "fml/make_copyable.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkData.h"
@@ -49,6 +55,7 @@ Rasterizer::Rasterizer(Delegate& delegate,
           SnapshotController::Make(*this, delegate.GetSettings())),
       weak_factory_(this) {
   FML_DCHECK(compositor_context_);
+  RegisterTrimmableCaches();
 }
 
 Rasterizer::~Rasterizer() = default;
@@ -155,23 +162,124 @@ void Rasterizer::DisableThreadMergerIfNeeded() {
   }
 }
 
-void Rasterizer::NotifyLowMemoryWarning() const {
-  if (!surface_) {
-    FML_DLOG(INFO)
-        << "Rasterizer::NotifyLowMemoryWarning called with no surface.";
-    return;
-  }
-  auto context = surface_->GetContext();
-  if (!context) {
-    FML_DLOG(INFO)
-        << "Rasterizer::NotifyLowMemoryWarning called with no GrContext.";
-    return;
+void Rasterizer::NotifyLowMemoryWarning() {
+  NotifyMemoryPressure(MemoryPressureLevel::kCritical);
+}
+
+void Rasterizer::NotifyMemoryPressure(MemoryPressureLevel level) {
+  TRACE_EVENT0("flutter", "Rasterizer::NotifyMemoryPressure");
+  std::unique_ptr<GLContextResult> context_switch;
+  if (surface_) {
+    context_switch = surface_->MakeRenderContextCurrent();
+    if (!context_switch->GetResult()) {
+      return;
+    }
   }
-  auto context_switch = surface_->MakeRenderContextCurrent();
-  if (!context_switch->GetResult()) {
+  memory_trimmer_.Trim(level);
+}
+
+// The caches are trimmed in the order in which they are registered, so the
+// ones that are cheapest to fill again come first.
+void Rasterizer::RegisterTrimmableCaches() {
+#if IMPELLER_SUPPORTS_RENDERING
+  memory_trimmer_.RegisterCache(
+      "RenderTargetCache",
+      [this]() -> size_t {
+        auto aiks_context = surface_ ? surface_->GetAiksContext() : nullptr;
+        if (!aiks_context) {
+          return 0;
+        }
+        return aiks_context->GetContentContext()
+            .GetRenderTargetCache()
+            ->GetIdleByteSize();
+      },
+      [this](size_t bytes) -> size_t {
+        auto aiks_context = surface_ ? surface_->GetAiksContext() : nullptr;
+        if (!aiks_context) {
+          return 0;
+        }
+        return aiks_context->GetContentContext().GetRenderTargetCache()->Trim(
+            bytes);
+      });
+  memory_trimmer_.RegisterCache(
+      "GlyphAtlas",
+      [this]() -> size_t {
+        auto aiks_context = surface_ ? surface_->GetAiksContext() : nullptr;
+        if (!aiks_context) {
+          return 0;
+        }
+        return aiks_context->GetContentContext()
+            .GetLazyGlyphAtlas()
+            ->GetTrimmableByteSize();
+      },
+      [this](size_t bytes) -> size_t {
+        auto aiks_context = surface_ ? surface_->GetAiksContext() : nullptr;
+        if (!aiks_context) {
+          return 0;
+        }
+        return aiks_context->GetContentContext().GetLazyGlyphAtlas()->Trim(
+            bytes);
+      });
+#endif  // IMPELLER_SUPPORTS_RENDERING
+  memory_trimmer_.RegisterCache(
+      "RasterCache",
+      [this]() {
+        RasterCache& raster_cache = compositor_context_->raster_cache();
+        return raster_cache.EstimatePictureCacheByteSize() +
+               raster_cache.EstimateLayerCacheByteSize();
+      },
+      [this](size_t bytes) {
+        return compositor_context_->raster_cache().Trim(bytes);
+      });
+  memory_trimmer_.RegisterCache(
+      "SkiaResourceCache",
+      [this]() -> size_t {
+        auto context = surface_ ? surface_->GetContext() : nullptr;
+        return context ? context->getResourceCachePurgeableBytes() : 0;
+      },
+      [this](size_t bytes) -> size_t {
+        auto context = surface_ ? surface_->GetContext() : nullptr;
+        if (!context) {
+          return 0;
+        }
+        size_t before = context->getResourceCachePurgeableBytes();
+        if (bytes >= before) {
+          context->performDeferredCleanup(std::chrono::milliseconds(0));
+        } else {
+          context->purgeUnlockedResources(bytes, /*preferScratchResources=*/
+                                          true);
+        }
+        return before - std::min(before,
+                                 context->getResourceCachePurgeableBytes());
+      });
+}
+
+void Rasterizer::WarmUpRasterCache(fml::TimePoint deadline) {
+  TRACE_EVENT0("flutter", "Rasterizer::WarmUpRasterCache");
+  if (!surface_ || !surface_->EnableRasterCache()) {
     return;
   }
-  context->performDeferredCleanup(std::chrono::milliseconds(0));
+  delegate_.GetIsGpuDisabledSyncSwitch()->Execute(
+      fml::SyncSwitch::Handlers().SetIfFalse([&] {
+        auto context_switch = surface_->MakeRenderContextCurrent();
+        if (!context_switch->GetResult()) {
+          return;
+        }
+        for (auto& [view_id, view_record] : view_records_) {
+          if (!view_record.last_successful_task) {
+            continue;
+          }
+          LayerTree* layer_tree =
+              view_record.last_successful_task->layer_tree.get();
+          if (!layer_tree || layer_tree->is_leaf_layer_tracing_enabled()) {
+            continue;
+          }
+          layer_tree->WarmUpRasterCache(*compositor_context_,
+                                        surface_->GetContext(),
+                                        surface_->GetAiksContext().get(),
+                                        deadline);
+        }
+      }));
 }
 
 void Rasterizer::CollectView(int64_t view_id) {
@@ -243,7 +351,17 @@ DrawStatus Rasterizer::Draw(const std::shared_ptr<FramePipeline>& pipeline) {
                          std::move(item->layer_tree_tasks));
   };
 
-  PipelineConsumeResult consume_result = pipeline->Consume(consumer);
+  // A frame that missed its target time is only dropped for a newer one, so
+  // the newest frame is always drawn.
+  FramePipeline::StalePredicate is_late;
+  if (delegate_.GetSettings().drop_late_frames) {
+    is_late = [now = fml::TimePoint::Now()](const FrameItem& item) {
+      return item.frame_timings_recorder->GetVsyncTargetTime() < now;
+    };
+  }
+
+  PipelineConsumeResult consume_result =
+      pipeline->ConsumeSkippingStale(consumer, is_late);
   if (consume_result == PipelineConsumeResult::NoneAvailable) {
     return DrawStatus::kPipelineEmpty;
   }
@@ -528,6 +646,32 @@ Rasterizer::DoDrawResult Rasterizer::DoDraw(
   return result;
 }
 
+#if IMPELLER_SUPPORTS_RENDERING
+// Reports the device memory held by the resources of the Impeller context
+// once a frame, so it can be graphed next to the frames in a timeline.
+static void TraceDeviceMemoryUsage(
+    const std::weak_ptr<impeller::Context>& impeller_context) {
+  auto context = impeller_context.lock();
+  if (!context || !context->GetResourceAllocator()) {
+    return;
+  }
+  auto usage = context->GetResourceAllocator()->GetDeviceMemoryUsage();
+  using Category = impeller::DeviceMemoryCategory;
+  static constexpr int64_t kDeviceMemoryTraceID = 1989;
+  FML_TRACE_COUNTER(
+      "flutter",                                                         //
+      "ImpellerDeviceMemory",                                            //
+      kDeviceMemoryTraceID,                                              //
+      "DeviceBufferBytes", usage.GetBytes(Category::kDeviceBuffer),      //
+      "HostVisibleBufferBytes",                                          //
+      usage.GetBytes(Category::kHostVisibleBuffer),                      //
+      "TextureBytes", usage.GetBytes(Category::kTexture),                //
+      "RenderTargetBytes", usage.GetBytes(Category::kRenderTarget),      //
+      "DeviceHeapBytes", usage.device_heap_bytes.value_or(0u)            //
+  );
+}
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 Rasterizer::DoDrawResult Rasterizer::DrawToSurfaces(
     FrameTimingsRecorder& frame_timings_recorder,
     std::vector<std::unique_ptr<LayerTreeTask>> tasks) {
@@ -555,6 +699,9 @@ Rasterizer::DoDrawResult Rasterizer::DrawToSurfaces(
             }));
   }
   frame_timings_recorder.AssertInState(FrameTimingsRecorder::State::kRasterEnd);
+#if IMPELLER_SUPPORTS_RENDERING
+  TraceDeviceMemoryUsage(impeller_context_);
+#endif  // IMPELLER_SUPPORTS_RENDERING
 
   return result;
 }
@@ -604,6 +751,11 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
 
   frame_timings_recorder.RecordRasterStart(fml::TimePoint::Now());
 
+  // With several views, frames whose submission can be prepared off the
+  // raster thread are held back until every view has been drawn.
+  std::vector<std::unique_ptr<SurfaceFrame>> deferred_frames;
+  bool defer_submission = concurrent_view_task_runner_ && tasks.size() > 1;
+
   // Second traverse: draw all layer trees.
   std::vector<std::unique_ptr<LayerTreeTask>> resubmitted_tasks;
   for (std::unique_ptr<LayerTreeTask>& task : tasks) {
@@ -612,12 +764,14 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
     float device_pixel_ratio = task->device_pixel_ratio;
 
     DrawSurfaceStatus status = DrawToSurfaceUnsafe(
-        view_id, *layer_tree, device_pixel_ratio, presentation_time);
+        view_id, *layer_tree, device_pixel_ratio, presentation_time,
+        frame_timings_recorder, defer_submission ? &deferred_frames : nullptr);
     FML_DCHECK(status != DrawSurfaceStatus::kDiscarded);
 
     auto& view_record = EnsureViewRecord(task->view_id);
     view_record.last_draw_status = status;
-    if (status == DrawSurfaceStatus::kSuccess) {
+    if (status == DrawSurfaceStatus::kSuccess ||
+        status == DrawSurfaceStatus::kUnchanged) {
       view_record.last_successful_task = std::make_unique<LayerTreeTask>(
           view_id, std::move(layer_tree), device_pixel_ratio);
     } else if (status == DrawSurfaceStatus::kRetry) {
@@ -625,6 +779,12 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
           view_id, std::move(layer_tree), device_pixel_ratio));
     }
   }
+  if (!deferred_frames.empty()) {
+    fml::TimePoint submit_start = fml::TimePoint::Now();
+    SubmitDeferredFrames(std::move(deferred_frames));
+    frame_timings_recorder.AddRasterPhaseDuration(
+        FrameTiming::kSubmit, fml::TimePoint::Now() - submit_start);
+  }
   // TODO(dkwingsmt): Pass in raster cache(s) for all views.
   // See https://github.com/flutter/flutter/issues/135530, item 4.
   frame_timings_recorder.RecordRasterEnd(&compositor_context_->raster_cache());
@@ -649,9 +809,16 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
     int64_t view_id,
     flutter::LayerTree& layer_tree,
     float device_pixel_ratio,
-    std::optional<fml::TimePoint> presentation_time) {
+    std::optional<fml::TimePoint> presentation_time,
+    FrameTimingsRecorder& frame_timings_recorder,
+    std::vector<std::unique_ptr<SurfaceFrame>>* deferred_frames) {
   FML_DCHECK(surface_);
 
+  if (CanSkipUnchangedFrame(view_id, layer_tree)) {
+    TRACE_EVENT0("flutter", "Rasterizer::SkipUnchangedFrame");
+    return DrawSurfaceStatus::kUnchanged;
+  }
+
   DlCanvas* embedder_root_canvas = nullptr;
   if (external_view_embedder_) {
     external_view_embedder_->PrepareFlutterView(
@@ -726,6 +893,11 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
                                  ignore_raster_cache,  // ignore raster cache
                                  damage.get()          // frame damage
         );
+    for (auto phase :
+         {FrameTiming::kDiff, FrameTiming::kPreroll, FrameTiming::kPaint}) {
+      frame_timings_recorder.AddRasterPhaseDuration(
+          phase, compositor_frame->GetRasterPhaseDuration(phase));
+    }
     if (frame_status == RasterStatus::kSkipAndRetry) {
       return DrawSurfaceStatus::kRetry;
     }
@@ -739,14 +911,19 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
 
     frame->set_submit_info(submit_info);
 
+    fml::TimePoint submit_start = fml::TimePoint::Now();
     if (external_view_embedder_ &&
         (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
       FML_DCHECK(!frame->IsSubmitted());
       external_view_embedder_->SubmitFlutterView(
           surface_->GetContext(), surface_->GetAiksContext(), std::move(frame));
+    } else if (deferred_frames && frame->CanPrepare()) {
+      deferred_frames->push_back(std::move(frame));
     } else {
       frame->Submit();
     }
+    frame_timings_recorder.AddRasterPhaseDuration(
+        FrameTiming::kSubmit, fml::TimePoint::Now() - submit_start);
 
     // Do not update raster cache metrics for kResubmit because that status
     // indicates that the frame was not actually painted.
@@ -765,6 +942,56 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
   return DrawSurfaceStatus::kFailed;
 }
 
+bool Rasterizer::CanSkipUnchangedFrame(int64_t view_id,
+                                       flutter::LayerTree& layer_tree) {
+  if (!delegate_.GetSettings().skip_unchanged_frames ||
+      layer_tree.is_leaf_layer_tracing_enabled()) {
+    return false;
+  }
+  // The embedder composites the frame with the platform views, and expects
+  // to be handed every frame.
+  if (external_view_embedder_ &&
+      (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
+    return false;
+  }
+
+  // The diff also records the paint regions of |layer_tree|, which the next
+  // frame is compared with.
+  const LayerTree* last_layer_tree = GetLastLayerTree(view_id);
+  FrameDamage damage;
+  damage.SetPreviousLayerTree(last_layer_tree);
+  damage.ComputeClipRect(layer_tree, surface_->EnableRasterCache(),
+                         !surface_->GetContext(),
+                         compositor_context_->texture_registry().get());
+  std::optional<SkIRect> frame_damage = damage.GetFrameDamage();
+  return last_layer_tree && frame_damage.has_value() &&
+         frame_damage->isEmpty();
+}
+
+void Rasterizer::SubmitDeferredFrames(
+    std::vector<std::unique_ptr<SurfaceFrame>> frames) {
+  if (frames.empty()) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "Rasterizer::SubmitDeferredFrames");
+  fml::ParallelFor(
+      concurrent_view_task_runner_, frames.size(), 1,
+      [&frames](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          frames[i]->Prepare();
+        }
+      },
+      fml::ConcurrentTaskPriority::kLatencySensitive);
+  for (auto& frame : frames) {
+    frame->Submit();
+  }
+  // Frames may hold a render context that was made current when they were
+  // acquired, which has to be released in the reverse order.
+  while (!frames.empty()) {
+    frames.pop_back();
+  }
+}
+
 Rasterizer::ViewRecord& Rasterizer::EnsureViewRecord(int64_t view_id) {
   return view_records_[view_id];
 }
@@ -895,6 +1122,84 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
     }
   }
 
+  return MakeScreenshot(data, layer_tree->frame_size(), format, base64_encode);
+}
+
+void Rasterizer::ScreenshotLastLayerTreeAsync(
+    Rasterizer::ScreenshotType type,
+    bool base64_encode,
+    const std::function<void(Screenshot)>& callback) {
+#if IMPELLER_SUPPORTS_RENDERING
+  auto* layer_tree = GetLastLayerTree(kFlutterImplicitViewId);
+  std::shared_ptr<impeller::AiksContext> aiks_context = GetAiksContext();
+  bool is_image_type = type == ScreenshotType::UncompressedImage ||
+                       type == ScreenshotType::CompressedImage;
+  if (layer_tree && aiks_context && is_image_type) {
+    TRACE_EVENT0("flutter", "Rasterizer::ScreenshotLastLayerTreeAsync");
+    bool compressed = type == ScreenshotType::CompressedImage;
+    std::string format = compressed ? "ScreenshotType::CompressedImage"
+                                    : "ScreenshotType::UncompressedImage";
+    SkISize frame_size = layer_tree->frame_size();
+
+    DisplayListBuilder builder(SkRect::Make(frame_size));
+    auto frame = compositor_context_->AcquireFrame(
+        nullptr,            // skia context
+        &builder,           // canvas
+        nullptr,            // view embedder
+        SkMatrix(),         // root surface transformation
+        false,              // instrumentation enabled
+        true,               // render buffer readback supported
+        nullptr,            // thread merger
+        aiks_context.get()  // aiks context
+    );
+    frame->Raster(*layer_tree, true, nullptr);
+    sk_sp<DlImage> image =
+        snapshot_controller_->MakeRasterSnapshot(builder.Build(), frame_size);
+    if (!image) {
+      FML_LOG(ERROR) << "Screenshot: unable to render the layer tree.";
+      callback({});
+      return;
+    }
+
+    bool read_back = false;
+    delegate_.GetIsGpuDisabledSyncSwitch()->Execute(
+        fml::SyncSwitch::Handlers().SetIfFalse([&] {
+          read_back = true;
+          ImageEncodingImpeller::ConvertDlImageToSkImage(
+              image,
+              [io_task_runner = delegate_.GetTaskRunners().GetIOTaskRunner(),
+               callback, compressed, format, frame_size,
+               base64_encode](fml::StatusOr<sk_sp<SkImage>> result) {
+                // The copy completes on a thread that the GPU backend owns,
+                // so encode the image elsewhere.
+                io_task_runner->PostTask([callback, compressed, format,
+                                          frame_size, base64_encode,
+                                          result = std::move(result)]() {
+                  if (!result.ok()) {
+                    FML_LOG(ERROR)
+                        << "Screenshot: unable to read back the image.";
+                    callback({});
+                    return;
+                  }
+                  callback(MakeScreenshot(
+                      EncodeScreenshotImage(result.value(), compressed),
+                      frame_size, format, base64_encode));
+                });
+              },
+              aiks_context->GetContext());
+        }));
+    if (read_back) {
+      return;
+    }
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+  callback(ScreenshotLastLayerTree(type, base64_encode));
+}
+
+Rasterizer::Screenshot Rasterizer::MakeScreenshot(sk_sp<SkData> data,
+                                                  SkISize frame_size,
+                                                  const std::string& format,
+                                                  bool base64_encode) {
   if (data == nullptr) {
     FML_LOG(ERROR) << "Screenshot data was null.";
     return {};
@@ -904,10 +1209,28 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
     size_t b64_size = Base64::EncodedSize(data->size());
     auto b64_data = SkData::MakeUninitialized(b64_size);
     Base64::Encode(data->data(), data->size(), b64_data->writable_data());
-    return Rasterizer::Screenshot{b64_data, layer_tree->frame_size(), format};
+    return Rasterizer::Screenshot{b64_data, frame_size, format};
   }
 
-  return Rasterizer::Screenshot{data, layer_tree->frame_size(), format};
+  return Rasterizer::Screenshot{data, frame_size, format};
+}
+
+sk_sp<SkData> Rasterizer::EncodeScreenshotImage(const sk_sp<SkImage>& image,
+                                                bool compressed) {
+  if (compressed) {
+    return SkPngEncoder::Encode(nullptr, image.get(), {});
+  }
+
+  // Use the same pixel layout as the screenshots drawn with Skia.
+  const auto image_info = SkImageInfo::MakeN32Premul(image->dimensions(),
+                                                     SkColorSpace::MakeSRGB());
+  auto data = SkData::MakeUninitialized(image_info.computeMinByteSize());
+  if (!image->readPixels(nullptr, image_info, data->writable_data(),
+                         image_info.minRowBytes(), 0, 0)) {
+    FML_LOG(ERROR) << "Screenshot: unable to obtain bitmap pixels";
+    return nullptr;
+  }
+  return data;
 }
 
 void Rasterizer::SetNextFrameCallback(const fml::closure& callback) {
@@ -919,6 +1242,19 @@ void Rasterizer::SetExternalViewEmbedder(
   external_view_embedder_ = view_embedder;
 }
 
+void Rasterizer::SetConcurrentViewTaskRunner(
+    std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+  concurrent_view_task_runner_ = std::move(task_runner);
+}
+
+void Rasterizer::PrepareToEmbedPlatformViews() {
+  // The merger is only created for embedders that support merging threads.
+  if (!external_view_embedder_ || !raster_thread_merger_) {
+    return;
+  }
+  external_view_embedder_->PrepareToEmbedPlatformViews(raster_thread_merger_);
+}
+
 void Rasterizer::SetSnapshotSurfaceProducer(
     std::unique_ptr<SnapshotSurfaceProducer> producer) {
   snapshot_surface_producer_ = std::move(producer);
@@ -948,6 +1284,14 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
   }
 
   max_cache_bytes_ = max_bytes;
+
+  // Raster cache images live alongside the other GPU resources, so layers and
+  // display lists are each given half of the resource cache budget.
+  RasterCache& raster_cache = compositor_context_->raster_cache();
+  raster_cache.SetMaxBytes(RasterCacheKeyKind::kLayerMetrics, max_bytes / 2);
+  raster_cache.SetMaxBytes(RasterCacheKeyKind::kDisplayListMetrics,
+                           max_bytes / 2);
+
   if (!surface_) {
     return;
   }
@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
@@ -18,6 +19,7 @@
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "flutter/fml/synchronization/sync_switch.h"
@@ -31,6 +33,7 @@
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"  // nogncheck
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/snapshot_delegate.h"
+#include "flutter/shell/common/memory_trimmer.h"
 #include "flutter/shell/common/pipeline.h"
 #include "flutter/shell/common/snapshot_controller.h"
 #include "flutter/shell/common/snapshot_surface_producer.h"
@@ -83,6 +86,9 @@ enum class DrawSurfaceStatus {
   // Layer tree was discarded because its size does not match the view size.
   // This typically occurs during resizing.
   kDiscarded,
+  // The layer tree was not rasterized, because it would have drawn the same
+  // pixels as the last one. The surface keeps showing the last frame.
+  kUnchanged,
 };
 
 // The information to draw to all views of a frame.
@@ -243,10 +249,31 @@ class Rasterizer final : public SnapshotDelegate,
   //----------------------------------------------------------------------------
   /// @brief      Notifies the rasterizer that there is a low memory situation
   ///             and it must purge as many unnecessary resources as possible.
-  ///             Currently, the Skia context associated with onscreen rendering
-  ///             is told to free GPU resources.
+  ///             This is the same as a critical `NotifyMemoryPressure`.
   ///
-  void NotifyLowMemoryWarning() const;
+  void NotifyLowMemoryWarning();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the rasterizer that the system is running low on
+  ///             memory. The render target cache, the glyph atlases, the
+  ///             raster cache and the Skia resource cache are trimmed, in that
+  ///             order, until about half of what they could give back is freed
+  ///             for moderate pressure, or all of it for critical pressure.
+  ///
+  /// @param[in]  level  How much memory to give back.
+  ///
+  void NotifyMemoryPressure(MemoryPressureLevel level);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the rasterizer that the engine is idle until the
+  ///             given deadline. The rasterizer uses this time to rasterize
+  ///             the raster cache entries of the last layer trees that have
+  ///             not been seen often enough to be cached yet, so that they
+  ///             are ready when they reach the access threshold.
+  ///
+  /// @param[in]  deadline  The time by which the rasterizer must be done.
+  ///
+  void WarmUpRasterCache(fml::TimePoint deadline);
 
   //----------------------------------------------------------------------------
   /// @brief      Gets a weak pointer to the rasterizer. The rasterizer may only
@@ -446,6 +473,28 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   Screenshot ScreenshotLastLayerTree(ScreenshotType type, bool base64_encode);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Screenshots the last layer tree like `ScreenshotLastLayerTree`
+  ///             does, but without making the raster thread wait for the GPU.
+  ///
+  ///             With Impeller, image screenshots are rendered to a texture,
+  ///             which is then copied to a host visible buffer. `callback` is
+  ///             called on the IO task runner once the copy has completed, and
+  ///             the image is encoded there. Other screenshots are taken the
+  ///             same way as by `ScreenshotLastLayerTree`, and `callback` is
+  ///             called before this method returns.
+  ///
+  /// @param[in]  type           The type of the screenshot to gather.
+  /// @param[in]  base64_encode  Whether Base 64 encoding must be applied to the
+  ///                            data after a screenshot has been captured.
+  /// @param[in]  callback       Called with the screenshot, which is empty if
+  ///                            none could be captured.
+  ///
+  void ScreenshotLastLayerTreeAsync(
+      ScreenshotType type,
+      bool base64_encode,
+      const std::function<void(Screenshot)>& callback);
+
   //----------------------------------------------------------------------------
   /// @brief      Sets a callback that will be executed when the next layer tree
   ///             in rendered to the on-screen surface. This is used by
@@ -472,6 +521,32 @@ class Rasterizer final : public SnapshotDelegate,
   void SetExternalViewEmbedder(
       const std::shared_ptr<ExternalViewEmbedder>& view_embedder);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Sets the task runner on which frames for different views are
+  ///             prepared concurrently when several views are drawn at once.
+  ///             The frames are still submitted on the raster thread, in view
+  ///             order. Frames are prepared as they are submitted if this is
+  ///             unset.
+  ///
+  /// @see        `SurfaceFrame::Prepare`
+  ///
+  /// @param[in]  task_runner  The concurrent task runner, or null.
+  ///
+  void SetConcurrentViewTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Lets the external view embedder get ready for a frame with
+  ///             platform views that is expected soon, such as by merging the
+  ///             raster and platform threads ahead of that frame.
+  ///
+  ///             Does nothing if the embedder does not merge threads for
+  ///             platform views.
+  ///
+  /// @see        ExternalViewEmbedder::PrepareToEmbedPlatformViews
+  ///
+  void PrepareToEmbedPlatformViews();
+
   //----------------------------------------------------------------------------
   /// @brief Set the snapshot surface producer. This is done on shell
   ///        initialization. This is non-null on platforms that support taking
@@ -698,13 +773,40 @@ class Rasterizer final : public SnapshotDelegate,
   // Draws the layer tree to the specified view, assuming we have access to the
   // GPU.
   //
-  // This method is not affiliated with the frame timing recorder, but must be
-  // included between the RasterStart and RasterEnd.
+  // This method must be called between the RasterStart and RasterEnd of
+  // |frame_timings_recorder|, which it adds the durations of the raster
+  // phases of this view to.
+  //
+  // If |deferred_frames| is non-null, a frame that can be prepared off the
+  // raster thread is added to it instead of being submitted.
   DrawSurfaceStatus DrawToSurfaceUnsafe(
       int64_t view_id,
       flutter::LayerTree& layer_tree,
       float device_pixel_ratio,
-      std::optional<fml::TimePoint> presentation_time);
+      std::optional<fml::TimePoint> presentation_time,
+      FrameTimingsRecorder& frame_timings_recorder,
+      std::vector<std::unique_ptr<SurfaceFrame>>* deferred_frames = nullptr);
+
+  // Base 64 encodes |data| if asked to and wraps it in a screenshot.
+  static Screenshot MakeScreenshot(sk_sp<SkData> data,
+                                   SkISize frame_size,
+                                   const std::string& format,
+                                   bool base64_encode);
+
+  // Encodes |image| as PNG if |compressed|, or else copies its pixels in the
+  // N32 premultiplied format used by uncompressed screenshots.
+  static sk_sp<SkData> EncodeScreenshotImage(const sk_sp<SkImage>& image,
+                                             bool compressed);
+
+  // Registers the caches that |NotifyMemoryPressure| trims.
+  void RegisterTrimmableCaches();
+
+  // Prepares |frames| concurrently, then submits them in order.
+  void SubmitDeferredFrames(std::vector<std::unique_ptr<SurfaceFrame>> frames);
+
+  // Whether |layer_tree| draws the same pixels as the last layer tree drawn to
+  // the view, and the surface can keep showing that frame instead.
+  bool CanSkipUnchangedFrame(int64_t view_id, flutter::LayerTree& layer_tree);
 
   ViewRecord& EnsureViewRecord(int64_t view_id);
 
@@ -726,7 +828,9 @@ class Rasterizer final : public SnapshotDelegate,
   std::optional<size_t> max_cache_bytes_;
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<ExternalViewEmbedder> external_view_embedder_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_view_task_runner_;
   std::unique_ptr<SnapshotController> snapshot_controller_;
+  MemoryTrimmer memory_trimmer_;
 
   // WeakPtrFactory must be the last member.
   fml::TaskRunnerAffineWeakPtrFactory<Rasterizer> weak_factory_;
@@ -6,10 +6,14 @@
 
 #include "flutter/shell/common/rasterizer.h"
 
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "flutter/flow/frame_timings.h"
+#include "flutter/flow/layers/container_layer.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/thread_host.h"
@@ -110,6 +114,11 @@ class MockExternalViewEmbedder : public ExternalViewEmbedder {
       PostPrerollAction,
       (const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger),
       (override));
+  MOCK_METHOD(
+      void,
+      PrepareToEmbedPlatformViews,
+      (const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger),
+      (override));
   MOCK_METHOD(DlCanvas*, CompositeEmbeddedView, (int64_t view_id), (override));
   MOCK_METHOD(void,
               SubmitFlutterView,
@@ -732,6 +741,84 @@ TEST(RasterizerTest, drawMultipleViewsWithExternalViewEmbedder) {
   latch.Wait();
 }
 
+TEST(RasterizerTest, drawMultipleViewsPreparesFramesBeforeSubmittingInOrder) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::kPlatform |
+                             ThreadHost::Type::kRaster | ThreadHost::Type::kIo |
+                             ThreadHost::Type::kUi);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto concurrent_loop = fml::ConcurrentMessageLoop::Create(2);
+  rasterizer->SetConcurrentViewTaskRunner(concurrent_loop->GetTaskRunner());
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+
+  const SkISize frame_size = SkISize::Make(800, 600);
+  std::atomic_int prepared_count = 0;
+  std::vector<int> submitted_frames;
+  int acquired_count = 0;
+  EXPECT_CALL(*surface, AllowsDrawingWhenGpuDisabled())
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*surface, AcquireFrame(frame_size)).Times(2);
+  ON_CALL(*surface, AcquireFrame).WillByDefault([&](const SkISize& size) {
+    int index = acquired_count++;
+    SurfaceFrame::FramebufferInfo framebuffer_info;
+    auto frame = std::make_unique<SurfaceFrame>(
+        /*surface=*/
+        nullptr, framebuffer_info,
+        /*submit_callback=*/
+        [&, index](const SurfaceFrame&, DlCanvas*) {
+          // Every view has been prepared before the first one is submitted.
+          EXPECT_EQ(prepared_count.load(), 2);
+          submitted_frames.push_back(index);
+          return true;
+        },
+        /*frame_size=*/size);
+    frame->set_prepare_callback([&](SurfaceFrame&) {
+      prepared_count++;
+      return true;
+    });
+    return frame;
+  });
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))));
+  rasterizer->Setup(std::move(surface));
+
+  fml::AutoResetWaitableEvent latch;
+  thread_host.raster_thread->GetTaskRunner()->PostTask([&] {
+    auto pipeline = std::make_shared<FramePipeline>(/*depth=*/10);
+    std::vector<std::unique_ptr<LayerTreeTask>> tasks;
+    for (int64_t view_id : {0, 1}) {
+      LayerTree::Config config;
+      config.root_layer = std::make_shared<ContainerLayer>();
+      tasks.push_back(std::make_unique<LayerTreeTask>(
+          view_id, std::make_unique<LayerTree>(config, frame_size),
+          kDevicePixelRatio));
+    }
+    auto layer_tree_item = std::make_unique<FrameItem>(
+        std::move(tasks), CreateFinishedBuildRecorder());
+    PipelineProduceResult result =
+        pipeline->Produce().Complete(std::move(layer_tree_item));
+    EXPECT_TRUE(result.success);
+    ON_CALL(delegate, ShouldDiscardLayerTree).WillByDefault(Return(false));
+    EXPECT_EQ(rasterizer->Draw(pipeline), DrawStatus::kDone);
+    EXPECT_EQ(rasterizer->GetLastDrawStatus(0), DrawSurfaceStatus::kSuccess);
+    EXPECT_EQ(rasterizer->GetLastDrawStatus(1), DrawSurfaceStatus::kSuccess);
+    latch.Signal();
+  });
+  latch.Wait();
+  EXPECT_EQ(submitted_frames, std::vector<int>({0, 1}));
+}
+
 TEST(RasterizerTest,
      drawWithGpuEnabledAndSurfaceAllowsDrawingWhenGpuDisabledDoesAcquireFrame) {
   std::string test_name =
@@ -1124,6 +1211,200 @@ TEST(RasterizerTest,
   latch.Wait();
 }
 
+TEST(RasterizerTest, drawDropsLateFrameWhenNewerFrameIsQueued) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::kPlatform |
+                             ThreadHost::Type::kRaster | ThreadHost::Type::kIo |
+                             ThreadHost::Type::kUi);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  settings.drop_late_frames = true;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  auto surface_frame = std::make_unique<SurfaceFrame>(
+      /*surface=*/
+      nullptr, framebuffer_info,
+      /*submit_callback=*/[](const SurfaceFrame&, DlCanvas*) { return true; },
+      /*frame_size=*/SkISize::Make(800, 600));
+  EXPECT_CALL(*surface, AllowsDrawingWhenGpuDisabled()).WillOnce(Return(true));
+  // Only one of the two queued frames is drawn.
+  EXPECT_CALL(*surface, AcquireFrame(SkISize()))
+      .WillOnce(Return(ByMove(std::move(surface_frame))));
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))));
+  rasterizer->Setup(std::move(surface));
+
+  fml::TimePoint late = fml::TimePoint::Now() - fml::TimeDelta::FromSeconds(1);
+  std::vector<uint64_t> frame_numbers;
+  auto pipeline = std::make_shared<FramePipeline>(/*depth=*/10);
+  for (int i = 0; i < 2; i++) {
+    auto recorder = CreateFinishedBuildRecorder(late);
+    frame_numbers.push_back(recorder->GetFrameNumber());
+    auto layer_tree = std::make_unique<LayerTree>(
+        /*config=*/LayerTree::Config(), /*frame_size=*/SkISize());
+    auto layer_tree_item = std::make_unique<FrameItem>(
+        SingleLayerTreeList(kImplicitViewId, std::move(layer_tree),
+                            kDevicePixelRatio),
+        std::move(recorder));
+    PipelineProduceResult result =
+        pipeline->Produce().Complete(std::move(layer_tree_item));
+    EXPECT_TRUE(result.success);
+  }
+
+  // The newest frame is drawn even though it is late too.
+  EXPECT_CALL(delegate, OnFrameRasterized(_))
+      .WillOnce([&](const FrameTiming& frame_timing) {
+        EXPECT_EQ(frame_timing.GetFrameNumber(), frame_numbers[1]);
+      });
+
+  fml::AutoResetWaitableEvent latch;
+  thread_host.raster_thread->GetTaskRunner()->PostTask([&] {
+    ON_CALL(delegate, ShouldDiscardLayerTree).WillByDefault(Return(false));
+    rasterizer->Draw(pipeline);
+    latch.Signal();
+  });
+  latch.Wait();
+}
+
+TEST(RasterizerTest, drawSkipsFrameThatIsUnchanged) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::kPlatform |
+                             ThreadHost::Type::kRaster | ThreadHost::Type::kIo |
+                             ThreadHost::Type::kUi);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  settings.skip_unchanged_frames = true;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+
+  const SkISize frame_size = SkISize::Make(800, 600);
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  auto surface_frame = std::make_unique<SurfaceFrame>(
+      /*surface=*/
+      nullptr, framebuffer_info,
+      /*submit_callback=*/[](const SurfaceFrame&, DlCanvas*) { return true; },
+      /*frame_size=*/frame_size);
+  EXPECT_CALL(*surface, AllowsDrawingWhenGpuDisabled())
+      .WillRepeatedly(Return(true));
+  // Only the first of the two frames is drawn.
+  EXPECT_CALL(*surface, AcquireFrame(frame_size))
+      .WillOnce(Return(ByMove(std::move(surface_frame))));
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))));
+  rasterizer->Setup(std::move(surface));
+
+  fml::AutoResetWaitableEvent latch;
+  thread_host.raster_thread->GetTaskRunner()->PostTask([&] {
+    ON_CALL(delegate, ShouldDiscardLayerTree).WillByDefault(Return(false));
+    for (DrawSurfaceStatus expected_status :
+         {DrawSurfaceStatus::kSuccess, DrawSurfaceStatus::kUnchanged}) {
+      auto pipeline = std::make_shared<FramePipeline>(/*depth=*/10);
+      LayerTree::Config config;
+      config.root_layer = std::make_shared<ContainerLayer>();
+      auto layer_tree = std::make_unique<LayerTree>(config, frame_size);
+      auto layer_tree_item = std::make_unique<FrameItem>(
+          SingleLayerTreeList(kImplicitViewId, std::move(layer_tree),
+                              kDevicePixelRatio),
+          CreateFinishedBuildRecorder());
+      PipelineProduceResult result =
+          pipeline->Produce().Complete(std::move(layer_tree_item));
+      EXPECT_TRUE(result.success);
+      EXPECT_EQ(rasterizer->Draw(pipeline), DrawStatus::kDone);
+      EXPECT_EQ(rasterizer->GetLastDrawStatus(kImplicitViewId),
+                expected_status);
+    }
+    latch.Signal();
+  });
+  latch.Wait();
+}
+
+TEST(RasterizerTest,
+     prepareToEmbedPlatformViewsHintsEmbedderWhenThreadsCanMerge) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::kPlatform |
+                             ThreadHost::Type::kRaster | ThreadHost::Type::kIo |
+                             ThreadHost::Type::kUi);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  std::shared_ptr<NiceMock<MockExternalViewEmbedder>> external_view_embedder =
+      std::make_shared<NiceMock<MockExternalViewEmbedder>>();
+  rasterizer->SetExternalViewEmbedder(external_view_embedder);
+  EXPECT_CALL(*external_view_embedder, SupportsDynamicThreadMerging)
+      .WillRepeatedly(Return(true));
+
+  // There is no thread merger to hand to the embedder before setup.
+  EXPECT_CALL(*external_view_embedder, PrepareToEmbedPlatformViews).Times(0);
+  rasterizer->PrepareToEmbedPlatformViews();
+  ::testing::Mock::VerifyAndClearExpectations(external_view_embedder.get());
+
+  rasterizer->Setup(std::make_unique<NiceMock<MockSurface>>());
+  auto raster_thread_merger = rasterizer->GetRasterThreadMerger();
+  ASSERT_TRUE(raster_thread_merger);
+  EXPECT_CALL(*external_view_embedder,
+              PrepareToEmbedPlatformViews(raster_thread_merger))
+      .Times(1);
+  rasterizer->PrepareToEmbedPlatformViews();
+}
+
+TEST(RasterizerTest,
+     prepareToEmbedPlatformViewsDoesNothingWithoutDynamicThreadMerging) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::kPlatform |
+                             ThreadHost::Type::kRaster | ThreadHost::Type::kIo |
+                             ThreadHost::Type::kUi);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  std::shared_ptr<NiceMock<MockExternalViewEmbedder>> external_view_embedder =
+      std::make_shared<NiceMock<MockExternalViewEmbedder>>();
+  rasterizer->SetExternalViewEmbedder(external_view_embedder);
+  EXPECT_CALL(*external_view_embedder, SupportsDynamicThreadMerging)
+      .WillRepeatedly(Return(false));
+  EXPECT_CALL(*external_view_embedder, PrepareToEmbedPlatformViews).Times(0);
+
+  rasterizer->Setup(std::make_unique<NiceMock<MockSurface>>());
+  rasterizer->PrepareToEmbedPlatformViews();
+}
+
 TEST(RasterizerTest, TeardownFreesResourceCache) {
   std::string test_name =
       ::testing::UnitTest::GetInstance()->current_test_info()->name();
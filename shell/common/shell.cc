@@ -5,6 +5,7 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 #include "flutter/shell/common/shell.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -14,7 +15,9 @@
 #include "flutter/common/constants.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/base32.h"
+#include "flutter/fml/cache_statistics.h"
 #include "flutter/fml/file.h"
+#include "flutter/fml/flight_recorder.h"
 #include "flutter/fml/icu_util.h"
 #include "flutter/fml/log_settings.h"
 #include "flutter/fml/logging.h"
@@ -41,6 +44,7 @@
 #include "third_party/skia/include/codec/SkWebpDecoder.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/tonic/common/log.h"
+#include "txt/platform.h"
 
 namespace flutter {
 
@@ -49,6 +53,11 @@ constexpr char kSystemChannel[] = "flutter/system";
 constexpr char kTypeKey[] = "type";
 constexpr char kFontChange[] = "fontsChange";
 
+// The longest that a trim for moderate memory pressure waits for the engine to
+// become idle.
+constexpr fml::TimeDelta kMaxMemoryTrimDelay =
+    fml::TimeDelta::FromMilliseconds(500);
+
 namespace {
 
 std::unique_ptr<Engine> CreateEngine(
@@ -142,16 +151,75 @@ void PerformInitializationTasks(Settings& settings) {
   PersistentCache::SetCacheSkSL(settings.cache_sksl);
 }
 
+// Requests |affinity| for the thread of |task_runner|. Requests for another
+// thread are posted ahead of the frame work already queued on it, so that
+// the thread is moved between two tasks.
+void RequestThreadAffinity(const fml::RefPtr<fml::TaskRunner>& task_runner,
+                           std::optional<fml::CpuAffinity> affinity) {
+  if (!affinity.has_value()) {
+    return;
+  }
+  if (task_runner->RunsTasksOnCurrentThread()) {
+    fml::RequestAffinity(affinity.value());
+    return;
+  }
+  task_runner->PostTaskWithDeadline(
+      [affinity = affinity.value()]() { fml::RequestAffinity(affinity); },
+      fml::TimePoint::Now());
+}
+
+// Warms up, on the concurrent worker task runner, the state that the first
+// frame needs but the platform view does not, while the platform view sets
+// up the GPU context. The UI thread uses the heap snapshot when it creates
+// the root isolate and the default font manager when it sets up the font
+// collection. Skia creates the default font manager once, so if the UI thread
+// gets there first it waits for the worker instead of creating another.
+void PrefetchStartupResources(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& runner,
+    const Settings& settings,
+    const fml::RefPtr<const DartSnapshot>& isolate_snapshot) {
+  if (!runner) {
+    return;
+  }
+  if (isolate_snapshot) {
+    runner->PostTask(
+        [isolate_snapshot]() { isolate_snapshot->PrefetchData(); });
+  }
+  // The font initialization data is a handle that only one font manager can
+  // take.
+  if (!settings.prefetched_default_font_manager &&
+      settings.font_initialization_data == 0) {
+    runner->PostTask([]() {
+      TRACE_EVENT0("flutter", "PrefetchDefaultFontManager");
+      txt::GetDefaultFontManager();
+    });
+  }
+}
+
 }  // namespace
 
 std::pair<DartVMRef, fml::RefPtr<const DartSnapshot>>
-Shell::InferVmInitDataFromSettings(Settings& settings) {
+Shell::InferVmInitDataFromSettings(Settings& settings,
+                                   StartupTimeline* startup_timeline) {
   // Always use the `vm_snapshot` and `isolate_snapshot` provided by the
   // settings to launch the VM.  If the VM is already running, the snapshot
   // arguments are ignored.
+  fml::TimePoint snapshot_start = fml::TimePoint::Now();
   auto vm_snapshot = DartSnapshot::VMSnapshotFromSettings(settings);
   auto isolate_snapshot = DartSnapshot::IsolateSnapshotFromSettings(settings);
+  fml::TimePoint vm_start = fml::TimePoint::Now();
+  bool launches_vm = !DartVMRef::IsInstanceRunning();
   auto vm = DartVMRef::Create(settings, vm_snapshot, isolate_snapshot);
+  if (startup_timeline) {
+    startup_timeline->RecordPhase(StartupTimeline::kSnapshotMapping,
+                                  snapshot_start, vm_start - snapshot_start,
+                                  StartupTimeline::kPlatformThread);
+    if (launches_vm) {
+      startup_timeline->RecordPhase(
+          StartupTimeline::kVMInit, vm_start, fml::TimePoint::Now() - vm_start,
+          StartupTimeline::kPlatformThread);
+    }
+  }
 
   // If the settings did not specify an `isolate_snapshot`, fall back to the
   // one the VM was launched with.
@@ -173,22 +241,29 @@ std::unique_ptr<Shell> Shell::Create(
 
   TRACE_EVENT0("flutter", "Shell::Create");
 
-  auto [vm, isolate_snapshot] = InferVmInitDataFromSettings(settings);
+  StartupTimeline startup_timeline;
+  auto [vm, isolate_snapshot] =
+      InferVmInitDataFromSettings(settings, &startup_timeline);
   auto resource_cache_limit_calculator =
       std::make_shared<ResourceCacheLimitCalculator>(
           settings.resource_cache_max_bytes_threshold);
 
-  return CreateWithSnapshot(platform_data,                     //
-                            task_runners,                      //
-                            /*parent_thread_merger=*/nullptr,  //
-                            /*parent_io_manager=*/nullptr,     //
-                            resource_cache_limit_calculator,   //
-                            settings,                          //
-                            std::move(vm),                     //
-                            std::move(isolate_snapshot),       //
-                            on_create_platform_view,           //
-                            on_create_rasterizer,              //
-                            CreateEngine, is_gpu_disabled);
+  auto shell = CreateWithSnapshot(platform_data,                     //
+                                  task_runners,                      //
+                                  /*parent_thread_merger=*/nullptr,  //
+                                  /*parent_io_manager=*/nullptr,     //
+                                  resource_cache_limit_calculator,   //
+                                  settings,                          //
+                                  std::move(vm),                     //
+                                  std::move(isolate_snapshot),       //
+                                  on_create_platform_view,           //
+                                  on_create_rasterizer,              //
+                                  CreateEngine, is_gpu_disabled);
+  if (shell) {
+    std::scoped_lock lock(shell->startup_timeline_mutex_);
+    shell->startup_timeline_.Merge(startup_timeline);
+  }
+  return shell;
 }
 
 std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
@@ -218,11 +293,20 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
                     !settings.skia_deterministic_rendering_on_cpu),
                 is_gpu_disabled));
 
+  if (settings.enable_parallel_startup) {
+    PrefetchStartupResources(shell->GetConcurrentWorkerTaskRunner(), settings,
+                             isolate_snapshot);
+  }
+
   // Create the platform view on the platform thread (this thread).
+  fml::TimePoint platform_view_start = fml::TimePoint::Now();
   auto platform_view = on_create_platform_view(*shell.get());
   if (!platform_view || !platform_view->GetWeakPtr()) {
     return nullptr;
   }
+  shell->RecordStartupPhase(StartupTimeline::kContextCreation,
+                            platform_view_start,
+                            StartupTimeline::kPlatformThread);
 
   // Create the rasterizer on the raster thread.
   std::promise<std::unique_ptr<Rasterizer>> rasterizer_promise;
@@ -297,6 +381,11 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // Send dispatcher_maker to the engine constructor because shell won't have
   // platform_view set until Shell::Setup is called later.
   auto dispatcher_maker = platform_view->GetDispatcherMaker();
+  if (shell->GetSettings().enable_pointer_resampling) {
+    dispatcher_maker = [](PointerDataDispatcher::Delegate& delegate) {
+      return std::make_unique<ResamplingPointerDataDispatcher>(delegate);
+    };
+  }
 
   // Create the engine on the UI thread.
   std::promise<std::unique_ptr<Engine>> engine_promise;
@@ -318,8 +407,13 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
 
         // The animator is owned by the UI thread but it gets its vsync pulses
         // from the platform.
-        auto animator = std::make_unique<Animator>(*shell, task_runners,
-                                                   std::move(vsync_waiter));
+        auto animator = std::make_unique<Animator>(
+            *shell, task_runners, std::move(vsync_waiter),
+            shell->GetSettings().frame_pipeline_depth);
+        animator->SetFramePacer(shell->frame_pacer_);
+        if (shell->GetSettings().enable_content_frame_rate) {
+          animator->EnableContentFrameRate();
+        }
 
         engine_promise.set_value(
             on_create_engine(*shell,                          //
@@ -433,6 +527,13 @@ Shell::Shell(DartVMRef vm,
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
 
   display_manager_ = std::make_unique<DisplayManager>();
+  if (settings_.enable_frame_pacing) {
+    frame_pacer_ = std::make_shared<FramePacer>();
+  }
+  if (settings_.coalesce_pointer_moves) {
+    pending_pointer_data_packets_ =
+        std::make_shared<PendingPointerDataPackets>();
+  }
   resource_cache_limit_calculator->AddResourceCacheLimitItem(
       weak_factory_.GetWeakPtr());
 
@@ -492,6 +593,26 @@ Shell::Shell(DartVMRef vm,
       task_runners_.GetPlatformTaskRunner(),
       std::bind(&Shell::OnServiceProtocolReloadAssetFonts, this,
                 std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetFlightRecorderExtensionName] = {
+          task_runners_.GetIOTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetFlightRecorder, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetGpuMemoryUsageExtensionName] = {
+          task_runners_.GetIOTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetGpuMemoryUsage, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetStartupTimelineExtensionName] = {
+          task_runners_.GetIOTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetStartupTimeline, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetCacheStatisticsExtensionName] = {
+          task_runners_.GetIOTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetCacheStatistics, this,
+                    std::placeholders::_1, std::placeholders::_2)};
 }
 
 Shell::~Shell() {
@@ -591,21 +712,60 @@ std::unique_ptr<Shell> Shell::Spawn(
 }
 
 void Shell::NotifyLowMemoryWarning() const {
+  NotifyMemoryPressure(MemoryPressureLevel::kCritical);
+}
+
+// Trims the rasterizer caches for moderate memory pressure if that hasn't
+// happened since the pressure was reported.
+static void TrimPendingMemory(
+    const fml::TaskRunnerAffineWeakPtr<Rasterizer>& rasterizer,
+    const std::shared_ptr<std::atomic<bool>>& pending_memory_trim) {
+  if (rasterizer && pending_memory_trim->exchange(false)) {
+    rasterizer->NotifyMemoryPressure(MemoryPressureLevel::kModerate);
+  }
+}
+
+void Shell::NotifyMemoryPressure(MemoryPressureLevel level) const {
+  if (level == MemoryPressureLevel::kModerate) {
+    // Trimming on the raster thread while it draws a frame makes that frame
+    // late, and moderate pressure can wait for the next idle period. Nothing
+    // may be drawn for a while though, so don't wait for it forever.
+    pending_memory_trim_->store(true);
+    task_runners_.GetRasterTaskRunner()->PostDelayedTask(
+        [rasterizer = rasterizer_->GetWeakPtr(),
+         pending_memory_trim = pending_memory_trim_]() {
+          TrimPendingMemory(rasterizer, pending_memory_trim);
+        },
+        kMaxMemoryTrimDelay);
+    return;
+  }
+
   auto trace_id = fml::tracing::TraceNonce();
-  TRACE_EVENT_ASYNC_BEGIN0("flutter", "Shell::NotifyLowMemoryWarning",
-                           trace_id);
-  // This does not require a current isolate but does require a running VM.
-  // Since a valid shell will not be returned to the embedder without a valid
-  // DartVMRef, we can be certain that this is a safe spot to assume a VM is
-  // running.
-  ::Dart_NotifyLowMemory();
+  TRACE_EVENT_ASYNC_BEGIN0("flutter", "Shell::NotifyMemoryPressure", trace_id);
+  if (level == MemoryPressureLevel::kCritical) {
+    // This does not require a current isolate but does require a running VM.
+    // Since a valid shell will not be returned to the embedder without a
+    // valid DartVMRef, we can be certain that this is a safe spot to assume a
+    // VM is running.
+    ::Dart_NotifyLowMemory();
+
+    task_runners_.GetUITaskRunner()->PostTask([engine = weak_engine_]() {
+      if (!engine) {
+        return;
+      }
+      auto decoder = engine->GetImageDecoderWeakPtr();
+      if (decoder && decoder->GetDecodedImageCache()) {
+        decoder->GetDecodedImageCache()->Clear();
+      }
+    });
+  }
 
   task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr(), trace_id = trace_id]() {
+      [rasterizer = rasterizer_->GetWeakPtr(), level, trace_id]() {
         if (rasterizer) {
-          rasterizer->NotifyLowMemoryWarning();
+          rasterizer->NotifyMemoryPressure(level);
         }
-        TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyLowMemoryWarning",
+        TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyMemoryPressure",
                                trace_id);
       });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
@@ -634,14 +794,20 @@ void Shell::RunEngine(
       task_runners_.GetUITaskRunner(),
       fml::MakeCopyable(
           [run_configuration = std::move(run_configuration),
-           weak_engine = weak_engine_, result]() mutable {
+           weak_engine = weak_engine_, result, shell = this]() mutable {
             if (!weak_engine) {
               FML_LOG(ERROR)
                   << "Could not launch engine with configuration - no engine.";
               result(Engine::RunStatus::Failure);
               return;
             }
+            fml::TimePoint run_start = fml::TimePoint::Now();
             auto run_result = weak_engine->Run(std::move(run_configuration));
+            if (run_result == flutter::Engine::RunStatus::Success) {
+              // The engine, and so the shell, is alive while this task runs.
+              shell->RecordStartupPhase(StartupTimeline::kIsolateRun,
+                                        run_start, StartupTimeline::kUIThread);
+            }
             if (run_result == flutter::Engine::RunStatus::Failure) {
               FML_LOG(ERROR) << "Could not launch engine with configuration.";
             }
@@ -715,6 +881,17 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   rasterizer_->SetExternalViewEmbedder(view_embedder);
   rasterizer_->SetSnapshotSurfaceProducer(
       platform_view_->CreateSnapshotSurfaceProducer());
+  if (settings_.enable_concurrent_preroll) {
+    rasterizer_->compositor_context()->SetConcurrentPrerollTaskRunner(
+        GetConcurrentWorkerTaskRunner());
+  }
+  if (settings_.enable_deferred_tile_rasterization) {
+    rasterizer_->compositor_context()->SetConcurrentRecordingTaskRunner(
+        GetConcurrentWorkerTaskRunner());
+  }
+  if (settings_.enable_concurrent_view_rasterization) {
+    rasterizer_->SetConcurrentViewTaskRunner(GetConcurrentWorkerTaskRunner());
+  }
 
   // The weak ptr must be generated in the platform thread which owns the unique
   // ptr.
@@ -1045,6 +1222,25 @@ void Shell::OnPlatformViewDispatchPointerDataPacket(
   TRACE_FLOW_BEGIN("flutter", "PointerEvent", next_pointer_flow_id_);
   FML_DCHECK(is_set_up_);
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  if (pending_pointer_data_packets_) {
+    bool needs_task;
+    {
+      std::scoped_lock lock(pending_pointer_data_packets_->mutex);
+      needs_task = pending_pointer_data_packets_->packets.empty();
+      pending_pointer_data_packets_->packets.push_back(std::move(packet));
+      pending_pointer_data_packets_->flow_ids.push_back(next_pointer_flow_id_);
+    }
+    // Packets that arrive before the UI thread gets to this task are merged
+    // into the packet it dispatches.
+    if (needs_task) {
+      task_runners_.GetUITaskRunner()->PostTask(
+          [engine = weak_engine_, pending = pending_pointer_data_packets_]() {
+            pending->Dispatch(engine.get());
+          });
+    }
+    next_pointer_flow_id_++;
+    return;
+  }
   task_runners_.GetUITaskRunner()->PostTask(
       fml::MakeCopyable([engine = weak_engine_, packet = std::move(packet),
                          flow_id = next_pointer_flow_id_]() mutable {
@@ -1055,6 +1251,30 @@ void Shell::OnPlatformViewDispatchPointerDataPacket(
   next_pointer_flow_id_++;
 }
 
+void Shell::PendingPointerDataPackets::Dispatch(Engine* engine) {
+  std::vector<std::unique_ptr<PointerDataPacket>> pending_packets;
+  std::vector<uint64_t> pending_flow_ids;
+  {
+    std::scoped_lock lock(mutex);
+    pending_packets.swap(packets);
+    pending_flow_ids.swap(flow_ids);
+  }
+  // The packets were already picked up by an earlier frame.
+  if (pending_packets.empty()) {
+    return;
+  }
+  for (size_t i = 0; i + 1 < pending_flow_ids.size(); i++) {
+    TRACE_FLOW_END("flutter", "PointerEvent", pending_flow_ids[i]);
+  }
+  if (engine) {
+    engine->DispatchPointerDataPacket(
+        pending_packets.size() == 1
+            ? std::move(pending_packets.front())
+            : PointerDataPacket::Coalesce(pending_packets),
+        pending_flow_ids.back());
+  }
+}
+
 // |PlatformView::Delegate|
 void Shell::OnPlatformViewDispatchSemanticsAction(int32_t node_id,
                                                   SemanticsAction action,
@@ -1148,6 +1368,7 @@ void Shell::OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) {
           return;
         }
 
+        texture->IncrementFrameGeneration();
         texture->MarkNewFrameAvailable();
       });
 
@@ -1159,6 +1380,19 @@ void Shell::OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) {
   });
 }
 
+// |PlatformView::Delegate|
+void Shell::OnPlatformViewPrepareToEmbedPlatformViews() {
+  FML_DCHECK(is_set_up_);
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+
+  task_runners_.GetRasterTaskRunner()->PostTask(
+      [rasterizer = rasterizer_->GetWeakPtr()]() {
+        if (rasterizer) {
+          rasterizer->PrepareToEmbedPlatformViews();
+        }
+      });
+}
+
 // |PlatformView::Delegate|
 void Shell::OnPlatformViewSetNextFrameCallback(const fml::closure& closure) {
   FML_DCHECK(is_set_up_);
@@ -1188,7 +1422,27 @@ void Shell::OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
     std::scoped_lock time_recorder_lock(time_recorder_mutex_);
     latest_frame_target_time_.emplace(frame_target_time);
   }
+
+  // Both threads are moved back to the performance cores before the frame
+  // starts if they went idle since the last one.
+  if (UsesAdaptiveThreadAffinity()) {
+    fml::TimePoint now = fml::TimePoint::Now();
+    std::optional<fml::CpuAffinity> ui_affinity;
+    std::optional<fml::CpuAffinity> raster_affinity;
+    {
+      std::scoped_lock lock(thread_affinity_mutex_);
+      ui_affinity = ui_thread_affinity_policy_.OnFrameStart(now);
+      raster_affinity = raster_thread_affinity_policy_.OnFrameStart(now);
+    }
+    RequestThreadAffinities(ui_affinity, raster_affinity);
+  }
+
   if (engine_) {
+    // Events that arrived before the frame are handled before it is built,
+    // even if the task that picks them up is queued behind this one.
+    if (pending_pointer_data_packets_) {
+      pending_pointer_data_packets_->Dispatch(engine_.get());
+    }
     engine_->BeginFrame(frame_target_time, frame_number);
   }
 }
@@ -1202,6 +1456,22 @@ void Shell::OnAnimatorNotifyIdle(fml::TimeDelta deadline) {
     engine_->NotifyIdle(deadline);
     volatile_path_tracker_->OnFrame();
   }
+
+  // The deadline is on the Dart timeline clock; hand the remaining idle time
+  // to the rasterizer as a deadline on its own clock.
+  fml::TimeDelta remaining =
+      deadline - fml::TimeDelta::FromMicroseconds(Dart_TimelineGetMicros());
+  if (remaining > fml::TimeDelta::Zero()) {
+    fml::TimePoint raster_deadline = fml::TimePoint::Now() + remaining;
+    task_runners_.GetRasterTaskRunner()->PostTask(
+        [rasterizer = weak_rasterizer_, raster_deadline,
+         pending_memory_trim = pending_memory_trim_]() {
+          TrimPendingMemory(rasterizer, pending_memory_trim);
+          if (rasterizer) {
+            rasterizer->WarmUpRasterCache(raster_deadline);
+          }
+        });
+  }
 }
 
 void Shell::OnAnimatorUpdateLatestFrameTargetTime(
@@ -1223,7 +1493,16 @@ void Shell::OnAnimatorUpdateLatestFrameTargetTime(
 void Shell::OnAnimatorDraw(std::shared_ptr<FramePipeline> pipeline) {
   FML_DCHECK(is_set_up_);
 
-  task_runners_.GetRasterTaskRunner()->PostTask(fml::MakeCopyable(
+  // Drawing the frame goes ahead of the other tasks on the raster thread.
+  fml::TimePoint frame_target_time = fml::TimePoint::Max();
+  {
+    std::scoped_lock time_recorder_lock(time_recorder_mutex_);
+    if (latest_frame_target_time_) {
+      frame_target_time = latest_frame_target_time_.value();
+    }
+  }
+
+  task_runners_.GetRasterTaskRunner()->PostTaskWithDeadline(fml::MakeCopyable(
       [&waiting_for_first_frame = waiting_for_first_frame_,
        &waiting_for_first_frame_condition = waiting_for_first_frame_condition_,
        rasterizer = rasterizer_->GetWeakPtr(),
@@ -1239,7 +1518,8 @@ void Shell::OnAnimatorDraw(std::shared_ptr<FramePipeline> pipeline) {
             waiting_for_first_frame_condition.notify_all();
           }
         }
-      }));
+      }),
+      frame_target_time);
 }
 
 // |Animator::Delegate|
@@ -1266,9 +1546,9 @@ void Shell::OnEngineUpdateSemantics(SemanticsNodeUpdates update,
 
   task_runners_.GetPlatformTaskRunner()->PostTask(
       [view = platform_view_->GetWeakPtr(), update = std::move(update),
-       actions = std::move(actions)] {
+       actions = std::move(actions)]() mutable {
         if (view) {
-          view->UpdateSemantics(update, actions);
+          view->UpdateSemantics(std::move(update), std::move(actions));
         }
       });
 }
@@ -1493,6 +1773,48 @@ double Shell::GetScaledFontSize(double unscaled_font_size,
                                            configuration_id);
 }
 
+StartupTimeline Shell::GetStartupTimeline() const {
+  std::scoped_lock lock(startup_timeline_mutex_);
+  return startup_timeline_;
+}
+
+void Shell::RecordStartupPhase(StartupTimeline::Phase phase,
+                               fml::TimePoint start,
+                               StartupTimeline::Thread thread) {
+  std::scoped_lock lock(startup_timeline_mutex_);
+  startup_timeline_.RecordPhase(phase, start, fml::TimePoint::Now() - start,
+                                thread);
+}
+
+void Shell::RecordFirstFrameStartupPhases(const FrameTiming& timing) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  StartupTimeline startup_timeline;
+  {
+    std::scoped_lock lock(startup_timeline_mutex_);
+    if (startup_timeline_.HasPhase(StartupTimeline::kFirstRaster)) {
+      return;
+    }
+    auto build_start = timing.Get(FrameTiming::kBuildStart);
+    auto raster_start = timing.Get(FrameTiming::kRasterStart);
+    auto raster_finish = timing.Get(FrameTiming::kRasterFinish);
+    auto submit = timing.GetRasterPhaseDuration(FrameTiming::kSubmit);
+    startup_timeline_.RecordPhase(
+        StartupTimeline::kFirstBuild, build_start,
+        timing.Get(FrameTiming::kBuildFinish) - build_start,
+        StartupTimeline::kUIThread);
+    startup_timeline_.RecordPhase(StartupTimeline::kFirstRaster, raster_start,
+                                  raster_finish - raster_start,
+                                  StartupTimeline::kRasterThread);
+    startup_timeline_.RecordPhase(StartupTimeline::kFirstPresent,
+                                  raster_finish - submit, submit,
+                                  StartupTimeline::kRasterThread);
+    startup_timeline = startup_timeline_;
+  }
+  if (settings_.startup_timeline_callback) {
+    settings_.startup_timeline_callback(startup_timeline);
+  }
+}
+
 void Shell::ReportTimings() {
   FML_DCHECK(is_set_up_);
   FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
@@ -1523,6 +1845,33 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     settings_.frame_rasterized_callback(timing);
   }
 
+  RecordFirstFrameStartupPhases(timing);
+
+  // The phases of the last frames are kept whether or not the timings are
+  // reported, so that a jank can be looked into after the fact.
+  fml::FlightRecorder::Record(
+      "Build", timing.Get(FrameTiming::kBuildStart),
+      timing.Get(FrameTiming::kBuildFinish) -
+          timing.Get(FrameTiming::kBuildStart),
+      timing.GetFrameNumber());
+  fml::FlightRecorder::Record(
+      "Raster", timing.Get(FrameTiming::kRasterStart),
+      timing.Get(FrameTiming::kRasterFinish) -
+          timing.Get(FrameTiming::kRasterStart),
+      timing.GetFrameNumber());
+
+  if (UsesAdaptiveThreadAffinity()) {
+    UpdateThreadAffinitiesForFrame(timing);
+  }
+
+  if (frame_pacer_) {
+    frame_pacer_->RecordFrame(
+        timing.Get(FrameTiming::kBuildFinish) -
+            timing.Get(FrameTiming::kBuildStart),
+        timing.Get(FrameTiming::kRasterFinish) -
+            timing.Get(FrameTiming::kRasterStart));
+  }
+
   if (!needs_report_timings_) {
     return;
   }
@@ -1581,6 +1930,84 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
   }
 }
 
+bool Shell::UsesAdaptiveThreadAffinity() const {
+  // A single thread that does the work of both cannot follow two policies.
+  return settings_.enable_adaptive_thread_affinity &&
+         task_runners_.GetUITaskRunner() != task_runners_.GetRasterTaskRunner();
+}
+
+void Shell::UpdateThreadAffinitiesForFrame(const FrameTiming& timing) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+
+  fml::TimePoint now = fml::TimePoint::Now();
+  fml::Milliseconds frame_budget = GetFrameBudget();
+  fml::TimeDelta build_time = timing.Get(FrameTiming::kBuildFinish) -
+                              timing.Get(FrameTiming::kBuildStart);
+  fml::TimeDelta raster_time = timing.Get(FrameTiming::kRasterFinish) -
+                               timing.Get(FrameTiming::kRasterStart);
+  std::optional<fml::CpuAffinity> ui_affinity;
+  std::optional<fml::CpuAffinity> raster_affinity;
+  {
+    std::scoped_lock lock(thread_affinity_mutex_);
+    ui_affinity =
+        ui_thread_affinity_policy_.OnFrameEnd(build_time, frame_budget, now);
+    raster_affinity = raster_thread_affinity_policy_.OnFrameEnd(
+        raster_time, frame_budget, now);
+  }
+  RequestThreadAffinities(ui_affinity, raster_affinity);
+  ScheduleThreadAffinityIdleCheck();
+}
+
+void Shell::RequestThreadAffinities(
+    std::optional<fml::CpuAffinity> ui_affinity,
+    std::optional<fml::CpuAffinity> raster_affinity) {
+  RequestThreadAffinity(task_runners_.GetUITaskRunner(), ui_affinity);
+  RequestThreadAffinity(task_runners_.GetRasterTaskRunner(), raster_affinity);
+}
+
+void Shell::ScheduleThreadAffinityIdleCheck() {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  if (thread_affinity_idle_check_scheduled_) {
+    return;
+  }
+
+  fml::TimePoint idle_deadline = fml::TimePoint::Max();
+  {
+    std::scoped_lock lock(thread_affinity_mutex_);
+    for (const ThreadAffinityPolicy* policy :
+         {&ui_thread_affinity_policy_, &raster_thread_affinity_policy_}) {
+      if (!policy->IsIdle()) {
+        idle_deadline = std::min(idle_deadline, policy->GetIdleDeadline());
+      }
+    }
+  }
+  if (idle_deadline == fml::TimePoint::Max()) {
+    // Both threads are already idle, the next frame schedules a new check.
+    return;
+  }
+
+  thread_affinity_idle_check_scheduled_ = true;
+  task_runners_.GetRasterTaskRunner()->PostDelayedTask(
+      [self = weak_factory_gpu_->GetWeakPtr()]() {
+        if (!self) {
+          return;
+        }
+        self->thread_affinity_idle_check_scheduled_ = false;
+        fml::TimePoint now = fml::TimePoint::Now();
+        std::optional<fml::CpuAffinity> ui_affinity;
+        std::optional<fml::CpuAffinity> raster_affinity;
+        {
+          std::scoped_lock lock(self->thread_affinity_mutex_);
+          ui_affinity = self->ui_thread_affinity_policy_.OnIdleCheck(now);
+          raster_affinity =
+              self->raster_thread_affinity_policy_.OnIdleCheck(now);
+        }
+        self->RequestThreadAffinities(ui_affinity, raster_affinity);
+        self->ScheduleThreadAffinityIdleCheck();
+      },
+      idle_deadline - fml::TimePoint::Now());
+}
+
 fml::Milliseconds Shell::GetFrameBudget() {
   double display_refresh_rate = display_manager_->GetMainDisplayRefreshRate();
   if (display_refresh_rate > 0) {
@@ -1864,6 +2291,133 @@ bool Shell::OnServiceProtocolGetSkSLs(
   return true;
 }
 
+bool Shell::OnServiceProtocolGetFlightRecorder(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "FlightRecorder", allocator);
+
+  rapidjson::Value threads_json(rapidjson::kArrayType);
+  for (const auto& thread_events : fml::FlightRecorder::Dump()) {
+    rapidjson::Value events_json(rapidjson::kArrayType);
+    for (const auto& event : thread_events.events) {
+      rapidjson::Value event_json(rapidjson::kObjectType);
+      event_json.AddMember("name", rapidjson::StringRef(event.name),
+                           allocator);
+      event_json.AddMember<int64_t>(
+          "startMicros", event.start.ToEpochDelta().ToMicroseconds(),
+          allocator);
+      event_json.AddMember<int64_t>("durationMicros",
+                                    event.duration.ToMicroseconds(), allocator);
+      event_json.AddMember<uint64_t>("id", event.id, allocator);
+      events_json.PushBack(event_json, allocator);
+    }
+    rapidjson::Value thread_json(rapidjson::kObjectType);
+    thread_json.AddMember(
+        "name", rapidjson::Value(thread_events.thread_name, allocator),
+        allocator);
+    thread_json.AddMember("events", events_json, allocator);
+    threads_json.PushBack(thread_json, allocator);
+  }
+  response->AddMember("threads", threads_json, allocator);
+  return true;
+}
+
+bool Shell::OnServiceProtocolGetGpuMemoryUsage(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+#if IMPELLER_SUPPORTS_RENDERING
+  auto impeller_context = io_manager_->GetImpellerContext();
+  if (impeller_context && impeller_context->GetResourceAllocator()) {
+    auto usage =
+        impeller_context->GetResourceAllocator()->GetDeviceMemoryUsage();
+    auto& allocator = response->GetAllocator();
+    response->SetObject();
+    response->AddMember("type", "GpuMemoryUsage", allocator);
+    rapidjson::Value categories_json(rapidjson::kObjectType);
+    for (size_t i = 0; i < impeller::kDeviceMemoryCategoryCount; i++) {
+      auto category = static_cast<impeller::DeviceMemoryCategory>(i);
+      const char* name = impeller::DeviceMemoryCategoryToString(category);
+      categories_json.AddMember(
+          rapidjson::StringRef(name),
+          static_cast<uint64_t>(usage.GetBytes(category)), allocator);
+    }
+    response->AddMember("categoryBytes", categories_json, allocator);
+    response->AddMember<uint64_t>("trackedBytes", usage.GetTrackedBytes(),
+                                  allocator);
+    if (usage.device_heap_bytes.has_value()) {
+      response->AddMember<uint64_t>(
+          "deviceHeapBytes", usage.device_heap_bytes.value(), allocator);
+    }
+    return true;
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+  const char* error = "GPU memory usage is only reported on Impeller.";
+  ServiceProtocolFailureError(response, error);
+  return false;
+}
+
+bool Shell::OnServiceProtocolGetStartupTimeline(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+  auto startup_timeline = GetStartupTimeline();
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "StartupTimeline", allocator);
+
+  rapidjson::Value phases_json(rapidjson::kArrayType);
+  for (int i = 0; i < StartupTimeline::kCount; i++) {
+    auto phase = static_cast<StartupTimeline::Phase>(i);
+    const auto& record = startup_timeline.GetPhase(phase);
+    if (!record.has_value()) {
+      continue;
+    }
+    rapidjson::Value phase_json(rapidjson::kObjectType);
+    phase_json.AddMember(
+        "name", rapidjson::StringRef(StartupTimeline::GetPhaseName(phase)),
+        allocator);
+    phase_json.AddMember<int64_t>(
+        "startMicros", record->start.ToEpochDelta().ToMicroseconds(),
+        allocator);
+    phase_json.AddMember<int64_t>("durationMicros",
+                                  record->duration.ToMicroseconds(), allocator);
+    phase_json.AddMember(
+        "thread",
+        rapidjson::StringRef(StartupTimeline::GetThreadName(record->thread)),
+        allocator);
+    phases_json.PushBack(phase_json, allocator);
+  }
+  response->AddMember("phases", phases_json, allocator);
+  return true;
+}
+
+bool Shell::OnServiceProtocolGetCacheStatistics(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "CacheStatistics", allocator);
+
+  rapidjson::Value caches_json(rapidjson::kArrayType);
+  for (const auto& cache : fml::CacheStatistics::Dump()) {
+    rapidjson::Value cache_json(rapidjson::kObjectType);
+    cache_json.AddMember("name", rapidjson::Value(cache.name, allocator),
+                         allocator);
+    cache_json.AddMember<uint64_t>("hits", cache.hits, allocator);
+    cache_json.AddMember<uint64_t>("misses", cache.misses, allocator);
+    cache_json.AddMember<uint64_t>("evictions", cache.evictions, allocator);
+    cache_json.AddMember("hitRate", cache.GetHitRate(), allocator);
+    caches_json.PushBack(cache_json, allocator);
+  }
+  response->AddMember("caches", caches_json, allocator);
+  return true;
+}
+
 bool Shell::OnServiceProtocolEstimateRasterCacheMemory(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
     rapidjson::Document* response) {
@@ -2124,18 +2678,33 @@ Rasterizer::Screenshot Shell::Screenshot(
   TRACE_EVENT0("flutter", "Shell::Screenshot");
   fml::AutoResetWaitableEvent latch;
   Rasterizer::Screenshot screenshot;
+  // Asynchronous screenshots are finished on the raster and IO task runners,
+  // so they can't be waited for on those threads.
+  bool wait_for_async_screenshot =
+      !task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread() &&
+      !task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread();
   fml::TaskRunner::RunNowOrPostTask(
       task_runners_.GetRasterTaskRunner(), [&latch,                        //
                                             rasterizer = GetRasterizer(),  //
                                             &screenshot,                   //
                                             screenshot_type,               //
-                                            base64_encode                  //
+                                            base64_encode,                 //
+                                            wait_for_async_screenshot      //
   ]() {
-        if (rasterizer) {
+        if (!rasterizer) {
+          latch.Signal();
+        } else if (wait_for_async_screenshot) {
+          rasterizer->ScreenshotLastLayerTreeAsync(
+              screenshot_type, base64_encode,
+              [&latch, &screenshot](Rasterizer::Screenshot result) {
+                screenshot = std::move(result);
+                latch.Signal();
+              });
+        } else {
           screenshot = rasterizer->ScreenshotLastLayerTree(screenshot_type,
                                                            base64_encode);
+          latch.Signal();
         }
-        latch.Signal();
       });
   latch.Wait();
   return screenshot;
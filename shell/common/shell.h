@@ -13,6 +13,7 @@
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/common/graphics/texture.h"
 #include "flutter/common/settings.h"
+#include "flutter/common/startup_timeline.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
@@ -36,10 +37,13 @@
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/display_manager.h"
 #include "flutter/shell/common/engine.h"
+#include "flutter/shell/common/frame_pacer.h"
+#include "flutter/shell/common/memory_trimmer.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/resource_cache_limit_calculator.h"
 #include "flutter/shell/common/shell_io_manager.h"
+#include "flutter/shell/common/thread_affinity_policy.h"
 
 namespace flutter {
 
@@ -284,10 +288,24 @@ class Shell final : public PlatformView::Delegate,
 
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to notify that there is a low memory
-  ///             warning. The shell will attempt to purge caches. Current, only
-  ///             the rasterizer cache is purged.
+  ///             warning. The shell will attempt to purge caches. This is the
+  ///             same as a critical `NotifyMemoryPressure`.
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to notify that the system is running low
+  ///             on memory. For moderate pressure the rasterizer gives back
+  ///             about half of what its caches could free, starting with the
+  ///             ones that are cheapest to fill again. It does so in the next
+  ///             idle period, or after a short delay if none comes, so that
+  ///             the trim doesn't delay a frame. For critical pressure
+  ///             all of its caches are purged and the Dart VM is told to
+  ///             collect garbage too.
+  ///
+  /// @param[in]  level  How much memory to give back.
+  ///
+  void NotifyMemoryPressure(MemoryPressureLevel level) const;
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to check if all shell subcomponents are
   ///             initialized. It is the embedder's responsibility to make this
@@ -359,6 +377,13 @@ class Shell final : public PlatformView::Delegate,
   ///
   fml::Status WaitForFirstFrame(fml::TimeDelta timeout);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the phases of the startup of this shell recorded so
+  ///             far. The timeline is complete once the first frame has been
+  ///             rasterized. This may be called on any thread.
+  ///
+  StartupTimeline GetStartupTimeline() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to reload the system fonts in
   ///             FontCollection.
@@ -451,8 +476,12 @@ class Shell final : public PlatformView::Delegate,
   // TODO(dkwingsmt): Extracting this method is part of a bigger change. If the
   // entire change is not eventually landed, we should merge this method back
   // to Create. https://github.com/flutter/flutter/issues/136826
+  //
+  // If |startup_timeline| is non-null, the snapshot mapping and VM launch are
+  // recorded on it.
   static std::pair<DartVMRef, fml::RefPtr<const DartSnapshot>>
-  InferVmInitDataFromSettings(Settings& settings);
+  InferVmInitDataFromSettings(Settings& settings,
+                              StartupTimeline* startup_timeline = nullptr);
 
  private:
   using ServiceProtocolHandler =
@@ -482,6 +511,9 @@ class Shell final : public PlatformView::Delegate,
   std::shared_ptr<VolatilePathTracker> volatile_path_tracker_;
   std::shared_ptr<PlatformMessageHandler> platform_message_handler_;
   std::atomic<bool> route_messages_through_platform_thread_ = false;
+  // Set while a trim for moderate memory pressure waits for an idle period.
+  std::shared_ptr<std::atomic<bool>> pending_memory_trim_ =
+      std::make_shared<std::atomic<bool>>(false);
 
   fml::WeakPtr<Engine> weak_engine_;  // to be shared across threads
   fml::TaskRunnerAffineWeakPtr<Rasterizer>
@@ -501,6 +533,8 @@ class Shell final : public PlatformView::Delegate,
 
   bool first_frame_rasterized_ = false;
   std::atomic<bool> waiting_for_first_frame_ = true;
+  mutable std::mutex startup_timeline_mutex_;
+  StartupTimeline startup_timeline_;
   std::mutex waiting_for_first_frame_mutex_;
   std::condition_variable waiting_for_first_frame_condition_;
 
@@ -517,6 +551,36 @@ class Shell final : public PlatformView::Delegate,
   // stored here for easier conversions to Dart objects.
   std::vector<int64_t> unreported_timings_;
 
+  // Decide the cores the UI and raster threads run on when
+  // |Settings::enable_adaptive_thread_affinity| is set. They are updated
+  // from both threads, so they are protected by |thread_affinity_mutex_|.
+  std::mutex thread_affinity_mutex_;
+  ThreadAffinityPolicy ui_thread_affinity_policy_;
+  ThreadAffinityPolicy raster_thread_affinity_policy_;
+
+  // Whether there's a task scheduled on the raster thread to move the UI and
+  // raster threads to the efficiency cores once they go idle.
+  bool thread_affinity_idle_check_scheduled_ = false;
+
+  // Fed the timings of rasterized frames and consulted by the animator when
+  // |Settings::enable_frame_pacing| is set, null otherwise.
+  std::shared_ptr<FramePacer> frame_pacer_;
+
+  // The pointer data packets that the UI thread has yet to pick up, when
+  // |Settings::coalesce_pointer_moves| is set. Shared with the task that
+  // picks them up, null otherwise. They are also picked up when a frame
+  // begins, so that the frame sees every event that arrived before it.
+  struct PendingPointerDataPackets {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<PointerDataPacket>> packets;
+    std::vector<uint64_t> flow_ids;
+
+    // Dispatches the packets queued so far to the engine, merged into one.
+    // Called on the UI thread.
+    void Dispatch(Engine* engine);
+  };
+  std::shared_ptr<PendingPointerDataPackets> pending_pointer_data_packets_;
+
   /// Manages the displays. This class is thread safe, can be accessed from
   /// any of the threads.
   std::unique_ptr<DisplayManager> display_manager_;
@@ -581,6 +645,21 @@ class Shell final : public PlatformView::Delegate,
 
   void ReportTimings();
 
+  bool UsesAdaptiveThreadAffinity() const;
+
+  // Feeds the work done by the UI and raster threads for a frame to their
+  // affinity policies. Must be called on the raster thread.
+  void UpdateThreadAffinitiesForFrame(const FrameTiming& timing);
+
+  // Requests the affinities the policies have changed to for the UI and the
+  // raster threads.
+  void RequestThreadAffinities(std::optional<fml::CpuAffinity> ui_affinity,
+                               std::optional<fml::CpuAffinity> raster_affinity);
+
+  // Schedules a check for the UI and raster threads having gone idle, unless
+  // one is already scheduled. Must be called on the raster thread.
+  void ScheduleThreadAffinityIdleCheck();
+
   // |PlatformView::Delegate|
   void OnPlatformViewCreated(std::unique_ptr<Surface> surface) override;
 
@@ -624,6 +703,9 @@ class Shell final : public PlatformView::Delegate,
   // |PlatformView::Delegate|
   void OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) override;
 
+  // |PlatformView::Delegate|
+  void OnPlatformViewPrepareToEmbedPlatformViews() override;
+
   // |PlatformView::Delegate|
   void OnPlatformViewSetNextFrameCallback(const fml::closure& closure) override;
 
@@ -791,6 +873,43 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Dumps the most recent events of the flight recorder of each thread.
+  bool OnServiceProtocolGetFlightRecorder(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports the device memory held by the buffers and textures of the
+  // Impeller context, by category. Fails on the Skia backend.
+  bool OnServiceProtocolGetGpuMemoryUsage(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports the phases of the startup of this shell recorded so far.
+  bool OnServiceProtocolGetStartupTimeline(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports the hits, misses and evictions of the caches of the process.
+  bool OnServiceProtocolGetCacheStatistics(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Records a startup phase that started at |start| and ends now.
+  void RecordStartupPhase(StartupTimeline::Phase phase,
+                          fml::TimePoint start,
+                          StartupTimeline::Thread thread);
+
+  // Records the phases of the first frame, whose timing is |timing|.
+  void RecordFirstFrameStartupPhases(const FrameTiming& timing);
+
   // Send a system font change notification.
   void SendFontChangeNotification();
 
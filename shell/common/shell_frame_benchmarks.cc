@@ -0,0 +1,215 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Drives frames of synthetic scenes through a headless shell, from the
+// |Animator| to the |Rasterizer| and the test platform view's surface, and
+// reports the distribution of their build and raster times.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/flow/layers/clip_rect_layer.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/opacity_layer.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/shell/common/shell_test.h"
+#include "flutter/shell/common/shell_test_platform_view.h"
+#include "flutter/shell/common/thread_host.h"
+#include "flutter/testing/dart_fixture.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr double kSceneSize = 800;
+
+enum class SyntheticScene {
+  // A single picture with one rect per unit of complexity.
+  kRects,
+  // A chain of opacity layers, each holding a small picture.
+  kNestedOpacity,
+  // A grid of clipped pictures.
+  kClippedPictures,
+};
+
+sk_sp<DisplayList> MakeRectsDisplayList(int64_t count) {
+  DisplayListBuilder builder(SkRect::MakeWH(kSceneSize, kSceneSize));
+  DlPaint paint;
+  for (int64_t i = 0; i < count; i++) {
+    SkScalar x = (i * 7) % static_cast<int64_t>(kSceneSize - 20);
+    SkScalar y = (i * 13) % static_cast<int64_t>(kSceneSize - 20);
+    paint.setColor(DlColor(0xFF000000 | ((i * 0x10305) & 0xFFFFFF)));
+    builder.DrawRect(SkRect::MakeXYWH(x, y, 20, 20), paint);
+  }
+  return builder.Build();
+}
+
+LayerTreeBuilder MakeSceneBuilder(SyntheticScene scene,
+                                  int64_t complexity,
+                                  size_t* recorded_bytes) {
+  return [scene, complexity,
+          recorded_bytes](const std::shared_ptr<ContainerLayer>& root) {
+    *recorded_bytes = 0;
+    switch (scene) {
+      case SyntheticScene::kRects: {
+        auto display_list = MakeRectsDisplayList(complexity);
+        *recorded_bytes += display_list->bytes();
+        root->Add(std::make_shared<DisplayListLayer>(
+            SkPoint::Make(0, 0), std::move(display_list), false, true));
+        break;
+      }
+      case SyntheticScene::kNestedOpacity: {
+        std::shared_ptr<ContainerLayer> parent = root;
+        for (int64_t i = 0; i < complexity; i++) {
+          auto opacity =
+              std::make_shared<OpacityLayer>(0xF0, SkPoint::Make(1, 1));
+          auto display_list = MakeRectsDisplayList(4);
+          *recorded_bytes += display_list->bytes();
+          opacity->Add(std::make_shared<DisplayListLayer>(
+              SkPoint::Make(0, 0), std::move(display_list), false, true));
+          parent->Add(opacity);
+          parent = opacity;
+        }
+        break;
+      }
+      case SyntheticScene::kClippedPictures: {
+        auto columns = std::max<int64_t>(
+            1, static_cast<int64_t>(std::sqrt(complexity)));
+        SkScalar cell_size = kSceneSize / columns;
+        for (int64_t i = 0; i < complexity; i++) {
+          SkScalar x = (i % columns) * cell_size;
+          SkScalar y = ((i / columns) % columns) * cell_size;
+          auto clip = std::make_shared<ClipRectLayer>(
+              SkRect::MakeXYWH(x, y, cell_size, cell_size),
+              Clip::kAntiAlias);
+          auto display_list = MakeRectsDisplayList(4);
+          *recorded_bytes += display_list->bytes();
+          clip->Add(std::make_shared<DisplayListLayer>(
+              SkPoint::Make(x, y), std::move(display_list), false, true));
+          root->Add(clip);
+        }
+        break;
+      }
+    }
+  };
+}
+
+double Percentile(std::vector<double>& samples, double percentile) {
+  if (samples.empty()) {
+    return 0;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto index = static_cast<size_t>(percentile * (samples.size() - 1));
+  return samples[index];
+}
+
+void ReportPercentiles(benchmark::State& state,
+                       const std::string& name,
+                       std::vector<double>& samples) {
+  state.counters[name + "_p50_ms"] = Percentile(samples, 0.5);
+  state.counters[name + "_p90_ms"] = Percentile(samples, 0.9);
+  state.counters[name + "_p99_ms"] = Percentile(samples, 0.99);
+}
+
+}  // namespace
+
+static void BM_ShellFrames(benchmark::State& state,
+                           ShellTestPlatformView::BackendType backend,
+                           SyntheticScene scene) {
+  DartFixture fixture;
+  Settings settings = fixture.CreateSettingsForFixture();
+
+  std::vector<double> build_times;
+  std::vector<double> raster_times;
+  fml::AutoResetWaitableEvent frame_latch;
+  settings.frame_rasterized_callback = [&](const FrameTiming& timing) {
+    build_times.push_back((timing.Get(FrameTiming::kBuildFinish) -
+                           timing.Get(FrameTiming::kBuildStart))
+                              .ToMillisecondsF());
+    raster_times.push_back((timing.Get(FrameTiming::kRasterFinish) -
+                            timing.Get(FrameTiming::kRasterStart))
+                               .ToMillisecondsF());
+    frame_latch.Signal();
+  };
+
+  ThreadHost thread_host(ThreadHost::ThreadHostConfig(
+      "io.flutter.bench.",
+      ThreadHost::Type::kPlatform | ThreadHost::Type::kRaster |
+          ThreadHost::Type::kIo | ThreadHost::Type::kUi));
+  TaskRunners task_runners("test",
+                           thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+
+  auto shell = Shell::Create(
+      flutter::PlatformData(), task_runners, settings,
+      ShellTestPlatformViewBuilder({.rendering_backend = backend}),
+      [](Shell& shell) { return std::make_unique<Rasterizer>(shell); });
+  FML_CHECK(shell);
+  ShellTest::PlatformViewNotifyCreated(shell.get());
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+  ShellTest::RunEngine(shell.get(), std::move(configuration));
+
+  size_t recorded_bytes = 0;
+  auto builder = MakeSceneBuilder(scene, state.range(0), &recorded_bytes);
+  for (auto _ : state) {
+    ShellTest::PumpOneFrame(shell.get(), ViewContent::ImplicitView(
+                                             kSceneSize, kSceneSize, builder));
+    frame_latch.Wait();
+  }
+
+  // Shutdown must occur synchronously on the platform thread.
+  fml::AutoResetWaitableEvent latch;
+  fml::TaskRunner::RunNowOrPostTask(task_runners.GetPlatformTaskRunner(),
+                                    [&shell, &latch]() mutable {
+                                      shell.reset();
+                                      latch.Signal();
+                                    });
+  latch.Wait();
+
+  ReportPercentiles(state, "build", build_times);
+  ReportPercentiles(state, "raster", raster_times);
+  state.counters["recorded_bytes_per_frame"] = recorded_bytes;
+}
+
+#define SHELL_FRAME_BENCHMARKS(name, backend)                              \
+  BENCHMARK_CAPTURE(BM_ShellFrames, Rects/name, backend,                   \
+                    SyntheticScene::kRects)                                \
+      ->RangeMultiplier(10)                                                \
+      ->Range(10, 10000)                                                   \
+      ->Unit(benchmark::kMillisecond);                                     \
+  BENCHMARK_CAPTURE(BM_ShellFrames, NestedOpacity/name, backend,           \
+                    SyntheticScene::kNestedOpacity)                        \
+      ->RangeMultiplier(4)                                                 \
+      ->Range(4, 256)                                                      \
+      ->Unit(benchmark::kMillisecond);                                     \
+  BENCHMARK_CAPTURE(BM_ShellFrames, ClippedPictures/name, backend,         \
+                    SyntheticScene::kClippedPictures)                      \
+      ->RangeMultiplier(4)                                                 \
+      ->Range(4, 1024)                                                     \
+      ->Unit(benchmark::kMillisecond);
+
+#ifdef SHELL_ENABLE_GL
+SHELL_FRAME_BENCHMARKS(OpenGL, ShellTestPlatformView::BackendType::kGLBackend)
+#endif  // SHELL_ENABLE_GL
+
+#ifdef SHELL_ENABLE_VULKAN
+SHELL_FRAME_BENCHMARKS(Vulkan,
+                       ShellTestPlatformView::BackendType::kVulkanBackend)
+#endif  // SHELL_ENABLE_VULKAN
+
+#ifdef SHELL_ENABLE_METAL
+SHELL_FRAME_BENCHMARKS(Metal, ShellTestPlatformView::BackendType::kMetalBackend)
+#endif  // SHELL_ENABLE_METAL
+
+}  // namespace testing
+}  // namespace flutter
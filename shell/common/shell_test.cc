@@ -318,6 +318,9 @@ void ShellTest::OnServiceProtocol(
       case ServiceProtocolEnum::kRenderFrameWithRasterStats:
         shell->OnServiceProtocolRenderFrameWithRasterStats(params, response);
         break;
+      case ServiceProtocolEnum::kGetFlightRecorder:
+        shell->OnServiceProtocolGetFlightRecorder(params, response);
+        break;
     }
     finished.set_value(true);
   });
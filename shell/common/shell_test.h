@@ -135,6 +135,7 @@ class ShellTest : public FixtureTest {
     kSetAssetBundlePath,
     kRunInView,
     kRenderFrameWithRasterStats,
+    kGetFlightRecorder,
   };
 
   // Helper method to test private method Shell::OnServiceProtocolGetSkSLs.
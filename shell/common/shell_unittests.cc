@@ -28,6 +28,7 @@
 #include "flutter/flow/layers/transform_layer.h"
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/command_line.h"
+#include "flutter/fml/flight_recorder.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/synchronization/count_down_latch.h"
@@ -125,6 +126,7 @@ class MockPlatformViewDelegate : public PlatformView::Delegate {
               OnPlatformViewMarkTextureFrameAvailable,
               (int64_t texture_id),
               (override));
+  MOCK_METHOD(void, OnPlatformViewPrepareToEmbedPlatformViews, (), (override));
 
   MOCK_METHOD(const Settings&,
               OnPlatformViewGetSettings,
@@ -250,6 +252,40 @@ class TestAssetResolver : public AssetResolver {
   AssetResolver::AssetResolverType type_;
 };
 
+// Has a single asset and counts how often it is asked for any asset.
+class CountingAssetResolver : public AssetResolver {
+ public:
+  explicit CountingAssetResolver(std::string asset_name)
+      : asset_name_(std::move(asset_name)) {}
+
+  // |AssetResolver|
+  bool IsValid() const override { return true; }
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override { return true; }
+
+  // |AssetResolver|
+  AssetResolver::AssetResolverType GetType() const override {
+    return AssetResolver::AssetResolverType::kDirectoryAssetBundle;
+  }
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override {
+    lookups_++;
+    if (asset_name != asset_name_) {
+      return nullptr;
+    }
+    return std::make_unique<fml::DataMapping>(asset_name_);
+  }
+
+  int GetLookups() const { return lookups_; }
+
+ private:
+  const std::string asset_name_;
+  mutable int lookups_ = 0;
+};
+
 class ThreadCheckingAssetResolver : public AssetResolver {
  public:
   explicit ThreadCheckingAssetResolver(
@@ -778,6 +814,53 @@ TEST_F(ShellTest, ReportTimingsIsCalled) {
   CheckFrameTimings(timings, start, finish);
 }
 
+TEST_F(ShellTest, StartupTimelineIsReportedAfterTheFirstFrame) {
+  auto settings = CreateSettingsForFixture();
+
+  StartupTimeline startup_timeline;
+  fml::AutoResetWaitableEvent timeline_latch;
+  settings.startup_timeline_callback =
+      [&startup_timeline, &timeline_latch](const StartupTimeline& timeline) {
+        startup_timeline = timeline;
+        timeline_latch.Signal();
+      };
+
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  PlatformViewNotifyCreated(shell.get());
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+  RunEngine(shell.get(), std::move(configuration));
+  PumpOneFrame(shell.get());
+  timeline_latch.Wait();
+
+  ASSERT_TRUE(startup_timeline.HasPhase(StartupTimeline::kSnapshotMapping));
+  ASSERT_TRUE(startup_timeline.HasPhase(StartupTimeline::kContextCreation));
+  ASSERT_TRUE(startup_timeline.HasPhase(StartupTimeline::kIsolateRun));
+  ASSERT_TRUE(startup_timeline.HasPhase(StartupTimeline::kFirstBuild));
+  ASSERT_TRUE(startup_timeline.HasPhase(StartupTimeline::kFirstRaster));
+  ASSERT_TRUE(startup_timeline.HasPhase(StartupTimeline::kFirstPresent));
+
+  const auto& isolate_run =
+      startup_timeline.GetPhase(StartupTimeline::kIsolateRun);
+  const auto& first_raster =
+      startup_timeline.GetPhase(StartupTimeline::kFirstRaster);
+  const auto& first_present =
+      startup_timeline.GetPhase(StartupTimeline::kFirstPresent);
+  EXPECT_EQ(isolate_run->thread, StartupTimeline::kUIThread);
+  EXPECT_EQ(first_raster->thread, StartupTimeline::kRasterThread);
+  EXPECT_LE(first_present->duration, first_raster->duration);
+  EXPECT_LE(first_raster->start, first_present->start);
+
+  // Later frames don't change the timeline.
+  PumpOneFrame(shell.get());
+  EXPECT_EQ(shell->GetStartupTimeline().GetPhase(StartupTimeline::kFirstRaster)
+                ->start,
+            first_raster->start);
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, FrameRasterizedCallbackIsCalled) {
   auto settings = CreateSettingsForFixture();
 
@@ -2407,6 +2490,50 @@ TEST_F(ShellTest, RasterizerScreenshot) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(ShellTest, RasterizerScreenshotAsync) {
+  Settings settings = CreateSettingsForFixture();
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  ThreadHost thread_host("io.flutter.test." + GetCurrentTestName() + ".",
+                         ThreadHost::Type::kPlatform |
+                             ThreadHost::Type::kRaster | ThreadHost::Type::kIo |
+                             ThreadHost::Type::kUi);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  PumpOneFrame(shell.get());
+
+  fml::AutoResetWaitableEvent latch;
+  Rasterizer::Screenshot screenshot;
+  fml::TaskRunner::RunNowOrPostTask(
+      shell->GetTaskRunners().GetRasterTaskRunner(),
+      [&shell, &latch, &screenshot]() {
+        shell->GetRasterizer()->ScreenshotLastLayerTreeAsync(
+            Rasterizer::ScreenshotType::CompressedImage, true,
+            [&latch, &screenshot](Rasterizer::Screenshot result) {
+              screenshot = std::move(result);
+              latch.Signal();
+            });
+      });
+  latch.Wait();
+  EXPECT_NE(screenshot.data, nullptr);
+  EXPECT_EQ(screenshot.format, "ScreenshotType::CompressedImage");
+
+  // The shell waits for asynchronous screenshots off the raster thread.
+  Rasterizer::Screenshot shell_screenshot =
+      shell->Screenshot(Rasterizer::ScreenshotType::CompressedImage, false);
+  EXPECT_NE(shell_screenshot.data, nullptr);
+
+  DestroyShell(std::move(shell), task_runners);
+}
+
 TEST_F(ShellTest, RasterizerMakeRasterSnapshot) {
   Settings settings = CreateSettingsForFixture();
   auto configuration = RunConfiguration::InferFromSettings(settings);
@@ -2545,6 +2672,37 @@ TEST_F(ShellTest, OnServiceProtocolEstimateRasterCacheMemoryWorks) {
 }
 
 // ktz
+TEST_F(ShellTest, OnServiceProtocolGetFlightRecorderWorks) {
+  Settings settings = CreateSettingsForFixture();
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  fml::AutoResetWaitableEvent latch;
+  shell->GetTaskRunners().GetRasterTaskRunner()->PostTask([&latch]() {
+    fml::FlightRecorder::Record(
+        "TestEvent",
+        fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromMicroseconds(1000)),
+        fml::TimeDelta::FromMicroseconds(250), 42);
+    latch.Signal();
+  });
+  latch.Wait();
+
+  ServiceProtocol::Handler::ServiceProtocolMap empty_params;
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kGetFlightRecorder,
+                    shell->GetTaskRunners().GetIOTaskRunner(), empty_params,
+                    &document);
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  document.Accept(writer);
+  std::string actual_json = buffer.GetString();
+  EXPECT_EQ(actual_json.find("{\"type\":\"FlightRecorder\","), 0u);
+  EXPECT_NE(actual_json.find("{\"name\":\"TestEvent\",\"startMicros\":1000,"
+                             "\"durationMicros\":250,\"id\":42}"),
+            std::string::npos);
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, OnServiceProtocolRenderFrameWithRasterStatsWorks) {
   auto settings = CreateSettingsForFixture();
   std::unique_ptr<Shell> shell = CreateShell(settings);
@@ -3179,6 +3337,31 @@ TEST_F(ShellTest, AssetManagerMultiSubdir) {
 }
 #endif  // OS_FUCHSIA
 
+TEST_F(ShellTest, AssetManagerSkipsResolversThatDidNotHaveAnAsset) {
+  auto first = std::make_unique<CountingAssetResolver>("first");
+  auto second = std::make_unique<CountingAssetResolver>("second");
+  auto* first_resolver = first.get();
+  auto* second_resolver = second.get();
+
+  AssetManager asset_manager;
+  asset_manager.PushBack(std::move(first));
+  asset_manager.PushBack(std::move(second));
+
+  EXPECT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  EXPECT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  EXPECT_EQ(first_resolver->GetLookups(), 1);
+  EXPECT_EQ(second_resolver->GetLookups(), 2);
+
+  // A resolver added in front takes precedence, so it is asked again.
+  auto front = std::make_unique<CountingAssetResolver>("front");
+  auto* front_resolver = front.get();
+  asset_manager.PushFront(std::move(front));
+  EXPECT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  EXPECT_EQ(front_resolver->GetLookups(), 1);
+  EXPECT_EQ(first_resolver->GetLookups(), 2);
+  EXPECT_EQ(second_resolver->GetLookups(), 3);
+}
+
 TEST_F(ShellTest, Spawn) {
   auto settings = CreateSettingsForFixture();
   auto shell = CreateShell(settings);
@@ -3849,6 +4032,27 @@ TEST_F(ShellTest, PrefetchDefaultFontManager) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(ShellTest, ParallelStartupRasterizesFirstFrame) {
+  auto settings = CreateSettingsForFixture();
+  settings.enable_parallel_startup = true;
+  fml::AutoResetWaitableEvent frame_latch;
+  settings.frame_rasterized_callback = [&frame_latch](const FrameTiming&) {
+    frame_latch.Signal();
+  };
+
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+  RunEngine(shell.get(), std::move(configuration));
+  PumpOneFrame(shell.get());
+  frame_latch.Wait();
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, OnPlatformViewCreatedWhenUIThreadIsBusy) {
   // This test will deadlock if the threading logic in
   // Shell::OnCreatePlatformView is wrong.
@@ -468,6 +468,32 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
       command_line.HasOption(FlagForSwitch(Switch::EnableVulkanValidation));
   settings.enable_opengl_gpu_tracing =
       command_line.HasOption(FlagForSwitch(Switch::EnableOpenGLGPUTracing));
+  settings.enable_concurrent_preroll =
+      command_line.HasOption(FlagForSwitch(Switch::EnableConcurrentPreroll));
+  settings.enable_deferred_tile_rasterization = command_line.HasOption(
+      FlagForSwitch(Switch::EnableDeferredTileRasterization));
+  settings.enable_adaptive_thread_affinity = command_line.HasOption(
+      FlagForSwitch(Switch::EnableAdaptiveThreadAffinity));
+  GetSwitchValue(command_line, Switch::FramePipelineDepth,
+                 &settings.frame_pipeline_depth);
+  settings.drop_late_frames =
+      command_line.HasOption(FlagForSwitch(Switch::DropLateFrames));
+  settings.enable_frame_pacing =
+      command_line.HasOption(FlagForSwitch(Switch::EnableFramePacing));
+  settings.enable_content_frame_rate =
+      command_line.HasOption(FlagForSwitch(Switch::EnableContentFrameRate));
+  settings.enable_pointer_resampling =
+      command_line.HasOption(FlagForSwitch(Switch::EnablePointerResampling));
+  settings.coalesce_pointer_moves =
+      command_line.HasOption(FlagForSwitch(Switch::CoalescePointerMoves));
+  settings.skip_unchanged_frames =
+      command_line.HasOption(FlagForSwitch(Switch::SkipUnchangedFrames));
+  settings.enable_concurrent_view_rasterization = command_line.HasOption(
+      FlagForSwitch(Switch::EnableConcurrentViewRasterization));
+  settings.enable_parallel_startup =
+      command_line.HasOption(FlagForSwitch(Switch::EnableParallelStartup));
+  settings.enable_yuv_image_decoding =
+      command_line.HasOption(FlagForSwitch(Switch::EnableYUVImageDecoding));
 
   settings.enable_embedder_api =
       command_line.HasOption(FlagForSwitch(Switch::EnableEmbedderAPI));
@@ -518,6 +544,16 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
         std::stoi(resource_cache_max_bytes_threshold);
   }
 
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::DecodedImageCacheMaxBytes))) {
+    std::string decoded_image_cache_max_bytes;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::DecodedImageCacheMaxBytes),
+        &decoded_image_cache_max_bytes);
+    settings.decoded_image_cache_max_bytes =
+        std::stoull(decoded_image_cache_max_bytes);
+  }
+
   if (command_line.HasOption(FlagForSwitch(Switch::MsaaSamples))) {
     std::string msaa_samples;
     command_line.GetOptionValue(FlagForSwitch(Switch::MsaaSamples),
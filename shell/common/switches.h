@@ -262,6 +262,10 @@ DEF_SWITCH(OldGenHeapSize,
 DEF_SWITCH(ResourceCacheMaxBytesThreshold,
            "resource-cache-max-bytes-threshold",
            "The max bytes threshold of resource cache, or 0 for unlimited.")
+DEF_SWITCH(DecodedImageCacheMaxBytes,
+           "decoded-image-cache-max-bytes",
+           "The max bytes of decoded images the engine caches by the contents "
+           "of their encoded data, or 0 to not cache them.")
 DEF_SWITCH(EnableImpeller,
            "enable-impeller",
            "Enable the Impeller renderer on supported platforms. Ignored if "
@@ -279,6 +283,59 @@ DEF_SWITCH(EnableOpenGLGPUTracing,
            "enable-opengl-gpu-tracing",
            "Enable tracing of GPU execution time when using the Impeller "
            "OpenGLES backend.")
+DEF_SWITCH(EnableConcurrentPreroll,
+           "enable-concurrent-preroll",
+           "Preroll the children of container layers with many children on "
+           "worker threads.")
+DEF_SWITCH(EnableDeferredTileRasterization,
+           "enable-deferred-tile-rasterization",
+           "Record large pictures in tiles on worker threads when rendering "
+           "with Skia.")
+DEF_SWITCH(EnableAdaptiveThreadAffinity,
+           "enable-adaptive-thread-affinity",
+           "Move the UI and raster threads to the efficiency cores while "
+           "frames are light or none are produced, and back to the "
+           "performance cores under load.")
+DEF_SWITCH(FramePipelineDepth,
+           "frame-pipeline-depth",
+           "The most frames the UI thread may build ahead of the raster "
+           "thread.")
+DEF_SWITCH(DropLateFrames,
+           "drop-late-frames",
+           "Skip queued frames that missed their target time when a newer "
+           "frame is waiting to be rasterized.")
+DEF_SWITCH(EnableFramePacing,
+           "enable-frame-pacing",
+           "Delay the start of each frame after the vsync by as much as the "
+           "build and raster times of the recent frames allow.")
+DEF_SWITCH(EnableContentFrameRate,
+           "enable-content-frame-rate",
+           "Lower the display refresh rate to 60, 30 or 24 Hz while the "
+           "content being animated doesn't need it to be any higher.")
+DEF_SWITCH(EnablePointerResampling,
+           "enable-pointer-resampling",
+           "Dispatch pointer moves once per frame, at the positions the "
+           "pointers had at the time of the vsync.")
+DEF_SWITCH(CoalescePointerMoves,
+           "coalesce-pointer-moves",
+           "Merge the pointer events that queue up while the UI thread is "
+           "busy, dropping the moves that later moves make stale.")
+DEF_SWITCH(SkipUnchangedFrames,
+           "skip-unchanged-frames",
+           "Don't rasterize or present frames that would draw the same pixels "
+           "as the last frame.")
+DEF_SWITCH(EnableConcurrentViewRasterization,
+           "enable-concurrent-view-rasterization",
+           "Prepare the frames of different views on worker threads when "
+           "several views are drawn at once.")
+DEF_SWITCH(EnableParallelStartup,
+           "enable-parallel-startup",
+           "Warm the resources that the first frame needs on worker threads "
+           "while the GPU context is being set up.")
+DEF_SWITCH(EnableYUVImageDecoding,
+           "enable-yuv-image-decoding",
+           "With Impeller, upload the luma and chroma planes of JPEG images "
+           "and convert them to RGB on the GPU.")
 DEF_SWITCH(LeakVM,
            "leak-vm",
            "When the last shell shuts down, the shared VM is leaked by default "
@@ -0,0 +1,65 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/thread_affinity_policy.h"
+
+namespace flutter {
+
+std::optional<fml::CpuAffinity> ThreadAffinityPolicy::OnFrameStart(
+    fml::TimePoint now) {
+  last_frame_time_ = now;
+  if (!idle_) {
+    return std::nullopt;
+  }
+  idle_ = false;
+  return SetAffinity(fml::CpuAffinity::kPerformance);
+}
+
+std::optional<fml::CpuAffinity> ThreadAffinityPolicy::OnFrameEnd(
+    fml::TimeDelta work_time,
+    fml::Milliseconds frame_budget,
+    fml::TimePoint now) {
+  last_frame_time_ = now;
+  idle_ = false;
+  if (frame_budget.count() <= 0) {
+    return std::nullopt;
+  }
+
+  double load = work_time.ToMillisecondsF() / frame_budget.count();
+  if (load >= kHeavyFrameLoad) {
+    light_frame_count_ = 0;
+    return SetAffinity(fml::CpuAffinity::kPerformance);
+  }
+  if (load >= kLightFrameLoad) {
+    // Frames in between keep the thread where it is, so that a workload
+    // close to one of the thresholds does not move it back and forth.
+    light_frame_count_ = 0;
+    return std::nullopt;
+  }
+  if (++light_frame_count_ < kLightFramesToDemote) {
+    return std::nullopt;
+  }
+  return SetAffinity(fml::CpuAffinity::kEfficiency);
+}
+
+std::optional<fml::CpuAffinity> ThreadAffinityPolicy::OnIdleCheck(
+    fml::TimePoint now) {
+  if (idle_ || now < GetIdleDeadline()) {
+    return std::nullopt;
+  }
+  idle_ = true;
+  light_frame_count_ = 0;
+  return SetAffinity(fml::CpuAffinity::kEfficiency);
+}
+
+std::optional<fml::CpuAffinity> ThreadAffinityPolicy::SetAffinity(
+    fml::CpuAffinity affinity) {
+  if (affinity_ == affinity) {
+    return std::nullopt;
+  }
+  affinity_ = affinity;
+  return affinity;
+}
+
+}  // namespace flutter
@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_THREAD_AFFINITY_POLICY_H_
+#define FLUTTER_SHELL_COMMON_THREAD_AFFINITY_POLICY_H_
+
+#include <cstddef>
+#include <optional>
+
+#include "flutter/fml/cpu_affinity.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// Decides which cores a thread that does work for every frame, such as the
+/// UI or the raster thread, should run on.
+///
+/// A thread starts on the performance cores. It is moved to the efficiency
+/// cores once no frame has been produced for |kIdleTimeout|, or once the
+/// work it did for |kLightFramesToDemote| frames in a row took less than
+/// |kLightFrameLoad| of the frame budget. It is moved back to the
+/// performance cores when a frame starts after it went idle, or as soon as
+/// the work for a frame takes |kHeavyFrameLoad| of the frame budget or more.
+///
+/// The policy only decides. The caller applies the decisions between frames
+/// so that a thread is never moved in the middle of one. This class is not
+/// thread safe.
+class ThreadAffinityPolicy {
+ public:
+  static constexpr double kHeavyFrameLoad = 0.5;
+  static constexpr double kLightFrameLoad = 0.25;
+  static constexpr size_t kLightFramesToDemote = 120;
+  static constexpr fml::TimeDelta kIdleTimeout =
+      fml::TimeDelta::FromSeconds(1);
+
+  ThreadAffinityPolicy() = default;
+
+  fml::CpuAffinity GetAffinity() const { return affinity_; }
+
+  /// Whether no frame has been produced since the thread went idle.
+  bool IsIdle() const { return idle_; }
+
+  /// The time at which the thread is considered idle if no frame starts or
+  /// ends before then.
+  fml::TimePoint GetIdleDeadline() const {
+    return last_frame_time_ + kIdleTimeout;
+  }
+
+  /// Called when the thread starts working on a frame. Returns the affinity
+  /// to request if it changed.
+  std::optional<fml::CpuAffinity> OnFrameStart(fml::TimePoint now);
+
+  /// Called once the thread has spent |work_time| on a frame that had
+  /// |frame_budget| to be produced in. Returns the affinity to request if it
+  /// changed.
+  std::optional<fml::CpuAffinity> OnFrameEnd(fml::TimeDelta work_time,
+                                             fml::Milliseconds frame_budget,
+                                             fml::TimePoint now);
+
+  /// Called while no frame is being produced. Returns the affinity to
+  /// request if it changed.
+  std::optional<fml::CpuAffinity> OnIdleCheck(fml::TimePoint now);
+
+ private:
+  std::optional<fml::CpuAffinity> SetAffinity(fml::CpuAffinity affinity);
+
+  fml::CpuAffinity affinity_ = fml::CpuAffinity::kPerformance;
+  bool idle_ = false;
+  size_t light_frame_count_ = 0;
+  fml::TimePoint last_frame_time_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_THREAD_AFFINITY_POLICY_H_
@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/thread_affinity_policy.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr fml::Milliseconds kFrameBudget = fml::kDefaultFrameBudget;
+
+fml::TimeDelta WorkTime(double load) {
+  return fml::TimeDelta::FromMillisecondsF(kFrameBudget.count() * load);
+}
+
+}  // namespace
+
+TEST(ThreadAffinityPolicyTest, StartsOnPerformanceCores) {
+  ThreadAffinityPolicy policy;
+  EXPECT_EQ(policy.GetAffinity(), fml::CpuAffinity::kPerformance);
+  EXPECT_FALSE(policy.OnFrameStart(fml::TimePoint::Now()).has_value());
+}
+
+TEST(ThreadAffinityPolicyTest, DemotesAfterLightFrames) {
+  ThreadAffinityPolicy policy;
+  fml::TimePoint now = fml::TimePoint::Now();
+  for (size_t i = 1; i < ThreadAffinityPolicy::kLightFramesToDemote; i++) {
+    EXPECT_FALSE(
+        policy.OnFrameEnd(WorkTime(0.1), kFrameBudget, now).has_value());
+  }
+  auto affinity = policy.OnFrameEnd(WorkTime(0.1), kFrameBudget, now);
+  ASSERT_TRUE(affinity.has_value());
+  EXPECT_EQ(affinity.value(), fml::CpuAffinity::kEfficiency);
+
+  // Starting another frame does not move the thread back by itself.
+  EXPECT_FALSE(policy.OnFrameStart(now).has_value());
+  EXPECT_EQ(policy.GetAffinity(), fml::CpuAffinity::kEfficiency);
+}
+
+TEST(ThreadAffinityPolicyTest, FramesInBetweenResetTheLightFrameCount) {
+  ThreadAffinityPolicy policy;
+  fml::TimePoint now = fml::TimePoint::Now();
+  for (size_t i = 1; i < ThreadAffinityPolicy::kLightFramesToDemote; i++) {
+    EXPECT_FALSE(
+        policy.OnFrameEnd(WorkTime(0.1), kFrameBudget, now).has_value());
+  }
+  EXPECT_FALSE(policy.OnFrameEnd(WorkTime(0.4), kFrameBudget, now).has_value());
+  EXPECT_FALSE(policy.OnFrameEnd(WorkTime(0.1), kFrameBudget, now).has_value());
+  EXPECT_EQ(policy.GetAffinity(), fml::CpuAffinity::kPerformance);
+}
+
+TEST(ThreadAffinityPolicyTest, PromotesOnHeavyFrame) {
+  ThreadAffinityPolicy policy;
+  fml::TimePoint now = fml::TimePoint::Now();
+  for (size_t i = 0; i < ThreadAffinityPolicy::kLightFramesToDemote; i++) {
+    policy.OnFrameEnd(WorkTime(0.1), kFrameBudget, now);
+  }
+  ASSERT_EQ(policy.GetAffinity(), fml::CpuAffinity::kEfficiency);
+
+  EXPECT_FALSE(policy.OnFrameEnd(WorkTime(0.4), kFrameBudget, now).has_value());
+  auto affinity = policy.OnFrameEnd(WorkTime(0.6), kFrameBudget, now);
+  ASSERT_TRUE(affinity.has_value());
+  EXPECT_EQ(affinity.value(), fml::CpuAffinity::kPerformance);
+}
+
+TEST(ThreadAffinityPolicyTest, DemotesWhenIdleAndPromotesOnFrameStart) {
+  ThreadAffinityPolicy policy;
+  fml::TimePoint now = fml::TimePoint::Now();
+  policy.OnFrameEnd(WorkTime(0.4), kFrameBudget, now);
+
+  EXPECT_FALSE(policy.OnIdleCheck(now + fml::TimeDelta::FromMilliseconds(500))
+                   .has_value());
+  auto affinity = policy.OnIdleCheck(policy.GetIdleDeadline());
+  ASSERT_TRUE(affinity.has_value());
+  EXPECT_EQ(affinity.value(), fml::CpuAffinity::kEfficiency);
+  EXPECT_TRUE(policy.IsIdle());
+
+  affinity = policy.OnFrameStart(now + fml::TimeDelta::FromSeconds(2));
+  ASSERT_TRUE(affinity.has_value());
+  EXPECT_EQ(affinity.value(), fml::CpuAffinity::kPerformance);
+  EXPECT_FALSE(policy.IsIdle());
+}
+
+}  // namespace testing
+}  // namespace flutter
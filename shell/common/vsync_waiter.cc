@@ -128,7 +128,9 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
     fml::TaskQueueId ui_task_queue_id =
         task_runners_.GetUITaskRunner()->GetTaskQueueId();
 
-    task_runners_.GetUITaskRunner()->PostTask(
+    // The frame has to be built by its target time, so it goes ahead of the
+    // other tasks on the UI thread, such as platform messages.
+    task_runners_.GetUITaskRunner()->PostTaskWithDeadline(
         [ui_task_queue_id, callback, flow_identifier, frame_start_time,
          frame_target_time, pause_secondary_tasks]() {
           FML_TRACE_EVENT_WITH_FLOW_IDS(
@@ -144,7 +146,8 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
           if (pause_secondary_tasks) {
             ResumeDartMicroTasks(ui_task_queue_id);
           }
-        });
+        },
+        frame_target_time);
   }
 
   for (auto& secondary_callback : secondary_callbacks) {
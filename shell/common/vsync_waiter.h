@@ -35,6 +35,13 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   /// |Animator::ScheduleMaybeClearTraceFlowIds|.
   void ScheduleSecondaryCallback(uintptr_t id, const fml::closure& callback);
 
+  /// Asks the display to refresh at |frame_rate| Hz, because nothing that is
+  /// being animated needs it to refresh any faster. A |frame_rate| of 0
+  /// removes the preference. Called on the UI thread.
+  ///
+  /// The default implementation ignores the preference.
+  virtual void SetPreferredFrameRate(double frame_rate) {}
+
  protected:
   // On some backends, the |FireCallback| needs to be made from a static C
   // method.
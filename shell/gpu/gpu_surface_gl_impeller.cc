@@ -4,6 +4,9 @@
 
 #include "flutter/shell/gpu/gpu_surface_gl_impeller.h"
 
+#include <memory>
+#include <optional>
+
 #include "flutter/fml/make_copyable.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/gles/surface_gles.h"
@@ -14,7 +17,8 @@ namespace flutter {
 
 GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
     GPUSurfaceGLDelegate* delegate,
-    std::shared_ptr<impeller::Context> context)
+    std::shared_ptr<impeller::Context> context,
+    std::shared_ptr<impeller::AiksContext> aiks_context)
     : weak_factory_(this) {
   if (delegate == nullptr) {
     return;
@@ -29,8 +33,10 @@ GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+  if (!aiks_context) {
+    aiks_context = std::make_shared<impeller::AiksContext>(
+        context, impeller::TypographerContextSkia::Make());
+  }
 
   if (!aiks_context->IsValid()) {
     return;
@@ -93,40 +99,47 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
       impeller::ISize{size.width(), size.height()}  // fbo_size
   );
 
+  // Recorded by the prepare callback, which may run on a worker thread, and
+  // rendered by the submit callback.
+  auto picture = std::make_shared<std::optional<impeller::Picture>>();
+  auto cull_rect =
+      surface->GetTargetRenderPassDescriptor().GetRenderTargetSize();
+
+  SurfaceFrame::PrepareCallback prepare_callback =
+      [picture, cull_rect](SurfaceFrame& surface_frame) -> bool {
+    auto display_list = surface_frame.BuildDisplayList();
+    if (!display_list) {
+      FML_LOG(ERROR) << "Could not build display list for surface frame.";
+      return false;
+    }
+
+    impeller::Rect dl_cull_rect = impeller::Rect::MakeSize(cull_rect);
+    impeller::DlDispatcher impeller_dispatcher(dl_cull_rect);
+    display_list->Dispatch(impeller_dispatcher,
+                           SkIRect::MakeWH(cull_rect.width, cull_rect.height));
+    *picture = impeller_dispatcher.EndRecordingAsPicture();
+    return true;
+  };
+
   SurfaceFrame::SubmitCallback submit_callback =
       fml::MakeCopyable([renderer = impeller_renderer_,  //
                          aiks_context = aiks_context_,   //
-                         surface = std::move(surface)    //
+                         surface = std::move(surface),   //
+                         picture                         //
   ](SurfaceFrame& surface_frame, DlCanvas* canvas) mutable -> bool {
-        if (!aiks_context) {
+        if (!aiks_context || !picture->has_value()) {
           return false;
         }
 
-        auto display_list = surface_frame.BuildDisplayList();
-        if (!display_list) {
-          FML_LOG(ERROR) << "Could not build display list for surface frame.";
-          return false;
-        }
-
-        auto cull_rect =
-            surface->GetTargetRenderPassDescriptor().GetRenderTargetSize();
-        impeller::Rect dl_cull_rect = impeller::Rect::MakeSize(cull_rect);
-        impeller::DlDispatcher impeller_dispatcher(dl_cull_rect);
-        display_list->Dispatch(
-            impeller_dispatcher,
-            SkIRect::MakeWH(cull_rect.width, cull_rect.height));
-        auto picture = impeller_dispatcher.EndRecordingAsPicture();
-
         return renderer->Render(
             std::move(surface),
-            fml::MakeCopyable(
-                [aiks_context, picture = std::move(picture)](
-                    impeller::RenderTarget& render_target) -> bool {
-                  return aiks_context->Render(picture, render_target);
-                }));
+            [&aiks_context, &picture](
+                impeller::RenderTarget& render_target) -> bool {
+              return aiks_context->Render(picture->value(), render_target);
+            });
       });
 
-  return std::make_unique<SurfaceFrame>(
+  auto frame = std::make_unique<SurfaceFrame>(
       nullptr,                                // surface
       delegate_->GLContextFramebufferInfo(),  // framebuffer info
       submit_callback,                        // submit callback
@@ -134,6 +147,8 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
       std::move(context_switch),              // context result
       true                                    // display list fallback
   );
+  frame->set_prepare_callback(prepare_callback);
+  return frame;
 }
 
 // |Surface|
@@ -166,7 +181,7 @@ bool GPUSurfaceGLImpeller::AllowsDrawingWhenGpuDisabled() const {
 
 // |Surface|
 bool GPUSurfaceGLImpeller::EnableRasterCache() const {
-  return false;
+  return true;
 }
 
 // |Surface|
@@ -17,8 +17,10 @@ namespace flutter {
 
 class GPUSurfaceGLImpeller final : public Surface {
  public:
-  explicit GPUSurfaceGLImpeller(GPUSurfaceGLDelegate* delegate,
-                                std::shared_ptr<impeller::Context> context);
+  explicit GPUSurfaceGLImpeller(
+      GPUSurfaceGLDelegate* delegate,
+      std::shared_ptr<impeller::Context> context,
+      std::shared_ptr<impeller::AiksContext> aiks_context = nullptr);
 
   // |Surface|
   ~GPUSurfaceGLImpeller() override;
@@ -21,9 +21,11 @@ namespace flutter {
 class IMPELLER_CA_METAL_LAYER_AVAILABLE GPUSurfaceMetalImpeller
     : public Surface {
  public:
-  GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delegate,
-                          const std::shared_ptr<impeller::Context>& context,
-                          bool render_to_surface = true);
+  GPUSurfaceMetalImpeller(
+      GPUSurfaceMetalDelegate* delegate,
+      const std::shared_ptr<impeller::Context>& context,
+      bool render_to_surface = true,
+      const std::shared_ptr<impeller::AiksContext>& aiks_context = nullptr);
 
   // |Surface|
   ~GPUSurfaceMetalImpeller();
@@ -33,6 +35,9 @@ class IMPELLER_CA_METAL_LAYER_AVAILABLE GPUSurfaceMetalImpeller
 
   virtual Surface::SurfaceData GetSurfaceData() const override;
 
+  // |Surface|
+  std::shared_ptr<impeller::AiksContext> GetAiksContext() const override;
+
  private:
   const GPUSurfaceMetalDelegate* delegate_;
   const MTLRenderTargetType render_target_type_;
@@ -74,9 +79,6 @@ class IMPELLER_CA_METAL_LAYER_AVAILABLE GPUSurfaceMetalImpeller
   // |Surface|
   bool EnableRasterCache() const override;
 
-  // |Surface|
-  std::shared_ptr<impeller::AiksContext> GetAiksContext() const override;
-
   FML_DISALLOW_COPY_AND_ASSIGN(GPUSurfaceMetalImpeller);
 };
 
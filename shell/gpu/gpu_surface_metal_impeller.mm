@@ -12,6 +12,8 @@
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/display_list/dl_dispatcher.h"
+#include "impeller/renderer/backend/metal/context_mtl.h"
+#include "impeller/renderer/backend/metal/lazy_drawable_holder.h"
 #include "impeller/renderer/backend/metal/surface_mtl.h"
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
@@ -19,6 +21,15 @@ static_assert(!__has_feature(objc_arc), "ARC must be disabled.");
 
 namespace flutter {
 
+static std::shared_ptr<impeller::TypographerContext> CreateTypographerContext(
+    const std::shared_ptr<impeller::Context>& context) {
+  if (!context) {
+    return impeller::TypographerContextSkia::Make();
+  }
+  return impeller::TypographerContextSkia::Make(
+      impeller::ContextMTL::Cast(*context).GetWorkerTaskRunner());
+}
+
 static std::shared_ptr<impeller::Renderer> CreateImpellerRenderer(
     std::shared_ptr<impeller::Context> context) {
   auto renderer = std::make_shared<impeller::Renderer>(std::move(context));
@@ -29,15 +40,26 @@ static std::shared_ptr<impeller::Renderer> CreateImpellerRenderer(
   return renderer;
 }
 
-GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delegate,
-                                                 const std::shared_ptr<impeller::Context>& context,
-                                                 bool render_to_surface)
+static std::shared_ptr<impeller::AiksContext> CreateAiksContext(
+    const std::shared_ptr<impeller::Renderer>& renderer,
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::AiksContext>& shared_aiks_context) {
+  if (renderer && shared_aiks_context && shared_aiks_context->GetContext() == context) {
+    return shared_aiks_context;
+  }
+  return std::make_shared<impeller::AiksContext>(renderer ? context : nullptr,
+                                                 CreateTypographerContext(context));
+}
+
+GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(
+    GPUSurfaceMetalDelegate* delegate,
+    const std::shared_ptr<impeller::Context>& context,
+    bool render_to_surface,
+    const std::shared_ptr<impeller::AiksContext>& aiks_context)
     : delegate_(delegate),
       render_target_type_(delegate->GetRenderTargetType()),
       impeller_renderer_(CreateImpellerRenderer(context)),
-      aiks_context_(
-          std::make_shared<impeller::AiksContext>(impeller_renderer_ ? context : nullptr,
-                                                  impeller::TypographerContextSkia::Make())),
+      aiks_context_(CreateAiksContext(impeller_renderer_, context, aiks_context)),
       render_to_surface_(render_to_surface) {
   // If this preference is explicitly set, we allow for disabling partial repaint.
   NSNumber* disablePartialRepaint =
@@ -97,22 +119,27 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
 
   auto* mtl_layer = (CAMetalLayer*)layer;
 
-  auto drawable = impeller::SurfaceMTL::GetMetalDrawableAndValidate(
-      impeller_renderer_->GetContext(), mtl_layer);
-  if (!drawable) {
-    return nullptr;
-  }
-  if (Settings::kSurfaceDataAccessible) {
-    last_texture_.reset([drawable.texture retain]);
+  // The drawable is acquired lazily, when the root pass is encoded or the
+  // surface is presented, so that a wait in nextDrawable overlaps with the
+  // encoding of everything that precedes it. Partial repaint tracks damage per
+  // drawable texture and needs that texture now, so it gives up the overlap.
+  auto drawable_future = impeller::GetDrawableDeferred(mtl_layer);
+  uintptr_t damage_key = 0;
+  if (!disable_partial_repaint_) {
+    id<CAMetalDrawable> drawable = drawable_future.get();
+    if (!drawable) {
+      return nullptr;
+    }
+    damage_key = reinterpret_cast<uintptr_t>(drawable.texture);
   }
 
-  id<MTLTexture> last_texture = static_cast<id<MTLTexture>>(last_texture_);
   SurfaceFrame::SubmitCallback submit_callback =
       fml::MakeCopyable([this,                           //
                          renderer = impeller_renderer_,  //
                          aiks_context = aiks_context_,   //
-                         drawable,                       //
-                         last_texture                    //
+                         mtl_layer,                      //
+                         drawable_future,                //
+                         damage_key                      //
   ](SurfaceFrame& surface_frame, DlCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
           return false;
@@ -125,10 +152,8 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
         }
 
         if (!disable_partial_repaint_) {
-          uintptr_t texture = reinterpret_cast<uintptr_t>(last_texture);
-
           for (auto& entry : damage_) {
-            if (entry.first != texture) {
+            if (entry.first != damage_key) {
               // Accumulate damage for other framebuffers
               if (surface_frame.submit_info().frame_damage) {
                 entry.second.join(*surface_frame.submit_info().frame_damage);
@@ -136,7 +161,7 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
             }
           }
           // Reset accumulated damage for current framebuffer
-          damage_[texture] = SkIRect::MakeEmpty();
+          damage_[damage_key] = SkIRect::MakeEmpty();
         }
 
         std::optional<impeller::IRect> clip_rect;
@@ -146,8 +171,11 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
                                                 buffer_damage->width(), buffer_damage->height());
         }
 
-        auto surface = impeller::SurfaceMTL::MakeFromMetalLayerDrawable(
-            impeller_renderer_->GetContext(), drawable, clip_rect);
+        auto surface = impeller::SurfaceMTL::MakeFromMetalLayer(
+            impeller_renderer_->GetContext(), mtl_layer, drawable_future, clip_rect);
+        if (!surface) {
+          return false;
+        }
 
         if (clip_rect && (clip_rect->size.width == 0 || clip_rect->size.height == 0)) {
           return surface->Present();
@@ -156,15 +184,22 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
         impeller::IRect cull_rect = surface->coverage();
         SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.size.width, cull_rect.size.height);
         impeller::DlDispatcher impeller_dispatcher(cull_rect);
+        impeller_dispatcher.SetConcurrentTaskRunner(
+            impeller::ContextMTL::Cast(*renderer->GetContext()).GetWorkerTaskRunner());
         display_list->Dispatch(impeller_dispatcher, sk_cull_rect);
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
 
-        return renderer->Render(
+        bool render_result = renderer->Render(
             std::move(surface),
             fml::MakeCopyable([aiks_context, picture = std::move(picture)](
                                   impeller::RenderTarget& render_target) -> bool {
               return aiks_context->Render(picture, render_target);
             }));
+        if (Settings::kSurfaceDataAccessible) {
+          id<CAMetalDrawable> drawable = drawable_future.get();
+          last_texture_.reset([drawable.texture retain]);
+        }
+        return render_result;
       });
 
   SurfaceFrame::FramebufferInfo framebuffer_info;
@@ -173,8 +208,7 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
   if (!disable_partial_repaint_) {
     // Provide accumulated damage to rasterizer (area in current framebuffer that lags behind
     // front buffer)
-    uintptr_t texture = reinterpret_cast<uintptr_t>(drawable.texture);
-    auto i = damage_.find(texture);
+    auto i = damage_.find(damage_key);
     if (i != damage_.end()) {
       framebuffer_info.existing_damage = i->second;
     }
@@ -254,6 +288,8 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromMTLTextur
         impeller::IRect cull_rect = surface->coverage();
         SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.size.width, cull_rect.size.height);
         impeller::DlDispatcher impeller_dispatcher(cull_rect);
+        impeller_dispatcher.SetConcurrentTaskRunner(
+            impeller::ContextMTL::Cast(*renderer->GetContext()).GetWorkerTaskRunner());
         display_list->Dispatch(impeller_dispatcher, sk_cull_rect);
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
 
@@ -318,7 +354,7 @@ bool GPUSurfaceMetalImpeller::AllowsDrawingWhenGpuDisabled() const {
 
 // |Surface|
 bool GPUSurfaceMetalImpeller::EnableRasterCache() const {
-  return false;
+  return true;
 }
 
 // |Surface|
@@ -10,6 +10,7 @@
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkSize.h"
 #include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/gpu/GrBackendSemaphore.h"
 #include "third_party/skia/include/gpu/GrBackendSurface.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 #include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
@@ -67,7 +68,18 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkan::AcquireFrame(
     return nullptr;
   }
 
-  SurfaceFrame::SubmitCallback callback = [image = image, delegate = delegate_](
+#ifdef SK_VULKAN
+  // The embedder may still be reading the previous frame from the image.
+  if (image.wait_semaphore) {
+    GrBackendSemaphore wait_semaphore;
+    wait_semaphore.initVulkan(
+        reinterpret_cast<VkSemaphore>(image.wait_semaphore));
+    surface->wait(1, &wait_semaphore, /*deleteSemaphoresAfterWait=*/false);
+  }
+#endif  // SK_VULKAN
+
+  SurfaceFrame::SubmitCallback callback = [image = image, delegate = delegate_,
+                                           context = skia_context_](
                                               const SurfaceFrame&,
                                               DlCanvas* canvas) -> bool {
     TRACE_EVENT0("flutter", "GPUSurfaceVulkan::PresentImage");
@@ -76,6 +88,23 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkan::AcquireFrame(
       return false;
     }
 
+#ifdef SK_VULKAN
+    // The embedder waits for the frame on the GPU instead of relying on the
+    // host sync.
+    if (image.signal_semaphore) {
+      GrBackendSemaphore signal_semaphore;
+      signal_semaphore.initVulkan(
+          reinterpret_cast<VkSemaphore>(image.signal_semaphore));
+      GrFlushInfo flush_info;
+      flush_info.fNumSemaphores = 1;
+      flush_info.fSignalSemaphores = &signal_semaphore;
+      context->flush(flush_info);
+      context->submit();
+      return delegate->PresentImage(reinterpret_cast<VkImage>(image.image),
+                                    static_cast<VkFormat>(image.format));
+    }
+#endif  // SK_VULKAN
+
     canvas->Flush();
 
     return delegate->PresentImage(reinterpret_cast<VkImage>(image.image),
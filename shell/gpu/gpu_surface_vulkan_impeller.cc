@@ -4,17 +4,37 @@
 
 #include "flutter/shell/gpu/gpu_surface_vulkan_impeller.h"
 
+#include <memory>
+#include <optional>
+
 #include "flutter/fml/make_copyable.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/vulkan/surface_context_vk.h"
+#include "impeller/renderer/backend/vulkan/texture_vk.h"
 #include "impeller/renderer/renderer.h"
 #include "impeller/renderer/surface.h"
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
 namespace flutter {
 
+namespace {
+
+// The part of the swapchain image that is repainted, from the buffer damage.
+std::optional<impeller::IRect> GetClipRect(const SurfaceFrame& surface_frame) {
+  const auto& buffer_damage = surface_frame.submit_info().buffer_damage;
+  if (!buffer_damage.has_value()) {
+    return std::nullopt;
+  }
+  return impeller::IRect::MakeXYWH(buffer_damage->x(), buffer_damage->y(),
+                                   buffer_damage->width(),
+                                   buffer_damage->height());
+}
+
+}  // namespace
+
 GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
-    std::shared_ptr<impeller::Context> context) {
+    std::shared_ptr<impeller::Context> context,
+    std::shared_ptr<impeller::AiksContext> aiks_context) {
   if (!context || !context->IsValid()) {
     return;
   }
@@ -24,8 +44,12 @@ GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+  if (!aiks_context) {
+    auto& context_vk = impeller::SurfaceContextVK::Cast(*context);
+    aiks_context = std::make_shared<impeller::AiksContext>(
+        context, impeller::TypographerContextSkia::Make(
+                     context_vk.GetConcurrentWorkerTaskRunner()));
+  }
   if (!aiks_context->IsValid()) {
     return;
   }
@@ -65,47 +89,139 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
     return nullptr;
   }
 
+  // Swapchain images are recreated when the size changes, so damage recorded
+  // for the old images no longer applies.
+  if (size != damage_frame_size_) {
+    damage_.clear();
+    damage_frame_size_ = size;
+  }
+  uint64_t image_id = reinterpret_cast<uint64_t>(static_cast<VkImage>(
+      impeller::TextureVK::Cast(
+          *surface->GetTargetRenderPassDescriptor().GetRenderTargetTexture())
+          .GetImage()));
+
+  // Recorded by the prepare callback, which may run on a worker thread, and
+  // rendered by the submit callback. It stays empty when nothing was damaged.
+  auto picture = std::make_shared<std::optional<impeller::Picture>>();
+  auto target_size =
+      surface->GetTargetRenderPassDescriptor().GetRenderTargetSize();
+  auto concurrent_task_runner = context_vk.GetConcurrentWorkerTaskRunner();
+
+  SurfaceFrame::PrepareCallback prepare_callback =
+      [picture, target_size,
+       concurrent_task_runner](SurfaceFrame& surface_frame) -> bool {
+    auto display_list = surface_frame.BuildDisplayList();
+    if (!display_list) {
+      FML_LOG(ERROR) << "Could not build display list for surface frame.";
+      return false;
+    }
+
+    std::optional<impeller::IRect> clip_rect = GetClipRect(surface_frame);
+    if (clip_rect && clip_rect->IsEmpty()) {
+      return true;
+    }
+
+    auto cull_rect = clip_rect.has_value() ? clip_rect->size : target_size;
+    impeller::Rect dl_cull_rect = impeller::Rect::MakeSize(cull_rect);
+    impeller::DlDispatcher impeller_dispatcher(dl_cull_rect);
+    impeller_dispatcher.SetConcurrentTaskRunner(concurrent_task_runner);
+    display_list->Dispatch(impeller_dispatcher,
+                           SkIRect::MakeWH(cull_rect.width, cull_rect.height));
+    *picture = impeller_dispatcher.EndRecordingAsPicture();
+    return true;
+  };
+
   SurfaceFrame::SubmitCallback submit_callback =
-      fml::MakeCopyable([renderer = impeller_renderer_,  //
+      fml::MakeCopyable([this,                           //
+                         renderer = impeller_renderer_,  //
                          aiks_context = aiks_context_,   //
-                         surface = std::move(surface)    //
+                         surface = std::move(surface),   //
+                         picture,                        //
+                         image_id                        //
   ](SurfaceFrame& surface_frame, DlCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
           return false;
         }
 
-        auto display_list = surface_frame.BuildDisplayList();
-        if (!display_list) {
-          FML_LOG(ERROR) << "Could not build display list for surface frame.";
+        for (auto& entry : damage_) {
+          if (entry.first != image_id) {
+            // Accumulate damage for other swapchain images.
+            if (surface_frame.submit_info().frame_damage) {
+              entry.second.join(*surface_frame.submit_info().frame_damage);
+            }
+          }
+        }
+        // Reset accumulated damage for the current swapchain image.
+        damage_[image_id] = SkIRect::MakeEmpty();
+
+        std::optional<impeller::IRect> clip_rect = GetClipRect(surface_frame);
+        if (clip_rect && clip_rect->IsEmpty()) {
+          return surface->Present();
+        }
+        if (!picture->has_value()) {
           return false;
         }
 
-        auto cull_rect =
-            surface->GetTargetRenderPassDescriptor().GetRenderTargetSize();
-        impeller::Rect dl_cull_rect = impeller::Rect::MakeSize(cull_rect);
-        impeller::DlDispatcher impeller_dispatcher(dl_cull_rect);
-        display_list->Dispatch(
-            impeller_dispatcher,
-            SkIRect::MakeWH(cull_rect.width, cull_rect.height));
-        auto picture = impeller_dispatcher.EndRecordingAsPicture();
+        if (clip_rect.has_value()) {
+          // compositor_context.cc offsets the rendering by the clip origin.
+          // Render just the damaged area and copy it into the swapchain image,
+          // which still holds the rest of the previous frame.
+          return RenderPartialRepaint(*aiks_context, picture->value(),
+                                      std::move(surface), clip_rect.value());
+        }
 
         return renderer->Render(
             std::move(surface),
-            fml::MakeCopyable(
-                [aiks_context, picture = std::move(picture)](
-                    impeller::RenderTarget& render_target) -> bool {
-                  return aiks_context->Render(picture, render_target);
-                }));
+            [&aiks_context, &picture](
+                impeller::RenderTarget& render_target) -> bool {
+              return aiks_context->Render(picture->value(), render_target);
+            });
       });
 
-  return std::make_unique<SurfaceFrame>(
-      nullptr,                          // surface
-      SurfaceFrame::FramebufferInfo{},  // framebuffer info
-      submit_callback,                  // submit callback
-      size,                             // frame size
-      nullptr,                          // context result
-      true                              // display list fallback
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  framebuffer_info.supports_partial_repaint = true;
+  auto existing_damage = damage_.find(image_id);
+  if (existing_damage != damage_.end()) {
+    framebuffer_info.existing_damage = existing_damage->second;
+  }
+
+  auto frame = std::make_unique<SurfaceFrame>(
+      nullptr,           // surface
+      framebuffer_info,  // framebuffer info
+      submit_callback,   // submit callback
+      size,              // frame size
+      nullptr,           // context result
+      true               // display list fallback
   );
+  frame->set_prepare_callback(prepare_callback);
+  return frame;
+}
+
+bool GPUSurfaceVulkanImpeller::RenderPartialRepaint(
+    impeller::AiksContext& aiks_context,
+    const impeller::Picture& picture,
+    std::unique_ptr<impeller::Surface> surface,
+    impeller::IRect clip_rect) {
+  auto image = picture.ToImage(aiks_context, clip_rect.size);
+  if (!image) {
+    return false;
+  }
+
+  auto context = aiks_context.GetContext();
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    return false;
+  }
+  auto blit_pass = command_buffer->CreateBlitPass();
+  blit_pass->AddCopy(
+      image->GetTexture(),
+      surface->GetTargetRenderPassDescriptor().GetRenderTargetTexture(),
+      std::nullopt, clip_rect.origin);
+  blit_pass->EncodeCommands(context->GetResourceAllocator());
+  if (!command_buffer->SubmitCommands()) {
+    return false;
+  }
+  return surface->Present();
 }
 
 // |Surface|
@@ -130,7 +246,7 @@ GPUSurfaceVulkanImpeller::MakeRenderContextCurrent() {
 
 // |Surface|
 bool GPUSurfaceVulkanImpeller::EnableRasterCache() const {
-  return false;
+  return true;
 }
 
 // |Surface|
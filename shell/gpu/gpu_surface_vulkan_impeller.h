@@ -4,19 +4,25 @@
 
 #pragma once
 
+#include <map>
+
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/aiks/picture.h"
 #include "flutter/impeller/renderer/context.h"
+#include "flutter/impeller/renderer/surface.h"
 #include "flutter/shell/gpu/gpu_surface_vulkan_delegate.h"
 
 namespace flutter {
 
 class GPUSurfaceVulkanImpeller final : public Surface {
  public:
-  explicit GPUSurfaceVulkanImpeller(std::shared_ptr<impeller::Context> context);
+  explicit GPUSurfaceVulkanImpeller(
+      std::shared_ptr<impeller::Context> context,
+      std::shared_ptr<impeller::AiksContext> aiks_context = nullptr);
 
   // |Surface|
   ~GPUSurfaceVulkanImpeller() override;
@@ -29,10 +35,21 @@ class GPUSurfaceVulkanImpeller final : public Surface {
   std::shared_ptr<impeller::Renderer> impeller_renderer_;
   std::shared_ptr<impeller::AiksContext> aiks_context_;
   bool is_valid_ = false;
+  // Accumulated damage for each swapchain image, i.e. the area of the image
+  // that lags behind the most recently presented frame.
+  std::map<uint64_t, SkIRect> damage_;
+  SkISize damage_frame_size_ = SkISize::MakeEmpty();
 
   // |Surface|
   std::unique_ptr<SurfaceFrame> AcquireFrame(const SkISize& size) override;
 
+  // Renders the |clip_rect| portion of the frame to a texture and copies it
+  // into the swapchain image of |surface| before presenting it.
+  static bool RenderPartialRepaint(impeller::AiksContext& aiks_context,
+                                   const impeller::Picture& picture,
+                                   std::unique_ptr<impeller::Surface> surface,
+                                   impeller::IRect clip_rect);
+
   // |Surface|
   SkMatrix GetRootTransformation() const override;
 
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/platform/android/android_choreographer.h"
 
+#include <algorithm>
+
 #include "flutter/fml/native_library.h"
 
 // Only avialalbe on API 24+
@@ -17,11 +19,121 @@ typedef void (*AChoreographer_postFrameCallback_FPN)(
     AChoreographer* choreographer,
     AChoreographer_frameCallback callback,
     void* data);
+// Only available on API 33+
+typedef void AChoreographerFrameCallbackData;
+typedef void (*AChoreographer_vsyncCallback)(
+    const AChoreographerFrameCallbackData* callback_data,
+    void* data);
+typedef int (*AChoreographer_postVsyncCallback_FPN)(
+    AChoreographer* choreographer,
+    AChoreographer_vsyncCallback callback,
+    void* data);
+typedef int64_t (*AChoreographerFrameCallbackData_getFrameTimeNanos_FPN)(
+    const AChoreographerFrameCallbackData* data);
+typedef size_t (*AChoreographerFrameCallbackData_getFrameTimelinesLength_FPN)(
+    const AChoreographerFrameCallbackData* data);
+typedef size_t (
+    *AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex_FPN)(
+    const AChoreographerFrameCallbackData* data);
+// Named after the shorter form of the function it resolves, which returns the
+// expected presentation time of a frame timeline.
+typedef int64_t (
+    *AChoreographerFrameCallbackData_getExpectedPresentationTimeNanos_FPN)(
+    const AChoreographerFrameCallbackData* data,
+    size_t index);
+typedef int64_t (
+    *AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos_FPN)(
+    const AChoreographerFrameCallbackData* data,
+    size_t index);
 static AChoreographer_getInstance_FPN AChoreographer_getInstance;
 static AChoreographer_postFrameCallback_FPN AChoreographer_postFrameCallback;
+static AChoreographer_postVsyncCallback_FPN AChoreographer_postVsyncCallback;
+static AChoreographerFrameCallbackData_getFrameTimeNanos_FPN
+    AChoreographerFrameCallbackData_getFrameTimeNanos;
+static AChoreographerFrameCallbackData_getFrameTimelinesLength_FPN
+    AChoreographerFrameCallbackData_getFrameTimelinesLength;
+static AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex_FPN
+    AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex;
+static AChoreographerFrameCallbackData_getExpectedPresentationTimeNanos_FPN
+    AChoreographerFrameCallbackData_getExpectedPresentationTimeNanos;
+static AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos_FPN
+    AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos;
+static bool use_vsync_callback = false;
 
 namespace flutter {
 
+namespace {
+
+template <typename T>
+bool ResolveFunction(fml::NativeLibrary& library,
+                     const char* name,
+                     T* function) {
+  auto resolved = library.ResolveFunction<T>(name);
+  if (!resolved) {
+    return false;
+  }
+  *function = resolved.value();
+  return true;
+}
+
+void ResolveVsyncCallbackFunctions(fml::NativeLibrary& libandroid) {
+  use_vsync_callback =
+      ResolveFunction(libandroid, "AChoreographer_postVsyncCallback",
+                      &AChoreographer_postVsyncCallback) &&
+      ResolveFunction(libandroid,
+                      "AChoreographerFrameCallbackData_getFrameTimeNanos",
+                      &AChoreographerFrameCallbackData_getFrameTimeNanos) &&
+      ResolveFunction(
+          libandroid, "AChoreographerFrameCallbackData_getFrameTimelinesLength",
+          &AChoreographerFrameCallbackData_getFrameTimelinesLength) &&
+      ResolveFunction(
+          libandroid,
+          "AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex",
+          &AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex) &&
+      ResolveFunction(
+          libandroid,
+          "AChoreographerFrameCallbackData_"
+          "getFrameTimelineExpectedPresentationTimeNanos",
+          &AChoreographerFrameCallbackData_getExpectedPresentationTimeNanos) &&
+      ResolveFunction(
+          libandroid,
+          "AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos",
+          &AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos);
+}
+
+struct VsyncCallbackBaton {
+  AndroidChoreographer::OnVsyncCallback callback;
+  void* data;
+};
+
+void OnVsync(const AChoreographerFrameCallbackData* callback_data,
+             void* data) {
+  auto* baton = reinterpret_cast<VsyncCallbackBaton*>(data);
+  size_t timeline_count =
+      AChoreographerFrameCallbackData_getFrameTimelinesLength(callback_data);
+  std::vector<AndroidChoreographer::FrameTimeline> timelines;
+  timelines.reserve(timeline_count);
+  for (size_t i = 0; i < timeline_count; i++) {
+    timelines.push_back({
+        .expected_presentation_time_nanos =
+            AChoreographerFrameCallbackData_getExpectedPresentationTimeNanos(
+                callback_data, i),
+        .deadline_nanos =
+            AChoreographerFrameCallbackData_getFrameTimelineDeadlineNanos(
+                callback_data, i),
+    });
+  }
+  baton->callback(
+      AChoreographerFrameCallbackData_getFrameTimeNanos(callback_data),
+      timelines,
+      AChoreographerFrameCallbackData_getPreferredFrameTimelineIndex(
+          callback_data),
+      baton->data);
+  delete baton;
+}
+
+}  // namespace
+
 bool AndroidChoreographer::ShouldUseNDKChoreographer() {
   static std::optional<bool> use_ndk_choreographer;
   if (use_ndk_choreographer) {
@@ -46,6 +158,7 @@ bool AndroidChoreographer::ShouldUseNDKChoreographer() {
     AChoreographer_getInstance = get_instance_fn.value();
     AChoreographer_postFrameCallback = post_frame_callback_fn.value();
     use_ndk_choreographer = true;
+    ResolveVsyncCallbackFunctions(*libandroid);
   } else {
     use_ndk_choreographer = false;
   }
@@ -58,4 +171,33 @@ void AndroidChoreographer::PostFrameCallback(OnFrameCallback callback,
   AChoreographer_postFrameCallback(choreographer, callback, data);
 }
 
+bool AndroidChoreographer::ShouldUseVsyncCallback() {
+  return ShouldUseNDKChoreographer() && use_vsync_callback;
+}
+
+void AndroidChoreographer::PostVsyncCallback(OnVsyncCallback callback,
+                                             void* data) {
+  AChoreographer* choreographer = AChoreographer_getInstance();
+  AChoreographer_postVsyncCallback(
+      choreographer, &OnVsync,
+      new VsyncCallbackBaton{.callback = callback, .data = data});
+}
+
+size_t AndroidChoreographer::SelectFrameTimeline(
+    const std::vector<FrameTimeline>& timelines,
+    size_t preferred_timeline_index,
+    int64_t now_nanos,
+    int64_t min_budget_nanos) {
+  if (timelines.empty()) {
+    return 0;
+  }
+  for (size_t i = std::min(preferred_timeline_index, timelines.size() - 1);
+       i < timelines.size(); i++) {
+    if (timelines[i].deadline_nanos - now_nanos >= min_budget_nanos) {
+      return i;
+    }
+  }
+  return timelines.size() - 1;
+}
+
 }  // namespace flutter
@@ -7,7 +7,9 @@
 
 #include "flutter/fml/macros.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace flutter {
 
@@ -18,10 +20,36 @@ namespace flutter {
 ///
 class AndroidChoreographer {
  public:
+  /// One of the frames the platform could present next, in
+  /// `CLOCK_MONOTONIC` nanoseconds.
+  struct FrameTimeline {
+    int64_t expected_presentation_time_nanos;
+    // The time by which the frame must be submitted to be presented at the
+    // expected presentation time.
+    int64_t deadline_nanos;
+  };
+
   typedef void (*OnFrameCallback)(int64_t frame_time_nanos, void* data);
+  typedef void (*OnVsyncCallback)(int64_t frame_time_nanos,
+                                  const std::vector<FrameTimeline>& timelines,
+                                  size_t preferred_timeline_index,
+                                  void* data);
   static bool ShouldUseNDKChoreographer();
   static void PostFrameCallback(OnFrameCallback callback, void* data);
 
+  /// Whether vsync callbacks with frame timelines are available. These are
+  /// only available on API 33+.
+  static bool ShouldUseVsyncCallback();
+  static void PostVsyncCallback(OnVsyncCallback callback, void* data);
+
+  /// Picks the earliest of the timelines, starting at the one the platform
+  /// prefers, whose deadline is at least `min_budget_nanos` after
+  /// `now_nanos`, or the last timeline if none of them is.
+  static size_t SelectFrameTimeline(const std::vector<FrameTimeline>& timelines,
+                                    size_t preferred_timeline_index,
+                                    int64_t now_nanos,
+                                    int64_t min_budget_nanos);
+
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidChoreographer);
 };
 
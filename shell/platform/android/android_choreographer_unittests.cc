@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/android_choreographer.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Three timelines 8ms apart, as on a 120Hz display.
+const std::vector<AndroidChoreographer::FrameTimeline> kTimelines = {
+    {.expected_presentation_time_nanos = 20000000,
+     .deadline_nanos = 12000000},
+    {.expected_presentation_time_nanos = 28000000,
+     .deadline_nanos = 20000000},
+    {.expected_presentation_time_nanos = 36000000,
+     .deadline_nanos = 28000000},
+};
+
+}  // namespace
+
+TEST(AndroidChoreographer, SelectsPreferredTimelineWhenItsDeadlineCanBeMet) {
+  EXPECT_EQ(AndroidChoreographer::SelectFrameTimeline(
+                kTimelines, /*preferred_timeline_index=*/1,
+                /*now_nanos=*/8000000, /*min_budget_nanos=*/4000000),
+            1u);
+}
+
+TEST(AndroidChoreographer, SkipsTimelinesWhoseDeadlineCannotBeMet) {
+  EXPECT_EQ(AndroidChoreographer::SelectFrameTimeline(
+                kTimelines, /*preferred_timeline_index=*/0,
+                /*now_nanos=*/10000000, /*min_budget_nanos=*/4000000),
+            1u);
+  EXPECT_EQ(AndroidChoreographer::SelectFrameTimeline(
+                kTimelines, /*preferred_timeline_index=*/0,
+                /*now_nanos=*/40000000, /*min_budget_nanos=*/4000000),
+            2u);
+}
+
+TEST(AndroidChoreographer, ClampsPreferredTimelineIndex) {
+  EXPECT_EQ(AndroidChoreographer::SelectFrameTimeline(
+                kTimelines, /*preferred_timeline_index=*/5,
+                /*now_nanos=*/0, /*min_budget_nanos=*/4000000),
+            2u);
+  EXPECT_EQ(AndroidChoreographer::SelectFrameTimeline(
+                {}, /*preferred_timeline_index=*/0,
+                /*now_nanos=*/0, /*min_budget_nanos=*/4000000),
+            0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -284,6 +284,11 @@ void AndroidShellHolder::Launch(
   }
 
   apk_asset_provider_ = std::move(apk_asset_provider);
+  // The engine reads these on the UI thread while it starts up. The run
+  // configuration below clones the provider, so its asset manager gets the
+  // prefetched assets.
+  apk_asset_provider_->PrefetchStartupAssets(
+      shell_->GetTaskRunners().GetIOTaskRunner());
   auto config = BuildRunConfiguration(entrypoint, libraryUrl, entrypoint_args);
   if (!config) {
     return;
@@ -5,6 +5,8 @@
 #include "flutter/shell/platform/android/android_surface_gl_impeller.h"
 
 #include "flutter/fml/logging.h"
+#include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/typographer/backends/skia/typographer_context_skia.h"
 #include "flutter/impeller/toolkit/egl/surface.h"
 #include "flutter/shell/gpu/gpu_surface_gl_impeller.h"
 
@@ -35,9 +37,23 @@ bool AndroidSurfaceGLImpeller::IsValid() const {
 // |AndroidSurface|
 std::unique_ptr<Surface> AndroidSurfaceGLImpeller::CreateGPUSurface(
     GrDirectContext* gr_context) {
+  // Engines spawned from one another share the AndroidContext and render on
+  // the same raster thread, so they share one Aiks context.
+  auto aiks_context = android_context_->GetAiksContext();
+  if (!aiks_context) {
+    aiks_context = std::make_shared<impeller::AiksContext>(
+        android_context_->GetImpellerContext(),
+        impeller::TypographerContextSkia::Make());
+    if (!aiks_context->IsValid()) {
+      return nullptr;
+    }
+    android_context_->SetAiksContext(aiks_context);
+  }
+
   auto surface = std::make_unique<GPUSurfaceGLImpeller>(
-      this,                                   // delegate
-      android_context_->GetImpellerContext()  // context
+      this,                                    // delegate
+      android_context_->GetImpellerContext(),  // context
+      aiks_context                             // aiks_context
   );
   if (!surface->IsValid()) {
     return nullptr;
@@ -10,14 +10,17 @@
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/impeller/aiks/aiks_context.h"
 #include "flutter/impeller/renderer/backend/vulkan/context_vk.h"
+#include "flutter/impeller/typographer/backends/skia/typographer_context_skia.h"
 #include "flutter/shell/gpu/gpu_surface_vulkan_impeller.h"
 #include "flutter/vulkan/vulkan_native_surface_android.h"
 
 namespace flutter {
 
 AndroidSurfaceVulkanImpeller::AndroidSurfaceVulkanImpeller(
-    const std::shared_ptr<AndroidContextVulkanImpeller>& android_context) {
+    const std::shared_ptr<AndroidContextVulkanImpeller>& android_context)
+    : android_context_(android_context) {
   is_valid_ = android_context->IsValid();
 
   auto& context_vk =
@@ -45,8 +48,26 @@ std::unique_ptr<Surface> AndroidSurfaceVulkanImpeller::CreateGPUSurface(
     return nullptr;
   }
 
+  // Engines spawned from one another share the AndroidContext and render on
+  // the same raster thread, so they share one Aiks context. It is created on
+  // the parent context, which outlives the surface context of any one engine.
+  auto aiks_context = android_context_->GetAiksContext();
+  if (!aiks_context) {
+    const auto& impeller_context = android_context_->GetImpellerContext();
+    aiks_context = std::make_shared<impeller::AiksContext>(
+        impeller_context,
+        impeller::TypographerContextSkia::Make(
+            impeller::ContextVK::Cast(*impeller_context)
+                .GetConcurrentWorkerTaskRunner()));
+    if (!aiks_context->IsValid()) {
+      return nullptr;
+    }
+    android_context_->SetAiksContext(aiks_context);
+  }
+
   std::unique_ptr<GPUSurfaceVulkanImpeller> gpu_surface =
-      std::make_unique<GPUSurfaceVulkanImpeller>(surface_context_vk_);
+      std::make_unique<GPUSurfaceVulkanImpeller>(surface_context_vk_,
+                                                 aiks_context);
 
   if (!gpu_surface->IsValid()) {
     return nullptr;
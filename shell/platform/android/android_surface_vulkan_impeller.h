@@ -46,6 +46,7 @@ class AndroidSurfaceVulkanImpeller : public AndroidSurface {
   bool SetNativeWindow(fml::RefPtr<AndroidNativeWindow> window) override;
 
  private:
+  std::shared_ptr<AndroidContextVulkanImpeller> android_context_;
   std::shared_ptr<impeller::SurfaceContextVK> surface_context_vk_;
   fml::RefPtr<AndroidNativeWindow> native_window_;
   bool is_valid_ = false;
@@ -7,29 +7,52 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "rapidjson/document.h"
 
 namespace flutter {
 
+// Assets at least this large that are stored compressed in the APK are
+// worth a warning, as they are decompressed into memory every time they are
+// read.
+static constexpr size_t kLargeCompressedAssetSize = 256 * 1024;
+
 class APKAssetMapping : public fml::Mapping {
  public:
-  explicit APKAssetMapping(AAsset* asset) : asset_(asset) {}
+  APKAssetMapping(AAsset* asset, std::string name)
+      : asset_(asset), name_(std::move(name)) {}
 
   ~APKAssetMapping() override { AAsset_close(asset_); }
 
   size_t GetSize() const override { return AAsset_getLength(asset_); }
 
   const uint8_t* GetMapping() const override {
-    return reinterpret_cast<const uint8_t*>(AAsset_getBuffer(asset_));
+    auto buffer = reinterpret_cast<const uint8_t*>(AAsset_getBuffer(asset_));
+    std::call_once(checked_compression_, [&]() {
+      if (AAsset_isAllocated(asset_) &&
+          GetSize() >= kLargeCompressedAssetSize) {
+        FML_LOG(WARNING) << "The asset " << name_ << " (" << GetSize()
+                         << " bytes) is stored compressed in the APK and "
+                            "has to be decompressed every time it is read. "
+                            "Consider storing it uncompressed.";
+      }
+    });
+    return buffer;
   }
 
   bool IsDontNeedSafe() const override { return !AAsset_isAllocated(asset_); }
 
  private:
   AAsset* const asset_;
+  const std::string name_;
+  mutable std::once_flag checked_compression_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(APKAssetMapping);
 };
@@ -56,7 +79,7 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
       return nullptr;
     }
 
-    return std::make_unique<APKAssetMapping>(asset);
+    return std::make_unique<APKAssetMapping>(asset, asset_name);
   };
 
  private:
@@ -67,16 +90,104 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
   FML_DISALLOW_COPY_AND_ASSIGN(APKAssetProviderImpl);
 };
 
+// The assets read ahead of time by |APKAssetProvider::PrefetchAssets|.
+class APKPrefetchedAssets {
+ public:
+  APKPrefetchedAssets() = default;
+
+  // Marks the assets that nobody has asked for yet as queued for prefetching.
+  void Enqueue(const std::vector<std::string>& asset_names) {
+    std::scoped_lock lock(mutex_);
+    for (const auto& asset_name : asset_names) {
+      if (requested_.count(asset_name) == 0 &&
+          reading_.count(asset_name) == 0 && ready_.count(asset_name) == 0) {
+        queued_.insert(asset_name);
+      }
+    }
+  }
+
+  // Reads the asset if it is still queued.
+  void Prefetch(const std::string& asset_name,
+                const APKAssetProviderInternal& impl) {
+    {
+      std::scoped_lock lock(mutex_);
+      if (queued_.erase(asset_name) == 0) {
+        return;
+      }
+      reading_.insert(asset_name);
+    }
+    std::unique_ptr<fml::Mapping> mapping = impl.GetAsMapping(asset_name);
+    if (mapping) {
+      // Decompresses the asset if it is stored compressed.
+      [[maybe_unused]] const uint8_t* data = mapping->GetMapping();
+    }
+    {
+      std::scoped_lock lock(mutex_);
+      reading_.erase(asset_name);
+      if (mapping) {
+        ready_[asset_name] = std::move(mapping);
+      }
+    }
+    reading_done_.notify_all();
+  }
+
+  // Hands out the prefetched mapping of the asset, waiting for it if it is
+  // being read right now. Returns null if the asset wasn't prefetched, in
+  // which case it won't be anymore and the caller has to read it.
+  std::unique_ptr<fml::Mapping> Take(const std::string& asset_name) {
+    std::unique_lock lock(mutex_);
+    requested_.insert(asset_name);
+    queued_.erase(asset_name);
+    reading_done_.wait(
+        lock, [&]() { return reading_.count(asset_name) == 0; });
+    auto found = ready_.find(asset_name);
+    if (found == ready_.end()) {
+      return nullptr;
+    }
+    std::unique_ptr<fml::Mapping> mapping = std::move(found->second);
+    ready_.erase(found);
+    return mapping;
+  }
+
+  // Prefetches the assets on the current thread.
+  static void PrefetchAll(const std::vector<std::string>& asset_names,
+                          const std::shared_ptr<APKPrefetchedAssets>& assets,
+                          const APKAssetProviderInternal& impl) {
+    assets->Enqueue(asset_names);
+    for (const auto& asset_name : asset_names) {
+      assets->Prefetch(asset_name, impl);
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable reading_done_;
+  std::set<std::string> requested_;
+  std::set<std::string> queued_;
+  std::set<std::string> reading_;
+  std::map<std::string, std::unique_ptr<fml::Mapping>> ready_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(APKPrefetchedAssets);
+};
+
 APKAssetProvider::APKAssetProvider(JNIEnv* env,
                                    jobject assetManager,
                                    std::string directory)
     : impl_(std::make_shared<APKAssetProviderImpl>(env,
                                                    assetManager,
-                                                   std::move(directory))) {}
+                                                   std::move(directory))),
+      prefetched_assets_(std::make_shared<APKPrefetchedAssets>()) {}
 
 APKAssetProvider::APKAssetProvider(
     std::shared_ptr<APKAssetProviderInternal> impl)
-    : impl_(std::move(impl)) {}
+    : impl_(std::move(impl)),
+      prefetched_assets_(std::make_shared<APKPrefetchedAssets>()) {}
+
+APKAssetProvider::APKAssetProvider(
+    std::shared_ptr<APKAssetProviderInternal> impl,
+    std::shared_ptr<APKPrefetchedAssets> prefetched_assets)
+    : impl_(std::move(impl)),
+      prefetched_assets_(std::move(prefetched_assets)) {}
 
 // |AssetResolver|
 bool APKAssetProvider::IsValid() const {
@@ -96,11 +207,54 @@ AssetResolver::AssetResolverType APKAssetProvider::GetType() const {
 // |AssetResolver|
 std::unique_ptr<fml::Mapping> APKAssetProvider::GetAsMapping(
     const std::string& asset_name) const {
+  if (std::unique_ptr<fml::Mapping> mapping =
+          prefetched_assets_->Take(asset_name)) {
+    return mapping;
+  }
   return impl_->GetAsMapping(asset_name);
 }
 
 std::unique_ptr<APKAssetProvider> APKAssetProvider::Clone() const {
-  return std::make_unique<APKAssetProvider>(impl_);
+  return std::unique_ptr<APKAssetProvider>(
+      new APKAssetProvider(impl_, prefetched_assets_));
+}
+
+void APKAssetProvider::PrefetchAssets(
+    std::vector<std::string> asset_names,
+    const fml::RefPtr<fml::TaskRunner>& task_runner) {
+  // Queue the assets right away, so that they aren't read twice if they are
+  // asked for before the task runs.
+  prefetched_assets_->Enqueue(asset_names);
+  task_runner->PostTask([impl = impl_, prefetched_assets = prefetched_assets_,
+                         asset_names = std::move(asset_names)]() {
+    APKPrefetchedAssets::PrefetchAll(asset_names, prefetched_assets, *impl);
+  });
+}
+
+void APKAssetProvider::PrefetchStartupAssets(
+    const fml::RefPtr<fml::TaskRunner>& task_runner) {
+  task_runner->PostTask(
+      [impl = impl_, prefetched_assets = prefetched_assets_]() {
+        std::vector<std::string> asset_names = {"FontManifest.json"};
+        std::unique_ptr<fml::Mapping> manifest =
+            impl->GetAsMapping(kStartupAssetManifest);
+        if (manifest) {
+          rapidjson::Document document;
+          document.Parse(reinterpret_cast<const char*>(manifest->GetMapping()),
+                         manifest->GetSize());
+          if (!document.HasParseError() && document.IsArray()) {
+            for (const auto& asset_name : document.GetArray()) {
+              if (asset_name.IsString()) {
+                asset_names.emplace_back(asset_name.GetString());
+              }
+            }
+          } else {
+            FML_LOG(WARNING) << "Could not parse " << kStartupAssetManifest;
+          }
+        }
+        APKPrefetchedAssets::PrefetchAll(asset_names, prefetched_assets,
+                                         *impl);
+      });
 }
 
 }  // namespace flutter
@@ -8,9 +8,13 @@
 #include <android/asset_manager_jni.h>
 #include <jni.h>
 
+#include <string>
+#include <vector>
+
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/platform/android/scoped_java_ref.h"
+#include "flutter/fml/task_runner.h"
 
 namespace flutter {
 
@@ -23,8 +27,15 @@ class APKAssetProviderInternal {
   virtual ~APKAssetProviderInternal() = default;
 };
 
+class APKPrefetchedAssets;
+
 class APKAssetProvider final : public AssetResolver {
  public:
+  // An optional bundled asset holding a JSON array of the names of the assets
+  // an app reads while starting up.
+  static constexpr const char* kStartupAssetManifest =
+      "StartupAssetManifest.json";
+
   explicit APKAssetProvider(JNIEnv* env,
                             jobject assetManager,
                             std::string directory);
@@ -43,8 +54,26 @@ class APKAssetProvider final : public AssetResolver {
   // delete the returned pointer.
   APKAssetProviderInternal* GetImpl() const { return impl_.get(); }
 
+  // Reads each of the named assets on |task_runner| ahead of time, so that
+  // the first |GetAsMapping| call for it doesn't block on decompressing it.
+  // The prefetched mapping of an asset is handed out once, to the first
+  // caller that asks for it. Assets that are asked for before the task runner
+  // got to them are read on the calling thread as usual.
+  //
+  // Clones of this provider share the prefetched assets.
+  void PrefetchAssets(std::vector<std::string> asset_names,
+                      const fml::RefPtr<fml::TaskRunner>& task_runner);
+
+  // Prefetches the font manifest and the assets listed in the
+  // |kStartupAssetManifest|, if the app bundles one, on |task_runner|.
+  void PrefetchStartupAssets(const fml::RefPtr<fml::TaskRunner>& task_runner);
+
  private:
+  APKAssetProvider(std::shared_ptr<APKAssetProviderInternal> impl,
+                   std::shared_ptr<APKPrefetchedAssets> prefetched_assets);
+
   std::shared_ptr<APKAssetProviderInternal> impl_;
+  std::shared_ptr<APKPrefetchedAssets> prefetched_assets_;
 
   // |flutter::AssetResolver|
   bool IsValid() const override;
@@ -1,4 +1,6 @@
 #include "flutter/shell/platform/android/apk_asset_provider.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -22,5 +24,55 @@ TEST(APKAssetProvider, Clone) {
   ASSERT_NE(first_provider->GetImpl(), second_provider->GetImpl());
   ASSERT_EQ(first_provider->GetImpl(), third_provider->GetImpl());
 }
+
+TEST(APKAssetProvider, HandsOutPrefetchedAssetOnce) {
+  auto impl = std::make_shared<MockAPKAssetProviderImpl>();
+  static const uint8_t kData[] = {1, 2, 3};
+  EXPECT_CALL(*impl, GetAsMapping("asset"))
+      .Times(2)
+      .WillRepeatedly([](const std::string&) -> std::unique_ptr<fml::Mapping> {
+        return std::make_unique<fml::NonOwnedMapping>(kData, sizeof(kData));
+      });
+  auto provider = std::make_unique<APKAssetProvider>(impl);
+  std::unique_ptr<AssetResolver> clone = provider->Clone();
+
+  fml::Thread thread("prefetch");
+  provider->PrefetchAssets({"asset"}, thread.GetTaskRunner());
+  fml::AutoResetWaitableEvent latch;
+  thread.GetTaskRunner()->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+
+  // The clone gets the prefetched mapping, and the next read goes to the
+  // APK again.
+  auto mapping = clone->GetAsMapping("asset");
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(mapping->GetSize(), sizeof(kData));
+  EXPECT_NE(clone->GetAsMapping("asset"), nullptr);
+}
+
+TEST(APKAssetProvider, DoesNotPrefetchAssetThatWasAlreadyRead) {
+  auto impl = std::make_shared<MockAPKAssetProviderImpl>();
+  static const uint8_t kData[] = {1, 2, 3};
+  EXPECT_CALL(*impl, GetAsMapping("asset"))
+      .WillOnce([](const std::string&) -> std::unique_ptr<fml::Mapping> {
+        return std::make_unique<fml::NonOwnedMapping>(kData, sizeof(kData));
+      });
+  std::unique_ptr<AssetResolver> provider =
+      std::make_unique<APKAssetProvider>(impl);
+
+  fml::Thread thread("prefetch");
+  fml::AutoResetWaitableEvent prefetch_can_start;
+  thread.GetTaskRunner()->PostTask(
+      [&prefetch_can_start]() { prefetch_can_start.Wait(); });
+  static_cast<APKAssetProvider*>(provider.get())
+      ->PrefetchAssets({"asset"}, thread.GetTaskRunner());
+
+  EXPECT_NE(provider->GetAsMapping("asset"), nullptr);
+
+  prefetch_can_start.Signal();
+  fml::AutoResetWaitableEvent latch;
+  thread.GetTaskRunner()->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+}
 }  // namespace testing
 }  // namespace flutter
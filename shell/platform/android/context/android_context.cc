@@ -41,4 +41,13 @@ void AndroidContext::SetImpellerContext(
   impeller_context_ = context;
 }
 
+void AndroidContext::SetAiksContext(
+    const std::shared_ptr<impeller::AiksContext>& context) {
+  aiks_context_ = context;
+}
+
+std::shared_ptr<impeller::AiksContext> AndroidContext::GetAiksContext() const {
+  return aiks_context_;
+}
+
 }  // namespace flutter
@@ -10,6 +10,10 @@
 #include "flutter/impeller/renderer/context.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
+namespace impeller {
+class AiksContext;
+}  // namespace impeller
+
 namespace flutter {
 
 enum class AndroidRenderingAPI {
@@ -65,6 +69,24 @@ class AndroidContext {
   ///
   std::shared_ptr<impeller::Context> GetImpellerContext() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Setter for the Impeller Aiks context to be used by subsequent
+  ///             AndroidSurfaces.
+  /// @details    Engines spawned from one another share this AndroidContext
+  ///             and their raster thread, so the first AndroidSurface sets
+  ///             its Aiks context here and later ones reuse its pipelines,
+  ///             glyph atlas and render target cache.
+  ///
+  void SetAiksContext(const std::shared_ptr<impeller::AiksContext>& context);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Accessor for the Impeller Aiks context shared by the
+  ///             AndroidSurfaces of this AndroidContext.
+  /// @returns    `nullptr` when no AndroidSurface has set one yet via
+  ///             SetAiksContext.
+  ///
+  std::shared_ptr<impeller::AiksContext> GetAiksContext() const;
+
  protected:
   /// Intended to be called from a subclass constructor after setup work for the
   /// context has completed.
@@ -78,6 +100,8 @@ class AndroidContext {
 
   std::shared_ptr<impeller::Context> impeller_context_;
 
+  std::shared_ptr<impeller::AiksContext> aiks_context_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidContext);
 };
 
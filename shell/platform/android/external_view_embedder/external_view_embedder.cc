@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/android/external_view_embedder/external_view_embedder.h"
 #include "flutter/common/constants.h"
+#include "flutter/flow/platform_view_rtree.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/fml/trace_event.h"
 
@@ -82,6 +83,13 @@ void AndroidExternalViewEmbedder::SubmitFlutterView(
   // below.
   DlAutoCanvasRestore save(background_canvas, /*do_save=*/true);
 
+  std::vector<SkRect> view_rects;
+  view_rects.reserve(current_frame_view_count);
+  for (int64_t view_id : composition_order_) {
+    view_rects.push_back(GetViewRect(view_id));
+  }
+  PlatformViewRTree view_rtree(view_rects);
+
   for (size_t i = 0; i < current_frame_view_count; i++) {
     int64_t view_id = composition_order_[i];
     EmbedderViewSlice* slice = slices_.at(view_id).get();
@@ -96,25 +104,19 @@ void AndroidExternalViewEmbedder::SubmitFlutterView(
     // Determinate if Flutter UI intersects with any of the previous
     // platform views stacked by z position.
     //
-    // This is done by querying the r-tree that holds the records for the
-    // picture recorder corresponding to the flow layers added after a platform
-    // view layer.
-    for (ssize_t j = i; j >= 0; j--) {
-      int64_t current_view_id = composition_order_[j];
-      SkRect current_view_rect = GetViewRect(current_view_id);
+    // This is done by querying the platform views that the region drawn by
+    // the flow layers added after a platform view layer overlaps.
+    for (const PlatformViewRTree::Overlap& overlap :
+         view_rtree.Search(slice->getRegion(), i + 1)) {
+      const SkRect& current_view_rect = view_rects[overlap.view_index];
       // The rect above the `current_view_rect`
-      SkRect partial_joined_rect = SkRect::MakeEmpty();
-      // Each rect corresponds to a native view that renders Flutter UI.
-      std::vector<SkIRect> intersection_rects =
-          slice->region(current_view_rect).getRects();
-
+      //
       // Limit the number of native views, so it doesn't grow forever.
       //
-      // In this case, the rects are merged into a single one that is the union
-      // of all the rects.
-      for (const SkIRect& rect : intersection_rects) {
-        partial_joined_rect.join(SkRect::Make(rect));
-      }
+      // In this case, the rects that correspond to native views that render
+      // Flutter UI are merged into a single one that is the union of all the
+      // rects.
+      SkRect partial_joined_rect = SkRect::Make(overlap.region.bounds());
       // Get the intersection rect with the `current_view_rect`,
       partial_joined_rect.intersect(current_view_rect);
       // Join the `partial_joined_rect` into `full_joined_rect` to get the rect
@@ -203,10 +205,13 @@ AndroidExternalViewEmbedder::CreateSurfaceIfNeeded(GrDirectContext* context,
                                                 rect.height()  //
   );
   DlCanvas* overlay_canvas = frame->Canvas();
-  overlay_canvas->Clear(DlColor::kTransparent());
   // Offset the picture since its absolute position on the scene is determined
   // by the position of the overlay view.
   overlay_canvas->Translate(-rect.x(), -rect.y());
+  // Only the part of the surface covered by the overlay view is shown, so
+  // clear and render just that part instead of the whole frame.
+  overlay_canvas->ClipRect(rect, DlCanvas::ClipOp::kIntersect);
+  overlay_canvas->Clear(DlColor::kTransparent());
   slice->render_into(overlay_canvas);
   return frame;
 }
@@ -239,6 +244,19 @@ PostPrerollResult AndroidExternalViewEmbedder::PostPrerollAction(
   return PostPrerollResult::kSuccess;
 }
 
+// |ExternalViewEmbedder|
+void AndroidExternalViewEmbedder::PrepareToEmbedPlatformViews(
+    const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {
+  // Merging between frames lets the first frame with platform views be
+  // submitted right away rather than skipped in `PostPrerollAction`. If that
+  // frame doesn't come, the lease runs out and the threads are unmerged.
+  if (raster_thread_merger->IsMerged()) {
+    raster_thread_merger->ExtendLeaseTo(kDefaultMergedLeaseDuration);
+  } else {
+    raster_thread_merger->MergeWithLease(kDefaultMergedLeaseDuration);
+  }
+}
+
 bool AndroidExternalViewEmbedder::FrameHasPlatformLayers() {
   return !composition_order_.empty();
 }
@@ -53,6 +53,11 @@ class AndroidExternalViewEmbedder final : public ExternalViewEmbedder {
       const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger)
       override;
 
+  // |ExternalViewEmbedder|
+  void PrepareToEmbedPlatformViews(
+      const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger)
+      override;
+
   // |ExternalViewEmbedder|
   DlCanvas* GetRootCanvas() override;
 
@@ -189,6 +189,43 @@ TEST(AndroidExternalViewEmbedder, RasterizerRunsOnRasterizerThread) {
   ASSERT_FALSE(raster_thread_merger->IsMerged());
 }
 
+TEST(AndroidExternalViewEmbedder, PrepareToEmbedPlatformViewsMergesThreads) {
+  auto jni_mock = std::make_shared<JNIMock>();
+  auto android_context = AndroidContext(AndroidRenderingAPI::kSoftware);
+  auto embedder = std::make_unique<AndroidExternalViewEmbedder>(
+      android_context, jni_mock, nullptr, GetTaskRunnersForFixture());
+
+  fml::Thread rasterizer_thread("rasterizer");
+  auto raster_thread_merger =
+      GetThreadMergerFromPlatformThread(&rasterizer_thread);
+  ASSERT_FALSE(raster_thread_merger->IsMerged());
+
+  embedder->PrepareToEmbedPlatformViews(raster_thread_merger);
+  ASSERT_TRUE(raster_thread_merger->IsMerged());
+
+  EXPECT_CALL(*jni_mock, FlutterViewBeginFrame());
+  embedder->BeginFrame(nullptr, raster_thread_merger);
+  embedder->PrepareFlutterView(kImplicitViewId, SkISize::Make(10, 20), 1.0);
+
+  // Push a platform view.
+  embedder->PrerollCompositeEmbeddedView(
+      0, std::make_unique<EmbeddedViewParams>());
+
+  // The frame isn't skipped to wait for the threads to merge.
+  auto postpreroll_result = embedder->PostPrerollAction(raster_thread_merger);
+  ASSERT_NE(PostPrerollResult::kSkipAndRetryFrame, postpreroll_result);
+
+  EXPECT_CALL(*jni_mock, FlutterViewEndFrame());
+  embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
+
+  int pending_frames = 0;
+  while (raster_thread_merger->IsMerged()) {
+    raster_thread_merger->DecrementLease();
+    pending_frames++;
+  }
+  ASSERT_EQ(10, pending_frames);  // kDefaultMergedLeaseDuration
+}
+
 TEST(AndroidExternalViewEmbedder, PlatformViewRect) {
   auto jni_mock = std::make_shared<JNIMock>();
 
@@ -674,6 +711,120 @@ TEST(AndroidExternalViewEmbedder, SubmitFrameOverlayComposition) {
   embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
 }
 
+TEST(AndroidExternalViewEmbedder, OverlayRendersOnlyItsOwnRect) {
+  auto jni_mock = std::make_shared<JNIMock>();
+  auto android_context =
+      std::make_shared<AndroidContext>(AndroidRenderingAPI::kSoftware);
+
+  auto window = fml::MakeRefCounted<AndroidNativeWindow>(nullptr);
+  auto gr_context = GrDirectContext::MakeMock(nullptr);
+  auto frame_size = SkISize::Make(1000, 1000);
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  SkRect overlay_clip_bounds = SkRect::MakeEmpty();
+  auto surface_factory = std::make_shared<TestAndroidSurfaceFactory>(
+      [gr_context, window, frame_size, framebuffer_info,
+       &overlay_clip_bounds]() {
+        auto surface_frame_1 = std::make_unique<SurfaceFrame>(
+            nullptr, framebuffer_info,
+            [&overlay_clip_bounds](const SurfaceFrame& surface_frame,
+                                   DlCanvas* canvas) {
+              overlay_clip_bounds = canvas->GetDestinationClipBounds();
+              return true;
+            },
+            /*frame_size=*/frame_size, /*context_result=*/nullptr,
+            /*display_list_fallback=*/true);
+
+        auto surface_mock = std::make_unique<SurfaceMock>();
+        EXPECT_CALL(*surface_mock, AcquireFrame(frame_size))
+            .WillOnce(Return(ByMove(std::move(surface_frame_1))));
+
+        auto android_surface_mock = std::make_unique<AndroidSurfaceMock>();
+        EXPECT_CALL(*android_surface_mock, IsValid()).WillOnce(Return(true));
+
+        EXPECT_CALL(*android_surface_mock, CreateGPUSurface(gr_context.get()))
+            .WillOnce(Return(ByMove(std::move(surface_mock))));
+
+        EXPECT_CALL(*android_surface_mock, SetNativeWindow(window));
+        return android_surface_mock;
+      });
+  auto embedder = std::make_unique<AndroidExternalViewEmbedder>(
+      *android_context, jni_mock, surface_factory, GetTaskRunnersForFixture());
+
+  auto raster_thread_merger = GetThreadMergerFromPlatformThread();
+
+  SkMatrix matrix;
+  MutatorsStack stack;
+  stack.PushTransform(SkMatrix::Translate(0, 0));
+  EXPECT_CALL(*jni_mock, FlutterViewOnDisplayPlatformView(0, 0, 0, 200, 200,
+                                                          300, 300, stack))
+      .Times(2);
+
+  // ------------------ First frame ------------------ //
+  {
+    EXPECT_CALL(*jni_mock, FlutterViewBeginFrame());
+    embedder->BeginFrame(nullptr, raster_thread_merger);
+    embedder->PrepareFlutterView(kImplicitViewId, frame_size, 1.5);
+
+    // Add an Android view without any Flutter UI on top of it.
+    embedder->PrerollCompositeEmbeddedView(
+        0, std::make_unique<EmbeddedViewParams>(matrix, SkSize::Make(200, 200),
+                                                stack));
+
+    auto surface_frame = std::make_unique<SurfaceFrame>(
+        SkSurfaces::Null(1000, 1000), framebuffer_info,
+        [](const SurfaceFrame& surface_frame, DlCanvas* canvas) mutable {
+          return true;
+        },
+        /*frame_size=*/SkISize::Make(800, 600));
+    embedder->SubmitFlutterView(gr_context.get(), nullptr,
+                                std::move(surface_frame));
+
+    EXPECT_CALL(*jni_mock, FlutterViewEndFrame());
+    embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
+  }
+
+  // ------------------ Second frame ------------------ //
+  {
+    EXPECT_CALL(*jni_mock, FlutterViewBeginFrame());
+    embedder->BeginFrame(nullptr, raster_thread_merger);
+    embedder->PrepareFlutterView(kImplicitViewId, frame_size, 1.5);
+
+    embedder->PrerollCompositeEmbeddedView(
+        0, std::make_unique<EmbeddedViewParams>(matrix, SkSize::Make(200, 200),
+                                                stack));
+
+    // This simulates Flutter UI that intersects with the Android view.
+    auto rect_paint = DlPaint();
+    rect_paint.setColor(DlColor::kCyan());
+    rect_paint.setDrawStyle(DlDrawStyle::kFill);
+    embedder->CompositeEmbeddedView(0)->DrawRect(
+        SkRect::MakeXYWH(25, 25, 80, 150), rect_paint);
+
+    EXPECT_CALL(*jni_mock, FlutterViewCreateOverlaySurface())
+        .WillOnce(Return(
+            ByMove(std::make_unique<PlatformViewAndroidJNI::OverlayMetadata>(
+                0, window))));
+    EXPECT_CALL(*jni_mock,
+                FlutterViewDisplayOverlaySurface(0, 25, 25, 80, 150));
+
+    auto surface_frame = std::make_unique<SurfaceFrame>(
+        SkSurfaces::Null(1000, 1000), framebuffer_info,
+        [](const SurfaceFrame& surface_frame, DlCanvas* canvas) mutable {
+          return true;
+        },
+        /*frame_size=*/SkISize::Make(800, 600));
+    embedder->SubmitFlutterView(gr_context.get(), nullptr,
+                                std::move(surface_frame));
+
+    // The overlay surface is only drawn where the overlay view shows it,
+    // rather than over the whole frame.
+    EXPECT_EQ(overlay_clip_bounds, SkRect::MakeWH(80, 150));
+
+    EXPECT_CALL(*jni_mock, FlutterViewEndFrame());
+    embedder->EndFrame(/*should_resubmit_frame=*/false, raster_thread_merger);
+  }
+}
+
 TEST(AndroidExternalViewEmbedder, SubmitFramePlatformViewWithoutAnyOverlay) {
   auto jni_mock = std::make_shared<JNIMock>();
   auto android_context =
@@ -27,7 +27,9 @@ void ImageExternalTextureVK::Attach(PaintContext& context) {
   }
 }
 
-void ImageExternalTextureVK::Detach() {}
+void ImageExternalTextureVK::Detach() {
+  imported_textures_.clear();
+}
 
 void ImageExternalTextureVK::ProcessFrame(PaintContext& context,
                                           const SkRect& bounds) {
@@ -40,31 +42,54 @@ void ImageExternalTextureVK::ProcessFrame(PaintContext& context,
   JavaLocalRef hardware_buffer = HardwareBufferFor(android_image_);
   AHardwareBuffer* latest_hardware_buffer = AHardwareBufferFor(hardware_buffer);
 
+  auto texture = GetOrImportTexture(latest_hardware_buffer);
+  dl_image_ = texture ? impeller::DlImageImpeller::Make(texture) : nullptr;
+  CloseHardwareBuffer(hardware_buffer);
+  // IMPORTANT: We only close the old image after texture stops referencing
+  // it.
+  CloseImage(old_android_image);
+}
+
+std::shared_ptr<impeller::TextureVK> ImageExternalTextureVK::GetOrImportTexture(
+    AHardwareBuffer* hardware_buffer) {
+  if (hardware_buffer == nullptr) {
+    return nullptr;
+  }
+  for (auto it = imported_textures_.begin(); it != imported_textures_.end();
+       ++it) {
+    if (it->first == hardware_buffer) {
+      imported_textures_.splice(imported_textures_.begin(), imported_textures_,
+                                it);
+      return imported_textures_.front().second;
+    }
+  }
+
   AHardwareBuffer_Desc hb_desc = {};
-  flutter::NDKHelpers::AHardwareBuffer_describe(latest_hardware_buffer,
-                                                &hb_desc);
+  flutter::NDKHelpers::AHardwareBuffer_describe(hardware_buffer, &hb_desc);
 
   impeller::TextureDescriptor desc;
   desc.storage_mode = impeller::StorageMode::kDevicePrivate;
-  desc.size = {static_cast<int>(bounds.width()),
-               static_cast<int>(bounds.height())};
+  desc.size = {static_cast<int>(hb_desc.width),
+               static_cast<int>(hb_desc.height)};
   // TODO(johnmccutchan): Use hb_desc to compute the correct format at runtime.
   desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
   desc.mip_count = 1;
 
   auto texture_source =
       std::make_shared<impeller::AndroidHardwareBufferTextureSourceVK>(
-          desc, impeller_context_->GetDevice(), latest_hardware_buffer,
-          hb_desc);
+          desc, impeller_context_->GetDevice(), hardware_buffer, hb_desc);
+  if (!texture_source->IsValid()) {
+    FML_LOG(ERROR) << "Could not import the hardware buffer into Vulkan.";
+    return nullptr;
+  }
 
   auto texture =
       std::make_shared<impeller::TextureVK>(impeller_context_, texture_source);
-
-  dl_image_ = impeller::DlImageImpeller::Make(texture);
-  CloseHardwareBuffer(hardware_buffer);
-  // IMPORTANT: We only close the old image after texture stops referencing
-  // it.
-  CloseImage(old_android_image);
+  imported_textures_.emplace_front(hardware_buffer, texture);
+  if (imported_textures_.size() > kMaxImportedTextures) {
+    imported_textures_.pop_back();
+  }
+  return texture;
 }
 
 }  // namespace flutter
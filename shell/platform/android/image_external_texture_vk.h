@@ -5,6 +5,9 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_EXTERNAL_TEXTURE_VK_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_EXTERNAL_TEXTURE_VK_H_
 
+#include <list>
+#include <utility>
+
 #include "flutter/shell/platform/android/image_external_texture.h"
 
 #include "flutter/impeller/renderer/backend/vulkan/android_hardware_buffer_texture_source_vk.h"
@@ -30,9 +33,26 @@ class ImageExternalTextureVK : public ImageExternalTexture {
   void ProcessFrame(PaintContext& context, const SkRect& bounds) override;
   void Detach() override;
 
+  // Returns the texture that samples |hardware_buffer| directly, importing it
+  // only if it is not one of the recently imported buffers.
+  std::shared_ptr<impeller::TextureVK> GetOrImportTexture(
+      AHardwareBuffer* hardware_buffer);
+
+  // Image readers cycle through a small pool of hardware buffers, so the
+  // textures imported for the most recently used buffers are kept and reused
+  // instead of creating a new image and binding its memory every frame. The
+  // imported memory holds a reference to its buffer, so a cached buffer is
+  // never freed and its address can't be reused for another buffer.
+  static constexpr size_t kMaxImportedTextures = 4;
+
   const std::shared_ptr<impeller::ContextVK> impeller_context_;
 
   fml::jni::ScopedJavaGlobalRef<jobject> android_image_;
+
+  // Most recently used first.
+  std::list<
+      std::pair<AHardwareBuffer*, std::shared_ptr<impeller::TextureVK>>>
+      imported_textures_;
 };
 
 }  // namespace flutter
@@ -40,6 +40,7 @@ import io.flutter.view.TextureRegistry;
 import java.io.IOException;
 import java.lang.ref.WeakReference;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.Locale;
@@ -1463,6 +1464,95 @@ public class FlutterJNI {
         viewId, x, y, width, height, viewWidth, viewHeight, mutatorsStack);
   }
 
+  // The records of the buffer passed to onDisplayPlatformViews.
+  private static final int DISPLAY_PLATFORM_VIEW = 0;
+  private static final int DISPLAY_OVERLAY_SURFACE = 1;
+  private static final int MUTATOR_TRANSFORM = 0;
+  private static final int MUTATOR_CLIP_RECT = 1;
+  private static final int MUTATOR_CLIP_RRECT = 2;
+
+  /**
+   * Displays the platform views and overlay surfaces of a frame, in the order in which they are
+   * stacked.
+   *
+   * <p>Called by native with one buffer per frame instead of a call per platform view and overlay
+   * surface. The buffer is only valid for the duration of the call.
+   */
+  @SuppressWarnings("unused")
+  @UiThread
+  public void onDisplayPlatformViews(@NonNull ByteBuffer mutations) {
+    mutations.order(ByteOrder.nativeOrder());
+    while (mutations.hasRemaining()) {
+      final int record = mutations.getInt();
+      switch (record) {
+        case DISPLAY_PLATFORM_VIEW:
+          {
+            final int viewId = mutations.getInt();
+            final int x = mutations.getInt();
+            final int y = mutations.getInt();
+            final int width = mutations.getInt();
+            final int height = mutations.getInt();
+            final int viewWidth = mutations.getInt();
+            final int viewHeight = mutations.getInt();
+            final FlutterMutatorsStack mutatorsStack = readMutatorsStack(mutations);
+            onDisplayPlatformView(
+                viewId, x, y, width, height, viewWidth, viewHeight, mutatorsStack);
+            break;
+          }
+        case DISPLAY_OVERLAY_SURFACE:
+          {
+            final int id = mutations.getInt();
+            final int x = mutations.getInt();
+            final int y = mutations.getInt();
+            final int width = mutations.getInt();
+            final int height = mutations.getInt();
+            onDisplayOverlaySurface(id, x, y, width, height);
+            break;
+          }
+        default:
+          throw new IllegalArgumentException("Unknown platform view mutation: " + record);
+      }
+    }
+  }
+
+  @NonNull
+  private static FlutterMutatorsStack readMutatorsStack(@NonNull ByteBuffer mutations) {
+    final FlutterMutatorsStack mutatorsStack = new FlutterMutatorsStack();
+    final int count = mutations.getInt();
+    for (int i = 0; i < count; i++) {
+      final int type = mutations.getInt();
+      switch (type) {
+        case MUTATOR_TRANSFORM:
+          {
+            final float[] matrix = new float[9];
+            mutations.asFloatBuffer().get(matrix);
+            mutations.position(mutations.position() + matrix.length * 4);
+            mutatorsStack.pushTransform(matrix);
+            break;
+          }
+        case MUTATOR_CLIP_RECT:
+          mutatorsStack.pushClipRect(
+              mutations.getInt(), mutations.getInt(), mutations.getInt(), mutations.getInt());
+          break;
+        case MUTATOR_CLIP_RRECT:
+          {
+            final int left = mutations.getInt();
+            final int top = mutations.getInt();
+            final int right = mutations.getInt();
+            final int bottom = mutations.getInt();
+            final float[] radiis = new float[8];
+            mutations.asFloatBuffer().get(radiis);
+            mutations.position(mutations.position() + radiis.length * 4);
+            mutatorsStack.pushClipRRect(left, top, right, bottom, radiis);
+            break;
+          }
+        default:
+          throw new IllegalArgumentException("Unknown mutator: " + type);
+      }
+    }
+    return mutatorsStack;
+  }
+
   // TODO(mattcarroll): determine if this is nonull or nullable
   @UiThread
   public Bitmap getBitmap() {
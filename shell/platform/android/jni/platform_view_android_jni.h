@@ -136,6 +136,10 @@ class PlatformViewAndroidJNI {
   /// @brief      Positions and sizes a platform view if using hybrid
   ///             composition.
   ///
+  ///             This may be deferred until the frame ends, so that the
+  ///             platform views and overlay surfaces of a frame are all
+  ///             displayed with one call into Java.
+  ///
   /// @note       Must be called from the platform thread.
   ///
   virtual void FlutterViewOnDisplayPlatformView(
@@ -151,6 +155,9 @@ class PlatformViewAndroidJNI {
   //----------------------------------------------------------------------------
   /// @brief      Positions and sizes an overlay surface in hybrid composition.
   ///
+  ///             Like |FlutterViewOnDisplayPlatformView|, this may be deferred
+  ///             until the frame ends.
+  ///
   /// @note       Must be called from the platform thread.
   ///
   virtual void FlutterViewDisplayOverlaySurface(int surface_id,
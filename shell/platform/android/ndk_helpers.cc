@@ -24,6 +24,9 @@ typedef void (*fp_AHardwareBuffer_describe)(AHardwareBuffer* buffer,
                                             AHardwareBuffer_Desc* desc);
 typedef EGLClientBuffer (*fp_eglGetNativeClientBufferANDROID)(
     AHardwareBuffer* buffer);
+typedef int32_t (*fp_ANativeWindow_setFrameRate)(ANativeWindow* window,
+                                                 float frameRate,
+                                                 int8_t compatibility);
 
 AHardwareBuffer* (*_AHardwareBuffer_fromHardwareBuffer)(
     JNIEnv* env,
@@ -34,6 +37,13 @@ void (*_AHardwareBuffer_describe)(AHardwareBuffer* buffer,
                                   AHardwareBuffer_Desc* desc) = nullptr;
 EGLClientBuffer (*_eglGetNativeClientBufferANDROID)(AHardwareBuffer* buffer) =
     nullptr;
+int32_t (*_ANativeWindow_setFrameRate)(ANativeWindow* window,
+                                       float frameRate,
+                                       int8_t compatibility) = nullptr;
+
+// ANATIVEWINDOW_FRAME_RATE_COMPATIBILITY_DEFAULT, which is only declared when
+// building for API 30 and above.
+constexpr int8_t kFrameRateCompatibilityDefault = 0;
 
 std::once_flag init_once;
 
@@ -66,6 +76,11 @@ void InitOnceCallback() {
           ->ResolveFunction<fp_AHardwareBuffer_describe>(
               "AHardwareBuffer_describe")
           .value_or(nullptr);
+  _ANativeWindow_setFrameRate =
+      android
+          ->ResolveFunction<fp_ANativeWindow_setFrameRate>(
+              "ANativeWindow_setFrameRate")
+          .value_or(nullptr);
 }
 
 }  // namespace
@@ -114,4 +129,17 @@ EGLClientBuffer NDKHelpers::eglGetNativeClientBufferANDROID(
   return _eglGetNativeClientBufferANDROID(buffer);
 }
 
+bool NDKHelpers::SurfaceFrameRateSupported() {
+  NDKHelpers::Init();
+  return _ANativeWindow_setFrameRate != nullptr;
+}
+
+int32_t NDKHelpers::ANativeWindow_setFrameRate(ANativeWindow* window,
+                                               float frame_rate) {
+  NDKHelpers::Init();
+  FML_CHECK(_ANativeWindow_setFrameRate != nullptr);
+  return _ANativeWindow_setFrameRate(window, frame_rate,
+                                     kFrameRateCompatibilityDefault);
+}
+
 }  // namespace flutter
@@ -11,6 +11,7 @@
 #include "flutter/impeller/toolkit/egl/egl.h"
 
 #include <android/hardware_buffer.h>
+#include <android/native_window.h>
 
 namespace flutter {
 
@@ -30,6 +31,11 @@ class NDKHelpers {
   static EGLClientBuffer eglGetNativeClientBufferANDROID(
       AHardwareBuffer* buffer);
 
+  // API Version 30
+  static bool SurfaceFrameRateSupported();
+  static int32_t ANativeWindow_setFrameRate(ANativeWindow* window,
+                                            float frame_rate);
+
  private:
   static void Init();
 };
@@ -6,10 +6,12 @@
 
 #include <android/api-level.h>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "flutter/common/graphics/texture.h"
 #include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/shell/common/shell_io_manager.h"
 #include "flutter/shell/gpu/gpu_surface_gl_delegate.h"
 #include "flutter/shell/platform/android/android_context_gl_impeller.h"
@@ -27,6 +29,7 @@
 #include "flutter/shell/platform/android/context/android_context.h"
 #include "flutter/shell/platform/android/external_view_embedder/external_view_embedder.h"
 #include "flutter/shell/platform/android/jni/platform_view_android_jni.h"
+#include "flutter/shell/platform/android/ndk_helpers.h"
 #include "flutter/shell/platform/android/platform_message_response_android.h"
 #include "flutter/shell/platform/android/surface/android_surface.h"
 #include "flutter/shell/platform/android/surface/snapshot_surface_producer.h"
@@ -190,6 +193,8 @@ PlatformViewAndroid::~PlatformViewAndroid() = default;
 
 void PlatformViewAndroid::NotifyCreated(
     fml::RefPtr<AndroidNativeWindow> native_window) {
+  native_window_ = native_window;
+  ApplyPreferredFrameRate();
   if (android_surface_) {
     InstallFirstFrameCallback();
 
@@ -209,6 +214,8 @@ void PlatformViewAndroid::NotifyCreated(
 
 void PlatformViewAndroid::NotifySurfaceWindowChanged(
     fml::RefPtr<AndroidNativeWindow> native_window) {
+  native_window_ = native_window;
+  ApplyPreferredFrameRate();
   if (android_surface_) {
     fml::AutoResetWaitableEvent latch;
     fml::TaskRunner::RunNowOrPostTask(
@@ -227,6 +234,7 @@ void PlatformViewAndroid::NotifySurfaceWindowChanged(
 
 void PlatformViewAndroid::NotifyDestroyed() {
   PlatformView::NotifyDestroyed();
+  native_window_ = nullptr;
 
   if (android_surface_) {
     fml::AutoResetWaitableEvent latch;
@@ -378,7 +386,14 @@ void PlatformViewAndroid::RegisterImageTexture(
 
 // |PlatformView|
 std::unique_ptr<VsyncWaiter> PlatformViewAndroid::CreateVSyncWaiter() {
-  return std::make_unique<VsyncWaiterAndroid>(task_runners_);
+  return std::make_unique<VsyncWaiterAndroid>(
+      task_runners_, [platform_view = GetWeakPtr()](float frame_rate) {
+        // On Platform Task Runner.
+        if (platform_view) {
+          reinterpret_cast<PlatformViewAndroid*>(platform_view.get())
+              ->SetPreferredFrameRate(frame_rate);
+        }
+      });
 }
 
 // |PlatformView|
@@ -503,6 +518,26 @@ void PlatformViewAndroid::FireFirstFrameCallback() {
   jni_facade_->FlutterViewOnFirstFrame();
 }
 
+void PlatformViewAndroid::SetPreferredFrameRate(float frame_rate) {
+  if (frame_rate == preferred_frame_rate_) {
+    return;
+  }
+  preferred_frame_rate_ = frame_rate;
+  ApplyPreferredFrameRate();
+}
+
+void PlatformViewAndroid::ApplyPreferredFrameRate() {
+  if (!native_window_ || !native_window_->IsValid() ||
+      native_window_->IsFakeWindow() ||
+      !NDKHelpers::SurfaceFrameRateSupported()) {
+    return;
+  }
+  TRACE_EVENT1("flutter", "PlatformViewAndroid::SetPreferredFrameRate",
+               "frame_rate", std::to_string(preferred_frame_rate_).c_str());
+  NDKHelpers::ANativeWindow_setFrameRate(native_window_->handle(),
+                                         preferred_frame_rate_);
+}
+
 double PlatformViewAndroid::GetScaledFontSize(double unscaled_font_size,
                                               int configuration_id) const {
   return jni_facade_->FlutterViewGetScaledFontSize(unscaled_font_size,
@@ -120,6 +120,10 @@ class PlatformViewAndroid final : public PlatformView {
     return platform_message_handler_;
   }
 
+  // Asks the display to refresh the window at |frame_rate| Hz, or at the
+  // rate it prefers if |frame_rate| is 0. Kept across changes of the window.
+  void SetPreferredFrameRate(float frame_rate);
+
   void SetIsRenderingToImageView(bool value) {
     if (GetImpellerContext()) {
       GetImpellerContext()->SetSyncPresentation(value);
@@ -135,6 +139,9 @@ class PlatformViewAndroid final : public PlatformView {
 
   std::unique_ptr<AndroidSurface> android_surface_;
   std::shared_ptr<PlatformMessageHandlerAndroid> platform_message_handler_;
+  // Accessed on the platform thread.
+  fml::RefPtr<AndroidNativeWindow> native_window_;
+  float preferred_frame_rate_ = 0;
 
   // |PlatformView|
   void UpdateSemantics(
@@ -181,6 +188,8 @@ class PlatformViewAndroid final : public PlatformView {
 
   void FireFirstFrameCallback();
 
+  void ApplyPreferredFrameRate();
+
   double GetScaledFontSize(double unscaled_font_size,
                            int configuration_id) const override;
 
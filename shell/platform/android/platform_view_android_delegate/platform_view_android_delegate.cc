@@ -220,13 +220,14 @@ void PlatformViewAndroidDelegate::UpdateSemantics(
     // Calling NewDirectByteBuffer in API level 22 and below with a size of zero
     // will cause a JNI crash.
     if (!actions_buffer.empty()) {
-      jni_facade_->FlutterViewUpdateCustomAccessibilityActions(actions_buffer,
-                                                               action_strings);
+      jni_facade_->FlutterViewUpdateCustomAccessibilityActions(
+          std::move(actions_buffer), std::move(action_strings));
     }
 
     if (!buffer.empty()) {
-      jni_facade_->FlutterViewUpdateSemantics(buffer, strings,
-                                              string_attribute_args);
+      jni_facade_->FlutterViewUpdateSemantics(
+          std::move(buffer), std::move(strings),
+          std::move(string_attribute_args));
     }
   }
 }
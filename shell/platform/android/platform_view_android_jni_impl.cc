@@ -8,6 +8,7 @@
 #include <android/native_window_jni.h>
 #include <dlfcn.h>
 #include <jni.h>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -130,12 +131,10 @@ static jmethodID g_compute_platform_resolved_locale_method = nullptr;
 static jmethodID g_request_dart_deferred_library_method = nullptr;
 
 // Called By Java
-static jmethodID g_on_display_platform_view_method = nullptr;
+static jmethodID g_on_display_platform_views_method = nullptr;
 
 // static jmethodID g_on_composite_platform_view_method = nullptr;
 
-static jmethodID g_on_display_overlay_surface_method = nullptr;
-
 static jmethodID g_overlay_surface_id_method = nullptr;
 
 static jmethodID g_overlay_surface_surface_method = nullptr;
@@ -147,11 +146,29 @@ static jmethodID g_bitmap_copy_pixels_from_buffer_method = nullptr;
 static jmethodID g_bitmap_config_value_of = nullptr;
 
 // Mutators
-static fml::jni::ScopedJavaGlobalRef<jclass>* g_mutators_stack_class = nullptr;
-static jmethodID g_mutators_stack_init_method = nullptr;
-static jmethodID g_mutators_stack_push_transform_method = nullptr;
-static jmethodID g_mutators_stack_push_cliprect_method = nullptr;
-static jmethodID g_mutators_stack_push_cliprrect_method = nullptr;
+
+// The records of the platform view mutations batch passed to
+// `FlutterJNI.onDisplayPlatformViews`, which are made of native order 32-bit
+// values.
+constexpr int32_t kDisplayPlatformView = 0;
+constexpr int32_t kDisplayOverlaySurface = 1;
+constexpr int32_t kMutatorTransform = 0;
+constexpr int32_t kMutatorClipRect = 1;
+constexpr int32_t kMutatorClipRRect = 2;
+
+template <typename T>
+static void AppendToBatch(std::vector<uint8_t>& batch, T value) {
+  static_assert(sizeof(T) == 4);
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  batch.insert(batch.end(), bytes, bytes + sizeof(T));
+}
+
+static void AppendRectToBatch(std::vector<uint8_t>& batch, const SkRect& rect) {
+  AppendToBatch<int32_t>(batch, static_cast<int>(rect.left()));
+  AppendToBatch<int32_t>(batch, static_cast<int>(rect.top()));
+  AppendToBatch<int32_t>(batch, static_cast<int>(rect.right()));
+  AppendToBatch<int32_t>(batch, static_cast<int>(rect.bottom()));
+}
 
 // Called By Java
 static jlong AttachJNI(JNIEnv* env, jclass clazz, jobject flutterJNI) {
@@ -1055,53 +1072,12 @@ bool PlatformViewAndroid::Register(JNIEnv* env) {
     return false;
   }
 
-  g_mutators_stack_class = new fml::jni::ScopedJavaGlobalRef<jclass>(
-      env,
-      env->FindClass(
-          "io/flutter/embedding/engine/mutatorsstack/FlutterMutatorsStack"));
-  if (g_mutators_stack_class == nullptr) {
-    FML_LOG(ERROR) << "Could not locate FlutterMutatorsStack";
-    return false;
-  }
-
-  g_mutators_stack_init_method =
-      env->GetMethodID(g_mutators_stack_class->obj(), "<init>", "()V");
-  if (g_mutators_stack_init_method == nullptr) {
-    FML_LOG(ERROR) << "Could not locate FlutterMutatorsStack.init method";
-    return false;
-  }
-
-  g_mutators_stack_push_transform_method =
-      env->GetMethodID(g_mutators_stack_class->obj(), "pushTransform", "([F)V");
-  if (g_mutators_stack_push_transform_method == nullptr) {
-    FML_LOG(ERROR)
-        << "Could not locate FlutterMutatorsStack.pushTransform method";
-    return false;
-  }
-
-  g_mutators_stack_push_cliprect_method = env->GetMethodID(
-      g_mutators_stack_class->obj(), "pushClipRect", "(IIII)V");
-  if (g_mutators_stack_push_cliprect_method == nullptr) {
-    FML_LOG(ERROR)
-        << "Could not locate FlutterMutatorsStack.pushClipRect method";
-    return false;
-  }
-
-  g_mutators_stack_push_cliprrect_method = env->GetMethodID(
-      g_mutators_stack_class->obj(), "pushClipRRect", "(IIII[F)V");
-  if (g_mutators_stack_push_cliprrect_method == nullptr) {
-    FML_LOG(ERROR)
-        << "Could not locate FlutterMutatorsStack.pushClipRRect method";
-    return false;
-  }
-
-  g_on_display_platform_view_method =
-      env->GetMethodID(g_flutter_jni_class->obj(), "onDisplayPlatformView",
-                       "(IIIIIIILio/flutter/embedding/engine/mutatorsstack/"
-                       "FlutterMutatorsStack;)V");
+  g_on_display_platform_views_method =
+      env->GetMethodID(g_flutter_jni_class->obj(), "onDisplayPlatformViews",
+                       "(Ljava/nio/ByteBuffer;)V");
 
-  if (g_on_display_platform_view_method == nullptr) {
-    FML_LOG(ERROR) << "Could not locate onDisplayPlatformView method";
+  if (g_on_display_platform_views_method == nullptr) {
+    FML_LOG(ERROR) << "Could not locate onDisplayPlatformViews method";
     return false;
   }
 
@@ -1121,14 +1097,6 @@ bool PlatformViewAndroid::Register(JNIEnv* env) {
     return false;
   }
 
-  g_on_display_overlay_surface_method = env->GetMethodID(
-      g_flutter_jni_class->obj(), "onDisplayOverlaySurface", "(IIIII)V");
-
-  if (g_on_display_overlay_surface_method == nullptr) {
-    FML_LOG(ERROR) << "Could not locate onDisplayOverlaySurface method";
-    return false;
-  }
-
   g_java_weak_reference_class = new fml::jni::ScopedJavaGlobalRef<jclass>(
       env, env->FindClass("java/lang/ref/WeakReference"));
   if (g_java_weak_reference_class->is_null()) {
@@ -1622,15 +1590,18 @@ void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
     int viewWidth,
     int viewHeight,
     MutatorsStack mutators_stack) {
-  JNIEnv* env = fml::jni::AttachCurrentThread();
-  auto java_object = java_object_.get(env);
-  if (java_object.is_null()) {
-    return;
-  }
-
-  jobject mutatorsStack = env->NewObject(g_mutators_stack_class->obj(),
-                                         g_mutators_stack_init_method);
-
+  std::vector<uint8_t>& batch = pending_platform_view_mutations_;
+  AppendToBatch<int32_t>(batch, kDisplayPlatformView);
+  for (int value : {view_id, x, y, width, height, viewWidth, viewHeight}) {
+    AppendToBatch<int32_t>(batch, value);
+  }
+
+  // Only the mutators that the Java side supports are sent.
+  // TODO(cyanglaz): Implement other mutators.
+  // https://github.com/flutter/flutter/issues/58426
+  size_t count_offset = batch.size();
+  AppendToBatch<int32_t>(batch, 0);
+  int32_t mutator_count = 0;
   std::vector<std::shared_ptr<Mutator>>::const_iterator iter =
       mutators_stack.Begin();
   while (iter != mutators_stack.End()) {
@@ -1639,46 +1610,34 @@ void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
         const SkMatrix& matrix = (*iter)->GetMatrix();
         SkScalar matrix_array[9];
         matrix.get9(matrix_array);
-        fml::jni::ScopedJavaLocalRef<jfloatArray> transformMatrix(
-            env, env->NewFloatArray(9));
-
-        env->SetFloatArrayRegion(transformMatrix.obj(), 0, 9, matrix_array);
-        env->CallVoidMethod(mutatorsStack,
-                            g_mutators_stack_push_transform_method,
-                            transformMatrix.obj());
+        AppendToBatch<int32_t>(batch, kMutatorTransform);
+        for (SkScalar value : matrix_array) {
+          AppendToBatch<float>(batch, value);
+        }
+        mutator_count++;
         break;
       }
       case kClipRect: {
         const SkRect& rect = (*iter)->GetRect();
-        env->CallVoidMethod(
-            mutatorsStack, g_mutators_stack_push_cliprect_method,
-            static_cast<int>(rect.left()), static_cast<int>(rect.top()),
-            static_cast<int>(rect.right()), static_cast<int>(rect.bottom()));
+        AppendToBatch<int32_t>(batch, kMutatorClipRect);
+        AppendRectToBatch(batch, rect);
+        mutator_count++;
         break;
       }
       case kClipRRect: {
         const SkRRect& rrect = (*iter)->GetRRect();
-        const SkRect& rect = rrect.rect();
-        const SkVector& upper_left = rrect.radii(SkRRect::kUpperLeft_Corner);
-        const SkVector& upper_right = rrect.radii(SkRRect::kUpperRight_Corner);
-        const SkVector& lower_right = rrect.radii(SkRRect::kLowerRight_Corner);
-        const SkVector& lower_left = rrect.radii(SkRRect::kLowerLeft_Corner);
-        SkScalar radiis[8] = {
-            upper_left.x(),  upper_left.y(),  upper_right.x(), upper_right.y(),
-            lower_right.x(), lower_right.y(), lower_left.x(),  lower_left.y(),
-        };
-        fml::jni::ScopedJavaLocalRef<jfloatArray> radiisArray(
-            env, env->NewFloatArray(8));
-        env->SetFloatArrayRegion(radiisArray.obj(), 0, 8, radiis);
-        env->CallVoidMethod(
-            mutatorsStack, g_mutators_stack_push_cliprrect_method,
-            static_cast<int>(rect.left()), static_cast<int>(rect.top()),
-            static_cast<int>(rect.right()), static_cast<int>(rect.bottom()),
-            radiisArray.obj());
+        AppendToBatch<int32_t>(batch, kMutatorClipRRect);
+        AppendRectToBatch(batch, rrect.rect());
+        for (SkRRect::Corner corner :
+             {SkRRect::kUpperLeft_Corner, SkRRect::kUpperRight_Corner,
+              SkRRect::kLowerRight_Corner, SkRRect::kLowerLeft_Corner}) {
+          const SkVector& radii = rrect.radii(corner);
+          AppendToBatch<float>(batch, radii.x());
+          AppendToBatch<float>(batch, radii.y());
+        }
+        mutator_count++;
         break;
       }
-      // TODO(cyanglaz): Implement other mutators.
-      // https://github.com/flutter/flutter/issues/58426
       case kClipPath:
       case kOpacity:
       case kBackdropFilter:
@@ -1686,12 +1645,7 @@ void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
     }
     ++iter;
   }
-
-  env->CallVoidMethod(java_object.obj(), g_on_display_platform_view_method,
-                      view_id, x, y, width, height, viewWidth, viewHeight,
-                      mutatorsStack);
-
-  FML_CHECK(fml::jni::CheckException(env));
+  memcpy(batch.data() + count_offset, &mutator_count, sizeof(mutator_count));
 }
 
 void PlatformViewAndroidJNIImpl::FlutterViewDisplayOverlaySurface(
@@ -1700,15 +1654,27 @@ void PlatformViewAndroidJNIImpl::FlutterViewDisplayOverlaySurface(
     int y,
     int width,
     int height) {
-  JNIEnv* env = fml::jni::AttachCurrentThread();
+  std::vector<uint8_t>& batch = pending_platform_view_mutations_;
+  AppendToBatch<int32_t>(batch, kDisplayOverlaySurface);
+  for (int value : {surface_id, x, y, width, height}) {
+    AppendToBatch<int32_t>(batch, value);
+  }
+}
 
-  auto java_object = java_object_.get(env);
-  if (java_object.is_null()) {
+void PlatformViewAndroidJNIImpl::FlushPlatformViewMutations(
+    JNIEnv* env,
+    jobject java_object) {
+  if (pending_platform_view_mutations_.empty()) {
     return;
   }
-
-  env->CallVoidMethod(java_object.obj(), g_on_display_overlay_surface_method,
-                      surface_id, x, y, width, height);
+  // The buffer only wraps the pending mutations, so the Java side must be
+  // done with it by the time the call returns.
+  fml::jni::ScopedJavaLocalRef<jobject> buffer(
+      env, env->NewDirectByteBuffer(pending_platform_view_mutations_.data(),
+                                    pending_platform_view_mutations_.size()));
+  env->CallVoidMethod(java_object, g_on_display_platform_views_method,
+                      buffer.obj());
+  pending_platform_view_mutations_.clear();
 
   FML_CHECK(fml::jni::CheckException(env));
 }
@@ -1721,6 +1687,9 @@ void PlatformViewAndroidJNIImpl::FlutterViewBeginFrame() {
     return;
   }
 
+  // Mutations left over from a frame that didn't end are still applied in
+  // order.
+  FlushPlatformViewMutations(env, java_object.obj());
   env->CallVoidMethod(java_object.obj(), g_on_begin_frame_method);
 
   FML_CHECK(fml::jni::CheckException(env));
@@ -1734,6 +1703,7 @@ void PlatformViewAndroidJNIImpl::FlutterViewEndFrame() {
     return;
   }
 
+  FlushPlatformViewMutations(env, java_object.obj());
   env->CallVoidMethod(java_object.obj(), g_on_end_frame_method);
 
   FML_CHECK(fml::jni::CheckException(env));
@@ -1779,6 +1749,7 @@ void PlatformViewAndroidJNIImpl::FlutterViewDestroyOverlaySurfaces() {
     return;
   }
 
+  FlushPlatformViewMutations(env, java_object.obj());
   env->CallVoidMethod(java_object.obj(), g_destroy_overlay_surfaces_method);
 
   FML_CHECK(fml::jni::CheckException(env));
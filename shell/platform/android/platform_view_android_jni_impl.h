@@ -106,6 +106,12 @@ class PlatformViewAndroidJNIImpl final : public PlatformViewAndroidJNI {
   // Reference to FlutterJNI object.
   const fml::jni::JavaObjectWeakGlobalRef java_object_;
 
+  // The platform view and overlay surface mutations of the current frame,
+  // sent to Java with a single call when the frame ends.
+  std::vector<uint8_t> pending_platform_view_mutations_;
+
+  void FlushPlatformViewMutations(JNIEnv* env, jobject java_object);
+
   FML_DISALLOW_COPY_AND_ASSIGN(PlatformViewAndroidJNIImpl);
 };
 
@@ -75,6 +75,7 @@ class MockPlatformViewDelegate : public PlatformView::Delegate {
               OnPlatformViewMarkTextureFrameAvailable,
               (int64_t texture_id),
               (override));
+  MOCK_METHOD(void, OnPlatformViewPrepareToEmbedPlatformViews, (), (override));
 
   MOCK_METHOD(const Settings&,
               OnPlatformViewGetSettings,
@@ -1,6 +1,8 @@
 package io.flutter.embedding.engine;
 
 import static org.junit.Assert.assertEquals;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.inOrder;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.spy;
 import static org.mockito.Mockito.times;
@@ -20,10 +22,13 @@ import io.flutter.embedding.engine.systemchannels.LocalizationChannel;
 import io.flutter.plugin.localization.LocalizationPlugin;
 import io.flutter.plugin.platform.PlatformViewsController;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Locale;
 import java.util.concurrent.atomic.AtomicInteger;
 import org.junit.Test;
 import org.junit.runner.RunWith;
+import org.mockito.ArgumentCaptor;
+import org.mockito.InOrder;
 import org.robolectric.annotation.Config;
 
 @Config(manifest = Config.NONE)
@@ -180,6 +185,58 @@ public class FlutterJNITest {
             /*mutatorsStack=*/ stack);
   }
 
+  @Test
+  public void onDisplayPlatformViews_callsPlatformViewsControllerInOrder() {
+    PlatformViewsController platformViewsController = mock(PlatformViewsController.class);
+
+    FlutterJNI flutterJNI = new FlutterJNI();
+    flutterJNI.setPlatformViewsController(platformViewsController);
+
+    ByteBuffer mutations = ByteBuffer.allocateDirect(4 * 20).order(ByteOrder.nativeOrder());
+    // A platform view with a clip rect.
+    mutations.putInt(0);
+    for (int value : new int[] {1, 10, 20, 100, 200, 100, 200}) {
+      mutations.putInt(value);
+    }
+    mutations.putInt(1);
+    mutations.putInt(1);
+    for (int value : new int[] {0, 0, 50, 60}) {
+      mutations.putInt(value);
+    }
+    // An overlay surface on top of it.
+    mutations.putInt(1);
+    for (int value : new int[] {2, 10, 20, 30, 40}) {
+      mutations.putInt(value);
+    }
+    mutations.flip();
+
+    // --- Execute Test ---
+    flutterJNI.onDisplayPlatformViews(mutations);
+
+    // --- Verify Results ---
+    ArgumentCaptor<FlutterMutatorsStack> stack =
+        ArgumentCaptor.forClass(FlutterMutatorsStack.class);
+    InOrder inOrder = inOrder(platformViewsController);
+    inOrder
+        .verify(platformViewsController)
+        .onDisplayPlatformView(
+            /*viewId=*/ eq(1),
+            /*x=*/ eq(10),
+            /*y=*/ eq(20),
+            /*width=*/ eq(100),
+            /*height=*/ eq(200),
+            /*viewWidth=*/ eq(100),
+            /*viewHeight=*/ eq(200),
+            /*mutatorsStack=*/ stack.capture());
+    inOrder
+        .verify(platformViewsController)
+        .onDisplayOverlaySurface(/*id=*/ 2, /*x=*/ 10, /*y=*/ 20, /*width=*/ 30, /*height=*/ 40);
+    assertEquals(1, stack.getValue().getMutators().size());
+    assertEquals(
+        FlutterMutatorsStack.FlutterMutatorType.CLIP_RECT,
+        stack.getValue().getMutators().get(0).getType());
+  }
+
   @Test
   public void onDisplayOverlaySurface_callsPlatformViewsController() {
     PlatformViewsController platformViewsController = mock(PlatformViewsController.class);
@@ -21,16 +21,37 @@ static fml::jni::ScopedJavaGlobalRef<jclass>* g_vsync_waiter_class = nullptr;
 static jmethodID g_async_wait_for_vsync_method_ = nullptr;
 static std::atomic_uint g_refresh_rate_ = 60;
 
-VsyncWaiterAndroid::VsyncWaiterAndroid(const flutter::TaskRunners& task_runners)
+VsyncWaiterAndroid::VsyncWaiterAndroid(
+    const flutter::TaskRunners& task_runners,
+    FrameRateCallback on_preferred_frame_rate)
     : VsyncWaiter(task_runners),
-      use_ndk_choreographer_(
-          AndroidChoreographer::ShouldUseNDKChoreographer()) {}
+      use_ndk_choreographer_(AndroidChoreographer::ShouldUseNDKChoreographer()),
+      use_vsync_callback_(AndroidChoreographer::ShouldUseVsyncCallback()),
+      on_preferred_frame_rate_(std::move(on_preferred_frame_rate)) {}
 
 VsyncWaiterAndroid::~VsyncWaiterAndroid() = default;
 
+// |VsyncWaiter|
+void VsyncWaiterAndroid::SetPreferredFrameRate(double frame_rate) {
+  if (!on_preferred_frame_rate_) {
+    return;
+  }
+  task_runners_.GetPlatformTaskRunner()->PostTask(
+      [callback = on_preferred_frame_rate_, frame_rate]() {
+        callback(static_cast<float>(frame_rate));
+      });
+}
+
 // |VsyncWaiter|
 void VsyncWaiterAndroid::AwaitVSync() {
-  if (use_ndk_choreographer_) {
+  if (use_vsync_callback_) {
+    auto* weak_this = new std::weak_ptr<VsyncWaiter>(shared_from_this());
+    fml::TaskRunner::RunNowOrPostTask(
+        task_runners_.GetUITaskRunner(), [weak_this]() {
+          AndroidChoreographer::PostVsyncCallback(&OnVsyncWithTimelinesFromNDK,
+                                                  weak_this);
+        });
+  } else if (use_ndk_choreographer_) {
     auto* weak_this = new std::weak_ptr<VsyncWaiter>(shared_from_this());
     fml::TaskRunner::RunNowOrPostTask(
         task_runners_.GetUITaskRunner(), [weak_this]() {
@@ -70,6 +91,46 @@ void VsyncWaiterAndroid::OnVsyncFromNDK(int64_t frame_nanos, void* data) {
   ConsumePendingCallback(weak_this, frame_time, target_time);
 }
 
+// static
+void VsyncWaiterAndroid::OnVsyncWithTimelinesFromNDK(
+    int64_t frame_nanos,
+    const std::vector<AndroidChoreographer::FrameTimeline>& timelines,
+    size_t preferred_timeline_index,
+    void* data) {
+  auto frame_time = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(frame_nanos));
+  auto now = fml::TimePoint::Now();
+  if (frame_time > now) {
+    frame_time = now;
+  }
+  auto frame_interval =
+      fml::TimeDelta::FromNanoseconds(1000000000.0 / g_refresh_rate_);
+  auto target_time = frame_time + frame_interval;
+
+  // Aim for the deadline of the earliest frame the engine still has time to
+  // produce, rather than assuming the next vsync, so that the frame is
+  // neither late nor queued behind another one.
+  if (!timelines.empty()) {
+    size_t index = AndroidChoreographer::SelectFrameTimeline(
+        timelines, preferred_timeline_index,
+        now.ToEpochDelta().ToNanoseconds(),
+        (frame_interval / 2).ToNanoseconds());
+    auto deadline = fml::TimePoint::FromEpochDelta(
+        fml::TimeDelta::FromNanoseconds(timelines[index].deadline_nanos));
+    if (deadline > frame_time) {
+      target_time = deadline;
+    }
+  }
+
+  TRACE_EVENT2_INT("flutter", "PlatformVsync", "frame_start_time",
+                   frame_time.ToEpochDelta().ToMicroseconds(),
+                   "frame_target_time",
+                   target_time.ToEpochDelta().ToMicroseconds());
+
+  auto* weak_this = reinterpret_cast<std::weak_ptr<VsyncWaiter>*>(data);
+  ConsumePendingCallback(weak_this, frame_time, target_time);
+}
+
 // static
 void VsyncWaiterAndroid::OnVsyncFromJava(JNIEnv* env,
                                          jclass jcaller,
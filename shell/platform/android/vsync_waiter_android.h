@@ -7,29 +7,44 @@
 
 #include <jni.h>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/common/vsync_waiter.h"
+#include "flutter/shell/platform/android/android_choreographer.h"
 
 namespace flutter {
 
-class AndroidChoreographer;
-
 class VsyncWaiterAndroid final : public VsyncWaiter {
  public:
+  // Called on the platform thread with the refresh rate that the content
+  // needs, or 0 if it needs the full refresh rate.
+  using FrameRateCallback = std::function<void(float frame_rate)>;
+
   static bool Register(JNIEnv* env);
 
-  explicit VsyncWaiterAndroid(const flutter::TaskRunners& task_runners);
+  explicit VsyncWaiterAndroid(const flutter::TaskRunners& task_runners,
+                              FrameRateCallback on_preferred_frame_rate = {});
 
   ~VsyncWaiterAndroid() override;
 
+  // |VsyncWaiter|
+  void SetPreferredFrameRate(double frame_rate) override;
+
  private:
   // |VsyncWaiter|
   void AwaitVSync() override;
 
   static void OnVsyncFromNDK(int64_t frame_nanos, void* data);
 
+  static void OnVsyncWithTimelinesFromNDK(
+      int64_t frame_nanos,
+      const std::vector<AndroidChoreographer::FrameTimeline>& timelines,
+      size_t preferred_timeline_index,
+      void* data);
+
   static void OnVsyncFromJava(JNIEnv* env,
                               jclass jcaller,
                               jlong frameDelayNanos,
@@ -45,6 +60,8 @@ class VsyncWaiterAndroid final : public VsyncWaiter {
                                   jfloat refresh_rate);
 
   const bool use_ndk_choreographer_;
+  const bool use_vsync_callback_;
+  const FrameRateCallback on_preferred_frame_rate_;
   FML_DISALLOW_COPY_AND_ASSIGN(VsyncWaiterAndroid);
 };
 
@@ -19,6 +19,31 @@ constexpr int kHasScrollingAction =
     FlutterSemanticsAction::kFlutterSemanticsActionScrollUp |
     FlutterSemanticsAction::kFlutterSemanticsActionScrollDown;
 
+// Whether an update would leave the data of a node in the tree as it is. The
+// offset container of the bounds is ignored since the bridge sets it from the
+// parent of the node once it is in the tree.
+static bool IsSameNodeData(const ui::AXNodeData& update,
+                           const ui::AXNodeData& current) {
+  const auto& update_transform = update.relative_bounds.transform;
+  const auto& current_transform = current.relative_bounds.transform;
+  bool same_transform =
+      update_transform && current_transform
+          ? *update_transform == *current_transform
+          : update_transform == current_transform;
+  return same_transform &&
+         update.relative_bounds.bounds == current.relative_bounds.bounds &&
+         update.role == current.role && update.state == current.state &&
+         update.actions == current.actions &&
+         update.child_ids == current.child_ids &&
+         update.string_attributes == current.string_attributes &&
+         update.int_attributes == current.int_attributes &&
+         update.float_attributes == current.float_attributes &&
+         update.bool_attributes == current.bool_attributes &&
+         update.intlist_attributes == current.intlist_attributes &&
+         update.stringlist_attributes == current.stringlist_attributes &&
+         update.html_attributes == current.html_attributes;
+}
+
 // AccessibilityBridge
 AccessibilityBridge::AccessibilityBridge()
     : tree_(std::make_unique<ui::AXTree>()) {
@@ -105,7 +130,12 @@ void AccessibilityBridge::CommitUpdates() {
     update.root_id = results.back().front().id;
   }
 
-  tree_->Unserialize(update);
+  // Only nodes that changed are in the update, and the framework often sends
+  // whole subtrees of which only a few nodes changed, for example when a list
+  // scrolls.
+  if (!update.nodes.empty() || update.has_tree_data) {
+    tree_->Unserialize(update);
+  }
   pending_semantics_node_updates_.clear();
   pending_semantics_custom_action_updates_.clear();
 
@@ -295,7 +325,14 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
     node_data.child_ids.push_back(child);
   }
   SetTreeData(node, tree_update);
-  tree_update.nodes.push_back(node_data);
+
+  // Leave nodes that are already up to date out of the update, so that the
+  // tree doesn't diff and notify about them again.
+  ui::AXNode* current = tree_->GetFromId(node.id);
+  if (current && IsSameNodeData(node_data, current->data())) {
+    return;
+  }
+  tree_update.nodes.push_back(std::move(node_data));
 }
 
 void AccessibilityBridge::SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "byte_buffer_streams.h"
@@ -78,6 +79,59 @@ EncodedType EncodedTypeForValue(const EncodableValue& value) {
   return EncodedType::kNull;
 }
 
+// Returns the number of bytes that serializing |value| takes, or a little
+// more, since alignment padding and the size prefixes are counted at their
+// largest. Used to size the output buffer once up front rather than growing
+// it as the value is written. Custom values, which only the serializer that
+// handles them knows how to write, are not counted.
+size_t EstimatedEncodedSize(const EncodableValue& value) {
+  // The type byte, plus the largest size prefix.
+  constexpr size_t kSizedHeader = 1 + 5;
+  switch (value.index()) {
+    case 0:
+    case 1:
+      return 1;
+    case 2:
+      return 1 + sizeof(int32_t);
+    case 3:
+      return 1 + sizeof(int64_t);
+    case 4:
+      return 1 + 7 + sizeof(double);
+    case 5:
+      return kSizedHeader + std::get<std::string>(value).size();
+    case 6:
+      return kSizedHeader + std::get<std::vector<uint8_t>>(value).size();
+    case 7:
+      return kSizedHeader + 3 +
+             std::get<std::vector<int32_t>>(value).size() * sizeof(int32_t);
+    case 8:
+      return kSizedHeader + 7 +
+             std::get<std::vector<int64_t>>(value).size() * sizeof(int64_t);
+    case 9:
+      return kSizedHeader + 7 +
+             std::get<std::vector<double>>(value).size() * sizeof(double);
+    case 10: {
+      size_t size = kSizedHeader;
+      for (const auto& item : std::get<EncodableList>(value)) {
+        size += EstimatedEncodedSize(item);
+      }
+      return size;
+    }
+    case 11: {
+      size_t size = kSizedHeader;
+      for (const auto& pair : std::get<EncodableMap>(value)) {
+        size += EstimatedEncodedSize(pair.first);
+        size += EstimatedEncodedSize(pair.second);
+      }
+      return size;
+    }
+    case 13:
+      return kSizedHeader + 3 +
+             std::get<std::vector<float>>(value).size() * sizeof(float);
+  }
+  return 1;
+}
+
 }  // namespace
 
 StandardCodecSerializer::StandardCodecSerializer() = default;
@@ -188,7 +242,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       std::string string_value;
       string_value.resize(size);
       stream->ReadBytes(reinterpret_cast<uint8_t*>(&string_value[0]), size);
-      return EncodableValue(string_value);
+      return EncodableValue(std::move(string_value));
     }
     case EncodedType::kUInt8List:
       return ReadVector<uint8_t>(stream);
@@ -205,7 +259,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       for (size_t i = 0; i < length; ++i) {
         list_value.push_back(ReadValue(stream));
       }
-      return EncodableValue(list_value);
+      return EncodableValue(std::move(list_value));
     }
     case EncodedType::kMap: {
       size_t length = ReadSize(stream);
@@ -215,7 +269,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
         EncodableValue value = ReadValue(stream);
         map_value.emplace(std::move(key), std::move(value));
       }
-      return EncodableValue(map_value);
+      return EncodableValue(std::move(map_value));
     }
     case EncodedType::kFloat32List: {
       return ReadVector<float>(stream);
@@ -268,11 +322,11 @@ EncodableValue StandardCodecSerializer::ReadVector(
   }
   stream->ReadBytes(reinterpret_cast<uint8_t*>(vector.data()),
                     count * type_size);
-  return EncodableValue(vector);
+  return EncodableValue(std::move(vector));
 }
 
 template <typename T>
-void StandardCodecSerializer::WriteVector(const std::vector<T> vector,
+void StandardCodecSerializer::WriteVector(const std::vector<T>& vector,
                                           ByteStreamWriter* stream) const {
   size_t count = vector.size();
   WriteSize(count, stream);
@@ -329,6 +383,7 @@ std::unique_ptr<std::vector<uint8_t>>
 StandardMessageCodec::EncodeMessageInternal(
     const EncodableValue& message) const {
   auto encoded = std::make_unique<std::vector<uint8_t>>();
+  encoded->reserve(EstimatedEncodedSize(message));
   ByteBufferStreamWriter stream(encoded.get());
   serializer_->WriteValue(message, &stream);
   return encoded;
@@ -383,6 +438,10 @@ std::unique_ptr<std::vector<uint8_t>>
 StandardMethodCodec::EncodeMethodCallInternal(
     const MethodCall<EncodableValue>& method_call) const {
   auto encoded = std::make_unique<std::vector<uint8_t>>();
+  encoded->reserve(
+      EstimatedEncodedSize(EncodableValue(method_call.method_name())) +
+      (method_call.arguments() ? EstimatedEncodedSize(*method_call.arguments())
+                               : 1));
   ByteBufferStreamWriter stream(encoded.get());
   serializer_->WriteValue(EncodableValue(method_call.method_name()), &stream);
   if (method_call.arguments()) {
@@ -397,6 +456,7 @@ std::unique_ptr<std::vector<uint8_t>>
 StandardMethodCodec::EncodeSuccessEnvelopeInternal(
     const EncodableValue* result) const {
   auto encoded = std::make_unique<std::vector<uint8_t>>();
+  encoded->reserve(1 + (result ? EstimatedEncodedSize(*result) : 1));
   ByteBufferStreamWriter stream(encoded.get());
   stream.WriteByte(0);
   if (result) {
@@ -177,6 +177,20 @@ TEST(StandardMessageCodec, CanEncodeAndDecodeEmptyList) {
   CheckEncodeDecode(EncodableValue(EncodableList{}), bytes);
 }
 
+TEST(StandardMessageCodec, CanEncodeAndDecodeLongList) {
+  // 300 elements need the two-byte size encoding.
+  std::vector<uint8_t> bytes = {0x0c, 0xfe, 0x2c, 0x01};
+  EncodableList list;
+  for (int32_t i = 0; i < 300; ++i) {
+    list.push_back(EncodableValue(i));
+    bytes.push_back(0x03);
+    for (int shift = 0; shift < 32; shift += 8) {
+      bytes.push_back(static_cast<uint8_t>(i >> shift));
+    }
+  }
+  CheckEncodeDecode(EncodableValue(list), bytes);
+}
+
 TEST(StandardMessageCodec, CanEncodeAndDecodeMap) {
   std::vector<uint8_t> bytes_prefix = {0x0d, 0x04};
   EncodableValue value(EncodableMap{
@@ -4,13 +4,25 @@
 
 #include "flutter/shell/platform/common/incoming_message_dispatcher.h"
 
+#include <vector>
+
 namespace flutter {
 
 IncomingMessageDispatcher::IncomingMessageDispatcher(
     FlutterDesktopMessengerRef messenger)
     : messenger_(messenger) {}
 
-IncomingMessageDispatcher::~IncomingMessageDispatcher() = default;
+IncomingMessageDispatcher::~IncomingMessageDispatcher() {
+  if (!background_thread_.joinable()) {
+    return;
+  }
+  {
+    std::scoped_lock lock(background_mutex_);
+    stop_background_thread_ = true;
+  }
+  background_condition_.notify_one();
+  background_thread_.join();
+}
 
 /// @note Procedure doesn't copy all closures.
 void IncomingMessageDispatcher::HandleMessage(
@@ -29,6 +41,27 @@ void IncomingMessageDispatcher::HandleMessage(
   auto& callback_info = callback_iterator->second;
   const FlutterDesktopMessageCallback& message_callback = callback_info.first;
 
+  if (background_channels_.count(channel) > 0) {
+    // The message data is only valid for the duration of this call.
+    const uint8_t* data = message.message;
+    std::vector<uint8_t> message_data(data, data + message.message_size);
+    PostBackgroundTask([messenger = messenger_, callback = message_callback,
+                        user_data = callback_info.second,
+                        channel = std::move(channel),
+                        message_data = std::move(message_data),
+                        response_handle = message.response_handle]() {
+      FlutterDesktopMessage background_message = {
+          .struct_size = sizeof(FlutterDesktopMessage),
+          .channel = channel.c_str(),
+          .message = message_data.data(),
+          .message_size = message_data.size(),
+          .response_handle = response_handle,
+      };
+      callback(messenger, &background_message, user_data);
+    });
+    return;
+  }
+
   // Process the call, handling input blocking if requested.
   bool block_input = input_blocking_channels_.count(channel) > 0;
   if (block_input) {
@@ -44,6 +77,7 @@ void IncomingMessageDispatcher::SetMessageCallback(
     const std::string& channel,
     FlutterDesktopMessageCallback callback,
     void* user_data) {
+  background_channels_.erase(channel);
   if (!callback) {
     callbacks_.erase(channel);
     return;
@@ -51,9 +85,49 @@ void IncomingMessageDispatcher::SetMessageCallback(
   callbacks_[channel] = std::make_pair(callback, user_data);
 }
 
+void IncomingMessageDispatcher::SetBackgroundMessageCallback(
+    const std::string& channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data) {
+  SetMessageCallback(channel, callback, user_data);
+  if (callback) {
+    background_channels_.insert(channel);
+  }
+}
+
 void IncomingMessageDispatcher::EnableInputBlockingForChannel(
     const std::string& channel) {
   input_blocking_channels_.insert(channel);
 }
 
+void IncomingMessageDispatcher::PostBackgroundTask(
+    std::function<void(void)> task) {
+  {
+    std::scoped_lock lock(background_mutex_);
+    background_tasks_.push_back(std::move(task));
+  }
+  if (!background_thread_.joinable()) {
+    background_thread_ = std::thread([this] { RunBackgroundTasks(); });
+  }
+  background_condition_.notify_one();
+}
+
+void IncomingMessageDispatcher::RunBackgroundTasks() {
+  while (true) {
+    std::function<void(void)> task;
+    {
+      std::unique_lock lock(background_mutex_);
+      background_condition_.wait(lock, [this] {
+        return stop_background_thread_ || !background_tasks_.empty();
+      });
+      if (stop_background_thread_) {
+        return;
+      }
+      task = std::move(background_tasks_.front());
+      background_tasks_.pop_front();
+    }
+    task();
+  }
+}
+
 }  // namespace flutter
@@ -5,10 +5,14 @@
 #ifndef FLUTTER_SHELL_PLATFORM_CPP_INCOMING_MESSAGE_DISPATCHER_H_
 #define FLUTTER_SHELL_PLATFORM_CPP_INCOMING_MESSAGE_DISPATCHER_H_
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "flutter/shell/platform/common/public/flutter_messenger.h"
@@ -35,6 +39,10 @@ class IncomingMessageDispatcher {
   // If input blocking has been enabled on that channel, wraps the call to the
   // handler with calls to the given callbacks to block and then unblock input.
   //
+  // If the handler was registered with SetBackgroundMessageCallback, copies
+  // |message| and calls the handler on the background thread instead, and
+  // input is not blocked.
+  //
   // If no handler is registered for the message's channel, sends a
   // NotImplemented response to the engine.
   void HandleMessage(
@@ -52,6 +60,17 @@ class IncomingMessageDispatcher {
                           FlutterDesktopMessageCallback callback,
                           void* user_data);
 
+  // Like SetMessageCallback, but |callback| is called on a background thread
+  // shared by all such channels, in the order the messages arrived, so that
+  // handling them does not hold up the thread that calls HandleMessage.
+  //
+  // A message that arrived before the callback was replaced or unregistered
+  // may still be handled by it afterwards. The callback must lock the
+  // messenger to respond, as for any use from another thread.
+  void SetBackgroundMessageCallback(const std::string& channel,
+                                    FlutterDesktopMessageCallback callback,
+                                    void* user_data);
+
   // Enables input blocking on the given channel name.
   //
   // If set, then the parent window should disable input callbacks
@@ -59,6 +78,13 @@ class IncomingMessageDispatcher {
   void EnableInputBlockingForChannel(const std::string& channel);
 
  private:
+  // Queues |task| to run on the background thread, starting the thread if
+  // needed.
+  void PostBackgroundTask(std::function<void(void)> task);
+
+  // Runs background tasks until the dispatcher is destroyed.
+  void RunBackgroundTasks();
+
   // Handle for interacting with the C messaging API.
   FlutterDesktopMessengerRef messenger_;
 
@@ -71,6 +97,19 @@ class IncomingMessageDispatcher {
   // Channel names for which input blocking should be enabled during the call to
   // that channel's handler.
   std::set<std::string> input_blocking_channels_;
+
+  // Channel names whose handlers should be called on the background thread.
+  std::set<std::string> background_channels_;
+
+  // The thread that background handlers are called on, started when the first
+  // message for one of them arrives.
+  std::thread background_thread_;
+
+  // Guards |background_tasks_| and |stop_background_thread_|.
+  std::mutex background_mutex_;
+  std::condition_variable background_condition_;
+  std::deque<std::function<void(void)>> background_tasks_;
+  bool stop_background_thread_ = false;
 };
 
 }  // namespace flutter
@@ -4,6 +4,10 @@
 
 #include "flutter/shell/platform/common/incoming_message_dispatcher.h"
 
+#include <future>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace flutter {
@@ -88,4 +92,42 @@ TEST(IncomingMessageDispatcher, BlockInputTrue) {
   EXPECT_EQ(did_call[2], 2);
 }
 
+TEST(IncomingMessageDispatcher, BackgroundHandlerGetsCopyOfMessage) {
+  FlutterDesktopMessengerRef messenger = nullptr;
+  auto dispatcher = std::make_unique<IncomingMessageDispatcher>(messenger);
+  struct CallInfo {
+    std::thread::id thread_id;
+    std::vector<uint8_t> data;
+    std::promise<void> called;
+  } info;
+  dispatcher->SetBackgroundMessageCallback(
+      "hello",
+      [](FlutterDesktopMessengerRef messenger,
+         const FlutterDesktopMessage* message, void* user_data) {
+        auto* info = reinterpret_cast<CallInfo*>(user_data);
+        EXPECT_STREQ(message->channel, "hello");
+        info->thread_id = std::this_thread::get_id();
+        info->data.assign(message->message,
+                          message->message + message->message_size);
+        info->called.set_value();
+      },
+      &info);
+  std::vector<uint8_t> data = {1, 2, 3};
+  FlutterDesktopMessage message = {
+      .struct_size = sizeof(FlutterDesktopMessage),
+      .channel = "hello",
+      .message = data.data(),
+      .message_size = data.size(),
+      .response_handle = nullptr,
+  };
+  dispatcher->HandleMessage(message);
+  // The handler must not depend on the original message outliving the call.
+  data.assign({0, 0, 0});
+  info.called.get_future().wait();
+  EXPECT_NE(info.thread_id, std::this_thread::get_id());
+  EXPECT_EQ(info.data, std::vector<uint8_t>({1, 2, 3}));
+  // Joins the background thread before |info| goes away.
+  dispatcher.reset();
+}
+
 }  // namespace flutter
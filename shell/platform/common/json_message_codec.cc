@@ -8,7 +8,6 @@
 #include <string>
 
 #include "rapidjson/error/en.h"
-#include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 
 namespace flutter {
@@ -21,15 +20,14 @@ const JsonMessageCodec& JsonMessageCodec::GetInstance() {
 
 std::unique_ptr<std::vector<uint8_t>> JsonMessageCodec::EncodeMessageInternal(
     const rapidjson::Document& message) const {
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  auto encoded = std::make_unique<std::vector<uint8_t>>();
+  JsonByteVectorWriteStream stream(encoded.get());
+  rapidjson::Writer<JsonByteVectorWriteStream> writer(stream);
   // clang-tidy has trouble reasoning about some of the complicated array and
   // pointer-arithmetic code in rapidjson.
   // NOLINTNEXTLINE(clang-analyzer-core.*)
   message.Accept(writer);
-  const char* buffer_start = buffer.GetString();
-  return std::make_unique<std::vector<uint8_t>>(
-      buffer_start, buffer_start + buffer.GetSize());
+  return encoded;
 }
 
 std::unique_ptr<rapidjson::Document> JsonMessageCodec::DecodeMessageInternal(
@@ -7,10 +7,31 @@
 
 #include <rapidjson/document.h>
 
+#include <cstdint>
+#include <vector>
+
 #include "flutter/shell/platform/common/client_wrapper/include/flutter/message_codec.h"
 
 namespace flutter {
 
+// A rapidjson output stream that appends to a byte vector, so that encoded
+// JSON can be written straight into the buffer that is sent to the engine.
+class JsonByteVectorWriteStream {
+ public:
+  typedef char Ch;
+
+  // Creates a stream that appends to |bytes|, which must outlive it.
+  explicit JsonByteVectorWriteStream(std::vector<uint8_t>* bytes)
+      : bytes_(bytes) {}
+
+  void Put(Ch c) { bytes_->push_back(static_cast<uint8_t>(c)); }
+
+  void Flush() {}
+
+ private:
+  std::vector<uint8_t>* bytes_;
+};
+
 // A message encoding/decoding mechanism for communications to/from the
 // Flutter engine via JSON channels.
 class JsonMessageCodec : public MessageCodec<rapidjson::Document> {
@@ -55,6 +55,18 @@ TEST(JsonMethodCodec, HandlesMethodCallsWithArgument) {
   EXPECT_TRUE(MethodCallsAreEqual(call, *decoded));
 }
 
+TEST(JsonMethodCodec, EncodesMethodCallsAsObjects) {
+  const JsonMethodCodec& codec = JsonMethodCodec::GetInstance();
+
+  auto arguments = std::make_unique<rapidjson::Document>(rapidjson::kArrayType);
+  arguments->PushBack(42, arguments->GetAllocator());
+  MethodCall<rapidjson::Document> call("hello", std::move(arguments));
+  auto encoded = codec.EncodeMethodCall(call);
+  ASSERT_TRUE(encoded);
+  std::string expected = R"({"method":"hello","args":[42]})";
+  EXPECT_EQ(std::string(encoded->begin(), encoded->end()), expected);
+}
+
 TEST(JsonMethodCodec, HandlesSuccessEnvelopesWithNullResult) {
   const JsonMethodCodec& codec = JsonMethodCodec::GetInstance();
   auto encoded = codec.EncodeSuccessEnvelope();
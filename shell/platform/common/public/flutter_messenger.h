@@ -90,6 +90,23 @@ FLUTTER_EXPORT void FlutterDesktopMessengerSetCallback(
     FlutterDesktopMessageCallback callback,
     void* user_data);
 
+// Registers a callback function for incoming binary messages from the Flutter
+// side on the specified channel, to be called on a background thread rather
+// than the platform thread.
+//
+// Messages for all channels registered this way are handled one at a time, in
+// the order they arrive. |callback| must respond to messages inside of a
+// |FlutterDesktopMessengerLock|, as for any use of the messenger from a thread
+// other than the platform thread. A message that arrived before the callback
+// was replaced or unregistered may still be passed to it afterwards.
+//
+// Otherwise behaves like |FlutterDesktopMessengerSetCallback|.
+FLUTTER_EXPORT void FlutterDesktopMessengerSetBackgroundCallback(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data);
+
 // Increments the reference count for the |messenger|.
 //
 // Operation is thread-safe.
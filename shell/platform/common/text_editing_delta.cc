@@ -4,15 +4,17 @@
 
 #include "flutter/shell/platform/common/text_editing_delta.h"
 
+#include <utility>
+
 #include "flutter/fml/string_conversion.h"
 
 namespace flutter {
 
-TextEditingDelta::TextEditingDelta(const std::u16string& text_before_change,
+TextEditingDelta::TextEditingDelta(std::u16string text_before_change,
                                    const TextRange& range,
-                                   const std::u16string& text)
-    : old_text_(text_before_change),
-      delta_text_(text),
+                                   std::u16string text)
+    : old_text_(std::move(text_before_change)),
+      delta_text_(std::move(text)),
       delta_start_(range.start()),
       delta_end_(range.start() + range.length()) {}
 
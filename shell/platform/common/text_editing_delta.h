@@ -14,9 +14,9 @@ namespace flutter {
 
 /// A change in the state of an input field.
 struct TextEditingDelta {
-  TextEditingDelta(const std::u16string& text_before_change,
+  TextEditingDelta(std::u16string text_before_change,
                    const TextRange& range,
-                   const std::u16string& text);
+                   std::u16string text);
 
   TextEditingDelta(const std::string& text_before_change,
                    const TextRange& range,
@@ -0,0 +1,123 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_input_buffer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/string_conversion.h"
+
+namespace flutter {
+
+namespace {
+
+// The smallest gap left after the buffer grows, so that typing a few
+// characters at a time doesn't reallocate on each one.
+constexpr size_t kMinimumGapLength = 64;
+
+}  // namespace
+
+TextInputBuffer::TextInputBuffer() = default;
+
+void TextInputBuffer::Assign(std::u16string_view text) {
+  buffer_.assign(text.begin(), text.end());
+  gap_start_ = buffer_.size();
+  gap_end_ = buffer_.size();
+  utf8_.reset();
+}
+
+void TextInputBuffer::Replace(size_t position,
+                              size_t length,
+                              std::u16string_view text) {
+  FML_DCHECK(position <= this->length());
+  length = std::min(length, this->length() - position);
+  MoveGap(position);
+  // The replaced code units now directly follow the gap, so extending the gap
+  // over them removes them.
+  gap_end_ += length;
+  ReserveGap(text.length());
+  std::copy(text.begin(), text.end(), buffer_.begin() + gap_start_);
+  gap_start_ += text.length();
+  utf8_.reset();
+}
+
+char16_t TextInputBuffer::at(size_t position) const {
+  FML_DCHECK(position < length());
+  return position < gap_start_ ? buffer_[position]
+                               : buffer_[position + gap_length()];
+}
+
+std::u16string TextInputBuffer::Substring(size_t position,
+                                          size_t length) const {
+  FML_DCHECK(position + length <= this->length());
+  std::u16string result;
+  result.reserve(length);
+  size_t end = position + length;
+  if (position < gap_start_) {
+    size_t before_gap_end = std::min(end, gap_start_);
+    result.append(buffer_.data() + position, before_gap_end - position);
+    position = before_gap_end;
+  }
+  if (position < end) {
+    result.append(buffer_.data() + position + gap_length(), end - position);
+  }
+  return result;
+}
+
+const std::string& TextInputBuffer::ToUtf8() const {
+  if (utf8_.has_value()) {
+    return utf8_.value();
+  }
+  std::u16string_view before_gap(buffer_.data(), gap_start_);
+  std::u16string_view after_gap(buffer_.data() + gap_end_,
+                                buffer_.size() - gap_end_);
+  // The halves can be converted separately unless the gap splits a surrogate
+  // pair.
+  bool splits_surrogate_pair =
+      !before_gap.empty() && !after_gap.empty() &&
+      (before_gap.back() & 0xFC00) == 0xD800 &&
+      (after_gap.front() & 0xFC00) == 0xDC00;
+  if (splits_surrogate_pair) {
+    utf8_ = fml::Utf16ToUtf8(Substring(0, length()));
+  } else {
+    utf8_ = fml::Utf16ToUtf8(before_gap) + fml::Utf16ToUtf8(after_gap);
+  }
+  return utf8_.value();
+}
+
+void TextInputBuffer::MoveGap(size_t position) {
+  if (position < gap_start_) {
+    std::copy_backward(buffer_.begin() + position,
+                       buffer_.begin() + gap_start_,
+                       buffer_.begin() + gap_end_);
+    gap_end_ -= gap_start_ - position;
+    gap_start_ = position;
+  } else if (position > gap_start_) {
+    size_t count = position - gap_start_;
+    std::copy(buffer_.begin() + gap_end_, buffer_.begin() + gap_end_ + count,
+              buffer_.begin() + gap_start_);
+    gap_start_ += count;
+    gap_end_ += count;
+  }
+}
+
+void TextInputBuffer::ReserveGap(size_t length) {
+  if (gap_length() >= length) {
+    return;
+  }
+  size_t after_gap_length = buffer_.size() - gap_end_;
+  size_t new_size =
+      std::max(buffer_.size() * 2,
+               this->length() + length + kMinimumGapLength);
+  std::vector<char16_t> grown(new_size);
+  std::copy(buffer_.begin(), buffer_.begin() + gap_start_, grown.begin());
+  std::copy(buffer_.begin() + gap_end_, buffer_.end(),
+            grown.end() - after_gap_length);
+  buffer_ = std::move(grown);
+  gap_end_ = buffer_.size() - after_gap_length;
+}
+
+}  // namespace flutter
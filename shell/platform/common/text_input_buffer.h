@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_COMMON_TEXT_INPUT_BUFFER_H_
+#define FLUTTER_SHELL_PLATFORM_COMMON_TEXT_INPUT_BUFFER_H_
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace flutter {
+
+// UTF-16 text storage for a |TextInputModel|.
+//
+// The text is kept in a gap buffer: the unused capacity sits at the position
+// of the last edit, so consecutive edits around the cursor only move the
+// characters between the old and new edit positions instead of the whole
+// text. The UTF-8 form of the text is cached until the next edit.
+class TextInputBuffer {
+ public:
+  TextInputBuffer();
+
+  // Replaces the contents of the buffer with |text|.
+  void Assign(std::u16string_view text);
+
+  // Replaces the |length| code units starting at |position| with |text|.
+  //
+  // Like |std::u16string::replace|, |length| is clamped to the end of the
+  // text.
+  void Replace(size_t position, size_t length, std::u16string_view text);
+
+  // Inserts |text| before the code unit at |position|.
+  void Insert(size_t position, std::u16string_view text) {
+    Replace(position, 0, text);
+  }
+
+  // Removes the |length| code units starting at |position|.
+  void Erase(size_t position, size_t length) { Replace(position, length, {}); }
+
+  // The number of UTF-16 code units in the buffer.
+  size_t length() const { return buffer_.size() - gap_length(); }
+
+  // Returns the code unit at |position|, which must be less than |length|.
+  char16_t at(size_t position) const;
+
+  // Returns a copy of the |length| code units starting at |position|.
+  std::u16string Substring(size_t position, size_t length) const;
+
+  // Returns the contents of the buffer as UTF-8.
+  const std::string& ToUtf8() const;
+
+ private:
+  size_t gap_length() const { return gap_end_ - gap_start_; }
+
+  // Moves the gap so that it starts at |position|.
+  void MoveGap(size_t position);
+
+  // Grows the buffer, if needed, so that the gap holds at least |length| code
+  // units.
+  void ReserveGap(size_t length);
+
+  std::vector<char16_t> buffer_;
+  size_t gap_start_ = 0;
+  size_t gap_end_ = 0;
+  mutable std::optional<std::string> utf8_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_COMMON_TEXT_INPUT_BUFFER_H_
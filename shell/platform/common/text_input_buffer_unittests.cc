@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_input_buffer.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+
+TEST(TextInputBuffer, Assign) {
+  TextInputBuffer buffer;
+  buffer.Assign(u"ABCDE");
+  EXPECT_EQ(buffer.length(), 5u);
+  EXPECT_EQ(buffer.Substring(0, 5), u"ABCDE");
+  EXPECT_EQ(buffer.ToUtf8(), "ABCDE");
+}
+
+TEST(TextInputBuffer, InsertAtDifferentPositions) {
+  TextInputBuffer buffer;
+  buffer.Assign(u"ABCDE");
+  buffer.Insert(5, u"F");
+  buffer.Insert(0, u"_");
+  buffer.Insert(3, u"xy");
+  EXPECT_EQ(buffer.length(), 9u);
+  EXPECT_EQ(buffer.Substring(0, 9), u"_ABxyCDEF");
+  EXPECT_EQ(buffer.at(0), u'_');
+  EXPECT_EQ(buffer.at(3), u'x');
+  EXPECT_EQ(buffer.at(8), u'F');
+}
+
+TEST(TextInputBuffer, EraseAndReplace) {
+  TextInputBuffer buffer;
+  buffer.Assign(u"ABCDE");
+  buffer.Erase(1, 2);
+  EXPECT_EQ(buffer.Substring(0, buffer.length()), u"ADE");
+  buffer.Replace(0, 1, u"xyz");
+  EXPECT_EQ(buffer.Substring(0, buffer.length()), u"xyzDE");
+  buffer.Replace(4, 10, u"!");
+  EXPECT_EQ(buffer.Substring(0, buffer.length()), u"xyzD!");
+}
+
+TEST(TextInputBuffer, SubstringSpanningGap) {
+  TextInputBuffer buffer;
+  buffer.Assign(u"ABCDEF");
+  buffer.Insert(3, u"_");
+  EXPECT_EQ(buffer.Substring(1, 5), u"BC_DE");
+  EXPECT_EQ(buffer.Substring(0, 3), u"ABC");
+  EXPECT_EQ(buffer.Substring(4, 3), u"DEF");
+}
+
+TEST(TextInputBuffer, ManyEditsGrowBuffer) {
+  TextInputBuffer buffer;
+  std::u16string expected;
+  for (int i = 0; i < 1000; i++) {
+    char16_t c = u'a' + (i % 26);
+    size_t position = (i * 7) % (expected.length() + 1);
+    buffer.Insert(position, std::u16string(1, c));
+    expected.insert(position, 1, c);
+  }
+  EXPECT_EQ(buffer.Substring(0, buffer.length()), expected);
+}
+
+TEST(TextInputBuffer, Utf8WithGapInsideSurrogatePair) {
+  TextInputBuffer buffer;
+  buffer.Assign(u"😄🙃");
+  // Split the first surrogate pair, leaving the gap between its halves.
+  buffer.Insert(1, u"x");
+  buffer.Erase(1, 1);
+  EXPECT_EQ(buffer.ToUtf8(), "😄🙃");
+}
+
+TEST(TextInputBuffer, Utf8IsUpdatedAfterEdits) {
+  TextInputBuffer buffer;
+  buffer.Assign(u"ABC");
+  EXPECT_EQ(buffer.ToUtf8(), "ABC");
+  buffer.Insert(1, u"ö");
+  EXPECT_EQ(buffer.ToUtf8(), "AöBC");
+  buffer.Erase(0, 1);
+  EXPECT_EQ(buffer.ToUtf8(), "öBC");
+}
+
+}  // namespace flutter
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 
+#include "flutter/shell/platform/common/text_input_buffer.h"
 #include "flutter/shell/platform/common/text_range.h"
 
 namespace flutter {
@@ -183,6 +184,9 @@ class TextInputModel {
   bool SelectToEnd();
 
   // Gets the current text as UTF-8.
+  //
+  // The conversion is cached, so calling this again before the text changes
+  // doesn't convert the text again.
   std::string GetText() const;
 
   // Gets the cursor position as a byte offset in UTF-8 string returned from
@@ -218,7 +222,7 @@ class TextInputModel {
     return composing_ ? composing_range_ : text_range();
   }
 
-  std::u16string text_;
+  TextInputBuffer text_;
   TextRange selection_ = TextRange(0);
   TextRange composing_range_ = TextRange(0);
   bool composing_ = false;
@@ -37,6 +37,7 @@ class FakeDelegate : public PlatformView::Delegate {
   void OnPlatformViewRegisterTexture(std::shared_ptr<Texture> texture) override {}
   void OnPlatformViewUnregisterTexture(int64_t texture_id) override {}
   void OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) override {}
+  void OnPlatformViewPrepareToEmbedPlatformViews() override {}
 
   void LoadDartDeferredLibrary(intptr_t loading_unit_id,
                                std::unique_ptr<const fml::Mapping> snapshot_data,
@@ -11,8 +11,10 @@
 #include <string>
 
 #include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/flow/platform_view_rtree.h"
 #include "flutter/fml/platform/darwin/scoped_nsobject.h"
 #import "flutter/shell/platform/darwin/common/framework/Headers/FlutterChannels.h"
+#import "flutter/shell/platform/darwin/ios/framework/Source/FlutterEngine_Internal.h"
 #import "flutter/shell/platform/darwin/ios/framework/Source/FlutterOverlayView.h"
 #import "flutter/shell/platform/darwin/ios/framework/Source/FlutterPlatformViews_Internal.h"
 #import "flutter/shell/platform/darwin/ios/framework/Source/FlutterView.h"
@@ -148,6 +150,7 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewLayerPool::GetLayer
     IOSSurface* ios_surface = layer->ios_surface.get();
     std::unique_ptr<Surface> surface = ios_surface->CreateGPUSurface(gr_context);
     layer->surface = std::move(surface);
+    layer->last_display_list = nullptr;
   }
   available_layer_index_++;
   return layer;
@@ -255,6 +258,16 @@ void FlutterPlatformViewsController::OnCreate(FlutterMethodCall* call, FlutterRe
   [clipping_view addSubview:touch_interceptor];
   root_views_[viewId] = fml::scoped_nsobject<UIView>([clipping_view retain]);
 
+  // The framework draws the new view in one of its next frames. Get the rasterizer ready for it
+  // now, so that frame isn't skipped while the threads merge.
+  FlutterEngine* engine = [flutter_view_controller_.get() engine];
+  if (engine) {
+    fml::WeakPtr<PlatformView> platform_view = [engine platformView];
+    if (platform_view) {
+      platform_view->PrepareToEmbedPlatformViews();
+    }
+  }
+
   result(nil);
 }
 
@@ -374,6 +387,17 @@ void FlutterPlatformViewsController::EndFrame(
   }
 }
 
+void FlutterPlatformViewsController::PrepareToEmbedPlatformViews(
+    const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {
+  // This runs between frames, so unlike in |PostPrerollAction| the threads can be merged right
+  // away. If no frame with a platform view comes, the lease runs out and they are unmerged.
+  if (raster_thread_merger->IsMerged()) {
+    raster_thread_merger->ExtendLeaseTo(kDefaultMergedLeaseDuration);
+  } else {
+    raster_thread_merger->MergeWithLease(kDefaultMergedLeaseDuration);
+  }
+}
+
 void FlutterPlatformViewsController::PushFilterToVisitedPlatformViews(
     const std::shared_ptr<const DlImageFilter>& filter,
     const SkRect& filter_rect) {
@@ -695,6 +719,13 @@ bool FlutterPlatformViewsController::SubmitFrame(GrDirectContext* gr_context,
   auto did_submit = true;
   auto num_platform_views = composition_order_.size();
 
+  std::vector<SkRect> platform_view_rects;
+  platform_view_rects.reserve(num_platform_views);
+  for (int64_t platform_view_id : composition_order_) {
+    platform_view_rects.push_back(GetPlatformViewRect(platform_view_id));
+  }
+  PlatformViewRTree platform_view_rtree(platform_view_rects);
+
   for (size_t i = 0; i < num_platform_views; i++) {
     int64_t platform_view_id = composition_order_[i];
     EmbedderViewSlice* slice = slices_[platform_view_id].get();
@@ -702,10 +733,11 @@ bool FlutterPlatformViewsController::SubmitFrame(GrDirectContext* gr_context,
 
     // Check if the current picture contains overlays that intersect with the
     // current platform view or any of the previous platform views.
-    for (size_t j = i + 1; j > 0; j--) {
-      int64_t current_platform_view_id = composition_order_[j - 1];
-      SkRect platform_view_rect = GetPlatformViewRect(current_platform_view_id);
-      std::vector<SkIRect> intersection_rects = slice->region(platform_view_rect).getRects();
+    for (const PlatformViewRTree::Overlap& overlap :
+         platform_view_rtree.Search(slice->getRegion(), i + 1)) {
+      int64_t current_platform_view_id = composition_order_[overlap.view_index];
+      const SkRect& platform_view_rect = platform_view_rects[overlap.view_index];
+      std::vector<SkIRect> intersection_rects = overlap.region.getRects();
       auto allocation_size = intersection_rects.size();
 
       // For testing purposes, the overlay id is used to find the overlay view.
@@ -838,6 +870,17 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewsController::GetLay
   overlay_view.accessibilityIdentifier =
       [NSString stringWithFormat:@"platform_view[%lld].overlay_view[%lld]", view_id, overlay_id];
 
+  // Overlays on top of platform views often stay the same while the platform
+  // views change, so don't render them again on the platform thread when
+  // they would look the same.
+  sk_sp<DisplayList> display_list = slice->display_list();
+  if (layer->last_display_list && display_list && layer->did_submit_last_frame &&
+      layer->last_rect == rect && layer->last_frame_size == frame_size_ &&
+      layer->last_display_list->Equals(display_list)) {
+    return layer;
+  }
+  layer->last_display_list = nullptr;
+
   std::unique_ptr<SurfaceFrame> frame = layer->surface->AcquireFrame(frame_size_);
   // If frame is null, AcquireFrame already printed out an error message.
   if (!frame) {
@@ -852,6 +895,11 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewsController::GetLay
   overlay_canvas->RestoreToCount(restore_count);
 
   layer->did_submit_last_frame = frame->Submit();
+  if (layer->did_submit_last_frame) {
+    layer->last_display_list = std::move(display_list);
+    layer->last_rect = rect;
+    layer->last_frame_size = frame_size_;
+  }
   return layer;
 }
 
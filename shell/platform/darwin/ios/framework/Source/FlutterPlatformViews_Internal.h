@@ -153,6 +153,13 @@ struct FlutterPlatformViewLayer {
   // Whether a frame for this layer was submitted.
   bool did_submit_last_frame;
 
+  // The recording, overlay rect and frame size that the last submitted frame
+  // of this layer was rendered from. Overlays that would be rendered from the
+  // same ones again keep showing that frame instead.
+  sk_sp<DisplayList> last_display_list;
+  SkIRect last_rect;
+  SkISize last_frame_size;
+
   // The GrContext that is currently used by the overlay surfaces.
   // We track this to know when the GrContext for the Flutter app has changed
   // so we can update the overlay with the new context.
@@ -249,6 +256,11 @@ class FlutterPlatformViewsController {
   void EndFrame(bool should_resubmit_frame,
                 const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger);
 
+  // Merges the raster and platform threads ahead of the first frame with a platform view, so that
+  // frame doesn't have to be skipped in |PostPrerollAction| to wait for the merge.
+  void PrepareToEmbedPlatformViews(
+      const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger);
+
   DlCanvas* CompositeEmbeddedView(int64_t view_id);
 
   // The rect of the platform view at index view_id. This rect has been translated into the
@@ -111,6 +111,38 @@ fml::RefPtr<fml::TaskRunner> CreateNewThread(const std::string& name) {
   }
 }
 
+- (void)testSetPreferredFrameRateLowersTheRefreshRate {
+  auto thread_task_runner = CreateNewThread("VsyncWaiterIosTest");
+  auto callback = [](std::unique_ptr<flutter::FrameTimingsRecorder> recorder) {};
+  id bundleMock = OCMPartialMock([NSBundle mainBundle]);
+  OCMStub([bundleMock objectForInfoDictionaryKey:@"CADisableMinimumFrameDurationOnPhone"])
+      .andReturn(@YES);
+  id mockDisplayLinkManager = [OCMockObject mockForClass:[DisplayLinkManager class]];
+  double maxFrameRate = 120;
+  [[[mockDisplayLinkManager stub] andReturnValue:@(maxFrameRate)] displayRefreshRate];
+
+  VSyncClient* vsyncClient = [[VSyncClient alloc] initWithTaskRunner:thread_task_runner
+                                                            callback:callback];
+  CADisplayLink* link = [vsyncClient getDisplayLink];
+  [vsyncClient setPreferredFrameRate:30];
+  if (@available(iOS 15.0, *)) {
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.maximum, 30, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.preferred, 30, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.minimum, 30, 0.1);
+  } else {
+    XCTAssertEqualWithAccuracy(link.preferredFramesPerSecond, 30, 0.1);
+  }
+
+  [vsyncClient setMaxRefreshRate:maxFrameRate];
+  if (@available(iOS 15.0, *)) {
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.maximum, maxFrameRate, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.preferred, maxFrameRate, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.minimum, maxFrameRate / 2, 0.1);
+  } else {
+    XCTAssertEqualWithAccuracy(link.preferredFramesPerSecond, maxFrameRate, 0.1);
+  }
+}
+
 - (void)testAwaitAndPauseWillWorkCorrectly {
   auto thread_task_runner = CreateNewThread("VsyncWaiterIosTest");
   VSyncClient* vsyncClient = [[VSyncClient alloc]
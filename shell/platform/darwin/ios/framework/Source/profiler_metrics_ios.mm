@@ -5,6 +5,10 @@
 #import "flutter/shell/platform/darwin/ios/framework/Source/profiler_metrics_ios.h"
 
 #import <Foundation/Foundation.h>
+#include <pthread.h>
+
+#include <string>
+#include <string_view>
 
 #import "flutter/shell/platform/darwin/ios/framework/Source/IOKit.h"
 
@@ -138,6 +142,24 @@ std::optional<GpuUsageInfo> FindGpuUsageInfo(io_iterator_t iterator) {
 #endif  // FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG ||
         // FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_PROFILE
 
+// Returns the name of the thread if the engine runs one of its task runners on
+// it, like `io.flutter.1.ui`.
+std::optional<std::string> GetEngineThreadName(thread_t thread) {
+  pthread_t pthread = pthread_from_mach_thread_np(thread);
+  char name[64];
+  if (pthread == NULL || pthread_getname_np(pthread, name, sizeof(name)) != 0) {
+    return std::nullopt;
+  }
+  std::string thread_name(name);
+  for (std::string_view suffix : {".ui", ".raster", ".io"}) {
+    if (thread_name.size() > suffix.size() &&
+        thread_name.compare(thread_name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+      return thread_name;
+    }
+  }
+  return std::nullopt;
+}
+
 std::optional<GpuUsageInfo> PollGpuUsage() {
 #if (FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_RELEASE || \
      FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_JIT_RELEASE)
@@ -169,6 +191,7 @@ std::optional<CpuUsageInfo> ProfilerMetricsIOS::CpuUsage() {
 
   double total_cpu_usage = 0.0;
   uint32_t num_threads = mach_threads.thread_count;
+  std::vector<ThreadCpuUsageInfo> engine_threads;
 
   // Add the CPU usage for each thread. It should be noted that there may be some CPU usage missing
   // from this calculation. If a thread ends between calls to this routine, then its info will be
@@ -188,6 +211,10 @@ std::optional<CpuUsageInfo> ProfilerMetricsIOS::CpuUsage() {
         const double current_thread_cpu_usage =
             basic_thread_info.cpu_usage / static_cast<float>(TH_USAGE_SCALE);
         total_cpu_usage += current_thread_cpu_usage;
+        if (std::optional<std::string> name = GetEngineThreadName(mach_threads.threads[i])) {
+          engine_threads.push_back({.thread_name = std::move(name.value()),
+                                    .cpu_usage = current_thread_cpu_usage * 100.0});
+        }
         break;
       }
       case MACH_SEND_TIMEOUT:
@@ -207,7 +234,8 @@ std::optional<CpuUsageInfo> ProfilerMetricsIOS::CpuUsage() {
   }
 
   flutter::CpuUsageInfo cpu_usage_info = {.num_threads = num_threads,
-                                          .total_cpu_usage = total_cpu_usage * 100.0};
+                                          .total_cpu_usage = total_cpu_usage * 100.0,
+                                          .engine_threads = std::move(engine_threads)};
   return cpu_usage_info;
 }
 
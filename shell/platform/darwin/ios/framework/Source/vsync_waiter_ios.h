@@ -60,6 +60,12 @@
 
 - (void)setMaxRefreshRate:(double)refreshRate;
 
+//------------------------------------------------------------------------------
+/// @brief      Asks the display link to fire at `frameRate` frames per second, which is lower
+///             than its max refresh rate. Call `setMaxRefreshRate:` to go back to the max.
+///
+- (void)setPreferredFrameRate:(double)frameRate;
+
 @end
 
 namespace flutter {
@@ -80,9 +86,15 @@ class VsyncWaiterIOS final : public VsyncWaiter, public VariableRefreshRateRepor
   // Made public for testing.
   void AwaitVSync() override;
 
+  // |VsyncWaiter|
+  void SetPreferredFrameRate(double frame_rate) override;
+
  private:
   fml::scoped_nsobject<VSyncClient> client_;
   double max_refresh_rate_;
+  double preferred_frame_rate_ = 0;
+
+  void UpdateFrameRate();
 
   FML_DISALLOW_COPY_AND_ASSIGN(VsyncWaiterIOS);
 };
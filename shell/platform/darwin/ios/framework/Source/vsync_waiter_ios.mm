@@ -57,11 +57,27 @@ void VsyncWaiterIOS::AwaitVSync() {
   }
   if (fabs(new_max_refresh_rate - max_refresh_rate_) > kRefreshRateDiffToIgnore) {
     max_refresh_rate_ = new_max_refresh_rate;
-    [client_.get() setMaxRefreshRate:max_refresh_rate_];
+    UpdateFrameRate();
   }
   [client_.get() await];
 }
 
+// |VsyncWaiter|
+void VsyncWaiterIOS::SetPreferredFrameRate(double frame_rate) {
+  preferred_frame_rate_ = frame_rate;
+  UpdateFrameRate();
+}
+
+void VsyncWaiterIOS::UpdateFrameRate() {
+  // The content never gets a higher rate than the max refresh rate by asking for it.
+  if (preferred_frame_rate_ > 0 &&
+      preferred_frame_rate_ < max_refresh_rate_ - kRefreshRateDiffToIgnore) {
+    [client_.get() setPreferredFrameRate:preferred_frame_rate_];
+  } else {
+    [client_.get() setMaxRefreshRate:max_refresh_rate_];
+  }
+}
+
 // |VariableRefreshRateReporter|
 double VsyncWaiterIOS::GetRefreshRate() const {
   return [client_.get() getRefreshRate];
@@ -118,6 +134,15 @@ fml::scoped_nsobject<VSyncClient> VsyncWaiterIOS::GetVsyncClient() const {
   }
 }
 
+- (void)setPreferredFrameRate:(double)frameRate {
+  if (@available(iOS 15.0, *)) {
+    display_link_.get().preferredFrameRateRange =
+        CAFrameRateRangeMake(frameRate, frameRate, frameRate);
+  } else {
+    display_link_.get().preferredFramesPerSecond = frameRate;
+  }
+}
+
 - (void)await {
   display_link_.get().paused = NO;
 }
@@ -19,6 +19,7 @@
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
 namespace impeller {
+class AiksContext;
 class Context;
 }  // namespace impeller
 
@@ -145,6 +146,23 @@ class IOSContext {
 
   virtual std::shared_ptr<impeller::Context> GetImpellerContext() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Setter for the Impeller Aiks context to be used by subsequent
+  ///             surfaces.
+  /// @details    Engines spawned from one another share this context and
+  ///             their raster thread, so the first surface sets its Aiks
+  ///             context here and later surfaces reuse its pipelines, glyph
+  ///             atlas and render target cache instead of creating their own.
+  ///
+  void SetAiksContext(const std::shared_ptr<impeller::AiksContext>& aiks_context);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Accessor for the Impeller Aiks context shared by the surfaces
+  ///             of this context.
+  /// @returns    `nullptr` when no surface has set one yet via SetAiksContext.
+  ///
+  std::shared_ptr<impeller::AiksContext> GetAiksContext() const;
+
   MsaaSampleCount GetMsaaSampleCount() const { return msaa_samples_; }
 
  protected:
@@ -152,6 +170,7 @@ class IOSContext {
 
  private:
   MsaaSampleCount msaa_samples_ = MsaaSampleCount::kNone;
+  std::shared_ptr<impeller::AiksContext> aiks_context_;
   FML_DISALLOW_COPY_AND_ASSIGN(IOSContext);
 };
 
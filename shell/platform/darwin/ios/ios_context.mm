@@ -56,4 +56,12 @@ std::shared_ptr<impeller::Context> IOSContext::GetImpellerContext() const {
   return nullptr;
 }
 
+void IOSContext::SetAiksContext(const std::shared_ptr<impeller::AiksContext>& aiks_context) {
+  aiks_context_ = aiks_context;
+}
+
+std::shared_ptr<impeller::AiksContext> IOSContext::GetAiksContext() const {
+  return aiks_context_;
+}
+
 }  // namespace flutter
@@ -50,6 +50,11 @@ class IOSExternalViewEmbedder : public ExternalViewEmbedder {
       const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger)
       override;
 
+  // |ExternalViewEmbedder|
+  void PrepareToEmbedPlatformViews(
+      const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger)
+      override;
+
   // |ExternalViewEmbedder|
   DlCanvas* CompositeEmbeddedView(int64_t view_id) override;
 
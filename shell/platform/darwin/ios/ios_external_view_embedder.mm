@@ -65,6 +65,14 @@ PostPrerollResult IOSExternalViewEmbedder::PostPrerollAction(
   return result;
 }
 
+// |ExternalViewEmbedder|
+void IOSExternalViewEmbedder::PrepareToEmbedPlatformViews(
+    const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {
+  TRACE_EVENT0("flutter", "IOSExternalViewEmbedder::PrepareToEmbedPlatformViews");
+  FML_CHECK(platform_views_controller_);
+  platform_views_controller_->PrepareToEmbedPlatformViews(raster_thread_merger);
+}
+
 // |ExternalViewEmbedder|
 DlCanvas* IOSExternalViewEmbedder::CompositeEmbeddedView(int64_t view_id) {
   TRACE_EVENT0("flutter", "IOSExternalViewEmbedder::CompositeEmbeddedView");
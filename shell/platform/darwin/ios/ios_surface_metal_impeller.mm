@@ -39,9 +39,15 @@ void IOSSurfaceMetalImpeller::UpdateStorageSizeIfNecessary() {
 std::unique_ptr<Surface> IOSSurfaceMetalImpeller::CreateGPUSurface(GrDirectContext*) {
   impeller_context_->UpdateOffscreenLayerPixelFormat(
       impeller::FromMTLPixelFormat(layer_.get().pixelFormat));
-  return std::make_unique<GPUSurfaceMetalImpeller>(this,              //
-                                                   impeller_context_  //
-  );
+  // Spawned engines share the context and render their surfaces on the same raster thread, so
+  // the first surface's Aiks context is shared with the surfaces that follow.
+  auto aiks_context = GetContext()->GetAiksContext();
+  auto surface = std::make_unique<GPUSurfaceMetalImpeller>(
+      this, impeller_context_, /*render_to_surface=*/true, aiks_context);
+  if (!aiks_context && surface->IsValid()) {
+    GetContext()->SetAiksContext(surface->GetAiksContext());
+  }
+  return surface;
 }
 
 // |GPUSurfaceMetalDelegate|
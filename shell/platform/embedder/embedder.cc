@@ -5,6 +5,7 @@
 #define FML_USED_ON_EMBEDDER
 #define RAPIDJSON_HAS_STDSTRING 1
 
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <memory>
@@ -601,7 +602,17 @@ InferVulkanPlatformViewCreationCallback(
                  static_cast<uint32_t>(frame_size.height())},
     };
 
-    return ptr(user_data, &frame_info);
+    // Images from embedders built against an older version of this struct
+    // don't have the semaphores.
+    FlutterVulkanImage image = ptr(user_data, &frame_info);
+    const FlutterVulkanImage* image_ptr = &image;
+    return FlutterVulkanImage{
+        .struct_size = sizeof(FlutterVulkanImage),
+        .image = image.image,
+        .format = image.format,
+        .wait_semaphore = SAFE_ACCESS(image_ptr, wait_semaphore, 0),
+        .signal_semaphore = SAFE_ACCESS(image_ptr, signal_semaphore, 0),
+    };
   };
 
   auto vulkan_present_image_callback =
@@ -1944,6 +1955,29 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
       external_texture_resolver =
           std::make_unique<ExternalTextureResolver>(external_texture_callback);
     }
+#ifdef IMPELLER_SUPPORTS_RENDERING
+    if (SAFE_ACCESS(open_gl_config,
+                    gl_external_egl_image_texture_frame_callback,
+                    nullptr) != nullptr) {
+      flutter::EmbedderExternalTextureEGLImage::ExternalTextureCallback
+          egl_image_callback =
+              [ptr =
+                   open_gl_config->gl_external_egl_image_texture_frame_callback,
+               user_data](int64_t texture_identifier, size_t width,
+                          size_t height)
+          -> std::unique_ptr<FlutterOpenGLEGLImageTexture> {
+        auto texture = std::make_unique<FlutterOpenGLEGLImageTexture>();
+        texture->struct_size = sizeof(FlutterOpenGLEGLImageTexture);
+        if (!ptr(user_data, texture_identifier, width, height,
+                 texture.get())) {
+          return nullptr;
+        }
+        return texture;
+      };
+      external_texture_resolver =
+          std::make_unique<ExternalTextureResolver>(egl_image_callback);
+    }
+#endif  // IMPELLER_SUPPORTS_RENDERING
   }
 #endif
 #ifdef SHELL_ENABLE_METAL
@@ -2463,9 +2497,10 @@ FlutterEngineResult FlutterEngineSendKeyEvent(FLUTTER_API_SYMBOL(FlutterEngine)
       message_data);
 }
 
-FlutterEngineResult FlutterEngineSendPlatformMessage(
+static FlutterEngineResult SendPlatformMessage(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
-    const FlutterPlatformMessage* flutter_message) {
+    const FlutterPlatformMessage* flutter_message,
+    bool take_message_data) {
   if (engine == nullptr) {
     return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
   }
@@ -2498,8 +2533,16 @@ FlutterEngineResult FlutterEngineSendPlatformMessage(
 
   std::unique_ptr<flutter::PlatformMessage> message;
   if (message_size == 0) {
+    if (take_message_data) {
+      free(const_cast<uint8_t*>(message_data));
+    }
     message = std::make_unique<flutter::PlatformMessage>(
         flutter_message->channel, response);
+  } else if (take_message_data) {
+    message = std::make_unique<flutter::PlatformMessage>(
+        flutter_message->channel,
+        fml::MallocMapping(const_cast<uint8_t*>(message_data), message_size),
+        response);
   } else {
     message = std::make_unique<flutter::PlatformMessage>(
         flutter_message->channel,
@@ -2514,6 +2557,20 @@ FlutterEngineResult FlutterEngineSendPlatformMessage(
                                   "Flutter application.");
 }
 
+FlutterEngineResult FlutterEngineSendPlatformMessage(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessage* flutter_message) {
+  return SendPlatformMessage(engine, flutter_message,
+                             /*take_message_data=*/false);
+}
+
+FlutterEngineResult FlutterEngineSendPlatformMessageWithoutCopy(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessage* flutter_message) {
+  return SendPlatformMessage(engine, flutter_message,
+                             /*take_message_data=*/true);
+}
+
 FlutterEngineResult FlutterPlatformMessageCreateResponseHandle(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     FlutterDataCallback data_callback,
@@ -2591,6 +2648,35 @@ FlutterEngineResult FlutterEngineSendPlatformMessageResponse(
   return kSuccess;
 }
 
+// Note: This can execute on any thread.
+FlutterEngineResult FlutterEngineSendPlatformMessageResponseWithoutCopy(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessageResponseHandle* handle,
+    uint8_t* data,
+    size_t data_length) {
+  if (data_length != 0 && data == nullptr) {
+    return LOG_EMBEDDER_ERROR(
+        kInvalidArguments,
+        "Data size was non zero but the pointer to the data was null.");
+  }
+
+  fml::MallocMapping mapping(data, data_length);
+  auto response = handle->message->response();
+
+  if (response) {
+    if (data_length == 0) {
+      response->CompleteEmpty();
+    } else {
+      response->Complete(
+          std::make_unique<fml::MallocMapping>(std::move(mapping)));
+    }
+  }
+
+  delete handle;
+
+  return kSuccess;
+}
+
 FlutterEngineResult __FlutterEngineFlushPendingTasksNow() {
   fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
   return kSuccess;
@@ -2799,6 +2885,32 @@ FlutterEngineResult FlutterEngineRunTask(FLUTTER_API_SYMBOL(FlutterEngine)
                                   "Could not run the specified task.");
 }
 
+FlutterEngineResult FlutterEngineRunExpiredTasks(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterTaskRunner task_runner,
+    uint64_t* next_target_time) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (next_target_time == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Next target time pointer was null.");
+  }
+
+  fml::TimePoint next;
+  if (!reinterpret_cast<flutter::EmbedderEngine*>(engine)->RunExpiredTasks(
+          task_runner, &next)) {
+    return LOG_EMBEDDER_ERROR(
+        kInvalidArguments,
+        "Could not run the expired tasks of the specified task runner.");
+  }
+  *next_target_time = next == fml::TimePoint::Max()
+                          ? UINT64_MAX
+                          : next.ToEpochDelta().ToNanoseconds();
+  return kSuccess;
+}
+
 static bool DispatchJSONPlatformMessage(FLUTTER_API_SYMBOL(FlutterEngine)
                                             engine,
                                         const rapidjson::Document& document,
@@ -3214,6 +3326,11 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(NotifyDisplayUpdate, FlutterEngineNotifyDisplayUpdate);
   SET_PROC(ScheduleFrame, FlutterEngineScheduleFrame);
   SET_PROC(SetNextFrameCallback, FlutterEngineSetNextFrameCallback);
+  SET_PROC(SendPlatformMessageWithoutCopy,
+           FlutterEngineSendPlatformMessageWithoutCopy);
+  SET_PROC(SendPlatformMessageResponseWithoutCopy,
+           FlutterEngineSendPlatformMessageResponseWithoutCopy);
+  SET_PROC(RunExpiredTasks, FlutterEngineRunExpiredTasks);
 #undef SET_PROC
 
   return kSuccess;
@@ -408,6 +408,35 @@ typedef bool (*TextureFrameCallback)(void* /* user data */,
                                      size_t /* width */,
                                      size_t /* height */,
                                      FlutterOpenGLTexture* /* texture out */);
+
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterOpenGLEGLImageTexture).
+  size_t struct_size;
+  /// The EGLImageKHR holding the frame, for example one created from a Linux
+  /// dmabuf with `EGL_LINUX_DMA_BUF_EXT` or from an Android
+  /// `AHardwareBuffer`. The engine samples from it directly, without a copy.
+  void* egl_image;
+  /// The texture target to which the image is bound: `GL_TEXTURE_2D` or
+  /// `GL_TEXTURE_EXTERNAL_OES`.
+  uint32_t target;
+  /// Width of the image. If zero, the size requested by the engine is used.
+  size_t width;
+  /// Height of the image. If zero, the size requested by the engine is used.
+  size_t height;
+  /// User data to be returned on the invocation of the destruction callback.
+  void* user_data;
+  /// Callback invoked (on an engine managed thread) once the engine no longer
+  /// samples from the image, which is when the next frame of the texture is
+  /// obtained or the texture is unregistered.
+  VoidCallback destruction_callback;
+} FlutterOpenGLEGLImageTexture;
+
+typedef bool (*EGLImageTextureFrameCallback)(
+    void* /* user data */,
+    int64_t /* texture identifier */,
+    size_t /* width */,
+    size_t /* height */,
+    FlutterOpenGLEGLImageTexture* /* texture out */);
 typedef void (*VsyncCallback)(void* /* user data */, intptr_t /* baton */);
 typedef void (*OnPreEngineRestartCallback)(void* /* user data */);
 
@@ -582,6 +611,14 @@ typedef struct {
   /// ID. Not specifying populate_existing_damage will result in full
   /// repaint (i.e. rendering all the pixels on the screen at every frame).
   FlutterFrameBufferWithDamageCallback populate_existing_damage;
+  /// When using Impeller, this may be specified instead of
+  /// `gl_external_texture_frame_callback` to supply the frames of external
+  /// textures as EGL images, which the engine binds to textures of its own.
+  /// This is how buffers shared across processes or APIs (such as video
+  /// decoder output) are composited without a copy. The engine calls this
+  /// method on an internal engine managed thread, with the engine's context
+  /// current, whenever it needs the next frame of a texture.
+  EGLImageTextureFrameCallback gl_external_egl_image_texture_frame_callback;
 } FlutterOpenGLRendererConfig;
 
 /// Alias for id<MTLDevice>.
@@ -711,6 +748,9 @@ typedef void* FlutterVulkanQueueHandle;
 /// Alias for VkImage.
 typedef uint64_t FlutterVulkanImageHandle;
 
+/// Alias for VkSemaphore.
+typedef uint64_t FlutterVulkanSemaphoreHandle;
+
 typedef struct {
   /// The size of this struct. Must be sizeof(FlutterVulkanImage).
   size_t struct_size;
@@ -719,6 +759,17 @@ typedef struct {
   FlutterVulkanImageHandle image;
   /// The VkFormat of the image (for example: VK_FORMAT_R8G8B8A8_UNORM).
   uint32_t format;
+  /// An optional binary VkSemaphore, owned by the embedder, that is signaled
+  /// once the image may be written to, for example when the embedder's
+  /// compositor is done reading the previous frame from it. The engine waits
+  /// for it on the GPU before it renders into the image. Only read from the
+  /// image returned by the `get_next_image_callback`; `0` if unused.
+  FlutterVulkanSemaphoreHandle wait_semaphore;
+  /// An optional binary VkSemaphore, owned by the embedder, that the engine
+  /// signals once the frame has been rendered into the image. The embedder
+  /// must wait for it on the GPU before it reads the image. Only read from
+  /// the image returned by the `get_next_image_callback`; `0` if unused.
+  FlutterVulkanSemaphoreHandle signal_semaphore;
 } FlutterVulkanImage;
 
 /// Callback to fetch a Vulkan function pointer for a given instance. Normally,
@@ -799,7 +850,9 @@ typedef struct {
   /// The callback invoked when a VkImage has been written to and is ready for
   /// use by the embedder. Prior to calling this callback, the engine performs
   /// a host sync, and so the VkImage can be used in a pipeline by the embedder
-  /// without any additional synchronization.
+  /// without any additional synchronization. If the image came with a
+  /// `signal_semaphore`, the engine signals it instead, and the embedder's
+  /// pipeline must wait for it.
   /// Not used if a FlutterCompositor is supplied in FlutterProjectArgs.
   FlutterVulkanPresentCallback present_image_callback;
 
@@ -1449,6 +1502,11 @@ typedef void (*FlutterTaskRunnerPostTaskCallback)(
     uint64_t /* target time nanos */,
     void* /* user data */);
 
+typedef void (*FlutterTaskRunnerWakeUpCallback)(
+    FlutterTaskRunner /* task runner */,
+    uint64_t /* target time nanos */,
+    void* /* user data */);
+
 /// An interface used by the Flutter engine to execute tasks at the target time
 /// on a specified thread. There should be a 1-1 relationship between a thread
 /// and a task runner. It is undefined behavior to run a task on a thread that
@@ -1471,11 +1529,20 @@ typedef struct {
   /// delta, `FlutterEngineGetCurrentTime` may be called and the difference used
   /// as the delta.
   ///
-  /// @attention     This field is required.
+  /// @attention     This field is required unless `wake_up_callback` is
+  ///                 specified.
   FlutterTaskRunnerPostTaskCallback post_task_callback;
   /// A unique identifier for the task runner. If multiple task runners service
   /// tasks on the same thread, their identifiers must match.
   size_t identifier;
+  /// May be called from any thread. If specified, the engine keeps the tasks
+  /// for this task runner itself and `post_task_callback` is not called.
+  /// Instead, this is called when the earliest target time of the pending
+  /// tasks moves earlier, which coalesces the wake ups for tasks posted in
+  /// quick succession. At the given target time the embedder should call
+  /// `FlutterEngineRunExpiredTasks` on the thread associated with the task
+  /// runner, and then again at the target time that call returns.
+  FlutterTaskRunnerWakeUpCallback wake_up_callback;
 } FlutterTaskRunnerDescription;
 
 typedef struct {
@@ -2448,6 +2515,24 @@ FlutterEngineResult FlutterEngineSendPlatformMessage(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     const FlutterPlatformMessage* message);
 
+//------------------------------------------------------------------------------
+/// @brief      Sends a platform message to the Flutter application like
+///             `FlutterEngineSendPlatformMessage`, except that the engine takes
+///             ownership of the message data instead of copying it.
+///
+/// @param[in]  engine   A running engine instance.
+/// @param[in]  message  The message. Its data must have been allocated with
+///                      `malloc`. Unless `kInvalidArguments` is returned, the
+///                      engine releases the data with `free` once it is done
+///                      with it, even if the message could not be sent.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineSendPlatformMessageWithoutCopy(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessage* message);
+
 //------------------------------------------------------------------------------
 /// @brief     Creates a platform message response handle that allows the
 ///            embedder to set a native callback for a response to a message.
@@ -2521,6 +2606,31 @@ FlutterEngineResult FlutterEngineSendPlatformMessageResponse(
     const uint8_t* data,
     size_t data_length);
 
+//------------------------------------------------------------------------------
+/// @brief      Send a response from the native side to a platform message from
+///             the Dart Flutter application like
+///             `FlutterEngineSendPlatformMessageResponse`, except that the
+///             engine takes ownership of the response data instead of copying
+///             it.
+///
+/// @param[in]  engine       The running engine instance.
+/// @param[in]  handle       The platform message response handle.
+/// @param[in]  data         The data to associate with the platform message
+///                          response. It must have been allocated with
+///                          `malloc`. Unless `kInvalidArguments` is returned,
+///                          the engine releases it with `free` once it is
+///                          done with it.
+/// @param[in]  data_length  The length of the platform message response data.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineSendPlatformMessageResponseWithoutCopy(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessageResponseHandle* handle,
+    uint8_t* data,
+    size_t data_length);
+
 //------------------------------------------------------------------------------
 /// @brief      This API is only meant to be used by platforms that need to
 ///             flush tasks on a message loop not controlled by the Flutter
@@ -2777,6 +2887,30 @@ FlutterEngineResult FlutterEngineRunTask(FLUTTER_API_SYMBOL(FlutterEngine)
                                              engine,
                                          const FlutterTask* task);
 
+//------------------------------------------------------------------------------
+/// @brief      Inform the engine to run, in order, all the tasks of a task
+///             runner whose target time has expired. This is only valid for
+///             task runners whose description specifies a
+///             `FlutterTaskRunnerDescription.wake_up_callback`, and must be
+///             called on the thread associated with the task runner.
+///
+/// @param[in]  engine            A running engine instance.
+/// @param[in]  task_runner       The task runner given to the wake up
+///                               callback.
+/// @param[out] next_target_time  The target time, on the same clock as
+///                               `FlutterEngineGetCurrentTime`, at which this
+///                               should next be called, or `UINT64_MAX` if no
+///                               tasks remain. The wake up callback is not
+///                               called for this time.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineRunExpiredTasks(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterTaskRunner task_runner,
+    uint64_t* next_target_time);
+
 //------------------------------------------------------------------------------
 /// @brief      Notify a running engine instance that the locale has been
 ///             updated. The preferred locale must be the first item in the list
@@ -3076,6 +3210,20 @@ typedef FlutterEngineResult (*FlutterEngineSetNextFrameCallbackFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     VoidCallback callback,
     void* user_data);
+typedef FlutterEngineResult (
+    *FlutterEngineSendPlatformMessageWithoutCopyFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessage* message);
+typedef FlutterEngineResult (
+    *FlutterEngineSendPlatformMessageResponseWithoutCopyFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterPlatformMessageResponseHandle* handle,
+    uint8_t* data,
+    size_t data_length);
+typedef FlutterEngineResult (*FlutterEngineRunExpiredTasksFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterTaskRunner task_runner,
+    uint64_t* next_target_time);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -3122,6 +3270,11 @@ typedef struct {
   FlutterEngineNotifyDisplayUpdateFnPtr NotifyDisplayUpdate;
   FlutterEngineScheduleFrameFnPtr ScheduleFrame;
   FlutterEngineSetNextFrameCallbackFnPtr SetNextFrameCallback;
+  FlutterEngineSendPlatformMessageWithoutCopyFnPtr
+      SendPlatformMessageWithoutCopy;
+  FlutterEngineSendPlatformMessageResponseWithoutCopyFnPtr
+      SendPlatformMessageResponseWithoutCopy;
+  FlutterEngineRunExpiredTasksFnPtr RunExpiredTasks;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
@@ -247,6 +247,13 @@ bool EmbedderEngine::RunTask(const FlutterTask* task) {
                                 task->task);
 }
 
+bool EmbedderEngine::RunExpiredTasks(FlutterTaskRunner task_runner,
+                                     fml::TimePoint* next_target_time) {
+  // Like |RunTask|, this is valid before the shell is running.
+  return thread_host_->RunExpiredTasks(reinterpret_cast<int64_t>(task_runner),
+                                       next_target_time);
+}
+
 bool EmbedderEngine::PostTaskOnEngineManagedNativeThreads(
     const std::function<void(FlutterNativeThreadType)>& closure) const {
   if (!IsValid() || closure == nullptr) {
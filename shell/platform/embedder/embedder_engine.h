@@ -80,6 +80,9 @@ class EmbedderEngine {
 
   bool RunTask(const FlutterTask* task);
 
+  bool RunExpiredTasks(FlutterTaskRunner task_runner,
+                       fml::TimePoint* next_target_time);
+
   bool PostTaskOnEngineManagedNativeThreads(
       const std::function<void(FlutterNativeThreadType)>& closure) const;
 
@@ -0,0 +1,130 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_external_texture_egl_image.h"
+
+#include "flutter/fml/logging.h"
+#include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/display_list/dl_image_impeller.h"
+#include "flutter/impeller/renderer/backend/gles/context_gles.h"
+#include "flutter/impeller/renderer/backend/gles/texture_gles.h"
+
+namespace flutter {
+
+EmbedderExternalTextureEGLImage::EmbedderExternalTextureEGLImage(
+    int64_t texture_identifier,
+    const ExternalTextureCallback& callback)
+    : Texture(texture_identifier), external_texture_callback_(callback) {
+  FML_DCHECK(external_texture_callback_);
+}
+
+EmbedderExternalTextureEGLImage::~EmbedderExternalTextureEGLImage() {
+  ReleaseLastFrame();
+}
+
+// |flutter::Texture|
+void EmbedderExternalTextureEGLImage::Paint(PaintContext& context,
+                                            const SkRect& bounds,
+                                            bool freeze,
+                                            const DlImageSampling sampling) {
+  if (last_image_ == nullptr) {
+    last_image_ =
+        ResolveTexture(Id(),                                           //
+                       context.aiks_context,                           //
+                       SkISize::Make(bounds.width(), bounds.height())  //
+        );
+  }
+
+  DlCanvas* canvas = context.canvas;
+  const DlPaint* paint = context.paint;
+
+  if (last_image_) {
+    SkRect image_bounds = SkRect::Make(last_image_->bounds());
+    if (bounds != image_bounds) {
+      canvas->DrawImageRect(last_image_, image_bounds, bounds, sampling, paint);
+    } else {
+      canvas->DrawImage(last_image_, {bounds.x(), bounds.y()}, sampling, paint);
+    }
+  }
+}
+
+sk_sp<DlImage> EmbedderExternalTextureEGLImage::ResolveTexture(
+    int64_t texture_id,
+    impeller::AiksContext* aiks_context,
+    const SkISize& size) {
+  if (!aiks_context) {
+    FML_LOG(ERROR) << "EGL image external textures require Impeller.";
+    return nullptr;
+  }
+
+  ReleaseLastFrame();
+  last_frame_ =
+      external_texture_callback_(texture_id, size.width(), size.height());
+  if (!last_frame_ || !last_frame_->egl_image) {
+    last_frame_ = nullptr;
+    return nullptr;
+  }
+
+  auto impeller_context = aiks_context->GetContext();
+  const auto& context = impeller::ContextGLES::Cast(*impeller_context);
+  const auto& gl = context.GetReactor()->GetProcTable();
+  if (!gl.EGLImageTargetTexture2DOES.IsAvailable()) {
+    FML_LOG(ERROR) << "GL_OES_EGL_image is not supported.";
+    ReleaseLastFrame();
+    return nullptr;
+  }
+
+  impeller::TextureDescriptor desc;
+  desc.type = last_frame_->target == GL_TEXTURE_EXTERNAL_OES
+                  ? impeller::TextureType::kTextureExternalOES
+                  : impeller::TextureType::kTexture2D;
+  desc.storage_mode = impeller::StorageMode::kDevicePrivate;
+  desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
+  desc.size = {size.width(), size.height()};
+  if (last_frame_->width != 0 && last_frame_->height != 0) {
+    desc.size = {static_cast<int>(last_frame_->width),
+                 static_cast<int>(last_frame_->height)};
+  }
+  desc.mip_count = 1;
+
+  // The texture is wrapped as its storage comes from the image rather than
+  // from Impeller.
+  auto texture = std::make_shared<impeller::TextureGLES>(
+      context.GetReactor(), desc, impeller::TextureGLES::IsWrapped::kWrapped);
+  texture->SetCoordinateSystem(
+      impeller::TextureCoordinateSystem::kUploadFromHost);
+  if (!texture->Bind()) {
+    ReleaseLastFrame();
+    return nullptr;
+  }
+  gl.EGLImageTargetTexture2DOES(
+      last_frame_->target, static_cast<GLeglImageOES>(last_frame_->egl_image));
+  return impeller::DlImageImpeller::Make(std::move(texture));
+}
+
+void EmbedderExternalTextureEGLImage::ReleaseLastFrame() {
+  if (last_frame_ && last_frame_->destruction_callback) {
+    last_frame_->destruction_callback(last_frame_->user_data);
+  }
+  last_frame_ = nullptr;
+}
+
+// |flutter::Texture|
+void EmbedderExternalTextureEGLImage::OnGrContextCreated() {}
+
+// |flutter::Texture|
+void EmbedderExternalTextureEGLImage::OnGrContextDestroyed() {}
+
+// |flutter::Texture|
+void EmbedderExternalTextureEGLImage::MarkNewFrameAvailable() {
+  last_image_ = nullptr;
+}
+
+// |flutter::Texture|
+void EmbedderExternalTextureEGLImage::OnTextureUnregistered() {
+  last_image_ = nullptr;
+  ReleaseLastFrame();
+}
+
+}  // namespace flutter
@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_EGL_IMAGE_H_
+#define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_EGL_IMAGE_H_
+
+#include <functional>
+#include <memory>
+
+#include "flutter/common/graphics/texture.h"
+#include "flutter/fml/macros.h"
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// An external texture whose frames the embedder supplies as EGL images,
+/// which are bound to Impeller GLES textures so that they are sampled without
+/// a copy.
+///
+class EmbedderExternalTextureEGLImage : public flutter::Texture {
+ public:
+  using ExternalTextureCallback =
+      std::function<std::unique_ptr<FlutterOpenGLEGLImageTexture>(int64_t,
+                                                                  size_t,
+                                                                  size_t)>;
+
+  EmbedderExternalTextureEGLImage(int64_t texture_identifier,
+                                  const ExternalTextureCallback& callback);
+
+  ~EmbedderExternalTextureEGLImage();
+
+ private:
+  const ExternalTextureCallback& external_texture_callback_;
+  sk_sp<DlImage> last_image_;
+  // The frame that |last_image_| samples from, which is handed back to the
+  // embedder when it is replaced.
+  std::unique_ptr<FlutterOpenGLEGLImageTexture> last_frame_;
+
+  sk_sp<DlImage> ResolveTexture(int64_t texture_id,
+                                impeller::AiksContext* aiks_context,
+                                const SkISize& size);
+
+  void ReleaseLastFrame();
+
+  // |flutter::Texture|
+  void Paint(PaintContext& context,
+             const SkRect& bounds,
+             bool freeze,
+             const DlImageSampling sampling) override;
+
+  // |flutter::Texture|
+  void OnGrContextCreated() override;
+
+  // |flutter::Texture|
+  void OnGrContextDestroyed() override;
+
+  // |flutter::Texture|
+  void MarkNewFrameAvailable() override;
+
+  // |flutter::Texture|
+  void OnTextureUnregistered() override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalTextureEGLImage);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_EGL_IMAGE_H_
@@ -13,6 +13,12 @@ namespace flutter {
 EmbedderExternalTextureResolver::EmbedderExternalTextureResolver(
     EmbedderExternalTextureGL::ExternalTextureCallback gl_callback)
     : gl_callback_(std::move(gl_callback)) {}
+
+#ifdef IMPELLER_SUPPORTS_RENDERING
+EmbedderExternalTextureResolver::EmbedderExternalTextureResolver(
+    EmbedderExternalTextureEGLImage::ExternalTextureCallback egl_image_callback)
+    : egl_image_callback_(std::move(egl_image_callback)) {}
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -28,6 +34,12 @@ EmbedderExternalTextureResolver::ResolveExternalTexture(int64_t texture_id) {
     return std::make_unique<EmbedderExternalTextureGL>(texture_id,
                                                        gl_callback_);
   }
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  if (egl_image_callback_) {
+    return std::make_unique<EmbedderExternalTextureEGLImage>(
+        texture_id, egl_image_callback_);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -45,6 +57,11 @@ bool EmbedderExternalTextureResolver::SupportsExternalTextures() {
   if (gl_callback_) {
     return true;
   }
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  if (egl_image_callback_) {
+    return true;
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -11,6 +11,9 @@
 
 #ifdef SHELL_ENABLE_GL
 #include "flutter/shell/platform/embedder/embedder_external_texture_gl.h"
+#ifdef IMPELLER_SUPPORTS_RENDERING
+#include "flutter/shell/platform/embedder/embedder_external_texture_egl_image.h"  // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -27,6 +30,11 @@ class EmbedderExternalTextureResolver {
 #ifdef SHELL_ENABLE_GL
   explicit EmbedderExternalTextureResolver(
       EmbedderExternalTextureGL::ExternalTextureCallback gl_callback);
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  explicit EmbedderExternalTextureResolver(
+      EmbedderExternalTextureEGLImage::ExternalTextureCallback
+          egl_image_callback);
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -41,6 +49,9 @@ class EmbedderExternalTextureResolver {
  private:
 #ifdef SHELL_ENABLE_GL
   EmbedderExternalTextureGL::ExternalTextureCallback gl_callback_;
+#ifdef IMPELLER_SUPPORTS_RENDERING
+  EmbedderExternalTextureEGLImage::ExternalTextureCallback egl_image_callback_;
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -16,6 +16,10 @@ namespace flutter {
 
 static const auto kRootViewIdentifier = EmbedderExternalView::ViewIdentifier{};
 
+// Backing stores that a frame does not use are kept for the next one, in case
+// it needs one of the same size again, and are collected after that.
+static constexpr size_t kMaxUnusedFrames = 2;
+
 EmbedderExternalViewEmbedder::EmbedderExternalViewEmbedder(
     bool avoid_backing_store_cache,
     const CreateRenderTargetCallback& create_render_target_callback,
@@ -458,7 +462,7 @@ void EmbedderExternalViewEmbedder::SubmitFlutterView(
   //
   // @warning: Embedder may trample on our OpenGL context here.
   auto deferred_cleanup_render_targets =
-      render_target_cache_.ClearAllRenderTargetsInCache();
+      render_target_cache_.CollectUnusedRenderTargets(kMaxUnusedFrames);
 
   // The OpenGL context could have been trampled by the embedder at this point
   // as it attempted to collect old render targets and create new ones. Tell
@@ -17,7 +17,7 @@ EmbedderRenderTargetCache::GetRenderTarget(
   if (compatible_target == cached_render_targets_.end()) {
     return nullptr;
   }
-  auto target = std::move(compatible_target->second);
+  auto target = std::move(compatible_target->second.target);
   cached_render_targets_.erase(compatible_target);
   return target;
 }
@@ -26,12 +26,28 @@ std::set<std::unique_ptr<EmbedderRenderTarget>>
 EmbedderRenderTargetCache::ClearAllRenderTargetsInCache() {
   std::set<std::unique_ptr<EmbedderRenderTarget>> cleared_targets;
   for (auto& targets : cached_render_targets_) {
-    cleared_targets.insert(std::move(targets.second));
+    cleared_targets.insert(std::move(targets.second.target));
   }
   cached_render_targets_.clear();
   return cleared_targets;
 }
 
+std::set<std::unique_ptr<EmbedderRenderTarget>>
+EmbedderRenderTargetCache::CollectUnusedRenderTargets(
+    size_t max_unused_frames) {
+  std::set<std::unique_ptr<EmbedderRenderTarget>> collected_targets;
+  for (auto it = cached_render_targets_.begin();
+       it != cached_render_targets_.end();) {
+    if (++it->second.unused_frames >= max_unused_frames) {
+      collected_targets.insert(std::move(it->second.target));
+      it = cached_render_targets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return collected_targets;
+}
+
 void EmbedderRenderTargetCache::CacheRenderTarget(
     std::unique_ptr<EmbedderRenderTarget> target) {
   if (target == nullptr) {
@@ -39,7 +55,8 @@ void EmbedderRenderTargetCache::CacheRenderTarget(
   }
   auto desc = EmbedderExternalView::RenderTargetDescriptor{
       target->GetRenderTargetSize()};
-  cached_render_targets_.insert(std::make_pair(desc, std::move(target)));
+  cached_render_targets_.insert(
+      std::make_pair(desc, CachedRenderTarget{.target = std::move(target)}));
 }
 
 size_t EmbedderRenderTargetCache::GetCachedTargetsCount() const {
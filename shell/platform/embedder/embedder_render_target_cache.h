@@ -31,14 +31,38 @@ class EmbedderRenderTargetCache {
   std::set<std::unique_ptr<EmbedderRenderTarget>>
   ClearAllRenderTargetsInCache();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Removes the render targets that were not used by the last
+  ///             `max_unused_frames` frames, counting the current one. The
+  ///             others are kept so that a layer that comes back at the same
+  ///             size, for example when an overlay reappears or the window
+  ///             size jitters, does not need a new backing store.
+  ///
+  ///             Call this once per frame, after the render targets for the
+  ///             frame have been taken out of the cache.
+  ///
+  /// @param[in]  max_unused_frames  The number of frames in a row a render
+  ///                                target may go unused, at least 1.
+  ///
+  /// @return     The removed render targets.
+  ///
+  std::set<std::unique_ptr<EmbedderRenderTarget>> CollectUnusedRenderTargets(
+      size_t max_unused_frames);
+
   void CacheRenderTarget(std::unique_ptr<EmbedderRenderTarget> target);
 
   size_t GetCachedTargetsCount() const;
 
  private:
+  struct CachedRenderTarget {
+    std::unique_ptr<EmbedderRenderTarget> target;
+    // The number of frames in a row that did not use the target.
+    size_t unused_frames = 0;
+  };
+
   using CachedRenderTargets = std::unordered_multimap<
       EmbedderExternalView::RenderTargetDescriptor,
-      std::unique_ptr<EmbedderRenderTarget>,
+      CachedRenderTarget,
       EmbedderExternalView::RenderTargetDescriptor::Hash,
       EmbedderExternalView::RenderTargetDescriptor::Equal>;
 
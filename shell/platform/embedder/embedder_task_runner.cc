@@ -36,6 +36,22 @@ void EmbedderTaskRunner::PostTaskForTime(const fml::closure& task,
     return;
   }
 
+  if (dispatch_table_.wake_up_callback) {
+    bool wake_up = false;
+    {
+      std::scoped_lock lock(tasks_mutex_);
+      timed_tasks_.emplace(target_time, task);
+      if (target_time < scheduled_wake_up_) {
+        scheduled_wake_up_ = target_time;
+        wake_up = true;
+      }
+    }
+    if (wake_up) {
+      dispatch_table_.wake_up_callback(this, target_time);
+    }
+    return;
+  }
+
   uint64_t baton = 0;
 
   {
@@ -53,6 +69,12 @@ void EmbedderTaskRunner::PostDelayedTask(const fml::closure& task,
   PostTaskForTime(task, fml::TimePoint::Now() + delay);
 }
 
+void EmbedderTaskRunner::PostTaskWithDeadline(const fml::closure& task,
+                                              fml::TimePoint deadline) {
+  // The embedder decides the order its tasks run in.
+  PostTask(task);
+}
+
 bool EmbedderTaskRunner::RunsTasksOnCurrentThread() {
   return dispatch_table_.runs_task_on_current_thread_callback();
 }
@@ -78,6 +100,32 @@ bool EmbedderTaskRunner::PostTask(uint64_t baton) {
   return true;
 }
 
+bool EmbedderTaskRunner::UsesWakeUps() const {
+  return static_cast<bool>(dispatch_table_.wake_up_callback);
+}
+
+fml::TimePoint EmbedderTaskRunner::RunExpiredTasks() {
+  FML_DCHECK(dispatch_table_.wake_up_callback);
+  const fml::TimePoint now = fml::TimePoint::Now();
+  while (true) {
+    fml::closure task;
+    {
+      std::scoped_lock lock(tasks_mutex_);
+      auto first = timed_tasks_.begin();
+      if (first == timed_tasks_.end() || first->first > now) {
+        scheduled_wake_up_ = first == timed_tasks_.end()
+                                 ? fml::TimePoint::Max()
+                                 : first->first;
+        return scheduled_wake_up_;
+      }
+      task = std::move(first->second);
+      timed_tasks_.erase(first);
+      scheduled_wake_up_ = fml::TimePoint::Min();
+    }
+    task();
+  }
+}
+
 // |fml::TaskRunner|
 fml::TaskQueueId EmbedderTaskRunner::GetTaskQueueId() {
   return placeholder_id_;
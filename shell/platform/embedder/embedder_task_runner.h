@@ -5,11 +5,13 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_TASK_RUNNER_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_TASK_RUNNER_H_
 
+#include <map>
 #include <mutex>
 #include <unordered_map>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_point.h"
 
 namespace flutter {
 
@@ -39,6 +41,16 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
     /// thread.
     ///
     std::function<bool(void)> runs_task_on_current_thread_callback;
+    //--------------------------------------------------------------------------
+    /// Optional. If set, the task runner keeps posted tasks itself instead of
+    /// handing each one to `post_task_callback`, and calls this only when the
+    /// earliest time at which a task is due moves earlier. The embedder must
+    /// then call `EmbedderTaskRunner::RunExpiredTasks` on the correct thread
+    /// once that time point expires.
+    ///
+    std::function<void(EmbedderTaskRunner* task_runner,
+                       fml::TimePoint target_time)>
+        wake_up_callback;
   };
 
   //----------------------------------------------------------------------------
@@ -71,12 +83,39 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
 
   bool PostTask(uint64_t baton);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Runs, in order, every task that was due when the call was
+  ///             made. Only used if the dispatch table has a
+  ///             `wake_up_callback`. Must be called on the thread that the
+  ///             task runner services.
+  ///
+  /// @return     The time point at which the earliest remaining task is due,
+  ///             or `fml::TimePoint::Max()` if there are none. The embedder
+  ///             is expected to call this again at that time; the wake up
+  ///             callback is not called for it.
+  ///
+  fml::TimePoint RunExpiredTasks();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the dispatch table has a `wake_up_callback`, so that
+  ///             tasks are run with `RunExpiredTasks`.
+  ///
+  bool UsesWakeUps() const;
+
  private:
   const size_t embedder_identifier_;
   DispatchTable dispatch_table_;
   std::mutex tasks_mutex_;
   uint64_t last_baton_ = 0;
   std::unordered_map<uint64_t, fml::closure> pending_tasks_;
+  // Tasks awaiting `RunExpiredTasks`, by target time. Tasks with the same
+  // target time run in the order they were posted.
+  std::multimap<fml::TimePoint, fml::closure> timed_tasks_;
+  // The time at which the embedder will next call `RunExpiredTasks`, as far
+  // as the task runner knows. `fml::TimePoint::Min()` while the tasks are
+  // being run, since the time returned from that call covers every task
+  // posted in the meantime.
+  fml::TimePoint scheduled_wake_up_ = fml::TimePoint::Max();
   fml::TaskQueueId placeholder_id_;
 
   // |fml::TaskRunner|
@@ -89,6 +128,10 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
   // |fml::TaskRunner|
   void PostDelayedTask(const fml::closure& task, fml::TimeDelta delay) override;
 
+  // |fml::TaskRunner|
+  void PostTaskWithDeadline(const fml::closure& task,
+                            fml::TimePoint deadline) override;
+
   // |fml::TaskRunner|
   bool RunsTasksOnCurrentThread() override;
 
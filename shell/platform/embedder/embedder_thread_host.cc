@@ -42,7 +42,10 @@ CreateEmbedderTaskRunner(const FlutterTaskRunnerDescription* description) {
     return {false, {}};
   }
 
-  if (SAFE_ACCESS(description, post_task_callback, nullptr) == nullptr) {
+  auto wake_up_callback_c = SAFE_ACCESS(description, wake_up_callback, nullptr);
+
+  if (SAFE_ACCESS(description, post_task_callback, nullptr) == nullptr &&
+      wake_up_callback_c == nullptr) {
     FML_LOG(ERROR)
         << "FlutterTaskRunnerDescription.post_task_callback was nullptr.";
     return {false, {}};
@@ -74,6 +77,16 @@ CreateEmbedderTaskRunner(const FlutterTaskRunnerDescription* description) {
         return runs_task_on_current_thread_callback_c(user_data);
       }};
 
+  if (wake_up_callback_c) {
+    task_runner_dispatch_table.wake_up_callback =
+        [wake_up_callback_c, user_data](EmbedderTaskRunner* task_runner,
+                                        fml::TimePoint target_time) -> void {
+      wake_up_callback_c(reinterpret_cast<FlutterTaskRunner>(task_runner),
+                         target_time.ToEpochDelta().ToNanoseconds(),
+                         user_data);
+    };
+  }
+
   return {true, fml::MakeRefCounted<EmbedderTaskRunner>(
                     task_runner_dispatch_table,
                     SAFE_ACCESS(description, identifier, 0u))};
@@ -295,4 +308,15 @@ bool EmbedderThreadHost::PostTask(int64_t runner, uint64_t task) const {
   return found->second->PostTask(task);
 }
 
+bool EmbedderThreadHost::RunExpiredTasks(
+    int64_t runner,
+    fml::TimePoint* next_target_time) const {
+  auto found = runners_map_.find(runner);
+  if (found == runners_map_.end() || !found->second->UsesWakeUps()) {
+    return false;
+  }
+  *next_target_time = found->second->RunExpiredTasks();
+  return true;
+}
+
 }  // namespace flutter
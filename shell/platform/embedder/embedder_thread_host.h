@@ -38,6 +38,8 @@ class EmbedderThreadHost {
 
   bool PostTask(int64_t runner, uint64_t task) const;
 
+  bool RunExpiredTasks(int64_t runner, fml::TimePoint* next_target_time) const;
+
  private:
   ThreadHost host_;
   flutter::TaskRunners runners_;
@@ -62,6 +62,7 @@ class MockDelegate : public PlatformView::Delegate {
               OnPlatformViewMarkTextureFrameAvailable,
               (int64_t texture_id),
               (override));
+  MOCK_METHOD(void, OnPlatformViewPrepareToEmbedPlatformViews, (), (override));
   MOCK_METHOD(void,
               LoadDartDeferredLibrary,
               (intptr_t loading_unit_id,
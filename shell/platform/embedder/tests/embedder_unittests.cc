@@ -23,6 +23,7 @@
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/runtime/dart_vm.h"
+#include "flutter/shell/platform/embedder/embedder_task_runner.h"
 #include "flutter/shell/platform/embedder/tests/embedder_assertions.h"
 #include "flutter/shell/platform/embedder/tests/embedder_config_builder.h"
 #include "flutter/shell/platform/embedder/tests/embedder_test.h"
@@ -200,6 +201,42 @@ TEST_F(EmbedderTest, ImplicitViewNotNull) {
 
 std::atomic_size_t EmbedderTestTaskRunner::sEmbedderTaskRunnerIdentifiers = {};
 
+TEST(EmbedderTaskRunnerTest, CoalescesWakeUpsForPendingTasks) {
+  std::vector<fml::TimePoint> wake_ups;
+  EmbedderTaskRunner::DispatchTable table = {
+      .post_task_callback = [](EmbedderTaskRunner*, uint64_t,
+                               fml::TimePoint) { FAIL(); },
+      .runs_task_on_current_thread_callback = []() { return true; },
+      .wake_up_callback =
+          [&wake_ups](EmbedderTaskRunner*, fml::TimePoint target_time) {
+            wake_ups.push_back(target_time);
+          },
+  };
+  auto embedder_task_runner = fml::MakeRefCounted<EmbedderTaskRunner>(table, 0);
+  fml::RefPtr<fml::TaskRunner> task_runner = embedder_task_runner;
+
+  const fml::TimePoint start = fml::TimePoint::Now();
+  std::vector<int> ran;
+  task_runner->PostTask([&ran]() { ran.push_back(1); });
+  task_runner->PostTask([&ran]() { ran.push_back(2); });
+  task_runner->PostDelayedTask([&ran]() { ran.push_back(3); },
+                               fml::TimeDelta::FromSeconds(3600));
+  // Only the first task moved the earliest target time earlier.
+  ASSERT_EQ(wake_ups.size(), 1u);
+
+  fml::TimePoint next = embedder_task_runner->RunExpiredTasks();
+  EXPECT_EQ(ran, std::vector<int>({1, 2}));
+  EXPECT_GE(next, start + fml::TimeDelta::FromSeconds(3600));
+  EXPECT_EQ(wake_ups.size(), 1u);
+
+  // A task due before the delayed one needs a new wake up.
+  task_runner->PostTask([&ran]() { ran.push_back(4); });
+  ASSERT_EQ(wake_ups.size(), 2u);
+  next = embedder_task_runner->RunExpiredTasks();
+  EXPECT_EQ(ran, std::vector<int>({1, 2, 4}));
+  EXPECT_GE(next, start + fml::TimeDelta::FromSeconds(3600));
+}
+
 TEST_F(EmbedderTest, CanSpecifyCustomPlatformTaskRunner) {
   auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
   fml::AutoResetWaitableEvent latch;
@@ -415,6 +452,70 @@ TEST_F(EmbedderTest, PlatformMessagesCanReceiveResponse) {
 
   captures.latch.Wait();
 }
+TEST_F(EmbedderTest, PlatformMessagesWithoutCopyCanReceiveResponse) {
+  struct Captures {
+    fml::AutoResetWaitableEvent latch;
+    std::thread::id thread_id;
+  };
+  Captures captures;
+
+  CreateNewThread()->PostTask([&]() {
+    captures.thread_id = std::this_thread::get_id();
+    auto& context =
+        GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+    EmbedderConfigBuilder builder(context);
+    builder.SetSoftwareRendererConfig();
+    builder.SetDartEntrypoint("platform_messages_response");
+
+    fml::AutoResetWaitableEvent ready;
+    context.AddNativeCallback(
+        "SignalNativeTest",
+        CREATE_NATIVE_ENTRY(
+            [&ready](Dart_NativeArguments args) { ready.Signal(); }));
+
+    auto engine = builder.LaunchEngine();
+    ASSERT_TRUE(engine.is_valid());
+
+    static std::string kMessageData = "Hello from embedder.";
+
+    FlutterPlatformMessageResponseHandle* response_handle = nullptr;
+    auto callback = [](const uint8_t* data, size_t size,
+                       void* user_data) -> void {
+      ASSERT_EQ(size, kMessageData.size());
+      ASSERT_EQ(strncmp(reinterpret_cast<const char*>(kMessageData.data()),
+                        reinterpret_cast<const char*>(data), size),
+                0);
+      auto captures = reinterpret_cast<Captures*>(user_data);
+      ASSERT_EQ(captures->thread_id, std::this_thread::get_id());
+      captures->latch.Signal();
+    };
+    auto result = FlutterPlatformMessageCreateResponseHandle(
+        engine.get(), callback, &captures, &response_handle);
+    ASSERT_EQ(result, kSuccess);
+
+    // The engine takes the data over and frees it.
+    auto message_data = static_cast<uint8_t*>(malloc(kMessageData.size()));
+    memcpy(message_data, kMessageData.data(), kMessageData.size());
+
+    FlutterPlatformMessage message = {};
+    message.struct_size = sizeof(FlutterPlatformMessage);
+    message.channel = "test_channel";
+    message.message = message_data;
+    message.message_size = kMessageData.size();
+    message.response_handle = response_handle;
+
+    ready.Wait();
+    result =
+        FlutterEngineSendPlatformMessageWithoutCopy(engine.get(), &message);
+    ASSERT_EQ(result, kSuccess);
+
+    result = FlutterPlatformMessageReleaseResponseHandle(engine.get(),
+                                                         response_handle);
+    ASSERT_EQ(result, kSuccess);
+  });
+
+  captures.latch.Wait();
+}
 
 //------------------------------------------------------------------------------
 /// Tests that a platform message can be sent with no response handle. Instead
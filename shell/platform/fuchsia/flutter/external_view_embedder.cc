@@ -7,6 +7,7 @@
 #include <cstdint>
 
 #include "flutter/fml/trace_event.h"
+#include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
@@ -397,10 +398,24 @@ void ExternalViewEmbedder::SubmitFlutterView(
         // Update the image content and set size.
         flatland_->flatland()->SetContent(layers_[layer_index].transform_id,
                                           {surface_for_layer->GetImageId()});
+        // Only the top left of surfaces that are larger than the layer is
+        // drawn into. Images keep their sample region when their surface is
+        // reused, so it is reset once the whole image is drawn into again.
+        const uint32_t image_id = surface_for_layer->GetImageId();
+        const SkISize content_size = surface_for_layer->GetContentSize();
+        const bool cropped = content_size != surface_for_layer->GetSize();
+        if (cropped || cropped_images_.erase(image_id) > 0) {
+          flatland_->flatland()->SetImageSampleRegion(
+              {image_id}, {0.f, 0.f, static_cast<float>(content_size.width()),
+                           static_cast<float>(content_size.height())});
+        }
+        if (cropped) {
+          cropped_images_.insert(image_id);
+        }
         flatland_->flatland()->SetImageDestinationSize(
             {surface_for_layer->GetImageId()},
-            {static_cast<uint32_t>(surface_for_layer->GetSize().width()),
-             static_cast<uint32_t>(surface_for_layer->GetSize().height())});
+            {static_cast<uint32_t>(content_size.width()),
+             static_cast<uint32_t>(content_size.height())});
 
         // Flutter Embedder lacks an API to detect if a layer has alpha or not.
         // For now, we assume any layer beyond the first has alpha.
@@ -474,15 +489,16 @@ void ExternalViewEmbedder::SubmitFlutterView(
 
       sk_sp<SkSurface> sk_surface = surface->GetSkiaSurface();
       FML_CHECK(sk_surface != nullptr);
-      FML_CHECK(SkISize::Make(sk_surface->width(), sk_surface->height()) ==
-                frame_size_);
+      FML_CHECK(surface->GetContentSize() == frame_size_);
       SkCanvas* canvas = sk_surface->getCanvas();
       FML_CHECK(canvas != nullptr);
 
       const auto& layer = frame_layers_.find(surface_index.first);
       FML_CHECK(layer != frame_layers_.end());
 
+      SkAutoCanvasRestore save(canvas, true);
       canvas->setMatrix(SkMatrix::I());
+      canvas->clipRect(SkRect::Make(frame_size_));
       canvas->clear(SK_ColorTRANSPARENT);
       canvas->drawPicture(layer->second.picture);
       if (GrDirectContext* direct_context =
@@ -13,6 +13,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "flutter/flow/embedded_views.h"
@@ -202,6 +203,9 @@ class ExternalViewEmbedder final : public flutter::ExternalViewEmbedder {
 
   std::unordered_map<int64_t, View> views_;
   std::vector<Layer> layers_;
+  // The images of pooled surfaces whose sample region was last set to less
+  // than the whole image.
+  std::unordered_set<uint32_t> cropped_images_;
 
   std::unordered_map<EmbedderLayerId, EmbedderLayer> frame_layers_;
   std::vector<EmbedderLayerId> frame_composition_order_;
@@ -35,6 +35,10 @@ class SurfaceProducerSurface {
 
   virtual SkISize GetSize() const = 0;
 
+  // The size of the region at the top left of the surface that is drawn into
+  // and shown, which is at most |GetSize|.
+  virtual SkISize GetContentSize() const = 0;
+
   virtual void SetImageId(uint32_t image_id) = 0;
 
   virtual uint32_t GetImageId() = 0;
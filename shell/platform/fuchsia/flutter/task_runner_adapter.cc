@@ -36,6 +36,11 @@ class CompatTaskRunner : public fml::TaskRunner {
                            zx::duration(delay.ToNanoseconds()));
   }
 
+  void PostTaskWithDeadline(const fml::closure& task,
+                            fml::TimePoint deadline) override {
+    async::PostTask(forwarding_target_, task);
+  }
+
   bool RunsTasksOnCurrentThread() override {
     return forwarding_target_ == async_get_default_dispatcher();
   }
@@ -89,6 +89,8 @@ class FakeSurfaceProducerSurface : public SurfaceProducerSurface {
     return SkISize::Make(surface_->width(), surface_->height());
   }
 
+  SkISize GetContentSize() const override { return GetSize(); }
+
   void SetImageId(uint32_t image_id) override { image_id_ = image_id; }
   uint32_t GetImageId() override { return image_id_; }
 
@@ -133,6 +133,8 @@ class MockPlatformViewDelegate : public flutter::PlatformView::Delegate {
   // |flutter::PlatformView::Delegate|
   void OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) {}
   // |flutter::PlatformView::Delegate|
+  void OnPlatformViewPrepareToEmbedPlatformViews() {}
+  // |flutter::PlatformView::Delegate|
   std::unique_ptr<std::vector<std::string>> ComputePlatformViewResolvedLocale(
       const std::vector<std::string>& supported_locale_data) {
     return nullptr;
@@ -165,6 +165,7 @@ VulkanSurface::VulkanSurface(
   }
 
   std::fill(size_history_.begin(), size_history_.end(), SkISize::MakeEmpty());
+  content_size_ = size;
 
   wait_.set_object(release_event_.get());
   wait_.set_trigger(ZX_EVENT_SIGNALED);
@@ -193,6 +194,20 @@ SkISize VulkanSurface::GetSize() const {
   return SkISize::Make(sk_surface_->width(), sk_surface_->height());
 }
 
+SkISize VulkanSurface::GetContentSize() const {
+  if (!valid_) {
+    return SkISize::Make(0, 0);
+  }
+
+  return content_size_;
+}
+
+void VulkanSurface::SetContentSize(const SkISize& size) {
+  FML_DCHECK(size.width() <= GetSize().width() &&
+             size.height() <= GetSize().height());
+  content_size_ = size;
+}
+
 vulkan::VulkanHandle<VkSemaphore> VulkanSurface::SemaphoreFromEvent(
     const zx::event& event) const {
   VkResult result;
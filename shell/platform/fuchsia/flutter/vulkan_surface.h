@@ -62,6 +62,13 @@ class VulkanSurface final : public SurfaceProducerSurface {
   // |SurfaceProducerSurface|
   SkISize GetSize() const override;
 
+  // |SurfaceProducerSurface|
+  SkISize GetContentSize() const override;
+
+  // Sets the size of the region the surface is drawn into when it is reused
+  // for a size smaller than its own, see |VulkanSurfacePool|.
+  void SetContentSize(const SkISize& size);
+
   // Note: It is safe for the caller to collect the surface in the
   // |on_writes_committed| callback.
   void SignalWritesFinished(
@@ -172,6 +179,7 @@ class VulkanSurface final : public SurfaceProducerSurface {
   async::WaitMethod<VulkanSurface, &VulkanSurface::OnHandleReady> wait_;
   std::function<void()> pending_on_writes_committed_;
   std::array<SkISize, kSizeHistorySize> size_history_;
+  SkISize content_size_ = SkISize::MakeEmpty();
   int size_history_index_ = 0;
   size_t age_ = 0;
   bool valid_ = false;
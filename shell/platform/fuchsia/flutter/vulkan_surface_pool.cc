@@ -67,26 +67,47 @@ std::unique_ptr<VulkanSurface> VulkanSurfacePool::AcquireSurface(
   return surface;
 }
 
+SkISize VulkanSurfacePool::GetPooledSize(const SkISize& size) {
+  auto align = [](int32_t dimension) {
+    return (dimension + kSurfaceSizeAlignment - 1) / kSurfaceSizeAlignment *
+           kSurfaceSizeAlignment;
+  };
+  return SkISize::Make(align(size.width()), align(size.height()));
+}
+
 std::unique_ptr<VulkanSurface> VulkanSurfacePool::GetCachedOrCreateSurface(
     const SkISize& size) {
   TRACE_EVENT2("flutter", "VulkanSurfacePool::GetCachedOrCreateSurface",
                "width", size.width(), "height", size.height());
-  // First try to find a surface that exactly matches |size|.
-  {
-    auto exact_match_it =
+  // First try to find a surface that exactly matches |size|, and then one
+  // whose size |size| rounds up to.
+  const SkISize pooled_size = GetPooledSize(size);
+  for (const SkISize& match_size : {size, pooled_size}) {
+    auto match_it =
         std::find_if(available_surfaces_.begin(), available_surfaces_.end(),
-                     [&size](const auto& surface) {
-                       return surface->IsValid() && surface->GetSize() == size;
+                     [&match_size](const auto& surface) {
+                       return surface->IsValid() &&
+                              surface->GetSize() == match_size;
                      });
-    if (exact_match_it != available_surfaces_.end()) {
-      auto acquired_surface = std::move(*exact_match_it);
-      available_surfaces_.erase(exact_match_it);
-      TRACE_EVENT_INSTANT0("flutter", "Exact match found");
+    if (match_it != available_surfaces_.end()) {
+      auto acquired_surface = std::move(*match_it);
+      available_surfaces_.erase(match_it);
+      acquired_surface->SetContentSize(size);
+      trace_surfaces_reused_++;
+      if (match_size == size) {
+        TRACE_EVENT_INSTANT0("flutter", "Exact match found");
+      } else {
+        TRACE_EVENT_INSTANT0("flutter", "Size class match found");
+      }
       return acquired_surface;
     }
   }
 
-  return CreateSurface(size);
+  auto surface = CreateSurface(pooled_size);
+  if (surface != nullptr) {
+    surface->SetContentSize(size);
+  }
+  return surface;
 }
 
 void VulkanSurfacePool::SubmitSurface(
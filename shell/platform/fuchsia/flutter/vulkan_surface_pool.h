@@ -21,6 +21,11 @@ class VulkanSurfacePool final {
   static constexpr int kMaxSurfaces = 12;
   // If a surface doesn't get used for 3 or more generations, we discard it.
   static constexpr int kMaxSurfaceAge = 3;
+  // Acquired surfaces are allocated with their width and height rounded up
+  // to a multiple of this, and drawn into at the requested size. A surface
+  // is reused for every size that rounds up to its own, so resizing a layer
+  // doesn't reallocate its images on every frame.
+  static constexpr int kSurfaceSizeAlignment = 128;
 
   VulkanSurfacePool(vulkan::VulkanProvider& vulkan_provider,
                     sk_sp<GrDirectContext> context);
@@ -50,6 +55,8 @@ class VulkanSurfacePool final {
   size_t trace_surfaces_created_ = 0;
   size_t trace_surfaces_reused_ = 0;
 
+  static SkISize GetPooledSize(const SkISize& size);
+
   std::unique_ptr<VulkanSurface> GetCachedOrCreateSurface(const SkISize& size);
 
   void RecycleSurface(std::unique_ptr<VulkanSurface> surface);
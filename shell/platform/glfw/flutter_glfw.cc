@@ -1175,6 +1175,15 @@ void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
       channel, callback, user_data);
 }
 
+void FlutterDesktopMessengerSetBackgroundCallback(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data) {
+  messenger->GetEngine()->message_dispatcher->SetBackgroundMessageCallback(
+      channel, callback, user_data);
+}
+
 FlutterDesktopTextureRegistrarRef FlutterDesktopRegistrarGetTextureRegistrar(
     FlutterDesktopPluginRegistrarRef registrar) {
   std::cerr << "GLFW Texture support is not implemented yet." << std::endl;
@@ -17,6 +17,15 @@ G_DECLARE_FINAL_TYPE(FlGLArea, fl_gl_area, FL, GL_AREA, GtkWidget)
  * FlGLArea:
  *
  * #FlGLArea is a OpenGL drawing area that shows Flutter backing store Layer.
+ *
+ * The engine renders each layer into the framebuffer of an
+ * #FlBackingStoreProvider and the layers are drawn into the window with
+ * gdk_cairo_draw_from_gl() when GTK paints the widget. As long as GDK paints
+ * the window with OpenGL this is a single GPU copy per layer. The layers are
+ * not rendered to an EGL window surface or Wayland subsurface of their own:
+ * GDK doesn't provide one for a widget, and the backing stores, external
+ * textures and the resize synchronization in #FlRenderer all rely on the
+ * #GdkGLContext of the window.
  */
 
 /**
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_standard_message_codec.h"
 #include "flutter/shell/platform/linux/fl_standard_message_codec_private.h"
+#include "flutter/shell/platform/linux/fl_value_private.h"
 
 #include <gmodule.h>
 
@@ -243,7 +244,8 @@ static FlValue* read_uint8_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(uint8_t) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_uint8_list(get_data(buffer, offset), length);
+  FlValue* value = fl_value_new_list_from_bytes(FL_VALUE_TYPE_UINT8_LIST,
+                                                buffer, *offset, length);
   *offset += length;
   return value;
 }
@@ -266,8 +268,8 @@ static FlValue* read_int32_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(int32_t) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_int32_list(
-      reinterpret_cast<const int32_t*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_list_from_bytes(FL_VALUE_TYPE_INT32_LIST,
+                                                buffer, *offset, length);
   *offset += sizeof(int32_t) * length;
   return value;
 }
@@ -290,8 +292,8 @@ static FlValue* read_int64_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(int64_t) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_int64_list(
-      reinterpret_cast<const int64_t*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_list_from_bytes(FL_VALUE_TYPE_INT64_LIST,
+                                                buffer, *offset, length);
   *offset += sizeof(int64_t) * length;
   return value;
 }
@@ -314,8 +316,8 @@ static FlValue* read_float32_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(float) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_float32_list(
-      reinterpret_cast<const float*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_list_from_bytes(FL_VALUE_TYPE_FLOAT32_LIST,
+                                                buffer, *offset, length);
   *offset += sizeof(float) * length;
   return value;
 }
@@ -338,8 +340,8 @@ static FlValue* read_float64_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(double) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_float_list(
-      reinterpret_cast<const double*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_list_from_bytes(FL_VALUE_TYPE_FLOAT_LIST,
+                                                buffer, *offset, length);
   *offset += sizeof(double) * length;
   return value;
 }
@@ -570,6 +570,26 @@ TEST(FlStandardMessageCodecTest, DecodeFloat32List) {
   EXPECT_FLOAT_EQ(data[4], 0.00625f);
 }
 
+TEST(FlStandardMessageCodecTest, DecodeFloat32ListWithoutCopy) {
+  g_autoptr(FlStandardMessageCodec) codec = fl_standard_message_codec_new();
+  GBytes* data = hex_string_to_bytes("0e0200000000803f00000040");
+  const uint8_t* elements =
+      static_cast<const uint8_t*>(g_bytes_get_data(data, nullptr)) + 4;
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlValue) value =
+      fl_message_codec_decode_message(FL_MESSAGE_CODEC(codec), data, &error);
+  g_bytes_unref(data);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(error, nullptr);
+  ASSERT_EQ(fl_value_get_type(value), FL_VALUE_TYPE_FLOAT32_LIST);
+
+  // The list refers to the elements in the message, which it keeps alive.
+  const float* list = fl_value_get_float32_list(value);
+  EXPECT_EQ(reinterpret_cast<const uint8_t*>(list), elements);
+  EXPECT_FLOAT_EQ(list[0], 1.0f);
+  EXPECT_FLOAT_EQ(list[1], 2.0f);
+}
+
 TEST(FlStandardMessageCodecTest, DecodeFloat32ListNoData) {
   decode_error_value("0e", FL_MESSAGE_CODEC_ERROR,
                      FL_MESSAGE_CODEC_ERROR_OUT_OF_DATA);
@@ -3,9 +3,11 @@
 // found in the LICENSE file.
 
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_value.h"
+#include "flutter/shell/platform/linux/fl_value_private.h"
 
 #include <gmodule.h>
 
+#include <cstdint>
 #include <cstring>
 
 struct _FlValue {
@@ -37,30 +39,40 @@ typedef struct {
   FlValue parent;
   uint8_t* values;
   size_t values_length;
+  // If set, @values points into this buffer rather than being owned.
+  GBytes* bytes;
 } FlValueUint8List;
 
 typedef struct {
   FlValue parent;
   int32_t* values;
   size_t values_length;
+  // If set, @values points into this buffer rather than being owned.
+  GBytes* bytes;
 } FlValueInt32List;
 
 typedef struct {
   FlValue parent;
   int64_t* values;
   size_t values_length;
+  // If set, @values points into this buffer rather than being owned.
+  GBytes* bytes;
 } FlValueInt64List;
 
 typedef struct {
   FlValue parent;
   float* values;
   size_t values_length;
+  // If set, @values points into this buffer rather than being owned.
+  GBytes* bytes;
 } FlValueFloat32List;
 
 typedef struct {
   FlValue parent;
   double* values;
   size_t values_length;
+  // If set, @values points into this buffer rather than being owned.
+  GBytes* bytes;
 } FlValueFloatList;
 
 typedef struct {
@@ -81,6 +93,35 @@ static FlValue* fl_value_new(FlValueType type, size_t size) {
   return self;
 }
 
+// Frees the elements of a list of numbers.
+static void free_list_values(gpointer values, GBytes* bytes) {
+  if (bytes != nullptr) {
+    g_bytes_unref(bytes);
+  } else {
+    g_free(values);
+  }
+}
+
+// Creates a list of numbers of type @type whose elements are @data, which
+// must lie within @bytes. @copy is used to create a list with a copy of the
+// elements if @data is not aligned for access as @T.
+template <typename List, typename T>
+static FlValue* fl_value_new_list_from_data(FlValueType type,
+                                            GBytes* bytes,
+                                            const uint8_t* data,
+                                            size_t length,
+                                            FlValue* (*copy)(const T*,
+                                                             size_t)) {
+  if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+    return copy(reinterpret_cast<const T*>(data), length);
+  }
+  List* self = reinterpret_cast<List*>(fl_value_new(type, sizeof(List)));
+  self->values_length = length;
+  self->values = reinterpret_cast<T*>(const_cast<uint8_t*>(data));
+  self->bytes = g_bytes_ref(bytes);
+  return reinterpret_cast<FlValue*>(self);
+}
+
 // Helper function to match GDestroyNotify type.
 static void fl_value_destroy(gpointer value) {
   fl_value_unref(static_cast<FlValue*>(value));
@@ -335,6 +376,33 @@ G_MODULE_EXPORT FlValue* fl_value_new_float_list(const double* data,
   return reinterpret_cast<FlValue*>(self);
 }
 
+FlValue* fl_value_new_list_from_bytes(FlValueType type,
+                                      GBytes* bytes,
+                                      size_t offset,
+                                      size_t length) {
+  const uint8_t* data =
+      static_cast<const uint8_t*>(g_bytes_get_data(bytes, nullptr)) + offset;
+  switch (type) {
+    case FL_VALUE_TYPE_UINT8_LIST:
+      return fl_value_new_list_from_data<FlValueUint8List, uint8_t>(
+          type, bytes, data, length, fl_value_new_uint8_list);
+    case FL_VALUE_TYPE_INT32_LIST:
+      return fl_value_new_list_from_data<FlValueInt32List, int32_t>(
+          type, bytes, data, length, fl_value_new_int32_list);
+    case FL_VALUE_TYPE_INT64_LIST:
+      return fl_value_new_list_from_data<FlValueInt64List, int64_t>(
+          type, bytes, data, length, fl_value_new_int64_list);
+    case FL_VALUE_TYPE_FLOAT32_LIST:
+      return fl_value_new_list_from_data<FlValueFloat32List, float>(
+          type, bytes, data, length, fl_value_new_float32_list);
+    case FL_VALUE_TYPE_FLOAT_LIST:
+      return fl_value_new_list_from_data<FlValueFloatList, double>(
+          type, bytes, data, length, fl_value_new_float_list);
+    default:
+      g_return_val_if_reached(nullptr);
+  }
+}
+
 G_MODULE_EXPORT FlValue* fl_value_new_list() {
   FlValueList* self = reinterpret_cast<FlValueList*>(
       fl_value_new(FL_VALUE_TYPE_LIST, sizeof(FlValueList)));
@@ -382,27 +450,27 @@ G_MODULE_EXPORT void fl_value_unref(FlValue* self) {
     }
     case FL_VALUE_TYPE_UINT8_LIST: {
       FlValueUint8List* v = reinterpret_cast<FlValueUint8List*>(self);
-      g_free(v->values);
+      free_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_INT32_LIST: {
       FlValueInt32List* v = reinterpret_cast<FlValueInt32List*>(self);
-      g_free(v->values);
+      free_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_INT64_LIST: {
       FlValueInt64List* v = reinterpret_cast<FlValueInt64List*>(self);
-      g_free(v->values);
+      free_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_FLOAT32_LIST: {
       FlValueFloat32List* v = reinterpret_cast<FlValueFloat32List*>(self);
-      g_free(v->values);
+      free_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_FLOAT_LIST: {
       FlValueFloatList* v = reinterpret_cast<FlValueFloatList*>(self);
-      g_free(v->values);
+      free_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_LIST: {
@@ -0,0 +1,34 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_value.h"
+
+G_BEGIN_DECLS
+
+/**
+ * fl_value_new_list_from_bytes:
+ * @type: the type of list, one of #FL_VALUE_TYPE_UINT8_LIST,
+ * #FL_VALUE_TYPE_INT32_LIST, #FL_VALUE_TYPE_INT64_LIST,
+ * #FL_VALUE_TYPE_FLOAT32_LIST or #FL_VALUE_TYPE_FLOAT_LIST.
+ * @bytes: a #GBytes containing the elements.
+ * @offset: offset in @bytes of the first element.
+ * @length: number of elements.
+ *
+ * Creates an ordered list of numbers whose elements are read from @bytes. If
+ * the elements are suitably aligned they are not copied; instead the list
+ * keeps a reference to @bytes for as long as it exists.
+ *
+ * Returns: a new #FlValue.
+ */
+FlValue* fl_value_new_list_from_bytes(FlValueType type,
+                                      GBytes* bytes,
+                                      size_t offset,
+                                      size_t length);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/windows/angle_surface_manager.h"
 
+#include <string>
 #include <vector>
 
 #include "flutter/fml/logging.h"
@@ -153,6 +154,12 @@ bool AngleSurfaceManager::Initialize(bool enable_impeller) {
     }
   }
 
+  const char* extensions = eglQueryString(egl_display_, EGL_EXTENSIONS);
+  supports_direct_composition_ =
+      extensions != nullptr &&
+      std::string(extensions).find("EGL_ANGLE_direct_composition") !=
+          std::string::npos;
+
   EGLint numConfigs = 0;
   if (enable_impeller) {
     // First try the MSAA configuration.
@@ -239,14 +246,21 @@ bool AngleSurfaceManager::CreateSurface(WindowsRenderTarget* render_target,
 
   EGLSurface surface = EGL_NO_SURFACE;
 
-  const EGLint surfaceAttributes[] = {
-      EGL_FIXED_SIZE_ANGLE, EGL_TRUE, EGL_WIDTH, width,
-      EGL_HEIGHT,           height,   EGL_NONE};
+  // When available, present through DirectComposition. ANGLE then uses a
+  // flip model swapchain that DWM composes without copying it, which avoids
+  // tearing and a frame of latency, and that can be resized in place.
+  std::vector<EGLint> surface_attributes = {
+      EGL_FIXED_SIZE_ANGLE, EGL_TRUE, EGL_WIDTH, width, EGL_HEIGHT, height};
+  if (supports_direct_composition_) {
+    surface_attributes.push_back(EGL_DIRECT_COMPOSITION_ANGLE);
+    surface_attributes.push_back(EGL_TRUE);
+  }
+  surface_attributes.push_back(EGL_NONE);
 
   surface = eglCreateWindowSurface(
       egl_display_, egl_config_,
       static_cast<EGLNativeWindowType>(std::get<HWND>(*render_target)),
-      surfaceAttributes);
+      surface_attributes.data());
   if (surface == EGL_NO_SURFACE) {
     LogEglError("Surface creation failed.");
     return false;
@@ -272,6 +286,10 @@ void AngleSurfaceManager::ResizeSurface(WindowsRenderTarget* render_target,
   EGLint existing_width, existing_height;
   GetSurfaceDimensions(&existing_width, &existing_height);
   if (width != existing_width || height != existing_height) {
+    if (ResizeSurfaceInPlace(width, height)) {
+      return;
+    }
+
     surface_width_ = width;
     surface_height_ = height;
 
@@ -284,6 +302,27 @@ void AngleSurfaceManager::ResizeSurface(WindowsRenderTarget* render_target,
   }
 }
 
+bool AngleSurfaceManager::ResizeSurfaceInPlace(EGLint width, EGLint height) {
+  if (!supports_direct_composition_ || render_surface_ == EGL_NO_SURFACE) {
+    return false;
+  }
+
+  // Fixed size surfaces take their new size from EGL_WIDTH and EGL_HEIGHT and
+  // resize the swapchain buffers on the next swap. Unlike recreating the
+  // surface, this keeps the last frame on screen while the window is resized.
+  if (eglSurfaceAttrib(egl_display_, render_surface_, EGL_WIDTH, width) !=
+          EGL_TRUE ||
+      eglSurfaceAttrib(egl_display_, render_surface_, EGL_HEIGHT, height) !=
+          EGL_TRUE) {
+    LogEglError("Unable to resize the surface in place");
+    return false;
+  }
+
+  surface_width_ = width;
+  surface_height_ = height;
+  return true;
+}
+
 void AngleSurfaceManager::GetSurfaceDimensions(EGLint* width, EGLint* height) {
   if (render_surface_ == EGL_NO_SURFACE || !initialize_succeeded_) {
     *width = 0;
@@ -111,6 +111,10 @@ class AngleSurfaceManager {
       const EGLint* config,
       bool should_log);
 
+  // Resizes the current surface in place, which only surfaces presented
+  // through DirectComposition support.
+  bool ResizeSurfaceInPlace(EGLint width, EGLint height);
+
   // EGL representation of native display.
   EGLDisplay egl_display_;
 
@@ -128,6 +132,11 @@ class AngleSurfaceManager {
   // creating surfaces.
   bool initialize_succeeded_;
 
+  // Whether ANGLE can present window surfaces through a DirectComposition
+  // visual and a flip model swapchain rather than a blit model swapchain
+  // bound to the HWND.
+  bool supports_direct_composition_ = false;
+
   // Current render_surface that engine will draw into.
   EGLSurface render_surface_ = EGL_NO_SURFACE;
 
@@ -346,6 +346,20 @@ void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
       ->SetMessageCallback(channel, callback, user_data);
 }
 
+void FlutterDesktopMessengerSetBackgroundCallback(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data) {
+  FML_DCHECK(FlutterDesktopMessengerIsAvailable(messenger))
+      << "Messenger must reference a running engine to set a callback";
+
+  flutter::FlutterDesktopMessenger::FromRef(messenger)
+      ->GetEngine()
+      ->message_dispatcher()
+      ->SetBackgroundMessageCallback(channel, callback, user_data);
+}
+
 FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
     FlutterDesktopMessengerRef messenger) {
   return flutter::FlutterDesktopMessenger::FromRef(messenger)
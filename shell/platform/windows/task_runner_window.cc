@@ -8,6 +8,11 @@
 
 #include "flutter/fml/logging.h"
 
+// Only declared by Windows 10 SDKs starting with version 1803.
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
 namespace flutter {
 
 TaskRunnerWindow::TaskRunnerWindow() {
@@ -30,9 +35,35 @@ TaskRunnerWindow::TaskRunnerWindow() {
     OutputDebugString(message);
     LocalFree(message);
   }
+
+  timer_ = CreateWaitableTimerEx(nullptr, nullptr,
+                                 CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                 TIMER_ALL_ACCESS);
+  if (!timer_) {
+    // High resolution timers aren't supported before Windows 10 1803.
+    timer_ = CreateWaitableTimerEx(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+  }
+  if (timer_) {
+    timer_wait_ = CreateThreadpoolWait(OnTimerSignaled, this, nullptr);
+    if (!timer_wait_) {
+      CloseHandle(timer_);
+      timer_ = nullptr;
+    }
+  }
 }
 
 TaskRunnerWindow::~TaskRunnerWindow() {
+  if (timer_wait_) {
+    // Make sure that no callback uses the window once it is destroyed.
+    SetThreadpoolWait(timer_wait_, nullptr, nullptr);
+    WaitForThreadpoolWaitCallbacks(timer_wait_, TRUE);
+    CloseThreadpoolWait(timer_wait_);
+    timer_wait_ = nullptr;
+  }
+  if (timer_) {
+    CloseHandle(timer_);
+    timer_ = nullptr;
+  }
   if (window_handle_) {
     DestroyWindow(window_handle_);
     window_handle_ = nullptr;
@@ -83,12 +114,38 @@ void TaskRunnerWindow::ProcessTasks() {
 }
 
 void TaskRunnerWindow::SetTimer(std::chrono::nanoseconds when) {
+  if (!timer_) {
+    if (when == std::chrono::nanoseconds::max()) {
+      KillTimer(window_handle_, 0);
+    } else {
+      auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(when);
+      ::SetTimer(window_handle_, 0, millis.count() + 1, nullptr);
+    }
+    return;
+  }
+
   if (when == std::chrono::nanoseconds::max()) {
-    KillTimer(window_handle_, 0);
-  } else {
-    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(when);
-    ::SetTimer(window_handle_, 0, millis.count() + 1, nullptr);
+    CancelWaitableTimer(timer_);
+    return;
   }
+  // Negative due times are relative, in 100 nanosecond intervals.
+  LARGE_INTEGER due_time;
+  due_time.QuadPart = -std::max<LONGLONG>(when.count() / 100, 0);
+  if (!SetWaitableTimer(timer_, &due_time, 0, nullptr, nullptr, FALSE)) {
+    FML_LOG(ERROR) << "Failed to set the task runner timer.";
+    WakeUp();
+    return;
+  }
+  // Thread pool waits only fire once, so the wait is set again every time the
+  // timer is.
+  SetThreadpoolWait(timer_wait_, timer_, nullptr);
+}
+
+void CALLBACK TaskRunnerWindow::OnTimerSignaled(PTP_CALLBACK_INSTANCE instance,
+                                                PVOID context,
+                                                PTP_WAIT wait,
+                                                TP_WAIT_RESULT wait_result) {
+  static_cast<TaskRunnerWindow*>(context)->WakeUp();
 }
 
 WNDCLASS TaskRunnerWindow::RegisterWindowClass() {
@@ -45,6 +45,12 @@ class TaskRunnerWindow {
 
   void SetTimer(std::chrono::nanoseconds when);
 
+  // Called on a thread pool thread when |timer_| is signaled.
+  static void CALLBACK OnTimerSignaled(PTP_CALLBACK_INSTANCE instance,
+                                       PVOID context,
+                                       PTP_WAIT wait,
+                                       TP_WAIT_RESULT wait_result);
+
   WNDCLASS RegisterWindowClass();
 
   LRESULT
@@ -61,6 +67,15 @@ class TaskRunnerWindow {
   std::wstring window_class_name_;
   std::vector<Delegate*> delegates_;
 
+  // A waitable timer that is due when the next task is, and the thread pool
+  // wait that wakes up the window once it is signaled. Window timers are
+  // limited to the resolution of the system timer, which is usually 15.6ms,
+  // while high resolution waitable timers fire within a millisecond of their
+  // due time. Both are null if the timer couldn't be created, in which case
+  // the window falls back to a window timer.
+  HANDLE timer_ = nullptr;
+  PTP_WAIT timer_wait_ = nullptr;
+
   FML_DISALLOW_COPY_AND_ASSIGN(TaskRunnerWindow);
 };
 }  // namespace flutter
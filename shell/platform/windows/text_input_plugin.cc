@@ -74,8 +74,8 @@ void TextInputPlugin::TextHook(const std::u16string& text) {
   active_model_->AddText(text);
 
   if (enable_delta_model) {
-    TextEditingDelta delta =
-        TextEditingDelta(text_before_change, selection_before_change, text);
+    TextEditingDelta delta = TextEditingDelta(std::move(text_before_change),
+                                              selection_before_change, text);
     SendStateUpdateWithDelta(*active_model_, &delta);
   } else {
     SendStateUpdate(*active_model_);
@@ -473,8 +473,8 @@ void TextInputPlugin::EnterPressed(TextInputModel* model) {
     TextRange selection_before_change = model->selection();
     model->AddText(u"\n");
     if (enable_delta_model) {
-      TextEditingDelta delta(text_before_change, selection_before_change,
-                             u"\n");
+      TextEditingDelta delta(std::move(text_before_change),
+                             selection_before_change, u"\n");
       SendStateUpdateWithDelta(*model, &delta);
     } else {
       SendStateUpdate(*model);
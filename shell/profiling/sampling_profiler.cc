@@ -62,6 +62,12 @@ void SamplingProfiler::SampleRepeatedly(fml::TimeDelta task_delay) const {
           TRACE_EVENT_INSTANT2("flutter::profiling", "CpuUsage",
                                "total_cpu_usage", total_cpu_usage.c_str(),
                                "num_threads", num_threads.c_str());
+          for (const auto& thread : cpu_usage->engine_threads) {
+            std::string thread_cpu_usage = std::to_string(thread.cpu_usage);
+            TRACE_EVENT_INSTANT2("flutter::profiling", "ThreadCpuUsage",
+                                 "thread", thread.thread_name.c_str(),
+                                 "cpu_usage", thread_cpu_usage.c_str());
+          }
         }
         if (usage.memory_usage) {
           std::string dirty_memory_usage =
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/task_runner.h"
@@ -16,6 +17,16 @@
 
 namespace flutter {
 
+/**
+ * @brief CPU usage of one of the threads that the engine runs its task runners
+ * on, like `io.flutter.1.raster`. `cpu_usage` is the percentage (between [0,
+ * 100]) of a single core that the thread used.
+ */
+struct ThreadCpuUsageInfo {
+  std::string thread_name;
+  double cpu_usage;
+};
+
 /**
  * @brief CPU usage stats. `num_threads` is the number of threads owned by the
  * process. It is to be noted that this is not per shell, there can be multiple
@@ -23,11 +34,13 @@ namespace flutter {
  * 100]) cpu usage of the application. This is across all the cores, for example
  * an application using 100% of all the core will report `total_cpu_usage` as
  * `100`, if it has 100% across 2 cores and 0% across the other cores, embedder
- * must report `total_cpu_usage` as `50`.
+ * must report `total_cpu_usage` as `50`. `engine_threads` breaks the usage of
+ * the UI, raster and IO threads out, for embedders that can tell them apart.
  */
 struct CpuUsageInfo {
   uint32_t num_threads;
   double total_cpu_usage;
+  std::vector<ThreadCpuUsageInfo> engine_threads;
 };
 
 /**
@@ -55,6 +55,29 @@ void main() {
     }
   });
 
+  test('layoutAsync matches synchronous layout', () async {
+    Paragraph buildParagraph() {
+      final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
+        fontFamily: 'FlutterTest',
+        fontSize: 10.0,
+      ));
+      builder.addText('Test Test Test');
+      return builder.build();
+    }
+
+    const ParagraphConstraints constraints = ParagraphConstraints(width: 50.0);
+    final Paragraph expected = buildParagraph()..layout(constraints);
+    final Paragraph paragraph = buildParagraph();
+    await paragraph.layoutAsync(constraints);
+
+    expect(paragraph.width, expected.width);
+    expect(paragraph.height, expected.height);
+    expect(paragraph.numberOfLines, expected.numberOfLines);
+    expect(paragraph.longestLine, expected.longestLine);
+    paragraph.dispose();
+    expected.dispose();
+  });
+
   test('predictably lays out a multi-line paragraph', () {
     for (final double fontSize in <double>[10.0, 20.0, 30.0, 40.0]) {
       final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
@@ -42,6 +42,19 @@ void main() {
             'frameNumber: 23)');
   });
 
+  test('FrameTiming.queueDuration is the time between build and raster', () {
+    final FrameTiming timing = FrameTiming(
+      vsyncStart: 500,
+      buildStart: 1000,
+      buildFinish: 8000,
+      rasterStart: 9000,
+      rasterFinish: 19500,
+      rasterFinishWallTime: 19501,
+      frameNumber: 23,
+    );
+    expect(timing.queueDuration, const Duration(microseconds: 1000));
+  });
+
   test('FrameTiming.toString with cache statistics has the correct format', () {
     final FrameTiming timing = FrameTiming(
       vsyncStart: 500,
@@ -0,0 +1,129 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "txt/fallback_font_manager.h"
+
+#include <functional>
+#include <utility>
+
+#include "flutter/fml/hash_combine.h"
+#include "third_party/skia/include/core/SkString.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+
+namespace txt {
+
+FallbackFontManager::FallbackFontManager(sk_sp<SkFontMgr> font_manager)
+    : font_manager_(std::move(font_manager)) {}
+
+FallbackFontManager::~FallbackFontManager() = default;
+
+size_t FallbackFontManager::GetCachedFallbackCount() const {
+  std::scoped_lock lock(fallbacks_mutex_);
+  return fallbacks_.size();
+}
+
+bool FallbackFontManager::FallbackKey::operator==(
+    const FallbackKey& other) const {
+  return character == other.character && weight == other.weight &&
+         width == other.width && slant == other.slant &&
+         family_name == other.family_name && locales == other.locales;
+}
+
+size_t FallbackFontManager::FallbackKeyHash::operator()(
+    const FallbackKey& key) const {
+  return fml::HashCombine(std::hash<std::string>{}(key.family_name),
+                          std::hash<std::string>{}(key.locales), key.weight,
+                          key.width, key.slant, key.character);
+}
+
+int FallbackFontManager::onCountFamilies() const {
+  return font_manager_->countFamilies();
+}
+
+void FallbackFontManager::onGetFamilyName(int index,
+                                          SkString* familyName) const {
+  font_manager_->getFamilyName(index, familyName);
+}
+
+sk_sp<SkFontStyleSet> FallbackFontManager::onCreateStyleSet(int index) const {
+  return font_manager_->createStyleSet(index);
+}
+
+sk_sp<SkFontStyleSet> FallbackFontManager::onMatchFamily(
+    const char familyName[]) const {
+  return font_manager_->matchFamily(familyName);
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onMatchFamilyStyle(
+    const char familyName[],
+    const SkFontStyle& style) const {
+  return font_manager_->matchFamilyStyle(familyName, style);
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onMatchFamilyStyleCharacter(
+    const char familyName[],
+    const SkFontStyle& style,
+    const char* bcp47[],
+    int bcp47Count,
+    SkUnichar character) const {
+  FallbackKey key;
+  key.family_name = familyName ? familyName : "";
+  for (int i = 0; i < bcp47Count; i++) {
+    key.locales += bcp47[i];
+    key.locales += ',';
+  }
+  key.weight = style.weight();
+  key.width = style.width();
+  key.slant = style.slant();
+  key.character = character;
+
+  {
+    std::scoped_lock lock(fallbacks_mutex_);
+    auto found = fallbacks_.find(key);
+    if (found != fallbacks_.end()) {
+      return found->second;
+    }
+  }
+
+  // Resolve the fallback without holding the lock, it may take a while.
+  sk_sp<SkTypeface> typeface = font_manager_->matchFamilyStyleCharacter(
+      familyName, style, bcp47, bcp47Count, character);
+
+  std::scoped_lock lock(fallbacks_mutex_);
+  if (fallbacks_.size() >= kMaxCachedFallbacks) {
+    fallbacks_.clear();
+  }
+  fallbacks_[std::move(key)] = typeface;
+  return typeface;
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onMakeFromData(sk_sp<SkData> data,
+                                                      int ttcIndex) const {
+  return font_manager_->makeFromData(std::move(data), ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onMakeFromStreamIndex(
+    std::unique_ptr<SkStreamAsset> stream,
+    int ttcIndex) const {
+  return font_manager_->makeFromStream(std::move(stream), ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onMakeFromStreamArgs(
+    std::unique_ptr<SkStreamAsset> stream,
+    const SkFontArguments& args) const {
+  return font_manager_->makeFromStream(std::move(stream), args);
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onMakeFromFile(const char path[],
+                                                      int ttcIndex) const {
+  return font_manager_->makeFromFile(path, ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackFontManager::onLegacyMakeTypeface(
+    const char familyName[],
+    SkFontStyle style) const {
+  return font_manager_->legacyMakeTypeface(familyName, style);
+}
+
+}  // namespace txt
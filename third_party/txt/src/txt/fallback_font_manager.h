@@ -0,0 +1,106 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TXT_FALLBACK_FONT_MANAGER_H_
+#define TXT_FALLBACK_FONT_MANAGER_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkFontMgr.h"
+#include "third_party/skia/include/core/SkStream.h"
+
+namespace txt {
+
+// Wraps a font manager and remembers the typeface it picks for a character
+// that the requested fonts don't have.
+//
+// Text layout asks the platform font manager for a fallback for each missing
+// character, which on most platforms queries the system font configuration
+// every time. Text with many emoji or CJK characters asks for the same few
+// fallbacks over and over. All other calls are forwarded as they are.
+class FallbackFontManager : public SkFontMgr {
+ public:
+  // The most fallbacks that are remembered. The cache is cleared when it is
+  // full.
+  static constexpr size_t kMaxCachedFallbacks = 4096;
+
+  explicit FallbackFontManager(sk_sp<SkFontMgr> font_manager);
+
+  ~FallbackFontManager() override;
+
+  size_t GetCachedFallbackCount() const;
+
+ private:
+  struct FallbackKey {
+    std::string family_name;
+    std::string locales;
+    int weight;
+    int width;
+    int slant;
+    SkUnichar character;
+
+    bool operator==(const FallbackKey& other) const;
+  };
+
+  struct FallbackKeyHash {
+    size_t operator()(const FallbackKey& key) const;
+  };
+
+  const sk_sp<SkFontMgr> font_manager_;
+  mutable std::mutex fallbacks_mutex_;
+  mutable std::unordered_map<FallbackKey, sk_sp<SkTypeface>, FallbackKeyHash>
+      fallbacks_;
+
+  // |SkFontMgr|
+  int onCountFamilies() const override;
+
+  // |SkFontMgr|
+  void onGetFamilyName(int index, SkString* familyName) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onCreateStyleSet(int index) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onMatchFamily(const char familyName[]) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyle(const char familyName[],
+                                       const SkFontStyle&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData>, int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset>,
+                                          int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset>,
+                                         const SkFontArguments&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromFile(const char path[],
+                                   int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[],
+                                         SkFontStyle) const override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FallbackFontManager);
+};
+
+}  // namespace txt
+
+#endif  // TXT_FALLBACK_FONT_MANAGER_H_
@@ -17,6 +17,7 @@
 #include "font_collection.h"
 
 #include <algorithm>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -26,12 +27,17 @@
 #include <vector>
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
+#include "third_party/skia/modules/skparagraph/include/ParagraphCache.h"  // nogncheck
+#include "txt/fallback_font_manager.h"
 #include "txt/platform.h"
 #include "txt/text_style.h"
 
 namespace txt {
 
-FontCollection::FontCollection() : enable_font_fallback_(true) {}
+FontCollection::FontCollection()
+    : enable_font_fallback_(true),
+      enable_paragraph_cache_(true),
+      paragraph_cache_counters_(std::make_shared<ParagraphCacheCounters>()) {}
 
 FontCollection::~FontCollection() {
   if (skt_collection_) {
@@ -43,14 +49,24 @@ size_t FontCollection::GetFontManagersCount() const {
   return GetFontManagerOrder().size();
 }
 
+// Fallbacks for missing characters only come from the default font manager,
+// which is the one that asks the platform.
+static sk_sp<SkFontMgr> WithFallbackCache(sk_sp<SkFontMgr> font_manager) {
+  if (!font_manager) {
+    return nullptr;
+  }
+  return sk_make_sp<FallbackFontManager>(std::move(font_manager));
+}
+
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
-  default_font_manager_ = GetDefaultFontManager(font_initialization_data);
+  default_font_manager_ =
+      WithFallbackCache(GetDefaultFontManager(font_initialization_data));
   skt_collection_.reset();
 }
 
 void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
-  default_font_manager_ = font_manager;
+  default_font_manager_ = WithFallbackCache(std::move(font_manager));
   skt_collection_.reset();
 }
 
@@ -96,6 +112,24 @@ void FontCollection::ClearFontFamilyCache() {
   }
 }
 
+void FontCollection::SetParagraphCacheEnabled(bool enabled) {
+  enable_paragraph_cache_ = enabled;
+  if (skt_collection_) {
+    skt_collection_->getParagraphCache()->turnOn(enabled);
+  }
+}
+
+FontCollection::ParagraphCacheStatistics
+FontCollection::GetParagraphCacheStatistics() const {
+  ParagraphCacheStatistics statistics;
+  statistics.hits = paragraph_cache_counters_->hits.load();
+  statistics.misses = paragraph_cache_counters_->misses.load();
+  if (skt_collection_) {
+    statistics.entries = skt_collection_->getParagraphCache()->count();
+  }
+  return statistics;
+}
+
 sk_sp<skia::textlayout::FontCollection>
 FontCollection::CreateSktFontCollection() {
   if (!skt_collection_) {
@@ -113,6 +147,22 @@ FontCollection::CreateSktFontCollection() {
     if (!enable_font_fallback_) {
       skt_collection_->disableFontFallback();
     }
+
+    skia::textlayout::ParagraphCache* paragraph_cache =
+        skt_collection_->getParagraphCache();
+    paragraph_cache->turnOn(enable_paragraph_cache_);
+    // The cache reports the outcome of every lookup made while shaping a
+    // paragraph. Lookups may happen on any thread that lays out text.
+    paragraph_cache->setChecker(
+        [counters = paragraph_cache_counters_](
+            skia::textlayout::ParagraphImpl* paragraph, const char* event,
+            bool found) {
+          if (std::strcmp(event, "foundParagraph") == 0) {
+            counters->hits++;
+          } else if (std::strcmp(event, "missingParagraph") == 0) {
+            counters->misses++;
+          }
+        });
   }
 
   return skt_collection_;
@@ -17,6 +17,7 @@
 #ifndef LIB_TXT_SRC_FONT_COLLECTION_H_
 #define LIB_TXT_SRC_FONT_COLLECTION_H_
 
+#include <atomic>
 #include <memory>
 #include <set>
 #include <string>
@@ -56,12 +57,36 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   // Construct a Skia text layout FontCollection based on this collection.
   sk_sp<skia::textlayout::FontCollection> CreateSktFontCollection();
 
+  struct ParagraphCacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t entries = 0;
+  };
+
+  // Paragraphs laid out with this collection share a bounded cache of shaped
+  // runs keyed on their text, text styles, placeholders and paragraph style.
+  // Layout skips shaping on a hit and only recomputes line breaks for the
+  // requested width. The cache is enabled by default.
+  void SetParagraphCacheEnabled(bool enabled);
+
+  // Counters for paragraph cache lookups since this collection was created.
+  ParagraphCacheStatistics GetParagraphCacheStatistics() const;
+
  private:
+  struct ParagraphCacheCounters {
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+  };
+
   sk_sp<SkFontMgr> default_font_manager_;
   sk_sp<SkFontMgr> asset_font_manager_;
   sk_sp<SkFontMgr> dynamic_font_manager_;
   sk_sp<SkFontMgr> test_font_manager_;
   bool enable_font_fallback_;
+  bool enable_paragraph_cache_;
+  // Shared with the cache lookup observer installed on |skt_collection_|,
+  // which may outlive this collection.
+  std::shared_ptr<ParagraphCacheCounters> paragraph_cache_counters_;
 
   // An equivalent font collection usable by the Skia text shaper library.
   sk_sp<skia::textlayout::FontCollection> skt_collection_;
@@ -18,7 +18,12 @@
 
 #include <sstream>
 
+#include "flutter/runtime/test_font_data.h"
+#include "txt/asset_font_manager.h"
+#include "txt/fallback_font_manager.h"
 #include "txt/font_collection.h"
+#include "txt/paragraph_builder.h"
+#include "txt/typeface_font_asset_provider.h"
 
 namespace txt {
 namespace testing {
@@ -30,6 +35,51 @@ class FontCollectionTests : public ::testing::Test {
   void SetUp() override {}
 };
 
+// Counts the fallbacks it is asked for and has none.
+class FallbackCountingFontManager : public AssetFontManager {
+ public:
+  FallbackCountingFontManager()
+      : AssetFontManager(std::make_unique<TypefaceFontAssetProvider>()) {}
+
+  int GetFallbackRequests() const { return fallback_requests_; }
+
+ private:
+  mutable int fallback_requests_ = 0;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override {
+    fallback_requests_++;
+    return nullptr;
+  }
+};
+
+TEST_F(FontCollectionTests, FallbackFontManagerRemembersFallbacks) {
+  auto counting_manager = sk_make_sp<FallbackCountingFontManager>();
+  FallbackFontManager font_manager(counting_manager);
+  const char* en[] = {"en"};
+  const char* ja[] = {"ja"};
+
+  font_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), en, 1,
+                                         0x1F600);
+  font_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), en, 1,
+                                         0x1F600);
+  ASSERT_EQ(counting_manager->GetFallbackRequests(), 1);
+
+  font_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), ja, 1,
+                                         0x1F600);
+  font_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle::Bold(), en, 1,
+                                         0x1F600);
+  font_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), en, 1,
+                                         0x1F601);
+  ASSERT_EQ(counting_manager->GetFallbackRequests(), 4);
+  ASSERT_EQ(font_manager.GetCachedFallbackCount(), 4u);
+}
+
 TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
   FontCollection font_collection;
   sk_sp<skia::textlayout::FontCollection> sk_font_collection =
@@ -39,5 +89,48 @@ TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
   sk_font_collection = font_collection.CreateSktFontCollection();
   ASSERT_NE(sk_font_collection->getFallbackManager().get(), nullptr);
 }
+
+TEST_F(FontCollectionTests, ParagraphCacheSkipsShapingIdenticalParagraphs) {
+  auto font_collection = std::make_shared<FontCollection>();
+  auto font_provider = std::make_unique<TypefaceFontAssetProvider>();
+  for (auto& font : flutter::GetTestFontData()) {
+    font_provider->RegisterTypeface(font);
+  }
+  font_collection->SetAssetFontManager(
+      sk_make_sp<AssetFontManager>(std::move(font_provider)));
+
+  auto layout = [&](const std::u16string& text, double width) {
+    auto builder = ParagraphBuilder::CreateSkiaBuilder(
+        ParagraphStyle(), font_collection, /*impeller_enabled=*/false);
+    builder->PushStyle(TextStyle());
+    builder->AddText(text);
+    builder->Pop();
+    builder->Build()->Layout(width);
+  };
+
+  layout(u"List item", 100);
+  auto statistics = font_collection->GetParagraphCacheStatistics();
+  ASSERT_EQ(statistics.hits, 0u);
+  ASSERT_EQ(statistics.misses, 1u);
+  ASSERT_EQ(statistics.entries, 1u);
+
+  // Identical text and styles reuse the shaped runs at any width.
+  layout(u"List item", 100);
+  layout(u"List item", 50);
+  statistics = font_collection->GetParagraphCacheStatistics();
+  ASSERT_EQ(statistics.hits, 2u);
+  ASSERT_EQ(statistics.misses, 1u);
+  ASSERT_EQ(statistics.entries, 1u);
+
+  layout(u"Another item", 100);
+  statistics = font_collection->GetParagraphCacheStatistics();
+  ASSERT_EQ(statistics.misses, 2u);
+
+  font_collection->SetParagraphCacheEnabled(false);
+  layout(u"List item", 100);
+  statistics = font_collection->GetParagraphCacheStatistics();
+  ASSERT_EQ(statistics.hits, 2u);
+  ASSERT_EQ(statistics.misses, 2u);
+}
 }  // namespace testing
 }  // namespace txt
@@ -0,0 +1,94 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "font_subset.h"
+
+namespace font_subset {
+
+template <typename...>
+using void_t = void;
+template <typename T, typename = void>
+struct HarfBuzzSubset {
+  // This is the HarfBuzz 3.0 interface.
+  static HarfbuzzWrappers::HbFacePtr Make(hb_face_t* face, T input) {
+    // The prior version of harfbuzz automatically dropped layout tables,
+    // but in the new version they are kept by default. So re-add them to the
+    // drop list to retain the same behaviour.
+    if (!hb_ot_var_has_data(face) || hb_ot_var_get_axis_count(face) == 0) {
+      // we can only drop GSUB/GPOS/GDEF for non variable fonts, they may be
+      // needed for variable fonts (guessing we need to keep all of these, but
+      // in Material Symbols Icon variable fonts if we drop the GSUB table (they
+      // do not have GPOS/DEF) then the Fill=1,Weight=100 variation is rendered
+      // incorrect. (and other variations are probably less noticibly
+      // incorrect))
+      hb_set_add(hb_subset_input_set(input, HB_SUBSET_SETS_DROP_TABLE_TAG),
+                 HB_TAG('G', 'S', 'U', 'B'));
+      hb_set_add(hb_subset_input_set(input, HB_SUBSET_SETS_DROP_TABLE_TAG),
+                 HB_TAG('G', 'P', 'O', 'S'));
+      hb_set_add(hb_subset_input_set(input, HB_SUBSET_SETS_DROP_TABLE_TAG),
+                 HB_TAG('G', 'D', 'E', 'F'));
+    }
+    return HarfbuzzWrappers::HbFacePtr(hb_subset_or_fail(face, input));
+  }
+};
+
+HarfbuzzWrappers::HbFacePtr SubsetFace(hb_face_t* face,
+                                       hb_subset_input_t* input) {
+  return HarfBuzzSubset<hb_subset_input_t*>::Make(face, input);
+}
+
+HarfbuzzWrappers::HbBlobPtr SubsetFontToGlyphs(
+    hb_blob_t* font,
+    const std::set<uint16_t>& glyphs) {
+  if (glyphs.empty()) {
+    return nullptr;
+  }
+
+  HarfbuzzWrappers::HbFacePtr face(hb_face_create(font, 0));
+  if (face.get() == hb_face_get_empty()) {
+    return nullptr;
+  }
+
+  HarfbuzzWrappers::HbSubsetInputPtr input(hb_subset_input_create_or_fail());
+  if (!input) {
+    return nullptr;
+  }
+  hb_subset_input_set_flags(input.get(), HB_SUBSET_FLAGS_RETAIN_GIDS);
+
+  hb_set_t* glyph_set = hb_subset_input_glyph_set(input.get());
+  for (uint16_t glyph : glyphs) {
+    hb_set_add(glyph_set, glyph);
+  }
+
+  // The subsetter only keeps the character mappings of the requested
+  // codepoints, so request every codepoint that maps to a retained glyph.
+  {
+    hb_set_t* codepoint_set = hb_subset_input_unicode_set(input.get());
+    HarfbuzzWrappers::HbSetPtr codepoints(hb_set_create());
+    hb_face_collect_unicodes(face.get(), codepoints.get());
+    HarfbuzzWrappers::HbFontPtr hb_font(hb_font_create(face.get()));
+    hb_codepoint_t codepoint = HB_SET_VALUE_INVALID;
+    while (hb_set_next(codepoints.get(), &codepoint)) {
+      hb_codepoint_t glyph = 0;
+      if (hb_font_get_nominal_glyph(hb_font.get(), codepoint, &glyph) &&
+          glyphs.count(glyph) > 0) {
+        hb_set_add(codepoint_set, codepoint);
+      }
+    }
+  }
+
+  HarfbuzzWrappers::HbFacePtr subset(
+      hb_subset_or_fail(face.get(), input.get()));
+  if (!subset || subset.get() == hb_face_get_empty()) {
+    return nullptr;
+  }
+
+  HarfbuzzWrappers::HbBlobPtr result(hb_face_reference_blob(subset.get()));
+  if (!hb_blob_get_length(result.get())) {
+    return nullptr;
+  }
+  return result;
+}
+
+}  // namespace font_subset
@@ -0,0 +1,39 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FONT_SUBSET_H_
+#define FONT_SUBSET_H_
+
+#include <hb-subset.h>
+
+#include <cstdint>
+#include <set>
+
+#include "hb_wrappers.h"
+
+namespace font_subset {
+
+// Subsets a face to the codepoints and glyphs in the given input.
+//
+// Layout tables are dropped from fonts without variation axes, matching the
+// output of earlier versions of HarfBuzz.
+HarfbuzzWrappers::HbFacePtr SubsetFace(hb_face_t* face,
+                                       hb_subset_input_t* input);
+
+// Subsets the font data in |font| to the given glyph indices without writing
+// to disk.
+//
+// Glyph indices are retained, so glyphs recorded against the original font
+// refer to the same glyphs in the subset. Characters that map to a retained
+// glyph keep their mapping, and layout tables are kept so that the retained
+// glyphs shape as before.
+//
+// Returns nullptr if the font could not be subset.
+HarfbuzzWrappers::HbBlobPtr SubsetFontToGlyphs(
+    hb_blob_t* font,
+    const std::set<uint16_t>& glyphs);
+
+}  // namespace font_subset
+
+#endif  // FONT_SUBSET_H_
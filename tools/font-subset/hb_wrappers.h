@@ -26,11 +26,16 @@ struct hb_set_deleter {
   void operator()(hb_set_t* ptr) { hb_set_destroy(ptr); }
 };
 
+struct hb_font_deleter {
+  void operator()(hb_font_t* ptr) { hb_font_destroy(ptr); }
+};
+
 using HbBlobPtr = std::unique_ptr<hb_blob_t, hb_blob_deleter>;
 using HbFacePtr = std::unique_ptr<hb_face_t, hb_face_deleter>;
 using HbSubsetInputPtr =
     std::unique_ptr<hb_subset_input_t, hb_subset_input_deleter>;
 using HbSetPtr = std::unique_ptr<hb_set_t, hb_set_deleter>;
+using HbFontPtr = std::unique_ptr<hb_font_t, hb_font_deleter>;
 
 };  // namespace HarfbuzzWrappers
 
@@ -11,6 +11,7 @@
 #include <set>
 #include <string>
 
+#include "font_subset.h"
 #include "hb_wrappers.h"
 
 hb_codepoint_t ParseCodepoint(std::string_view arg, bool& optional) {
@@ -61,33 +62,6 @@ void Usage() {
       << std::endl;
 }
 
-template <typename...>
-using void_t = void;
-template <typename T, typename = void>
-struct HarfBuzzSubset {
-  // This is the HarfBuzz 3.0 interface.
-  static HarfbuzzWrappers::HbFacePtr Make(hb_face_t* face, T input) {
-    // The prior version of harfbuzz automatically dropped layout tables,
-    // but in the new version they are kept by default. So re-add them to the
-    // drop list to retain the same behaviour.
-    if (!hb_ot_var_has_data(face) || hb_ot_var_get_axis_count(face) == 0) {
-      // we can only drop GSUB/GPOS/GDEF for non variable fonts, they may be
-      // needed for variable fonts (guessing we need to keep all of these, but
-      // in Material Symbols Icon variable fonts if we drop the GSUB table (they
-      // do not have GPOS/DEF) then the Fill=1,Weight=100 variation is rendered
-      // incorrect. (and other variations are probably less noticibly
-      // incorrect))
-      hb_set_add(hb_subset_input_set(input, HB_SUBSET_SETS_DROP_TABLE_TAG),
-                 HB_TAG('G', 'S', 'U', 'B'));
-      hb_set_add(hb_subset_input_set(input, HB_SUBSET_SETS_DROP_TABLE_TAG),
-                 HB_TAG('G', 'P', 'O', 'S'));
-      hb_set_add(hb_subset_input_set(input, HB_SUBSET_SETS_DROP_TABLE_TAG),
-                 HB_TAG('G', 'D', 'E', 'F'));
-    }
-    return HarfbuzzWrappers::HbFacePtr(hb_subset_or_fail(face, input));
-  }
-};
-
 int main(int argc, char** argv) {
   if (argc != 3) {
     Usage();
@@ -152,7 +126,7 @@ int main(int argc, char** argv) {
   }
 
   HarfbuzzWrappers::HbFacePtr new_face =
-      HarfBuzzSubset<hb_subset_input_t*>::Make(font_face.get(), input.get());
+      font_subset::SubsetFace(font_face.get(), input.get());
 
   if (!new_face || new_face.get() == hb_face_get_empty()) {
     std::cerr